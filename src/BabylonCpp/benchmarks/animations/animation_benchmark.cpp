@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/animations/_ianimation_state.h>
+#include <babylon/animations/animation.h>
+#include <babylon/animations/ianimation_key.h>
+#include <babylon/animations/runtime_animation.h>
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/transform_node.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/quaternion.h>
+#include <babylon/maths/vector3.h>
+
+namespace {
+
+/**
+ * @brief Creates an animation of the given type with one key per frame.
+ */
+BABYLON::AnimationPtr CreateAnimation(unsigned int dataType, size_t nbKeys,
+                                      const std::string& targetProperty = "property")
+{
+  using namespace BABYLON;
+
+  auto animation = Animation::New("animation", targetProperty, 30, static_cast<int>(dataType));
+  std::vector<IAnimationKey> keys;
+  keys.reserve(nbKeys);
+  for (size_t i = 0; i < nbKeys; ++i) {
+    const auto frame = static_cast<float>(i);
+    switch (dataType) {
+      case Animation::ANIMATIONTYPE_FLOAT:
+        keys.emplace_back(frame, AnimationValue(frame * 0.5f));
+        break;
+      case Animation::ANIMATIONTYPE_VECTOR3:
+        keys.emplace_back(frame, AnimationValue(Vector3(frame, -frame, frame * 0.5f)));
+        break;
+      case Animation::ANIMATIONTYPE_QUATERNION:
+        keys.emplace_back(frame,
+                          AnimationValue(Quaternion::RotationYawPitchRoll(frame * 0.1f, 0.f, 0.f)));
+        break;
+      default:
+        keys.emplace_back(frame, AnimationValue(Matrix::Translation(frame, 0.f, 0.f)));
+        break;
+    }
+  }
+  animation->setKeys(keys);
+  return animation;
+}
+
+} // end of anonymous namespace
+
+TEST(AnimationBenchmark, Interpolate)
+{
+  using namespace BABYLON;
+
+  const std::vector<std::pair<unsigned int, std::string>> dataTypes{
+    {Animation::ANIMATIONTYPE_FLOAT, "float"},
+    {Animation::ANIMATIONTYPE_VECTOR3, "vector3"},
+    {Animation::ANIMATIONTYPE_QUATERNION, "quaternion"},
+    {Animation::ANIMATIONTYPE_MATRIX, "matrix"},
+  };
+
+  for (const auto& [dataType, typeName] : dataTypes) {
+    for (size_t nbKeys : {size_t{10}, size_t{1000}, size_t{10000}}) {
+      auto animation = CreateAnimation(dataType, nbKeys);
+
+      // Plays the whole animation with 10 samples per key
+      const auto nbSamples = nbKeys * 10;
+      const auto name      = "interpolate/" + typeName + "/" + std::to_string(nbKeys) + "_keys";
+      Benchmark::Run("animations", name, 20, nbSamples, "samples",
+                     [&animation, nbKeys, nbSamples]() {
+                       _IAnimationState state;
+                       state.key         = 0;
+                       state.repeatCount = 0;
+                       state.loopMode    = Animation::ANIMATIONLOOPMODE_CYCLE;
+                       const auto step
+                         = static_cast<float>(nbKeys - 1) / static_cast<float>(nbSamples);
+                       for (size_t i = 0; i < nbSamples; ++i) {
+                         animation->_interpolate(static_cast<float>(i) * step, state);
+                       }
+                     });
+    }
+  }
+}
+
+TEST(AnimationBenchmark, InterpolateSeek)
+{
+  using namespace BABYLON;
+
+  constexpr size_t nbKeys    = 10000;
+  constexpr size_t nbSamples = 10000;
+
+  auto animation = CreateAnimation(Animation::ANIMATIONTYPE_VECTOR3, nbKeys);
+
+  // Scrubbing: each sample jumps to a pseudo random frame
+  std::vector<float> frames(nbSamples);
+  uint32_t seed = 1;
+  for (auto& frame : frames) {
+    seed  = seed * 1664525u + 1013904223u;
+    frame = static_cast<float>(seed >> 8) / static_cast<float>(1u << 24)
+            * static_cast<float>(nbKeys - 1);
+  }
+
+  Benchmark::Run("animations", "interpolate_seek/vector3/" + std::to_string(nbKeys) + "_keys", 20,
+                 nbSamples, "samples", [&animation, &frames]() {
+                   _IAnimationState state;
+                   state.key         = 0;
+                   state.repeatCount = 0;
+                   state.loopMode    = Animation::ANIMATIONLOOPMODE_CYCLE;
+                   for (const auto frame : frames) {
+                     animation->_interpolate(frame, state);
+                   }
+                 });
+}
+
+TEST(AnimationBenchmark, RuntimeAnimationSetValue)
+{
+  using namespace BABYLON;
+
+  constexpr size_t nbNodes = 1000;
+
+  NullEngineOptions options;
+  auto engine = NullEngine::New(options);
+  auto scene  = Scene::New(engine.get());
+
+  // Translation, rotation and scaling channels of glTF-like animations, and a
+  // single float channel
+  auto position = CreateAnimation(Animation::ANIMATIONTYPE_VECTOR3, 100, "position");
+  auto rotation = CreateAnimation(Animation::ANIMATIONTYPE_QUATERNION, 100, "rotationQuaternion");
+  auto scaling  = CreateAnimation(Animation::ANIMATIONTYPE_VECTOR3, 100, "scaling");
+  auto scalingX = CreateAnimation(Animation::ANIMATIONTYPE_FLOAT, 100, "scaling.x");
+
+  std::vector<RuntimeAnimationPtr> runtimeAnimations;
+  for (size_t i = 0; i < nbNodes; ++i) {
+    auto node = TransformNode::New("node" + std::to_string(i), scene.get());
+    for (const auto& animation : {position, rotation, scaling, scalingX}) {
+      runtimeAnimations.emplace_back(RuntimeAnimation::New(node, animation, scene.get(), nullptr));
+    }
+  }
+
+  const auto nbChannels = runtimeAnimations.size();
+  Benchmark::Run("animations", "runtime_animation_set_value/" + std::to_string(nbChannels)
+                                 + "_channels",
+                 20, nbChannels, "channels", [&runtimeAnimations]() {
+                   for (const auto& runtimeAnimation : runtimeAnimations) {
+                     runtimeAnimation->goToFrame(42.5f);
+                   }
+                 });
+}
+
+TEST(AnimationBenchmark, AnimateCrowd)
+{
+  using namespace BABYLON;
+
+  constexpr size_t nbCharacters = 2000;
+
+  NullEngineOptions options;
+  auto engine = NullEngine::New(options);
+
+  auto position = CreateAnimation(Animation::ANIMATIONTYPE_VECTOR3, 100, "position");
+  auto rotation = CreateAnimation(Animation::ANIMATIONTYPE_QUATERNION, 100, "rotationQuaternion");
+  auto scaling  = CreateAnimation(Animation::ANIMATIONTYPE_VECTOR3, 100, "scaling");
+
+  for (const auto parallel : {false, true}) {
+    // One looping animatable per character, with a different speed each
+    auto scene                                  = Scene::New(engine.get());
+    scene->useConstantAnimationDeltaTime        = true;
+    scene->parallelAnimationEvaluation          = parallel;
+    scene->parallelAnimationEvaluationThreshold = 1;
+    for (size_t i = 0; i < nbCharacters; ++i) {
+      auto node = TransformNode::New("node" + std::to_string(i), scene.get());
+      scene->beginDirectAnimation(node, {position, rotation, scaling}, 0.f, 99.f, true,
+                                  0.5f + static_cast<float>(i % 10) * 0.1f);
+    }
+
+    const auto name = std::string("animate_crowd/") + (parallel ? "parallel/" : "serial/")
+                      + std::to_string(nbCharacters) + "_animatables";
+    Benchmark::Run("animations", name, 50, nbCharacters, "animatables",
+                   [&scene]() { scene->animate(); });
+  }
+}
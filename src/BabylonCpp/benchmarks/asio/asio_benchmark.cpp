@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <babylon/asio/asio.h>
+#include <babylon/babylon_common.h>
+
+namespace {
+
+const std::vector<std::string> benchmarkAssets = {
+  "fonts/fa-regular-400.ttf",
+  "fonts/fa-solid-900.ttf",
+  "glTF-Sample-Models/2.0/AntiqueCamera/glTF/AntiqueCamera.bin",
+  "glTF-Sample-Models/2.0/AntiqueCamera/glTF/AntiqueCamera.gltf",
+};
+
+struct LoadRunResult {
+  double milliseconds;
+  size_t peakWorkerThreads;
+};
+
+/**
+ * @brief Loads nbRequests assets through the asio service and pumps the
+ * callbacks like an application main loop would.
+ */
+LoadRunResult RunLoad(size_t concurrency, size_t nbRequests)
+{
+  BABYLON::asio::Service_SetConcurrency(concurrency);
+
+  size_t nbCompleted = 0;
+  auto onSuccess     = [&nbCompleted](const BABYLON::ArrayBuffer& /*data*/) { ++nbCompleted; };
+  auto onError       = [&nbCompleted](const std::string& /*message*/) { ++nbCompleted; };
+
+  const auto start = std::chrono::high_resolution_clock::now();
+  for (size_t i = 0; i < nbRequests; ++i) {
+    BABYLON::asio::LoadAssetAsync_Binary(benchmarkAssets[i % benchmarkAssets.size()], onSuccess,
+                                         onError);
+  }
+  while (nbCompleted < nbRequests) {
+    BABYLON::asio::HeartBeat_Sync();
+  }
+  const auto end = std::chrono::high_resolution_clock::now();
+
+  LoadRunResult result;
+  result.milliseconds = std::chrono::duration<double, std::milli>(end - start).count();
+  result.peakWorkerThreads = BABYLON::asio::Service_GetStats().peakWorkerThreads;
+  return result;
+}
+
+} // end of anonymous namespace
+
+TEST(AsioBenchmark, LoadManyAssets)
+{
+#ifndef _WIN32
+  const size_t nbRequests = 400;
+
+  // concurrency == nbRequests emulates the former thread-per-request service.
+  // Runs are done by increasing concurrency, since peakWorkerThreads is a
+  // high-water mark over the service lifetime
+  for (size_t concurrency : {size_t{1}, size_t{4}, size_t{8}, nbRequests}) {
+    const auto result = RunLoad(concurrency, nbRequests);
+    std::cout << "asio: " << nbRequests << " requests, concurrency " << concurrency << ": "
+              << result.milliseconds << " ms, peak worker threads "
+              << result.peakWorkerThreads << std::endl;
+    EXPECT_LE(result.peakWorkerThreads, concurrency);
+  }
+
+  BABYLON::asio::Service_SetConcurrency(4);
+#endif // _WIN32
+}
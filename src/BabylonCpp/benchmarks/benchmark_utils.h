@@ -0,0 +1,176 @@
+#ifndef BABYLON_BENCHMARK_UTILS_H
+#define BABYLON_BENCHMARK_UTILS_H
+
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+namespace BABYLON {
+namespace Benchmark {
+
+/**
+ * @brief Measurements of a benchmark case.
+ */
+struct Result {
+  /** Group of the case (scene, animations, loading, ...) */
+  std::string suite;
+  /** Name of the case, including its size */
+  std::string name;
+  /** Number of timed iterations */
+  size_t iterations = 0;
+  /** Duration of an iteration in milliseconds */
+  double meanMs   = 0.0;
+  double medianMs = 0.0;
+  double minMs    = 0.0;
+  double maxMs    = 0.0;
+  /** Number of items (meshes, keys, vertices, ...) processed by an iteration */
+  size_t items = 0;
+  /** Name of the items */
+  std::string itemsName;
+  /** Items processed per second, based on the median duration */
+  double itemsPerSecond = 0.0;
+  /** Additional measurements (memory, ...) */
+  std::map<std::string, double> counters;
+}; // end of struct Result
+
+/**
+ * @brief Returns the results recorded by the benchmarks of the process.
+ */
+inline std::vector<Result>& Results()
+{
+  static std::vector<Result> results;
+  return results;
+}
+
+/**
+ * @brief Records a result which was not measured with Run() and prints it.
+ */
+inline void Record(const Result& result)
+{
+  std::cout << result.suite << " / " << result.name << ": " << result.medianMs << " ms";
+  if (result.items > 0) {
+    std::cout << " (" << result.itemsPerSecond << " " << result.itemsName << "/s)";
+  }
+  for (const auto& [counter, value] : result.counters) {
+    std::cout << ", " << counter << " " << value;
+  }
+  std::cout << std::endl;
+  Results().emplace_back(result);
+}
+
+/**
+ * @brief Runs the function once to warm up, then times the given number of
+ * iterations individually and records the result.
+ * @param suite defines the group of the case
+ * @param name defines the name of the case
+ * @param iterations defines the number of timed iterations
+ * @param items defines the number of items processed by an iteration
+ * @param itemsName defines the name of the items
+ * @param function defines the function to measure
+ * @returns the measurements
+ */
+template <typename Function>
+Result Run(const std::string& suite, const std::string& name, size_t iterations, size_t items,
+           const std::string& itemsName, Function&& function)
+{
+  function();
+
+  std::vector<double> durations(std::max(iterations, size_t{1}));
+  for (auto& duration : durations) {
+    const auto start = std::chrono::high_resolution_clock::now();
+    function();
+    const auto end = std::chrono::high_resolution_clock::now();
+    duration       = std::chrono::duration<double, std::milli>(end - start).count();
+  }
+  std::sort(durations.begin(), durations.end());
+
+  const auto total = std::accumulate(durations.begin(), durations.end(), 0.0);
+
+  Result result;
+  result.suite      = suite;
+  result.name       = name;
+  result.iterations = durations.size();
+  result.meanMs     = total / static_cast<double>(durations.size());
+  result.medianMs   = durations[durations.size() / 2];
+  result.minMs      = durations.front();
+  result.maxMs      = durations.back();
+  result.items      = items;
+  result.itemsName  = itemsName;
+  if (result.medianMs > 0.0) {
+    result.itemsPerSecond = static_cast<double>(items) * 1000.0 / result.medianMs;
+  }
+  Record(result);
+  return result;
+}
+
+/**
+ * @brief Returns the recorded results with the build information as json.
+ */
+inline nlohmann::json ResultsToJson()
+{
+  auto now = std::time(nullptr);
+  char timestamp[32];
+  std::strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+  nlohmann::json context;
+  context["date"] = timestamp;
+#if defined(__clang__)
+  context["compiler"] = "clang " __clang_version__;
+#elif defined(__GNUC__)
+  context["compiler"] = "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+  context["compiler"] = "msvc " + std::to_string(_MSC_VER);
+#endif
+#ifdef NDEBUG
+  context["build_type"] = "release";
+#else
+  context["build_type"] = "debug";
+#endif
+  context["hardware_threads"] = std::thread::hardware_concurrency();
+
+  auto benchmarks = nlohmann::json::array();
+  for (const auto& result : Results()) {
+    benchmarks.push_back({{"suite", result.suite},
+                          {"name", result.name},
+                          {"iterations", result.iterations},
+                          {"mean_ms", result.meanMs},
+                          {"median_ms", result.medianMs},
+                          {"min_ms", result.minMs},
+                          {"max_ms", result.maxMs},
+                          {"items", result.items},
+                          {"items_name", result.itemsName},
+                          {"items_per_second", result.itemsPerSecond},
+                          {"counters", result.counters}});
+  }
+
+  return {{"context", context}, {"benchmarks", benchmarks}};
+}
+
+/**
+ * @brief Writes the recorded results as json.
+ * @param filename defines the path of the json file
+ * @returns whether the file was written
+ */
+inline bool WriteResults(const std::string& filename)
+{
+  std::ofstream file(filename);
+  if (!file) {
+    return false;
+  }
+  file << ResultsToJson().dump(2) << std::endl;
+  return static_cast<bool>(file);
+}
+
+} // end of namespace Benchmark
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_BENCHMARK_UTILS_H
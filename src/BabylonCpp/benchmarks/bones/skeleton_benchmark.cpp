@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/bones/bone.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/maths/matrix.h>
+
+namespace {
+
+/**
+ * @brief Creates a humanoid like skeleton: a spine with limbs of a few bones.
+ */
+BABYLON::SkeletonPtr CreateSkeleton(BABYLON::Scene* scene, size_t nbBones)
+{
+  using namespace BABYLON;
+
+  auto skeleton = Skeleton::New("skeleton", "skeleton", scene);
+  std::vector<Bone*> createdBones;
+  for (size_t i = 0; i < nbBones; ++i) {
+    auto parent      = i == 0 ? nullptr : createdBones[(i - 1) / 4 * 4];
+    auto rotation    = Matrix::RotationZ(0.05f * static_cast<float>(i % 7));
+    auto localMatrix = rotation.multiply(Matrix::Translation(0.f, 0.1f, 0.f));
+    createdBones.emplace_back(
+      Bone::New("bone" + std::to_string(i), skeleton.get(), parent, localMatrix).get());
+  }
+  return skeleton;
+}
+
+/**
+ * @brief Marks the skeletons as dirty so that every prepare recomputes them.
+ */
+void MarkAsDirty(const std::vector<BABYLON::SkeletonPtr>& skeletons)
+{
+  for (const auto& skeleton : skeletons) {
+    skeleton->_markAsDirty();
+  }
+}
+
+} // end of anonymous namespace
+
+TEST(SkeletonBenchmark, SingleSkeleton)
+{
+  using namespace BABYLON;
+
+  NullEngineOptions options;
+  auto engine = NullEngine::New(options);
+  auto scene  = Scene::New(engine.get());
+
+  const std::vector<SkeletonPtr> skeletons{CreateSkeleton(scene.get(), 1000)};
+  Benchmark::Run("bones", "prepare/1_skeleton_1000_bones", 1000, 1000, "bones", [&skeletons]() {
+    MarkAsDirty(skeletons);
+    skeletons[0]->prepare();
+  });
+}
+
+TEST(SkeletonBenchmark, Crowd)
+{
+  using namespace BABYLON;
+
+  NullEngineOptions options;
+  auto engine = NullEngine::New(options);
+  auto scene  = Scene::New(engine.get());
+
+  std::vector<SkeletonPtr> skeletons;
+  for (size_t i = 0; i < 500; ++i) {
+    skeletons.emplace_back(CreateSkeleton(scene.get(), 64));
+  }
+
+  Benchmark::Run("bones", "prepare/500_skeletons_64_bones/serial", 100, 500 * 64, "bones",
+                 [&skeletons]() {
+                   MarkAsDirty(skeletons);
+                   for (const auto& skeleton : skeletons) {
+                     skeleton->prepare();
+                   }
+                 });
+  Benchmark::Run("bones", "prepare/500_skeletons_64_bones/parallel", 100, 500 * 64, "bones",
+                 [&skeletons]() {
+                   MarkAsDirty(skeletons);
+                   Skeleton::PrepareSkeletons(skeletons);
+                 });
+}
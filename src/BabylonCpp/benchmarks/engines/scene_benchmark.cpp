@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/collisions/picking_info.h>
+#include <babylon/culling/ray.h>
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/meshes/mesh.h>
+
+namespace {
+
+/**
+ * @brief Creates a scene with a camera looking at a grid of n x n boxes, about
+ * half of them in the camera frustum.
+ */
+std::unique_ptr<BABYLON::Scene> CreateGridScene(BABYLON::Engine* engine, size_t n)
+{
+  using namespace BABYLON;
+
+  auto scene  = Scene::New(engine);
+  auto camera = FreeCamera::New("camera", Vector3(0.f, 0.f, -100.f), scene.get());
+  camera->setTarget(Vector3::Zero());
+
+  const auto halfSize = static_cast<float>(n) / 2.f;
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t j = 0; j < n; ++j) {
+      auto box        = Mesh::CreateBox("box", 1.f, scene.get());
+      box->position() = Vector3((static_cast<float>(i) - halfSize) * 2.f,
+                                (static_cast<float>(j) - halfSize) * 2.f, 0.f);
+    }
+  }
+  return scene;
+}
+
+} // end of anonymous namespace
+
+TEST(SceneBenchmark, Render)
+{
+  using namespace BABYLON;
+
+  NullEngineOptions options;
+  auto engine = NullEngine::New(options);
+
+  for (size_t n : {size_t{10}, size_t{32}, size_t{100}}) {
+    auto scene = CreateGridScene(engine.get(), n);
+    Benchmark::Run("scene", "render/" + std::to_string(n * n) + "_meshes", 50, n * n, "meshes",
+                   [&scene]() { scene->render(); });
+  }
+}
+
+TEST(SceneBenchmark, EvaluateActiveMeshes)
+{
+  using namespace BABYLON;
+
+  NullEngineOptions options;
+  auto engine = NullEngine::New(options);
+
+  for (size_t n : {size_t{10}, size_t{32}, size_t{100}}) {
+    auto scene = CreateGridScene(engine.get(), n);
+    // freezeActiveMeshes() runs exactly one active meshes evaluation
+    Benchmark::Run("scene", "evaluate_active_meshes/" + std::to_string(n * n) + "_meshes", 50,
+                   n * n, "meshes", [&scene]() {
+                     scene->freezeActiveMeshes(false);
+                     scene->unfreezeActiveMeshes();
+                   });
+  }
+}
+
+TEST(SceneBenchmark, PickWithRay)
+{
+  using namespace BABYLON;
+
+  NullEngineOptions options;
+  auto engine = NullEngine::New(options);
+
+  for (size_t n : {size_t{10}, size_t{32}, size_t{100}}) {
+    auto scene = CreateGridScene(engine.get(), n);
+    scene->render();
+
+    // Rays cast from the camera side towards points scattered over the grid
+    const auto extent = static_cast<float>(n);
+    std::vector<Ray> rays;
+    for (size_t k = 0; k < 1000; ++k) {
+      const auto angle = static_cast<float>(k) * 0.37f;
+      const Vector3 origin(0.f, 0.f, -100.f);
+      const Vector3 target(std::sin(angle * 2.1f) * extent, std::cos(angle * 0.7f) * extent, 0.f);
+      rays.emplace_back(origin, target.subtract(origin).normalize(), 1000.f);
+    }
+
+    Benchmark::Run("scene", "pick_with_ray/" + std::to_string(n * n) + "_meshes", 10, rays.size(),
+                   "rays", [&scene, &rays]() {
+                     for (const auto& ray : rays) {
+                       scene->pickWithRay(ray, nullptr, false);
+                     }
+                   });
+  }
+}
@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/instrumentation/profiler.h>
+
+TEST(ProfilerBenchmark, Zones)
+{
+  using namespace BABYLON;
+
+  constexpr size_t nbZones = 10000;
+
+  auto& profiler = Profiler::Default();
+
+  Benchmark::Run("profiler", "zone/idle", 20, nbZones, "zones", [&]() {
+    for (size_t i = 0; i < nbZones; ++i) {
+      profiler.beginZone("zone");
+      profiler.endZone();
+    }
+  });
+
+  // Each iteration starts a new capture, which keeps the ring buffers from
+  // filling up
+  Benchmark::Run("profiler", "zone/capturing", 20, nbZones, "zones", [&]() {
+    profiler.start();
+    for (size_t i = 0; i < nbZones; ++i) {
+      profiler.beginZone("zone");
+      profiler.endZone();
+    }
+  });
+
+  const std::string counterName = "counter";
+  Benchmark::Run("profiler", "counter/capturing", 20, nbZones, "zones", [&]() {
+    profiler.start();
+    for (size_t i = 0; i < nbZones; ++i) {
+      profiler.beginZone(counterName);
+      profiler.endZone(counterName);
+    }
+  });
+  profiler.stop();
+
+  EXPECT_EQ(profiler.droppedZones(), 0u);
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/loading/plugins/babylon/babylon_file_loader.h>
+#include <babylon/meshes/abstract_mesh.h>
+
+namespace {
+
+/**
+ * @brief Generates a .babylon scene with nbMeshes grids of n x n quads.
+ */
+std::string GenerateBabylonScene(size_t nbMeshes, size_t n)
+{
+  std::ostringstream oss;
+  oss << R"({"meshes":[)";
+  for (size_t m = 0; m < nbMeshes; ++m) {
+    oss << (m == 0 ? "" : ",") << R"({"name":"grid)" << m << R"(","id":"grid)" << m
+        << R"(","position":[)" << m << R"(,0,0],"positions":[)";
+    for (size_t y = 0; y <= n; ++y) {
+      for (size_t x = 0; x <= n; ++x) {
+        oss << (x + y == 0 ? "" : ",") << x * 0.1f << "," << y * 0.1f << ",0";
+      }
+    }
+    oss << R"(],"normals":[)";
+    for (size_t i = 0; i < (n + 1) * (n + 1); ++i) {
+      oss << (i == 0 ? "" : ",") << "0,0,1";
+    }
+    oss << R"(],"indices":[)";
+    for (size_t y = 0; y < n; ++y) {
+      for (size_t x = 0; x < n; ++x) {
+        const auto a = y * (n + 1) + x, b = a + 1, c = a + n + 2, d = a + n + 1;
+        oss << (x + y == 0 ? "" : ",") << a << "," << b << "," << c << "," << a << "," << c
+            << "," << d;
+      }
+    }
+    oss << "]}";
+  }
+  oss << "]}";
+  return oss.str();
+}
+
+} // end of anonymous namespace
+
+TEST(BabylonFileLoaderBenchmark, ImportMeshes)
+{
+  using namespace BABYLON;
+
+  NullEngineOptions options;
+  auto engine = NullEngine::New(options);
+  auto scene  = Scene::New(engine.get());
+
+  for (size_t nbMeshes : {size_t{10}, size_t{100}}) {
+    const size_t n  = 100;
+    const auto data = GenerateBabylonScene(nbMeshes, n);
+    std::cout << "babylon: " << nbMeshes << " meshes (" << data.size() / (1024 * 1024) << " MB)"
+              << std::endl;
+
+    Benchmark::Run("loading", "babylon/" + std::to_string(nbMeshes) + "_meshes", 5,
+                   nbMeshes * n * n, "quads", [&scene, &data, nbMeshes]() {
+                     BabylonFileLoader loader;
+                     std::vector<AbstractMeshPtr> meshes;
+                     std::vector<IParticleSystemPtr> particleSystems;
+                     std::vector<SkeletonPtr> skeletons;
+                     ASSERT_TRUE(loader.importMesh({}, scene.get(), data, "", meshes,
+                                                   particleSystems, skeletons));
+                     ASSERT_EQ(meshes.size(), nbMeshes);
+                     for (const auto& mesh : meshes) {
+                       mesh->dispose();
+                     }
+                   });
+  }
+}
@@ -0,0 +1,199 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <sstream>
+#include <string>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/asio/asio.h>
+#include <babylon/babylon_common.h>
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/loading/plugins/gltf/gltf_file_loader.h>
+#include <babylon/meshes/abstract_mesh.h>
+
+namespace {
+
+const std::string glbAssetPath = "glb_loading_benchmark.glb";
+
+void AppendUint32(std::string& data, uint32_t value)
+{
+  data.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+/**
+ * @brief Generates a binary glTF with a grid of n x n quads (float positions
+ * and uint32 indices).
+ */
+std::string GenerateGridGlb(size_t n)
+{
+  const auto nbVertices = (n + 1) * (n + 1);
+  const auto nbIndices  = n * n * 6;
+
+  std::string bin;
+  bin.reserve(nbVertices * 3 * sizeof(float) + nbIndices * sizeof(uint32_t));
+  for (size_t y = 0; y <= n; ++y) {
+    for (size_t x = 0; x <= n; ++x) {
+      const float position[3] = {x * 0.1f, y * 0.1f, 0.f};
+      bin.append(reinterpret_cast<const char*>(position), sizeof(position));
+    }
+  }
+  for (size_t y = 0; y < n; ++y) {
+    for (size_t x = 0; x < n; ++x) {
+      const auto a = static_cast<uint32_t>(y * (n + 1) + x), b = a + 1,
+                 c = static_cast<uint32_t>(a + n + 2), d = static_cast<uint32_t>(a + n + 1);
+      for (auto index : {a, b, c, a, c, d}) {
+        AppendUint32(bin, index);
+      }
+    }
+  }
+
+  const auto positionsLength = nbVertices * 3 * sizeof(float);
+  std::ostringstream json;
+  json << R"({"asset":{"version":"2.0"},"scene":0,"scenes":[{"nodes":[0]}],)"
+       << R"("nodes":[{"mesh":0,"name":"grid"}],)"
+       << R"("meshes":[{"primitives":[{"attributes":{"POSITION":0},"indices":1}]}],)"
+       << R"("buffers":[{"byteLength":)" << bin.size() << "}],"
+       << R"("bufferViews":[{"buffer":0,"byteOffset":0,"byteLength":)" << positionsLength
+       << R"(},{"buffer":0,"byteOffset":)" << positionsLength
+       << R"(,"byteLength":)" << bin.size() - positionsLength << "}],"
+       << R"("accessors":[{"bufferView":0,"componentType":5126,"type":"VEC3","count":)"
+       << nbVertices << R"(,"min":[0,0,0],"max":[)" << n * 0.1f << "," << n * 0.1f << ",0]},"
+       << R"({"bufferView":1,"componentType":5125,"type":"SCALAR","count":)" << nbIndices
+       << "}]}";
+  auto jsonChunk = json.str();
+  jsonChunk.append((4 - jsonChunk.size() % 4) % 4, ' ');
+
+  std::string glb;
+  AppendUint32(glb, 0x46546C67); // magic "glTF"
+  AppendUint32(glb, 2);          // version
+  AppendUint32(glb, static_cast<uint32_t>(12 + 8 + jsonChunk.size() + 8 + bin.size()));
+  AppendUint32(glb, static_cast<uint32_t>(jsonChunk.size()));
+  AppendUint32(glb, 0x4E4F534A); // "JSON"
+  glb += jsonChunk;
+  AppendUint32(glb, static_cast<uint32_t>(bin.size()));
+  AppendUint32(glb, 0x004E4942); // "BIN"
+  glb += bin;
+  return glb;
+}
+
+/**
+ * @brief Resets the peak resident set size of the process (Linux only).
+ */
+void ResetPeakResidentMemory()
+{
+  std::ofstream clearRefs("/proc/self/clear_refs");
+  if (clearRefs) {
+    clearRefs << "5";
+  }
+}
+
+/**
+ * @brief Returns the peak resident set size of the process in MB since the
+ * last reset (Linux only, 0 on other platforms).
+ */
+size_t PeakResidentMemoryMB()
+{
+  std::ifstream status("/proc/self/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.rfind("VmHWM:", 0) == 0) {
+      return std::stoul(line.substr(6)) / 1024;
+    }
+  }
+  return 0;
+}
+
+/**
+ * @brief Loads the generated file with the given asio function and imports
+ * it in the scene, like SceneLoader would.
+ */
+template <typename LoadFunction>
+void RunLoad(const std::string& name, size_t nbQuads, BABYLON::Scene* scene, LoadFunction&& load)
+{
+  using namespace BABYLON;
+
+  ResetPeakResidentMemory();
+  const auto start = std::chrono::high_resolution_clock::now();
+
+  std::optional<ArrayBufferView> data;
+  std::optional<std::string> error;
+  load([&data](ArrayBufferView&& fileData) { data = std::move(fileData); },
+       [&error](const std::string& message) { error = message; });
+  while (!data.has_value() && !error.has_value()) {
+    asio::HeartBeat_Sync();
+  }
+  ASSERT_FALSE(error.has_value()) << *error;
+
+  GLTF2::GLTFFileLoader loader;
+  const auto result = loader.importMeshAsync({}, scene, *data, "");
+  data.reset();
+
+  const auto end = std::chrono::high_resolution_clock::now();
+
+  ASSERT_FALSE(result.meshes.empty());
+
+  Benchmark::Result benchmarkResult;
+  benchmarkResult.suite      = "loading";
+  benchmarkResult.name       = "glb/" + name + "/" + std::to_string(nbQuads) + "_quads";
+  benchmarkResult.iterations = 1;
+  benchmarkResult.meanMs     = std::chrono::duration<double, std::milli>(end - start).count();
+  benchmarkResult.medianMs   = benchmarkResult.meanMs;
+  benchmarkResult.minMs      = benchmarkResult.meanMs;
+  benchmarkResult.maxMs      = benchmarkResult.meanMs;
+  benchmarkResult.items      = nbQuads;
+  benchmarkResult.itemsName  = "quads";
+  if (benchmarkResult.medianMs > 0.0) {
+    benchmarkResult.itemsPerSecond
+      = static_cast<double>(nbQuads) * 1000.0 / benchmarkResult.medianMs;
+  }
+  benchmarkResult.counters["peak_resident_memory_mb"]
+    = static_cast<double>(PeakResidentMemoryMB());
+  Benchmark::Record(benchmarkResult);
+  for (const auto& mesh : result.meshes) {
+    mesh->dispose();
+  }
+}
+
+} // end of anonymous namespace
+
+TEST(GLBLoadingBenchmark, ReadVersusMapped)
+{
+  using namespace BABYLON;
+
+  NullEngineOptions options;
+  auto engine = NullEngine::New(options);
+  auto scene  = Scene::New(engine.get());
+
+  for (size_t n : {size_t{300}, size_t{1000}}) {
+    const auto filename = assets_folder() + glbAssetPath;
+    {
+      const auto glb = GenerateGridGlb(n);
+      std::ofstream(filename, std::ios::binary).write(glb.data(),
+                                                      static_cast<std::streamsize>(glb.size()));
+      std::cout << "glb: " << n * n << " quads (" << glb.size() / (1024 * 1024) << " MB)"
+                << std::endl;
+    }
+
+    // Previous path: the file is read in memory, then copied in the view
+    RunLoad("read", n * n, scene.get(), [](auto&& onSuccess, auto&& onError) {
+      asio::LoadAssetAsync_Binary(
+        glbAssetPath,
+        [onSuccess](const ArrayBuffer& data) { onSuccess(ArrayBufferView(data)); }, onError);
+    });
+
+    // The view references the mapped file
+    RunLoad("mapped", n * n, scene.get(), [](auto&& onSuccess, auto&& onError) {
+      asio::LoadAssetAsync_MappedBinary(
+        glbAssetPath,
+        [onSuccess](const ArrayBufferView& data) { onSuccess(ArrayBufferView(data)); }, onError);
+    });
+
+    std::remove(filename.c_str());
+  }
+}
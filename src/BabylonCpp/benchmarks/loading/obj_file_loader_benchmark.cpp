@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/loading/plugins/obj/obj_file_loader.h>
+#include <babylon/meshes/abstract_mesh.h>
+
+namespace {
+
+/**
+ * @brief Generates an obj file with a grid of n x n quads, "v/vt/vn" faces.
+ */
+std::string GenerateGridObj(size_t n)
+{
+  std::ostringstream oss;
+  for (size_t y = 0; y <= n; ++y) {
+    for (size_t x = 0; x <= n; ++x) {
+      oss << "v " << x * 0.1f << " " << y * 0.1f << " 0.0\n";
+      oss << "vt " << x / static_cast<float>(n) << " " << y / static_cast<float>(n) << "\n";
+    }
+  }
+  oss << "vn 0.0 0.0 1.0\n";
+  oss << "o grid\n";
+  for (size_t y = 0; y < n; ++y) {
+    for (size_t x = 0; x < n; ++x) {
+      const auto a = y * (n + 1) + x + 1, b = a + 1, c = a + n + 2, d = a + n + 1;
+      oss << "f " << a << "/" << a << "/1 " << b << "/" << b << "/1 " << c << "/" << c << "/1 "
+          << d << "/" << d << "/1\n";
+    }
+  }
+  return oss.str();
+}
+
+} // end of anonymous namespace
+
+TEST(OBJFileLoaderBenchmark, ParseGrid)
+{
+  using namespace BABYLON;
+
+  NullEngineOptions options;
+  auto engine = NullEngine::New(options);
+  auto scene  = Scene::New(engine.get());
+
+  for (size_t n : {size_t{100}, size_t{300}, size_t{1000}}) {
+    const auto data = GenerateGridObj(n);
+    std::cout << "obj: " << n * n << " quads (" << data.size() / (1024 * 1024) << " MB)"
+              << std::endl;
+
+    Benchmark::Run("loading", "obj/" + std::to_string(n * n) + "_quads", 5, n * n, "quads",
+                   [&scene, &data]() {
+                     OBJFileLoader loader;
+                     const auto meshes = loader.importMesh({}, scene.get(), data);
+                     ASSERT_EQ(meshes.size(), 1u);
+                     meshes[0]->dispose();
+                   });
+  }
+}
@@ -1,7 +1,39 @@
 #include <gmock/gmock.h>
 
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include "benchmark_utils.h"
+
 int main(int argc, char* argv[])
 {
   ::testing::InitGoogleMock(&argc, argv);
-  return RUN_ALL_TESTS();
+
+  // Results file: --benchmark_out=<file>, or the BABYLON_BENCHMARK_OUT
+  // environment variable, or benchmark_results.json
+  std::string outputFile = "benchmark_results.json";
+  if (const auto* value = std::getenv("BABYLON_BENCHMARK_OUT")) {
+    outputFile = value;
+  }
+  const std::string outputFlag = "--benchmark_out=";
+  for (int i = 1; i < argc; ++i) {
+    const std::string argument = argv[i];
+    if (argument.rfind(outputFlag, 0) == 0) {
+      outputFile = argument.substr(outputFlag.size());
+    }
+  }
+
+  const auto status = RUN_ALL_TESTS();
+
+  if (!BABYLON::Benchmark::Results().empty()) {
+    if (BABYLON::Benchmark::WriteResults(outputFile)) {
+      std::cout << "Benchmark results written to " << outputFile << std::endl;
+    }
+    else {
+      std::cerr << "Could not write the benchmark results to " << outputFile << std::endl;
+    }
+  }
+
+  return status;
 }
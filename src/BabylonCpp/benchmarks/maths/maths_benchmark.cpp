@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <vector>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/quaternion.h>
+#include <babylon/maths/vector3.h>
+
+namespace {
+
+constexpr size_t nbElements = 100000;
+
+std::vector<BABYLON::Matrix> CreateMatrices()
+{
+  using namespace BABYLON;
+
+  std::vector<Matrix> matrices;
+  matrices.reserve(nbElements);
+  for (size_t i = 0; i < nbElements; ++i) {
+    const auto angle = static_cast<float>(i) * 0.001f;
+    matrices.emplace_back(Matrix::Compose(Vector3(1.f, 2.f, 3.f),
+                                          Quaternion::RotationYawPitchRoll(angle, angle, angle),
+                                          Vector3(angle, 1.f, -angle)));
+  }
+  return matrices;
+}
+
+} // end of anonymous namespace
+
+TEST(MathsBenchmark, Matrix)
+{
+  using namespace BABYLON;
+
+  auto matrices = CreateMatrices();
+  auto result   = Matrix::Identity();
+
+  Benchmark::Run("maths", "matrix/multiply", 20, nbElements, "matrices", [&]() {
+    for (auto& matrix : matrices) {
+      matrix.multiplyToRef(matrices[0], result);
+    }
+  });
+
+  Benchmark::Run("maths", "matrix/invert", 20, nbElements, "matrices", [&]() {
+    for (const auto& matrix : matrices) {
+      matrix.invertToRef(result);
+    }
+  });
+
+  std::optional<Vector3> scale       = Vector3::Zero();
+  std::optional<Quaternion> rotation = Quaternion::Identity();
+  std::optional<Vector3> translation = Vector3::Zero();
+  Benchmark::Run("maths", "matrix/decompose", 20, nbElements, "matrices", [&]() {
+    for (const auto& matrix : matrices) {
+      matrix.decompose(scale, rotation, translation);
+    }
+  });
+}
+
+TEST(MathsBenchmark, Vector3)
+{
+  using namespace BABYLON;
+
+  const auto transformation = CreateMatrices()[42];
+  std::vector<Vector3> vectors;
+  vectors.reserve(nbElements);
+  for (size_t i = 0; i < nbElements; ++i) {
+    const auto value = static_cast<float>(i);
+    vectors.emplace_back(value, -value, value * 0.5f);
+  }
+  auto result = Vector3::Zero();
+
+  Benchmark::Run("maths", "vector3/transform_coordinates", 20, nbElements, "vectors", [&]() {
+    for (const auto& vector : vectors) {
+      Vector3::TransformCoordinatesToRef(vector, transformation, result);
+    }
+  });
+
+  Benchmark::Run("maths", "vector3/cross_normalize", 20, nbElements, "vectors", [&]() {
+    for (const auto& vector : vectors) {
+      Vector3::CrossToRef(vector, result, result);
+      result.normalize();
+    }
+  });
+}
@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/csg/csg.h>
+#include <babylon/meshes/mesh.h>
+
+TEST(CSGBenchmark, SubtractSphereFromBox)
+{
+  using namespace BABYLON;
+
+  NullEngineOptions options;
+  auto engine = NullEngine::New(options);
+  auto scene  = Scene::New(engine.get());
+
+  auto box  = Mesh::CreateBox("box", 2.f, scene.get());
+  auto csgA = CSG::CSG::FromMesh(box);
+
+  // The BSP tree implementation is quadratic, it is only run on the small
+  // spheres
+  for (unsigned int segments : {12u, 16u, 24u, 64u}) {
+    auto sphere             = Mesh::CreateSphere("sphere", segments, 2.6f, scene.get());
+    auto csgB               = CSG::CSG::FromMesh(sphere);
+    const auto nbTriangles  = sphere->getTotalIndices() / 3;
+    const auto sphereSuffix = std::to_string(nbTriangles) + "_triangles";
+
+    for (bool useBSPTree : {false, true}) {
+      if (useBSPTree && segments > 24) {
+        continue;
+      }
+      CSG::CSG::UseBSPTree = useBSPTree;
+      const auto name = std::string(useBSPTree ? "csg_bsp_tree/" : "csg/") + sphereSuffix;
+      Benchmark::Run("meshes", name, useBSPTree ? 1 : 5, nbTriangles, "triangles",
+                     [&csgA, &csgB]() { csgA->subtract(csgB); });
+    }
+  }
+  CSG::CSG::UseBSPTree = false;
+}
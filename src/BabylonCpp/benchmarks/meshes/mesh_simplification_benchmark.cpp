@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/simplification/quadratic_error_simplification.h>
+
+TEST(MeshSimplificationBenchmark, Decimate)
+{
+  using namespace BABYLON;
+
+  NullEngineOptions options;
+  auto engine = NullEngine::New(options);
+  auto scene  = Scene::New(engine.get());
+
+  for (unsigned int segments : {32u, 128u, 256u}) {
+    auto sphere = Mesh::CreateSphere("sphere", segments, 1.f, scene.get());
+    QuadraticErrorSimplification simplifier(sphere);
+
+    for (float quality : {0.5f, 0.1f}) {
+      // Throughput in removed triangles
+      size_t nbDecimated = 0;
+      {
+        const auto geometry = simplifier.decimate(quality);
+        nbDecimated         = geometry.originalTrianglesCount - geometry.trianglesCount;
+        EXPECT_GT(nbDecimated, 0ull);
+      }
+
+      const auto name = "decimate/" + std::to_string(sphere->getTotalIndices() / 3)
+                        + "_triangles/quality_" + std::to_string(static_cast<int>(quality * 100));
+      Benchmark::Run("meshes", name, 5, nbDecimated, "decimated_triangles",
+                     [&simplifier, quality]() {
+                       const auto geometry = simplifier.decimate(quality);
+                       EXPECT_GT(geometry.trianglesCount, 0ull);
+                     });
+    }
+  }
+}
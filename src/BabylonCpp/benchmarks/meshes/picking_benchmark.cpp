@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/collisions/picking_info.h>
+#include <babylon/culling/ray.h>
+#include <babylon/culling/triangle_bvh.h>
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/geometry.h>
+#include <babylon/meshes/mesh.h>
+
+namespace {
+
+constexpr size_t nbRays = 1000;
+
+/**
+ * @brief Returns rays cast from a circle of radius 3 towards points scattered
+ * around the origin, about half of them hitting a sphere of diameter 1.
+ */
+std::vector<BABYLON::Ray> CreateRays()
+{
+  using namespace BABYLON;
+
+  std::vector<Ray> rays;
+  rays.reserve(nbRays);
+  for (size_t i = 0; i < nbRays; ++i) {
+    const auto angle = static_cast<float>(i) * 0.37f;
+    const Vector3 origin(std::cos(angle) * 3.f, 0.5f, std::sin(angle) * 3.f);
+    const Vector3 target(std::sin(angle * 2.1f) * 0.6f, std::cos(angle * 0.7f) * 0.6f, 0.f);
+    rays.emplace_back(origin, target.subtract(origin).normalize(), 100.f);
+  }
+  return rays;
+}
+
+} // end of anonymous namespace
+
+TEST(PickingBenchmark, PickWithRay)
+{
+  using namespace BABYLON;
+
+  NullEngineOptions options;
+  auto engine = NullEngine::New(options);
+  auto rays   = CreateRays();
+
+  for (unsigned int segments : {16u, 64u, 256u}) {
+    auto scene             = Scene::New(engine.get());
+    auto sphere            = Mesh::CreateSphere("sphere", segments, 1.f, scene.get());
+    const auto nbTriangles = sphere->getTotalIndices() / 3;
+
+    // The BVH is built by the warm up iteration of Benchmark::Run
+    std::vector<size_t> nbHits;
+    for (bool useTriangleBVH : {false, true}) {
+      scene->useTriangleBVHForPicking = useTriangleBVH;
+      const auto name = std::string("pick_with_ray/") + (useTriangleBVH ? "bvh/" : "brute_force/")
+                        + std::to_string(nbTriangles) + "_triangles";
+      size_t hits = 0;
+      Benchmark::Run("meshes", name, 10, nbRays, "rays", [&scene, &rays, &hits]() {
+        hits = 0;
+        for (const auto& ray : rays) {
+          const auto pickingInfo = scene->pickWithRay(ray);
+          if (pickingInfo && pickingInfo->hit) {
+            ++hits;
+          }
+        }
+      });
+      nbHits.emplace_back(hits);
+    }
+    EXPECT_GT(nbHits[0], 0ull);
+    EXPECT_EQ(nbHits[0], nbHits[1]);
+  }
+}
+
+TEST(PickingBenchmark, BuildTriangleBVH)
+{
+  using namespace BABYLON;
+
+  NullEngineOptions options;
+  auto engine = NullEngine::New(options);
+  auto scene  = Scene::New(engine.get());
+
+  for (unsigned int segments : {64u, 256u}) {
+    auto sphere            = Mesh::CreateSphere("sphere", segments, 1.f, scene.get());
+    auto geometry          = sphere->geometry();
+    const auto indexCount  = geometry->_indices.size();
+    const auto nbTriangles = indexCount / 3;
+    ASSERT_TRUE(geometry->_generatePointsArray());
+
+    Benchmark::Run("meshes", "build_triangle_bvh/" + std::to_string(nbTriangles) + "_triangles", 10,
+                   nbTriangles, "triangles", [&geometry, indexCount]() {
+                     geometry->_triangleBVHs.clear();
+                     ASSERT_NE(geometry->_getTriangleBVH(0, indexCount), nullptr);
+                   });
+  }
+}
@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/vertex_data.h>
+
+namespace {
+
+std::unique_ptr<BABYLON::VertexData> CreateSphereVertexData(unsigned int segments)
+{
+  using namespace BABYLON;
+
+  SphereOptions options;
+  options.segments = segments;
+  options.diameter = 1.f;
+  return VertexData::CreateSphere(options);
+}
+
+} // end of anonymous namespace
+
+TEST(VertexDataBenchmark, ComputeNormals)
+{
+  using namespace BABYLON;
+
+  for (unsigned int segments : {32u, 128u, 512u}) {
+    const auto vertexData = CreateSphereVertexData(segments);
+    Float32Array normals(vertexData->positions.size());
+    Benchmark::Run("meshes", "compute_normals/" + std::to_string(segments) + "_segments", 20,
+                   vertexData->positions.size() / 3, "vertices", [&vertexData, &normals]() {
+                     VertexData::ComputeNormals(vertexData->positions, vertexData->indices,
+                                                normals);
+                   });
+  }
+}
+
+TEST(VertexDataBenchmark, Merge)
+{
+  using namespace BABYLON;
+
+  for (size_t nbMerges : {size_t{10}, size_t{100}}) {
+    const auto source = CreateSphereVertexData(32);
+    Benchmark::Run("meshes", "merge/" + std::to_string(nbMerges) + "_spheres", 20,
+                   nbMerges * source->positions.size() / 3, "vertices", [&source, nbMerges]() {
+                     VertexData merged;
+                     for (size_t i = 0; i < nbMerges; ++i) {
+                       merged.merge(*source, true);
+                     }
+                   });
+  }
+}
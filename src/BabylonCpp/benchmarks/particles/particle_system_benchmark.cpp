@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/particles/particle.h>
+#include <babylon/particles/particle_system.h>
+
+namespace {
+
+/**
+ * @brief Fills the particle system with long living particles, then measures
+ * its update step.
+ */
+void RunUpdate(const std::string& name, BABYLON::ParticleSystem& particleSystem, size_t capacity)
+{
+  particleSystem.manualEmitCount = static_cast<int>(capacity);
+  particleSystem.start();
+  particleSystem.animate(true);
+
+  BABYLON::Benchmark::Run("particles", name, 100, capacity, "particles",
+                          [&particleSystem]() { particleSystem.animate(true); });
+}
+
+} // end of anonymous namespace
+
+TEST(ParticleSystemBenchmark, DefaultVersusCustomUpdate)
+{
+  using namespace BABYLON;
+
+  NullEngineOptions options;
+  auto engine = NullEngine::New(options);
+  auto scene  = Scene::New(engine.get());
+
+  for (size_t capacity : {size_t{10000}, size_t{100000}}) {
+    const auto createParticleSystem = [&]() {
+      // Owned by the scene
+      auto particleSystem               = new ParticleSystem("particles", capacity, scene.get());
+      particleSystem->emitter           = Vector3::Zero();
+      particleSystem->minLifeTime       = 1000.f;
+      particleSystem->maxLifeTime       = 1000.f;
+      particleSystem->minAngularSpeed   = -1.f;
+      particleSystem->maxAngularSpeed   = 1.f;
+      particleSystem->gravity           = Vector3(0.f, -9.81f, 0.f);
+      particleSystem->preWarmStepOffset = 1;
+      return particleSystem;
+    };
+
+    // Default update, vectorized over the arrays of the particle store
+    auto defaultParticleSystem = createParticleSystem();
+    RunUpdate("update/default/" + std::to_string(capacity) + "_particles", *defaultParticleSystem,
+              capacity);
+    EXPECT_EQ(defaultParticleSystem->getActiveCount(), capacity);
+
+    // Same update written per particle through handles
+    auto customParticleSystem            = createParticleSystem();
+    customParticleSystem->updateFunction = [](std::vector<Particle>& particles) {
+      for (auto& particle : particles) {
+        const auto step = particle.particleSystem->updateSpeed;
+        particle.age() += step;
+        particle.angle() += particle.angularSpeed() * step;
+        particle.setDirection(particle.direction().add(Vector3(0.f, -9.81f * step, 0.f)));
+        particle.setPosition(particle.position().add(particle.direction().scale(step)));
+      }
+    };
+    RunUpdate("update/per_particle/" + std::to_string(capacity) + "_particles",
+              *customParticleSystem, capacity);
+    EXPECT_EQ(customParticleSystem->getActiveCount(), capacity);
+  }
+}
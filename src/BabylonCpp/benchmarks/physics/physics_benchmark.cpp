@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <string>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/physics/native/native_physics_body.h>
+#include <babylon/physics/native/native_physics_plugin.h>
+#include <babylon/physics/native/native_physics_shape.h>
+#include <babylon/physics/native/native_physics_world.h>
+
+namespace {
+
+constexpr size_t nbSteps = 30;
+
+/**
+ * @brief Fills a world with a static ground and columns of alternating spheres
+ * and boxes dropped on it, 4 bodies high.
+ */
+void CreateBodies(BABYLON::NativePhysicsWorld& world, size_t nbBodies)
+{
+  using namespace BABYLON;
+
+  world.createBody(NativePhysicsShape::CreateBox(Vector3(100.f, 0.5f, 100.f)), 0.f,
+                   Vector3(0.f, -0.5f, 0.f), Quaternion());
+  const auto sphere  = NativePhysicsShape::CreateSphere(0.4f);
+  const auto box     = NativePhysicsShape::CreateBox(Vector3(0.4f, 0.4f, 0.4f));
+  const auto columns = nbBodies / 4;
+  const auto rows    = static_cast<size_t>(std::ceil(std::sqrt(static_cast<float>(columns))));
+  for (size_t i = 0; i < nbBodies; ++i) {
+    const auto column = i / 4;
+    const auto x      = static_cast<float>(column % rows) * 2.f - static_cast<float>(rows);
+    const auto y      = 0.5f + static_cast<float>(i % 4) * 1.1f;
+    const auto z      = static_cast<float>(column / rows) * 2.f - static_cast<float>(rows);
+    world.createBody(i % 2 ? sphere : box, 1.f, Vector3(x, y, z), Quaternion());
+  }
+}
+
+} // end of anonymous namespace
+
+TEST(PhysicsBenchmark, NativePhysicsStep)
+{
+  using namespace BABYLON;
+
+  NullEngineOptions options;
+  auto engine = NullEngine::New(options);
+
+  for (size_t nbBodies : {1000u, 10000u}) {
+    // The plugin drives the world through the physics engine of the scene, as
+    // in an application, one fixed step per frame
+    auto scene = Scene::New(engine.get());
+    NativePhysicsPlugin plugin(false);
+    ASSERT_TRUE(scene->enablePhysics(Vector3(0.f, -9.81f, 0.f), &plugin));
+
+    // The bodies are recreated by each iteration, before they fall asleep
+    const auto name = "native_physics_step/" + std::to_string(nbBodies) + "_bodies";
+    Benchmark::Run("physics", name, 3, nbSteps, "steps", [&scene, &plugin, nbBodies]() {
+      plugin.dispose();
+      CreateBodies(plugin.physicsWorld(), nbBodies);
+      for (size_t step = 0; step < nbSteps; ++step) {
+        scene->_advancePhysicsEngineStep(1000.f / 60.f);
+      }
+    });
+    EXPECT_GT(plugin.physicsWorld().manifoldCount(), 0ull);
+
+    scene->disablePhysicsEngine();
+  }
+}
@@ -0,0 +1,37 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "../benchmark_utils.h"
+
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/rendering/edges_renderer.h>
+
+TEST(EdgesRendererBenchmark, GenerateEdgesLines)
+{
+  using namespace BABYLON;
+
+  NullEngineOptions options;
+  auto engine = NullEngine::New(options);
+  auto scene  = Scene::New(engine.get());
+
+  // Up to a million triangles, the cases by vertices include the welding of
+  // the vertices
+  for (unsigned int segments : {64u, 256u, 512u}) {
+    auto sphere            = Mesh::CreateSphere("sphere", segments, 1.f, scene.get());
+    const auto nbTriangles = sphere->getTotalIndices() / 3;
+    const auto suffix      = std::to_string(nbTriangles) + "_triangles";
+
+    for (bool checkVerticesInsteadOfIndices : {false, true}) {
+      const auto name = std::string(checkVerticesInsteadOfIndices ? "edges_by_vertices/" :
+                                                                    "edges_by_indices/")
+                        + suffix;
+      Benchmark::Run("rendering", name, 5, nbTriangles, "triangles",
+                     [&sphere, checkVerticesInsteadOfIndices]() {
+                       EdgesRenderer edgesRenderer(sphere, 0.95f, checkVerticesInsteadOfIndices);
+                     });
+    }
+  }
+}
@@ -128,6 +128,30 @@ public:
    */
   bool _animate(const millisecond_t& delay);
 
+  /**
+   * @brief Hidden
+   * Returns whether the animatable can be evaluated on a worker thread (see
+   * Scene::parallelAnimationEvaluation) and prepares its animations for it.
+   */
+  bool _prepareConcurrentEvaluation();
+
+  /**
+   * @brief Hidden
+   * First phase of _animate(): updates the delays and evaluates the runtime
+   * animations without setting any value on the targets.
+   */
+  void _evaluate(const millisecond_t& delay);
+
+  /**
+   * @brief Hidden
+   * Second phase of _animate(): sets the evaluated values on the targets,
+   * raises the callbacks and removes the animatable from the scene at its end.
+   * The evaluation is discarded, and the animatable animated again, when its
+   * state was changed by a callback since _evaluate().
+   * @returns a boolean indicating if the animatable is running
+   */
+  bool _applyEvaluation();
+
 protected:
   /**
    * @brief Creates a new Animatable
@@ -187,6 +211,19 @@ private:
    */
   void _raiseOnAnimationEnd();
 
+  /**
+   * @brief Updates the delays of the animatable at the start of an animation
+   * step.
+   * @returns whether the runtime animations must be animated
+   */
+  bool _updateDelays(const millisecond_t& delay);
+
+  /**
+   * @brief Ends an animation step, disposing the animatable when it is not
+   * running anymore.
+   */
+  bool _endAnimate(bool running);
+
 public:
   /**
    * Defines the target object
@@ -275,6 +312,11 @@ private:
   float _speedRatio;
   float _weight;
   Animatable* _syncRoot;
+  bool _isEvaluated;
+  millisecond_t _evaluationDelay;
+  // Whether the animatable was paused, restarted, stopped, moved or had its
+  // speed ratio or weight changed since its last evaluation
+  bool _stateChangedSinceEvaluation;
 
 }; // end of class Animatable
 
@@ -5,6 +5,7 @@
 #include <unordered_map>
 
 #include <babylon/animations/animation_event.h>
+#include <babylon/animations/animation_key_track.h>
 #include <babylon/animations/animation_range.h>
 #include <babylon/animations/animation_value.h>
 #include <babylon/animations/easing/ieasing_function.h>
@@ -488,6 +489,12 @@ public:
    */
   AnimationValue _interpolate(float currentFrame, _IAnimationState& state);
 
+  /**
+   * @brief Hidden Rebuilds the key track read by _interpolate when the keys or
+   * the data type changed.
+   */
+  void _updateKeyTrack();
+
   /**
    * @brief Defines the function to use to interpolate matrices.
    * @param startValue defines the start matrix
@@ -632,6 +639,16 @@ private:
    */
   std::vector<IAnimationKey> _keys;
 
+  /**
+   * Stores the key frames in typed arrays for interpolation
+   */
+  AnimationKeyTrack _keyTrack;
+
+  /**
+   * Whether the keys may have changed since the key track was built
+   */
+  bool _keyTrackIsDirty = true;
+
   /**
    * Stores the easing function of the animation
    */
@@ -0,0 +1,114 @@
+#ifndef BABYLON_ANIMATIONS_ANIMATION_KEY_TRACK_H
+#define BABYLON_ANIMATIONS_ANIMATION_KEY_TRACK_H
+
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/maths/color3.h>
+#include <babylon/maths/color4.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/quaternion.h>
+#include <babylon/maths/size.h>
+#include <babylon/maths/vector2.h>
+#include <babylon/maths/vector3.h>
+
+namespace BABYLON {
+
+struct IAnimationKey;
+
+/**
+ * @brief Hidden
+ * Keys of an animation stored in contiguous arrays: the frames, the values and
+ * tangents in arrays of the data type of the animation, and per key flags. This
+ * is the layout read by Animation::_interpolate.
+ */
+class BABYLON_SHARED_EXPORT AnimationKeyTrack {
+
+public:
+  /**
+   * Values and tangents of the keys, the tangent arrays are empty when no key
+   * has tangents
+   */
+  template <typename T>
+  struct Values {
+    std::vector<T> values;
+    std::vector<T> inTangents;
+    std::vector<T> outTangents;
+  }; // end of struct Values
+
+  /**
+   * Flags of the keys
+   */
+  static constexpr uint8_t HasInTangent  = 1;
+  static constexpr uint8_t HasOutTangent = 2;
+  static constexpr uint8_t Step          = 4;
+
+public:
+  /**
+   * @brief Rebuilds the track from animation keys.
+   * @param keys defines the keys, sorted by frame
+   * @param dataType defines the data type of the animation
+   */
+  void build(const std::vector<IAnimationKey>& keys, unsigned int dataType);
+
+  /**
+   * @brief Finds the segment [key, key + 1] holding a frame: the first one
+   * whose end frame is greater or equal to the frame. The segment of the
+   * previous lookup and the next one are tried first, a binary search is used
+   * on seeks.
+   * @param frame defines the frame, between the first and the last keys
+   * @param cursor defines the segment of the previous lookup, updated with the
+   * segment found
+   * @returns the index of the start key of the segment
+   */
+  size_t findSegment(float frame, int& cursor) const;
+
+  /**
+   * @brief Returns the values of the keys of a type.
+   */
+  template <typename T>
+  [[nodiscard]] const Values<T>& get() const
+  {
+    return std::get<Values<T>>(_values);
+  }
+
+  template <typename T>
+  Values<T>& get()
+  {
+    return std::get<Values<T>>(_values);
+  }
+
+public:
+  /**
+   * Frames of the keys
+   */
+  std::vector<float> frames;
+
+  /**
+   * Flags of the keys
+   */
+  std::vector<uint8_t> flags;
+
+  /**
+   * Whether all the values and tangents are of the data type of the animation
+   * and were stored in the typed arrays
+   */
+  bool typed = false;
+
+  /**
+   * Data type of the animation when the track was built
+   */
+  unsigned int dataType = 0;
+
+private:
+  std::tuple<Values<float>, Values<Vector2>, Values<Vector3>, Values<Quaternion>, Values<Size>,
+             Values<Color3>, Values<Color4>, Values<Matrix>>
+    _values;
+
+}; // end of class AnimationKeyTrack
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_ANIMATIONS_ANIMATION_KEY_TRACK_H
@@ -13,10 +13,13 @@ namespace BABYLON {
 class Animatable;
 class Animation;
 class AnimationEvent;
+class Bone;
 class IAnimatable;
 struct IAnimationKey;
+class MorphTarget;
 class RuntimeAnimation;
 class Scene;
+class TransformNode;
 using AnimationPtr        = std::shared_ptr<Animation>;
 using IAnimatablePtr      = std::shared_ptr<IAnimatable>;
 using RuntimeAnimationPtr = std::shared_ptr<RuntimeAnimation>;
@@ -100,6 +103,44 @@ public:
   bool animate(millisecond_t delay, float from, float to, bool loop, float speedRatio,
                float weight = -1.f);
 
+  /**
+   * @brief Hidden
+   * Returns whether _evaluate() can run on a worker thread, and builds what the
+   * evaluation would otherwise build lazily in shared objects.
+   */
+  bool _prepareConcurrentEvaluation();
+
+  /**
+   * @brief Hidden
+   * First half of animate(): computes the current frame and interpolates the
+   * value of the animation into the evaluation slot of the runtime animation.
+   * Neither the target nor any user callback is touched, so runtime animations
+   * of different animatables can be evaluated concurrently.
+   */
+  void _evaluate(millisecond_t delay, float from, float to, bool loop, float speedRatio);
+
+  /**
+   * @brief Hidden
+   * Second half of animate(): raises the loop callback, sets the evaluated value
+   * on the target and fires the animation events.
+   * @param weight defines the weight of the animation (default is -1 so no weight)
+   * @returns a boolean indicating if the animation is running
+   */
+  bool _applyEvaluation(float weight = -1.f);
+
+  /**
+   * @brief Hidden
+   * Returns whether _evaluate() was called since the last _applyEvaluation().
+   */
+  [[nodiscard]] bool _hasPendingEvaluation() const;
+
+  /**
+   * @brief Hidden
+   * Drops the pending evaluation, the state of the runtime animation is left as
+   * before the _evaluate() call.
+   */
+  void _discardEvaluation();
+
 protected:
   /**
    * @brief Create a new RuntimeAnimation object.
@@ -142,7 +183,58 @@ protected:
   bool get_isAdditive() const;
 
 private:
+  /**
+   * @brief Typed binding of the animated property of a target, resolved once
+   * from the target property path so that the values of each frame are
+   * written without going through IAnimatable::setProperty.
+   */
+  struct PropertyBinding {
+    enum class Kind {
+      // Not bound, the value is set with IAnimatable::setProperty
+      None,
+      Position,
+      Rotation,
+      RotationQuaternion,
+      Scaling,
+      // A float member of a vector of a transform node ("position.x"), written
+      // through the vector accessor so that the node is marked as moved
+      PositionComponent,
+      RotationComponent,
+      ScalingComponent,
+      BoneMatrix,
+      MorphTargetInfluence,
+    };
+    Kind kind                    = Kind::None;
+    unsigned int dataType        = 0;
+    TransformNode* transformNode = nullptr;
+    Bone* bone                   = nullptr;
+    MorphTarget* morphTarget     = nullptr;
+    float Vector3::*component    = nullptr;
+  }; // end of struct PropertyBinding
+
+  /**
+   * @brief Result of the last _evaluate() call, used by _applyEvaluation().
+   */
+  struct Evaluation {
+    // Whether the evaluation was not applied yet
+    bool pending = false;
+    // Whether the animation has a target property
+    bool evaluated = false;
+    bool running   = false;
+    // Whether the animation looped since the previous evaluation
+    bool looped = false;
+    float from  = 0.f;
+    float range = 0.f;
+    float frame = 0.f;
+    // Delay and ratio committed as the previous ones when applied
+    millisecond_t delay{0};
+    float ratio = 0.f;
+    AnimationValue value;
+  }; // end of struct Evaluation
+
   void _preparePath(const IAnimatablePtr& target, unsigned int targetIndex = 0);
+  void _bindProperty(const IAnimatablePtr& target);
+  bool _applyBinding(const AnimationValue& value) const;
   void _getOriginalValues(unsigned int targetIndex = 0);
   void _setValue(const IAnimatablePtr& target, const IAnimatablePtr& destination,
                  const AnimationValue& currentValue, float weight, unsigned int targetIndex = 0);
@@ -258,6 +350,16 @@ private:
   IAnimatablePtr _currentActiveTarget;
   IAnimatablePtr _directTarget;
 
+  /**
+   * The binding of the animated property of the direct target
+   */
+  PropertyBinding _binding;
+
+  /**
+   * The evaluation slot of the runtime animation
+   */
+  Evaluation _evaluation;
+
   /**
    * The target path of the runtime animation
    */
@@ -4,6 +4,8 @@
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_common.h>
 #include <babylon/asio/callback_types.h>
+#include <babylon/core/array_buffer_view.h>
+#include <chrono>
 #include <variant>
 #include <functional>
 #include <string>
@@ -11,7 +13,27 @@
 namespace BABYLON {
 namespace asio {
 
+/**
+ * @brief Priority of a load request: queued requests are started in
+ * decreasing priority order, in FIFO order within a given priority.
+ */
+enum class LoadPriority : int { Low = -1, Normal = 0, High = 1 };
 
+/**
+ * @brief Snapshot of the io service state (see Service_GetStats)
+ */
+struct IoServiceStats {
+  // Maximum number of simultaneous io worker threads
+  size_t concurrency = 0;
+  // Number of io worker threads currently alive
+  size_t workerThreads = 0;
+  // Maximum number of io worker threads alive at the same time
+  size_t peakWorkerThreads = 0;
+  // Number of requests queued or running
+  size_t pendingRequests = 0;
+  // Number of requests whose io is finished (callbacks may still be pending)
+  size_t completedRequests = 0;
+};
 
 /**
  * @brief LoadAssetAsync_Text will load a text resource *asynchronously*
@@ -21,7 +43,8 @@ BABYLON_SHARED_EXPORT void
 LoadAssetAsync_Text(
   const std::string& assetPath, const OnSuccessFunction<std::string>& onSuccessFunction,
   const OnErrorFunction& onErrorFunction,
-  const OnProgressFunction& onProgressFunction = nullptr);
+  const OnProgressFunction& onProgressFunction = nullptr,
+  LoadPriority priority = LoadPriority::Normal);
 
 /**
  * @brief LoadAssetAsync_Text will load a binary resource *asynchronously*
@@ -31,7 +54,23 @@ BABYLON_SHARED_EXPORT void LoadAssetAsync_Binary(
   const std::string& assetPath,
   const OnSuccessFunction<ArrayBuffer>& onSuccessFunction,
   const OnErrorFunction& onErrorFunction,
-  const OnProgressFunction& onProgressFunction = nullptr);
+  const OnProgressFunction& onProgressFunction = nullptr,
+  LoadPriority priority = LoadPriority::Normal);
+
+/**
+ * @brief LoadAssetAsync_MappedBinary will load a binary resource *asynchronously*
+ * and raise the given callbacks *synchronously*.
+ * The file is memory mapped when the platform supports it: the view reads the
+ * file content in place, its pages are loaded lazily and can be released
+ * with ArrayBufferView::releasePages() once the data has been consumed.
+ * Falls back to reading the file in memory otherwise.
+ */
+BABYLON_SHARED_EXPORT void LoadAssetAsync_MappedBinary(
+  const std::string& assetPath,
+  const OnSuccessFunction<ArrayBufferView>& onSuccessFunction,
+  const OnErrorFunction& onErrorFunction,
+  const OnProgressFunction& onProgressFunction = nullptr,
+  LoadPriority priority = LoadPriority::Normal);
 
 /**
  * @brief HeartBeat_Sync: call this in the app's main loop:
@@ -42,6 +81,23 @@ BABYLON_SHARED_EXPORT void LoadAssetAsync_Binary(
  */
 BABYLON_SHARED_EXPORT void HeartBeat_Sync();
 
+/**
+ * @brief HeartBeat_Sync(timeBudget): budgeted variant of HeartBeat_Sync.
+ * Runs the pending callbacks *synchronously* until the queue is empty or
+ * until timeBudget is spent (at least one callback is run per call).
+ * Interactive apps typically pass a couple of milliseconds per frame, headless
+ * tools can pass a larger budget in order to finish loads faster.
+ *
+ * @return the number of callbacks that were run
+ */
+BABYLON_SHARED_EXPORT size_t HeartBeat_Sync(std::chrono::nanoseconds timeBudget);
+
+/**
+ * @brief GetCallbackQueueStats: queue depth and callback latency statistics
+ */
+BABYLON_SHARED_EXPORT CallbackQueueStats GetCallbackQueueStats();
+BABYLON_SHARED_EXPORT void ResetCallbackQueueStats();
+
 
 /**
  * @brief HasRemainingTasks: returns true if io downloads or callbacks are still pending
@@ -57,6 +113,17 @@ BABYLON_SHARED_EXPORT void Service_WaitAll_Sync();
 
 BABYLON_SHARED_EXPORT void Service_Stop();
 
+/**
+ * @brief Service_SetConcurrency: sets the maximum number of io worker threads
+ * (by default, the number of cores clamped to [2, 8])
+ */
+BABYLON_SHARED_EXPORT void Service_SetConcurrency(size_t concurrency);
+
+/**
+ * @brief Service_GetStats: returns the io worker pool state and counters
+ */
+BABYLON_SHARED_EXPORT IoServiceStats Service_GetStats();
+
 /**
  * Desesperate patch for glTF loading
  */
@@ -1,6 +1,7 @@
 #ifndef BABYLONCPP_CALLBACK_TYPES_H
 #define BABYLONCPP_CALLBACK_TYPES_H
 
+#include <cstddef>
 #include <string>
 #include <functional>
 
@@ -15,6 +16,23 @@ std::function<   void (bool lengthComputable, size_t loaded, size_t total)  >;
 template<typename DataType>
 using OnSuccessFunction = std::function<void(const DataType& data)>;
 
+/**
+ * @brief Statistics about the synchronous callbacks queue (see HeartBeat_Sync)
+ */
+struct CallbackQueueStats {
+  // Number of callbacks waiting to be run
+  size_t queueDepth = 0;
+  // Number of callbacks run by the last heartbeat
+  size_t lastHeartBeatCallbacks = 0;
+  // Duration of the last heartbeat
+  double lastHeartBeatMilliseconds = 0.;
+  // Number of callbacks run since the last reset
+  size_t totalCallbacks = 0;
+  // Delay between the time a callback is queued and the time it is run
+  double averageLatencyMilliseconds = 0.;
+  double maxLatencyMilliseconds = 0.;
+};
+
 
 } // namespace asio
 } // namespace BABYLON
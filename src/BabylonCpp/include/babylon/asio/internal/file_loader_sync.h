@@ -19,6 +19,14 @@ ArrayBufferOrErrorMessage LoadFileSync_Binary(
   const OnProgressFunction& onProgressFunction
   );
 
+/**
+ * @brief Memory maps a file (reads it in memory if it cannot be mapped)
+ */
+ArrayBufferViewOrErrorMessage MapFileSync_Binary(
+  const std::string& filename,
+  const OnProgressFunction& onProgressFunction
+  );
+
 
 } // namespace internal
 } // namespace asio
@@ -0,0 +1,109 @@
+#ifndef BABYLONCPP_IO_WORKER_POOL_H
+#define BABYLONCPP_IO_WORKER_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+namespace BABYLON {
+namespace asio {
+namespace sync_io_impl {
+
+/**
+ * @brief Bounded pool of I/O worker threads.
+ *
+ * Jobs are dequeued by priority (highest first), FIFO within a priority.
+ * Threads are spawned lazily, never more than concurrency() at a time, and
+ * sleep on a condition variable when there is no work.
+ */
+class IoWorkerPool {
+public:
+  using Job = std::function<void()>;
+
+public:
+  explicit IoWorkerPool(size_t concurrency);
+  ~IoWorkerPool();
+
+  IoWorkerPool(const IoWorkerPool&) = delete;
+  IoWorkerPool& operator=(const IoWorkerPool&) = delete;
+
+  /**
+   * @brief Queues a job. If the pool is stopped before the job runs,
+   * onDropped is called instead.
+   * @returns false if the pool is stopped: the job is not queued and neither
+   * function is called
+   */
+  bool submit(Job job, int priority, Job onDropped = nullptr);
+
+  /**
+   * @brief Changes the maximum number of worker threads. Shrinking waits for
+   * the retired workers to finish their current job.
+   */
+  void setConcurrency(size_t concurrency);
+  size_t concurrency() const;
+
+  size_t workerThreadCount() const;
+  size_t peakWorkerThreadCount() const;
+  size_t pendingJobCount() const;
+
+  /**
+   * @brief Returns true if no job is queued or running.
+   */
+  bool idle() const;
+  void waitIdle();
+
+  /**
+   * @brief Drops the queued jobs, calling their onDropped function, and joins
+   * all the workers.
+   */
+  void stop();
+
+  static size_t DefaultConcurrency();
+
+private:
+  struct QueuedJob {
+    int priority;
+    uint64_t sequence;
+    Job job;
+    Job onDropped;
+    bool operator<(const QueuedJob& other) const
+    {
+      if (priority != other.priority) {
+        return priority < other.priority;
+      }
+      return sequence > other.sequence;
+    }
+  };
+
+  struct Worker {
+    std::thread thread;
+    bool retired = false;
+  };
+
+  void _spawnWorkerIfNeeded();
+  void _workerProc(Worker* worker);
+
+private:
+  mutable std::mutex _mutex;
+  std::condition_variable _jobAvailable;
+  std::condition_variable _becameIdle;
+  std::priority_queue<QueuedJob> _jobs;
+  std::list<Worker> _workers;
+  size_t _concurrency;
+  size_t _idleWorkers;
+  size_t _runningJobs;
+  size_t _peakWorkers;
+  uint64_t _sequence;
+  bool _stopRequested;
+}; // end of class IoWorkerPool
+
+} // namespace sync_io_impl
+} // namespace asio
+} // namespace BABYLON
+
+#endif // BABYLONCPP_IO_WORKER_POOL_H
@@ -0,0 +1,91 @@
+#ifndef BABYLONCPP_MPSC_QUEUE_H
+#define BABYLONCPP_MPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+namespace BABYLON {
+namespace asio {
+
+/**
+ * @brief Unbounded lock-free multi-producer / single-consumer queue (Vyukov).
+ *
+ * Any thread may push(); only one thread at a time (the main thread, which
+ * runs the synchronous callbacks) may call try_pop().
+ */
+template <typename T>
+class MpscQueue {
+private:
+  struct Node {
+    std::atomic<Node*> next{nullptr};
+    T value{};
+  };
+
+public:
+  MpscQueue() : _head{new Node}, _tail{_head.load(std::memory_order_relaxed)}
+  {
+  }
+
+  ~MpscQueue()
+  {
+    T dummy;
+    while (try_pop(dummy)) {
+    }
+    delete _tail;
+  }
+
+  MpscQueue(const MpscQueue&) = delete;
+  MpscQueue& operator=(const MpscQueue&) = delete;
+
+  void push(T value)
+  {
+    auto node   = new Node;
+    node->value = std::move(value);
+    _size.fetch_add(1, std::memory_order_relaxed);
+    Node* prev = _head.exchange(node, std::memory_order_acq_rel);
+    prev->next.store(node, std::memory_order_release);
+  }
+
+  /**
+   * @brief Pops the oldest element. May transiently return false while a
+   * producer is between its two push steps, even if size() > 0.
+   */
+  bool try_pop(T& out)
+  {
+    Node* tail = _tail;
+    Node* next = tail->next.load(std::memory_order_acquire);
+    if (next == nullptr) {
+      return false;
+    }
+    out   = std::move(next->value);
+    next->value = T{};
+    _tail = next;
+    delete tail;
+    _size.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+  }
+
+  /**
+   * @brief Approximate number of queued elements.
+   */
+  size_t size() const
+  {
+    return _size.load(std::memory_order_relaxed);
+  }
+
+  bool empty() const
+  {
+    return size() == 0;
+  }
+
+private:
+  std::atomic<Node*> _head;
+  Node* _tail;
+  std::atomic<size_t> _size{0};
+}; // end of class MpscQueue
+
+} // namespace asio
+} // namespace BABYLON
+
+#endif // BABYLONCPP_MPSC_QUEUE_H
@@ -1,6 +1,8 @@
 #ifndef BABYLONCPP_SYNC_CALLBACK_RUNNER_H
 #define BABYLONCPP_SYNC_CALLBACK_RUNNER_H
 
+#include <babylon/asio/callback_types.h>
+#include <chrono>
 #include <functional>
 
 namespace BABYLON {
@@ -14,10 +16,17 @@ namespace sync_callback_runner {
 
 void PushCallback(const VoidCallback & function);
 void HeartBeat();
+// Runs callbacks until the queue is empty or until timeBudget is spent
+// (at least one callback is run). A zero budget means "until empty".
+// Returns the number of callbacks that were run.
+size_t HeartBeat(std::chrono::nanoseconds timeBudget);
 bool HasRemainingCallbacks();
 
 void CallAllPendingCallbacks();
 
+CallbackQueueStats GetStats();
+void ResetStats();
+
 } // namespace sync_callback_runner
 } // namespace asio
 } // namespace BABYLON
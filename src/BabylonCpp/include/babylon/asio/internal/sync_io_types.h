@@ -2,6 +2,7 @@
 #define BABYLONCPP_SYNC_IO_TYPES_H
 
 #include <babylon/babylon_common.h>
+#include <babylon/core/array_buffer_view.h>
 #include <string>
 #include <variant>
 #include <functional>
@@ -12,6 +13,7 @@ namespace sync_io_impl
 {
 using ArrayBufferOrErrorMessage = std::variant<ArrayBuffer, ErrorMessage>;
 using SyncLoaderFunction = std::function<ArrayBufferOrErrorMessage()>;
+using ArrayBufferViewOrErrorMessage = std::variant<ArrayBufferView, ErrorMessage>;
 
 } // namespace internal
 } // namespace asio
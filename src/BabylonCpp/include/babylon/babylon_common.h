@@ -5,6 +5,7 @@
 #include <cstdint>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace BABYLON {
@@ -300,6 +301,84 @@ private:
   TSetter const _setter;
 };
 
+// -- Observed Strings -- //
+
+/**
+ * @brief String field reporting its assignments to its owner, which can then
+ * re-key the structures indexed by the field. Reads behave as a std::string.
+ * Copies and strings converted to an ObservedString are detached from the owner.
+ */
+template <typename C>
+class ObservedString : public std::string {
+public:
+  using TCallback = void (C::*)();
+
+  ObservedString(C* owner, TCallback onChanged, const std::string& value = "")
+      : std::string{value}, _owner{owner}, _onChanged{onChanged}
+  {
+  }
+
+  ObservedString(const std::string& value = "") // NOLINT
+      : std::string{value}, _owner{nullptr}, _onChanged{nullptr}
+  {
+  }
+
+  ObservedString(const char* value) // NOLINT
+      : std::string{value}, _owner{nullptr}, _onChanged{nullptr}
+  {
+  }
+
+  ObservedString(const ObservedString& other)
+      : std::string{other}, _owner{nullptr}, _onChanged{nullptr}
+  {
+  }
+
+  ObservedString& operator=(const ObservedString& value) // NOLINT
+  {
+    return *this = static_cast<const std::string&>(value);
+  }
+
+  ObservedString& operator=(const std::string& value)
+  {
+    std::string::operator=(value);
+    _notify();
+    return *this;
+  }
+
+  ObservedString& operator=(std::string&& value)
+  {
+    std::string::operator=(std::move(value));
+    _notify();
+    return *this;
+  }
+
+  ObservedString& operator=(const char* value)
+  {
+    std::string::operator=(value);
+    _notify();
+    return *this;
+  }
+
+  ObservedString& operator+=(const std::string& value)
+  {
+    std::string::operator+=(value);
+    _notify();
+    return *this;
+  }
+
+private:
+  void _notify()
+  {
+    if (_owner) {
+      (_owner->*_onChanged)();
+    }
+  }
+
+private:
+  C* const _owner;
+  TCallback const _onChanged;
+};
+
 inline std::string babylon_repo_folder()
 {
   static std::string repo_dir = BABYLON_REPO_FOLDER;
@@ -0,0 +1,125 @@
+#ifndef BABYLON_BAKED_VERTEX_ANIMATION_BAKED_VERTEX_ANIMATION_MANAGER_H
+#define BABYLON_BAKED_VERTEX_ANIMATION_BAKED_VERTEX_ANIMATION_MANAGER_H
+
+#include <memory>
+#include <string>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/maths/vector4.h>
+
+namespace BABYLON {
+
+class BakedVertexAnimationManager;
+class Effect;
+class RawTexture;
+class Scene;
+using BakedVertexAnimationManagerPtr = std::shared_ptr<BakedVertexAnimationManager>;
+using EffectPtr                      = std::shared_ptr<Effect>;
+using RawTexturePtr                  = std::shared_ptr<RawTexture>;
+
+/**
+ * @brief Class used to play animations baked in a texture by a
+ * VertexAnimationBaker. The bone matrices of the current frame are read from
+ * the texture in the vertex shader, the skeleton of the mesh is no longer
+ * evaluated on the CPU.
+ *
+ * The settings of the animation (start frame, end frame, frame offset and
+ * speed in frames per second) are read from animationParameters, or per
+ * instance from the "bakedVertexAnimationSettingsInstanced" thin instance
+ * attribute, which lets each instance play its own clip with its own offset.
+ */
+class BABYLON_SHARED_EXPORT BakedVertexAnimationManager {
+
+public:
+  template <typename... Ts>
+  static BakedVertexAnimationManagerPtr New(Ts&&... args)
+  {
+    return std::shared_ptr<BakedVertexAnimationManager>(
+      new BakedVertexAnimationManager(std::forward<Ts>(args)...));
+  }
+  ~BakedVertexAnimationManager(); // = default
+
+  /**
+   * @brief Returns the string "BakedVertexAnimationManager".
+   */
+  [[nodiscard]] std::string getClassName() const;
+
+  /**
+   * @brief Returns whether the manager is ready to be used: it has a texture
+   * and the texture is ready.
+   */
+  bool isReady();
+
+  /**
+   * @brief Binds the uniforms and the texture of the animation to an effect.
+   * @param effect defines the effect to bind to
+   * @param useInstances defines whether the settings are read from the per
+   * instance attribute instead of the animationParameters uniform
+   */
+  void bind(const EffectPtr& effect, bool useInstances = false);
+
+  /**
+   * @brief Sets the settings of the animation played by the meshes without
+   * instances.
+   * @param startFrame defines the first frame of the clip in the texture
+   * @param endFrame defines the last frame of the clip in the texture
+   * @param offset defines the offset added to the current frame
+   * @param speedFramesPerSecond defines the playback speed
+   */
+  void setAnimationParameters(float startFrame, float endFrame, float offset = 0.f,
+                              float speedFramesPerSecond = 30.f);
+
+  /**
+   * @brief Disposes the manager.
+   * @param forceDisposeTextures defines whether the texture is disposed too
+   */
+  void dispose(bool forceDisposeTextures = false);
+
+protected:
+  /**
+   * @brief Creates a new BakedVertexAnimationManager.
+   * @param scene defines the current scene
+   */
+  BakedVertexAnimationManager(Scene* scene = nullptr);
+
+  RawTexturePtr& get_texture();
+  void set_texture(const RawTexturePtr& value);
+  [[nodiscard]] bool get_isEnabled() const;
+  void set_isEnabled(bool value);
+
+private:
+  void _markSubMeshesAsAttributesDirty();
+
+public:
+  /**
+   * The texture holding the baked bone matrices, one row per frame
+   */
+  Property<BakedVertexAnimationManager, RawTexturePtr> texture;
+
+  /**
+   * Whether the baked animation is played by the meshes using this manager
+   */
+  Property<BakedVertexAnimationManager, bool> isEnabled;
+
+  /**
+   * The settings of the animation: start frame, end frame, frame offset and
+   * speed in frames per second
+   */
+  Vector4 animationParameters;
+
+  /**
+   * The time of the animation in seconds, advanced by the application
+   */
+  float time;
+
+private:
+  Scene* _scene;
+  RawTexturePtr _texture;
+  bool _isEnabled;
+
+}; // end of class BakedVertexAnimationManager
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_BAKED_VERTEX_ANIMATION_BAKED_VERTEX_ANIMATION_MANAGER_H
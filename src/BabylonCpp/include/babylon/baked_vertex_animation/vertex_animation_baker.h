@@ -0,0 +1,119 @@
+#ifndef BABYLON_BAKED_VERTEX_ANIMATION_VERTEX_ANIMATION_BAKER_H
+#define BABYLON_BAKED_VERTEX_ANIMATION_VERTEX_ANIMATION_BAKER_H
+
+#include <memory>
+#include <nlohmann/json_fwd.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+using json = nlohmann::json;
+
+namespace BABYLON {
+
+class AbstractMesh;
+class Animation;
+class AnimationGroup;
+class AnimationRange;
+class IAnimatable;
+class RawTexture;
+class Scene;
+using AbstractMeshPtr = std::shared_ptr<AbstractMesh>;
+using AnimationPtr    = std::shared_ptr<Animation>;
+using IAnimatablePtr  = std::shared_ptr<IAnimatable>;
+using RawTexturePtr   = std::shared_ptr<RawTexture>;
+
+/**
+ * @brief Class to bake the skeletal animations of a mesh into vertex animation
+ * data: the bone matrices of each frame, stored one frame after the other.
+ * The data is turned into a texture played by a BakedVertexAnimationManager.
+ *
+ * Baking samples the animations synchronously and does not render the scene,
+ * so it can run headless on a NullEngine.
+ */
+class BABYLON_SHARED_EXPORT VertexAnimationBaker {
+
+public:
+  /**
+   * @brief Creates a new VertexAnimationBaker.
+   * @param scene defines the scene of the mesh
+   * @param mesh defines the skinned mesh to bake
+   */
+  VertexAnimationBaker(Scene* scene, const AbstractMeshPtr& mesh);
+  ~VertexAnimationBaker(); // = default
+
+  /**
+   * @brief Bakes the animations of the bones of the skeleton of the mesh.
+   * @param ranges defines the frame ranges to bake, every integer frame of each
+   * range is sampled, bounds included
+   * @returns the bone matrices of the frames, 16 * (bones + 1) floats per frame
+   */
+  Float32Array bakeVertexData(const std::vector<AnimationRange>& ranges);
+
+  /**
+   * @brief Bakes the animations of an animation group driving the skeleton of
+   * the mesh.
+   * @param animationGroup defines the animation group to sample
+   * @param ranges defines the frame ranges to bake, the range of the group when
+   * empty
+   * @returns the bone matrices of the frames, 16 * (bones + 1) floats per frame
+   */
+  Float32Array bakeVertexData(AnimationGroup& animationGroup,
+                              const std::vector<AnimationRange>& ranges = {});
+
+  /**
+   * @brief Creates the texture of baked vertex data: a float RGBA texture with
+   * one row per frame and four texels per bone matrix.
+   * @param vertexData defines the baked vertex data
+   * @returns the texture
+   */
+  RawTexturePtr textureFromBakedVertexData(const Float32Array& vertexData);
+
+  /**
+   * @brief Serializes baked vertex data, the floats are base64 encoded.
+   * @param vertexData defines the baked vertex data
+   * @returns the serialization object
+   */
+  [[nodiscard]] json serializeBakedVertexDataToObject(const Float32Array& vertexData) const;
+
+  /**
+   * @brief Loads baked vertex data from a serialization object.
+   * @param data defines the serialization object
+   * @returns the baked vertex data
+   */
+  [[nodiscard]] Float32Array loadBakedVertexDataFromObject(const json& data) const;
+
+  /**
+   * @brief Serializes baked vertex data to a JSON string.
+   * @param vertexData defines the baked vertex data
+   * @returns the JSON string
+   */
+  [[nodiscard]] std::string serializeBakedVertexDataToJSON(const Float32Array& vertexData) const;
+
+  /**
+   * @brief Loads baked vertex data from a JSON string.
+   * @param json defines the JSON string
+   * @returns the baked vertex data
+   */
+  [[nodiscard]] Float32Array loadBakedVertexDataFromJSON(const std::string& json) const;
+
+private:
+  /**
+   * @brief Samples animations of targets over frame ranges and stores the
+   * transform matrices of the skeleton of the mesh after each frame.
+   */
+  Float32Array _bakeVertexData(const std::vector<std::pair<IAnimatablePtr, AnimationPtr>>& targets,
+                               const std::vector<AnimationRange>& ranges);
+
+private:
+  Scene* _scene;
+  AbstractMeshPtr _mesh;
+
+}; // end of class VertexAnimationBaker
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_BAKED_VERTEX_ANIMATION_VERTEX_ANIMATION_BAKER_H
@@ -179,6 +179,35 @@ public:
    */
   void prepare();
 
+  /**
+   * @brief Builds all resources required to render the given skeletons. The
+   * bone matrices of the skeletons are computed concurrently on the default
+   * thread pool, the rest of the preparation is done on the calling thread.
+   * @param skeletons defines the skeletons to prepare (a skeleton must appear
+   * only once)
+   */
+  static void PrepareSkeletons(const std::vector<SkeletonPtr>& skeletons);
+
+  /**
+   * @brief Hidden
+   * First step of prepare(), which must run on the main thread.
+   * @returns true if the bone matrices must be computed with
+   * _prepareTransformMatrices() and then finalized with _endPrepare()
+   */
+  bool _beginPrepare();
+
+  /**
+   * @brief Hidden
+   * Computes the bone matrices, only touches the bones of the skeleton.
+   */
+  void _prepareTransformMatrices();
+
+  /**
+   * @brief Hidden
+   * Last step of prepare(), which must run on the main thread.
+   */
+  void _endPrepare();
+
   /**
    * @brief Gets the list of animatables currently running for this skeleton.
    * @returns an array of animatables
@@ -291,6 +320,7 @@ protected:
 
 private:
   float _getHighestAnimationFrame();
+  void _updateBoneHierarchy();
   void _computeTransformMatrices(Float32Array& targetMatrix,
                                  const std::optional<Matrix>& initialSkinMatrix = std::nullopt);
   void _sortBones(unsigned int index, std::vector<BonePtr>& bones, std::vector<bool>& visited);
@@ -382,6 +412,14 @@ private:
   bool _useTextureToStoreBoneMatrices;
   AnimationPropertiesOverridePtr _animationPropertiesOverride;
 
+  // Bone hierarchy flattened in topological order (parents before children)
+  std::vector<Bone*> _hierarchyBones;
+  std::vector<Bone*> _hierarchyParentBones;
+  std::vector<int> _hierarchyParents;
+  std::vector<size_t> _hierarchyBoneIndices;
+  std::vector<size_t> _hierarchyOrder;
+  Float32Array _worldMatrices;
+
 }; // end of class Bone
 
 } // end of namespace BABYLON
@@ -1,11 +1,18 @@
 #ifndef BABYLON_CORE_ARRAY_BUFFER_VIEW_H
 #define BABYLON_CORE_ARRAY_BUFFER_VIEW_H
 
+#include <memory>
+#include <optional>
+
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_common.h>
+#include <babylon/core/typed_array_view.h>
 
 namespace BABYLON {
 
+class MemoryMappedFile;
+using MemoryMappedFilePtr = std::shared_ptr<MemoryMappedFile>;
+
 /**
  * @brief ArrayBufferView is a helper type representing any of the following
  * TypedArray types:
@@ -16,6 +23,18 @@ namespace BABYLON {
  *  - Int32Array,
  *  - Uint32Array,
  *  - Float32Array,
+ *
+ * Like in JavaScript, the view references a range (byteOffset, byteLength) of
+ * an underlying buffer which is shared between copies and sub-arrays of the
+ * view, so that they can be passed around without copying the data. The buffer
+ * is copied on write: the non const buffer() / uint8Array() accessors detach
+ * the view from the other views sharing its buffer.
+ *
+ * The buffer can also be the read-only content of a memory mapped file. Its
+ * data is then read in place by data(), subarray(), typedView() and the typed
+ * copies. The first time buffer() / uint8Array() is called, only the range of
+ * the view is copied in a heap buffer, which the view then starts (byteOffset
+ * is reset to 0); the other views of the file keep reading it in place.
  */
 class BABYLON_SHARED_EXPORT ArrayBufferView {
 
@@ -23,9 +42,11 @@ public:
   ArrayBufferView();
   ArrayBufferView(const Int8Array& buffer);
   ArrayBufferView(const ArrayBuffer& arrayBuffer);
+  ArrayBufferView(ArrayBuffer&& arrayBuffer);
   ArrayBufferView(const Uint16Array& buffer);
   ArrayBufferView(const Uint32Array& buffer);
   ArrayBufferView(const Float32Array& buffer);
+  explicit ArrayBufferView(const MemoryMappedFilePtr& file);
   ArrayBufferView(const ArrayBufferView& other);
   ArrayBufferView(ArrayBufferView&& other);
   ArrayBufferView& operator=(const ArrayBufferView& other);
@@ -33,13 +54,82 @@ public:
   ~ArrayBufferView(); // = default
 
   void clear();
+
+  /**
+   * @brief Returns the length in bytes of the view (from byteOffset).
+   */
   size_t byteLength() const;
   operator bool() const;
 
+  /**
+   * @brief Returns a view of a range of this view, sharing its buffer.
+   * @param byteOffset offset in bytes of the range, relative to this view
+   * @param byteLength length in bytes of the range (up to the end of this view
+   * by default)
+   * @throws std::out_of_range if the range is not contained in this view
+   */
+  [[nodiscard]] ArrayBufferView subarray(size_t byteOffset,
+                                         std::optional<size_t> byteLength = std::nullopt) const;
+
+  /**
+   * @brief Returns a pointer to the first byte of the view.
+   */
+  [[nodiscard]] const uint8_t* data() const;
+
+  /**
+   * @brief Returns whether the view reads the content of a memory mapped file.
+   */
+  [[nodiscard]] bool isMapped() const;
+
+  /**
+   * @brief Hints the OS that the data of the view is not needed anymore (e.g.
+   * once it has been uploaded to the GPU), so that the pages of a memory mapped
+   * file can be released from the resident memory. The data remains valid.
+   * Does nothing for views of heap buffers.
+   */
+  void releasePages() const;
+
+  /**
+   * @brief Returns a non-owning typed view of the elements of this view.
+   * @param byteOffset offset in bytes of the first element, relative to this
+   * view
+   * @param count number of elements (as many as fit in this view by default)
+   * @param byteStride distance in bytes between two consecutive elements
+   * (sizeof(T) by default)
+   * @throws std::out_of_range if the elements are not contained in this view
+   */
+  template <typename T>
+  [[nodiscard]] TypedArrayView<T> typedView(size_t byteOffset = 0,
+                                            std::optional<size_t> count      = std::nullopt,
+                                            std::optional<size_t> byteStride = std::nullopt) const
+  {
+    const auto stride = byteStride.value_or(0) != 0 ? *byteStride : sizeof(T);
+    const auto length = byteLength();
+    if (byteOffset > length) {
+      _throwOutOfRange(byteOffset, 0);
+    }
+    const auto available = length - byteOffset < sizeof(T) ?
+                             0 :
+                             (length - byteOffset - sizeof(T)) / stride + 1;
+    if (count.has_value() && *count > available) {
+      _throwOutOfRange(byteOffset, (*count - 1) * stride + sizeof(T));
+    }
+    return TypedArrayView<T>(data() + byteOffset, count.value_or(available), stride);
+  }
+
+  /**
+   * @brief Returns the whole underlying buffer, the view starts at byteOffset.
+   * @note The range of a memory mapped file view is copied on the first call,
+   * which resets byteOffset to 0.
+   */
   Uint8Array& buffer();
   const Uint8Array& buffer() const;
   Uint8Array& uint8Array();
   const Uint8Array& uint8Array() const;
+
+  /**
+   * @brief Returns a copy of the content of the view.
+   */
   Int8Array int8Array() const;
   Int16Array int16Array() const;
   Uint16Array uint16Array() const;
@@ -47,11 +137,22 @@ public:
   Uint32Array uint32Array() const;
   Float32Array float32Array() const;
 
+private:
+  [[nodiscard]] size_t _bufferLength() const;
+  void _detach() const;
+  [[noreturn]] void _throwOutOfRange(size_t byteOffset, size_t byteLength) const;
+
 public:
-  size_t byteOffset = 0;
+  // Mutable: detaching a mapped file view rebases it on the copy of its range
+  mutable size_t byteOffset = 0;
 
 private:
-  Uint8Array _uint8Array;
+  // Either a heap buffer or a mapped file, mutable: the mapped file content is
+  // copied in a heap buffer when the buffer is accessed as an Uint8Array
+  mutable std::shared_ptr<Uint8Array> _buffer;
+  mutable MemoryMappedFilePtr _mappedFile;
+  // Length of the view, up to the end of the buffer if not set
+  mutable std::optional<size_t> _byteLength;
 
 }; // end of class ArrayBufferView
 
@@ -0,0 +1,99 @@
+#ifndef BABYLON_CORE_MEMORY_MAPPED_FILE_H
+#define BABYLON_CORE_MEMORY_MAPPED_FILE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+class MemoryMappedFile;
+using MemoryMappedFilePtr = std::shared_ptr<MemoryMappedFile>;
+
+/**
+ * @brief Read-only view of the content of a file, mapped in memory when the
+ * platform supports it (the file is read in a heap buffer otherwise).
+ *
+ * Mapped pages are loaded lazily by the OS and can be dropped under memory
+ * pressure, so large files do not add their size to the resident memory.
+ */
+class BABYLON_SHARED_EXPORT MemoryMappedFile {
+
+public:
+  /**
+   * @brief Opens a file.
+   * @param filename defines the path of the file
+   * @returns the opened file, nullptr if the file could not be read
+   */
+  static MemoryMappedFilePtr Open(const std::string& filename);
+  ~MemoryMappedFile(); // = default
+
+  MemoryMappedFile(const MemoryMappedFile&) = delete;
+  MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+  /**
+   * @brief Returns the content of the file.
+   */
+  [[nodiscard]] const uint8_t* data() const
+  {
+    return _data;
+  }
+
+  /**
+   * @brief Returns the size of the file in bytes.
+   */
+  [[nodiscard]] size_t size() const
+  {
+    return _size;
+  }
+
+  /**
+   * @brief Returns the content of the file as text.
+   */
+  [[nodiscard]] std::string_view view() const
+  {
+    return std::string_view(reinterpret_cast<const char*>(_data), _size);
+  }
+
+  /**
+   * @brief Returns whether the content is mapped (true) or was read in memory
+   * (false).
+   */
+  [[nodiscard]] bool isMapped() const
+  {
+    return _isMapped;
+  }
+
+  /**
+   * @brief Hints the OS that a range of the content is not needed anymore, so
+   * that its pages can be released from the resident memory. The content
+   * remains valid: released pages are read again from the file if they are
+   * accessed later. Does nothing if the content is not mapped.
+   * @param offset defines the offset in bytes of the range
+   * @param length defines the length in bytes of the range
+   */
+  void releasePages(size_t offset, size_t length) const;
+
+private:
+  MemoryMappedFile();
+
+private:
+  const uint8_t* _data;
+  size_t _size;
+  bool _isMapped;
+  // Content when the file could not be mapped
+  std::vector<uint8_t> _buffer;
+#ifdef _WIN32
+  void* _fileHandle;
+  void* _mappingHandle;
+#endif
+
+}; // end of class MemoryMappedFile
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_MEMORY_MAPPED_FILE_H
@@ -0,0 +1,85 @@
+#ifndef BABYLON_CORE_THREAD_POOL_H
+#define BABYLON_CORE_THREAD_POOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Fixed size pool of worker threads used for CPU bound work (scene
+ * evaluation, skinning, geometry processing, ...).
+ *
+ * parallelFor() splits a range in chunks which are processed by the workers
+ * *and* by the calling thread, and returns once every chunk is done. As the
+ * caller always takes part in the work, parallelFor() can safely be nested
+ * or called from a worker thread.
+ */
+class BABYLON_SHARED_EXPORT ThreadPool {
+
+public:
+  using Task      = std::function<void()>;
+  using RangeTask = std::function<void(size_t begin, size_t end)>;
+
+public:
+  /**
+   * @brief Returns the pool shared by the engine, sized after the number of
+   * hardware threads.
+   */
+  static ThreadPool& Default();
+
+  /**
+   * @brief Creates a pool with the given number of workers (0 means one worker
+   * per hardware thread, minus the calling thread).
+   */
+  explicit ThreadPool(size_t nbWorkers = 0);
+  ~ThreadPool(); // = default
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  /**
+   * @brief Returns the number of worker threads.
+   */
+  [[nodiscard]] size_t workerCount() const;
+
+  /**
+   * @brief Returns the number of threads that can run a parallelFor (workers
+   * plus the calling thread).
+   */
+  [[nodiscard]] size_t concurrency() const;
+
+  /**
+   * @brief Queues an independent task.
+   */
+  std::future<void> submit(Task task);
+
+  /**
+   * @brief Calls task(begin, end) over [0, count) in chunks of at most
+   * grainSize elements and waits for all of them. The first exception thrown by
+   * a chunk is rethrown in the calling thread.
+   */
+  void parallelFor(size_t count, size_t grainSize, const RangeTask& task);
+
+private:
+  void _workerProc();
+
+private:
+  std::vector<std::thread> _workers;
+  std::deque<Task> _tasks;
+  std::mutex _mutex;
+  std::condition_variable _taskAvailable;
+  bool _stopRequested;
+
+}; // end of class ThreadPool
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_THREAD_POOL_H
@@ -0,0 +1,152 @@
+#ifndef BABYLON_CORE_TYPED_ARRAY_VIEW_H
+#define BABYLON_CORE_TYPED_ARRAY_VIEW_H
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace BABYLON {
+
+/**
+ * @brief Non-owning, read-only view of typed elements stored in a byte buffer.
+ *
+ * Elements are read with memcpy, so the view can be created at any byte
+ * offset, and interleaved data can be read through a byte stride. The view
+ * does not keep the buffer alive: it is valid as long as the ArrayBufferView
+ * (or any copy of it sharing the same buffer) it was created from.
+ */
+template <typename T>
+class TypedArrayView {
+
+  static_assert(std::is_trivially_copyable<T>::value,
+                "TypedArrayView elements must be trivially copyable");
+
+public:
+  TypedArrayView() : _data{nullptr}, _size{0}, _byteStride{sizeof(T)}
+  {
+  }
+
+  /**
+   * @brief Constructor
+   * @param data pointer to the first byte of the first element
+   * @param size number of elements
+   * @param byteStride distance in bytes between two consecutive elements
+   */
+  TypedArrayView(const uint8_t* data, size_t size, size_t byteStride = sizeof(T))
+      : _data{data}, _size{size}, _byteStride{byteStride != 0 ? byteStride : sizeof(T)}
+  {
+  }
+
+  /**
+   * @brief Returns the number of elements.
+   */
+  [[nodiscard]] size_t size() const
+  {
+    return _size;
+  }
+
+  [[nodiscard]] bool empty() const
+  {
+    return _size == 0;
+  }
+
+  /**
+   * @brief Returns the distance in bytes between two consecutive elements.
+   */
+  [[nodiscard]] size_t byteStride() const
+  {
+    return _byteStride;
+  }
+
+  /**
+   * @brief Returns the number of bytes spanned by the elements.
+   */
+  [[nodiscard]] size_t byteLength() const
+  {
+    return _size == 0 ? 0 : (_size - 1) * _byteStride + sizeof(T);
+  }
+
+  /**
+   * @brief Returns whether the elements are tightly packed.
+   */
+  [[nodiscard]] bool isPacked() const
+  {
+    return _byteStride == sizeof(T);
+  }
+
+  /**
+   * @brief Returns a pointer to the first byte of the first element.
+   */
+  [[nodiscard]] const uint8_t* data() const
+  {
+    return _data;
+  }
+
+  /**
+   * @brief Returns the element at the given index (no bounds checking).
+   */
+  T operator[](size_t index) const
+  {
+    T value;
+    std::memcpy(&value, _data + index * _byteStride, sizeof(T));
+    return value;
+  }
+
+  /**
+   * @brief Returns the element at the given index.
+   * @throws std::out_of_range if the index is out of range
+   */
+  [[nodiscard]] T at(size_t index) const
+  {
+    if (index >= _size) {
+      throw std::out_of_range("TypedArrayView index " + std::to_string(index)
+                              + " out of range (size " + std::to_string(_size) + ")");
+    }
+    return operator[](index);
+  }
+
+  /**
+   * @brief Calls callback(value, index) for every element.
+   */
+  template <typename Callback>
+  void forEach(Callback&& callback) const
+  {
+    for (size_t index = 0; index < _size; ++index) {
+      callback(operator[](index), index);
+    }
+  }
+
+  /**
+   * @brief Copies the elements in a new array, converting them to C.
+   */
+  template <typename C = T>
+  [[nodiscard]] std::vector<C> toArray() const
+  {
+    std::vector<C> result(_size);
+    if constexpr (std::is_same<C, T>::value) {
+      if (isPacked()) {
+        if (_size > 0) {
+          std::memcpy(result.data(), _data, _size * sizeof(T));
+        }
+        return result;
+      }
+    }
+    for (size_t index = 0; index < _size; ++index) {
+      result[index] = static_cast<C>(operator[](index));
+    }
+    return result;
+  }
+
+private:
+  const uint8_t* _data;
+  size_t _size;
+  size_t _byteStride;
+
+}; // end of class TypedArrayView
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_TYPED_ARRAY_VIEW_H
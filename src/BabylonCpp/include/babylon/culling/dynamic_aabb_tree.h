@@ -0,0 +1,156 @@
+#ifndef BABYLON_CULLING_DYNAMIC_AABB_TREE_H
+#define BABYLON_CULLING_DYNAMIC_AABB_TREE_H
+
+#include <cstddef>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/maths/vector3.h>
+
+namespace BABYLON {
+
+class AbstractMesh;
+class Light;
+class NativePhysicsBody;
+class Ray;
+
+/**
+ * @brief Dynamic bounding volume hierarchy of axis aligned boxes, used as a
+ * broadphase to quickly select the entries overlapping a box, a sphere or a
+ * ray.
+ *
+ * Each entry (proxy) is stored with a "fat" box, enlarged by a margin, so that
+ * small moves only need a containment test. Proxies leaving their fat box are
+ * reinserted, and the tree is kept balanced with rotations, so updates and
+ * queries run in O(log n).
+ */
+template <class T>
+class BABYLON_SHARED_EXPORT DynamicAABBTree {
+
+public:
+  /**
+   * Identifier of the null node and of invalid proxies
+   */
+  static constexpr int NullNode = -1;
+
+public:
+  /**
+   * @brief Creates an empty tree.
+   * @param marginRatio defines the margin added around the proxy boxes, as a
+   * ratio of their size
+   */
+  DynamicAABBTree(float marginRatio = 0.1f);
+  ~DynamicAABBTree(); // = default
+
+  /**
+   * @brief Inserts an entry in the tree.
+   * @param min defines the minimum of the entry box
+   * @param max defines the maximum of the entry box
+   * @param data defines the entry
+   * @returns the proxy id of the entry
+   */
+  int createProxy(const Vector3& min, const Vector3& max, const T& data);
+
+  /**
+   * @brief Removes an entry from the tree.
+   * @param proxyId defines the proxy id of the entry
+   */
+  void destroyProxy(int proxyId);
+
+  /**
+   * @brief Updates the box of an entry. The entry is only reinserted when the
+   * box is no more contained in its fat box.
+   * @param proxyId defines the proxy id of the entry
+   * @param min defines the new minimum of the entry box
+   * @param max defines the new maximum of the entry box
+   * @returns true if the entry was reinserted
+   */
+  bool moveProxy(int proxyId, const Vector3& min, const Vector3& max);
+
+  /**
+   * @brief Returns the entry of a proxy.
+   */
+  const T& getData(int proxyId) const;
+
+  /**
+   * @brief Returns the fat box of a proxy.
+   */
+  void getFatBounds(int proxyId, Vector3& min, Vector3& max) const;
+
+  /**
+   * @brief Collects the entries whose fat box overlaps a box.
+   * @param min defines the minimum of the box
+   * @param max defines the maximum of the box
+   * @param results defines the array receiving the entries
+   */
+  void queryBox(const Vector3& min, const Vector3& max, std::vector<T>& results) const;
+
+  /**
+   * @brief Collects the entries whose fat box overlaps a sphere.
+   * @param center defines the center of the sphere
+   * @param radius defines the radius of the sphere
+   * @param results defines the array receiving the entries
+   */
+  void querySphere(const Vector3& center, float radius, std::vector<T>& results) const;
+
+  /**
+   * @brief Collects the entries whose fat box is hit by a ray (the ray length
+   * is not taken into account, like in Ray::intersectsBox).
+   * @param ray defines the ray
+   * @param results defines the array receiving the entries
+   * @param intersectionThreshold defines an extra extend added to the boxes
+   */
+  void queryRay(const Ray& ray, std::vector<T>& results, float intersectionThreshold = 0.f) const;
+
+  /**
+   * @brief Returns the number of entries in the tree.
+   */
+  [[nodiscard]] size_t proxyCount() const;
+
+  /**
+   * @brief Returns the height of the tree (0 for a single leaf, -1 when empty).
+   */
+  [[nodiscard]] int height() const;
+
+  /**
+   * @brief Removes all the entries.
+   */
+  void clear();
+
+private:
+  struct Node {
+    Vector3 min;
+    Vector3 max;
+    T data{};
+    // Parent node, or next free node when the node is not used
+    int parent = NullNode;
+    int child1 = NullNode;
+    int child2 = NullNode;
+    // Leaf = 0, free node = -1
+    int height = -1;
+
+    [[nodiscard]] bool isLeaf() const
+    {
+      return child1 == NullNode;
+    }
+  }; // end of struct Node
+
+  int _allocateNode();
+  void _freeNode(int nodeId);
+  void _insertLeaf(int leaf);
+  void _removeLeaf(int leaf);
+  int _balance(int nodeId);
+  void _setFatBounds(Node& node, const Vector3& min, const Vector3& max) const;
+
+private:
+  std::vector<Node> _nodes;
+  int _root;
+  int _freeList;
+  size_t _proxyCount;
+  float _marginRatio;
+
+}; // end of class DynamicAABBTree
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CULLING_DYNAMIC_AABB_TREE_H
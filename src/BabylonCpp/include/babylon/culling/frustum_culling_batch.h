@@ -0,0 +1,77 @@
+#ifndef BABYLON_CULLING_FRUSTUM_CULLING_BATCH_H
+#define BABYLON_CULLING_FRUSTUM_CULLING_BATCH_H
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/maths/plane.h>
+
+namespace BABYLON {
+
+class BoundingInfo;
+
+/**
+ * @brief Packed (structure of arrays) copy of the world bounding volumes of a
+ * set of meshes, used to run the frustum tests of many meshes in one batch.
+ * The results are identical to BoundingInfo::isInFrustum().
+ */
+class BABYLON_SHARED_EXPORT FrustumCullingBatch {
+
+public:
+  FrustumCullingBatch();
+  ~FrustumCullingBatch(); // = default
+
+  /**
+   * @brief Resizes the batch, entries are left uninitialized.
+   * @param count defines the number of bounding volumes
+   */
+  void resize(size_t count);
+
+  /**
+   * @brief Gets the number of bounding volumes in the batch.
+   */
+  [[nodiscard]] size_t size() const;
+
+  /**
+   * @brief Copies the world bounding volumes of a mesh into the batch.
+   * @param index defines the index of the entry
+   * @param boundingInfo defines the bounding info to copy (nullptr means never
+   * in frustum)
+   * @param strategy defines the culling strategy (see
+   * Constants::MESHES_CULLINGSTRATEGY_XXX)
+   */
+  void set(size_t index, const BoundingInfo* boundingInfo, unsigned int strategy);
+
+  /**
+   * @brief Runs the frustum tests of the entries in [begin, end).
+   * Disjoint ranges can be culled concurrently.
+   * @param frustumPlanes defines the frustum planes to test
+   */
+  void cull(const std::array<Plane, 6>& frustumPlanes, size_t begin, size_t end);
+
+  /**
+   * @brief Returns the result of the last cull() for the given entry.
+   */
+  [[nodiscard]] bool isInFrustum(size_t index) const
+  {
+    return _inFrustum[index] != 0;
+  }
+
+private:
+  std::vector<float> _centerX;
+  std::vector<float> _centerY;
+  std::vector<float> _centerZ;
+  std::vector<float> _radius;
+  // 8 world box corners per entry, stored as x0..x7, y0..y7, z0..z7
+  std::vector<float> _corners;
+  std::vector<uint8_t> _strategies;
+  std::vector<uint8_t> _valid;
+  std::vector<uint8_t> _inFrustum;
+
+}; // end of class FrustumCullingBatch
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CULLING_FRUSTUM_CULLING_BATCH_H
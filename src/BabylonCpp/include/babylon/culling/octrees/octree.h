@@ -1,7 +1,9 @@
 #ifndef BABYLON_CULLING_OCTREES_OCTREE_H
 #define BABYLON_CULLING_OCTREES_OCTREE_H
 
+#include <array>
 #include <functional>
+#include <unordered_map>
 
 #include <babylon/babylon_api.h>
 #include <babylon/culling/octrees/ioctree_container.h>
@@ -17,16 +19,27 @@ class Vector3;
 /**
  * @brief Octrees are a really powerful data structure that can quickly select
  * entities based on space coordinates.
+ *
+ * This is a loose octree: each entry is stored in exactly one block, which is
+ * remembered so that entries can be moved or removed in constant time, and the
+ * selections do not contain duplicated entries.
  * @see https://doc.babylonjs.com/how_to/optimizing_your_scene_with_octrees
  */
 template <class T>
 class BABYLON_SHARED_EXPORT Octree : public IOctreeContainer<T> {
 
+public:
+  /**
+   * Function returning the world bounding box of an entry, or false if the
+   * entry must not be stored in the octree
+   */
+  using BoundsFunc = std::function<bool(const T& entry, Vector3& min, Vector3& max)>;
+
 public:
   /**
    * @brief Creates a octree.
    * @see https://doc.babylonjs.com/how_to/optimizing_your_scene_with_octrees
-   * @param creationFunc function to be used to instatiate the octree
+   * @param boundsFunc function used to get the world bounding box of an entry
    * @param maxBlockCapacity defines the maximum number of meshes you want on
    * your octree's leaves (default: 64)
    * @param maxDepth defines the maximum depth (sub-levels) for your octree.
@@ -34,57 +47,69 @@ public:
    * precedence over capacity.)
    */
   Octree();
-  Octree(
-    const std::function<void(T& entry, OctreeBlock<T>& block)>& creationFunc,
-    std::size_t maxBlockCapacity = 64, std::size_t maxDepth = 2);
+  Octree(const BoundsFunc& boundsFunc, std::size_t maxBlockCapacity = 64,
+         std::size_t maxDepth = 2);
   ~Octree(); // = default
 
   /** Methods **/
 
   /**
-   * @brief Updates the octree by adding blocks for the passed in meshes within
-   * the min and max world parameters.
-   * @param worldMin worldMin for the octree blocks var blockSize = new
-   * Vector3((worldMax.x - worldMin.x) / 2, (worldMax.y - worldMin.y) / 2,
-   * (worldMax.z - worldMin.z) / 2);
-   * @param worldMax worldMax for the octree blocks var blockSize = new
-   * Vector3((worldMax.x - worldMin.x) / 2, (worldMax.y - worldMin.y) / 2,
-   * (worldMax.z - worldMin.z) / 2);
+   * @brief Rebuilds the octree with the passed in meshes, the root block
+   * covering the min and max world parameters.
+   * @param worldMin defines the minimum vector (in world space) of the octree
+   * @param worldMax defines the maximum vector (in world space) of the octree
    * @param entries meshes to be added to the octree blocks
    */
-  void update(const Vector3& worldMin, const Vector3& worldMax,
-              std::vector<T>& entries);
+  void update(const Vector3& worldMin, const Vector3& worldMax, const std::vector<T>& entries);
 
   /**
-   * @brief Adds a mesh to the octree.
+   * @brief Adds a mesh to the octree (or moves it if it is already stored).
    * @param entry Mesh to add to the octree
    */
-  void addMesh(T& entry);
+  void addMesh(const T& entry);
 
   /**
    * @brief Remove an element from the octree.
    * @param entry defines the element to remove
    */
-  void removeMesh(T& entry);
+  void removeMesh(const T& entry);
+
+  /**
+   * @brief Moves an element to the block matching its current bounding box.
+   * This is a constant time operation while the element stays in the loose
+   * bounds of its block. Elements not stored yet are added, and elements
+   * without bounding box are removed.
+   * @param entry defines the element to update
+   */
+  void updateMesh(const T& entry);
+
+  /**
+   * @brief Returns true if an element is stored in the octree blocks.
+   */
+  bool contains(const T& entry) const;
+
+  /**
+   * @brief Returns the number of elements stored in the octree blocks.
+   */
+  [[nodiscard]] std::size_t entryCount() const;
 
   /**
    * @brief Selects an array of meshes within the frustum.
    * @param frustumPlanes The frustum planes to use which will select all meshes
    * within it
-   * @param allowDuplicate If duplicate objects are allowed in the resulting
-   * object array
+   * @param allowDuplicate If the dynamic content can duplicate the objects
+   * selected in the octree blocks
    * @returns array of meshes within the frustum
    */
-  std::vector<T>& select(const std::array<Plane, 6>& frustumPlanes,
-                         bool allowDuplicate = true);
+  std::vector<T>& select(const std::array<Plane, 6>& frustumPlanes, bool allowDuplicate = true);
 
   /**
    * @brief Test if the octree intersect with the given bounding sphere and if
    * yes, then add its content to the selection array.
    * @param sphereCenter defines the bounding sphere center
    * @param sphereRadius defines the bounding sphere radius
-   * @param allowDuplicate defines if the selection array can contains
-   * duplicated entries
+   * @param allowDuplicate defines if the dynamic content can duplicate the
+   * objects selected in the octree blocks
    * @returns an array of objects that intersect the sphere
    */
   std::vector<T>& intersects(const Vector3& sphereCenter, float sphereRadius,
@@ -101,16 +126,30 @@ public:
   /** Statics **/
 
   /**
-   * @brief Adds a mesh into the octree block if it intersects the block.
+   * @brief Gets the world bounding box of a mesh (blocked meshes are not
+   * stored in the octree).
    */
-  static void CreationFuncForMeshes(AbstractMesh* entry,
-                                    OctreeBlock<AbstractMesh*>& block);
+  static bool BoundsFuncForMeshes(AbstractMesh* const& entry, Vector3& min, Vector3& max);
 
   /**
-   * @brief Adds a submesh into the octree block if it intersects the block.
+   * @brief Gets the world bounding box of a submesh.
    */
-  static void CreationFuncForSubMeshes(SubMesh* entry,
-                                       OctreeBlock<SubMesh*>& block);
+  static bool BoundsFuncForSubMeshes(SubMesh* const& entry, Vector3& min, Vector3& max);
+
+private:
+  struct EntryLocation {
+    // Block storing the entry, nullptr for the entries only in the dynamic
+    // content
+    OctreeBlock<T>* block = nullptr;
+    std::size_t index     = 0;
+    std::size_t stamp     = 0;
+  }; // end of struct EntryLocation
+
+  void _insert(const T& entry, const Vector3& min, const Vector3& max);
+  void _place(const T& entry, OctreeBlock<T>& block);
+  void _detach(EntryLocation& location);
+  void _split(OctreeBlock<T>& block);
+  void _addDynamicContent(bool allowDuplicate);
 
 public:
   /**
@@ -129,7 +168,10 @@ private:
   std::size_t _maxBlockCapacity;
 
   std::vector<T> _selectionContent;
-  std::function<void(T&, OctreeBlock<T>&)> _creationFunc;
+  std::size_t _selectionStamp;
+  std::size_t _entryCount;
+  std::unordered_map<T, EntryLocation> _locations;
+  BoundsFunc _boundsFunc;
 
 }; // end of class Octree
 
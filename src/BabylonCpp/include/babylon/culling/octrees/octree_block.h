@@ -1,7 +1,7 @@
 #ifndef BABYLON_CULLING_OCTREES_OCTREE_BLOCK_H
 #define BABYLON_CULLING_OCTREES_OCTREE_BLOCK_H
 
-#include <functional>
+#include <array>
 
 #include <babylon/babylon_api.h>
 #include <babylon/culling/octrees/ioctree_container.h>
@@ -13,7 +13,11 @@ class Plane;
 class Ray;
 
 /**
- * @brief Class used to store a cell in an octree.
+ * @brief Class used to store a cell in a loose octree.
+ *
+ * The loose bounds of a block extend its cell by half of the cell size on each
+ * side, so an entry is stored in the deepest block containing its center and
+ * not larger than the cell, and each entry lives in exactly one block.
  * @see http://doc.babylonjs.com/how_to/optimizing_your_scene_with_octrees
  */
 template <class T>
@@ -23,19 +27,17 @@ public:
   /**
    * @brief Creates a new block.
    * @param minPoint defines the minimum vector (in world space) of the block's
-   * bounding box.
+   * cell
    * @param maxPoint defines the maximum vector (in world space) of the block's
-   * bounding box
+   * cell
    * @param capacity defines the maximum capacity of this block (if capacity is
    * reached the block will be split into sub blocks)
    * @param depth defines the current depth of this block in the octree
    * @param maxDepth defines the maximal depth allowed (beyond this value, the
    * capacity is ignored)
-   * @param creationFunc defines a callback to call when an element is added to
-   * the block
    */
   OctreeBlock(const Vector3& minPoint, const Vector3& maxPoint, size_t capacity, size_t depth,
-              size_t maxDepth, const std::function<void(T&, OctreeBlock<T>&)>& creationFunc);
+              size_t maxDepth);
   ~OctreeBlock(); // = default
 
   /** Properties **/
@@ -46,99 +48,125 @@ public:
   [[nodiscard]] size_t capacity() const;
 
   /**
-   * @brief Gets the minimum vector (in world space) of the block's bounding
-   * box.
+   * @brief Gets the depth of this block in the octree.
+   */
+  [[nodiscard]] size_t depth() const;
+
+  /**
+   * @brief Gets the minimum vector (in world space) of the block's cell.
    */
   Vector3& minPoint();
 
   /**
-   * @brief Gets the maximum vector (in world space) of the block's bounding
-   * box.
+   * @brief Gets the maximum vector (in world space) of the block's cell.
    */
   Vector3& maxPoint();
 
+  /**
+   * @brief Gets the minimum vector (in world space) of the block's loose
+   * bounding box.
+   */
+  Vector3& looseMinPoint();
+
+  /**
+   * @brief Gets the maximum vector (in world space) of the block's loose
+   * bounding box.
+   */
+  Vector3& looseMaxPoint();
+
   /** Methods **/
 
   /**
-   * @brief Add a new element to this block.
-   * @param entry defines the element to add
+   * @brief Checks if an entry can be stored in this block: its center must be
+   * in the cell and its size must not exceed the cell size.
+   * @param center defines the center of the entry bounding box
+   * @param extendSize defines the half size of the entry bounding box
+   * @returns true if the entry fits in the loose bounds of the block
    */
-  void addEntry(T& entry);
+  [[nodiscard]] bool fits(const Vector3& center, const Vector3& extendSize) const;
 
   /**
-   * @brief Remove an element from this block.
-   * @param entry defines the element to remove
+   * @brief Returns the index of the child block whose cell contains a point.
+   * @param point defines the point to locate
+   * @returns the index of the child block in the blocks array
    */
-  void removeEntry(T& entry);
+  [[nodiscard]] size_t childIndex(const Vector3& point) const;
 
   /**
-   * @brief Add an array of elements to this block.
-   * @param entries defines the array of elements to add
+   * @brief Enlarges the loose bounding box of the block to include a box. Only
+   * used for the root block, which stores the entries outside of the octree.
+   * @param min defines the minimum of the box
+   * @param max defines the maximum of the box
    */
-  void addEntries(std::vector<T>& entries);
+  void extendLooseBounds(const Vector3& min, const Vector3& max);
 
   /**
    * @brief Test if the current block intersects the furstum planes and if yes,
-   * then add its content to the selection array.
+   * then add its content and the content of its children to the selection
+   * array.
    * @param frustumPlanes defines the frustum planes to test
    * @param selection defines the array to store current content if selection is
    * positive
-   * @param allowDuplicate defines if the selection array can contains
-   * duplicated entries
+   * @param selectionStamp defines the stamp of the selection, stored in the
+   * selected blocks
    */
   void select(const std::array<Plane, 6>& frustumPlanes, std::vector<T>& selection,
-              bool allowDuplicate = true);
+              size_t selectionStamp);
 
   /**
    * @brief Test if the current block intersect with the given bounding sphere
-   * and if yes, then add its content to the selection array.
+   * and if yes, then add its content and the content of its children to the
+   * selection array.
    * @param sphereCenter defines the bounding sphere center
    * @param sphereRadius defines the bounding sphere radius
    * @param selection defines the array to store current content if selection is
    * positive
-   * @param allowDuplicate defines if the selection array can contains
-   * duplicated entries
+   * @param selectionStamp defines the stamp of the selection, stored in the
+   * selected blocks
    */
   void intersects(const Vector3& sphereCenter, float sphereRadius, std::vector<T>& selection,
-                  bool allowDuplicate = true);
+                  size_t selectionStamp);
 
   /**
    * @brief Test if the current block intersect with the given ray and if yes,
-   * then add its content to the selection array.
+   * then add its content and the content of its children to the selection
+   * array.
    * @param ray defines the ray to test with
    * @param selection defines the array to store current content if selection is
    * positive
+   * @param selectionStamp defines the stamp of the selection, stored in the
+   * selected blocks
    */
-  void intersectsRay(const Ray& ray, std::vector<T>& selection);
+  void intersectsRay(const Ray& ray, std::vector<T>& selection, size_t selectionStamp);
 
   /**
-   * @brief Subdivide the content into child blocks (this block will then be
-   * empty).
+   * @brief Creates the 8 child blocks (the content of the block is not moved).
    */
   void createInnerBlocks();
 
-  /**
-   * @brief Hidden
-   */
-  static void _CreateBlocks(const Vector3& worldMin, const Vector3& worldMax,
-                            std::vector<T>& entries, size_t maxBlockCapacity, size_t currentDepth,
-                            size_t maxDepth, IOctreeContainer<T>& target,
-                            const std::function<void(T&, OctreeBlock<T>&)>& creationFunc);
-
 public:
   /**
    * Gets the content of the current block
    */
   std::vector<T> entries;
 
+  /**
+   * Hidden (stamp of the last selection including this block)
+   */
+  size_t _selectionStamp;
+
+private:
+  void _updateBoundingVectors();
+
 private:
   size_t _depth;
   size_t _maxDepth;
   size_t _capacity;
   Vector3 _minPoint;
   Vector3 _maxPoint;
+  Vector3 _looseMinPoint;
+  Vector3 _looseMaxPoint;
   std::array<Vector3, 8> _boundingVectors;
-  std::function<void(T&, OctreeBlock<T>&)> _creationFunc;
 
 }; // end of class OctreeBlock
 
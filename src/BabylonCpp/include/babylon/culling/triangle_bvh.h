@@ -0,0 +1,111 @@
+#ifndef BABYLON_CULLING_TRIANGLE_BVH_H
+#define BABYLON_CULLING_TRIANGLE_BVH_H
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+class IntersectionInfo;
+class Ray;
+class Vector3;
+
+/**
+ * @brief Bounding volume hierarchy over the triangles of an index range, used
+ * to accelerate ray picking on large meshes. The hierarchy is built in the
+ * local space of the geometry and only stores triangle ids, so it stays valid
+ * as long as the positions and the indices are not updated.
+ */
+class BABYLON_SHARED_EXPORT TriangleBVH {
+
+public:
+  using TrianglePickingPredicate
+    = std::function<bool(const Vector3& p0, const Vector3& p1, const Vector3& p2, const Ray& ray)>;
+
+  /**
+   * Minimum number of triangles for a BVH to be worth building, smaller ranges
+   * are tested triangle by triangle
+   */
+  static constexpr size_t MinTriangleCount = 64;
+
+  /**
+   * Maximum number of triangles stored in a leaf
+   */
+  static constexpr size_t MaxLeafSize = 4;
+
+public:
+  /**
+   * @brief Builds the hierarchy of a triangle list.
+   * @param positions defines the vertex positions
+   * @param indices defines the index buffer
+   * @param indexStart defines the first index of the range (multiple of 3)
+   * @param indexCount defines the number of indices of the range
+   */
+  TriangleBVH(const std::vector<Vector3>& positions, const IndicesArray& indices,
+              size_t indexStart, size_t indexCount);
+  ~TriangleBVH(); // = default
+
+  /**
+   * @brief Returns the number of triangles in the hierarchy.
+   */
+  [[nodiscard]] size_t triangleCount() const;
+
+  /**
+   * @brief Returns the number of nodes in the hierarchy.
+   */
+  [[nodiscard]] size_t nodeCount() const;
+
+  /**
+   * @brief Intersects the ray with the triangles of the hierarchy. The result
+   * is the one of SubMesh::_intersectTriangles: the closest hit (the lowest
+   * face id on ties), or any hit when fastCheck is true.
+   * @param ray defines the ray, in the local space of the positions
+   * @param positions defines the vertex positions used to build the hierarchy
+   * @param indices defines the index buffer used to build the hierarchy
+   * @param fastCheck defines if the first hit found can be returned
+   * @param trianglePredicate defines an optional predicate used to select
+   * the triangles which can be picked
+   * @returns the intersection info, with the face id relative to the range start
+   */
+  std::optional<IntersectionInfo>
+  intersects(Ray& ray, const std::vector<Vector3>& positions, const IndicesArray& indices,
+             bool fastCheck, const TrianglePickingPredicate& trianglePredicate) const;
+
+  /**
+   * @brief Collects the triangles whose bounding box overlaps a box.
+   * @param min defines the minimum of the box, in the local space of the positions
+   * @param max defines the maximum of the box, in the local space of the positions
+   * @param faceIds defines the array receiving the face ids, relative to the range start
+   */
+  void queryBox(const Vector3& min, const Vector3& max, std::vector<uint32_t>& faceIds) const;
+
+private:
+  struct Node {
+    std::array<float, 3> min;
+    std::array<float, 3> max;
+    // Leaf: first triangle in _faceIds; inner node: index of the first child
+    uint32_t offset;
+    // Number of triangles, 0 for inner nodes
+    uint32_t count;
+  }; // end of struct Node
+
+  bool _intersectsNode(const Node& node, const Ray& ray,
+                       const std::array<float, 3>& inverseDirection, float maxDistance,
+                       float& distance) const;
+
+private:
+  size_t _indexStart;
+  std::vector<Node> _nodes;
+  std::vector<uint32_t> _faceIds;
+
+}; // end of class TriangleBVH
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CULLING_TRIANGLE_BVH_H
@@ -456,17 +456,18 @@ protected:
 
 private:
   void initCacheImpl(); // non virtual implementation of initCache for this base class
+  void _reindexInScene();
 
 public:
   /**
    * Gets or sets the name of the node
    */
-  std::string name;
+  ObservedString<Node> name;
 
   /**
    * Gets or sets the id of the node
    */
-  std::string id;
+  ObservedString<Node> id;
 
   /**
    * Gets or sets the unique id of the node
@@ -540,6 +541,7 @@ public:
 
 protected:
   std::unordered_map<std::string, AnimationRangePtr> _ranges;
+  std::vector<NodePtr> _children;
 
 private:
   bool _doNotSerialize;
@@ -548,7 +550,6 @@ private:
   bool _isReady;
   int _parentUpdateId;
   Node* _parentNode;
-  std::vector<NodePtr> _children;
   int _sceneRootNodesIndex;
   AnimationPropertiesOverridePtr _animationPropertiesOverride;
   Observer<Node>::Ptr _onDisposeObserver;
@@ -401,6 +401,39 @@ public:
     const std::optional<unsigned int>& format = std::nullopt,
     const std::string& forcedExtension = "", const std::string& mimeType = "") override;
 
+  /**
+   * @brief Creates a raw texture.
+   * @param data defines the data to store in the texture
+   * @param width defines the width of the texture
+   * @param height defines the height of the texture
+   * @param format defines the format of the data
+   * @param generateMipMaps defines if the engine should generate the mip levels
+   * @param invertY defines if data must be stored with Y axis inverted
+   * @param samplingMode defines the required sampling mode
+   * @param compression defines the compression used (null by default)
+   * @param type defines the type fo the data (Engine.TEXTURETYPE_UNSIGNED_INT by default)
+   * @returns the raw texture inside an InternalTexture
+   */
+  InternalTexturePtr
+  createRawTexture(const Uint8Array& data, int width, int height, unsigned int format,
+                   bool generateMipMaps, bool invertY, unsigned int samplingMode,
+                   const std::string& compression = "",
+                   unsigned int type = Constants::TEXTURETYPE_UNSIGNED_INT) override;
+
+  /**
+   * @brief Update a raw texture.
+   * @param texture defines the texture to update
+   * @param data defines the data to store in the texture
+   * @param format defines the format of the data
+   * @param invertY defines if data must be stored with Y axis inverted
+   * @param compression defines the compression used (null by default)
+   * @param type defines the type fo the data (Engine.TEXTURETYPE_UNSIGNED_INT by default)
+   */
+  void updateRawTexture(const InternalTexturePtr& texture, const Uint8Array& data,
+                        unsigned int format, bool invertY = true,
+                        const std::string& compression = "",
+                        unsigned int type = Constants::TEXTURETYPE_UNSIGNED_INT) override;
+
   /**
    * @brief Creates a new render target texture
    * @param size defines the size of the texture
@@ -564,7 +597,7 @@ public:
 protected:
   NullEngine(const NullEngineOptions& options = NullEngineOptions{});
 
-  void _deleteBuffer(GL::IGLBuffer* buffer);
+  void _deleteBuffer(const WebGLDataBufferPtr& buffer) override;
 
 private:
   NullEngineOptions _options;
@@ -1,16 +1,20 @@
 #ifndef BABYLON_ENGINES_SCENE_H
 #define BABYLON_ENGINES_SCENE_H
 
+#include <mutex>
 #include <nlohmann/json.hpp>
 #include <regex>
+#include <unordered_set>
 #include <variant>
 
 #include <babylon/animations/ianimatable.h>
 #include <babylon/babylon_api.h>
 #include <babylon/core/array_buffer_view.h>
 #include <babylon/core/structs.h>
+#include <babylon/culling/dynamic_aabb_tree.h>
 #include <babylon/culling/octrees/octree.h>
 #include <babylon/engines/abstract_scene.h>
+#include <babylon/engines/scene_object_index.h>
 #include <babylon/engines/scene_options.h>
 #include <babylon/engines/stage.h>
 #include <babylon/events/pointer_event_types.h>
@@ -41,6 +45,7 @@ class DepthRenderer;
 class Effect;
 class Engine;
 class EnvironmentHelper;
+class FrustumCullingBatch;
 class GamepadManager;
 class GeometryBufferRenderer;
 struct IActiveMeshCandidateProvider;
@@ -703,6 +708,15 @@ public:
   int removeMesh(const AbstractMeshPtr& toRemove, bool recursive = false);
   int removeMesh(AbstractMesh* toRemove, bool recursive = false);
 
+  /**
+   * @brief Removes several meshes from the list of scene's meshes, in a single
+   * pass over the list.
+   * @param toRemove defines the meshes to remove
+   * @param recursive if all child meshes should also be removed from the scene
+   * @returns the number of meshes removed from the scene
+   */
+  size_t removeMeshes(const std::vector<AbstractMeshPtr>& toRemove, bool recursive = false);
+
   /**
    * @brief Add a transform node to the list of scene's transform nodes.
    * @param newTransformNode defines the transform node to add
@@ -1346,6 +1360,88 @@ public:
   Octree<AbstractMesh*>* createOrUpdateSelectionOctree(size_t maxCapacity = 64,
                                                        size_t maxDepth    = 2);
 
+  /** Meshes tree **/
+
+  /**
+   * @brief Gets the meshes whose world bounding box intersects a sphere.
+   * @param center defines the center of the sphere, in world space
+   * @param radius defines the radius of the sphere
+   * @returns the meshes, in the scene order
+   */
+  std::vector<AbstractMesh*> getMeshesInSphere(const Vector3& center, float radius);
+
+  /**
+   * @brief Gets the meshes of the scene intersecting a mesh.
+   * @param mesh defines the mesh to test
+   * @param precise defines if the intersections are computed with the
+   * oriented bounding boxes (see AbstractMesh::intersectsMesh)
+   * @param includeDescendants defines if the descendants of the scene meshes
+   * are also tested
+   * @returns the meshes, in the scene order
+   */
+  std::vector<AbstractMesh*> getIntersectingMeshes(AbstractMesh& mesh, bool precise = false,
+                                                   bool includeDescendants = false);
+
+  /**
+   * @brief Hidden
+   * Re-keys a node or a material of the scene in the lookup indices after its
+   * id or name was assigned.
+   */
+  void _reindexObject(Node* node);
+  void _reindexObject(Material* material);
+
+  /**
+   * @brief Hidden
+   * Queues a mesh whose transform or world bounding box changed for the next
+   * update of the meshes tree. Can be called from the thread pool.
+   */
+  void _markMeshForMeshesTreeUpdate(AbstractMesh* mesh);
+
+  /**
+   * @brief Hidden
+   * Recomputes the world matrices of the queued meshes, then refits the meshes
+   * tree (and the selection octree, if any) with their world bounding boxes.
+   */
+  void _updateMeshesTree();
+
+  /**
+   * @brief Hidden
+   * Gets the candidate meshes for a ray (in world space), in the scene order.
+   */
+  std::vector<AbstractMesh*> _getMeshesTreeCandidates(const Ray& ray);
+
+  /**
+   * @brief Hidden
+   * Gets the candidate meshes for a sphere (in world space), in the scene
+   * order.
+   */
+  std::vector<AbstractMesh*> _getMeshesTreeCandidates(const Vector3& center, float radius);
+
+  /**
+   * @brief Hidden
+   * Updates the light sources of the meshes whose world bounding box changed
+   * and of the meshes reached by the lights whose lit volume changed (moved,
+   * range changed...) since the last update.
+   */
+  void _updateLightSources();
+
+  /**
+   * @brief Hidden
+   * Updates the lit volume of a light in the lights tree.
+   * @param light defines the light to update
+   * @returns the meshes in the previous and in the new lit volumes of the light
+   * (all the meshes when one of them is not bounded), in the scene order
+   */
+  std::vector<AbstractMesh*> _updateLightInLightsTree(Light* light);
+
+  /**
+   * @brief Hidden
+   * Gets the lights whose lit volume may reach a mesh: the lights with an
+   * unbounded volume, in the scene order, followed by the lights whose volume
+   * overlaps the world bounding sphere of the mesh.
+   */
+  std::vector<Light*> _getLightSourcesCandidates(AbstractMesh* mesh);
+
   /** Picking **/
 
   /**
@@ -1797,6 +1893,8 @@ private:
   Scene& _processPointerUp(std::optional<PickingInfo>& pickResult, const PointerEvent& evt,
                            const ClickInfo& clickInfo);
   void _animate();
+  bool _animateInParallel(const std::vector<AnimatablePtr>& animatables,
+                          const millisecond_t& animationTime);
   /**
    * @brief Hidden
    */
@@ -1816,6 +1914,12 @@ private:
   void _processLateAnimationBindings();
   void _evaluateSubMesh(SubMesh* subMesh, AbstractMesh* mesh, AbstractMesh* initialMesh);
   void _evaluateActiveMeshes();
+  void _evaluateActiveMeshesSerially(const std::vector<AbstractMesh*>& candidates);
+  void _evaluateActiveMeshesInParallel(const std::vector<AbstractMesh*>& candidates);
+  void _computeWorldMatricesInHierarchyOrder(const std::vector<AbstractMesh*>& meshes);
+  void _registerMeshForIntersections(AbstractMesh* mesh);
+  void _detachRemovedMesh(AbstractMesh* toRemove);
+  void _queueLightSourcesUpdate(AbstractMesh* mesh);
   void _activeMesh(AbstractMesh* sourceMesh, AbstractMesh* mesh);
   void _renderForCamera(const CameraPtr& camera, const CameraPtr& rigParent = nullptr);
   void _bindFrameBuffer();
@@ -3106,6 +3210,8 @@ public:
   std::optional<float> _cachedVisibility;
   /** Hidden */
   std::vector<IDisposable*> _toBeDisposed;
+  /** Hidden (incremented each time the queued meshes tree updates are applied) */
+  size_t _meshesTreeGeneration;
 
   /**
    * Gets or sets a boolean indicating that all submeshes of active meshes must
@@ -3114,6 +3220,56 @@ public:
    */
   bool dispatchAllSubMeshesOfActiveMeshes;
 
+  /**
+   * Gets or sets a boolean indicating that the active meshes evaluation can use
+   * the engine thread pool (off by default): world matrices are computed level
+   * by level of the hierarchy in parallel, frustum tests are run in batch, and
+   * the results are merged serially in the candidates order, so the rendering
+   * is identical to the serial evaluation. Observers of
+   * onAfterWorldMatrixUpdateObservable are always called from the main thread.
+   */
+  bool parallelActiveMeshesEvaluation;
+
+  /**
+   * Minimum number of active mesh candidates for the parallel evaluation to be
+   * used (see parallelActiveMeshesEvaluation)
+   */
+  size_t parallelActiveMeshesEvaluationThreshold;
+
+  /**
+   * Gets or sets a boolean indicating that the active skeletons can be
+   * prepared on the engine thread pool (off by default): the skeletons are
+   * collected during the active meshes evaluation, then the bone matrices of
+   * the independent skeletons are computed in parallel (see
+   * Skeleton::PrepareSkeletons).
+   */
+  bool parallelSkeletonsPreparation;
+
+  /**
+   * Gets or sets a boolean indicating that the active animatables can be
+   * evaluated on the engine thread pool (off by default): the frames and the
+   * values of all the runtime animations are computed in parallel, then the
+   * values are set on the targets, the callbacks are raised and the late
+   * animation bindings are processed serially, in the animatables order, so
+   * the result is identical to the serial evaluation. Animatables synchronized
+   * with another one are always evaluated serially.
+   */
+  bool parallelAnimationEvaluation;
+
+  /**
+   * Minimum number of active animatables for the parallel evaluation to be
+   * used (see parallelAnimationEvaluation)
+   */
+  size_t parallelAnimationEvaluationThreshold;
+
+  /**
+   * Gets or sets a boolean indicating that the triangles of large meshes are
+   * picked through a bounding volume hierarchy cached by their geometry (on
+   * by default). When disabled, every triangle of the picked sub-meshes is
+   * tested.
+   */
+  bool useTriangleBVHForPicking;
+
   /** Hidden */
   std::vector<IParticleSystem*> _activeParticleSystems;
 
@@ -3580,6 +3736,37 @@ private:
   std::vector<RenderTargetTexturePtr> _renderTargets;
   std::vector<SkeletonPtr> _activeSkeletons;
   std::vector<Mesh*> _softwareSkinnedMeshes;
+  // Membership sets of the vectors above, used to avoid linear searches when
+  // the active meshes are evaluated
+  std::unordered_set<Material*> _processedMaterialsSet;
+  std::unordered_set<RenderTargetTexture*> _renderTargetsSet;
+  std::unordered_set<Skeleton*> _activeSkeletonsSet;
+  std::unordered_set<Mesh*> _softwareSkinnedMeshesSet;
+  std::unordered_set<AbstractMesh*> _meshesForIntersectionsSet;
+  std::unique_ptr<FrustumCullingBatch> _frustumCullingBatch;
+  // Dynamic bounding volume hierarchy of the world bounding boxes of the
+  // meshes, used as broadphase by the picking, the collisions and the meshes
+  // queries. The meshes are queued when their bounding info changes and the
+  // tree is refitted before each query.
+  DynamicAABBTree<AbstractMesh*> _meshesTree;
+  std::vector<AbstractMesh*> _meshesTreeUpdates;
+  std::mutex _meshesTreeMutex;
+  size_t _meshesTreeOrderCounter;
+  // Dynamic bounding volume hierarchy of the volumes lit by the lights with a
+  // bounded range, used to assign their light sources to the meshes. The
+  // meshes whose bounding box changed are queued when the meshes tree is
+  // refitted, and get their light sources updated once per frame.
+  DynamicAABBTree<Light*> _lightsTree;
+  std::vector<Light*> _unboundedLights;
+  bool _unboundedLightsDirty;
+  std::vector<AbstractMesh*> _lightSourcesUpdates;
+  // Indices of the scene collections by unique id, id and name, used by the
+  // getXXXByID / getXXXByName lookups
+  SceneObjectIndex<AbstractMesh> _meshesIndex;
+  SceneObjectIndex<TransformNode> _transformNodesIndex;
+  SceneObjectIndex<Light> _lightsIndex;
+  SceneObjectIndex<Camera> _camerasIndex;
+  SceneObjectIndex<Material> _materialsIndex;
   std::unique_ptr<RenderingManager> _renderingManager;
   Matrix _transformMatrix;
   std::unique_ptr<UniformBuffer> _sceneUbo;
@@ -0,0 +1,132 @@
+#ifndef BABYLON_ENGINES_SCENE_OBJECT_INDEX_H
+#define BABYLON_ENGINES_SCENE_OBJECT_INDEX_H
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Hash indices of a scene collection (meshes, lights, materials...) by
+ * unique id, id and name.
+ *
+ * The index is authoritative: the ids and names report their assignments (see
+ * ObservedString) and the object is then re-keyed with update(), so a lookup is
+ * a hash lookup and a miss returns nullptr.
+ *
+ * When several objects share a key, the first (or last) one added to the index
+ * is returned.
+ */
+template <class T>
+class BABYLON_SHARED_EXPORT SceneObjectIndex {
+
+public:
+  using TPtr = std::shared_ptr<T>;
+
+public:
+  SceneObjectIndex();
+  ~SceneObjectIndex(); // = default
+
+  /**
+   * @brief Indexes an object. Adding an already indexed object updates its
+   * keys.
+   * @param object defines the object to index
+   */
+  void add(const TPtr& object);
+
+  /**
+   * @brief Re-keys an object after its unique id, id or name changed.
+   * @param object defines the object to update
+   * @returns true if the object is indexed
+   */
+  bool update(T* object);
+
+  /**
+   * @brief Removes an object from the index.
+   * @param object defines the object to remove
+   * @returns true if the object was indexed
+   */
+  bool remove(T* object);
+
+  /**
+   * @brief Returns whether an object is indexed.
+   */
+  [[nodiscard]] bool contains(T* object) const;
+
+  /**
+   * @brief Returns the number of indexed objects.
+   */
+  [[nodiscard]] size_t size() const;
+
+  /**
+   * @brief Removes all the objects from the index.
+   */
+  void clear();
+
+  /**
+   * @brief Gets an object using its unique id.
+   * @param uniqueId defines the unique id to search for
+   * @returns the found object or nullptr
+   */
+  [[nodiscard]] TPtr getByUniqueId(size_t uniqueId) const;
+
+  /**
+   * @brief Gets the first object added with a given id.
+   * @param id defines the id to search for
+   * @returns the found object or nullptr
+   */
+  [[nodiscard]] TPtr getById(const std::string& id) const;
+
+  /**
+   * @brief Gets the last object added with a given id.
+   * @param id defines the id to search for
+   * @returns the found object or nullptr
+   */
+  [[nodiscard]] TPtr getLastById(const std::string& id) const;
+
+  /**
+   * @brief Gets the first object added with a given name.
+   * @param name defines the name to search for
+   * @returns the found object or nullptr
+   */
+  [[nodiscard]] TPtr getByName(const std::string& name) const;
+
+private:
+  struct Entry {
+    TPtr object;
+    // Insertion order, used to return the first or last object of a bucket
+    size_t order = 0;
+    // Keys the object is indexed with
+    size_t uniqueId = 0;
+    std::string id;
+    std::string name;
+    // Positions in the id and name buckets
+    size_t idSlot   = 0;
+    size_t nameSlot = 0;
+  }; // end of struct Entry
+
+  using Bucket = std::vector<Entry*>;
+
+  void _insertInBucket(std::unordered_map<std::string, Bucket>& buckets, const std::string& key,
+                       Entry* entry, size_t Entry::*slot);
+  void _removeFromBucket(std::unordered_map<std::string, Bucket>& buckets,
+                         const std::string& key, Entry* entry, size_t Entry::*slot);
+  TPtr _find(const std::unordered_map<std::string, Bucket>& buckets, const std::string& key,
+             bool last) const;
+
+private:
+  std::unordered_map<T*, Entry> _entries;
+  std::unordered_map<size_t, Entry*> _byUniqueId;
+  std::unordered_map<std::string, Bucket> _byId;
+  std::unordered_map<std::string, Bucket> _byName;
+  size_t _orderCounter;
+
+}; // end of class SceneObjectIndex
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_ENGINES_SCENE_OBJECT_INDEX_H
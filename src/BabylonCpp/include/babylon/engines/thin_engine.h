@@ -1332,11 +1332,11 @@ public:
    * @param type defines the type fo the data (Engine.TEXTURETYPE_UNSIGNED_INT by default)
    * @returns the raw texture inside an InternalTexture
    */
-  InternalTexturePtr createRawTexture(const Uint8Array& data, int width, int height,
-                                      unsigned int format, bool generateMipMaps, bool invertY,
-                                      unsigned int samplingMode,
-                                      const std::string& compression = "",
-                                      unsigned int type = Constants::TEXTURETYPE_UNSIGNED_INT);
+  virtual InternalTexturePtr
+  createRawTexture(const Uint8Array& data, int width, int height, unsigned int format,
+                   bool generateMipMaps, bool invertY, unsigned int samplingMode,
+                   const std::string& compression = "",
+                   unsigned int type              = Constants::TEXTURETYPE_UNSIGNED_INT);
 
   /**
    * @brief Update a raw texture.
@@ -1347,10 +1347,10 @@ public:
    * @param compression defines the compression used (null by default)
    * @param type defines the type fo the data (Engine.TEXTURETYPE_UNSIGNED_INT by default)
    */
-  void updateRawTexture(const InternalTexturePtr& texture, const Uint8Array& data,
-                        unsigned int format, bool invertY = true,
-                        const std::string& compression = "",
-                        unsigned int type              = Constants::TEXTURETYPE_UNSIGNED_INT);
+  virtual void updateRawTexture(const InternalTexturePtr& texture, const Uint8Array& data,
+                                unsigned int format, bool invertY = true,
+                                const std::string& compression = "",
+                                unsigned int type = Constants::TEXTURETYPE_UNSIGNED_INT);
 
   /**
    * @brief Creates a new raw cube texture.
@@ -1708,7 +1708,7 @@ protected:
   void _normalizeIndexData(const IndicesArray& indices, Uint16Array& uint16ArrayResult,
                            Uint32Array& uint32ArrayResult);
   void bindIndexBuffer(const WebGLDataBufferPtr& buffer);
-  void _deleteBuffer(const WebGLDataBufferPtr& buffer);
+  virtual void _deleteBuffer(const WebGLDataBufferPtr& buffer);
   /** @hidden */
   virtual void _reportDrawCall();
   static std::string _ConcatenateShader(const std::string& source, const std::string& defines,
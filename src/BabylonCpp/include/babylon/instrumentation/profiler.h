@@ -0,0 +1,196 @@
+#ifndef BABYLON_INSTRUMENTATION_PROFILER_H
+#define BABYLON_INSTRUMENTATION_PROFILER_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+struct ProfilerThreadBuffer;
+
+/**
+ * @brief Hierarchical CPU profiler recording nested zones per thread.
+ *
+ * Each thread writes the zones it closes into its own single producer ring
+ * buffer, without locking; collect() drains the buffers of all the threads.
+ * The captured zones are exported in the Chrome trace event format, which can
+ * be opened in chrome://tracing or Perfetto.
+ *
+ * Zones are opened with the BABYLON_PROFILE_ZONE macro or with
+ * Tools::StartPerformanceCounter / Tools::EndPerformanceCounter. Both compile
+ * to nothing unless the library is built with BABYLON_ENABLE_PROFILER.
+ */
+class BABYLON_SHARED_EXPORT Profiler {
+
+public:
+  /**
+   * A closed zone
+   */
+  struct Zone {
+    /** Name of the zone, interned or a string literal */
+    const char* name;
+    /** Start time, in nanoseconds since the creation of the profiler */
+    uint64_t start;
+    /** Duration in nanoseconds */
+    uint64_t duration;
+    /** Number of zones open on the thread when the zone was opened */
+    uint32_t depth;
+    /** Identifier of the thread, 1 for the first thread that opened a zone */
+    uint32_t threadId;
+  }; // end of struct Zone
+
+  /**
+   * Number of zones a thread can close between two collections before zones
+   * are dropped
+   */
+  static constexpr size_t ThreadBufferCapacity = 1 << 16;
+
+public:
+  /**
+   * @brief Returns the profiler shared by the engine.
+   */
+  static Profiler& Default();
+
+  ~Profiler(); // = default
+
+  Profiler(const Profiler&) = delete;
+  Profiler& operator=(const Profiler&) = delete;
+
+  /**
+   * @brief Starts a capture, the zones captured so far are discarded.
+   */
+  void start();
+
+  /**
+   * @brief Stops the capture, the zones closed afterwards are not recorded.
+   */
+  void stop();
+
+  /**
+   * @brief Returns whether a capture is running.
+   */
+  [[nodiscard]] bool isCapturing() const
+  {
+    return _capturing.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Opens a zone on the calling thread.
+   * @param name defines the name of the zone, which must outlive the profiler
+   * (a string literal or an interned name)
+   */
+  void beginZone(const char* name);
+
+  /**
+   * @brief Closes the last zone opened on the calling thread.
+   */
+  void endZone();
+
+  /**
+   * @brief Opens a zone with a dynamic name on the calling thread.
+   */
+  void beginZone(const std::string& name);
+
+  /**
+   * @brief Closes the last zone with a given name opened on the calling
+   * thread, the zones opened after it stay open.
+   */
+  void endZone(const std::string& name);
+
+  /**
+   * @brief Names the calling thread in the exported traces.
+   */
+  void setThreadName(const std::string& name);
+
+  /**
+   * @brief Returns a copy of a name which lives as long as the profiler.
+   */
+  const char* intern(const std::string& name);
+
+  /**
+   * @brief Drains the ring buffers of all the threads.
+   * @returns all the zones captured since the start of the capture, sorted by
+   * thread and start time
+   */
+  std::vector<Zone> collect();
+
+  /**
+   * @brief Returns the number of zones dropped because a ring buffer was full.
+   */
+  [[nodiscard]] uint64_t droppedZones() const;
+
+  /**
+   * @brief Exports the captured zones in the Chrome trace event JSON format.
+   */
+  std::string toChromeTrace();
+
+  /**
+   * @brief Writes the captured zones to a Chrome trace event JSON file.
+   * @returns whether the file was written
+   */
+  bool saveChromeTrace(const std::string& filename);
+
+  /**
+   * @brief Returns the time elapsed since the creation of the profiler, in
+   * nanoseconds.
+   */
+  [[nodiscard]] uint64_t now() const;
+
+private:
+  Profiler();
+
+  ProfilerThreadBuffer& _threadBuffer();
+  void _pushZone(ProfilerThreadBuffer& buffer, size_t stackIndex, uint64_t end);
+
+private:
+  std::atomic<bool> _capturing;
+  std::atomic<uint64_t> _captureStart;
+  uint64_t _epoch;
+  mutable std::mutex _threadsMutex;
+  std::vector<std::shared_ptr<ProfilerThreadBuffer>> _threads;
+  std::vector<Zone> _zones;
+  std::mutex _namesMutex;
+  std::unordered_set<std::string> _names;
+
+}; // end of class Profiler
+
+/**
+ * @brief Opens a profiler zone for the lifetime of the object.
+ */
+class BABYLON_SHARED_EXPORT ProfileZone {
+
+public:
+  explicit ProfileZone(const char* name)
+  {
+    Profiler::Default().beginZone(name);
+  }
+  ~ProfileZone()
+  {
+    Profiler::Default().endZone();
+  }
+
+  ProfileZone(const ProfileZone&) = delete;
+  ProfileZone& operator=(const ProfileZone&) = delete;
+
+}; // end of class ProfileZone
+
+} // end of namespace BABYLON
+
+#define BABYLON_PROFILE_CONCAT_IMPL(a, b) a##b
+#define BABYLON_PROFILE_CONCAT(a, b) BABYLON_PROFILE_CONCAT_IMPL(a, b)
+
+#ifdef BABYLON_ENABLE_PROFILER
+#define BABYLON_PROFILE_ZONE(name)                                                                 \
+  const ::BABYLON::ProfileZone BABYLON_PROFILE_CONCAT(_babylonProfileZone, __LINE__)(name)
+#else
+#define BABYLON_PROFILE_ZONE(name)
+#endif
+
+#endif // end of BABYLON_INSTRUMENTATION_PROFILER_H
@@ -1,6 +1,8 @@
 #ifndef BABYLON_LIGHTS_LIGHT_H
 #define BABYLON_LIGHTS_LIGHT_H
 
+#include <unordered_set>
+
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_common.h>
 #include <babylon/engines/node.h>
@@ -225,6 +227,72 @@ public:
    */
   bool canAffectMesh(AbstractMesh* mesh);
 
+  /**
+   * @brief Gets the only meshes impacted by this light.
+   */
+  [[nodiscard]] const std::vector<AbstractMeshPtr>& includedOnlyMeshes() const;
+
+  /**
+   * @brief Sets the only meshes impacted by this light.
+   */
+  void setIncludedOnlyMeshes(const std::vector<AbstractMeshPtr>& meshes);
+
+  /**
+   * @brief Adds a mesh to the only meshes impacted by this light.
+   */
+  void addIncludedOnlyMesh(const AbstractMeshPtr& mesh);
+
+  /**
+   * @brief Removes a mesh from the only meshes impacted by this light.
+   * @returns whether the mesh was in the list
+   */
+  bool removeIncludedOnlyMesh(AbstractMesh* mesh);
+
+  /**
+   * @brief Gets the meshes not impacted by this light.
+   */
+  [[nodiscard]] const std::vector<AbstractMeshPtr>& excludedMeshes() const;
+
+  /**
+   * @brief Sets the meshes not impacted by this light.
+   */
+  void setExcludedMeshes(const std::vector<AbstractMeshPtr>& meshes);
+
+  /**
+   * @brief Adds a mesh to the meshes not impacted by this light.
+   */
+  void addExcludedMesh(const AbstractMeshPtr& mesh);
+
+  /**
+   * @brief Removes a mesh from the meshes not impacted by this light.
+   * @returns whether the mesh was in the list
+   */
+  bool removeExcludedMesh(AbstractMesh* mesh);
+
+  /**
+   * @brief Hidden
+   * Gets the bounding sphere of the volume lit by the light (its range).
+   * @param center defines the vector receiving the center of the sphere
+   * @param radius defines the float receiving the radius of the sphere
+   * @returns false if the lit volume is not bounded
+   */
+  virtual bool _getLitVolumeBoundingSphere(Vector3& center, float& radius);
+
+  /**
+   * @brief Hidden
+   * Specifies if the light stops at its range in every material. The physical
+   * falloff ignores the range, and it is the default falloff of the PBR
+   * materials.
+   */
+  [[nodiscard]] bool _isLimitedByRange() const;
+
+  /**
+   * @brief Hidden
+   * Specifies if the volume lit by the light (range and shape) intersects a
+   * sphere in world space.
+   */
+  virtual bool _canLightSphere(const Vector3& center, float radius);
+
   /**
    * @brief Releases resources associated with this node.
    * @param doNotRecurse Set to true to not recurse into each children (recurse
@@ -384,26 +452,6 @@ protected:
    */
   void set_renderPriority(int value);
 
-  /**
-   * @brief Gets the only meshes impacted by this light.
-   */
-  std::vector<AbstractMeshPtr>& get_includedOnlyMeshes();
-
-  /**
-   * @brief Sets the only meshes impacted by this light.
-   */
-  void set_includedOnlyMeshes(const std::vector<AbstractMeshPtr>& value);
-
-  /**
-   * @brief Gets the meshes not impacted by this light.
-   */
-  std::vector<AbstractMeshPtr>& get_excludedMeshes();
-
-  /**
-   * @brief Sets the meshes not impacted by this light.
-   */
-  void set_excludedMeshes(const std::vector<AbstractMeshPtr>& value);
-
   /**
    * @brief Gets the layer id use to find what meshes are not impacted by the
    * light. Inactive if 0
@@ -484,6 +532,8 @@ public:
    * Defines how far from the source the light is impacting in scene units.
    * Note: Unused in PBR material as the distance light falloff is defined
    * following the inverse squared falloff.
+   * Note: The meshes out of the range of a point or spot light are not
+   * assigned the light.
    */
   Property<Light, float> range;
 
@@ -493,7 +543,8 @@ public:
    * in Light.FALLOFF_x.
    *
    * Note: This is only useful for PBR Materials at the moment. This could be
-   * extended if required to other types of materials.
+   * extended if required to other types of materials. Only the lights with the
+   * standard or gltf falloff are skipped for the meshes out of their range.
    */
   unsigned int falloffType;
 
@@ -554,16 +605,6 @@ public:
    */
   Property<Light, int> renderPriority;
 
-  /**
-   * Meshes impacted by this light
-   */
-  Property<Light, std::vector<AbstractMeshPtr>> includedOnlyMeshes;
-
-  /**
-   * Meshes not impacted by this light
-   */
-  Property<Light, std::vector<AbstractMeshPtr>> excludedMeshes;
-
   /**
    * Layer id use to find what meshes are not impacted by the light
    */
@@ -582,6 +623,18 @@ public:
   /** Hidden */
   const bool _isLight;
 
+  /** Hidden (whether the lit volume of the light is tracked by its scene) */
+  bool _lightsTreeTracked;
+
+  /** Hidden (proxy of the light in the scene lights tree, -1 if unbounded) */
+  int _lightsTreeProxyId;
+
+  /** Hidden (bounding sphere of the lit volume when it was last tracked) */
+  Vector3 _lightsTreeCenter;
+
+  /** Hidden */
+  float _lightsTreeRadius;
+
 protected:
   float _inverseSquaredRange;
 
@@ -600,6 +653,10 @@ private:
   bool _shadowEnabled;
   std::vector<AbstractMeshPtr> _includedOnlyMeshes;
   std::vector<AbstractMeshPtr> _excludedMeshes;
+  // Membership sets of the arrays above, the arrays are only modified through
+  // the accessors which keep both in sync
+  std::unordered_set<AbstractMesh*> _includedOnlyMeshesSet;
+  std::unordered_set<AbstractMesh*> _excludedMeshesSet;
   unsigned int _includeOnlyWithLayerMask;
   unsigned int _excludeWithLayerMask;
   unsigned int _lightmapMode;
@@ -98,6 +98,18 @@ public:
    */
   void prepareLightSpecificDefines(MaterialDefines& defines, unsigned int lightIndex) override;
 
+  /**
+   * @brief Hidden
+   * Gets the sphere of center the light position and of radius the light range.
+   */
+  bool _getLitVolumeBoundingSphere(Vector3& center, float& sphereRadius) override;
+
+  /**
+   * @brief Hidden
+   * Specifies if a sphere in world space is in the range of the light.
+   */
+  bool _canLightSphere(const Vector3& center, float sphereRadius) override;
+
 protected:
   /**
    * @brief Creates a PointLight object from the passed name and position (Vector3) and adds it in
@@ -86,6 +86,18 @@ public:
    */
   void prepareLightSpecificDefines(MaterialDefines& defines, unsigned int lightIndex) override;
 
+  /**
+   * @brief Hidden
+   * Gets the sphere of center the light position and of radius the light range.
+   */
+  bool _getLitVolumeBoundingSphere(Vector3& center, float& sphereRadius) override;
+
+  /**
+   * @brief Hidden
+   * Specifies if a sphere in world space is in the range and in the cone of the light.
+   */
+  bool _canLightSphere(const Vector3& center, float sphereRadius) override;
+
 protected:
   /**
    * @brief Creates a SpotLight object in the scene. A spot light is a simply light oriented cone.
@@ -7,6 +7,7 @@
 #include <vector>
 
 #include <babylon/babylon_api.h>
+#include <babylon/core/array_buffer_view.h>
 #include <babylon/loading/iscene_loader_plugin_extensions.h>
 
 namespace BABYLON {
@@ -51,7 +52,8 @@ struct BABYLON_SHARED_EXPORT ISceneLoaderPluginAsync {
    * @param meshesNames An array of mesh names, a single mesh name, or empty
    * string for all meshes that filter what meshes are imported
    * @param scene The scene to import into
-   * @param data The data to import
+   * @param data The data to import (text or binary, depending on the file
+   * extension)
    * @param rootUrl The root url for scene and resources
    * @param onProgress The callback when the load progresses
    * @param fileName Defines the name of the file to load
@@ -60,7 +62,7 @@ struct BABYLON_SHARED_EXPORT ISceneLoaderPluginAsync {
    */
   virtual ImportedMeshes importMeshAsync(
     const std::vector<std::string>& meshesNames, Scene* scene,
-    const std::string& data, const std::string& rootUrl,
+    const std::variant<std::string, ArrayBufferView>& data, const std::string& rootUrl,
     const std::function<void(const SceneLoaderProgressEvent& event)>& onProgress
     = nullptr,
     const std::string& fileName = "")
@@ -69,14 +71,16 @@ struct BABYLON_SHARED_EXPORT ISceneLoaderPluginAsync {
   /**
    * @brief Load into a scene.
    * @param scene The scene to load into
-   * @param data The data to import
+   * @param data The data to import (text or binary, depending on the file
+   * extension)
    * @param rootUrl The root url for scene and resources
    * @param onProgress The callback when the load progresses
    * @param fileName Defines the name of the file to load
    * @returns Nothing
    */
   virtual void loadAsync(
-    Scene* scene, const std::string& data, const std::string& rootUrl,
+    Scene* scene, const std::variant<std::string, ArrayBufferView>& data,
+    const std::string& rootUrl,
     const std::function<void(const SceneLoaderProgressEvent& event)>& onProgress
     = nullptr,
     const std::string& fileName = "")
@@ -98,14 +102,16 @@ struct BABYLON_SHARED_EXPORT ISceneLoaderPluginAsync {
   /**
    * @brief Load into an asset container.
    * @param scene The scene to load into
-   * @param data The data to import
+   * @param data The data to import (text or binary, depending on the file
+   * extension)
    * @param rootUrl The root url for scene and resources
    * @param onProgress The callback when the load progresses
    * @param fileName Defines the name of the file to load
    * @returns The loaded asset container
    */
   virtual AssetContainerPtr loadAssetContainerAsync(
-    Scene* scene, const std::string& data, const std::string& rootUrl,
+    Scene* scene, const std::variant<std::string, ArrayBufferView>& data,
+    const std::string& rootUrl,
     const std::function<void(const SceneLoaderProgressEvent& event)>& onProgress
     = nullptr,
     const std::string& fileName = "")
@@ -430,6 +430,7 @@ private:
   void _loadExtensions();
   void _checkExtensions();
   void _setState(const GLTFLoaderState& state);
+  void _releaseBufferPages();
   INodePtr _createRootNode();
   void _forEachPrimitive(const INode& node,
                          const std::function<void(const AbstractMeshPtr& babylonMesh)>& callback);
@@ -3,7 +3,7 @@
 
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_common.h>
-#include <babylon/core/data_view.h>
+#include <babylon/core/array_buffer_view.h>
 
 namespace BABYLON {
 namespace GLTF2 {
@@ -11,18 +11,20 @@ namespace GLTF2 {
 class BABYLON_SHARED_EXPORT BinaryReader {
 
 public:
-  BinaryReader(const ArrayBuffer& arrayBuffer);
+  BinaryReader(const ArrayBufferView& arrayBuffer);
   ~BinaryReader(); // = default
 
   [[nodiscard]] size_t getPosition() const;
   [[nodiscard]] size_t getLength() const;
   uint32_t readUint32();
-  Uint8Array readUint8Array(size_t length);
+  /**
+   * @brief Returns a view of the next length bytes (the data is not copied).
+   */
+  ArrayBufferView readUint8Array(size_t length);
   void skipBytes(size_t length);
 
 private:
-  ArrayBuffer _arrayBuffer;
-  DataView _dataView;
+  ArrayBufferView _arrayBuffer;
   size_t _byteOffset;
 
 }; // end of class BinaryReader
@@ -86,7 +86,8 @@ public:
    */
   ImportedMeshes
   importMeshAsync(const std::vector<std::string>& meshesNames, Scene* scene,
-                  const std::string& data, const std::string& rootUrl,
+                  const std::variant<std::string, ArrayBufferView>& data,
+                  const std::string& rootUrl,
                   const std::function<void(const SceneLoaderProgressEvent& event)>& onProgress
                   = nullptr,
                   const std::string& fileName = "") override;
@@ -102,7 +103,8 @@ public:
    * @returns a promise which completes when objects have been loaded to the
    * scene
    */
-  void loadAsync(Scene* scene, const std::string& data, const std::string& rootUrl,
+  void loadAsync(Scene* scene, const std::variant<std::string, ArrayBufferView>& data,
+                 const std::string& rootUrl,
                  const std::function<void(const SceneLoaderProgressEvent& event)>& onProgress
                  = nullptr,
                  const std::string& fileName = "") override;
@@ -117,7 +119,8 @@ public:
    * @returns The loaded asset container
    */
   AssetContainerPtr loadAssetContainerAsync(
-    Scene* scene, const std::string& data, const std::string& rootUrl,
+    Scene* scene, const std::variant<std::string, ArrayBufferView>& data,
+    const std::string& rootUrl,
     const std::function<void(const SceneLoaderProgressEvent& event)>& onProgress = nullptr,
     const std::string& fileName                                                  = "") override;
 
@@ -240,17 +243,18 @@ protected:
     const std::function<void(IGLTFValidationResults* results, EventState& es)>& callback);
 
 private:
-  IGLTFLoaderData _parseAsync(Scene* scene, const std::variant<std::string, ArrayBuffer>& data,
+  IGLTFLoaderData _parseAsync(Scene* scene,
+                              const std::variant<std::string, ArrayBufferView>& data,
                               const std::string& rootUrl, const std::string& fileName = "");
   void _validateAsync(Scene* scene, const std::string& json, const std::string& rootUrl,
                       const std::string& fileName = "");
   IGLTFLoaderPtr _getLoader(const IGLTFLoaderData& loaderData);
-  UnpackedBinary _unpackBinary(const ArrayBuffer& data);
+  UnpackedBinary _unpackBinary(const ArrayBufferView& data);
   UnpackedBinary _unpackBinaryV1(BinaryReader& binaryReader) const;
   UnpackedBinary _unpackBinaryV2(BinaryReader& binaryReader) const;
   static std::optional<Version> _parseVersion(const std::string& version);
   static int _compareVersion(const Version& a, const Version& b);
-  static std::string _decodeBufferToText(const Uint8Array& buffer);
+  static std::string _decodeBufferToText(const ArrayBufferView& buffer);
   void _logEnabled(const std::string& message);
   void _logDisabled(const std::string& message);
   void _startPerformanceCounterEnabled(const std::string& counterName);
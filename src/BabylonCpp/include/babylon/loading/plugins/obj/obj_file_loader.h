@@ -1,6 +1,10 @@
 #ifndef BABYLON_LOADING_PLUGINS_OBJ_OBJ_FILE_LOADER_H
 #define BABYLON_LOADING_PLUGINS_OBJ_OBJ_FILE_LOADER_H
 
+#include <limits>
+#include <string_view>
+#include <unordered_map>
+
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_common.h>
 #include <babylon/loading/plugins/obj/mtl_file_loader.h>
@@ -20,45 +24,53 @@ struct MeshObject {
 }; // end of struct MeshObject
 
 /**
- * @brief Tuple with indice of Position, Normal, UV  [pos, norm, uvs]
+ * @brief Indices of a face vertex in the positions, uvs and normals of the obj
+ * file (Undefined when the face does not reference the component).
  */
-struct TuplePosNormEntry {
-  std::vector<size_t> normals = {};
-  std::vector<size_t> idx     = {};
-  std::vector<size_t> uv      = {};
-}; // end of struct MeshObject
+struct OBJVertexKey {
+  static constexpr uint32_t Undefined = std::numeric_limits<uint32_t>::max();
+
+  uint32_t position = Undefined;
+  uint32_t uv       = Undefined;
+  uint32_t normal   = Undefined;
+
+  bool operator==(const OBJVertexKey& other) const
+  {
+    return position == other.position && uv == other.uv && normal == other.normal;
+  }
+}; // end of struct OBJVertexKey
+
+struct OBJVertexKeyHash {
+  size_t operator()(const OBJVertexKey& key) const
+  {
+    const auto h = (static_cast<uint64_t>(key.position) * 0x9E3779B97F4A7C15ull)
+                   ^ (static_cast<uint64_t>(key.uv) * 0xC2B2AE3D27D4EB4Full)
+                   ^ (static_cast<uint64_t>(key.normal) * 0x165667B19E3779F9ull);
+    return static_cast<size_t>(h ^ (h >> 32));
+  }
+}; // end of struct OBJVertexKeyHash
 
 struct OBJParseSolidState {
-  std::vector<Vector3> positions; // values for the positions of vertices
-  std::vector<Vector3> normals;   // Values for the normals
-  std::vector<Vector2> uvs;       // Values for the textures
-  std::vector<Color4> colors;
-  std::vector<MeshObject> meshesFromObj;          // [mesh] Contains all the obj meshes
-  MeshObject handledMesh;                         // The current mesh of meshes array
-  std::vector<uint32_t> indicesForBabylon;        // The list of indices for VertexData
-  std::vector<Vector3> wrappedPositionForBabylon; // The list of position in vectors
-  std::vector<Vector2> wrappedUvsForBabylon;      // Array with all value of uvs to match with the
-                                                  // indices
-  std::vector<Color4>
-    wrappedColorsForBabylon; // Array with all color values to match with the indices
-  std::vector<Vector3>
-    wrappedNormalsForBabylon; // Array with all value of normals to match with the indices
-  std::vector<TuplePosNormEntry>
-    tuplePosNorm; // Create a tuple with indice of Position, Normal, UV  [pos, norm, uvs]
-  size_t curPositionInIndices = 0;
-  bool hasMeshes;                            // Meshes are defined in the file
-  Float32Array unwrappedPositionsForBabylon; // Value of positionForBabylon w/o Vector3() [x,y,z]
-  Float32Array unwrappedColorsForBabylon;    // Value of colorForBabylon w/o Color4() [r,g,b,a]
-  Float32Array unwrappedNormalsForBabylon;   // Value of normalsForBabylon w/o Vector3()  [x,y,z]
-  Float32Array unwrappedUVForBabylon;        // Value of uvsForBabylon w/o Vector3()      [x,y,z]
-  std::vector<std::string> triangles;        // Indices from new triangles coming from polygons
+  Float32Array positions; // values for the positions of vertices [x,y,z]
+  Float32Array normals;   // Values for the normals [x,y,z]
+  Float32Array uvs;       // Values for the textures [u,v]
+  Float32Array colors;    // Values for the vertex colors [r,g,b,a]
+  std::vector<MeshObject> meshesFromObj; // [mesh] Contains all the obj meshes
+  // Index of each (position, uv, normal) tuple already added to the current mesh
+  std::unordered_map<OBJVertexKey, uint32_t, OBJVertexKeyHash> vertexIndices;
+  IndicesArray indicesForBabylon;            // The list of indices for VertexData
+  bool hasMeshes = false;                    // Meshes are defined in the file
+  Float32Array unwrappedPositionsForBabylon; // Value of positionForBabylon [x,y,z]
+  Float32Array unwrappedColorsForBabylon;    // Value of colorForBabylon [r,g,b,a]
+  Float32Array unwrappedNormalsForBabylon;   // Value of normalsForBabylon [x,y,z]
+  Float32Array unwrappedUVForBabylon;        // Value of uvsForBabylon [u,v]
   std::string materialNameFromObj;           // The name of the current material
   std::string fileToLoad;                    // The name of the mtlFile to load
   MTLFileLoader materialsFromMTLFile;        // Used for reading and parsing the MTL file
   std::string objMeshName;                   // The name of the current obj mesh
-  size_t increment;                          // Id for meshes created by the multimaterial
-  bool isFirstMaterial;
-  Color4 grayColor = Color4(0.5f, 0.5f, 0.5f, 1.f);
+  size_t increment     = 1;                  // Id for meshes created by the multimaterial
+  bool isFirstMaterial = true;
+  Color4 grayColor     = Color4(0.5f, 0.5f, 0.5f, 1.f);
 };
 
 /**
@@ -174,6 +186,29 @@ public:
    */
   bool canDirectLoad(const std::string& data);
 
+  /**
+   * @brief Imports meshes from the content of an obj file.
+   * @param meshesNames defines the names of the meshes to import (empty to import all meshes)
+   * @param scene defines the scene the meshes are added to
+   * @param data defines the content of the obj file
+   * @param rootUrl defines the root url of the file
+   * @returns the imported meshes
+   */
+  std::vector<AbstractMeshPtr> importMesh(const std::vector<std::string>& meshesNames,
+                                          Scene* scene, std::string_view data,
+                                          const std::string& rootUrl = "");
+
+  /**
+   * @brief Imports meshes from an obj file. The file is memory mapped and
+   * parsed in place.
+   * @param meshesNames defines the names of the meshes to import (empty to import all meshes)
+   * @param scene defines the scene the meshes are added to
+   * @param filename defines the path of the obj file
+   * @returns the imported meshes (empty if the file could not be read)
+   */
+  std::vector<AbstractMeshPtr> importMeshFromFile(const std::vector<std::string>& meshesNames,
+                                                  Scene* scene, const std::string& filename);
+
 private:
   static MeshLoadOptions currentMeshLoadOptions();
 
@@ -191,124 +226,35 @@ private:
    * @private
    */
   std::vector<AbstractMeshPtr> _parseSolid(const std::vector<std::string>& meshesNames,
-                                           Scene* scene, const std::string& data,
+                                           Scene* scene, std::string_view data,
                                            const std::string& rootUrl);
 
   /**
-   * @brief Search for obj in the given array.
-   * This function is called to check if a couple of data already exists in an array.
-   *
-   * If found, returns the index of the founded tuple index. Returns -1 if not found
-   * @param arr Array<{ normals: Array<number>, idx: Array<number> }>
-   * @param obj Array<number>
-   * @returns {boolean}
-   */
-  int _isInArray(std::vector<TuplePosNormEntry>& arr, const std::vector<size_t>& obj);
-
-  /**
-   * @brief Search for obj in the given array.
-   * This function is called to check if a couple of data already exists in an array.
-   *
-   * If found, returns the index of the founded tuple index. Returns -1 if not found
-   * @param arr Array<{ normals: Array<number>, idx: Array<number> }>
-   * @param obj Array<number>
-   * @returns {boolean}
-   */
-  int _isInArrayUV(std::vector<TuplePosNormEntry>& arr, const std::vector<size_t>& obj);
-
-  /**
-   * @brief This function set the data for each triangle.
-   * Data are position, normals and uvs
-   * If a tuple of (position, normal) is not set, add the data into the corresponding array
-   * If the tuple already exist, add only their indice
+   * @brief Parses the content of the OBJ file into state.meshesFromObj.
    *
-   * @param tuplePosNorm Tuples with indice of Position, Normal, UV  [pos, norm, uvs]
-   * @param indicePositionFromObj Integer The index in positions array
-   * @param indiceUvsFromObj Integer The index in uvs array
-   * @param indiceNormalFromObj Integer The index in normals array
-   * @param positionVectorFromOBJ Vector3 The value of position at index objIndice
-   * @param textureVectorFromOBJ Vector3 The value of uvs
-   * @param normalsVectorFromOBJ Vector3 The value of normals at index objNormale
-   */
-  void _setData(size_t indicePositionFromObj, size_t indiceUvsFromObj, size_t indiceNormalFromObj,
-                const Vector3& positionVectorFromOBJ, const Vector2& textureVectorFromOBJ,
-                const Vector3& normalsVectorFromOBJ, OBJParseSolidState& state,
-                const std::optional<Color4>& positionColorsFromOBJ = std::nullopt);
-
-  /**
-   * @brief Transform Vector() and BABYLON.Color() objects into numbers in an array.
-   * @param state
-   */
-  void _unwrapData(OBJParseSolidState& state);
-
-  /**
-   * @brief Create triangles from polygons
-   * It is important to notice that a triangle is a polygon
-   * We get 5 patterns of face defined in OBJ File :
-   * facePattern1 = ["1","2","3","4","5","6"]
-   * facePattern2 = ["1/1","2/2","3/3","4/4","5/5","6/6"]
-   * facePattern3 = ["1/1/1","2/2/2","3/3/3","4/4/4","5/5/5","6/6/6"]
-   * facePattern4 = ["1//1","2//2","3//3","4//4","5//5","6//6"]
-   * facePattern5 = ["-1/-1/-1","-2/-2/-2","-3/-3/-3","-4/-4/-4","-5/-5/-5","-6/-6/-6"]
-   * Each pattern is divided by the same method
-   * @param face Array[String] The indices of elements
-   * @param v Integer The variable to increment
+   * The file is split in chunks of lines which are tokenized concurrently: a
+   * first pass counts the vertex statements of each chunk so that every chunk
+   * knows where its vertices land in the file arrays (and can resolve
+   * relative indices), a second pass parses the numbers and triangulates the
+   * faces. The meshes are then assembled serially, in file order.
+   * @param data The content of the obj file
    * @param state
    */
-  void _getTriangles(const std::vector<std::string>& face, size_t v, OBJParseSolidState& state);
+  void _parseMeshObjects(std::string_view data, OBJParseSolidState& state);
 
   /**
-   * @brief Create triangles and push the data for each polygon for the pattern 1.
-   * In this pattern we get vertice positions
-   * @param face
-   * @param v
-   * @param state
-   */
-  void _setDataForCurrentFaceWithPattern1(const std::vector<std::string>& face, size_t v,
-                                          OBJParseSolidState& state);
-
-  /**
-   * @brief Create triangles and push the data for each polygon for the pattern 2.
-   * In this pattern we get vertice positions and uvsu
-   * @param face
-   * @param v
-   * @param state
-   */
-  void _setDataForCurrentFaceWithPattern2(const std::vector<std::string>& face, size_t v,
-                                          OBJParseSolidState& state);
-
-  /**
-   * @brief Create triangles and push the data for each polygon for the pattern 3.
-   * In this pattern we get vertice positions, uvs and normals
-   * @param face
-   * @param v
-   * @param state
-   */
-  void _setDataForCurrentFaceWithPattern3(const std::vector<std::string>& face, size_t v,
-                                          OBJParseSolidState& state);
-
-  /**
-   * @brief Create triangles and push the data for each polygon for the pattern 4.
-   * In this pattern we get vertice positions and normals
-   * @param face
-   * @param v
-   * @param state
-   */
-  void _setDataForCurrentFaceWithPattern4(const std::vector<std::string>& face, size_t v,
-                                          OBJParseSolidState& state);
-
-  /**
-   * @brief Create triangles and push the data for each polygon for the pattern 3
-   * In this pattern we get vertice positions, uvs and normals
-   * @param face
-   * @param v
+   * @brief Adds a face vertex to the current mesh.
+   * If the tuple (position, uv, normal) was already added to the mesh, only its index is added.
+   * Otherwise the position, uv, normal (and color) values are appended to the mesh data.
+   * When OptimizeWithUV is false, the uv index is not part of the tuple.
+   *
+   * @param vertex The indices of the vertex in the file arrays
    * @param state
    */
-  void _setDataForCurrentFaceWithPattern5(const std::vector<std::string>& face, size_t v,
-                                          OBJParseSolidState& state);
+  void _setData(const OBJVertexKey& vertex, OBJParseSolidState& state);
 
   /**
-   * @brief Hidden
+   * @brief Moves the data gathered since the previous mesh definition into the last mesh.
    */
   void _addPreviousObjMesh(OBJParseSolidState& state);
 
@@ -321,40 +267,6 @@ public:
    * Defines the extension the plugin is able to load.
    */
   std::string extensions = ".obj";
-  /** @hidden */
-  std::string obj = "^o";
-  /** @hidden */
-  std::string group = "^g";
-  /** @hidden */
-  std::string mtllib = "^mtllib ";
-  /** @hidden */
-  std::string usemtl = "^usemtl ";
-  /** @hidden */
-  std::string smooth = "^s ";
-  /** @hidden */
-  std::string vertexPattern = "v( +[\\d|\\.|\\+|\\-|e|E]+){3,7}";
-  // vn float float float
-  /** @hidden */
-  std::string normalPattern
-    = "vn( +[\\d|\\.|\\+|\\-|e|E]+)( +[\\d|\\.|\\+|\\-|e|E]+)( +[\\d|\\.|\\+|\\-|e|E]+)";
-  // vt float float
-  /** @hidden */
-  std::string uvPattern = "vt( +[\\d|\\.|\\+|\\-|e|E]+)( +[\\d|\\.|\\+|\\-|e|E]+)";
-  // f vertex vertex vertex ...
-  /** @hidden */
-  std::string facePattern1 = "f\\s+(([\\d]{1,}[\\s]?){3,})+";
-  // f vertex/uvs vertex/uvs vertex/uvs ...
-  /** @hidden */
-  std::string facePattern2 = "f\\s+((([\\d]{1,}\\/[\\d]{1,}[\\s]?){3,})+)";
-  // f vertex/uvs/normal vertex/uvs/normal vertex/uvs/normal ...
-  /** @hidden */
-  std::string facePattern3 = "f\\s+((([\\d]{1,}\\/[\\d]{1,}\\/[\\d]{1,}[\\s]?){3,})+)";
-  // f vertex//normal vertex//normal vertex//normal ...
-  /** @hidden */
-  std::string facePattern4 = "f\\s+((([\\d]{1,}\\/\\/[\\d]{1,}[\\s]?){3,})+)";
-  // f -vertex/-uvs/-normal -vertex/-uvs/-normal -vertex/-uvs/-normal ...
-  /** @hidden */
-  std::string facePattern5 = "f\\s+(((-[\\d]{1,}\\/-[\\d]{1,}\\/-[\\d]{1,}[\\s]?){3,})+)";
 
 private:
   bool _forAssetContainer = false;
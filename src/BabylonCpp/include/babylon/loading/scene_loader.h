@@ -6,6 +6,7 @@
 #include <variant>
 
 #include <babylon/babylon_api.h>
+#include <babylon/core/array_buffer_view.h>
 #include <babylon/engines/constants.h>
 #include <babylon/misc/observable.h>
 
@@ -122,7 +123,8 @@ private:
     const std::function<void(
       const std::variant<ISceneLoaderPluginPtr, ISceneLoaderPluginAsyncPtr>&
         plugin,
-      const std::string& data, const std::string& responseURL)>& onSuccess,
+      const std::variant<std::string, ArrayBufferView>& data,
+      const std::string& responseURL)>& onSuccess,
     const std::function<void(const SceneLoaderProgressEvent& event)>&
       onProgress,
     const std::function<void(const std::string& message,
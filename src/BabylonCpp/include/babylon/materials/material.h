@@ -663,6 +663,7 @@ protected:
 
 private:
   void releaseVertexArrayObject(const AbstractMeshPtr& mesh, bool forceDisposeEffect = false);
+  void _reindexInScene();
 
 public:
   // Events
@@ -690,7 +691,7 @@ public:
   /**
    * The ID of the material
    */
-  std::string id;
+  ObservedString<Material> id;
 
   /**
    * Gets or sets the unique id of the material
@@ -700,7 +701,7 @@ public:
   /**
    * The name of the material
    */
-  std::string name;
+  ObservedString<Material> name;
 
   /**
    * Specifies if the ready state should be checked on each call
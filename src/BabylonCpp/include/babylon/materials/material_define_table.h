@@ -0,0 +1,495 @@
+#ifndef BABYLON_MATERIALS_MATERIAL_DEFINE_TABLE_H
+#define BABYLON_MATERIALS_MATERIAL_DEFINE_TABLE_H
+
+#include <cstdint>
+#include <deque>
+#include <initializer_list>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Kind of value held by a material define.
+ */
+enum class MaterialDefineKind {
+  Bool,
+  Int,
+  Float,
+  String,
+}; // end of enum class MaterialDefineKind
+
+/**
+ * @brief Append-only registry mapping the material define names to dense
+ * indices.
+ *
+ * The registry of a given define kind is shared by all the material types, so
+ * that defines set by name from lights, shadow generators or helper functions
+ * land at the same index whatever the material. The name of a define is hashed
+ * once when it is resolved to its index, hot code paths should resolve it once
+ * and keep the index (see MaterialDefineTable::Index()).
+ * @note Like the rest of the material API, the registry is not thread safe.
+ */
+class BABYLON_SHARED_EXPORT MaterialDefineRegistry {
+
+public:
+  /**
+   * @brief Returns the registry used for the given kind of defines.
+   */
+  static MaterialDefineRegistry& Get(MaterialDefineKind kind);
+
+  /**
+   * @brief Returns the index of a define, registering it if needed.
+   */
+  size_t indexOf(const std::string& name);
+
+  /**
+   * @brief Returns the index of a define if it is registered.
+   */
+  [[nodiscard]] std::optional<size_t> find(const std::string& name) const;
+
+  /**
+   * @brief Returns the name of the define registered at the given index.
+   */
+  [[nodiscard]] const std::string& name(size_t index) const;
+
+  /**
+   * @brief Returns the number of registered defines.
+   */
+  [[nodiscard]] size_t size() const;
+
+private:
+  std::unordered_map<std::string, size_t> _indices;
+  // deque: the references returned by name() remain valid on registration
+  std::deque<std::string> _names;
+
+}; // end of class MaterialDefineRegistry
+
+/**
+ * @brief Packed bitset indexed by define index, missing words read as zeros.
+ */
+class MaterialDefineBits {
+
+public:
+  [[nodiscard]] bool test(size_t index) const
+  {
+    const auto word = index >> 6;
+    return word < _words.size() && ((_words[word] >> (index & 63)) & 1);
+  }
+
+  void set(size_t index, bool value)
+  {
+    const auto word = index >> 6;
+    if (word >= _words.size()) {
+      if (!value) {
+        return;
+      }
+      _words.resize(word + 1, 0);
+    }
+    const auto mask = uint64_t{1} << (index & 63);
+    if (value) {
+      _words[word] |= mask;
+    }
+    else {
+      _words[word] &= ~mask;
+    }
+  }
+
+  void clear()
+  {
+    _words.clear();
+  }
+
+  [[nodiscard]] size_t count() const
+  {
+    size_t count = 0;
+    for (auto word : _words) {
+      for (; word; word &= word - 1) {
+        ++count;
+      }
+    }
+    return count;
+  }
+
+  /**
+   * @brief Calls callback(index) for every set bit, by increasing index.
+   */
+  template <typename Callback>
+  void forEachSetBit(Callback&& callback) const
+  {
+    for (size_t w = 0; w < _words.size(); ++w) {
+      for (auto word = _words[w]; word; word &= word - 1) {
+        size_t bit = 0;
+        while (!((word >> bit) & 1)) {
+          ++bit;
+        }
+        callback(w * 64 + bit);
+      }
+    }
+  }
+
+  bool operator==(const MaterialDefineBits& other) const
+  {
+    const auto& shortest = _words.size() < other._words.size() ? _words : other._words;
+    const auto& longest  = _words.size() < other._words.size() ? other._words : _words;
+    for (size_t w = 0; w < shortest.size(); ++w) {
+      if (shortest[w] != longest[w]) {
+        return false;
+      }
+    }
+    for (size_t w = shortest.size(); w < longest.size(); ++w) {
+      if (longest[w] != 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool operator!=(const MaterialDefineBits& other) const
+  {
+    return !(operator==(other));
+  }
+
+private:
+  std::vector<uint64_t> _words;
+
+}; // end of class MaterialDefineBits
+
+template <typename T>
+struct MaterialDefineTraits;
+
+template <>
+struct MaterialDefineTraits<bool> {
+  static constexpr MaterialDefineKind Kind = MaterialDefineKind::Bool;
+};
+
+template <>
+struct MaterialDefineTraits<unsigned int> {
+  static constexpr MaterialDefineKind Kind = MaterialDefineKind::Int;
+};
+
+template <>
+struct MaterialDefineTraits<float> {
+  static constexpr MaterialDefineKind Kind = MaterialDefineKind::Float;
+};
+
+template <>
+struct MaterialDefineTraits<std::string> {
+  static constexpr MaterialDefineKind Kind = MaterialDefineKind::String;
+};
+
+/**
+ * @brief Set of material defines of a given value type, stored in a dense
+ * array indexed by the registry index of the define.
+ *
+ * The table can be used like the std::unordered_map<std::string, T> it
+ * replaces (operator[] declares missing defines), while comparing or copying
+ * two tables only compares or copies a few packed arrays.
+ */
+template <typename T>
+class MaterialDefineTable {
+
+public:
+  /**
+   * @brief Returns the registry index of a define (registering it if needed).
+   * The index is stable for the lifetime of the program.
+   */
+  static size_t Index(const std::string& name)
+  {
+    return Registry().indexOf(name);
+  }
+
+  /**
+   * @brief Returns the registry index of a define if it is registered.
+   */
+  static std::optional<size_t> Find(const std::string& name)
+  {
+    return Registry().find(name);
+  }
+
+  static MaterialDefineRegistry& Registry()
+  {
+    return MaterialDefineRegistry::Get(MaterialDefineTraits<T>::Kind);
+  }
+
+public:
+  /**
+   * @brief Replaces the defines of the table.
+   */
+  MaterialDefineTable& operator=(std::initializer_list<std::pair<const std::string, T>> defines)
+  {
+    clear();
+    for (const auto& define : defines) {
+      operator[](define.first) = define.second;
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Returns the value of a define, declaring it if needed.
+   */
+  T& operator[](const std::string& name)
+  {
+    return operator[](Index(name));
+  }
+
+  T& operator[](size_t index)
+  {
+    if (index >= _values.size()) {
+      _values.resize(index + 1);
+    }
+    _declared.set(index, true);
+    return _values[index];
+  }
+
+  /**
+   * @brief Returns the value of a declared define.
+   * @throws std::out_of_range if the define is not declared
+   */
+  [[nodiscard]] const T& at(const std::string& name) const
+  {
+    const auto index = Find(name);
+    if (!index || !contains(*index)) {
+      throw std::out_of_range("Undeclared material define: " + name);
+    }
+    return _values[*index];
+  }
+
+  [[nodiscard]] bool contains(const std::string& name) const
+  {
+    const auto index = Find(name);
+    return index && contains(*index);
+  }
+
+  [[nodiscard]] bool contains(size_t index) const
+  {
+    return _declared.test(index);
+  }
+
+  size_t erase(const std::string& name)
+  {
+    const auto index = Find(name);
+    if (!index || !contains(*index)) {
+      return 0;
+    }
+    _declared.set(*index, false);
+    _values[*index] = T{};
+    return 1;
+  }
+
+  [[nodiscard]] size_t size() const
+  {
+    return _declared.count();
+  }
+
+  [[nodiscard]] bool empty() const
+  {
+    return size() == 0;
+  }
+
+  void clear()
+  {
+    _declared.clear();
+    _values.clear();
+  }
+
+  /**
+   * @brief Calls callback(name, value) for every declared define, by
+   * registration order.
+   */
+  template <typename Callback>
+  void forEach(Callback&& callback) const
+  {
+    const auto& registry = Registry();
+    _declared.forEachSetBit(
+      [&](size_t index) { callback(registry.name(index), _values[index]); });
+  }
+
+  bool operator==(const MaterialDefineTable& other) const
+  {
+    if (_declared != other._declared) {
+      return false;
+    }
+    bool equal = true;
+    _declared.forEachSetBit(
+      [&](size_t index) { equal = equal && (_values[index] == other._values[index]); });
+    return equal;
+  }
+
+  bool operator!=(const MaterialDefineTable& other) const
+  {
+    return !(operator==(other));
+  }
+
+private:
+  MaterialDefineBits _declared;
+  std::vector<T> _values;
+
+}; // end of class MaterialDefineTable
+
+/**
+ * @brief Set of boolean material defines, stored as two packed bitsets
+ * (declared defines and their values).
+ */
+template <>
+class MaterialDefineTable<bool> {
+
+public:
+  /**
+   * @brief Proxy to a boolean define returned by the non const operator[].
+   */
+  class Reference {
+
+  public:
+    Reference(MaterialDefineTable* table, size_t index) : _table{table}, _index{index}
+    {
+    }
+
+    operator bool() const
+    {
+      return _table->test(_index);
+    }
+
+    Reference& operator=(bool value)
+    {
+      _table->_values.set(_index, value);
+      return *this;
+    }
+
+    Reference& operator=(const Reference& other)
+    {
+      return operator=(static_cast<bool>(other));
+    }
+
+  private:
+    MaterialDefineTable* _table;
+    size_t _index;
+
+  }; // end of class Reference
+
+public:
+  static size_t Index(const std::string& name)
+  {
+    return Registry().indexOf(name);
+  }
+
+  static std::optional<size_t> Find(const std::string& name)
+  {
+    return Registry().find(name);
+  }
+
+  static MaterialDefineRegistry& Registry()
+  {
+    return MaterialDefineRegistry::Get(MaterialDefineKind::Bool);
+  }
+
+public:
+  MaterialDefineTable& operator=(std::initializer_list<std::pair<const std::string, bool>> defines)
+  {
+    clear();
+    for (const auto& define : defines) {
+      operator[](define.first) = define.second;
+    }
+    return *this;
+  }
+
+  Reference operator[](const std::string& name)
+  {
+    return operator[](Index(name));
+  }
+
+  Reference operator[](size_t index)
+  {
+    _declared.set(index, true);
+    return Reference(this, index);
+  }
+
+  /**
+   * @brief Returns the value of a define, false when it is not declared.
+   */
+  [[nodiscard]] bool test(size_t index) const
+  {
+    return _values.test(index);
+  }
+
+  [[nodiscard]] bool at(const std::string& name) const
+  {
+    const auto index = Find(name);
+    if (!index || !contains(*index)) {
+      throw std::out_of_range("Undeclared material define: " + name);
+    }
+    return test(*index);
+  }
+
+  [[nodiscard]] bool contains(const std::string& name) const
+  {
+    const auto index = Find(name);
+    return index && contains(*index);
+  }
+
+  [[nodiscard]] bool contains(size_t index) const
+  {
+    return _declared.test(index);
+  }
+
+  size_t erase(const std::string& name)
+  {
+    const auto index = Find(name);
+    if (!index || !contains(*index)) {
+      return 0;
+    }
+    _declared.set(*index, false);
+    _values.set(*index, false);
+    return 1;
+  }
+
+  [[nodiscard]] size_t size() const
+  {
+    return _declared.count();
+  }
+
+  [[nodiscard]] bool empty() const
+  {
+    return size() == 0;
+  }
+
+  void clear()
+  {
+    _declared.clear();
+    _values.clear();
+  }
+
+  template <typename Callback>
+  void forEach(Callback&& callback) const
+  {
+    const auto& registry = Registry();
+    _declared.forEachSetBit(
+      [&](size_t index) { callback(registry.name(index), _values.test(index)); });
+  }
+
+  bool operator==(const MaterialDefineTable& other) const
+  {
+    return (_declared == other._declared) && (_values == other._values);
+  }
+
+  bool operator!=(const MaterialDefineTable& other) const
+  {
+    return !(operator==(other));
+  }
+
+private:
+  MaterialDefineBits _declared;
+  // Only declared defines can be set
+  MaterialDefineBits _values;
+
+}; // end of class MaterialDefineTable<bool>
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MATERIALS_MATERIAL_DEFINE_TABLE_H
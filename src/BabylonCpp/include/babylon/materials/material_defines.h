@@ -1,15 +1,18 @@
 #ifndef BABYLON_MATERIALS_MATERIAL_DEFINES_H
 #define BABYLON_MATERIALS_MATERIAL_DEFINES_H
 
-#include <unordered_map>
-
 #include <babylon/babylon_api.h>
 #include <babylon/materials/imaterial_defines.h>
+#include <babylon/materials/material_define_table.h>
 
 namespace BABYLON {
 
 /**
  * @brief Manages the defines for the Material.
+ *
+ * The defines are kept in packed tables indexed by the define registry (see
+ * MaterialDefineTable), so comparing two sets of defines or checking whether
+ * the effect defines string changed only costs a few word compares.
  */
 struct BABYLON_SHARED_EXPORT MaterialDefines : public IMaterialDefines {
 
@@ -21,6 +24,11 @@ struct BABYLON_SHARED_EXPORT MaterialDefines : public IMaterialDefines {
   ~MaterialDefines() override; // = default
 
   bool operator[](const std::string& define) const;
+  /**
+   * @brief Returns the value of a bool define from its registry index (see
+   * MaterialDefineTable<bool>::Index()).
+   */
+  bool operator[](size_t defineIndex) const;
   bool operator==(const MaterialDefines& rhs) const;
   bool operator!=(const MaterialDefines& rhs) const;
   friend std::ostream& operator<<(std::ostream& os, const MaterialDefines& materialDefines);
@@ -104,15 +112,16 @@ struct BABYLON_SHARED_EXPORT MaterialDefines : public IMaterialDefines {
 
   /**
    * @brief Converts the material define values to a string.
+   * The string is cached and only rebuilt when a define changed.
    * @returns String of material define information.
    */
   [[nodiscard]] std::string toString() const override;
 
   // Properties
-  std::unordered_map<std::string, bool> boolDef;
-  std::unordered_map<std::string, unsigned int> intDef;
-  std::unordered_map<std::string, float> floatDef;
-  std::unordered_map<std::string, std::string> stringDef;
+  MaterialDefineTable<bool> boolDef;
+  MaterialDefineTable<unsigned int> intDef;
+  MaterialDefineTable<float> floatDef;
+  MaterialDefineTable<std::string> stringDef;
 
   bool _isDirty;
   /** Hidden */
@@ -143,6 +152,15 @@ struct BABYLON_SHARED_EXPORT MaterialDefines : public IMaterialDefines {
   /** Hidden */
   bool _needUVs;
 
+private:
+  // Defines string cache, valid while the tables equal their cached copy
+  mutable bool _hasCachedString;
+  mutable std::string _cachedString;
+  mutable MaterialDefineTable<bool> _cachedBoolDef;
+  mutable MaterialDefineTable<unsigned int> _cachedIntDef;
+  mutable MaterialDefineTable<float> _cachedFloatDef;
+  mutable MaterialDefineTable<std::string> _cachedStringDef;
+
 }; // end of struct MaterialDefines
 
 } // end of namespace BABYLON
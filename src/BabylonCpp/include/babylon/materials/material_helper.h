@@ -103,10 +103,12 @@ struct BABYLON_SHARED_EXPORT MaterialHelper {
    * @param defines specifies the list of active defines
    * @param useInstances defines if instances have to be turned on
    * @param useClipPlane defines if clip plane have to be turned on
+   * @param useThinInstances defines if thin instances have to be turned on
    */
   static void PrepareDefinesForFrameBoundValues(Scene* scene, Engine* engine,
                                                 MaterialDefines& defines, bool useInstances,
-                                                std::optional<bool> useClipPlane = std::nullopt);
+                                                std::optional<bool> useClipPlane = std::nullopt,
+                                                bool useThinInstances            = false);
 
   /**
    * @brief Prepares the defines for bones.
@@ -115,6 +117,21 @@ struct BABYLON_SHARED_EXPORT MaterialHelper {
    */
   static void PrepareDefinesForBones(AbstractMesh* mesh, MaterialDefines& defines);
 
+  /**
+   * @brief Returns whether the mesh plays a baked vertex animation: its bone matrices are then read
+   * from the animation texture and its skeleton is not prepared.
+   * @param mesh The mesh containing the geometry data we will draw
+   * @returns true if the effects drawing the mesh must define BAKED_VERTEX_ANIMATION_TEXTURE
+   */
+  static bool UseBakedVertexAnimation(AbstractMesh* mesh);
+
+  /**
+   * @brief Prepares the defines for baked vertex animation, when supported by the material.
+   * @param mesh The mesh containing the geometry data we will draw
+   * @param defines The defines to update
+   */
+  static void PrepareDefinesForBakedVertexAnimation(AbstractMesh* mesh, MaterialDefines& defines);
+
   /**
    * @brief Prepares the defines for morph targets.
    * @param mesh The mesh containing the geometry data we will draw
@@ -131,11 +148,14 @@ struct BABYLON_SHARED_EXPORT MaterialHelper {
    * @param useBones Precise whether bones should be used or not (override mesh info)
    * @param useMorphTargets Precise whether morph targets should be used or not (override mesh info)
    * @param useVertexAlpha Precise whether vertex alpha should be used or not (override mesh info)
+   * @param useBakedVertexAnimation Precise whether baked vertex animation should be used or not
+   * (override mesh info)
    * @returns false if defines are considered not dirty and have not been checked
    */
   static bool PrepareDefinesForAttributes(AbstractMesh* mesh, MaterialDefines& defines,
                                           bool useVertexColor, bool useBones,
-                                          bool useMorphTargets = false, bool useVertexAlpha = true);
+                                          bool useMorphTargets = false, bool useVertexAlpha = true,
+                                          bool useBakedVertexAnimation = true);
 
   /**
    * @brief Prepares the defines related to multiview.
@@ -269,6 +289,15 @@ struct BABYLON_SHARED_EXPORT MaterialHelper {
   static void PrepareAttributesForBones(std::vector<std::string>& attribs, AbstractMesh* mesh,
                                         MaterialDefines& defines, EffectFallbacks& fallbacks);
 
+  /**
+   * @brief Prepares the list of attributes required for baked vertex animation according to the
+   * effect defines: the per instance animation settings when the mesh has instances.
+   * @param attribs The current list of supported attribs
+   * @param defines The current Defines of the effect
+   */
+  static void PrepareAttributesForBakedVertexAnimation(std::vector<std::string>& attribs,
+                                                       MaterialDefines& defines);
+
   /**
    * @brief Check and prepare the list of attributes required for instances according to the effect
    * defines.
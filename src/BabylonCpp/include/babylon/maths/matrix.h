@@ -2,6 +2,7 @@
 #define BABYLON_MATHS_MATRIX_H
 
 #include <array>
+#include <atomic>
 #include <memory>
 #include <optional>
 
@@ -1029,6 +1030,9 @@ private:
   void _updateIdentityStatus(bool isIdentity, bool isIdentityDirty = false,
                              bool isIdentity3x2 = false, bool isIdentity3x2Dirty = true);
 
+  /** @hidden */
+  static int _NextUpdateFlag();
+
 public:
   /**
    * Gets the update flag of the matrix which is an unique number for the
@@ -1038,7 +1042,7 @@ public:
   int updateFlag;
 
 private:
-  static int _updateFlagSeed;
+  static std::atomic<int> _updateFlagSeed;
   static Matrix _identityReadOnly;
   bool _isIdentity;
   bool _isIdentityDirty;
@@ -17,21 +17,24 @@ class Vector4;
 
 /**
  * @brief Temporary pre-allocated objects for engine internal use.
+ * The arrays are per thread, so that world matrices and bounding infos can be
+ * computed from worker threads. Thread local data cannot be exported from a
+ * shared library, hence this struct is internal to BabylonCpp.
  * Hidden
  */
-struct BABYLON_SHARED_EXPORT TmpVectors {
-  static std::array<Color3, 3> Color3Array;
-  static std::array<Color4, 3> Color4Array;
+struct TmpVectors {
+  static thread_local std::array<Color3, 3> Color3Array;
+  static thread_local std::array<Color4, 3> Color4Array;
   // 3 temp Vector2 at once should be enough
-  static std::array<Vector2, 3> Vector2Array;
+  static thread_local std::array<Vector2, 3> Vector2Array;
   // 13 temp Vector3 at once should be enough
-  static std::array<Vector3, 13> Vector3Array;
+  static thread_local std::array<Vector3, 13> Vector3Array;
   // 3 temp Vector4 at once should be enough
-  static std::array<Vector4, 3> Vector4Array;
+  static thread_local std::array<Vector4, 3> Vector4Array;
   // 2 temp Quaternion at once should be enough
-  static std::array<Quaternion, 2> QuaternionArray;
+  static thread_local std::array<Quaternion, 2> QuaternionArray;
   // 8 temp Matrices at once should be enough
-  static std::array<Matrix, 8> MatrixArray;
+  static thread_local std::array<Matrix, 8> MatrixArray;
 }; // end of struct TmpVectors
 
 } // end of namespace BABYLON
@@ -8,8 +8,10 @@
 
 namespace BABYLON {
 
+class BakedVertexAnimationManager;
 class Skeleton;
-using SkeletonPtr = std::shared_ptr<Skeleton>;
+using BakedVertexAnimationManagerPtr = std::shared_ptr<BakedVertexAnimationManager>;
+using SkeletonPtr                    = std::shared_ptr<Skeleton>;
 
 /**
  * @brief Hidden
@@ -30,6 +32,7 @@ struct BABYLON_SHARED_EXPORT _InternalAbstractMeshDataInfo {
   bool _isActiveIntermediate         = false;
   bool _onlyForInstancesIntermediate = false;
   bool _actAsRegularMesh             = false;
+  BakedVertexAnimationManagerPtr _bakedVertexAnimationManager;
 }; // end of struct _InternalAbstractMeshDataInfo
 
 } // end of namespace BABYLON
@@ -0,0 +1,37 @@
+#ifndef BABYLON_MESHES_THIN_INSTANCE_DATA_STORAGE_H
+#define BABYLON_MESHES_THIN_INSTANCE_DATA_STORAGE_H
+
+#include <unordered_map>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/maths/vector3.h>
+
+namespace BABYLON {
+
+class Buffer;
+using BufferPtr = std::shared_ptr<Buffer>;
+
+/**
+ * @brief Hidden
+ */
+struct BABYLON_SHARED_EXPORT _ThinInstanceDataStorage {
+  size_t instancesCount  = 0;
+  BufferPtr matrixBuffer = nullptr;
+  // Local bounding box of the mesh without the thin instances, captured on the
+  // first refresh of the bounding info of the batch
+  bool hasBoundingVectors = false;
+  Vector3 boundingMinimum;
+  Vector3 boundingMaximum;
+  // Custom per instance attributes
+  std::unordered_map<std::string, BufferPtr> userBuffers;
+  std::unordered_map<std::string, size_t> userStrides;
+  // Size (in floats) of the gpu buffers, per attribute
+  std::unordered_map<std::string, size_t> bufferSizes;
+  // Range of instances [first, second[ modified without refreshing the gpu buffer, per attribute
+  std::unordered_map<std::string, std::pair<size_t, size_t>> dirtyRanges;
+}; // end of struct _ThinInstanceDataStorage
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESHES_THIN_INSTANCE_DATA_STORAGE_H
@@ -1,6 +1,7 @@
 #ifndef BABYLON_MESHES_ABSTRACT_MESH_H
 #define BABYLON_MESHES_ABSTRACT_MESH_H
 
+#include <atomic>
 #include <nlohmann/json_fwd.hpp>
 
 #include <babylon/babylon_api.h>
@@ -222,6 +223,9 @@ public:
 
   /**
    * @brief Hidden
+   * Recomputes the light sources of the mesh: the enabled lights whose lit
+   * volume reaches the world bounding sphere of the mesh, by priority (when the
+   * scene sorts its lights) and then nearest (relative to their range) first.
    */
   void _resyncLightSources();
 
@@ -562,6 +566,18 @@ public:
    */
   bool isInFrustum(const std::array<Plane, 6>& frustumPlanes, unsigned int strategy = 0) override;
 
+  /**
+   * @brief Hidden
+   * Completes a frustum test whose bounding info part was already done (see
+   * FrustumCullingBatch) and returns the same result as isInFrustum().
+   */
+  virtual bool _isInFrustumFromCullingResult(bool boundingInfoInFrustum);
+
+  /**
+   * @brief Hidden
+   */
+  bool _canComputeWorldMatrixConcurrently() override;
+
   /**
    * @brief Returns `true` if the mesh is completely in the frustum defined be
    * the passed array of planes. A mesh is completely in the frustum if its
@@ -933,6 +949,11 @@ protected:
    */
   void _afterComputeWorldMatrix() override;
 
+  /**
+   * @brief Hidden
+   */
+  void _markAsTransformDirty() override;
+
 protected:
   /**
    * @brief Gets the number of facets in the mesh.
@@ -1297,6 +1318,18 @@ protected:
    */
   virtual SkeletonPtr& get_skeleton();
 
+  /**
+   * @brief Sets the baked vertex animation manager playing the animations of
+   * the skeleton from a texture.
+   */
+  void set_bakedVertexAnimationManager(const BakedVertexAnimationManagerPtr& value);
+
+  /**
+   * @brief Gets the baked vertex animation manager playing the animations of
+   * the skeleton from a texture.
+   */
+  virtual BakedVertexAnimationManagerPtr& get_bakedVertexAnimationManager();
+
   /**
    * @brief Hidden
    */
@@ -1823,6 +1856,27 @@ public:
   /** Hidden */
   BoundingInfoPtr _boundingInfo;
 
+  /** Hidden (proxy of the mesh in the scene meshes tree, -1 if none) */
+  int _meshesTreeProxyId;
+
+  /** Hidden (order of addition to the scene, 0 when not in a scene) */
+  size_t _meshesTreeOrder;
+
+  /** Hidden (whether the mesh is queued for a scene meshes tree update) */
+  std::atomic<bool> _meshesTreeDirty;
+
+  /** Hidden (slot of the mesh in the scene meshes tree updates, when queued) */
+  size_t _meshesTreeUpdateSlot;
+
+  /** Hidden (position of the mesh in the scene meshes array, -1 if none) */
+  int _indexInSceneMeshesArray;
+
+  /** Hidden (whether the mesh is queued for a scene light sources update) */
+  bool _lightSourcesDirty;
+
+  /** Hidden (slot of the mesh in the scene light sources updates, when queued) */
+  size_t _lightSourcesUpdateSlot;
+
   /** Hidden */
   int _renderId;
 
@@ -1876,6 +1930,13 @@ public:
    */
   Property<AbstractMesh, SkeletonPtr> skeleton;
 
+  /**
+   * The baked vertex animation manager of the mesh. When enabled, the bone
+   * matrices are read from its texture and the skeleton is no longer prepared
+   * on the CPU
+   */
+  Property<AbstractMesh, BakedVertexAnimationManagerPtr> bakedVertexAnimationManager;
+
   /**
    * An event triggered when the mesh is rebuilt.
    */
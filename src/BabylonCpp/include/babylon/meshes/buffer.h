@@ -32,7 +32,7 @@ public:
    * @param useBytes set to true if the stride in in bytes (optional)
    * @param divisor sets an optional divisor for instances (1 by default)
    */
-  Buffer(Engine* engine, const Float32Array& data, bool updatable,
+  Buffer(Engine* engine, Float32Array data, bool updatable,
          std::optional<size_t> stride = std::nullopt, bool postponeInternalCreation = false,
          bool instanced = false, bool useBytes = false,
          const std::optional<unsigned int>& divisor = std::nullopt);
@@ -49,7 +49,7 @@ public:
    * @param useBytes set to true if the stride in in bytes (optional)
    * @param divisor sets an optional divisor for instances (1 by default)
    */
-  Buffer(Mesh* mesh, const Float32Array& data, bool updatable,
+  Buffer(Mesh* mesh, Float32Array data, bool updatable,
          std::optional<size_t> stride = std::nullopt, bool postponeInternalCreation = false,
          bool instanced = false, bool useBytes = false,
          const std::optional<unsigned int>& divisor = std::nullopt);
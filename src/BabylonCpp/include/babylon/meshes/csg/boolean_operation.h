@@ -0,0 +1,59 @@
+#ifndef BABYLON_MESHES_CSG_BOOLEAN_OPERATION_H
+#define BABYLON_MESHES_CSG_BOOLEAN_OPERATION_H
+
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/meshes/csg/polygon.h>
+
+namespace BABYLON {
+namespace CSG {
+
+/**
+ * @brief Boolean operations between two solids, without BSP trees.
+ *
+ * Each polygon of a solid is only split by the planes of the polygons of the
+ * other solid overlapping its bounding box, which are found with a bounding
+ * volume hierarchy. The resulting fragments are then classified (inside,
+ * outside or coplanar) against the other solid by ray casting, and the
+ * operation keeps or drops them. Polygons are processed in parallel on the
+ * default thread pool, with per chunk vertex arenas; the output order is the
+ * same for any number of threads.
+ */
+class BABYLON_SHARED_EXPORT BooleanOperation {
+
+public:
+  enum class Type {
+    Union,
+    Subtract,
+    Intersect,
+  }; // end of enum class Type
+
+public:
+  /**
+   * @brief Applies a boolean operation between two closed solids.
+   * @param type The operation to apply
+   * @param a The polygons of the first solid (world space)
+   * @param b The polygons of the second solid (world space)
+   * @returns The polygons of the resulting solid
+   */
+  static std::vector<Polygon> Apply(Type type, const std::vector<Polygon>& a,
+                                    const std::vector<Polygon>& b);
+
+  /**
+   * @brief Applies a boolean operation between two closed solids using BSP
+   * trees (reference implementation).
+   * @param type The operation to apply
+   * @param a The polygons of the first solid (world space)
+   * @param b The polygons of the second solid (world space)
+   * @returns The polygons of the resulting solid
+   */
+  static std::vector<Polygon> ApplyWithBSPTree(Type type, const std::vector<Polygon>& a,
+                                               const std::vector<Polygon>& b);
+
+}; // end of class BooleanOperation
+
+} // end of namespace CSG
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESHES_CSG_BOOLEAN_OPERATION_H
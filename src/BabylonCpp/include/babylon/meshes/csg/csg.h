@@ -5,6 +5,7 @@
 #include <babylon/maths/matrix.h>
 #include <babylon/maths/quaternion.h>
 #include <babylon/maths/vector3.h>
+#include <babylon/meshes/csg/boolean_operation.h>
 #include <babylon/meshes/csg/polygon.h>
 
 namespace BABYLON {
@@ -158,6 +159,21 @@ public:
    */
   Vector3 scaling;
 
+  /**
+   * Use the BSP tree based implementation of the boolean operations instead of
+   * the default one (spatial pruning and parallel classification)
+   */
+  static bool UseBSPTree;
+
+private:
+  /**
+   * @brief Applies a boolean operation between this CSG and another CSG.
+   * @param type The operation to apply
+   * @param csg The other CSG
+   * @returns The polygons of the resulting solid
+   */
+  std::vector<Polygon> _applyBooleanOperation(BooleanOperation::Type type, const CSG& csg) const;
+
 private:
   static unsigned int currentCSGMeshId;
   std::vector<Polygon> _polygons;
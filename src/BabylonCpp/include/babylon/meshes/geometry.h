@@ -23,6 +23,7 @@ class Engine;
 class Geometry;
 class Mesh;
 class Scene;
+class TriangleBVH;
 class VertexBuffer;
 class VertexData;
 class WebGLDataBuffer;
@@ -285,6 +286,14 @@ public:
    */
   bool _generatePointsArray();
 
+  /**
+   * @brief Hidden
+   * Gets the triangle BVH of an index range, built from the points array and
+   * the indices on first use and cached until the positions or the indices
+   * are updated.
+   */
+  TriangleBVH* _getTriangleBVH(size_t indexStart, size_t indexCount);
+
   /**
    * @brief Gets a value indicating if the geometry is disposed.
    * @returns true if the geometry was disposed
@@ -448,6 +457,8 @@ public:
   // Cache
   /** Hidden */
   std::vector<Vector3> _positions;
+  /** Hidden */
+  std::map<std::pair<size_t, size_t>, std::unique_ptr<TriangleBVH>> _triangleBVHs;
 
   /**
    *  Gets or sets the Bias Vector to apply on the bounding elements
@@ -258,6 +258,11 @@ protected:
    */
   SkeletonPtr& get_skeleton() override;
 
+  /**
+   * @brief Gets the baked vertex animation manager of the source mesh.
+   */
+  BakedVertexAnimationManagerPtr& get_bakedVertexAnimationManager() override;
+
   /**
    * @brief Gets the rendering ground id of the source mesh.
    */
@@ -2,6 +2,7 @@
 #define BABYLON_MESHES_MESH_H
 
 #include <babylon/babylon_api.h>
+#include <babylon/babylon_enums.h>
 #include <babylon/maths/isize.h>
 #include <babylon/maths/path3d.h>
 #include <babylon/meshes/abstract_mesh.h>
@@ -14,7 +15,9 @@ struct _CreationDataStorage;
 struct _InstancesBatch;
 struct _InstanceDataStorage;
 struct _InternalMeshDataInfo;
+struct _ThinInstanceDataStorage;
 struct _VisibleInstances;
+struct ISimplificationSettings;
 class Buffer;
 class Effect;
 class Geometry;
@@ -701,6 +704,105 @@ public:
   void _processInstancedBuffers(const std::vector<InstancedMesh*>& visibleInstances,
                                 bool renderSelf);
 
+  /** Thin instances **/
+
+  /**
+   * @brief Creates a new thin instance. The matrix buffer grows by doubling its capacity, so
+   * adding instances one at a time is amortized O(1).
+   * @param matrix the matrix of the thin instance
+   * @param refresh true to refresh the underlying gpu buffer (default: true). If you do multiple
+   * calls to this method in a row, set refresh to true only for the last call to save performance
+   * @returns the thin instance index number
+   */
+  size_t thinInstanceAdd(const Matrix& matrix, bool refresh = true);
+
+  /**
+   * @brief Specifies that a custom attribute is to be used per thin instance. The buffer of the
+   * attribute is allocated with the capacity of the matrix buffer and filled with zeros.
+   * @param kind name of the attribute
+   * @param stride size in floats of the attribute
+   */
+  void thinInstanceRegisterAttribute(const std::string& kind, size_t stride);
+
+  /**
+   * @brief Sets the matrix of a thin instance.
+   * @param index index of the thin instance
+   * @param matrix matrix to set
+   * @param refresh true to upload the matrix to the gpu buffer (default: true)
+   * @returns true if the thin instance exists
+   */
+  bool thinInstanceSetMatrixAt(size_t index, const Matrix& matrix, bool refresh = true);
+
+  /**
+   * @brief Sets the value of a custom attribute for a thin instance.
+   * @param kind name of the attribute
+   * @param index index of the thin instance
+   * @param value value to set (stride floats)
+   * @param refresh true to upload the value to the gpu buffer (default: true)
+   * @returns true if the attribute is registered and the thin instance exists
+   */
+  bool thinInstanceSetAttributeAt(const std::string& kind, size_t index,
+                                  const Float32Array& value, bool refresh = true);
+
+  /**
+   * @brief Sets a buffer to be used with thin instances. The buffer is used as is, without any
+   * copy of the instance data: the number of thin instances is the buffer size divided by the
+   * stride, and no scene node is created per instance.
+   * @param kind name of the attribute. Use "matrix" to setup the buffer of matrices
+   * @param buffer buffer to set, an empty buffer removes the attribute
+   * @param stride size in floats of each value of the buffer (ignored for "matrix", which is
+   * always 16)
+   * @param staticBuffer indicates that the buffer is static, so that you won't change it after it
+   * is set (better performances - false by default)
+   */
+  void thinInstanceSetBuffer(const std::string& kind, Float32Array buffer, size_t stride = 0,
+                             bool staticBuffer = false);
+
+  /**
+   * @brief Gets the buffer of a thin instance attribute. Call thinInstanceBufferUpdated or
+   * thinInstancePartialBufferUpdate after modifying it.
+   * @param kind name of the attribute. Use "matrix" to get the buffer of matrices
+   * @returns the buffer, or nullptr if the attribute is not set
+   */
+  Float32Array* thinInstanceGetBuffer(const std::string& kind);
+
+  /**
+   * @brief Synchronizes the gpu buffer of a thin instance attribute with its data. Call this
+   * method if you update the buffer returned by thinInstanceGetBuffer. For the "matrix" buffer,
+   * the bounding info is also recomputed unless doNotSyncBoundingInfo is set.
+   * @param kind name of the attribute to update. Use "matrix" to update the buffer of matrices
+   */
+  void thinInstanceBufferUpdated(const std::string& kind);
+
+  /**
+   * @brief Applies a partial update to a thin instance buffer. Only the updated range is uploaded
+   * to the gpu. For the "matrix" buffer, the bounding info is extended with the updated
+   * instances, call thinInstanceRefreshBoundingInfo to shrink it.
+   * @param kind name of the attribute. Use "matrix" to update the buffer of matrices
+   * @param data the data to set in the buffer
+   * @param offset the offset (in floats) in the buffer where to start the update
+   */
+  void thinInstancePartialBufferUpdate(const std::string& kind, const Float32Array& data,
+                                       size_t offset);
+
+  /**
+   * @brief Refreshes the bounding info, taking into account all the thin instances defined.
+   * @param forceRefreshParentInfo true to force recomputing the mesh bounding info from the
+   * geometry and use it to compute the aggregated bounding info
+   */
+  void thinInstanceRefreshBoundingInfo(bool forceRefreshParentInfo = false);
+
+  /**
+   * @brief Hidden
+   */
+  void _renderWithThinInstances(SubMesh* subMesh, unsigned int fillMode, const EffectPtr& effect,
+                                Engine* engine);
+
+  /**
+   * @brief Hidden
+   */
+  void _disposeThinInstanceSpecificData();
+
   /**
    * @brief Hidden
    */
@@ -790,6 +892,11 @@ public:
    */
   bool isInFrustum(const std::array<Plane, 6>& frustumPlanes, unsigned int strategy = 0) override;
 
+  /**
+   * @brief Hidden
+   */
+  bool _isInFrustumFromCullingResult(bool boundingInfoInFrustum) override;
+
   /**
    * @brief Sets the mesh material by the material or multiMaterial `id`
    * property.
@@ -1008,6 +1115,24 @@ public:
    */
   void optimizeIndices(const std::function<void(Mesh* mesh)>& successCallback);
 
+  /**
+   * @brief Simplify the mesh according to the given array of settings. The
+   * levels are decimated on the thread pool and added as LOD levels of the
+   * mesh, from the main thread, as soon as they are ready.
+   * @see http://doc.babylonjs.com/how_to/in-browser_mesh_simplification
+   * @param settings a collection of simplification settings
+   * @param parallelProcessing should all levels calculate parallel or one
+   * after the other
+   * @param simplificationType the type of simplification to run
+   * @param successCallback optional success callback to be called after the
+   * simplification finished processing all settings
+   * @returns the current mesh
+   */
+  Mesh& simplify(const std::vector<ISimplificationSettings>& settings,
+                 bool parallelProcessing                    = true,
+                 SimplificationType simplificationType      = SimplificationType::QUADRATIC,
+                 const std::function<void()>& successCallback = nullptr);
+
   /**
    * @brief This function will remove some indices and vertices from a mesh. It
    * removes facets where two of its vertices share the same position and forces
@@ -1753,6 +1878,22 @@ protected:
    */
   bool get_hasInstances() const override;
 
+  /**
+   * @brief Gets a boolean indicating if this mesh has thin instances.
+   */
+  bool get_hasThinInstances() const override;
+
+  /**
+   * @brief Gets the number of thin instances to display.
+   */
+  size_t get_thinInstanceCount() const;
+
+  /**
+   * @brief Sets the number of thin instances to display. Note that you can't set a number higher
+   * than what the underlying buffer can handle.
+   */
+  void set_thinInstanceCount(size_t value);
+
   /**
    * @brief Gets the morph target manager.
    * @see http://doc.babylonjs.com/how_to/how_to_use_morphtargets
@@ -1843,6 +1984,14 @@ private:
   // influences)
   void normalizeSkinWeightsAndExtra();
   Mesh& _queueLoad(Scene* scene);
+  BufferPtr _thinInstanceGetBufferForKind(const std::string& kind) const;
+  size_t _thinInstanceGetStride(const std::string& kind) const;
+  void _thinInstanceCreateBuffer(const std::string& kind, Float32Array data, size_t stride,
+                                 bool staticBuffer);
+  void _thinInstanceUpdateBufferSize(const std::string& kind, size_t numInstances);
+  void _thinInstanceUpdateRange(const std::string& kind, size_t start, size_t end, bool refresh);
+  void _thinInstanceUploadRange(const std::string& kind, size_t start, size_t end);
+  void _thinInstanceExtendBoundingInfo(size_t start, size_t end);
 
 public:
   /** Events **/
@@ -1995,6 +2144,11 @@ public:
    */
   WriteOnlyProperty<Mesh, size_t> overridenInstanceCount;
 
+  /**
+   * Number of thin instances to display, at most the capacity of the matrix buffer
+   */
+  Property<Mesh, size_t> thinInstanceCount;
+
 private:
   // Internal data
   std::unique_ptr<_InternalMeshDataInfo> _internalMeshDataInfo;
@@ -2003,6 +2157,7 @@ private:
   // Morph
   std::vector<VertexBuffer*> _delayInfo;
   std::unique_ptr<_InstanceDataStorage> _instanceDataStorage;
+  std::unique_ptr<_ThinInstanceDataStorage> _thinInstanceDataStorage;
   MaterialPtr _effectiveMaterial;
   // Instances
   /** @hidden */
@@ -1,30 +1,35 @@
 #ifndef BABYLON_MESHES_SIMPLIFICATION_DECIMATION_TRIANGLE_H
 #define BABYLON_MESHES_SIMPLIFICATION_DECIMATION_TRIANGLE_H
 
+#include <array>
+
 #include <babylon/babylon_api.h>
 #include <babylon/maths/vector3.h>
-#include <babylon/meshes/simplification/decimation_vertex.h>
 
 namespace BABYLON {
 
 /**
- * @brief
+ * @brief Triangle of the decimated mesh.
  */
 class BABYLON_SHARED_EXPORT DecimationTriangle {
 
 public:
-  DecimationTriangle(const std::vector<DecimationVertex>& vertices);
+  DecimationTriangle(const std::array<int, 3>& vertices,
+                     const std::array<uint32_t, 3>& originalOffsets, size_t subMeshIndex);
   ~DecimationTriangle(); // = default
 
 public:
   Vector3 normal;
-  std::array<int, 4> error;
+  // Errors of the collapses of the 3 edges, and their minimum
+  std::array<double, 4> error;
   bool deleted;
   bool isDirty;
-  float borderFactor;
-  bool deletePending;
-  float originalOffset;
-  std::vector<DecimationVertex> vertices;
+  // Ids of the decimation vertices
+  std::array<int, 3> vertices;
+  // Source mesh vertices providing the attributes (uvs, normals, weights...) of
+  // the corners
+  std::array<uint32_t, 3> originalOffsets;
+  size_t subMeshIndex;
 
 }; // end of class DecimationTriangle
 
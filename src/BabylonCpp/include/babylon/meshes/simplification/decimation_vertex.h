@@ -8,7 +8,8 @@
 namespace BABYLON {
 
 /**
- * @brief
+ * @brief Vertex of the decimated mesh, shared by all the mesh vertices with
+ * the same position.
  */
 class BABYLON_SHARED_EXPORT DecimationVertex {
 
@@ -22,10 +23,11 @@ public:
   QuadraticMatrix q;
   Vector3 position;
   int id;
+  // Vertex on a border of the mesh or on an attribute seam, kept in place
   bool isBorder;
+  // Range of the references to the triangles using the vertex
   int triangleStart;
   int triangleCount;
-  Float32Array originalOffsets;
 
 }; // end of class DecimationVertex
 
@@ -2,6 +2,7 @@
 #define BABYLON_MESHES_SIMPLIFICATION_ISIMPLIFICATION_TASK_H
 
 #include <functional>
+#include <memory>
 #include <vector>
 
 #include <babylon/babylon_api.h>
@@ -11,6 +12,7 @@
 namespace BABYLON {
 
 class Mesh;
+using MeshPtr = std::shared_ptr<Mesh>;
 
 /**
  * @brief Interface used to define a simplification task.
@@ -27,7 +29,7 @@ struct BABYLON_SHARED_EXPORT ISimplificationTask {
   /**
    * Mesh to simplify
    */
-  Mesh* mesh;
+  MeshPtr mesh;
   /**
    * Callback called on success
    */
@@ -1,10 +1,17 @@
 #ifndef BABYLON_MESHES_SIMPLIFICATION_ISIMPLIFIER_H
 #define BABYLON_MESHES_SIMPLIFICATION_ISIMPLIFIER_H
 
+#include <functional>
+#include <memory>
+
 #include <babylon/babylon_api.h>
 
 namespace BABYLON {
 
+class Mesh;
+struct ISimplificationSettings;
+using MeshPtr = std::shared_ptr<Mesh>;
+
 /**
  * @brief A simplifier interface for future simplification implementations.
  * @see http://doc.babylonjs.com/how_to/in-browser_mesh_simplification
@@ -12,18 +19,18 @@ namespace BABYLON {
 class BABYLON_SHARED_EXPORT ISimplifier {
 
 public:
+  virtual ~ISimplifier() = default;
+
   /**
    * @brief Simplification of a given mesh according to the given settings.
-   * Since this requires computation, it is assumed that the function runs
-   * async.
    * @param settings The settings of the simplification, including quality and
    * distance
    * @param successCallback A callback that will be called after the mesh was
    * simplified.
-   * @param errorCallback in case of an error, this callback will be called.
-   * optional.
    */
-  virtual void simplify() = 0;
+  virtual void simplify(const ISimplificationSettings& settings,
+                        const std::function<void(const MeshPtr& simplifiedMesh)>& successCallback)
+    = 0;
 
 }; // end of class ISimplifier
 
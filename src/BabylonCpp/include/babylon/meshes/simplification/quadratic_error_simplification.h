@@ -1,11 +1,24 @@
 #ifndef BABYLON_MESHES_SIMPLIFICATION_QUADRATIC_ERROR_SIMPLIFICATION_H
 #define BABYLON_MESHES_SIMPLIFICATION_QUADRATIC_ERROR_SIMPLIFICATION_H
 
+#include <array>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/maths/vector3.h>
 #include <babylon/meshes/simplification/isimplifier.h>
 
 namespace BABYLON {
 
+class DecimationTriangle;
+class DecimationVertex;
+class QuadraticMatrix;
+class Reference;
+
 /**
  * @brief An implementation of the Quadratic Error simplification algorithm.
  * Original paper : http://www1.cs.columbia.edu/~cs4162/html05s/garland97.pdf
@@ -13,12 +26,96 @@ namespace BABYLON {
  * http://voxels.blogspot.de/2014/05/quadric-mesh-simplification-with-source.html to babylon JS
  * @author RaananW
  * @see http://doc.babylonjs.com/how_to/in-browser_mesh_simplification
+ *
+ * The geometry of the mesh is copied when the simplifier is created, so that
+ * decimate() only works on this copy and can run on a worker thread. The mesh
+ * itself is only accessed by the constructor and by createMesh(), which must
+ * be called from the main thread.
  */
 class BABYLON_SHARED_EXPORT QuadraticErrorSimplification : public ISimplifier {
 
 public:
-  QuadraticErrorSimplification();
-  virtual ~QuadraticErrorSimplification();
+  /**
+   * @brief Geometry of a decimated mesh.
+   */
+  struct SimplifiedGeometry {
+    /** Vertex data, per kind */
+    std::unordered_map<std::string, Float32Array> vertexData;
+    IndicesArray indices;
+    /** Material index, index start and index count of the submeshes */
+    std::vector<std::array<uint32_t, 3>> subMeshes;
+    /** Number of triangles of the source mesh and of the decimated one */
+    size_t originalTrianglesCount = 0;
+    size_t trianglesCount         = 0;
+  }; // end of struct SimplifiedGeometry
+
+public:
+  /**
+   * @brief Copies the geometry of the mesh to simplify.
+   * @param mesh defines the mesh to simplify
+   */
+  QuadraticErrorSimplification(const MeshPtr& mesh);
+  ~QuadraticErrorSimplification() override; // = default
+
+  /**
+   * @brief Simplifies the mesh synchronously and creates the simplified mesh.
+   * @param settings The settings of the simplification, including quality and
+   * distance
+   * @param successCallback A callback that will be called after the mesh was
+   * simplified.
+   */
+  void simplify(const ISimplificationSettings& settings,
+                const std::function<void(const MeshPtr& simplifiedMesh)>& successCallback) override;
+
+  /**
+   * @brief Decimates the copied geometry. This function does not access the
+   * mesh and can be called from any thread, also concurrently.
+   * @param quality defines the ratio of the triangles to keep (between 0 and 1)
+   * @returns the decimated geometry
+   */
+  [[nodiscard]] SimplifiedGeometry decimate(float quality) const;
+
+  /**
+   * @brief Creates the simplified mesh from a decimated geometry. Must be
+   * called from the main thread.
+   * @param geometry defines the decimated geometry
+   * @returns the simplified mesh, hidden until it is used as a LOD level
+   */
+  MeshPtr createMesh(const SimplifiedGeometry& geometry) const;
+
+private:
+  struct DecimationState;
+
+  void _initDecimatedMesh(DecimationState& state) const;
+  void _updateMesh(DecimationState& state, size_t iteration) const;
+  void _updateTriangles(DecimationState& state, int origVertex, const DecimationVertex& vertex,
+                        const std::vector<bool>& deletedArray, size_t& deletedTriangles) const;
+  bool _isFlipped(const DecimationState& state, const DecimationVertex& vertex1, int index2,
+                  const Vector3& point, std::vector<bool>& deletedArray) const;
+  double _calculateError(const DecimationVertex& vertex1, const DecimationVertex& vertex2,
+                         Vector3& pointResult) const;
+  double _vertexError(const QuadraticMatrix& q, const Vector3& point) const;
+  SimplifiedGeometry _reconstructGeometry(const DecimationState& state) const;
+
+public:
+  /**
+   * Number of decimation passes
+   */
+  size_t decimationIterations;
+
+  /**
+   * Aggressiveness of the decimation, higher values remove the triangles
+   * faster at the cost of the quality
+   */
+  float aggressiveness;
+
+private:
+  MeshPtr _mesh;
+  Float32Array _positions;
+  IndicesArray _indices;
+  std::unordered_map<std::string, Float32Array> _vertexData;
+  std::unordered_map<std::string, size_t> _strides;
+  std::vector<std::array<uint32_t, 3>> _subMeshes;
 
 }; // end of class QuadraticErrorSimplification
 
@@ -8,33 +8,36 @@
 namespace BABYLON {
 
 /**
- * @brief
+ * @brief Symmetric 4x4 matrix of a quadric error, stored as its 10 upper
+ * coefficients. Computed in double precision as the errors of the collapses
+ * are compared with very small thresholds.
  */
 class BABYLON_SHARED_EXPORT QuadraticMatrix {
 
 public:
   QuadraticMatrix();
-  QuadraticMatrix(const std::array<float, 10>& data);
+  QuadraticMatrix(const std::array<double, 10>& data);
   QuadraticMatrix(const QuadraticMatrix& other);
   QuadraticMatrix(QuadraticMatrix&& other);
   QuadraticMatrix& operator=(const QuadraticMatrix& other);
   QuadraticMatrix& operator=(QuadraticMatrix&& other);
   ~QuadraticMatrix(); // = default
 
-  float det(unsigned int a11, unsigned int a12, unsigned int a13, //
-            unsigned int a21, unsigned int a22, int unsigned a23, //
-            int unsigned a31, int unsigned a32, int unsigned a33  //
-  );
+  double operator[](unsigned int index) const;
+
+  [[nodiscard]] double det(unsigned int a11, unsigned int a12, unsigned int a13, //
+                           unsigned int a21, unsigned int a22, unsigned int a23, //
+                           unsigned int a31, unsigned int a32, unsigned int a33  //
+  ) const;
   void addInPlace(const QuadraticMatrix& matrix);
-  void addArrayInPlace(const std::array<float, 10>& data);
-  QuadraticMatrix add(const QuadraticMatrix& matrix);
+  void addArrayInPlace(const std::array<double, 10>& data);
+  [[nodiscard]] QuadraticMatrix add(const QuadraticMatrix& matrix) const;
 
-  static QuadraticMatrix FromData(float a, float b, float c, float d);
-  static std::array<float, 10> DataFromNumbers(float a, float b, float c,
-                                               float d);
+  static QuadraticMatrix FromData(double a, double b, double c, double d);
+  static std::array<double, 10> DataFromNumbers(double a, double b, double c, double d);
 
 private:
-  std::array<float, 10> data;
+  std::array<double, 10> data;
 
 }; // end of class QuadraticMatrix
 
@@ -1,18 +1,25 @@
 #ifndef BABYLON_MESHES_SIMPLIFICATION_SIMPLIFICATION_QUEUE_H
 #define BABYLON_MESHES_SIMPLIFICATION_SIMPLIFICATION_QUEUE_H
 
+#include <future>
+#include <memory>
 #include <queue>
+#include <vector>
 
 #include <babylon/babylon_api.h>
 #include <babylon/meshes/simplification/isimplification_task.h>
+#include <babylon/meshes/simplification/quadratic_error_simplification.h>
 
 namespace BABYLON {
 
-class ISimplifier;
-
 /**
  * @brief Queue used to order the simplification tasks.
  * @see http://doc.babylonjs.com/how_to/in-browser_mesh_simplification
+ *
+ * The levels of a task are decimated on the thread pool (all at once when the
+ * task allows parallel processing, one after the other otherwise). The queue
+ * is polled by the scene before each frame: the finished levels are turned
+ * into meshes and added as LOD levels on the main thread.
  */
 class BABYLON_SHARED_EXPORT SimplificationQueue {
 
@@ -40,8 +47,25 @@ public:
    */
   void runSimplification(const ISimplificationTask& task);
 
+  /**
+   * @brief Adds the levels decimated since the last call to the mesh of the
+   * running task, and completes the task once all its levels are added. Must
+   * be called from the main thread.
+   */
+  void update();
+
 private:
-  ISimplifier* getSimplifier(const ISimplificationTask& task);
+  struct SimplificationLevel {
+    ISimplificationSettings settings;
+    QuadraticErrorSimplification::SimplifiedGeometry geometry;
+    std::future<void> job;
+    bool started = false;
+  }; // end of struct SimplificationLevel
+
+  std::shared_ptr<QuadraticErrorSimplification>
+  getSimplifier(const ISimplificationTask& task) const;
+  void _startLevel(const std::shared_ptr<SimplificationLevel>& level);
+  void _completeTask();
 
 public:
   /**
@@ -51,6 +75,9 @@ public:
 
 private:
   std::queue<ISimplificationTask> _simplificationQueue;
+  ISimplificationTask _runningTask;
+  std::shared_ptr<QuadraticErrorSimplification> _simplifier;
+  std::vector<std::shared_ptr<SimplificationLevel>> _levels;
 
 }; // end of class SimplificationQueue
 
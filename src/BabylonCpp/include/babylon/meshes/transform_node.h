@@ -1,6 +1,7 @@
 #ifndef BABYLON_MESHES_TRANSFORM_NODE_H
 #define BABYLON_MESHES_TRANSFORM_NODE_H
 
+#include <atomic>
 #include <optional>
 
 #include <babylon/babylon_api.h>
@@ -416,6 +417,14 @@ public:
    */
   Matrix& computeWorldMatrix(bool force = false, bool useWasUpdatedFlag = false) override;
 
+  /**
+   * @brief Hidden
+   * Returns true if computeWorldMatrix() only writes the state of this node and
+   * only reads the (already computed) world matrix of its parent, so that the
+   * nodes of a same hierarchy level can be computed concurrently.
+   */
+  virtual bool _canComputeWorldMatrixConcurrently();
+
   /**
    * @brief Resets this nodeTransform's local matrix to Matrix.Identity().
    * @param independentOfChildren indicates if all child nodeTransform's world-space transform
@@ -526,6 +535,18 @@ protected:
 
   virtual void _afterComputeWorldMatrix();
 
+  /**
+   * @brief Hidden (called when the local transform may have been changed, the
+   * meshes below this node are queued for a scene meshes tree update. The
+   * descendants are visited once until the queued updates are applied)
+   */
+  virtual void _markAsTransformDirty();
+
+  /**
+   * @brief Sets the parent of the node.
+   */
+  void set_parent(Node* const& parent) override;
+
   /**
    * @brief Gets the billboard mode. Default is 0.
    *
@@ -845,6 +866,8 @@ private:
   Matrix _pivotMatrix;
   std::unique_ptr<Matrix> _pivotMatrixInverse;
   bool _nonUniformScaling;
+  // Scene meshes tree generation in which the descendants were last queued
+  std::atomic<size_t> _transformDirtyGeneration;
 
 }; // end of class TransformNode
 
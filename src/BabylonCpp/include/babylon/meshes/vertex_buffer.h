@@ -10,6 +10,7 @@
 
 namespace BABYLON {
 
+class ArrayBufferView;
 class Buffer;
 class DataView;
 class Engine;
@@ -158,7 +159,7 @@ public:
    * @param useBytes set to true if stride and offset are in bytes (optional)
    * @param divisor defines the instance divisor to use (1 by default)
    */
-  VertexBuffer(Engine* engine, const std::variant<Float32Array, Buffer*>& data,
+  VertexBuffer(Engine* engine, std::variant<Float32Array, Buffer*> data,
                const std::string& kind, bool updatable,
                const std::optional<bool>& postponeInternalCreation = std::nullopt,
                std::optional<size_t> stride                        = std::nullopt,
@@ -322,6 +323,24 @@ public:
                       size_t count, bool normalized,
                       const std::function<void(float value, size_t index)>& callback);
 
+  /**
+   * @brief Enumerates each value of the given parameters as numbers, reading
+   * the values in place from the view.
+   * @param data the data to enumerate
+   * @param byteOffset the byte offset of the data, relative to the view
+   * @param byteStride the byte stride of the data
+   * @param componentCount the number of components per element
+   * @param componentType the type of the component
+   * @param count the total number of components
+   * @param normalized whether the data is normalized
+   * @param callback the callback function called for each value
+   * @throws std::out_of_range if the data is not contained in the view
+   */
+  static void ForEach(const ArrayBufferView& data, size_t byteOffset, size_t byteStride,
+                      size_t componentCount, unsigned int componentType, size_t count,
+                      bool normalized,
+                      const std::function<void(float value, size_t index)>& callback);
+
 private:
   /**
    * @brief Gets the instance divisor when in instanced mode
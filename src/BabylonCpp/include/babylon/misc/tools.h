@@ -157,18 +157,29 @@ struct BABYLON_SHARED_EXPORT Tools {
    */
   static void DumpFramebuffer(int width, int height, Engine* engine);
 
-  static void StartPerformanceCounter(const std::string&)
-  {
-  }
-  static void StartPerformanceCounter(const std::string&, bool)
-  {
-  }
-  static void EndPerformanceCounter(const std::string&)
+#ifdef BABYLON_ENABLE_PROFILER
+  /**
+   * @brief Starts a performance counter: opens a zone of the profiler on the calling thread.
+   * @param counterName defines the name of the counter
+   * @param condition defines if the counter should be started
+   */
+  static void StartPerformanceCounter(const std::string& counterName, bool condition = true);
+
+  /**
+   * @brief Ends a performance counter: closes the last zone of the profiler with the same name
+   * opened on the calling thread.
+   * @param counterName defines the name of the counter
+   * @param condition defines if the counter should be ended
+   */
+  static void EndPerformanceCounter(const std::string& counterName, bool condition = true);
+#else
+  static void StartPerformanceCounter(const std::string&, bool = true)
   {
   }
-  static void EndPerformanceCounter(const std::string&, bool)
+  static void EndPerformanceCounter(const std::string&, bool = true)
   {
   }
+#endif
   static void ExitFullscreen()
   {
   }
@@ -6,8 +6,7 @@
 #include <babylon/maths/vector2.h>
 #include <babylon/maths/vector3.h>
 #include <babylon/maths/vector4.h>
-#include <babylon/misc/color_gradient.h>
-#include <babylon/misc/factor_gradient.h>
+#include <babylon/particles/particle_store.h>
 
 namespace BABYLON {
 
@@ -18,191 +17,177 @@ using SubEmitterPtr = std::shared_ptr<SubEmitter>;
 /**
  * @brief A particle represents one of the element emitted by a particle system.
  * This is mainly define by its coordinates, direction, velocity and age.
+ *
+ * The particle data lives in the ParticleStore of the particle system: a
+ * particle is a handle to a slot of the store. As particles are removed by
+ * moving the last particle in the slot of the removed one, a handle refers to
+ * another particle after the particle of its slot has been recycled.
  */
 class BABYLON_SHARED_EXPORT Particle {
 
-private:
-  static size_t _Count;
-
 public:
   /**
-   * @brief Creates a new instance Particle.
+   * @brief Creates a new handle to a particle.
    * @param particleSystem the particle system the particle belongs to
+   * @param index the index of the particle in the store of the particle system
    */
-  Particle(ParticleSystem* particleSystem);
+  Particle(ParticleSystem* particleSystem, size_t index);
   Particle(const Particle& other);            // Copy constructor
   Particle(Particle&& other);                 // Move constructor
   Particle& operator=(const Particle& other); // Copy assignment operator
   Particle& operator=(Particle&& other);      // Move assignment operator
   ~Particle();                                // = default
-  [[nodiscard]] Particle* clone() const;
 
   /**
-   * @brief Defines how the sprite cell index is updated for the particle.
+   * @brief Returns the index of the particle in the store of the particle
+   * system.
    */
-  void updateCellIndex();
+  [[nodiscard]] size_t index() const;
 
   /**
-   * @brief Hidden
+   * @brief Returns the unique ID of the particle.
    */
-  void _inheritParticleInfoToSubEmitter(const SubEmitterPtr& subEmitter);
+  [[nodiscard]] size_t id() const;
 
   /**
-   * @brief Hidden
+   * @brief Returns the world position of the particle in the scene.
    */
-  void _inheritParticleInfoToSubEmitters();
+  [[nodiscard]] Vector3 position() const;
 
   /**
-   * @brief Hidden
+   * @brief Sets the world position of the particle in the scene.
    */
-  void _reset();
+  void setPosition(const Vector3& value);
 
   /**
-   * @brief Copy the properties of particle to another one.
-   * @param other the particle to copy the information to.
+   * @brief Returns the world direction of the particle in the scene.
    */
-  void copyTo(Particle& other);
+  [[nodiscard]] Vector3 direction() const;
 
-private:
-  void updateCellInfoFromSystem();
-
-public:
   /**
-   * Unique ID of the particle
+   * @brief Sets the world direction of the particle in the scene.
    */
-  size_t id;
+  void setDirection(const Vector3& value);
 
   /**
-   * The world position of the particle in the scene.
+   * @brief Returns the color of the particle.
    */
-  Vector3 position;
+  [[nodiscard]] Color4 color() const;
 
   /**
-   * The world direction of the particle in the scene.
+   * @brief Sets the color of the particle.
    */
-  Vector3 direction;
+  void setColor(const Color4& value);
 
   /**
-   * The color of the particle.
+   * @brief Returns the color change of the particle per step.
    */
-  Color4 color;
+  [[nodiscard]] Color4 colorStep() const;
 
   /**
-   * The color change of the particle per step.
+   * @brief Sets the color change of the particle per step.
    */
-  Color4 colorStep;
+  void setColorStep(const Color4& value);
 
   /**
-   * Defines how long will the life of the particle be.
+   * @brief Defines how long will the life of the particle be.
    */
-  float lifeTime;
+  float& lifeTime();
+  [[nodiscard]] float lifeTime() const;
 
   /**
-   * The current age of the particle.
+   * @brief The current age of the particle.
    */
-  float age;
+  float& age();
+  [[nodiscard]] float age() const;
 
   /**
-   * The current size of the particle.
+   * @brief The current size of the particle.
    */
-  float size;
+  float& size();
+  [[nodiscard]] float size() const;
 
   /**
-   * The current scale of the particle.
+   * @brief Returns the current scale of the particle.
    */
-  Vector2 scale;
+  [[nodiscard]] Vector2 scale() const;
 
   /**
-   * The current angle of the particle.
+   * @brief Sets the current scale of the particle.
    */
-  float angle;
+  void setScale(const Vector2& value);
 
   /**
-   * Defines how fast is the angle changing.
+   * @brief The current angle of the particle.
    */
-  float angularSpeed;
+  float& angle();
+  [[nodiscard]] float angle() const;
 
   /**
-   * Defines the cell index used by the particle to be rendered from a sprite.
+   * @brief Defines how fast is the angle changing.
    */
-  unsigned int cellIndex;
+  float& angularSpeed();
+  [[nodiscard]] float angularSpeed() const;
 
   /**
-   * The information required to support color remapping
+   * @brief Defines the cell index used by the particle to be rendered from a
+   * sprite.
    */
-  std::optional<Vector4> remapData;
-
-  /** @hidden */
-  std::optional<float> _randomCellOffset;
-
-  /** Hidden */
-  std::optional<Vector3> _initialDirection;
-
-  /** Hidden */
-  std::vector<SubEmitterPtr> _attachedSubEmitters;
+  unsigned int& cellIndex();
+  [[nodiscard]] unsigned int cellIndex() const;
 
-  /** Hidden */
-  unsigned int _initialStartSpriteCellID;
-  /** Hidden */
-  unsigned int _initialEndSpriteCellID;
-
-  /** Hidden */
-  std::optional<ColorGradient> _currentColorGradient;
-  /** Hidden */
-  Color4 _currentColor1;
-  /** Hidden */
-  Color4 _currentColor2;
+  /**
+   * @brief The information required to support color remapping.
+   */
+  std::optional<Vector4>& remapData();
 
-  /** Hidden */
-  std::optional<FactorGradient> _currentSizeGradient;
-  /** Hidden */
-  float _currentSize1;
-  /** Hidden */
-  float _currentSize2;
+  /**
+   * @brief Returns the values of the particle which are not updated every
+   * frame (gradients tracking, sub-emitters, ...).
+   */
+  ParticleState& state();
+  [[nodiscard]] const ParticleState& state() const;
 
-  /** Hidden */
-  std::optional<FactorGradient> _currentAngularSpeedGradient;
-  /** Hidden */
-  float _currentAngularSpeed1;
-  /** Hidden */
-  float _currentAngularSpeed2;
+  /**
+   * @brief Hidden
+   */
+  std::optional<Vector3>& _localPosition();
 
-  /** Hidden */
-  std::optional<FactorGradient> _currentVelocityGradient;
-  /** Hidden */
-  float _currentVelocity1;
-  /** Hidden */
-  float _currentVelocity2;
+  /**
+   * @brief Defines how the sprite cell index is updated for the particle.
+   */
+  void updateCellIndex();
 
-  /** Hidden */
-  std::optional<FactorGradient> _currentLimitVelocityGradient;
-  /** Hidden */
-  float _currentLimitVelocity1;
-  /** Hidden */
-  float _currentLimitVelocity2;
+  /**
+   * @brief Hidden
+   */
+  void _inheritParticleInfoToSubEmitter(const SubEmitterPtr& subEmitter);
 
-  /** Hidden */
-  std::optional<FactorGradient> _currentDragGradient;
-  /** Hidden */
-  float _currentDrag1;
-  /** Hidden */
-  float _currentDrag2;
+  /**
+   * @brief Hidden
+   */
+  void _inheritParticleInfoToSubEmitters();
 
-  /** Hidden */
-  std::optional<Vector3> _randomNoiseCoordinates1;
-  /** Hidden */
-  Vector3 _randomNoiseCoordinates2;
+  /**
+   * @brief Hidden
+   */
+  void _reset();
 
-  /** @hidden */
-  std::optional<Vector3> _localPosition;
+  /**
+   * @brief Copy the properties of particle to another one.
+   * @param other the particle to copy the information to.
+   */
+  void copyTo(Particle& other);
 
+public:
   /**
    * The particle system the particle belongs to.
    */
   ParticleSystem* particleSystem;
 
 private:
-  unsigned int _currentFrameCounter;
+  ParticleStore* _store;
+  size_t _index;
 
 }; // end of class Particle
 
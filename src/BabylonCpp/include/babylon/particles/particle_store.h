@@ -0,0 +1,199 @@
+#ifndef BABYLON_PARTICLES_PARTICLE_STORE_H
+#define BABYLON_PARTICLES_PARTICLE_STORE_H
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/maths/color4.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/maths/vector4.h>
+#include <babylon/misc/color_gradient.h>
+#include <babylon/misc/factor_gradient.h>
+
+namespace BABYLON {
+
+class SubEmitter;
+using SubEmitterPtr = std::shared_ptr<SubEmitter>;
+
+/**
+ * @brief Per particle state which is not read by the default update loop of
+ * the particle system (gradients tracking, sub-emitters, noise, ...).
+ */
+struct BABYLON_SHARED_EXPORT ParticleState {
+
+  /**
+   * Unique ID of the particle
+   */
+  size_t id = 0;
+
+  /**
+   * The information required to support color remapping
+   */
+  std::optional<Vector4> remapData = std::nullopt;
+
+  /** Hidden */
+  std::optional<float> _randomCellOffset = std::nullopt;
+  /** Hidden */
+  std::optional<Vector3> _initialDirection = std::nullopt;
+  /** Hidden */
+  std::vector<SubEmitterPtr> _attachedSubEmitters;
+  /** Hidden */
+  unsigned int _initialStartSpriteCellID = 0;
+  /** Hidden */
+  unsigned int _initialEndSpriteCellID = 0;
+
+  /** Hidden */
+  std::optional<ColorGradient> _currentColorGradient = std::nullopt;
+  /** Hidden */
+  Color4 _currentColor1 = Color4(0.f, 0.f, 0.f, 0.f);
+  /** Hidden */
+  Color4 _currentColor2 = Color4(0.f, 0.f, 0.f, 0.f);
+
+  /** Hidden */
+  std::optional<FactorGradient> _currentSizeGradient = std::nullopt;
+  /** Hidden */
+  float _currentSize1 = 0.f;
+  /** Hidden */
+  float _currentSize2 = 0.f;
+
+  /** Hidden */
+  std::optional<FactorGradient> _currentAngularSpeedGradient = std::nullopt;
+  /** Hidden */
+  float _currentAngularSpeed1 = 0.f;
+  /** Hidden */
+  float _currentAngularSpeed2 = 0.f;
+
+  /** Hidden */
+  std::optional<FactorGradient> _currentVelocityGradient = std::nullopt;
+  /** Hidden */
+  float _currentVelocity1 = 0.f;
+  /** Hidden */
+  float _currentVelocity2 = 0.f;
+
+  /** Hidden */
+  std::optional<FactorGradient> _currentLimitVelocityGradient = std::nullopt;
+  /** Hidden */
+  float _currentLimitVelocity1 = 0.f;
+  /** Hidden */
+  float _currentLimitVelocity2 = 0.f;
+
+  /** Hidden */
+  std::optional<FactorGradient> _currentDragGradient = std::nullopt;
+  /** Hidden */
+  float _currentDrag1 = 0.f;
+  /** Hidden */
+  float _currentDrag2 = 0.f;
+
+  /** Hidden */
+  std::optional<Vector3> _randomNoiseCoordinates1 = std::nullopt;
+  /** Hidden */
+  Vector3 _randomNoiseCoordinates2 = Vector3::Zero();
+
+  /** Hidden */
+  std::optional<Vector3> _localPosition = std::nullopt;
+
+}; // end of struct ParticleState
+
+/**
+ * @brief Structure-of-arrays storage of the active particles of a particle
+ * system.
+ *
+ * The values updated every frame are stored in contiguous arrays (one array
+ * per component), the other values in ParticleState. Particles are removed by
+ * moving the last particle in the slot of the removed one, so the active
+ * particles always occupy the [0, size()) range of every array.
+ */
+class BABYLON_SHARED_EXPORT ParticleStore {
+
+public:
+  ParticleStore();
+  ~ParticleStore(); // = default
+
+  /**
+   * @brief Returns the number of particles.
+   */
+  [[nodiscard]] size_t size() const
+  {
+    return age.size();
+  }
+
+  /**
+   * @brief Returns whether there are no particles.
+   */
+  [[nodiscard]] bool empty() const
+  {
+    return age.empty();
+  }
+
+  /**
+   * @brief Reserves the storage for the given number of particles.
+   */
+  void reserve(size_t capacity);
+
+  /**
+   * @brief Appends a particle with default values.
+   * @param cellIndex defines the initial sprite cell index of the particle
+   * @returns the index of the new particle
+   */
+  size_t add(unsigned int cellIndex = 0);
+
+  /**
+   * @brief Removes a particle by moving the last particle in its slot.
+   * @param index defines the index of the particle to remove
+   */
+  void swapRemove(size_t index);
+
+  /**
+   * @brief Copies a particle in the slot of another one.
+   * @param from defines the index of the particle to copy
+   * @param to defines the index of the slot to overwrite
+   */
+  void copy(size_t from, size_t to);
+
+  /**
+   * @brief Removes all the particles.
+   */
+  void clear();
+
+  /**
+   * @brief Returns a new unique particle ID.
+   */
+  static size_t NextId();
+
+public:
+  /** World position */
+  Float32Array positionX, positionY, positionZ;
+  /** World direction */
+  Float32Array directionX, directionY, directionZ;
+  /** Color */
+  Float32Array colorR, colorG, colorB, colorA;
+  /** Color change per step */
+  Float32Array colorStepR, colorStepG, colorStepB, colorStepA;
+  /** Life time */
+  Float32Array lifeTime;
+  /** Current age */
+  Float32Array age;
+  /** Current size */
+  Float32Array sizes;
+  /** Current scale */
+  Float32Array scaleX, scaleY;
+  /** Current angle */
+  Float32Array angle;
+  /** Angle change per step */
+  Float32Array angularSpeed;
+  /** Sprite cell index */
+  std::vector<unsigned int> cellIndex;
+  /** Values which are not updated every frame */
+  std::vector<ParticleState> states;
+
+private:
+  static size_t _Count;
+
+}; // end of class ParticleStore
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PARTICLES_PARTICLE_STORE_H
@@ -8,6 +8,7 @@
 #include <babylon/misc/observer.h>
 #include <babylon/particles/base_particle_system.h>
 #include <babylon/particles/iparticle_system.h>
+#include <babylon/particles/particle_store.h>
 #include <unordered_map>
 
 namespace BABYLON {
@@ -305,8 +306,14 @@ public:
 
   /**
    * @brief Gets the current list of active particles.
+   * @returns handles to the active particles
    */
-  std::vector<Particle*>& particles();
+  std::vector<Particle> particles();
+
+  /**
+   * @brief Gets the structure-of-arrays storage of the active particles.
+   */
+  ParticleStore& particleStore();
 
   /**
    * @brief Gets the number of particles active at the same time.
@@ -386,16 +393,10 @@ public:
   void reset() override;
 
   /**
-   * @brief For internal use only.
-   */
-  void _appendParticleVertex(unsigned int index, Particle* particle, int offsetX, int offsetY);
-
-  /**
-   * @brief "Recycles" one of the particle by copying it back to the "stock" of
-   * particles and removing it from the active list. Its lifetime will start
-   * back at 0.
+   * @brief "Recycles" one of the particle by removing it from the active list:
+   * the last active particle is moved in its slot.
    */
-  void recycleParticle(Particle* particle);
+  void recycleParticle(const Particle& particle);
 
   /**
    * @brief Hidden
@@ -427,12 +428,6 @@ public:
                                              std::vector<std::string>& attributes,
                                              std::vector<std::string>& samplers) override;
 
-  /**
-   * @brief For internal use only.
-   */
-  void _appendParticleVertexWithAnimation(unsigned int index, Particle* particle, int offsetX,
-                                          int offsetY);
-
   /**
    * @brief Animates the particle system for the current frame by emitting new
    * particles and or animating the living ones.
@@ -550,14 +545,15 @@ private:
   void _prepareSubEmitterInternalArray();
   // Start of sub system methods
   void _stopSubEmitters();
-  Particle* _createParticle();
+  Particle _createParticle();
   void _removeFromRoot();
-  void _emitFromParticle(Particle* particle);
+  void _emitFromParticle(const Particle& particle);
   // End of sub system methods
   void _update(int newParticles);
+  void _updateParticles();
   /** @hidden */
   EffectPtr _getEffect(unsigned int blendMode);
-  void _appendParticleVertices(unsigned int offset, Particle* particle);
+  void _fillVertexData();
   size_t _render(unsigned int blendMode);
 
 public:
@@ -572,8 +568,10 @@ public:
    * particles. This function will be called instead of regular update (age,
    * position, color, etc.). Do not forget that this function will be called
    * on every frame so try to keep it simple and fast :)
+   * The regular update runs over the arrays of the particle store when no
+   * function is defined (default).
    */
-  std::function<void(std::vector<Particle*>& particles)> updateFunction;
+  std::function<void(std::vector<Particle>& particles)> updateFunction;
 
   /**
    * This function can be defined to specify initial direction for every new
@@ -645,11 +643,10 @@ public:
 
 private:
   Observer<IParticleSystem>::Ptr _onDisposeObserver;
-  std::vector<Particle*> _particles;
+  ParticleStore _particles;
   float _epsilon;
   size_t _capacity;
-  std::vector<Particle*> _stockParticles;
-  int _newPartsExcess;
+  float _newPartsExcess;
   Float32Array _vertexData;
   std::unique_ptr<Buffer> _vertexBuffer;
   std::unordered_map<std::string, VertexBufferPtr> _vertexBuffers;
@@ -659,25 +656,23 @@ private:
   std::unordered_map<unsigned int, EffectPtr> _customEffect;
   std::string _cachedDefines;
 
-  Color4 _scaledColorStep;
   Color4 _colorDiff;
-  Vector3 _scaledDirection;
-  Vector3 _scaledGravity;
   int _currentRenderId;
   bool _alive;
   bool _useInstancing;
 
   bool _started;
   bool _stopped;
-  int _actualFrame;
-  int _scaledUpdateSpeed;
+  float _actualFrame;
+  float _scaledUpdateSpeed;
+  // Per particle update step and direction scale of the current frame
+  Float32Array _updateSteps;
+  Float32Array _directionScales;
   unsigned int _vertexBufferSize;
   int _rawTextureWidth;
   RawTexturePtr _rampGradientsTexture;
   bool _useRampGradients;
 
-  std::function<void(unsigned int offset, Particle* particle)> _appendParticleVertexes;
-
   std::vector<std::vector<ParticleSystem*>> _subEmitters;
   ParticleSystem* _rootParticleSystem;
   Vector3 _zeroVector3;
@@ -9,8 +9,7 @@ namespace BABYLON {
 
 class PhysicsImpostor;
 struct PhysicsHitData;
-using PhysicsImpostorPtr = std::shared_ptr<PhysicsImpostor>;
-using PhysicsHitDataPtr  = std::shared_ptr<PhysicsHitData>;
+using PhysicsHitDataPtr = std::shared_ptr<PhysicsHitData>;
 
 /**
  * @brief Interface for an affected physics impostor.
@@ -21,7 +20,7 @@ struct BABYLON_SHARED_EXPORT PhysicsAffectedImpostorWithData {
   /**
    * The impostor affected by the effect
    */
-  PhysicsImpostorPtr impostor = nullptr;
+  PhysicsImpostor* impostor = nullptr;
 
   /**
    * The data about the hit/horce from the explosion
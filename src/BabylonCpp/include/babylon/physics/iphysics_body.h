@@ -10,6 +10,8 @@ class Vector3;
 
 struct BABYLON_SHARED_EXPORT IPhysicsBody {
 
+  virtual ~IPhysicsBody() = default;
+
   virtual void setPosition(const Vector3& newPosition)                     = 0;
   virtual void setOrientation(const Quaternion& newRotation)               = 0;
   virtual void setShapesDensity(float density)                             = 0;
@@ -115,10 +115,10 @@ struct BABYLON_SHARED_EXPORT IPhysicsEngine {
   virtual IPhysicsEnginePlugin* getPhysicsPlugin() = 0;
 
   /**
-   * @brief Gets the list of physic impostors
+   * @brief Gets the list of physic impostors, owned by their objects
    * @returns an array of PhysicsImpostor
    */
-  virtual std::vector<PhysicsImpostorPtr>& getImpostors() = 0;
+  virtual std::vector<PhysicsImpostor*>& getImpostors() = 0;
 
   /**
    * @brief Gets the impostor for a physics enabled object
@@ -0,0 +1,181 @@
+#ifndef BABYLON_PHYSICS_NATIVE_NATIVE_PHYSICS_BODY_H
+#define BABYLON_PHYSICS_NATIVE_NATIVE_PHYSICS_BODY_H
+
+#include <babylon/babylon_api.h>
+#include <babylon/maths/quaternion.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/physics/iphysics_body.h>
+#include <babylon/physics/native/native_physics_shape.h>
+
+namespace BABYLON {
+
+class NativePhysicsWorld;
+
+/**
+ * @brief Rigid body of the native physics engine.
+ *
+ * A body with a zero mass is static, as well as any body with a mesh shape.
+ * Bodies are created and owned by a NativePhysicsWorld, and must only be
+ * modified between two steps of it.
+ */
+class BABYLON_SHARED_EXPORT NativePhysicsBody : public IPhysicsBody {
+
+  friend class NativePhysicsWorld;
+
+public:
+  NativePhysicsBody(const NativePhysicsShapePtr& shape, float mass, const Vector3& position,
+                    const Quaternion& rotation);
+  ~NativePhysicsBody() override; // = default
+
+  NativePhysicsBody(const NativePhysicsBody&) = delete;
+  NativePhysicsBody& operator=(const NativePhysicsBody&) = delete;
+
+  /** IPhysicsBody **/
+  void setPosition(const Vector3& newPosition) override;
+  void setOrientation(const Quaternion& newRotation) override;
+  void setShapesDensity(float density) override;
+  void setupMass(int mass) override;
+  float mass() override;
+  void applyImpulse(const Vector3& position, const Vector3& force) override;
+  Vector3 angularVelocity() override;
+  void setAngularVelocity(const Vector3& velocity) override;
+  Vector3 linearVelocity() override;
+  void setLinearVelocity(const Vector3& velocity) override;
+  void sleep() override;
+  bool sleeping() override;
+  void awake() override;
+  void syncShapes() override;
+
+  /**
+   * @brief Returns the unique id of the body in its world.
+   */
+  [[nodiscard]] size_t uniqueId() const;
+
+  /**
+   * @brief Returns the collision shape of the body.
+   */
+  [[nodiscard]] const NativePhysicsShapePtr& shape() const;
+
+  /**
+   * @brief Returns the position of the center of the body.
+   */
+  [[nodiscard]] const Vector3& position() const;
+
+  /**
+   * @brief Returns the orientation of the body.
+   */
+  [[nodiscard]] const Quaternion& rotation() const;
+
+  /**
+   * @brief Returns whether the body is static (zero mass).
+   */
+  [[nodiscard]] bool isStatic() const;
+
+  /**
+   * @brief Sets the mass of the body, a zero mass makes it static.
+   * @param mass defines the new mass
+   */
+  void setMass(float mass);
+
+  /**
+   * @brief Returns the friction coefficient of the body.
+   */
+  [[nodiscard]] float friction() const;
+
+  /**
+   * @brief Sets the friction coefficient of the body.
+   */
+  void setFriction(float friction);
+
+  /**
+   * @brief Returns the restitution coefficient of the body.
+   */
+  [[nodiscard]] float restitution() const;
+
+  /**
+   * @brief Sets the restitution coefficient of the body.
+   */
+  void setRestitution(float restitution);
+
+  /**
+   * @brief Sets the linear and angular damping, in 1/s.
+   */
+  void setDamping(float linearDamping, float angularDamping);
+
+  /**
+   * @brief Accumulates a force applied at a world point, until the next step.
+   * @param force defines the force, in world space
+   * @param contactPoint defines the point where the force is applied
+   */
+  void applyForce(const Vector3& force, const Vector3& contactPoint);
+
+  /**
+   * @brief Transforms a point from the local space of the body to world space.
+   */
+  [[nodiscard]] Vector3 localToWorld(const Vector3& point) const;
+
+  /**
+   * @brief Transforms a point from world space to the local space of the body.
+   */
+  [[nodiscard]] Vector3 worldToLocal(const Vector3& point) const;
+
+  /**
+   * @brief Rotates a direction from the local space of the body to world
+   * space.
+   */
+  [[nodiscard]] Vector3 rotateToWorld(const Vector3& direction) const;
+
+  /**
+   * @brief Rotates a direction from world space to the local space of the
+   * body.
+   */
+  [[nodiscard]] Vector3 rotateToLocal(const Vector3& direction) const;
+
+  /**
+   * @brief Multiplies a world vector by the world inverse inertia tensor.
+   */
+  [[nodiscard]] Vector3 applyInverseInertia(const Vector3& vector) const;
+
+  /**
+   * @brief Computes the world axis aligned bounding box of the body.
+   */
+  void computeBoundingBox(Vector3& min, Vector3& max) const;
+
+private:
+  void _updateMassProperties();
+
+private:
+  size_t _uniqueId;
+  NativePhysicsShapePtr _shape;
+  Vector3 _position;
+  Quaternion _rotation;
+  Vector3 _linearVelocity;
+  Vector3 _angularVelocity;
+  Vector3 _force;
+  Vector3 _torque;
+  float _mass;
+  float _inverseMass;
+  Vector3 _inverseInertia;
+  float _friction;
+  float _restitution;
+  float _linearDamping;
+  float _angularDamping;
+  bool _sleeping;
+  float _sleepTime;
+  // Set when the transformation was changed outside of a step
+  bool _transformDirty;
+  // World bounding box, and broadphase proxy (NullNode when the body is not
+  // in a world)
+  Vector3 _boundingMin;
+  Vector3 _boundingMax;
+  int _proxyId;
+  // Index of the body in the body list of its world, and in the solver
+  // bodies of its island
+  size_t _index;
+  size_t _solverIndex;
+
+}; // end of class NativePhysicsBody
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PHYSICS_NATIVE_NATIVE_PHYSICS_BODY_H
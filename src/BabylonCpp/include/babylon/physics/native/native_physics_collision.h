@@ -0,0 +1,89 @@
+#ifndef BABYLON_PHYSICS_NATIVE_NATIVE_PHYSICS_COLLISION_H
+#define BABYLON_PHYSICS_NATIVE_NATIVE_PHYSICS_COLLISION_H
+
+#include <array>
+
+#include <babylon/babylon_api.h>
+#include <babylon/maths/vector3.h>
+
+namespace BABYLON {
+
+class NativePhysicsBody;
+
+/**
+ * @brief Contact point between two native physics bodies.
+ */
+struct BABYLON_SHARED_EXPORT NativePhysicsContactPoint {
+  // Contact points on the surface of each body, in their local space
+  Vector3 localPointA;
+  Vector3 localPointB;
+  // Contact points on the surface of each body, in world space
+  Vector3 pointA;
+  Vector3 pointB;
+  // Contact normal in world space, pointing from body A to body B
+  Vector3 normal;
+  // Distance between the surfaces along the normal, negative when they overlap
+  float separation = 0.f;
+  // Accumulated impulses of the previous step, used for warm starting
+  float normalImpulse   = 0.f;
+  float tangentImpulse1 = 0.f;
+  float tangentImpulse2 = 0.f;
+}; // end of struct NativePhysicsContactPoint
+
+/**
+ * @brief Contact points between a pair of native physics bodies, updated at
+ * each step while the bodies are close to each other.
+ */
+struct BABYLON_SHARED_EXPORT NativePhysicsManifold {
+  static constexpr size_t MaxPoints = 4;
+  NativePhysicsBody* bodyA = nullptr;
+  NativePhysicsBody* bodyB = nullptr;
+  std::array<NativePhysicsContactPoint, MaxPoints> points;
+  size_t pointCount = 0;
+  // Step at which the manifold was updated for the last time
+  size_t lastStep = 0;
+}; // end of struct NativePhysicsManifold
+
+/**
+ * @brief Narrow phase of the native physics engine.
+ *
+ * Convex shapes are handled as cores inflated by a radius: the distance
+ * between the cores is computed with the GJK algorithm, deep overlaps fall
+ * back to a separating axis search, and the contact polygon is built by
+ * clipping the features of the shapes facing each other. Static meshes are
+ * handled triangle by triangle.
+ */
+class BABYLON_SHARED_EXPORT NativePhysicsCollision {
+
+public:
+  /**
+   * Maximum separation for which contact points are created
+   */
+  static constexpr float ContactMargin = 0.02f;
+
+public:
+  /**
+   * @brief Recomputes the contact points of a manifold from the current
+   * transformations of its bodies. The accumulated impulses of the points
+   * which persist from the previous step are kept.
+   * @param manifold defines the manifold to update
+   */
+  static void UpdateManifold(NativePhysicsManifold& manifold);
+
+  /**
+   * @brief Intersects a segment with a body.
+   * @param body defines the body
+   * @param from defines the start of the segment, in world space
+   * @param to defines the end of the segment, in world space
+   * @param fraction receives the position of the hit along the segment
+   * @param normal receives the world normal of the surface at the hit
+   * @returns whether the segment hits the body
+   */
+  static bool Raycast(const NativePhysicsBody& body, const Vector3& from, const Vector3& to,
+                      float& fraction, Vector3& normal);
+
+}; // end of class NativePhysicsCollision
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PHYSICS_NATIVE_NATIVE_PHYSICS_COLLISION_H
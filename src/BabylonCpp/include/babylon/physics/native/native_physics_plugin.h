@@ -0,0 +1,128 @@
+#ifndef BABYLON_PHYSICS_NATIVE_NATIVE_PHYSICS_PLUGIN_H
+#define BABYLON_PHYSICS_NATIVE_NATIVE_PHYSICS_PLUGIN_H
+
+#include <memory>
+#include <unordered_map>
+
+#include <babylon/babylon_api.h>
+#include <babylon/physics/iphysics_engine_plugin.h>
+
+namespace BABYLON {
+
+class NativePhysicsBody;
+struct NativePhysicsJoint;
+class NativePhysicsWorld;
+class PhysicsJoint;
+
+/**
+ * @brief Physics plugin running the built-in rigid body engine
+ * (NativePhysicsWorld), to be passed to Scene::enablePhysics.
+ *
+ * Supported impostors: sphere, box (and plane, as a thin box), capsule,
+ * convex hull (and cylinder, as the hull of the mesh vertices) and mesh (static
+ * only). Primitive shapes are centered on the position of their object.
+ * Supported joints: distance, point to point and ball and socket. Hinge,
+ * wheel, slider, prismatic, universal and lock joints are approximated by point
+ * to point joints. Soft bodies and motors are not supported.
+ *
+ * The plugin is not owned by the physics engine and must outlive it.
+ */
+class BABYLON_SHARED_EXPORT NativePhysicsPlugin : public IPhysicsEnginePlugin {
+
+public:
+  /**
+   * Maximum number of fixed steps run by a call to executeStep
+   */
+  static constexpr size_t MaxSubSteps = 3;
+
+public:
+  /**
+   * @brief Creates a native physics plugin.
+   * @param useDeltaForWorldStep defines whether the world advances by the
+   * frame delta (in fixed steps) or by a single fixed step per frame
+   * @param iterations defines the number of iterations of the velocity solver
+   */
+  NativePhysicsPlugin(bool useDeltaForWorldStep = true, size_t iterations = 10);
+  ~NativePhysicsPlugin() override; // = default
+
+  NativePhysicsPlugin(const NativePhysicsPlugin&) = delete;
+  NativePhysicsPlugin& operator=(const NativePhysicsPlugin&) = delete;
+
+  /**
+   * @brief Returns the simulated world.
+   */
+  NativePhysicsWorld& physicsWorld();
+
+  /** IPhysicsEnginePlugin **/
+  void setGravity(const Vector3& gravity) override;
+  void setTimeStep(float timeStep) override;
+  [[nodiscard]] float getTimeStep() const override;
+  void executeStep(float delta, const std::vector<PhysicsImpostor*>& impostors) override;
+  void applyImpulse(const PhysicsImpostor& impostor, const Vector3& force,
+                    const Vector3& contactPoint) override;
+  void applyForce(const PhysicsImpostor& impostor, const Vector3& force,
+                  const Vector3& contactPoint) override;
+  void generatePhysicsBody(const PhysicsImpostor& impostor) override;
+  void removePhysicsBody(const PhysicsImpostor& impostor) override;
+  void generateJoint(PhysicsImpostorJoint* impostorJoint) override;
+  void removeJoint(PhysicsImpostorJoint* impostorJoint) override;
+  bool isSupported() override;
+  void setTransformationFromPhysicsBody(const PhysicsImpostor& impostor) override;
+  void setPhysicsBodyTransformation(const PhysicsImpostor& impostor, const Vector3& newPosition,
+                                    const Quaternion& newRotation) override;
+  void setLinearVelocity(const PhysicsImpostor& impostor,
+                         const std::optional<Vector3>& velocity) override;
+  void setAngularVelocity(const PhysicsImpostor& impostor,
+                          const std::optional<Vector3>& velocity) override;
+  Vector3 getLinearVelocity(const PhysicsImpostor& impostor) override;
+  Vector3 getAngularVelocity(const PhysicsImpostor& impostor) override;
+  void setBodyMass(const PhysicsImpostor& impostor, float mass) override;
+  float getBodyMass(const PhysicsImpostor& impostor) override;
+  float getBodyFriction(const PhysicsImpostor& impostor) override;
+  void setBodyFriction(const PhysicsImpostor& impostor, float friction) override;
+  float getBodyRestitution(const PhysicsImpostor& impostor) override;
+  void setBodyRestitution(const PhysicsImpostor& impostor, float restitution) override;
+  float getBodyPressure(const PhysicsImpostor& impostor) override;
+  void setBodyPressure(const PhysicsImpostor& impostor, float pressure) override;
+  float getBodyStiffness(const PhysicsImpostor& impostor) override;
+  void setBodyStiffness(const PhysicsImpostor& impostor, float stiffness) override;
+  size_t getBodyVelocityIterations(const PhysicsImpostor& impostor) override;
+  void setBodyVelocityIterations(const PhysicsImpostor& impostor,
+                                 size_t velocityIterations) override;
+  size_t getBodyPositionIterations(const PhysicsImpostor& impostor) override;
+  void setBodyPositionIterations(const PhysicsImpostor& impostor,
+                                 size_t positionIterations) override;
+  void appendAnchor(const PhysicsImpostor& impostor, const PhysicsImpostorPtr& otherImpostor,
+                    int width, int height, float influence,
+                    bool noCollisionBetweenLinkedBodies) override;
+  void appendHook(const PhysicsImpostor& impostor, const PhysicsImpostorPtr& otherImpostor,
+                  float length, float influence, bool noCollisionBetweenLinkedBodies) override;
+  void sleepBody(const PhysicsImpostor& impostor) override;
+  void wakeUpBody(const PhysicsImpostor& impostor) override;
+  PhysicsRaycastResult raycast(const Vector3& from, const Vector3& to) override;
+  void updateDistanceJoint(DistanceJoint* joint, float maxDistance, float minDistance) override;
+  void setMotor(IMotorEnabledJoint* joint, float speed, float maxForce,
+                unsigned int motorIndex = 0) override;
+  void setLimit(IMotorEnabledJoint* joint, float upperLimit, float lowerLimit,
+                unsigned int motorIndex = 0) override;
+  float getRadius(const PhysicsImpostor& impostor) override;
+  void getBoxSizeToRef(const PhysicsImpostor& impostor, Vector3& result) override;
+  void syncMeshWithImpostor(AbstractMesh* mesh, const PhysicsImpostor& impostor) override;
+  void dispose() override;
+
+private:
+  NativePhysicsBody* _getBody(const PhysicsImpostor& impostor) const;
+
+private:
+  bool _useDeltaForWorldStep;
+  float _fixedTimeStep;
+  float _timeAccumulator;
+  std::unique_ptr<NativePhysicsWorld> _world;
+  // Native joints of the joints of the physics engine
+  std::unordered_map<PhysicsJoint*, NativePhysicsJoint*> _joints;
+
+}; // end of class NativePhysicsPlugin
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PHYSICS_NATIVE_NATIVE_PHYSICS_PLUGIN_H
@@ -0,0 +1,187 @@
+#ifndef BABYLON_PHYSICS_NATIVE_NATIVE_PHYSICS_SHAPE_H
+#define BABYLON_PHYSICS_NATIVE_NATIVE_PHYSICS_SHAPE_H
+
+#include <memory>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/maths/vector3.h>
+
+namespace BABYLON {
+
+class NativePhysicsShape;
+class TriangleBVH;
+using NativePhysicsShapePtr = std::shared_ptr<NativePhysicsShape>;
+
+/**
+ * @brief Types of the collision shapes of the native physics engine.
+ */
+enum class NativePhysicsShapeType {
+  Sphere,
+  Box,
+  Capsule,
+  ConvexHull,
+  Mesh,
+}; // end of enum class NativePhysicsShapeType
+
+/**
+ * @brief Collision shape of a native physics body, defined in the local space
+ * of the body.
+ *
+ * Convex shapes are described by a core (a point for spheres, a segment along
+ * the local Y axis for capsules, a slightly shrunk box for boxes, a point cloud
+ * for convex hulls) inflated by a radius, which is what the narrow phase uses.
+ * Mesh shapes are static triangle soups indexed by a bounding volume
+ * hierarchy.
+ */
+class BABYLON_SHARED_EXPORT NativePhysicsShape {
+
+public:
+  /**
+   * Rounding radius of the box cores, as a ratio of the smallest half extent
+   */
+  static constexpr float BoxMarginRatio = 0.1f;
+
+  /**
+   * Maximum rounding radius of the box cores
+   */
+  static constexpr float MaxBoxMargin = 0.04f;
+
+  /**
+   * Maximum number of points kept in a convex hull
+   */
+  static constexpr size_t MaxConvexHullPoints = 128;
+
+public:
+  /**
+   * @brief Creates a sphere.
+   * @param radius defines the radius of the sphere
+   */
+  static NativePhysicsShapePtr CreateSphere(float radius);
+
+  /**
+   * @brief Creates a box.
+   * @param halfExtents defines the half size of the box along each axis
+   */
+  static NativePhysicsShapePtr CreateBox(const Vector3& halfExtents);
+
+  /**
+   * @brief Creates a capsule aligned with the local Y axis.
+   * @param radius defines the radius of the capsule
+   * @param halfHeight defines the half length of the cylindrical part
+   */
+  static NativePhysicsShapePtr CreateCapsule(float radius, float halfHeight);
+
+  /**
+   * @brief Creates the convex hull of a point cloud. Large clouds are reduced
+   * to their extreme points along a fixed set of directions.
+   * @param points defines the points
+   */
+  static NativePhysicsShapePtr CreateConvexHull(const std::vector<Vector3>& points);
+
+  /**
+   * @brief Creates a static triangle mesh.
+   * @param positions defines the vertex positions
+   * @param indices defines the triangle indices
+   */
+  static NativePhysicsShapePtr CreateMesh(const std::vector<Vector3>& positions,
+                                          const IndicesArray& indices);
+
+  ~NativePhysicsShape(); // = default
+
+  NativePhysicsShape(const NativePhysicsShape&) = delete;
+  NativePhysicsShape& operator=(const NativePhysicsShape&) = delete;
+
+  /**
+   * @brief Returns the type of the shape.
+   */
+  [[nodiscard]] NativePhysicsShapeType type() const;
+
+  /**
+   * @brief Returns whether the shape is convex (every type but meshes).
+   */
+  [[nodiscard]] bool isConvex() const;
+
+  /**
+   * @brief Returns the radius inflating the core of the shape.
+   */
+  [[nodiscard]] float radius() const;
+
+  /**
+   * @brief Returns the half extents of a box (the full box, margin included).
+   */
+  [[nodiscard]] const Vector3& halfExtents() const;
+
+  /**
+   * @brief Returns the half length of the cylindrical part of a capsule.
+   */
+  [[nodiscard]] float halfHeight() const;
+
+  /**
+   * @brief Returns the points of a convex hull, or the positions of a mesh.
+   */
+  [[nodiscard]] const std::vector<Vector3>& points() const;
+
+  /**
+   * @brief Returns the indices of a mesh.
+   */
+  [[nodiscard]] const IndicesArray& indices() const;
+
+  /**
+   * @brief Returns the triangle hierarchy of a mesh.
+   */
+  [[nodiscard]] const TriangleBVH* triangleBVH() const;
+
+  /**
+   * @brief Returns the minimum of the local bounding box.
+   */
+  [[nodiscard]] const Vector3& localMin() const;
+
+  /**
+   * @brief Returns the maximum of the local bounding box.
+   */
+  [[nodiscard]] const Vector3& localMax() const;
+
+  /**
+   * @brief Returns the point of the core furthest along a local direction.
+   * @param direction defines the direction, not necessarily normalized
+   */
+  [[nodiscard]] Vector3 supportCore(const Vector3& direction) const;
+
+  /**
+   * @brief Returns the volume of the shape (of its bounding box for hulls and
+   * meshes).
+   */
+  [[nodiscard]] float volume() const;
+
+  /**
+   * @brief Returns the diagonal of the local inertia tensor for a mass. Hulls
+   * and meshes use the inertia of their bounding box.
+   * @param mass defines the mass of the body
+   */
+  [[nodiscard]] Vector3 computeInertia(float mass) const;
+
+protected:
+  NativePhysicsShape(NativePhysicsShapeType type);
+
+private:
+  void _computeLocalBounds();
+
+private:
+  NativePhysicsShapeType _type;
+  float _radius;
+  Vector3 _halfExtents;
+  Vector3 _coreHalfExtents;
+  float _halfHeight;
+  std::vector<Vector3> _points;
+  IndicesArray _indices;
+  std::unique_ptr<TriangleBVH> _triangleBVH;
+  Vector3 _localMin;
+  Vector3 _localMax;
+
+}; // end of class NativePhysicsShape
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PHYSICS_NATIVE_NATIVE_PHYSICS_SHAPE_H
@@ -0,0 +1,218 @@
+#ifndef BABYLON_PHYSICS_NATIVE_NATIVE_PHYSICS_WORLD_H
+#define BABYLON_PHYSICS_NATIVE_NATIVE_PHYSICS_WORLD_H
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/culling/dynamic_aabb_tree.h>
+#include <babylon/maths/quaternion.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/physics/native/native_physics_collision.h>
+#include <babylon/physics/native/native_physics_shape.h>
+
+namespace BABYLON {
+
+class NativePhysicsBody;
+
+/**
+ * @brief Types of the joints of the native physics engine.
+ */
+enum class NativePhysicsJointType {
+  // The pivots of the two bodies are kept at the same position
+  PointToPoint,
+  // The distance between the pivots is kept in a range
+  Distance,
+}; // end of enum class NativePhysicsJointType
+
+/**
+ * @brief Joint between two native physics bodies.
+ */
+struct BABYLON_SHARED_EXPORT NativePhysicsJoint {
+  NativePhysicsJointType type = NativePhysicsJointType::PointToPoint;
+  NativePhysicsBody* bodyA    = nullptr;
+  NativePhysicsBody* bodyB    = nullptr;
+  // Pivots in the local space of each body
+  Vector3 localPivotA = Vector3::Zero();
+  Vector3 localPivotB = Vector3::Zero();
+  // Distance range of the distance joints
+  float minDistance = 0.f;
+  float maxDistance = 0.f;
+  // Accumulated impulses of the previous step, used for warm starting
+  Vector3 impulse    = Vector3::Zero();
+  float lowerImpulse = 0.f;
+  float upperImpulse = 0.f;
+}; // end of struct NativePhysicsJoint
+
+/**
+ * @brief Rigid body world of the native physics engine.
+ *
+ * A step runs the following stages, the heavy ones in parallel on the default
+ * thread pool:
+ * - the bounding boxes of the awake bodies are refitted in the broadphase
+ *   (a dynamic AABB tree) and the awake bodies query it for pairs,
+ * - the contact manifolds of the pairs are updated (narrow phase),
+ * - the dynamic bodies are split in islands connected by contacts and joints,
+ *   islands touching an awake body are woken up,
+ * - each awake island is solved independently (sequential impulses with warm
+ *   starting), integrated, and put to sleep when it stays at rest.
+ * The result does not depend on the number of threads.
+ */
+class BABYLON_SHARED_EXPORT NativePhysicsWorld {
+
+public:
+  /**
+   * Number of iterations of the velocity solver
+   */
+  static constexpr size_t DefaultSolverIterations = 10;
+
+  /**
+   * Velocities under which a body is considered at rest, in m/s and rad/s
+   */
+  static constexpr float SleepLinearVelocity  = 0.05f;
+  static constexpr float SleepAngularVelocity = 0.05f;
+
+  /**
+   * Time an island must stay at rest before sleeping, in seconds
+   */
+  static constexpr float TimeToSleep = 0.5f;
+
+public:
+  NativePhysicsWorld();
+  ~NativePhysicsWorld(); // = default
+
+  NativePhysicsWorld(const NativePhysicsWorld&) = delete;
+  NativePhysicsWorld& operator=(const NativePhysicsWorld&) = delete;
+
+  /**
+   * @brief Sets the gravity of the world.
+   */
+  void setGravity(const Vector3& gravity);
+
+  /**
+   * @brief Returns the gravity of the world.
+   */
+  [[nodiscard]] const Vector3& gravity() const;
+
+  /**
+   * @brief Sets the number of iterations of the velocity solver.
+   */
+  void setSolverIterations(size_t iterations);
+
+  /**
+   * @brief Returns the number of iterations of the velocity solver.
+   */
+  [[nodiscard]] size_t solverIterations() const;
+
+  /**
+   * @brief Creates a body in the world.
+   * @param shape defines the collision shape of the body
+   * @param mass defines the mass of the body, 0 for a static body
+   * @param position defines the position of the body
+   * @param rotation defines the orientation of the body
+   * @returns the body, owned by the world
+   */
+  NativePhysicsBody* createBody(const NativePhysicsShapePtr& shape, float mass,
+                                const Vector3& position, const Quaternion& rotation);
+
+  /**
+   * @brief Removes a body from the world, with its contacts and joints.
+   */
+  void destroyBody(NativePhysicsBody* body);
+
+  /**
+   * @brief Returns the number of bodies in the world.
+   */
+  [[nodiscard]] size_t bodyCount() const;
+
+  /**
+   * @brief Creates a joint between two bodies.
+   * @param type defines the type of the joint
+   * @param bodyA defines the first body
+   * @param bodyB defines the second body
+   * @param pivotA defines the pivot in the local space of the first body
+   * @param pivotB defines the pivot in the local space of the second body
+   * @returns the joint, owned by the world. The range of the distance joints
+   * is initialized with the current distance between the pivots
+   */
+  NativePhysicsJoint* createJoint(NativePhysicsJointType type, NativePhysicsBody* bodyA,
+                                  NativePhysicsBody* bodyB, const Vector3& pivotA,
+                                  const Vector3& pivotB);
+
+  /**
+   * @brief Removes a joint from the world.
+   */
+  void destroyJoint(NativePhysicsJoint* joint);
+
+  /**
+   * @brief Advances the simulation.
+   * @param timeStep defines the duration of the step, in seconds
+   */
+  void step(float timeStep);
+
+  /**
+   * @brief Finds the first body hit by a segment.
+   * @param from defines the start of the segment
+   * @param to defines the end of the segment
+   * @param body receives the body hit
+   * @param fraction receives the position of the hit along the segment
+   * @param normal receives the world normal of the surface at the hit
+   * @returns whether a body was hit
+   */
+  bool raycast(const Vector3& from, const Vector3& to, NativePhysicsBody*& body,
+               float& fraction, Vector3& normal) const;
+
+  /**
+   * @brief Returns the number of contact manifolds.
+   */
+  [[nodiscard]] size_t manifoldCount() const;
+
+  /**
+   * @brief Returns the number of islands solved during the last step.
+   */
+  [[nodiscard]] size_t awakeIslandCount() const;
+
+  /**
+   * @brief Returns the number of dynamic bodies which are not sleeping.
+   */
+  [[nodiscard]] size_t awakeBodyCount() const;
+
+private:
+  struct Island {
+    std::vector<NativePhysicsBody*> bodies;
+    std::vector<NativePhysicsManifold*> manifolds;
+    std::vector<NativePhysicsJoint*> joints;
+  }; // end of struct Island
+
+  void _updateBroadphase();
+  void _findPairs();
+  void _updateManifolds();
+  void _buildIslands();
+  void _solveIsland(Island& island, float timeStep) const;
+
+private:
+  Vector3 _gravity;
+  size_t _solverIterations;
+  size_t _nextBodyId;
+  size_t _stepCount;
+  std::vector<std::unique_ptr<NativePhysicsBody>> _bodies;
+  std::vector<std::unique_ptr<NativePhysicsJoint>> _joints;
+  DynamicAABBTree<NativePhysicsBody*> _broadphase;
+  // Manifolds indexed by the unique ids of their bodies
+  std::unordered_map<uint64_t, NativePhysicsManifold> _manifolds;
+  // Scratch data of a step
+  std::vector<NativePhysicsBody*> _awakeBodies;
+  std::vector<std::vector<std::pair<NativePhysicsBody*, NativePhysicsBody*>>> _chunkPairs;
+  std::vector<NativePhysicsManifold*> _activeManifolds;
+  std::vector<size_t> _islandParents;
+  std::vector<Island> _islands;
+  std::vector<size_t> _awakeIslands;
+
+}; // end of class NativePhysicsWorld
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_PHYSICS_NATIVE_NATIVE_PHYSICS_WORLD_H
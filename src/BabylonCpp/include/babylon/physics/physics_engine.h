@@ -129,10 +129,10 @@ public:
   IPhysicsEnginePlugin* getPhysicsPlugin() final;
 
   /**
-   * @brief Gets the list of physic impostors.
+   * @brief Gets the list of physic impostors, owned by their objects.
    * @returns an array of PhysicsImpostor
    */
-  std::vector<PhysicsImpostorPtr>& getImpostors() final;
+  std::vector<PhysicsImpostor*>& getImpostors() final;
 
   /**
    * @brief Gets the impostor for a physics enabled object.
@@ -173,7 +173,7 @@ protected:
 private:
   bool _initialized;
   IPhysicsEnginePlugin* _physicsPlugin;
-  std::vector<PhysicsImpostorPtr> _impostors;
+  std::vector<PhysicsImpostor*> _impostors;
   std::vector<PhysicsImpostorJointPtr> _joints;
   float _subTimeStep;
 
@@ -107,7 +107,7 @@ public:
 public:
   PhysicsImpostor(IPhysicsEnabledObject* object, unsigned int type,
                   PhysicsImpostorParameters& options, Scene* scene = nullptr);
-  virtual ~PhysicsImpostor(); // = default
+  virtual ~PhysicsImpostor();
 
   /**
    * @brief This function will completly initialize this impostor.
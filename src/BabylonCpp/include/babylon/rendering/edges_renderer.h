@@ -29,17 +29,20 @@ class BABYLON_SHARED_EXPORT EdgesRenderer : public IEdgesRenderer {
 public:
   /**
    * @brief Creates an instance of the EdgesRenderer. It is primarily use to
-   * display edges of a mesh. Beware when you use this class with complex
-   * objects as the adjacencies computation can be really long.
+   * display edges of a mesh. The adjacencies are found on the sorted edges, so
+   * the generation runs in O(n log n) of the number of faces.
    * @param  source Mesh used to create edges
    * @param  epsilon sum of angles in adjacency to check for edge
    * @param  checkVerticesInsteadOfIndices bases the edges detection on vertices
    * vs indices
    * @param  generateEdgesLines - should generate Lines or only prepare
    * resources.
+   * @param  epsilonVertexMerge defines the distance under which vertices are
+   * welded when checkVerticesInsteadOfIndices is true
    */
   EdgesRenderer(const AbstractMeshPtr& source, float epsilon = 0.95f,
-                bool checkVerticesInsteadOfIndices = false, bool generateEdgesLines = true);
+                bool checkVerticesInsteadOfIndices = false, bool generateEdgesLines = true,
+                float epsilonVertexMerge = Math::Epsilon);
   ~EdgesRenderer() override; // = default
 
   /**
@@ -65,28 +68,39 @@ public:
 
 protected:
   void _prepareResources();
-  int _processEdgeForAdjacencies(unsigned int pa, unsigned int pb, unsigned int p0, unsigned int p1,
-                                 unsigned int p2);
-  int _processEdgeForAdjacenciesWithVertices(const Vector3& pa, const Vector3& pb,
-                                             const Vector3& p0, const Vector3& p1,
-                                             const Vector3& p2);
 
   /**
-   * @brief Checks if the pair of p0 and p1 is en edge.
-   * @param faceIndex
-   * @param edge
-   * @param faceNormals
-   * @param  p0
-   * @param  p1
+   * @brief Welds the vertices closer than epsilonVertexMerge.
+   * @param positions defines the vertex positions
+   * @returns the id of the vertex each vertex is merged into
    */
-  void _checkEdge(size_t faceIndex, int edge, const std::vector<Vector3>& faceNormals,
-                  const Vector3& p0, const Vector3& p1);
+  [[nodiscard]] Uint32Array _weldVertices(const Float32Array& positions) const;
 
   /**
-   * @brief Push line into the position, normal and index buffer.
+   * @brief Checks if the edge of a face needs a line.
+   * @param faceIndex defines the index of the face
+   * @param edge defines the index of the adjacent face, -1 if none
+   * @param faceNormals defines the normals of the faces
+   * @returns true if a line must be created
+   */
+  [[nodiscard]] bool _checkEdge(size_t faceIndex, int edge,
+                                const std::vector<Vector3>& faceNormals) const;
+
+  /**
+   * @brief Writes a line into the position, normal and index buffers, which
+   * must have been allocated with _allocateLines.
+   * @param p0 defines the start of the line
+   * @param p1 defines the end of the line
+   * @param offset defines the index of the first vertex of the line (4 per line)
    */
   void createLine(const Vector3& p0, const Vector3& p1, uint32_t offset);
 
+  /**
+   * @brief Allocates the position, normal and index buffers of the lines.
+   * @param linesCount defines the number of lines
+   */
+  void _allocateLines(size_t linesCount);
+
   /**
    * @brief Generates lines edges from adjacencjes.
    */
@@ -114,6 +128,7 @@ protected:
   WebGLDataBufferPtr _ib;
   std::unordered_map<std::string, VertexBufferPtr> _buffers;
   bool _checkVerticesInsteadOfIndices;
+  float _epsilonVertexMerge;
 
 private:
   Observer<AbstractMesh>::Ptr _meshRebuildObserver;
@@ -33,6 +33,7 @@ attribute vec4 color;
 #include<helperFunctions>
 
 #include<bonesDeclaration>
+#include<bakedVertexAnimationDeclaration>
 
 // Uniforms
 #include<instancesDeclaration>
@@ -131,6 +132,7 @@ void main(void) {
 
 #include<instancesVertex>
 #include<bonesVertex>
+#include<bakedVertexAnimation>
 
     vec4 worldPos = finalWorld * vec4(positionUpdated, 1.0);
 
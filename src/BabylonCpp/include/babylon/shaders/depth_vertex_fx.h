@@ -11,6 +11,7 @@ const char* depthVertexShader
 // Attribute
 attribute vec3 position;
 #include<bonesDeclaration>
+#include<bakedVertexAnimationDeclaration>
 
 #include<morphTargetsVertexGlobalDeclaration>
 #include<morphTargetsVertexDeclaration>[0..maxSimultaneousMorphTargets]
@@ -45,6 +46,7 @@ void main(void)
 #include<instancesVertex>
 
 #include<bonesVertex>
+#include<bakedVertexAnimation>
 
     gl_Position = viewProjection * finalWorld * vec4(positionUpdated, 1.0);
 
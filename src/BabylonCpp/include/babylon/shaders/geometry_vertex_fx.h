@@ -14,6 +14,7 @@ const char* geometryVertexShader
 precision highp int;
 
 #include<bonesDeclaration>
+#include<bakedVertexAnimationDeclaration>
 
 #include<morphTargetsVertexGlobalDeclaration>
 #include<morphTargetsVertexDeclaration>[0..maxSimultaneousMorphTargets]
@@ -98,6 +99,7 @@ void main(void)
     #endif
 
 #include<bonesVertex>
+#include<bakedVertexAnimation>
     vec4 pos = vec4(finalWorld * vec4(positionUpdated, 1.0));
 
     #ifdef BUMP
@@ -12,6 +12,7 @@ const char* glowMapGenerationVertexShader
 attribute vec3 position;
 
 #include<bonesDeclaration>
+#include<bakedVertexAnimationDeclaration>
 
 #include<morphTargetsVertexGlobalDeclaration>
 #include<morphTargetsVertexDeclaration>[0..maxSimultaneousMorphTargets]
@@ -60,6 +61,7 @@ void main(void)
 #include<morphTargetsVertex>[0..maxSimultaneousMorphTargets]
 #include<instancesVertex>
 #include<bonesVertex>
+#include<bakedVertexAnimation>
 
 #ifdef CUBEMAP
     vPosition = finalWorld * vec4(positionUpdated, 1.0);
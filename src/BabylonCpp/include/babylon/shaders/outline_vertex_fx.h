@@ -13,6 +13,7 @@ attribute vec3 position;
 attribute vec3 normal;
 
 #include<bonesDeclaration>
+#include<bakedVertexAnimationDeclaration>
 
 #include<morphTargetsVertexGlobalDeclaration>
 #include<morphTargetsVertexDeclaration>[0..maxSimultaneousMorphTargets]
@@ -49,6 +50,7 @@ void main(void)
 
 #include<instancesVertex>
 #include<bonesVertex>
+#include<bakedVertexAnimation>
 
     gl_Position = viewProjection * finalWorld * vec4(offsetPosition, 1.0);
 
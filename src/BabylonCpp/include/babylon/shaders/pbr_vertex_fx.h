@@ -42,6 +42,7 @@ attribute vec4 color;
 
 #include<helperFunctions>
 #include<bonesDeclaration>
+#include<bakedVertexAnimationDeclaration>
 
 // Uniforms
 #include<instancesDeclaration>
@@ -174,6 +175,7 @@ void main(void) {
 
 #include<instancesVertex>
 #include<bonesVertex>
+#include<bakedVertexAnimation>
 
 #ifdef MULTIVIEW
     if (gl_ViewID_OVR == 0u) {
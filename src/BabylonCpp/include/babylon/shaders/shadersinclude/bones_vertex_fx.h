@@ -8,6 +8,7 @@ extern const char* bonesVertex;
 const char* bonesVertex
   = R"ShaderCode(
 
+#ifndef BAKED_VERTEX_ANIMATION_TEXTURE
 #if NUM_BONE_INFLUENCERS > 0
     mat4 influence;
 
@@ -65,6 +66,7 @@ const char* bonesVertex
 
     finalWorld = finalWorld * influence;
 #endif
+#endif
 
 )ShaderCode";
 
@@ -13,6 +13,9 @@ const char* instancesDeclaration
     attribute vec4 world1;
     attribute vec4 world2;
     attribute vec4 world3;
+    #ifdef THIN_INSTANCES
+        uniform mat4 world;
+    #endif
 #else
     uniform mat4 world;
 #endif
@@ -17,6 +17,7 @@ attribute vec3 position;
 #endif
 
 #include<bonesDeclaration>
+#include<bakedVertexAnimationDeclaration>
 
 #include<morphTargetsVertexGlobalDeclaration>
 #include<morphTargetsVertexDeclaration>[0..maxSimultaneousMorphTargets]
@@ -63,6 +64,7 @@ vec3 positionUpdated = position;
 
 #include<instancesVertex>
 #include<bonesVertex>
+#include<bakedVertexAnimation>
 
 vec4 worldPos = finalWorld * vec4(positionUpdated, 1.0);
 
@@ -33,6 +33,8 @@ Animatable::Animatable(Scene* scene, const IAnimatablePtr& iTarget, float iFromF
     , _scene{scene}
     , _weight{-1.f}
     , _syncRoot{nullptr}
+    , _isEvaluated{false}
+    , _stateChangedSinceEvaluation{false}
 {
   if (!animations.empty()) {
     appendAnimations(target, animations);
@@ -70,12 +72,14 @@ float Animatable::get_weight() const
 void Animatable::set_weight(float value)
 {
   if (stl_util::almost_equal(value, -1.f)) { // -1 is ok and means no weight
-    _weight = -1.f;
+    _weight                      = -1.f;
+    _stateChangedSinceEvaluation = true;
     return;
   }
 
   // Else weight must be in [0, 1] range
-  _weight = std::min(std::max(value, 0.f), 1.f);
+  _weight                      = std::min(std::max(value, 0.f), 1.f);
+  _stateChangedSinceEvaluation = true;
 }
 
 float Animatable::get_speedRatio() const
@@ -88,7 +92,8 @@ void Animatable::set_speedRatio(float value)
   for (const auto& animation : _runtimeAnimations) {
     animation->_prepareForSpeedRatioChange(value);
   }
-  _speedRatio = value;
+  _speedRatio                  = value;
+  _stateChangedSinceEvaluation = true;
 }
 
 // Methods
@@ -159,8 +164,9 @@ void Animatable::reset()
     runtimeAnimation->reset(true);
   }
 
-  _localDelayOffset = std::nullopt;
-  _pausedDelay      = std::nullopt;
+  _localDelayOffset            = std::nullopt;
+  _pausedDelay                 = std::nullopt;
+  _stateChangedSinceEvaluation = true;
 }
 
 void Animatable::enableBlending(float blendingSpeed)
@@ -196,6 +202,7 @@ void Animatable::goToFrame(float frame)
   for (const auto& runtimeAnimations : _runtimeAnimations) {
     runtimeAnimations->goToFrame(frame);
   }
+  _stateChangedSinceEvaluation = true;
 }
 
 void Animatable::pause()
@@ -203,12 +210,14 @@ void Animatable::pause()
   if (_paused) {
     return;
   }
-  _paused = true;
+  _paused                      = true;
+  _stateChangedSinceEvaluation = true;
 }
 
 void Animatable::restart()
 {
-  _paused = false;
+  _paused                      = false;
+  _stateChangedSinceEvaluation = true;
 }
 
 void Animatable::_raiseOnAnimationEnd()
@@ -223,6 +232,7 @@ void Animatable::_raiseOnAnimationEnd()
 void Animatable::stop(const std::string& animationName,
                       const std::function<bool(IAnimatable* target)>& targetMask)
 {
+  _stateChangedSinceEvaluation = true;
   if (!animationName.empty() || targetMask) {
     auto idx = stl_util::index_of_ptr(_scene->_activeAnimatables, this);
     if (idx > -1) {
@@ -256,14 +266,14 @@ void Animatable::stop(const std::string& animationName,
   }
 }
 
-bool Animatable::_animate(const millisecond_t& delay)
+bool Animatable::_updateDelays(const millisecond_t& delay)
 {
   if (_paused) {
     animationStarted = false;
     if (_pausedDelay == std::nullopt) {
       _pausedDelay = delay;
     }
-    return true;
+    return false;
   }
 
   if (_localDelayOffset == std::nullopt) {
@@ -275,8 +285,13 @@ bool Animatable::_animate(const millisecond_t& delay)
     _pausedDelay      = std::nullopt;
   }
 
-  if (_weight == 0.f) { // We consider that an animation with a weight === 0 is
-                        // "actively" paused
+  // We consider that an animation with a weight === 0 is "actively" paused
+  return _weight != 0.f;
+}
+
+bool Animatable::_animate(const millisecond_t& delay)
+{
+  if (!_updateDelays(delay)) {
     return true;
   }
 
@@ -290,6 +305,72 @@ bool Animatable::_animate(const millisecond_t& delay)
     running = running || isRunning;
   }
 
+  return _endAnimate(running);
+}
+
+bool Animatable::_prepareConcurrentEvaluation()
+{
+  if (_syncRoot) {
+    return false;
+  }
+
+  auto concurrent = true;
+  for (const auto& runtimeAnimation : _runtimeAnimations) {
+    concurrent = runtimeAnimation->_prepareConcurrentEvaluation() && concurrent;
+  }
+  return concurrent;
+}
+
+void Animatable::_evaluate(const millisecond_t& delay)
+{
+  _evaluationDelay             = delay;
+  _stateChangedSinceEvaluation = false;
+  _isEvaluated                 = _updateDelays(delay);
+  if (!_isEvaluated) {
+    return;
+  }
+
+  for (const auto& animation : _runtimeAnimations) {
+    animation->_evaluate(delay - (*_localDelayOffset), static_cast<float>(fromFrame),
+                         static_cast<float>(toFrame), loopAnimation, speedRatio());
+  }
+}
+
+bool Animatable::_applyEvaluation()
+{
+  // Paused, restarted, stopped, moved or slowed down by the callback of a
+  // previous animatable: animated as if it was not evaluated beforehand
+  if (_stateChangedSinceEvaluation) {
+    _isEvaluated = false;
+    for (const auto& animation : _runtimeAnimations) {
+      animation->_discardEvaluation();
+    }
+    return _animate(_evaluationDelay);
+  }
+
+  if (!_isEvaluated) {
+    return true;
+  }
+  _isEvaluated = false;
+
+  auto running = false;
+
+  for (const auto& animation : _runtimeAnimations) {
+    // Animations appended by a callback since the evaluation are animated now
+    auto isRunning = animation->_hasPendingEvaluation() ?
+                       animation->_applyEvaluation(_weight) :
+                       animation->animate(_evaluationDelay - (*_localDelayOffset),
+                                          static_cast<float>(fromFrame),
+                                          static_cast<float>(toFrame), loopAnimation,
+                                          speedRatio(), _weight);
+    running = running || isRunning;
+  }
+
+  return _endAnimate(running);
+}
+
+bool Animatable::_endAnimate(bool running)
+{
   animationStarted = running;
 
   if (!running) {
@@ -20,8 +20,95 @@
 #include <babylon/misc/string_tools.h>
 #include <babylon/misc/tools.h>
 
+#include <type_traits>
+
 namespace BABYLON {
 
+namespace {
+
+/**
+ * @brief Interpolates the values of the segment [key, key + 1] of a key track.
+ */
+template <typename T>
+T InterpolateSegment(const Animation& animation, const AnimationKeyTrack& track, size_t key,
+                     float gradient)
+{
+  const auto& values     = track.get<T>();
+  const auto& startValue = values.values[key];
+  const auto& endValue   = values.values[key + 1];
+
+  if constexpr (std::is_same_v<T, Size>) {
+    return animation.sizeInterpolateFunction(startValue, endValue, gradient);
+  }
+  else if constexpr (std::is_same_v<T, Color3>) {
+    return animation.color3InterpolateFunction(startValue, endValue, gradient);
+  }
+  else if constexpr (std::is_same_v<T, Color4>) {
+    return animation.color4InterpolateFunction(startValue, endValue, gradient);
+  }
+  else {
+    const auto useTangent = (track.flags[key] & AnimationKeyTrack::HasOutTangent)
+                            && (track.flags[key + 1] & AnimationKeyTrack::HasInTangent);
+    if (useTangent) {
+      const auto frameDelta = track.frames[key + 1] - track.frames[key];
+      const auto& outTangent = values.outTangents[key];
+      const auto& inTangent  = values.inTangents[key + 1];
+      if constexpr (std::is_same_v<T, float>) {
+        return animation.floatInterpolateFunctionWithTangents(
+          startValue, outTangent * frameDelta, endValue, inTangent * frameDelta, gradient);
+      }
+      else if constexpr (std::is_same_v<T, Quaternion>) {
+        return animation.quaternionInterpolateFunctionWithTangents(
+          startValue, outTangent.scale(frameDelta), endValue, inTangent.scale(frameDelta),
+          gradient);
+      }
+      else if constexpr (std::is_same_v<T, Vector3>) {
+        return animation.vector3InterpolateFunctionWithTangents(
+          startValue, outTangent.scale(frameDelta), endValue, inTangent.scale(frameDelta),
+          gradient);
+      }
+      else {
+        return animation.vector2InterpolateFunctionWithTangents(
+          startValue, outTangent.scale(frameDelta), endValue, inTangent.scale(frameDelta),
+          gradient);
+      }
+    }
+    if constexpr (std::is_same_v<T, float>) {
+      return animation.floatInterpolateFunction(startValue, endValue, gradient);
+    }
+    else if constexpr (std::is_same_v<T, Quaternion>) {
+      return animation.quaternionInterpolateFunction(startValue, endValue, gradient);
+    }
+    else if constexpr (std::is_same_v<T, Vector3>) {
+      return animation.vector3InterpolateFunction(startValue, endValue, gradient);
+    }
+    else {
+      return animation.vector2InterpolateFunction(startValue, endValue, gradient);
+    }
+  }
+}
+
+/**
+ * @brief Adds the offset of the repeated cycles to an interpolated value in the
+ * relative loop mode.
+ */
+template <typename T>
+AnimationValue ApplyLoopMode(const T& value, const _IAnimationState& state)
+{
+  if (state.loopMode != Animation::ANIMATIONLOOPMODE_RELATIVE) {
+    return AnimationValue(value);
+  }
+  const auto repeatCount = static_cast<float>(state.repeatCount);
+  if constexpr (std::is_same_v<T, float>) {
+    return AnimationValue(state.offsetValue.get<float>() * repeatCount + value);
+  }
+  else {
+    return AnimationValue(value.add(state.offsetValue.get<T>().scale(repeatCount)));
+  }
+}
+
+} // end of anonymous namespace
+
 bool Animation::_AllowMatricesInterpolation = false;
 
 bool Animation::_AllowMatrixDecomposeForInterpolation = true;
@@ -246,6 +333,7 @@ void Animation::deleteRange(const std::string& iName, bool deleteFrames)
       stl_util::erase_remove_if(_keys, [from, to](const IAnimationKey& key) {
         return key.frame >= from && key.frame <= to;
       });
+      _keyTrackIsDirty = true;
     }
     _ranges.erase(iName);
   }
@@ -258,6 +346,8 @@ AnimationRange& Animation::getRange(const std::string& iName)
 
 std::vector<IAnimationKey>& Animation::getKeys()
 {
+  // The keys can be modified through the returned reference
+  _keyTrackIsDirty = true;
   return _keys;
 }
 
@@ -369,231 +459,64 @@ AnimationValue Animation::_interpolate(float currentFrame, _IAnimationState& sta
     return state.highLimitValue.copy();
   }
 
+  _updateKeyTrack();
+
   auto& keys = _keys;
   if (keys.size() == 1) {
     return _getKeyValue(keys[0].value);
   }
 
-#if 1
-  // Try to get a hash to find the right key
-  int _keysLength = static_cast<int>(keys.size());
-  int startKeyIndex
-    = std::max(0, std::min(_keysLength - 1,
-                           static_cast<int>(std::floor(_keysLength * (currentFrame - keys[0].frame)
-                                                       / (keys.back().frame - keys[0].frame))
-                                            - 1)));
-#else
-  auto startKeyIndex = state.key;
-#endif
-
-  if (keys[static_cast<unsigned int>(startKeyIndex)].frame >= currentFrame) {
-    while (startKeyIndex - 1 >= 0
-           && keys[static_cast<unsigned int>(startKeyIndex)].frame >= currentFrame) {
-      --startKeyIndex;
-    }
+  const auto& frames = _keyTrack.frames;
+  if (currentFrame > frames.back()) {
+    return _getKeyValue(keys.back().value);
   }
 
-  for (auto key = static_cast<size_t>(startKeyIndex); key < keys.size(); ++key) {
-    const auto& endKey = keys[key + 1];
-
-    if (endKey.frame >= currentFrame) {
-
-      state.key            = static_cast<int>(key);
-      const auto& startKey = keys[key];
-      auto startValue      = _getKeyValue(startKey.value);
-      if ((*startKey.interpolation).animationType().has_value()
-          && (*startKey.interpolation).animationType().value()
-               == static_cast<unsigned>(AnimationKeyInterpolation::STEP)) {
-        return startValue;
-      }
-      auto endValue = _getKeyValue(endKey.value);
+  // The state keeps the segment of the previous frame
+  const auto key = _keyTrack.findSegment(currentFrame, state.key);
+  if (!_keyTrack.typed || (_keyTrack.flags[key] & AnimationKeyTrack::Step)) {
+    return _getKeyValue(keys[key].value);
+  }
 
-      bool useTangent  = startKey.outTangent && endKey.inTangent;
-      float frameDelta = endKey.frame - startKey.frame;
+  // gradient : percent of currentFrame between the frame inf and the frame sup
+  const auto frameDelta = frames[key + 1] - frames[key];
+  auto gradient         = (currentFrame - frames[key]) / frameDelta;
 
-      // gradient : percent of currentFrame between the frame inf and the frame sup
-      float gradient = (currentFrame - startKey.frame) / frameDelta;
+  // check for easingFunction and correction of gradient
+  const auto& easingFunction = _easingFunction;
+  if (easingFunction != nullptr) {
+    gradient = easingFunction->ease(gradient);
+  }
 
-      // check for easingFunction and correction of gradient
-      auto easingFunction = getEasingFunction();
-      if (easingFunction != nullptr) {
-        gradient = easingFunction->ease(gradient);
+  switch (dataType) {
+    case Animation::ANIMATIONTYPE_FLOAT:
+      return ApplyLoopMode(InterpolateSegment<float>(*this, _keyTrack, key, gradient), state);
+    case Animation::ANIMATIONTYPE_QUATERNION:
+      return ApplyLoopMode(InterpolateSegment<Quaternion>(*this, _keyTrack, key, gradient), state);
+    case Animation::ANIMATIONTYPE_VECTOR3:
+      return ApplyLoopMode(InterpolateSegment<Vector3>(*this, _keyTrack, key, gradient), state);
+    case Animation::ANIMATIONTYPE_VECTOR2:
+      return ApplyLoopMode(InterpolateSegment<Vector2>(*this, _keyTrack, key, gradient), state);
+    case Animation::ANIMATIONTYPE_SIZE:
+      return ApplyLoopMode(InterpolateSegment<Size>(*this, _keyTrack, key, gradient), state);
+    case Animation::ANIMATIONTYPE_COLOR3:
+      return ApplyLoopMode(InterpolateSegment<Color3>(*this, _keyTrack, key, gradient), state);
+    case Animation::ANIMATIONTYPE_COLOR4:
+      return ApplyLoopMode(InterpolateSegment<Color4>(*this, _keyTrack, key, gradient), state);
+    case Animation::ANIMATIONTYPE_MATRIX: {
+      auto& matrices = _keyTrack.get<Matrix>().values;
+      if (state.loopMode != Animation::ANIMATIONLOOPMODE_RELATIVE
+          && Animation::AllowMatricesInterpolation() && state.workValue) {
+        // Interpolated in place in the work value of the state
+        auto& workValue = state.workValue->get<Matrix>();
+        matrixInterpolateFunction(matrices[key], matrices[key + 1], gradient, workValue);
+        return *state.workValue;
       }
-
-      auto newVale = keys[key].value.copy();
-
-      switch (dataType) {
-        // Float
-        case Animation::ANIMATIONTYPE_FLOAT: {
-          const auto floatValue
-            = useTangent ?
-                floatInterpolateFunctionWithTangents(
-                  startValue.get<float>(), *startKey.outTangent * frameDelta, endValue.get<float>(),
-                  *endKey.inTangent * frameDelta, gradient) :
-                floatInterpolateFunction(startValue.get<float>(), endValue.get<float>(), gradient);
-          switch (state.loopMode.value()) {
-            case Animation::ANIMATIONLOOPMODE_CYCLE:
-            case Animation::ANIMATIONLOOPMODE_CONSTANT:
-              newVale = floatValue;
-              return newVale;
-            case Animation::ANIMATIONLOOPMODE_RELATIVE:
-              newVale = state.offsetValue.get<float>() * state.repeatCount + floatValue;
-              return newVale;
-            default:
-              break;
-          }
-        } break;
-        // Quaternion
-        case Animation::ANIMATIONTYPE_QUATERNION: {
-          const auto quatValue
-            = useTangent ? quaternionInterpolateFunctionWithTangents(
-                startValue.get<Quaternion>(),
-                (*startKey.outTangent).get<Quaternion>().scale(frameDelta),
-                endValue.get<Quaternion>(), (*endKey.inTangent).get<Quaternion>().scale(frameDelta),
-                gradient) :
-                           quaternionInterpolateFunction(startValue.get<Quaternion>(),
-                                                         endValue.get<Quaternion>(), gradient);
-          switch (state.loopMode.value()) {
-            case Animation::ANIMATIONLOOPMODE_CYCLE:
-            case Animation::ANIMATIONLOOPMODE_CONSTANT:
-              newVale = quatValue;
-              return newVale;
-            case Animation::ANIMATIONLOOPMODE_RELATIVE:
-              newVale = quatValue.add(
-                state.offsetValue.get<Quaternion>().scale(static_cast<float>(state.repeatCount)));
-              return newVale;
-            default:
-              break;
-          }
-        } break;
-        // Vector3
-        case Animation::ANIMATIONTYPE_VECTOR3: {
-          const auto vec3Value
-            = useTangent ? vector3InterpolateFunctionWithTangents(
-                startValue.get<Vector3>(), (*startKey.outTangent).get<Vector3>().scale(frameDelta),
-                endValue.get<Vector3>(), (*endKey.inTangent).get<Vector3>().scale(frameDelta),
-                gradient) :
-                           vector3InterpolateFunction(startValue.get<Vector3>(),
-                                                      endValue.get<Vector3>(), gradient);
-          switch (state.loopMode.value()) {
-            case Animation::ANIMATIONLOOPMODE_CYCLE:
-            case Animation::ANIMATIONLOOPMODE_CONSTANT:
-              newVale = vec3Value;
-              return newVale;
-            case Animation::ANIMATIONLOOPMODE_RELATIVE:
-              newVale = vec3Value.add(
-                state.offsetValue.get<Vector3>().scale(static_cast<float>(state.repeatCount)));
-              return newVale;
-            default:
-              break;
-          }
-        } break;
-        // Vector2
-        case Animation::ANIMATIONTYPE_VECTOR2: {
-          const auto vec2Value
-            = useTangent ? vector2InterpolateFunctionWithTangents(
-                startValue.get<Vector2>(), (*startKey.outTangent).get<Vector2>().scale(frameDelta),
-                endValue.get<Vector2>(), (*endKey.inTangent).get<Vector2>().scale(frameDelta),
-                gradient) :
-                           vector2InterpolateFunction(startValue.get<Vector2>(),
-                                                      endValue.get<Vector2>(), gradient);
-          switch (state.loopMode.value()) {
-            case Animation::ANIMATIONLOOPMODE_CYCLE:
-            case Animation::ANIMATIONLOOPMODE_CONSTANT:
-              newVale = vec2Value;
-              return newVale;
-            case Animation::ANIMATIONLOOPMODE_RELATIVE:
-              newVale = vec2Value.add(
-                state.offsetValue.get<Vector2>().scale(static_cast<float>(state.repeatCount)));
-              return newVale;
-            default:
-              break;
-          }
-        } break;
-        // Size
-        case Animation::ANIMATIONTYPE_SIZE:
-          switch (state.loopMode.value()) {
-            case Animation::ANIMATIONLOOPMODE_CYCLE:
-            case Animation::ANIMATIONLOOPMODE_CONSTANT:
-              newVale
-                = sizeInterpolateFunction(startValue.get<Size>(), endValue.get<Size>(), gradient);
-              return newVale;
-            case Animation::ANIMATIONLOOPMODE_RELATIVE:
-              newVale
-                = sizeInterpolateFunction(startValue.get<Size>(), endValue.get<Size>(), gradient)
-                    .add(
-                      state.offsetValue.get<Size>().scale(static_cast<float>(state.repeatCount)));
-              return newVale;
-            default:
-              break;
-          }
-          break;
-        // Color3
-        case Animation::ANIMATIONTYPE_COLOR3:
-          switch (state.loopMode.value()) {
-            case Animation::ANIMATIONLOOPMODE_CYCLE:
-            case Animation::ANIMATIONLOOPMODE_CONSTANT:
-              newVale = color3InterpolateFunction(startValue.get<Color3>(), endValue.get<Color3>(),
-                                                  gradient);
-              return newVale;
-            case Animation::ANIMATIONLOOPMODE_RELATIVE:
-              newVale = color3InterpolateFunction(startValue.get<Color3>(), endValue.get<Color3>(),
-                                                  gradient)
-                          .add(state.offsetValue.get<Color3>().scale(
-                            static_cast<float>(state.repeatCount)));
-              return newVale;
-            default:
-              break;
-          }
-          break;
-        // Color4
-        case Animation::ANIMATIONTYPE_COLOR4:
-          switch (state.loopMode.value()) {
-            case Animation::ANIMATIONLOOPMODE_CYCLE:
-            case Animation::ANIMATIONLOOPMODE_CONSTANT:
-              newVale = color4InterpolateFunction(startValue.get<Color4>(), endValue.get<Color4>(),
-                                                  gradient);
-              return newVale;
-            case Animation::ANIMATIONLOOPMODE_RELATIVE:
-              newVale = color4InterpolateFunction(startValue.get<Color4>(), endValue.get<Color4>(),
-                                                  gradient)
-                          .add(state.offsetValue.get<Color4>().scale(
-                            static_cast<float>(state.repeatCount)));
-              return newVale;
-            default:
-              break;
-          }
-          break;
-        // Matrix
-        case Animation::ANIMATIONTYPE_MATRIX:
-          switch (state.loopMode.value()) {
-            case Animation::ANIMATIONLOOPMODE_CYCLE:
-            case Animation::ANIMATIONLOOPMODE_CONSTANT:
-              if (Animation::AllowMatricesInterpolation()) {
-                if (state.workValue) {
-                  auto& _workValue = *state.workValue;
-                  newVale
-                    = matrixInterpolateFunction(startValue.get<Matrix>(), endValue.get<Matrix>(),
-                                                gradient, _workValue.get<Matrix>());
-                  state.workValue = _workValue;
-                }
-                return newVale;
-              }
-              newVale = startValue.get<Matrix>();
-              return newVale;
-            case Animation::ANIMATIONLOOPMODE_RELATIVE:
-              newVale = startValue.get<Matrix>();
-              return newVale;
-            default:
-              break;
-          }
-          break;
-        default:
-          break;
-      }
-      break;
+      return AnimationValue(matrices[key]);
     }
+    default:
+      break;
   }
+
   return _getKeyValue(keys.back().value);
 }
 
@@ -641,7 +564,16 @@ AnimationPtr Animation::clone() const
 
 void Animation::setKeys(const std::vector<IAnimationKey>& values)
 {
-  _keys = values;
+  _keys            = values;
+  _keyTrackIsDirty = true;
+}
+
+void Animation::_updateKeyTrack()
+{
+  if (_keyTrackIsDirty || _keyTrack.dataType != static_cast<unsigned int>(dataType)) {
+    _keyTrack.build(_keys, static_cast<unsigned int>(dataType));
+    _keyTrackIsDirty = false;
+  }
 }
 
 json Animation::serialize() const
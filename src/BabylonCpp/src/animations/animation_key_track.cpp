@@ -0,0 +1,210 @@
+#include <babylon/animations/animation_key_track.h>
+
+#include <algorithm>
+#include <type_traits>
+
+#include <babylon/animations/animation.h>
+#include <babylon/animations/ianimation_key.h>
+#include <babylon/babylon_enums.h>
+
+namespace BABYLON {
+
+namespace {
+
+/**
+ * @brief Returns the animation type of the values of a type.
+ */
+template <typename T>
+constexpr unsigned int ValueType()
+{
+  if constexpr (std::is_same_v<T, float>) {
+    return Animation::ANIMATIONTYPE_FLOAT;
+  }
+  else if constexpr (std::is_same_v<T, Vector2>) {
+    return Animation::ANIMATIONTYPE_VECTOR2;
+  }
+  else if constexpr (std::is_same_v<T, Vector3>) {
+    return Animation::ANIMATIONTYPE_VECTOR3;
+  }
+  else if constexpr (std::is_same_v<T, Quaternion>) {
+    return Animation::ANIMATIONTYPE_QUATERNION;
+  }
+  else if constexpr (std::is_same_v<T, Size>) {
+    return Animation::ANIMATIONTYPE_SIZE;
+  }
+  else if constexpr (std::is_same_v<T, Color3>) {
+    return Animation::ANIMATIONTYPE_COLOR3;
+  }
+  else if constexpr (std::is_same_v<T, Color4>) {
+    return Animation::ANIMATIONTYPE_COLOR4;
+  }
+  else {
+    return Animation::ANIMATIONTYPE_MATRIX;
+  }
+}
+
+/**
+ * @brief Reads a value of a type, integers are accepted for floats.
+ */
+template <typename T>
+bool ReadValue(const AnimationValue& value, T& result)
+{
+  const auto type = value.animationType();
+  if (!type.has_value()) {
+    return false;
+  }
+  if constexpr (std::is_same_v<T, float>) {
+    if (*type == Animation::ANIMATIONTYPE_INT) {
+      result = static_cast<float>(value.get<int>());
+      return true;
+    }
+  }
+  if (*type != ValueType<T>()) {
+    return false;
+  }
+  result = value.get<T>();
+  return true;
+}
+
+/**
+ * @brief Returns whether a key holds its value until the next key.
+ */
+bool IsStepKey(const IAnimationKey& key)
+{
+  if (!key.interpolation.has_value()) {
+    return false;
+  }
+  const auto& interpolation = *key.interpolation;
+  const auto type           = interpolation.animationType();
+  const auto step           = static_cast<int>(AnimationKeyInterpolation::STEP);
+  if (type == Animation::ANIMATIONTYPE_INT) {
+    return interpolation.get<int>() == step;
+  }
+  if (type == Animation::ANIMATIONTYPE_FLOAT) {
+    return interpolation.get<float>() == static_cast<float>(step);
+  }
+  return false;
+}
+
+/**
+ * @brief Fills the typed values of a track, with the tangents when the type
+ * supports them.
+ * @returns whether all the values and tangents are of the requested type
+ */
+template <typename T, bool WithTangents>
+bool FillValues(const std::vector<IAnimationKey>& keys, std::vector<uint8_t>& flags,
+                AnimationKeyTrack::Values<T>& values)
+{
+  values.values.resize(keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    if (!ReadValue(keys[i].value, values.values[i])) {
+      return false;
+    }
+  }
+
+  if constexpr (WithTangents) {
+    const auto hasTangents = std::any_of(keys.begin(), keys.end(), [](const IAnimationKey& key) {
+      return key.inTangent.has_value() || key.outTangent.has_value();
+    });
+    if (!hasTangents) {
+      return true;
+    }
+    values.inTangents.resize(keys.size());
+    values.outTangents.resize(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+      const auto& key = keys[i];
+      if (key.inTangent.has_value()) {
+        if (!ReadValue(*key.inTangent, values.inTangents[i])) {
+          return false;
+        }
+        flags[i] |= AnimationKeyTrack::HasInTangent;
+      }
+      if (key.outTangent.has_value()) {
+        if (!ReadValue(*key.outTangent, values.outTangents[i])) {
+          return false;
+        }
+        flags[i] |= AnimationKeyTrack::HasOutTangent;
+      }
+    }
+  }
+
+  return true;
+}
+
+} // end of anonymous namespace
+
+void AnimationKeyTrack::build(const std::vector<IAnimationKey>& keys, unsigned int iDataType)
+{
+  dataType = iDataType;
+  frames.resize(keys.size());
+  flags.resize(keys.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    frames[i] = keys[i].frame;
+    flags[i]  = IsStepKey(keys[i]) ? Step : 0;
+  }
+
+  std::apply(
+    [](auto&... values) {
+      ((values.values.clear(), values.inTangents.clear(), values.outTangents.clear()), ...);
+    },
+    _values);
+
+  auto& [floats, vector2s, vector3s, quaternions, sizes, color3s, color4s, matrices] = _values;
+  switch (dataType) {
+    case Animation::ANIMATIONTYPE_FLOAT:
+      typed = FillValues<float, true>(keys, flags, floats);
+      break;
+    case Animation::ANIMATIONTYPE_VECTOR2:
+      typed = FillValues<Vector2, true>(keys, flags, vector2s);
+      break;
+    case Animation::ANIMATIONTYPE_VECTOR3:
+      typed = FillValues<Vector3, true>(keys, flags, vector3s);
+      break;
+    case Animation::ANIMATIONTYPE_QUATERNION:
+      typed = FillValues<Quaternion, true>(keys, flags, quaternions);
+      break;
+    case Animation::ANIMATIONTYPE_SIZE:
+      typed = FillValues<Size, false>(keys, flags, sizes);
+      break;
+    case Animation::ANIMATIONTYPE_COLOR3:
+      typed = FillValues<Color3, false>(keys, flags, color3s);
+      break;
+    case Animation::ANIMATIONTYPE_COLOR4:
+      typed = FillValues<Color4, false>(keys, flags, color4s);
+      break;
+    case Animation::ANIMATIONTYPE_MATRIX:
+      typed = FillValues<Matrix, false>(keys, flags, matrices);
+      break;
+    default:
+      typed = false;
+      break;
+  }
+}
+
+size_t AnimationKeyTrack::findSegment(float frame, int& cursor) const
+{
+  const auto lastSegment = frames.size() - 2;
+  const auto isSegment   = [this, frame](size_t key) {
+    return frames[key + 1] >= frame && (key == 0 || frames[key] < frame);
+  };
+
+  // Playback moves forward, most lookups stay in the same segment or enter the
+  // next one
+  auto key = static_cast<size_t>(std::max(cursor, 0));
+  if (key > lastSegment || !isSegment(key)) {
+    if (key < lastSegment && isSegment(key + 1)) {
+      ++key;
+    }
+    else {
+      // Seek: first key after the start one with a frame greater or equal to
+      // the requested one
+      const auto end = std::lower_bound(frames.begin() + 1, frames.end(), frame);
+      key = std::min(static_cast<size_t>(end - frames.begin()), frames.size() - 1) - 1;
+    }
+  }
+
+  cursor = static_cast<int>(key);
+  return key;
+}
+
+} // end of namespace BABYLON
@@ -10,6 +10,9 @@
 #include <babylon/animations/ianimatable.h>
 #include <babylon/animations/ianimation_key.h>
 #include <babylon/babylon_stl_util.h>
+#include <babylon/bones/bone.h>
+#include <babylon/meshes/transform_node.h>
+#include <babylon/morph/morph_target.h>
 
 namespace BABYLON {
 
@@ -73,6 +76,7 @@ RuntimeAnimation::RuntimeAnimation(const IAnimatablePtr& iTarget, const Animatio
     _getOriginalValues();
     _targetIsArray = false;
     _directTarget  = _activeTargets[0];
+    _bindProperty(_directTarget);
   }
 
   // Cloning events locally
@@ -143,6 +147,114 @@ void RuntimeAnimation::_preparePath(const IAnimatablePtr& iTarget, unsigned int
   }
 }
 
+void RuntimeAnimation::_bindProperty(const IAnimatablePtr& iTarget)
+{
+  using Kind = PropertyBinding::Kind;
+
+  _binding = PropertyBinding{};
+
+  const auto& targetPropertyPath = _animation->targetPropertyPath;
+  if (!iTarget || targetPropertyPath.empty() || targetPropertyPath.size() > 2) {
+    return;
+  }
+
+  const auto dataType  = static_cast<unsigned int>(_animation->dataType);
+  const auto& property = targetPropertyPath[0];
+  auto kind            = Kind::None;
+  if (auto transformNode = std::dynamic_pointer_cast<TransformNode>(iTarget)) {
+    if (targetPropertyPath.size() == 1) {
+      if (dataType == Animation::ANIMATIONTYPE_VECTOR3) {
+        kind = property == "position" ? Kind::Position :
+               property == "rotation" ? Kind::Rotation :
+               property == "scaling"  ? Kind::Scaling :
+                                        Kind::None;
+      }
+      else if (dataType == Animation::ANIMATIONTYPE_QUATERNION
+               && property == "rotationQuaternion") {
+        kind = Kind::RotationQuaternion;
+      }
+    }
+    else if (dataType == Animation::ANIMATIONTYPE_FLOAT) {
+      const auto& key    = targetPropertyPath[1];
+      _binding.component = key == "x" ? &Vector3::x :
+                           key == "y" ? &Vector3::y :
+                           key == "z" ? &Vector3::z :
+                                        nullptr;
+      if (_binding.component) {
+        kind = property == "position" ? Kind::PositionComponent :
+               property == "rotation" ? Kind::RotationComponent :
+               property == "scaling"  ? Kind::ScalingComponent :
+                                        Kind::None;
+      }
+    }
+    _binding.transformNode = transformNode.get();
+  }
+  else if (auto bone = std::dynamic_pointer_cast<Bone>(iTarget)) {
+    if (targetPropertyPath.size() == 1 && dataType == Animation::ANIMATIONTYPE_MATRIX
+        && property == "_matrix") {
+      kind          = Kind::BoneMatrix;
+      _binding.bone = bone.get();
+    }
+  }
+  else if (auto morphTarget = std::dynamic_pointer_cast<MorphTarget>(iTarget)) {
+    if (targetPropertyPath.size() == 1 && dataType == Animation::ANIMATIONTYPE_FLOAT
+        && property == "influence") {
+      kind                 = Kind::MorphTargetInfluence;
+      _binding.morphTarget = morphTarget.get();
+    }
+  }
+
+  if (kind == Kind::None) {
+    _binding = PropertyBinding{};
+    return;
+  }
+  _binding.kind     = kind;
+  _binding.dataType = dataType;
+}
+
+bool RuntimeAnimation::_applyBinding(const AnimationValue& value) const
+{
+  using Kind = PropertyBinding::Kind;
+
+  // Values of another type (e.g. an unset original value) keep the generic path
+  if (_binding.kind == Kind::None || value.animationType() != _binding.dataType) {
+    return false;
+  }
+
+  switch (_binding.kind) {
+    case Kind::Position:
+      _binding.transformNode->position = value.get<Vector3>();
+      break;
+    case Kind::Rotation:
+      _binding.transformNode->rotation = value.get<Vector3>();
+      break;
+    case Kind::RotationQuaternion:
+      _binding.transformNode->rotationQuaternion = value.get<Quaternion>();
+      break;
+    case Kind::Scaling:
+      _binding.transformNode->scaling = value.get<Vector3>();
+      break;
+    case Kind::PositionComponent:
+      _binding.transformNode->position().*_binding.component = value.get<float>();
+      break;
+    case Kind::RotationComponent:
+      _binding.transformNode->rotation().*_binding.component = value.get<float>();
+      break;
+    case Kind::ScalingComponent:
+      _binding.transformNode->scaling().*_binding.component = value.get<float>();
+      break;
+    case Kind::BoneMatrix:
+      _binding.bone->_matrix = value.get<Matrix>();
+      break;
+    case Kind::MorphTargetInfluence:
+      _binding.morphTarget->influence = value.get<float>();
+      break;
+    default:
+      return false;
+  }
+  return true;
+}
+
 AnimationPtr& RuntimeAnimation::animation()
 {
   return _animation;
@@ -236,7 +348,8 @@ void RuntimeAnimation::_setValue(const IAnimatablePtr& iTarget, const IAnimatabl
   if (!stl_util::almost_equal(iWeight, -1.f)) {
   }
   else {
-    if (_currentValue.has_value()) {
+    if (_currentValue.has_value()
+        && (destination != _directTarget || !_applyBinding(*_currentValue))) {
       const auto& targetPropertyPath = _animation->targetPropertyPath;
       destination->setProperty(targetPropertyPath, _currentValue.value());
     }
@@ -258,13 +371,11 @@ std::optional<unsigned int> RuntimeAnimation::_getCorrectLoopMode() const
 
 void RuntimeAnimation::goToFrame(float frame)
 {
-  auto& keys = _animation->getKeys();
-
-  if (frame < keys[0].frame) {
-    frame = keys[0].frame;
+  if (frame < _minFrame) {
+    frame = _minFrame;
   }
-  else if (frame > keys.back().frame) {
-    frame = keys.back().frame;
+  else if (frame > _maxFrame) {
+    frame = _maxFrame;
   }
 
   // Need to reset animation events
@@ -293,13 +404,36 @@ void RuntimeAnimation::_prepareForSpeedRatioChange(float newSpeedRatio)
 bool RuntimeAnimation::animate(millisecond_t delay, float from, float to, bool loop,
                                float speedRatio, float iWeight)
 {
-  auto& animation                = *_animation;
-  const auto& targetPropertyPath = animation.targetPropertyPath;
-  if (targetPropertyPath.empty()) {
-    _stopped = true;
+  _evaluate(delay, from, to, loop, speedRatio);
+  return _applyEvaluation(iWeight);
+}
+
+bool RuntimeAnimation::_prepareConcurrentEvaluation()
+{
+  // Decomposed matrix interpolation uses the shared temporary math values
+  if (_animation->dataType == static_cast<int>(Animation::ANIMATIONTYPE_MATRIX)
+      && Animation::AllowMatricesInterpolation()
+      && Animation::AllowMatrixDecomposeForInterpolation()) {
     return false;
   }
 
+  // The key track of the animation, which can be shared by several runtime
+  // animations, must not be rebuilt by the workers
+  _animation->_updateKeyTrack();
+  return true;
+}
+
+void RuntimeAnimation::_evaluate(millisecond_t delay, float from, float to, bool loop,
+                                 float speedRatio)
+{
+  auto& animation      = *_animation;
+  auto& evaluation     = _evaluation;
+  evaluation.pending   = true;
+  evaluation.evaluated = !animation.targetPropertyPath.empty();
+  if (!evaluation.evaluated) {
+    return;
+  }
+
   auto returnValue = true;
 
   // Check limits
@@ -320,8 +454,8 @@ bool RuntimeAnimation::animate(millisecond_t delay, float from, float to, bool l
       + _ratioOffset;
   AnimationValue highLimitValue(0.f);
 
-  _previousDelay = delay;
-  _previousRatio = ratio;
+  evaluation.delay = delay;
+  evaluation.ratio = ratio;
 
   if (!loop && (to >= from && ratio >= range)) {
     // If we are out of range and not looping get back to caller
@@ -423,10 +557,49 @@ bool RuntimeAnimation::animate(millisecond_t delay, float from, float to, bool l
     iCurrentFrame = (returnValue && range != 0.f) ? from + std::fmod(ratio, range) : to;
   }
 
+  evaluation.looped = (range > 0.f && currentFrame > iCurrentFrame)
+                      || (range < 0.f && currentFrame < iCurrentFrame);
+  _animationState.repeatCount    = range == 0.f ? 0 : static_cast<int>(ratio / range) >> 0;
+  _animationState.highLimitValue = highLimitValue;
+  _animationState.offsetValue    = offsetValue;
+
+  evaluation.running = returnValue;
+  evaluation.from    = from;
+  evaluation.range   = range;
+  evaluation.frame   = iCurrentFrame;
+  evaluation.value   = animation._interpolate(iCurrentFrame, _animationState);
+}
+
+bool RuntimeAnimation::_hasPendingEvaluation() const
+{
+  return _evaluation.pending;
+}
+
+void RuntimeAnimation::_discardEvaluation()
+{
+  _evaluation.pending = false;
+}
+
+bool RuntimeAnimation::_applyEvaluation(float iWeight)
+{
+  auto& evaluation   = _evaluation;
+  evaluation.pending = false;
+  if (!evaluation.evaluated) {
+    _stopped = true;
+    return false;
+  }
+
+  _previousDelay = evaluation.delay;
+  _previousRatio = evaluation.ratio;
+  _currentFrame  = evaluation.frame;
+
+  const auto from          = evaluation.from;
+  const auto range         = evaluation.range;
+  const auto iCurrentFrame = evaluation.frame;
+
   // Reset events if looping
   auto& events = _events;
-  if ((range > 0.f && currentFrame > iCurrentFrame)
-      || (range < 0.f && currentFrame < iCurrentFrame)) {
+  if (evaluation.looped) {
     _onLoop();
 
     // Need to reset animation events
@@ -439,15 +612,9 @@ bool RuntimeAnimation::animate(millisecond_t delay, float from, float to, bool l
       }
     }
   }
-  _currentFrame                  = iCurrentFrame;
-  _animationState.repeatCount    = range == 0.f ? 0 : static_cast<int>(ratio / range) >> 0;
-  _animationState.highLimitValue = highLimitValue;
-  _animationState.offsetValue    = offsetValue;
-
-  auto iCurrentValue = animation._interpolate(iCurrentFrame, _animationState);
 
   // Set value
-  setValue(iCurrentValue, iWeight);
+  setValue(evaluation.value, iWeight);
 
   // Check events
   if (!events.empty()) {
@@ -471,11 +638,11 @@ bool RuntimeAnimation::animate(millisecond_t delay, float from, float to, bool l
     }
   }
 
-  if (!returnValue) {
+  if (!evaluation.running) {
     _stopped = true;
   }
 
-  return returnValue;
+  return evaluation.running;
 }
 
 } // end of namespace BABYLON
@@ -3,30 +3,15 @@
 #include <babylon/asio/asio.h>
 #include <babylon/asio/internal/decode_data_uri.h>
 #include <babylon/asio/internal/file_loader_sync.h>
-#include <babylon/asio/internal/future_utils.h>
+#include <babylon/asio/internal/io_worker_pool.h>
 #include <babylon/core/filesystem.h>
 #include <babylon/asio/internal/sync_callback_runner.h>
 #include <babylon/misc/string_tools.h>
 #include <iostream>
 
-#if defined(__linux__) || defined(__APPLE__)
-#define CAN_NAME_THREAD
-#endif
-
-#ifdef CAN_NAME_THREAD
-  #include <pthread.h>
-  #ifdef __APPLE__
-    #define THIS_THREAD_SET_NAME(name)  pthread_setname_np(name)
-  #elif defined(__linux__)
-    #define THIS_THREAD_SET_NAME(name) pthread_setname_np(pthread_self(), name)
-  #endif
-#endif
-
-
-#include <future>
 #include <atomic>
-#include <chrono>
 #include <cassert>
+#include <memory>
 
 
 
@@ -37,108 +22,100 @@ using namespace sync_io_impl;
 
 using OnSuccessFunctionArrayBuffer            = std::function<void(const ArrayBuffer& data)>;
 
-using FutureArrayBufferOrErrorMessage = std::future<ArrayBufferOrErrorMessage>;
-
-
-
-struct FutureAndCallbacks {
-  OnSuccessFunctionArrayBuffer onSuccessFunctionArrayBuffer;
-  OnErrorFunction onErrorFunction;
-  FutureArrayBufferOrErrorMessage futureDataTypeOrErrorMessage;
-
-  std::optional<VoidCallback> shallCallNextCallback()
+template <typename DataType>
+static VoidCallback MakeCompletionCallback(std::variant<DataType, ErrorMessage>&& result,
+                                           const OnSuccessFunction<DataType>& onSuccessFunction,
+                                           const OnErrorFunction& onErrorFunction)
+{
+  VoidCallback nextCallback = EmptyVoidCallback;
+  if (std::holds_alternative<ErrorMessage>(result))
   {
-    auto status = get_future_running_status(futureDataTypeOrErrorMessage);
-    if (status != future_running_status::future_ready)
-      return std::nullopt;
-
-    ArrayBufferOrErrorMessage v = futureDataTypeOrErrorMessage.get();
-
-    VoidCallback nextCallback = EmptyVoidCallback;
-    if (std::holds_alternative<ErrorMessage>(v))
-    {
-      if (onErrorFunction)
-      {
-        const auto& errorMessage = std::get<ErrorMessage>(v);
-
-        auto onErrorFunctionCopy = this->onErrorFunction;
-        nextCallback = [errorMessage, onErrorFunctionCopy]() {
-          onErrorFunctionCopy(errorMessage.errorMessage);
-        };
-      }
-    }
-
-    if (std::holds_alternative<ArrayBuffer>(v))
+    if (onErrorFunction)
     {
-      if (onSuccessFunctionArrayBuffer)
-      {
-        const auto& data = std::get<ArrayBuffer>(v);
-
-        auto onSuccessFunctionCopy = this->onSuccessFunctionArrayBuffer;
-        nextCallback = [onSuccessFunctionCopy, data]() {
-          onSuccessFunctionCopy(data);
-        };
-      }
+      auto errorMessage = std::get<ErrorMessage>(std::move(result));
+      nextCallback = [errorMessage, onErrorFunction]() {
+        onErrorFunction(errorMessage.errorMessage);
+      };
     }
-    return nextCallback;
   }
-
-};
+  else if (onSuccessFunction)
+  {
+    auto data = std::make_shared<DataType>(std::get<DataType>(std::move(result)));
+    nextCallback = [onSuccessFunction, data]() {
+      onSuccessFunction(*data);
+    };
+  }
+  return nextCallback;
+}
 
 
 class AsyncLoadService {
 private:
   AsyncLoadService()
+      : mPool(IoWorkerPool::DefaultConcurrency())
   {
-    mStopRequested       = false;
-    mHasRunningIOTasks       = false;
-    mCheckIOCompletion_Async = really_async([this]() { this->CheckIOCompletion_AsyncProc(); });
+    mRunningIOTasks    = 0;
+    mCompletedIOTasks  = 0;
   }
   ~AsyncLoadService()
   {
-    // mStopRequested = true;
-  }
-  void CheckTasksStatus()
-  {
-    std::lock_guard<std::mutex> guard(mMutexRunningIOTasks);
-    std::vector<FutureAndCallbacks> stillRunningTasks;
-    for (auto& runningTask : mRunningIOTasks)
-    {
-      std::optional<VoidCallback> nextCallback = runningTask.shallCallNextCallback();
-      if (nextCallback.has_value())
-        sync_callback_runner::PushCallback(std::move(nextCallback.value()));
-      else
-        stillRunningTasks.emplace_back(std::move(runningTask));
-    }
-    mRunningIOTasks  = std::move(stillRunningTasks);
-    mHasRunningIOTasks = !mRunningIOTasks.empty();
-  }
-
-  void CheckIOCompletion_AsyncProc() // This will be called in a parallel thread
-  {
-    using namespace std::literals;
-#ifdef CAN_NAME_THREAD
-    THIS_THREAD_SET_NAME("asio: CheckIOCompletion");
-#endif
-    while (!mStopRequested) {
-      CheckTasksStatus();
-      std::this_thread::sleep_for(15ms);
-    }
+    mPool.stop();
   }
 
 public:
+  // The loader runs on one of the pool workers, which then pushes the
+  // completion callback straight into sync_callback_runner: no polling thread
+  // is involved between the end of the io and the callback availability.
   void LoadData(
     const SyncLoaderFunction& syncLoader,
     const OnSuccessFunctionArrayBuffer & onSuccessFunctionArrayBuffer,
-    const OnErrorFunction& onErrorFunction
+    const OnErrorFunction& onErrorFunction,
+    LoadPriority priority
   )
   {
-    std::lock_guard<std::mutex> guard(mMutexRunningIOTasks);
-    mHasRunningIOTasks = true;
-    FutureArrayBufferOrErrorMessage futureData = really_async(syncLoader);
-    FutureAndCallbacks payload{onSuccessFunctionArrayBuffer, onErrorFunction, std::move(futureData)};
+    auto ioJob = [syncLoader, onSuccessFunctionArrayBuffer, onErrorFunction]() {
+      return MakeCompletionCallback<ArrayBuffer>(syncLoader(), onSuccessFunctionArrayBuffer,
+                                                 onErrorFunction);
+    };
+    Submit(ioJob, onErrorFunction, priority);
+  }
+
+  void MapData(
+    const std::string& filename,
+    const OnSuccessFunction<ArrayBufferView>& onSuccessFunction,
+    const OnErrorFunction& onErrorFunction,
+    const OnProgressFunction& onProgressFunction,
+    LoadPriority priority
+  )
+  {
+    auto ioJob = [filename, onSuccessFunction, onErrorFunction, onProgressFunction]() {
+      return MakeCompletionCallback<ArrayBufferView>(
+        MapFileSync_Binary(filename, onProgressFunction), onSuccessFunction, onErrorFunction);
+    };
+    Submit(ioJob, onErrorFunction, priority);
+  }
 
-    mRunningIOTasks.emplace_back(std::move(payload));
+  // Runs ioJob on a pool worker and pushes the callback it returns. If the
+  // service is stopped before the job runs, the request fails instead.
+  void Submit(const std::function<VoidCallback()>& ioJob, const OnErrorFunction& onErrorFunction,
+              LoadPriority priority)
+  {
+    ++mRunningIOTasks;
+    auto job = [this, ioJob]() {
+      sync_callback_runner::PushCallback(ioJob());
+      ++mCompletedIOTasks;
+      --mRunningIOTasks;
+    };
+    auto onDropped = [this, onErrorFunction]() {
+      if (onErrorFunction) {
+        sync_callback_runner::PushCallback(
+          [onErrorFunction]() { onErrorFunction("The io service was stopped"); });
+      }
+      --mRunningIOTasks;
+    };
+    if (!mPool.submit(std::move(job), static_cast<int>(priority), onDropped)) {
+      onDropped();
+    }
   }
 
   static AsyncLoadService& Instance()
@@ -149,29 +126,39 @@ public:
 
   void WaitIoCompletion_Sync()
   {
-    using namespace std::literals;
-    while(mHasRunningIOTasks)
-      std::this_thread::sleep_for(50ms);
+    mPool.waitIdle();
   }
 
   bool HasRunningIOTasks()
   {
-    return mHasRunningIOTasks;
+    return mRunningIOTasks > 0;
   }
 
-  void Stop()
+  void SetConcurrency(size_t concurrency)
   {
-    mStopRequested = true;
+    mPool.setConcurrency(concurrency);
   }
 
-private:
-  std::vector<FutureAndCallbacks> mRunningIOTasks;
-  std::atomic<bool> mHasRunningIOTasks;
-  std::mutex mMutexRunningIOTasks;
+  IoServiceStats Stats()
+  {
+    IoServiceStats stats;
+    stats.concurrency       = mPool.concurrency();
+    stats.workerThreads     = mPool.workerThreadCount();
+    stats.peakWorkerThreads = mPool.peakWorkerThreadCount();
+    stats.pendingRequests   = mRunningIOTasks;
+    stats.completedRequests = mCompletedIOTasks;
+    return stats;
+  }
 
-  std::future<void> mCheckIOCompletion_Async;
-  std::atomic<bool> mStopRequested;
+  void Stop()
+  {
+    mPool.stop();
+  }
 
+private:
+  IoWorkerPool mPool;
+  std::atomic<size_t> mRunningIOTasks;
+  std::atomic<size_t> mCompletedIOTasks;
 };
 
 static std::string ArrayBufferToString(const ArrayBuffer & dataUint8)
@@ -199,22 +186,20 @@ void pop_HACK_DISABLE_ASYNC()
 void LoadFileAsync_Text(const std::string& filename,
                        const OnSuccessFunction<std::string>& onSuccessFunction,
                        const OnErrorFunction& onErrorFunction,
-                       const OnProgressFunction& onProgressFunction
+                       const OnProgressFunction& onProgressFunction,
+                       LoadPriority priority
                        )
 {
   if (HACK_DISABLE_ASYNC == 0)
   {
     auto& service   = AsyncLoadService::Instance();
     auto syncLoader = [filename, onProgressFunction]() {
-#ifdef CAN_NAME_THREAD
-      THIS_THREAD_SET_NAME("asio: LoadFileSync_Text");
-#endif
       return LoadFileSync_Binary(filename, onProgressFunction);
     };
     auto onSuccessFunctionArrayBuffer = [onSuccessFunction](const ArrayBuffer& dataUint8) {
       onSuccessFunction(ArrayBufferToString(dataUint8));
     };
-    service.LoadData(syncLoader, onSuccessFunctionArrayBuffer, onErrorFunction);
+    service.LoadData(syncLoader, onSuccessFunctionArrayBuffer, onErrorFunction, priority);
   }
   else
   {
@@ -237,18 +222,16 @@ void LoadFileAsync_Binary(
   const std::string& filename,
   const OnSuccessFunction<ArrayBuffer>& onSuccessFunction,
   const OnErrorFunction& onErrorFunction,
-  const OnProgressFunction& onProgressFunction
+  const OnProgressFunction& onProgressFunction,
+  LoadPriority priority
   )
 {
   if (HACK_DISABLE_ASYNC == 0) {
     auto & service = AsyncLoadService::Instance();
     auto syncLoader = [filename, onProgressFunction]() {
-#ifdef CAN_NAME_THREAD
-      THIS_THREAD_SET_NAME("asio: LoadFileSync_Binary");
-#endif
       return LoadFileSync_Binary(filename, onProgressFunction);
     };
-    service.LoadData(syncLoader, onSuccessFunction, onErrorFunction);
+    service.LoadData(syncLoader, onSuccessFunction, onErrorFunction, priority);
   }
   else
   {
@@ -264,15 +247,41 @@ void LoadFileAsync_Binary(
   }
 }
 
+void LoadFileAsync_MappedBinary(
+  const std::string& filename,
+  const OnSuccessFunction<ArrayBufferView>& onSuccessFunction,
+  const OnErrorFunction& onErrorFunction,
+  const OnProgressFunction& onProgressFunction,
+  LoadPriority priority
+  )
+{
+  if (HACK_DISABLE_ASYNC == 0) {
+    auto & service = AsyncLoadService::Instance();
+    service.MapData(filename, onSuccessFunction, onErrorFunction, onProgressFunction, priority);
+  }
+  else
+  {
+    ArrayBufferViewOrErrorMessage r = MapFileSync_Binary(filename, onProgressFunction);
+    if (std::holds_alternative<ErrorMessage>(r)) {
+      std::cout << "LoadFileAsync_MappedBinary hack error with " << filename << "\n";
+      onErrorFunction(std::get<ErrorMessage>(r).errorMessage);
+    }
+    else {
+      onSuccessFunction(std::get<ArrayBufferView>(r));
+    }
+  }
+}
+
 void LoadAssetAsync_Text(
   const std::string& assetPath,
                          const OnSuccessFunction<std::string>& onSuccessFunction,
   const OnErrorFunction& onErrorFunction,
-  const OnProgressFunction& onProgressFunction
+  const OnProgressFunction& onProgressFunction,
+  LoadPriority priority
 )
 {
   std::string filename = assets_folder() + assetPath;
-  LoadFileAsync_Text(filename, onSuccessFunction, onErrorFunction, onProgressFunction);
+  LoadFileAsync_Text(filename, onSuccessFunction, onErrorFunction, onProgressFunction, priority);
 }
 
 
@@ -280,7 +289,8 @@ void LoadAssetAsync_Binary(
   const std::string& assetPath,
   const std::function<void(const ArrayBuffer& data)>& onSuccessFunction,
   const OnErrorFunction& onErrorFunction,
-  const OnProgressFunction& onProgressFunction
+  const OnProgressFunction& onProgressFunction,
+  LoadPriority priority
 )
 {
   if (IsBase64JpgDataUri(assetPath)) {
@@ -289,7 +299,25 @@ void LoadAssetAsync_Binary(
   }
 
   std::string filename = assets_folder() + assetPath;
-  LoadFileAsync_Binary(filename, onSuccessFunction, onErrorFunction, onProgressFunction);
+  LoadFileAsync_Binary(filename, onSuccessFunction, onErrorFunction, onProgressFunction, priority);
+}
+
+void LoadAssetAsync_MappedBinary(
+  const std::string& assetPath,
+  const OnSuccessFunction<ArrayBufferView>& onSuccessFunction,
+  const OnErrorFunction& onErrorFunction,
+  const OnProgressFunction& onProgressFunction,
+  LoadPriority priority
+)
+{
+  if (IsBase64JpgDataUri(assetPath)) {
+    onSuccessFunction(ArrayBufferView(DecodeBase64JpgDataUri(assetPath)));
+    return;
+  }
+
+  std::string filename = assets_folder() + assetPath;
+  LoadFileAsync_MappedBinary(filename, onSuccessFunction, onErrorFunction, onProgressFunction,
+                             priority);
 }
 
 // Call this in the app's main loop: it will run the callbacks synchronously
@@ -299,6 +327,21 @@ void HeartBeat_Sync()
   sync_callback_runner::HeartBeat();
 }
 
+size_t HeartBeat_Sync(std::chrono::nanoseconds timeBudget)
+{
+  return sync_callback_runner::HeartBeat(timeBudget);
+}
+
+CallbackQueueStats GetCallbackQueueStats()
+{
+  return sync_callback_runner::GetStats();
+}
+
+void ResetCallbackQueueStats()
+{
+  sync_callback_runner::ResetStats();
+}
+
 
 void Service_WaitAll_Sync()
 {
@@ -313,6 +356,18 @@ BABYLON_SHARED_EXPORT void Service_Stop()
   service.Stop();
 }
 
+void Service_SetConcurrency(size_t concurrency)
+{
+  auto& service = AsyncLoadService::Instance();
+  service.SetConcurrency(concurrency);
+}
+
+IoServiceStats Service_GetStats()
+{
+  auto& service = AsyncLoadService::Instance();
+  return service.Stats();
+}
+
 bool HasRemainingTasks()
 {
   auto & service = AsyncLoadService::Instance();
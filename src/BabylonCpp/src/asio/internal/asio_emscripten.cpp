@@ -116,7 +116,8 @@ void LoadAssetAsync_Text(
   const std::string& assetPath,
   const std::function<void(const std::string& data)>& onSuccessFunction,
   const OnErrorFunction& onErrorFunction,
-  const OnProgressFunction& onProgressFunction
+  const OnProgressFunction& onProgressFunction,
+  LoadPriority /*priority*/
 )
 {
   std::string fullUrl = AssetsBaseUrl() + assetPath;
@@ -132,7 +133,8 @@ void LoadAssetAsync_Binary(
   const std::string& assetPath,
   const std::function<void(const ArrayBuffer& data)>& onSuccessFunction,
   const OnErrorFunction& onErrorFunction,
-  const OnProgressFunction& onProgressFunction
+  const OnProgressFunction& onProgressFunction,
+  LoadPriority /*priority*/
 )
 {
   if (IsBase64JpgDataUri(assetPath)) {
@@ -147,12 +149,44 @@ void LoadAssetAsync_Binary(
   emscripten_async_wget_data(fullUrl.c_str(), (void*)downloadId, babylon_emscripten_onLoad, babylon_emscripten_onError);
 }
 
+// No memory mapping with emscripten: the file is downloaded in a buffer
+void LoadAssetAsync_MappedBinary(
+  const std::string& assetPath,
+  const OnSuccessFunction<ArrayBufferView>& onSuccessFunction,
+  const OnErrorFunction& onErrorFunction,
+  const OnProgressFunction& onProgressFunction,
+  LoadPriority priority
+)
+{
+  auto onSuccessFunctionArrayBuffer = [onSuccessFunction](const ArrayBuffer& data) {
+    onSuccessFunction(ArrayBufferView(data));
+  };
+  LoadAssetAsync_Binary(assetPath, onSuccessFunctionArrayBuffer, onErrorFunction,
+                        onProgressFunction, priority);
+}
+
 // Call this in the app's main loop: it will run the callbacks synchronously
 // after the io completion
 void HeartBeat_Sync()
 {
 }
 
+size_t HeartBeat_Sync(std::chrono::nanoseconds /*timeBudget*/)
+{
+  return 0;
+}
+
+CallbackQueueStats GetCallbackQueueStats()
+{
+  CallbackQueueStats stats;
+  stats.queueDepth = gDownloadInfos.size();
+  return stats;
+}
+
+void ResetCallbackQueueStats()
+{
+}
+
 
 void Service_WaitAll_Sync()
 {
@@ -163,6 +197,17 @@ BABYLON_SHARED_EXPORT void Service_Stop()
 {
 }
 
+void Service_SetConcurrency(size_t /*concurrency*/)
+{
+}
+
+IoServiceStats Service_GetStats()
+{
+  IoServiceStats stats;
+  stats.pendingRequests = gDownloadInfos.size();
+  return stats;
+}
+
 bool HasRemainingTasks()
 {
   return !gDownloadInfos.empty();
@@ -2,6 +2,7 @@
 #include <babylon/asio/internal/sync_callback_runner.h>
 #include <babylon/core/filesystem.h>
 #include <babylon/core/logging.h>
+#include <babylon/core/memory_mapped_file.h>
 #include <fstream>
 
 namespace BABYLON {
@@ -57,6 +58,32 @@ ArrayBufferOrErrorMessage LoadFileSync_Binary(
   return buffer;
 }
 
+ArrayBufferViewOrErrorMessage MapFileSync_Binary(
+  const std::string& filename,
+  const OnProgressFunction& onProgressFunction
+)
+{
+  auto file = MemoryMappedFile::Open(filename);
+  if (!file) {
+    std::string message = "MapFileSync_Binary: Could not open file " + std::string(filename);
+    return ErrorMessage(message);
+  }
+
+  // The pages are read lazily when the data is accessed: the whole file is
+  // available at once
+  if (onProgressFunction)
+  {
+    const auto fileSize = file->size();
+    auto f = [onProgressFunction, fileSize]() {
+      onProgressFunction(true, fileSize, fileSize);
+    };
+    sync_callback_runner::PushCallback(f);
+  }
+
+  BABYLON_LOG_DEBUG("MapFileSync_Binary", "Finished mapping ", filename.c_str());
+  return ArrayBufferView(file);
+}
+
 
 } // namespace internal
 } // namespace asio
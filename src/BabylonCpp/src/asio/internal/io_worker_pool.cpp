@@ -0,0 +1,180 @@
+#include <babylon/asio/internal/io_worker_pool.h>
+
+#include <algorithm>
+#include <iterator>
+
+#if defined(__linux__)
+#include <pthread.h>
+#endif
+
+namespace BABYLON {
+namespace asio {
+namespace sync_io_impl {
+
+IoWorkerPool::IoWorkerPool(size_t concurrency)
+    : _concurrency{std::max<size_t>(concurrency, 1)}
+    , _idleWorkers{0}
+    , _runningJobs{0}
+    , _peakWorkers{0}
+    , _sequence{0}
+    , _stopRequested{false}
+{
+}
+
+IoWorkerPool::~IoWorkerPool()
+{
+  stop();
+}
+
+size_t IoWorkerPool::DefaultConcurrency()
+{
+  // File reads are I/O bound: allow a few more threads than cores, but keep
+  // the count bounded whatever the number of requests in flight
+  const size_t hardwareConcurrency = std::thread::hardware_concurrency();
+  return std::clamp<size_t>(hardwareConcurrency, 2, 8);
+}
+
+bool IoWorkerPool::submit(Job job, int priority, Job onDropped)
+{
+  {
+    std::lock_guard<std::mutex> guard(_mutex);
+    if (_stopRequested) {
+      return false;
+    }
+    _jobs.push(QueuedJob{priority, _sequence++, std::move(job), std::move(onDropped)});
+    _spawnWorkerIfNeeded();
+  }
+  _jobAvailable.notify_one();
+  return true;
+}
+
+void IoWorkerPool::_spawnWorkerIfNeeded()
+{
+  // Called with _mutex held
+  if (_idleWorkers >= _jobs.size() || _workers.size() >= _concurrency) {
+    return;
+  }
+  _workers.emplace_back();
+  auto worker    = &_workers.back();
+  worker->thread = std::thread([this, worker]() { _workerProc(worker); });
+  _peakWorkers = std::max(_peakWorkers, _workers.size());
+}
+
+void IoWorkerPool::_workerProc(Worker* worker)
+{
+#if defined(__linux__)
+  pthread_setname_np(pthread_self(), "asio: io worker");
+#elif defined(__APPLE__)
+  pthread_setname_np("asio: io worker");
+#endif
+  std::unique_lock<std::mutex> lock(_mutex);
+  while (true) {
+    ++_idleWorkers;
+    _jobAvailable.wait(
+      lock, [this, worker]() { return _stopRequested || worker->retired || !_jobs.empty(); });
+    --_idleWorkers;
+    if (_stopRequested || worker->retired) {
+      return;
+    }
+
+    auto job = std::move(const_cast<QueuedJob&>(_jobs.top()).job);
+    _jobs.pop();
+    ++_runningJobs;
+    lock.unlock();
+
+    job();
+    job = nullptr;
+
+    lock.lock();
+    --_runningJobs;
+    if (_jobs.empty() && _runningJobs == 0) {
+      _becameIdle.notify_all();
+    }
+  }
+}
+
+void IoWorkerPool::setConcurrency(size_t concurrency)
+{
+  std::list<Worker> retiredWorkers;
+  {
+    std::lock_guard<std::mutex> guard(_mutex);
+    _concurrency = std::max<size_t>(concurrency, 1);
+    while (_workers.size() > _concurrency) {
+      _workers.back().retired = true;
+      retiredWorkers.splice(retiredWorkers.begin(), _workers, std::prev(_workers.end()));
+    }
+    for (size_t i = 0; i < _jobs.size(); ++i) {
+      _spawnWorkerIfNeeded();
+    }
+  }
+  _jobAvailable.notify_all();
+  for (auto& worker : retiredWorkers) {
+    worker.thread.join();
+  }
+}
+
+size_t IoWorkerPool::concurrency() const
+{
+  std::lock_guard<std::mutex> guard(_mutex);
+  return _concurrency;
+}
+
+size_t IoWorkerPool::workerThreadCount() const
+{
+  std::lock_guard<std::mutex> guard(_mutex);
+  return _workers.size();
+}
+
+size_t IoWorkerPool::peakWorkerThreadCount() const
+{
+  std::lock_guard<std::mutex> guard(_mutex);
+  return _peakWorkers;
+}
+
+size_t IoWorkerPool::pendingJobCount() const
+{
+  std::lock_guard<std::mutex> guard(_mutex);
+  return _jobs.size() + _runningJobs;
+}
+
+bool IoWorkerPool::idle() const
+{
+  std::lock_guard<std::mutex> guard(_mutex);
+  return _jobs.empty() && _runningJobs == 0;
+}
+
+void IoWorkerPool::waitIdle()
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  _becameIdle.wait(
+    lock, [this]() { return _stopRequested || (_jobs.empty() && _runningJobs == 0); });
+}
+
+void IoWorkerPool::stop()
+{
+  std::list<Worker> workers;
+  std::priority_queue<QueuedJob> droppedJobs;
+  {
+    std::lock_guard<std::mutex> guard(_mutex);
+    _stopRequested = true;
+    droppedJobs.swap(_jobs);
+    workers.swap(_workers);
+  }
+  _jobAvailable.notify_all();
+  _becameIdle.notify_all();
+  while (!droppedJobs.empty()) {
+    if (droppedJobs.top().onDropped) {
+      droppedJobs.top().onDropped();
+    }
+    droppedJobs.pop();
+  }
+  for (auto& worker : workers) {
+    if (worker.thread.joinable()) {
+      worker.thread.join();
+    }
+  }
+}
+
+} // namespace sync_io_impl
+} // namespace asio
+} // namespace BABYLON
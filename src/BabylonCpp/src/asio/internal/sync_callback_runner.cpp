@@ -1,7 +1,8 @@
+#include <babylon/asio/internal/mpsc_queue.h>
 #include <babylon/asio/internal/sync_callback_runner.h>
 #include <babylon/core/logging.h>
-#include <future>
-#include <deque>
+
+#include <algorithm>
 
 namespace BABYLON {
 namespace asio {
@@ -12,59 +13,81 @@ void EmptyVoidCallback()
 
 namespace sync_callback_runner {
 
-std::deque<VoidCallback> gPendingCallbacks;
-std::mutex gMutexPendingCallbacks;
+using Clock = std::chrono::steady_clock;
+
+struct PendingCallback {
+  VoidCallback callback;
+  Clock::time_point pushTime;
+};
+
+// Callbacks are pushed by the io workers (and by the main thread), and are
+// only popped by the main thread
+MpscQueue<PendingCallback> gPendingCallbacks;
+
+// Only accessed from the main thread
+CallbackQueueStats gStats;
+double gTotalLatencyMilliseconds = 0.;
 
 
 void PushCallback(const VoidCallback & function)
 {
-  std::lock_guard<std::mutex> guard(gMutexPendingCallbacks);
-  gPendingCallbacks.push_back(function);
+  gPendingCallbacks.push(PendingCallback{function, Clock::now()});
 }
 
-void HeartBeat()
+size_t HeartBeat(std::chrono::nanoseconds timeBudget)
 {
-  int nbRemainingCallback = -1;
-  int nbCallbackAtStart = -1;
+  const auto start = Clock::now();
+  const bool hasBudget = timeBudget.count() > 0;
+  int nbCallbackAtStart = static_cast<int>(gPendingCallbacks.size());
+  size_t nbCalled = 0;
 
-  bool done = false;
-  while (!done)
+  PendingCallback pending;
+  while (gPendingCallbacks.try_pop(pending))
   {
-    VoidCallback callback;
-    {
-      std::lock_guard<std::mutex> guard(gMutexPendingCallbacks);
-
-      if (nbCallbackAtStart < 0)
-        nbCallbackAtStart = static_cast<int>(gPendingCallbacks.size());
-
-      if (!gPendingCallbacks.empty())
-      {
-        callback = gPendingCallbacks.front();
-        gPendingCallbacks.pop_front();
-      }
-      nbRemainingCallback = static_cast<int>(gPendingCallbacks.size());
-    }
+    const auto callStart = Clock::now();
+    const double latencyMilliseconds
+      = std::chrono::duration<double, std::milli>(callStart - pending.pushTime).count();
+    gTotalLatencyMilliseconds += latencyMilliseconds;
+    gStats.maxLatencyMilliseconds = std::max(gStats.maxLatencyMilliseconds, latencyMilliseconds);
+    ++gStats.totalCallbacks;
 
-    if (callback) {
-      BABYLON_LOG_DEBUG("sync_callback_runner", "Calling one callback, remaining ", nbRemainingCallback);
-      callback();
+    if (pending.callback) {
+      BABYLON_LOG_DEBUG("sync_callback_runner", "Calling one callback, remaining ",
+                        gPendingCallbacks.size());
+      pending.callback();
     }
-    else
-      done = true;
-   }
+    pending.callback = nullptr;
+    ++nbCalled;
+
+    // At least one callback is run per heartbeat, whatever the budget
+    if (hasBudget && Clock::now() - start >= timeBudget)
+      break;
+  }
 
-  if (nbRemainingCallback != nbCallbackAtStart) {
+  const int nbRemainingCallback = static_cast<int>(gPendingCallbacks.size());
+  gStats.queueDepth                = static_cast<size_t>(nbRemainingCallback);
+  gStats.lastHeartBeatCallbacks    = nbCalled;
+  gStats.lastHeartBeatMilliseconds
+    = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  gStats.averageLatencyMilliseconds
+    = gStats.totalCallbacks > 0 ? gTotalLatencyMilliseconds / gStats.totalCallbacks : 0.;
+
+  if (nbCalled > 0) {
     char msg[1000];
-    snprintf(msg, 1000, "HeartBeat end, called %i callbacks, remaining %i",
-             nbCallbackAtStart - nbRemainingCallback,
-             nbRemainingCallback);
+    snprintf(msg, 1000, "HeartBeat end, called %i callbacks (%i queued at start), remaining %i",
+             static_cast<int>(nbCalled), nbCallbackAtStart, nbRemainingCallback);
     BABYLON_LOG_DEBUG("sync_callback_runner", msg, "");
   }
+  return nbCalled;
+}
+
+void HeartBeat()
+{
+  HeartBeat(std::chrono::nanoseconds::zero());
 }
 
 bool HasRemainingCallbacks()
 {
-  std::lock_guard<std::mutex> guard(gMutexPendingCallbacks);
   return ! gPendingCallbacks.empty();
 }
 
@@ -74,6 +97,19 @@ void CallAllPendingCallbacks()
     HeartBeat();
 }
 
+CallbackQueueStats GetStats()
+{
+  CallbackQueueStats stats = gStats;
+  stats.queueDepth         = gPendingCallbacks.size();
+  return stats;
+}
+
+void ResetStats()
+{
+  gStats                    = CallbackQueueStats{};
+  gTotalLatencyMilliseconds = 0.;
+}
+
 } // namespace sync_callback_runner
 } // namespace asio
 } // namespace BABYLON
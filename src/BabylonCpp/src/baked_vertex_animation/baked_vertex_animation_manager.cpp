@@ -0,0 +1,105 @@
+#include <babylon/baked_vertex_animation/baked_vertex_animation_manager.h>
+
+#include <babylon/engines/constants.h>
+#include <babylon/engines/engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/materials/effect.h>
+#include <babylon/materials/textures/raw_texture.h>
+
+namespace BABYLON {
+
+BakedVertexAnimationManager::BakedVertexAnimationManager(Scene* scene)
+    : texture{this, &BakedVertexAnimationManager::get_texture,
+              &BakedVertexAnimationManager::set_texture}
+    , isEnabled{this, &BakedVertexAnimationManager::get_isEnabled,
+                &BakedVertexAnimationManager::set_isEnabled}
+    , animationParameters{0.f, 0.f, 0.f, 30.f}
+    , time{0.f}
+    , _texture{nullptr}
+    , _isEnabled{true}
+{
+  _scene = scene ? scene : Engine::LastCreatedScene();
+}
+
+BakedVertexAnimationManager::~BakedVertexAnimationManager() = default;
+
+std::string BakedVertexAnimationManager::getClassName() const
+{
+  return "BakedVertexAnimationManager";
+}
+
+RawTexturePtr& BakedVertexAnimationManager::get_texture()
+{
+  return _texture;
+}
+
+void BakedVertexAnimationManager::set_texture(const RawTexturePtr& value)
+{
+  if (_texture == value) {
+    return;
+  }
+
+  _texture = value;
+  _markSubMeshesAsAttributesDirty();
+}
+
+bool BakedVertexAnimationManager::get_isEnabled() const
+{
+  return _isEnabled;
+}
+
+void BakedVertexAnimationManager::set_isEnabled(bool value)
+{
+  if (_isEnabled == value) {
+    return;
+  }
+
+  _isEnabled = value;
+  _markSubMeshesAsAttributesDirty();
+}
+
+void BakedVertexAnimationManager::_markSubMeshesAsAttributesDirty()
+{
+  if (_scene) {
+    _scene->markAllMaterialsAsDirty(Constants::MATERIAL_AttributesDirtyFlag);
+  }
+}
+
+bool BakedVertexAnimationManager::isReady()
+{
+  return _texture && _texture->isReady();
+}
+
+void BakedVertexAnimationManager::bind(const EffectPtr& effect, bool useInstances)
+{
+  if (!_texture || !_isEnabled || !effect) {
+    return;
+  }
+
+  const auto size = _texture->getSize();
+  effect->setFloat2("bakedVertexAnimationTextureSizeInverted",
+                    1.f / static_cast<float>(size.width), 1.f / static_cast<float>(size.height));
+  effect->setFloat("bakedVertexAnimationTime", time);
+
+  if (!useInstances) {
+    effect->setVector4("bakedVertexAnimationSettings", animationParameters);
+  }
+
+  effect->setTexture("bakedVertexAnimationTexture", _texture);
+}
+
+void BakedVertexAnimationManager::setAnimationParameters(float startFrame, float endFrame,
+                                                         float offset, float speedFramesPerSecond)
+{
+  animationParameters = Vector4(startFrame, endFrame, offset, speedFramesPerSecond);
+}
+
+void BakedVertexAnimationManager::dispose(bool forceDisposeTextures)
+{
+  if (forceDisposeTextures && _texture) {
+    _texture->dispose();
+  }
+  _texture = nullptr;
+}
+
+} // end of namespace BABYLON
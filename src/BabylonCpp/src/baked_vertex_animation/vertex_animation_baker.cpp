@@ -0,0 +1,180 @@
+#include <babylon/baked_vertex_animation/vertex_animation_baker.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+#include <nlohmann/json.hpp>
+
+#include <babylon/animations/animation.h>
+#include <babylon/animations/animation_group.h>
+#include <babylon/animations/animation_range.h>
+#include <babylon/animations/ianimatable.h>
+#include <babylon/animations/runtime_animation.h>
+#include <babylon/animations/targeted_animation.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/engines/constants.h>
+#include <babylon/materials/textures/raw_texture.h>
+#include <babylon/meshes/abstract_mesh.h>
+#include <babylon/utils/base64.h>
+
+namespace BABYLON {
+
+namespace {
+
+/**
+ * @brief Returns the number of integer frames sampled in a range, bounds
+ * included.
+ */
+size_t FrameCount(const AnimationRange& range)
+{
+  return range.to < range.from ? 0 : static_cast<size_t>(std::floor(range.to - range.from)) + 1;
+}
+
+} // end of anonymous namespace
+
+VertexAnimationBaker::VertexAnimationBaker(Scene* scene, const AbstractMeshPtr& mesh)
+    : _scene{scene}, _mesh{mesh}
+{
+}
+
+VertexAnimationBaker::~VertexAnimationBaker() = default;
+
+Float32Array VertexAnimationBaker::bakeVertexData(const std::vector<AnimationRange>& ranges)
+{
+  if (!_mesh || !_mesh->skeleton()) {
+    throw std::runtime_error("No skeleton in this mesh.");
+  }
+
+  std::vector<std::pair<IAnimatablePtr, AnimationPtr>> targets;
+  for (const auto& animatable : _mesh->skeleton()->getAnimatables()) {
+    for (const auto& animation : animatable->getAnimations()) {
+      targets.emplace_back(animatable, animation);
+    }
+  }
+
+  return _bakeVertexData(targets, ranges);
+}
+
+Float32Array VertexAnimationBaker::bakeVertexData(AnimationGroup& animationGroup,
+                                                  const std::vector<AnimationRange>& ranges)
+{
+  if (!_mesh || !_mesh->skeleton()) {
+    throw std::runtime_error("No skeleton in this mesh.");
+  }
+
+  std::vector<std::pair<IAnimatablePtr, AnimationPtr>> targets;
+  for (const auto& targetedAnimation : animationGroup.targetedAnimations()) {
+    targets.emplace_back(targetedAnimation->target, targetedAnimation->animation);
+  }
+
+  if (ranges.empty()) {
+    return _bakeVertexData(
+      targets, {AnimationRange(animationGroup.name, animationGroup.from(), animationGroup.to())});
+  }
+
+  return _bakeVertexData(targets, ranges);
+}
+
+Float32Array VertexAnimationBaker::_bakeVertexData(
+  const std::vector<std::pair<IAnimatablePtr, AnimationPtr>>& targets,
+  const std::vector<AnimationRange>& ranges)
+{
+  const auto& skeleton    = _mesh->skeleton();
+  const auto matrixFloats = 16 * (skeleton->bones.size() + 1);
+  size_t frameCount       = 0;
+  for (const auto& range : ranges) {
+    frameCount += FrameCount(range);
+  }
+
+  Float32Array vertexData(matrixFloats * frameCount);
+
+  // The runtime animations are created once and moved from frame to frame, the
+  // skeleton is prepared right away instead of rendering the scene
+  std::vector<RuntimeAnimationPtr> runtimeAnimations;
+  runtimeAnimations.reserve(targets.size());
+  for (const auto& [target, animation] : targets) {
+    if (target && animation && !animation->getKeys().empty()) {
+      runtimeAnimations.emplace_back(RuntimeAnimation::New(target, animation, _scene, nullptr));
+    }
+  }
+
+  size_t frameIndex = 0;
+  for (const auto& range : ranges) {
+    const auto rangeFrameCount = FrameCount(range);
+    for (size_t i = 0; i < rangeFrameCount; ++i, ++frameIndex) {
+      const auto frame = range.from + static_cast<float>(i);
+      for (const auto& runtimeAnimation : runtimeAnimations) {
+        runtimeAnimation->goToFrame(frame);
+      }
+
+      skeleton->_markAsDirty();
+      skeleton->prepare();
+
+      const auto& matrices = skeleton->getTransformMatrices(_mesh.get());
+      std::copy_n(matrices.begin(), std::min(matrices.size(), matrixFloats),
+                  vertexData.begin() + static_cast<std::ptrdiff_t>(frameIndex * matrixFloats));
+    }
+  }
+
+  // Restore the pose of the skeleton
+  for (const auto& runtimeAnimation : runtimeAnimations) {
+    runtimeAnimation->reset(true);
+    runtimeAnimation->dispose();
+  }
+  skeleton->_markAsDirty();
+  skeleton->prepare();
+
+  return vertexData;
+}
+
+RawTexturePtr VertexAnimationBaker::textureFromBakedVertexData(const Float32Array& vertexData)
+{
+  if (!_mesh || !_mesh->skeleton()) {
+    throw std::runtime_error("No skeleton in this mesh.");
+  }
+
+  const auto& skeleton = _mesh->skeleton();
+  const auto width     = (skeleton->bones.size() + 1) * 4;
+  const auto height    = vertexData.size() / (width * 4);
+  auto texture         = RawTexture::CreateRGBATexture(
+    vertexData, static_cast<int>(width), static_cast<int>(height), _scene, false, false,
+    Constants::TEXTURE_NEAREST_SAMPLINGMODE, Constants::TEXTURETYPE_FLOAT);
+  texture->name = "VAT" + skeleton->name;
+  return texture;
+}
+
+json VertexAnimationBaker::serializeBakedVertexDataToObject(const Float32Array& vertexData) const
+{
+  return {
+    {"vertexData", Base64::encode(reinterpret_cast<const unsigned char*>(vertexData.data()),
+                                  static_cast<unsigned int>(vertexData.size() * sizeof(float)))},
+  };
+}
+
+Float32Array VertexAnimationBaker::loadBakedVertexDataFromObject(const json& data) const
+{
+  const auto it = data.find("vertexData");
+  if (it == data.end() || !it->is_string()) {
+    throw std::runtime_error("No baked vertex data in this object.");
+  }
+
+  const auto bytes = Base64::decode(it->get<std::string>());
+  Float32Array vertexData(bytes.size() / sizeof(float));
+  std::memcpy(vertexData.data(), bytes.data(), vertexData.size() * sizeof(float));
+  return vertexData;
+}
+
+std::string
+VertexAnimationBaker::serializeBakedVertexDataToJSON(const Float32Array& vertexData) const
+{
+  return serializeBakedVertexDataToObject(vertexData).dump();
+}
+
+Float32Array VertexAnimationBaker::loadBakedVertexDataFromJSON(const std::string& json) const
+{
+  return loadBakedVertexDataFromObject(json::parse(json));
+}
+
+} // end of namespace BABYLON
@@ -6,6 +6,7 @@
 #include <babylon/bones/bone.h>
 #include <babylon/core/json_util.h>
 #include <babylon/core/logging.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/engines/constants.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
@@ -15,6 +16,26 @@
 
 namespace BABYLON {
 
+namespace {
+
+/**
+ * @brief Multiplies two row-major 4x4 matrices stored in float arrays
+ * (result = a * b). Each row of the result is a linear combination of the rows
+ * of b, which compilers turn into 4-wide SIMD multiply-adds.
+ */
+inline void MultiplyMatrices(const float* a, const float* b, float* result)
+{
+  for (size_t row = 0; row < 4; ++row) {
+    const auto a0 = a[4 * row], a1 = a[4 * row + 1], a2 = a[4 * row + 2], a3 = a[4 * row + 3];
+    for (size_t column = 0; column < 4; ++column) {
+      result[4 * row + column]
+        = a0 * b[column] + a1 * b[4 + column] + a2 * b[8 + column] + a3 * b[12 + column];
+    }
+  }
+}
+
+} // end of anonymous namespace
+
 Skeleton::Skeleton(const std::string& iName, const std::string& iId, Scene* scene)
     : needInitialSkinMatrix{false}
     , overrideMesh{nullptr}
@@ -361,41 +382,121 @@ void Skeleton::_unregisterMeshWithPoseMatrix(AbstractMesh* mesh)
   stl_util::erase(_meshesWithPoseMatrix, mesh);
 }
 
+void Skeleton::_updateBoneHierarchy()
+{
+  // Check if the bones or their parents changed since the last flattening
+  auto upToDate = _hierarchyBones.size() == bones.size();
+  for (size_t i = 0; upToDate && i < bones.size(); ++i) {
+    upToDate = _hierarchyBones[_hierarchyOrder[i]] == bones[i].get()
+               && _hierarchyParentBones[_hierarchyOrder[i]] == bones[i]->getParent();
+  }
+  if (upToDate) {
+    return;
+  }
+
+  const auto nbBones = bones.size();
+  std::unordered_map<Bone*, size_t> boneIndices;
+  boneIndices.reserve(nbBones);
+  for (size_t i = 0; i < nbBones; ++i) {
+    boneIndices[bones[i].get()] = i;
+  }
+
+  // Topological order: every bone comes after its parent
+  _hierarchyBones.clear();
+  _hierarchyParentBones.clear();
+  _hierarchyBoneIndices.clear();
+  _hierarchyOrder.assign(nbBones, 0);
+  std::vector<bool> visited(nbBones, false);
+  std::vector<size_t> stack;
+  for (size_t i = 0; i < nbBones; ++i) {
+    // Push the chain of unvisited ancestors, then visit it from the root
+    for (auto index = i; !visited[index];) {
+      visited[index] = true;
+      stack.emplace_back(index);
+      const auto parent = bones[index]->getParent();
+      const auto it     = parent ? boneIndices.find(parent) : boneIndices.end();
+      if (it == boneIndices.end()) {
+        break;
+      }
+      index = it->second;
+    }
+    while (!stack.empty()) {
+      const auto index       = stack.back();
+      _hierarchyOrder[index] = _hierarchyBones.size();
+      _hierarchyBones.emplace_back(bones[index].get());
+      _hierarchyParentBones.emplace_back(bones[index]->getParent());
+      _hierarchyBoneIndices.emplace_back(index);
+      stack.pop_back();
+    }
+  }
+
+  _hierarchyParents.resize(nbBones);
+  for (size_t i = 0; i < nbBones; ++i) {
+    const auto parent = _hierarchyParentBones[i];
+    const auto it     = parent ? boneIndices.find(parent) : boneIndices.end();
+    _hierarchyParents[i]
+      = it == boneIndices.end() ? -1 : static_cast<int>(_hierarchyOrder[it->second]);
+  }
+}
+
 void Skeleton::_computeTransformMatrices(Float32Array& targetMatrix,
                                          const std::optional<Matrix>& initialSkinMatrix)
 {
-  onBeforeComputeObservable.notifyObservers(this);
+  _updateBoneHierarchy();
 
-  unsigned int index = 0;
-  for (const auto& bone : bones) {
+  const auto nbBones = _hierarchyBones.size();
+  _worldMatrices.resize(16 * nbBones);
+  auto* worldMatrices = _worldMatrices.data();
+
+  for (size_t i = 0; i < nbBones; ++i) {
+    auto bone = _hierarchyBones[i];
     ++bone->_childUpdateId;
-    auto parentBone = bone->getParent();
 
-    if (parentBone) {
-      bone->getLocalMatrix().multiplyToRef(parentBone->getWorldMatrix(), bone->getWorldMatrix());
+    const auto* localMatrix = bone->getLocalMatrix().m().data();
+    auto* worldMatrix       = worldMatrices + 16 * i;
+    const auto parentIndex  = _hierarchyParents[i];
+
+    if (parentIndex >= 0) {
+      // The parent has already been computed in this pass
+      MultiplyMatrices(localMatrix, worldMatrices + 16 * parentIndex, worldMatrix);
+    }
+    else if (_hierarchyParentBones[i]) {
+      // Parent bone which is not part of the skeleton
+      MultiplyMatrices(localMatrix, _hierarchyParentBones[i]->getWorldMatrix().m().data(),
+                       worldMatrix);
+    }
+    else if (initialSkinMatrix.has_value()) {
+      MultiplyMatrices(localMatrix, initialSkinMatrix->m().data(), worldMatrix);
     }
     else {
-      if (initialSkinMatrix.has_value()) {
-        bone->getLocalMatrix().multiplyToRef(*initialSkinMatrix, bone->getWorldMatrix());
-      }
-      else {
-        bone->getWorldMatrix().copyFrom(bone->getLocalMatrix());
-      }
+      std::copy(localMatrix, localMatrix + 16, worldMatrix);
     }
+    Matrix::FromArrayToRef(_worldMatrices, static_cast<unsigned int>(16 * i),
+                           bone->getWorldMatrix());
 
+    const auto boneIndex = _hierarchyBoneIndices[i];
     if (!bone->_index.has_value() || *bone->_index != -1) {
-      auto mappedIndex
-        = !bone->_index.has_value() ? index : static_cast<unsigned int>(*bone->_index);
-      bone->getInvertedAbsoluteTransform().multiplyToArray(bone->getWorldMatrix(), targetMatrix,
-                                                           mappedIndex * 16);
+      const auto mappedIndex
+        = !bone->_index.has_value() ? boneIndex : static_cast<size_t>(*bone->_index);
+      if (targetMatrix.size() >= 16 * (mappedIndex + 1)) {
+        MultiplyMatrices(bone->getInvertedAbsoluteTransform().m().data(), worldMatrix,
+                         targetMatrix.data() + 16 * mappedIndex);
+      }
     }
-    ++index;
   }
 
   _identity.copyToArray(targetMatrix, static_cast<unsigned int>(bones.size()) * 16);
 }
 
 void Skeleton::prepare()
+{
+  if (_beginPrepare()) {
+    _prepareTransformMatrices();
+    _endPrepare();
+  }
+}
+
+bool Skeleton::_beginPrepare()
 {
   // Update the local matrix of bones with linked transform nodes.
   if (_numBonesWithLinkedTransformNode > 0) {
@@ -410,7 +511,7 @@ void Skeleton::prepare()
   }
 
   if (!_isDirty) {
-    return;
+    return false;
   }
 
   if (needInitialSkinMatrix) {
@@ -450,33 +551,49 @@ void Skeleton::prepare()
         }
       }
 
+      onBeforeComputeObservable.notifyObservers(this);
       _computeTransformMatrices(mesh->_bonesTransformMatrices, poseMatrix);
 
       if (isUsingTextureForMatrices && mesh->_transformMatrixTexture) {
         mesh->_transformMatrixTexture->update(mesh->_bonesTransformMatrices);
       }
     }
+
+    _isDirty = false;
+    _scene->_activeBones.addCount(bones.size(), false);
+
+    // The matrices of every mesh with pose matrix are already computed
+    return false;
   }
-  else {
-    if (_transformMatrices.size() != 16 * (bones.size() + 1)) {
-      _transformMatrices.resize(16 * (bones.size() + 1));
 
-      if (isUsingTextureForMatrices) {
-        if (_transformMatrixTexture) {
-          _transformMatrixTexture->dispose();
-        }
+  if (_transformMatrices.size() != 16 * (bones.size() + 1)) {
+    _transformMatrices.resize(16 * (bones.size() + 1));
 
-        _transformMatrixTexture = RawTexture::CreateRGBATexture(
-          _transformMatrices, static_cast<int>((bones.size() + 1) * 4), 1, _scene, false, false,
-          Constants::TEXTURE_NEAREST_SAMPLINGMODE, Constants::TEXTURETYPE_FLOAT);
+    if (isUsingTextureForMatrices) {
+      if (_transformMatrixTexture) {
+        _transformMatrixTexture->dispose();
       }
+
+      _transformMatrixTexture = RawTexture::CreateRGBATexture(
+        _transformMatrices, static_cast<int>((bones.size() + 1) * 4), 1, _scene, false, false,
+        Constants::TEXTURE_NEAREST_SAMPLINGMODE, Constants::TEXTURETYPE_FLOAT);
     }
+  }
+
+  onBeforeComputeObservable.notifyObservers(this);
 
-    _computeTransformMatrices(_transformMatrices);
+  return true;
+}
 
-    if (isUsingTextureForMatrices && _transformMatrixTexture) {
-      _transformMatrixTexture->update(_transformMatrices);
-    }
+void Skeleton::_prepareTransformMatrices()
+{
+  _computeTransformMatrices(_transformMatrices);
+}
+
+void Skeleton::_endPrepare()
+{
+  if (isUsingTextureForMatrices && _transformMatrixTexture) {
+    _transformMatrixTexture->update(_transformMatrices);
   }
 
   _isDirty = false;
@@ -484,6 +601,39 @@ void Skeleton::prepare()
   _scene->_activeBones.addCount(bones.size(), false);
 }
 
+void Skeleton::PrepareSkeletons(const std::vector<SkeletonPtr>& skeletons)
+{
+  // Serial part: linked transform nodes, buffers, textures and observers
+  std::vector<Skeleton*> skeletonsToCompute;
+  skeletonsToCompute.reserve(skeletons.size());
+  for (const auto& skeleton : skeletons) {
+    if (skeleton->_beginPrepare()) {
+      skeletonsToCompute.emplace_back(skeleton.get());
+    }
+  }
+
+  // The bone matrices of independent skeletons are computed concurrently
+  auto& threadPool = ThreadPool::Default();
+  if (threadPool.workerCount() > 0 && skeletonsToCompute.size() > 1) {
+    threadPool.parallelFor(skeletonsToCompute.size(), 1,
+                           [&skeletonsToCompute](size_t begin, size_t end) {
+                             for (size_t i = begin; i < end; ++i) {
+                               skeletonsToCompute[i]->_prepareTransformMatrices();
+                             }
+                           });
+  }
+  else {
+    for (const auto& skeleton : skeletonsToCompute) {
+      skeleton->_prepareTransformMatrices();
+    }
+  }
+
+  // Serial part: texture updates
+  for (const auto& skeleton : skeletonsToCompute) {
+    skeleton->_endPrepare();
+  }
+}
+
 std::vector<IAnimatablePtr> Skeleton::getAnimatables()
 {
   if (_animatables.size() != bones.size()) {
@@ -1,5 +1,6 @@
 #include <babylon/collisions/collision_coordinator.h>
 
+#include <babylon/babylon_stl_util.h>
 #include <babylon/collisions/collider.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
@@ -66,16 +67,27 @@ void DefaultCollisionCoordinator::_collideWithWorld(Vector3& position, Vector3&
 
   collider->_initialize(position, velocity, closeDistance);
 
-  // Check if collision detection should happen against specified list of meshes or,
-  // if not specified, against all meshes in the scene
-  const auto meshes = excludedMesh ? excludedMesh->surroundingMeshes() : _scene->meshes;
-
-  // Check all meshes
-  for (const auto& mesh : meshes) {
+  const auto checkCollision = [&](AbstractMesh* mesh) {
     if (mesh->isEnabled() && mesh->checkCollisions && !mesh->subMeshes.empty()
-        && mesh != excludedMesh && ((collisionMask & mesh->collisionGroup) != 0)) {
+        && mesh != excludedMesh.get() && ((collisionMask & mesh->collisionGroup) != 0)) {
       mesh->_checkCollision(*collider);
     }
+  };
+
+  // Check if collision detection should happen against specified list of meshes or,
+  // if not specified, against the meshes of the scene in reach of the collider
+  if (excludedMesh && !excludedMesh->surroundingMeshes().empty()) {
+    for (const auto& mesh : excludedMesh->surroundingMeshes()) {
+      checkCollision(mesh.get());
+    }
+  }
+  else {
+    const auto& radius = collider->_radius;
+    const auto reach
+      = collider->_velocityWorldLength + stl_util::max(radius.x, radius.y, radius.z);
+    for (const auto& mesh : _scene->_getMeshesTreeCandidates(collider->_basePointWorld, reach)) {
+      checkCollision(mesh);
+    }
   }
 
   if (!collider->collisionFound) {
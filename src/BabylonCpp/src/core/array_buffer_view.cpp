@@ -1,33 +1,45 @@
 #include <babylon/core/array_buffer_view.h>
 
+#include <stdexcept>
+
 #include <babylon/babylon_stl_util.h>
+#include <babylon/core/memory_mapped_file.h>
 
 namespace BABYLON {
 
 ArrayBufferView::ArrayBufferView() = default;
 
 ArrayBufferView::ArrayBufferView(const Int8Array& buffer)
-    : byteOffset{0}, _uint8Array{stl_util::to_array<uint8_t>(buffer)}
+    : byteOffset{0}, _buffer{std::make_shared<Uint8Array>(stl_util::to_array<uint8_t>(buffer))}
 {
 }
 
 ArrayBufferView::ArrayBufferView(const ArrayBuffer& arrayBuffer)
-    : byteOffset{0}, _uint8Array{arrayBuffer}
+    : byteOffset{0}, _buffer{std::make_shared<Uint8Array>(arrayBuffer)}
+{
+}
+
+ArrayBufferView::ArrayBufferView(ArrayBuffer&& arrayBuffer)
+    : byteOffset{0}, _buffer{std::make_shared<Uint8Array>(std::move(arrayBuffer))}
 {
 }
 
 ArrayBufferView::ArrayBufferView(const Uint16Array& buffer)
-    : byteOffset{0}, _uint8Array{stl_util::to_array<uint8_t>(buffer)}
+    : byteOffset{0}, _buffer{std::make_shared<Uint8Array>(stl_util::to_array<uint8_t>(buffer))}
 {
 }
 
 ArrayBufferView::ArrayBufferView(const Uint32Array& buffer)
-    : byteOffset{0}, _uint8Array{stl_util::to_array<uint8_t>(buffer)}
+    : byteOffset{0}, _buffer{std::make_shared<Uint8Array>(stl_util::to_array<uint8_t>(buffer))}
 {
 }
 
 ArrayBufferView::ArrayBufferView(const Float32Array& buffer)
-    : byteOffset{0}, _uint8Array{stl_util::to_array<uint8_t>(buffer)}
+    : byteOffset{0}, _buffer{std::make_shared<Uint8Array>(stl_util::to_array<uint8_t>(buffer))}
+{
+}
+
+ArrayBufferView::ArrayBufferView(const MemoryMappedFilePtr& file) : byteOffset{0}, _mappedFile{file}
 {
 }
 
@@ -43,67 +55,151 @@ ArrayBufferView::~ArrayBufferView() = default;
 
 void ArrayBufferView::clear()
 {
-  _uint8Array.clear();
+  byteOffset  = 0;
+  _buffer     = nullptr;
+  _mappedFile = nullptr;
+  _byteLength.reset();
 }
 
 size_t ArrayBufferView::byteLength() const
 {
-  return _uint8Array.size();
+  const auto bufferLength = _bufferLength();
+  if (byteOffset >= bufferLength) {
+    return 0;
+  }
+  const auto available = bufferLength - byteOffset;
+  return _byteLength.has_value() ? std::min(*_byteLength, available) : available;
 }
 
 ArrayBufferView::operator bool() const
 {
-  return !_uint8Array.empty();
+  return byteLength() > 0;
 }
 
-Int8Array ArrayBufferView::int8Array() const
+ArrayBufferView ArrayBufferView::subarray(size_t iByteOffset,
+                                          std::optional<size_t> iByteLength) const
 {
-  return stl_util::to_array<int8_t>(_uint8Array);
+  const auto length = byteLength();
+  if (iByteOffset > length
+      || (iByteLength.has_value() && *iByteLength > length - iByteOffset)) {
+    _throwOutOfRange(iByteOffset, iByteLength.value_or(0));
+  }
+
+  ArrayBufferView view;
+  view.byteOffset  = byteOffset + iByteOffset;
+  view._buffer     = _buffer;
+  view._mappedFile = _mappedFile;
+  view._byteLength = iByteLength.value_or(length - iByteOffset);
+  return view;
+}
+
+const uint8_t* ArrayBufferView::data() const
+{
+  if (_mappedFile) {
+    return _mappedFile->data() + byteOffset;
+  }
+  return _buffer ? _buffer->data() + byteOffset : nullptr;
+}
+
+bool ArrayBufferView::isMapped() const
+{
+  return _mappedFile && _mappedFile->isMapped();
+}
+
+void ArrayBufferView::releasePages() const
+{
+  if (_mappedFile) {
+    _mappedFile->releasePages(byteOffset, byteLength());
+  }
 }
 
 Uint8Array& ArrayBufferView::buffer()
 {
-  return _uint8Array;
+  _detach();
+  return *_buffer;
 }
 
 const Uint8Array& ArrayBufferView::buffer() const
 {
-  return _uint8Array;
+  static const Uint8Array emptyBuffer;
+  if (_mappedFile) {
+    _detach();
+  }
+  return _buffer ? *_buffer : emptyBuffer;
 }
 
 Uint8Array& ArrayBufferView::uint8Array()
 {
-  return _uint8Array;
+  return buffer();
 }
 
 const Uint8Array& ArrayBufferView::uint8Array() const
 {
-  return _uint8Array;
+  return buffer();
+}
+
+Int8Array ArrayBufferView::int8Array() const
+{
+  return typedView<int8_t>().toArray();
 }
 
 Int16Array ArrayBufferView::int16Array() const
 {
-  return stl_util::to_array<int16_t>(_uint8Array);
+  return typedView<int16_t>().toArray();
 }
 
 Uint16Array ArrayBufferView::uint16Array() const
 {
-  return stl_util::to_array<uint16_t>(_uint8Array);
+  return typedView<uint16_t>().toArray();
 }
 
 Int32Array ArrayBufferView::int32Array() const
 {
-  return stl_util::to_array<int32_t>(_uint8Array);
+  return typedView<int32_t>().toArray();
 }
 
 Uint32Array ArrayBufferView::uint32Array() const
 {
-  return stl_util::to_array<uint32_t>(_uint8Array);
+  return typedView<uint32_t>().toArray();
 }
 
 Float32Array ArrayBufferView::float32Array() const
 {
-  return stl_util::to_array<float>(_uint8Array);
+  return typedView<float>().toArray();
+}
+
+size_t ArrayBufferView::_bufferLength() const
+{
+  if (_mappedFile) {
+    return _mappedFile->size();
+  }
+  return _buffer ? _buffer->size() : 0;
+}
+
+void ArrayBufferView::_detach() const
+{
+  if (_mappedFile) {
+    // Copy the range of the view only, the view then spans the whole copy
+    const auto* viewData = data();
+    _buffer     = std::make_shared<Uint8Array>(viewData, viewData + byteLength());
+    _mappedFile = nullptr;
+    byteOffset  = 0;
+    _byteLength = std::nullopt;
+  }
+  else if (!_buffer) {
+    _buffer = std::make_shared<Uint8Array>();
+  }
+  else if (_buffer.use_count() > 1) {
+    _buffer = std::make_shared<Uint8Array>(*_buffer);
+  }
+}
+
+void ArrayBufferView::_throwOutOfRange(size_t iByteOffset, size_t iByteLength) const
+{
+  throw std::out_of_range(
+    "Range [" + std::to_string(iByteOffset) + ", " + std::to_string(iByteOffset + iByteLength)
+    + ") is out of the bounds of the array buffer view (" + std::to_string(byteLength())
+    + " bytes)");
 }
 
 } // end of namespace BABYLON
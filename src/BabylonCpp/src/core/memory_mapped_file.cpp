@@ -0,0 +1,124 @@
+#include <babylon/core/memory_mapped_file.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else // _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // _WIN32
+
+#include <algorithm>
+#include <fstream>
+
+namespace BABYLON {
+
+MemoryMappedFile::MemoryMappedFile()
+    : _data{nullptr}
+    , _size{0}
+    , _isMapped{false}
+#ifdef _WIN32
+    , _fileHandle{nullptr}
+    , _mappingHandle{nullptr}
+#endif
+{
+}
+
+MemoryMappedFilePtr MemoryMappedFile::Open(const std::string& filename)
+{
+  MemoryMappedFilePtr file(new MemoryMappedFile());
+
+#if defined(_WIN32)
+  auto fileHandle = ::CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (fileHandle != INVALID_HANDLE_VALUE) {
+    LARGE_INTEGER fileSize;
+    if (::GetFileSizeEx(fileHandle, &fileSize) && fileSize.QuadPart > 0) {
+      auto mappingHandle = ::CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      if (mappingHandle) {
+        auto data = ::MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+        if (data) {
+          file->_data          = static_cast<const uint8_t*>(data);
+          file->_size          = static_cast<size_t>(fileSize.QuadPart);
+          file->_isMapped      = true;
+          file->_fileHandle    = fileHandle;
+          file->_mappingHandle = mappingHandle;
+          return file;
+        }
+        ::CloseHandle(mappingHandle);
+      }
+    }
+    ::CloseHandle(fileHandle);
+  }
+#elif !defined(__EMSCRIPTEN__)
+  const auto fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd >= 0) {
+    struct stat fileStat;
+    if (::fstat(fd, &fileStat) == 0 && fileStat.st_size > 0) {
+      const auto size = static_cast<size_t>(fileStat.st_size);
+      auto data       = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data != MAP_FAILED) {
+        ::close(fd);
+        file->_data     = static_cast<const uint8_t*>(data);
+        file->_size     = size;
+        file->_isMapped = true;
+        return file;
+      }
+    }
+    ::close(fd);
+  }
+#endif
+
+  // Fallback: read the file in memory (empty files, emscripten file system,
+  // ...)
+  std::ifstream stream(filename, std::ios::binary | std::ios::ate);
+  if (!stream) {
+    return nullptr;
+  }
+  const auto size = static_cast<size_t>(stream.tellg());
+  file->_buffer.resize(size);
+  stream.seekg(0, std::ios::beg);
+  if (size > 0 && !stream.read(reinterpret_cast<char*>(file->_buffer.data()),
+                               static_cast<std::streamsize>(size))) {
+    return nullptr;
+  }
+  file->_data = file->_buffer.data();
+  file->_size = size;
+  return file;
+}
+
+void MemoryMappedFile::releasePages(size_t offset, size_t length) const
+{
+  if (!_isMapped || offset >= _size || length == 0) {
+    return;
+  }
+  length = std::min(length, _size - offset);
+#if defined(_WIN32)
+  // Unlocking pages which are not locked removes them from the working set
+  ::VirtualUnlock(const_cast<uint8_t*>(_data + offset), length);
+#elif !defined(__EMSCRIPTEN__)
+  // madvise requires a page aligned address, the partial pages at the bounds
+  // of the range are released as well (the mapping is read-only, they are
+  // read again from the file if needed)
+  static const auto pageSize = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+  const auto begin           = (offset / pageSize) * pageSize;
+  ::madvise(const_cast<uint8_t*>(_data + begin), offset + length - begin, MADV_DONTNEED);
+#endif
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+  if (!_isMapped) {
+    return;
+  }
+#if defined(_WIN32)
+  ::UnmapViewOfFile(_data);
+  ::CloseHandle(_mappingHandle);
+  ::CloseHandle(_fileHandle);
+#elif !defined(__EMSCRIPTEN__)
+  ::munmap(const_cast<uint8_t*>(_data), _size);
+#endif
+}
+
+} // end of namespace BABYLON
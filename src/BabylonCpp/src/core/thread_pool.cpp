@@ -0,0 +1,171 @@
+#include <babylon/core/thread_pool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+
+namespace BABYLON {
+
+namespace {
+
+/**
+ * @brief State shared by the threads taking part in a parallelFor. It is
+ * reference counted as helper tasks may be dequeued after the parallelFor has
+ * returned (they then find no chunk left).
+ */
+struct ParallelForState {
+  ParallelForState(size_t iCount, size_t iGrainSize, const ThreadPool::RangeTask& iTask)
+      : count{iCount}
+      , grainSize{iGrainSize}
+      , nbChunks{(iCount + iGrainSize - 1) / iGrainSize}
+      , task{iTask}
+      , nextChunk{0}
+      , doneChunks{0}
+  {
+  }
+
+  // Processes chunks until there is none left
+  void run()
+  {
+    size_t chunk;
+    while ((chunk = nextChunk.fetch_add(1)) < nbChunks) {
+      const auto begin = chunk * grainSize;
+      const auto end   = std::min(begin + grainSize, count);
+      try {
+        task(begin, end);
+      }
+      catch (...) {
+        std::lock_guard<std::mutex> guard(mutex);
+        if (!exception) {
+          exception = std::current_exception();
+        }
+      }
+      if (doneChunks.fetch_add(1) + 1 == nbChunks) {
+        std::lock_guard<std::mutex> guard(mutex);
+        allDone.notify_all();
+      }
+    }
+  }
+
+  const size_t count;
+  const size_t grainSize;
+  const size_t nbChunks;
+  const ThreadPool::RangeTask& task;
+  std::atomic<size_t> nextChunk;
+  std::atomic<size_t> doneChunks;
+  std::mutex mutex;
+  std::condition_variable allDone;
+  std::exception_ptr exception;
+}; // end of struct ParallelForState
+
+} // end of anonymous namespace
+
+ThreadPool& ThreadPool::Default()
+{
+  static ThreadPool pool;
+  return pool;
+}
+
+ThreadPool::ThreadPool(size_t nbWorkers) : _stopRequested{false}
+{
+  if (nbWorkers == 0) {
+    const size_t hardwareConcurrency = std::thread::hardware_concurrency();
+    nbWorkers = hardwareConcurrency > 1 ? hardwareConcurrency - 1 : 0;
+  }
+  _workers.reserve(nbWorkers);
+  for (size_t i = 0; i < nbWorkers; ++i) {
+    _workers.emplace_back([this]() { _workerProc(); });
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> guard(_mutex);
+    _stopRequested = true;
+  }
+  _taskAvailable.notify_all();
+  for (auto& worker : _workers) {
+    worker.join();
+  }
+}
+
+size_t ThreadPool::workerCount() const
+{
+  return _workers.size();
+}
+
+size_t ThreadPool::concurrency() const
+{
+  return _workers.size() + 1;
+}
+
+void ThreadPool::_workerProc()
+{
+  while (true) {
+    Task task;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _taskAvailable.wait(lock, [this]() { return _stopRequested || !_tasks.empty(); });
+      if (_tasks.empty()) {
+        return;
+      }
+      task = std::move(_tasks.front());
+      _tasks.pop_front();
+    }
+    task();
+  }
+}
+
+std::future<void> ThreadPool::submit(Task task)
+{
+  auto packagedTask = std::make_shared<std::packaged_task<void()>>(std::move(task));
+  auto future       = packagedTask->get_future();
+  if (_workers.empty()) {
+    (*packagedTask)();
+    return future;
+  }
+  {
+    std::lock_guard<std::mutex> guard(_mutex);
+    _tasks.emplace_back([packagedTask]() { (*packagedTask)(); });
+  }
+  _taskAvailable.notify_one();
+  return future;
+}
+
+void ThreadPool::parallelFor(size_t count, size_t grainSize, const RangeTask& task)
+{
+  if (count == 0) {
+    return;
+  }
+  grainSize = std::max<size_t>(grainSize, 1);
+  if (_workers.empty() || count <= grainSize) {
+    task(0, count);
+    return;
+  }
+
+  auto state = std::make_shared<ParallelForState>(count, grainSize, task);
+  const auto nbHelpers = std::min(_workers.size(), state->nbChunks - 1);
+  {
+    std::lock_guard<std::mutex> guard(_mutex);
+    for (size_t i = 0; i < nbHelpers; ++i) {
+      _tasks.emplace_back([state]() { state->run(); });
+    }
+  }
+  _taskAvailable.notify_all();
+
+  // The calling thread takes part in the work
+  state->run();
+
+  {
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->allDone.wait(lock, [&state]() { return state->doneChunks == state->nbChunks; });
+  }
+
+  if (state->exception) {
+    std::rethrow_exception(state->exception);
+  }
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,466 @@
+#include <babylon/culling/dynamic_aabb_tree.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <babylon/culling/ray.h>
+#include <babylon/meshes/abstract_mesh.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Minimal margin added around the fat boxes, for flat and point entries
+constexpr float MinimalMargin = 0.001f;
+
+inline float SurfaceArea(const Vector3& min, const Vector3& max)
+{
+  const auto wx = max.x - min.x, wy = max.y - min.y, wz = max.z - min.z;
+  return 2.f * (wx * wy + wy * wz + wz * wx);
+}
+
+inline float CombinedSurfaceArea(const Vector3& min1, const Vector3& max1, const Vector3& min2,
+                                 const Vector3& max2)
+{
+  return SurfaceArea(Vector3(std::min(min1.x, min2.x), std::min(min1.y, min2.y),
+                             std::min(min1.z, min2.z)),
+                     Vector3(std::max(max1.x, max2.x), std::max(max1.y, max2.y),
+                             std::max(max1.z, max2.z)));
+}
+
+inline void CombineToRef(const Vector3& min1, const Vector3& max1, const Vector3& min2,
+                         const Vector3& max2, Vector3& min, Vector3& max)
+{
+  min.copyFromFloats(std::min(min1.x, min2.x), std::min(min1.y, min2.y), std::min(min1.z, min2.z));
+  max.copyFromFloats(std::max(max1.x, max2.x), std::max(max1.y, max2.y), std::max(max1.z, max2.z));
+}
+
+inline bool Contains(const Vector3& outerMin, const Vector3& outerMax, const Vector3& min,
+                     const Vector3& max)
+{
+  return outerMin.x <= min.x && outerMin.y <= min.y && outerMin.z <= min.z && max.x <= outerMax.x
+         && max.y <= outerMax.y && max.z <= outerMax.z;
+}
+
+inline bool Overlaps(const Vector3& min1, const Vector3& max1, const Vector3& min2,
+                     const Vector3& max2)
+{
+  return min1.x <= max2.x && min2.x <= max1.x && min1.y <= max2.y && min2.y <= max1.y
+         && min1.z <= max2.z && min2.z <= max1.z;
+}
+
+} // end of anonymous namespace
+
+template <class T>
+DynamicAABBTree<T>::DynamicAABBTree(float marginRatio)
+    : _root{NullNode}, _freeList{NullNode}, _proxyCount{0}, _marginRatio{marginRatio}
+{
+}
+
+template <class T>
+DynamicAABBTree<T>::~DynamicAABBTree() = default;
+
+template <class T>
+int DynamicAABBTree<T>::_allocateNode()
+{
+  if (_freeList == NullNode) {
+    _nodes.emplace_back();
+    return static_cast<int>(_nodes.size() - 1);
+  }
+
+  const auto nodeId = _freeList;
+  auto& node        = _nodes[static_cast<size_t>(nodeId)];
+  _freeList         = node.parent;
+  node              = Node();
+  return nodeId;
+}
+
+template <class T>
+void DynamicAABBTree<T>::_freeNode(int nodeId)
+{
+  auto& node  = _nodes[static_cast<size_t>(nodeId)];
+  node        = Node();
+  node.parent = _freeList;
+  _freeList   = nodeId;
+}
+
+template <class T>
+void DynamicAABBTree<T>::_setFatBounds(Node& node, const Vector3& min, const Vector3& max) const
+{
+  const auto mx = (max.x - min.x) * _marginRatio + MinimalMargin;
+  const auto my = (max.y - min.y) * _marginRatio + MinimalMargin;
+  const auto mz = (max.z - min.z) * _marginRatio + MinimalMargin;
+  node.min.copyFromFloats(min.x - mx, min.y - my, min.z - mz);
+  node.max.copyFromFloats(max.x + mx, max.y + my, max.z + mz);
+}
+
+template <class T>
+int DynamicAABBTree<T>::createProxy(const Vector3& min, const Vector3& max, const T& data)
+{
+  const auto proxyId = _allocateNode();
+  auto& node         = _nodes[static_cast<size_t>(proxyId)];
+  _setFatBounds(node, min, max);
+  node.data   = data;
+  node.height = 0;
+  _insertLeaf(proxyId);
+  ++_proxyCount;
+  return proxyId;
+}
+
+template <class T>
+void DynamicAABBTree<T>::destroyProxy(int proxyId)
+{
+  _removeLeaf(proxyId);
+  _freeNode(proxyId);
+  --_proxyCount;
+}
+
+template <class T>
+bool DynamicAABBTree<T>::moveProxy(int proxyId, const Vector3& min, const Vector3& max)
+{
+  auto& node = _nodes[static_cast<size_t>(proxyId)];
+  Node fatNode;
+  _setFatBounds(fatNode, min, max);
+  // Entries staying in their fat box are not moved, unless they became much
+  // smaller than it
+  if (Contains(node.min, node.max, min, max)
+      && SurfaceArea(node.min, node.max) <= 4.f * SurfaceArea(fatNode.min, fatNode.max)) {
+    return false;
+  }
+
+  _removeLeaf(proxyId);
+  _nodes[static_cast<size_t>(proxyId)].min = fatNode.min;
+  _nodes[static_cast<size_t>(proxyId)].max = fatNode.max;
+  _insertLeaf(proxyId);
+  return true;
+}
+
+template <class T>
+const T& DynamicAABBTree<T>::getData(int proxyId) const
+{
+  return _nodes[static_cast<size_t>(proxyId)].data;
+}
+
+template <class T>
+void DynamicAABBTree<T>::getFatBounds(int proxyId, Vector3& min, Vector3& max) const
+{
+  const auto& node = _nodes[static_cast<size_t>(proxyId)];
+  min.copyFrom(node.min);
+  max.copyFrom(node.max);
+}
+
+template <class T>
+void DynamicAABBTree<T>::_insertLeaf(int leaf)
+{
+  if (_root == NullNode) {
+    _root                                    = leaf;
+    _nodes[static_cast<size_t>(leaf)].parent = NullNode;
+    return;
+  }
+
+  // Find the best sibling, descending towards the child with the smallest
+  // surface area increase
+  const auto leafMin = _nodes[static_cast<size_t>(leaf)].min;
+  const auto leafMax = _nodes[static_cast<size_t>(leaf)].max;
+  auto index         = _root;
+  while (!_nodes[static_cast<size_t>(index)].isLeaf()) {
+    const auto& node = _nodes[static_cast<size_t>(index)];
+    const auto area  = SurfaceArea(node.min, node.max);
+
+    const auto combinedArea = CombinedSurfaceArea(node.min, node.max, leafMin, leafMax);
+
+    // Cost of creating a new parent for this node and the new leaf
+    const auto cost = 2.f * combinedArea;
+    // Minimum cost of pushing the leaf further down the tree
+    const auto inheritanceCost = 2.f * (combinedArea - area);
+
+    auto childCost = [this, &leafMin, &leafMax, inheritanceCost](int childId) {
+      const auto& child = _nodes[static_cast<size_t>(childId)];
+      const auto combined
+        = CombinedSurfaceArea(child.min, child.max, leafMin, leafMax) + inheritanceCost;
+      return child.isLeaf() ? combined : combined - SurfaceArea(child.min, child.max);
+    };
+    const auto cost1 = childCost(node.child1);
+    const auto cost2 = childCost(node.child2);
+
+    if (cost < cost1 && cost < cost2) {
+      break;
+    }
+    index = cost1 < cost2 ? node.child1 : node.child2;
+  }
+
+  const auto sibling   = index;
+  const auto oldParent = _nodes[static_cast<size_t>(sibling)].parent;
+  const auto newParent = _allocateNode();
+  {
+    auto& parentNode        = _nodes[static_cast<size_t>(newParent)];
+    const auto& siblingNode = _nodes[static_cast<size_t>(sibling)];
+    parentNode.parent       = oldParent;
+    CombineToRef(leafMin, leafMax, siblingNode.min, siblingNode.max, parentNode.min,
+                 parentNode.max);
+    parentNode.height = siblingNode.height + 1;
+    parentNode.child1 = sibling;
+    parentNode.child2 = leaf;
+  }
+  _nodes[static_cast<size_t>(sibling)].parent = newParent;
+  _nodes[static_cast<size_t>(leaf)].parent    = newParent;
+
+  if (oldParent != NullNode) {
+    auto& oldParentNode = _nodes[static_cast<size_t>(oldParent)];
+    if (oldParentNode.child1 == sibling) {
+      oldParentNode.child1 = newParent;
+    }
+    else {
+      oldParentNode.child2 = newParent;
+    }
+  }
+  else {
+    _root = newParent;
+  }
+
+  // Walk back up the tree fixing heights and boxes
+  index = _nodes[static_cast<size_t>(leaf)].parent;
+  while (index != NullNode) {
+    index = _balance(index);
+
+    auto& node         = _nodes[static_cast<size_t>(index)];
+    const auto& child1 = _nodes[static_cast<size_t>(node.child1)];
+    const auto& child2 = _nodes[static_cast<size_t>(node.child2)];
+    node.height        = 1 + std::max(child1.height, child2.height);
+    CombineToRef(child1.min, child1.max, child2.min, child2.max, node.min, node.max);
+
+    index = node.parent;
+  }
+}
+
+template <class T>
+void DynamicAABBTree<T>::_removeLeaf(int leaf)
+{
+  if (leaf == _root) {
+    _root = NullNode;
+    return;
+  }
+
+  const auto parent      = _nodes[static_cast<size_t>(leaf)].parent;
+  const auto& parentNode = _nodes[static_cast<size_t>(parent)];
+  const auto grandParent = parentNode.parent;
+  const auto sibling     = parentNode.child1 == leaf ? parentNode.child2 : parentNode.child1;
+
+  if (grandParent != NullNode) {
+    // Destroy the parent and connect the sibling to the grand parent
+    auto& grandParentNode = _nodes[static_cast<size_t>(grandParent)];
+    if (grandParentNode.child1 == parent) {
+      grandParentNode.child1 = sibling;
+    }
+    else {
+      grandParentNode.child2 = sibling;
+    }
+    _nodes[static_cast<size_t>(sibling)].parent = grandParent;
+    _freeNode(parent);
+
+    // Adjust the ancestor boxes
+    auto index = grandParent;
+    while (index != NullNode) {
+      index = _balance(index);
+
+      auto& node         = _nodes[static_cast<size_t>(index)];
+      const auto& child1 = _nodes[static_cast<size_t>(node.child1)];
+      const auto& child2 = _nodes[static_cast<size_t>(node.child2)];
+      CombineToRef(child1.min, child1.max, child2.min, child2.max, node.min, node.max);
+      node.height = 1 + std::max(child1.height, child2.height);
+
+      index = node.parent;
+    }
+  }
+  else {
+    _root                                       = sibling;
+    _nodes[static_cast<size_t>(sibling)].parent = NullNode;
+    _freeNode(parent);
+  }
+}
+
+template <class T>
+int DynamicAABBTree<T>::_balance(int iA)
+{
+  // Performs a left or right rotation if node A is imbalanced, returns the new
+  // root index of the sub-tree
+  auto& A = _nodes[static_cast<size_t>(iA)];
+  if (A.isLeaf() || A.height < 2) {
+    return iA;
+  }
+
+  const auto iB = A.child1;
+  const auto iC = A.child2;
+  auto& B       = _nodes[static_cast<size_t>(iB)];
+  auto& C       = _nodes[static_cast<size_t>(iC)];
+
+  const auto balance = C.height - B.height;
+
+  // Rotates the child X up, the other child staying under A
+  const auto rotate = [this, iA, &A](int iX, Node& X, Node& other) {
+    const auto iF = X.child1;
+    const auto iG = X.child2;
+    auto& F       = _nodes[static_cast<size_t>(iF)];
+    auto& G       = _nodes[static_cast<size_t>(iG)];
+
+    // Swap A and X
+    X.child1 = iA;
+    X.parent = A.parent;
+    A.parent = iX;
+
+    // A's old parent should point to X
+    if (X.parent != NullNode) {
+      auto& xParent = _nodes[static_cast<size_t>(X.parent)];
+      if (xParent.child1 == iA) {
+        xParent.child1 = iX;
+      }
+      else {
+        xParent.child2 = iX;
+      }
+    }
+    else {
+      _root = iX;
+    }
+
+    // Keep the taller grand child under X
+    const auto keepF = F.height > G.height;
+    const auto iKeep = keepF ? iF : iG;
+    const auto iMove = keepF ? iG : iF;
+    auto& keep       = keepF ? F : G;
+    auto& move       = keepF ? G : F;
+
+    X.child2 = iKeep;
+    if (A.child1 == iX) {
+      A.child1 = iMove;
+    }
+    else {
+      A.child2 = iMove;
+    }
+    move.parent = iA;
+    CombineToRef(other.min, other.max, move.min, move.max, A.min, A.max);
+    CombineToRef(A.min, A.max, keep.min, keep.max, X.min, X.max);
+    A.height = 1 + std::max(other.height, move.height);
+    X.height = 1 + std::max(A.height, keep.height);
+  };
+
+  // Rotate C up
+  if (balance > 1) {
+    rotate(iC, C, B);
+    return iC;
+  }
+
+  // Rotate B up
+  if (balance < -1) {
+    rotate(iB, B, C);
+    return iB;
+  }
+
+  return iA;
+}
+
+template <class T>
+void DynamicAABBTree<T>::queryBox(const Vector3& min, const Vector3& max,
+                                  std::vector<T>& results) const
+{
+  if (_root == NullNode) {
+    return;
+  }
+
+  std::vector<int> stack{_root};
+  while (!stack.empty()) {
+    const auto& node = _nodes[static_cast<size_t>(stack.back())];
+    stack.pop_back();
+    if (!Overlaps(node.min, node.max, min, max)) {
+      continue;
+    }
+    if (node.isLeaf()) {
+      results.emplace_back(node.data);
+    }
+    else {
+      stack.emplace_back(node.child1);
+      stack.emplace_back(node.child2);
+    }
+  }
+}
+
+template <class T>
+void DynamicAABBTree<T>::querySphere(const Vector3& center, float radius,
+                                     std::vector<T>& results) const
+{
+  if (_root == NullNode) {
+    return;
+  }
+
+  const auto radiusSquared = radius * radius;
+  std::vector<int> stack{_root};
+  while (!stack.empty()) {
+    const auto& node = _nodes[static_cast<size_t>(stack.back())];
+    stack.pop_back();
+    // Squared distance from the center to the box
+    const auto dx = std::max({node.min.x - center.x, 0.f, center.x - node.max.x});
+    const auto dy = std::max({node.min.y - center.y, 0.f, center.y - node.max.y});
+    const auto dz = std::max({node.min.z - center.z, 0.f, center.z - node.max.z});
+    if (dx * dx + dy * dy + dz * dz > radiusSquared) {
+      continue;
+    }
+    if (node.isLeaf()) {
+      results.emplace_back(node.data);
+    }
+    else {
+      stack.emplace_back(node.child1);
+      stack.emplace_back(node.child2);
+    }
+  }
+}
+
+template <class T>
+void DynamicAABBTree<T>::queryRay(const Ray& ray, std::vector<T>& results,
+                                  float intersectionThreshold) const
+{
+  if (_root == NullNode) {
+    return;
+  }
+
+  std::vector<int> stack{_root};
+  while (!stack.empty()) {
+    const auto& node = _nodes[static_cast<size_t>(stack.back())];
+    stack.pop_back();
+    if (!ray.intersectsBoxMinMax(node.min, node.max, intersectionThreshold)) {
+      continue;
+    }
+    if (node.isLeaf()) {
+      results.emplace_back(node.data);
+    }
+    else {
+      stack.emplace_back(node.child1);
+      stack.emplace_back(node.child2);
+    }
+  }
+}
+
+template <class T>
+size_t DynamicAABBTree<T>::proxyCount() const
+{
+  return _proxyCount;
+}
+
+template <class T>
+int DynamicAABBTree<T>::height() const
+{
+  return _root == NullNode ? -1 : _nodes[static_cast<size_t>(_root)].height;
+}
+
+template <class T>
+void DynamicAABBTree<T>::clear()
+{
+  _nodes.clear();
+  _root       = NullNode;
+  _freeList   = NullNode;
+  _proxyCount = 0;
+}
+
+template class DynamicAABBTree<AbstractMesh*>;
+template class DynamicAABBTree<Light*>;
+template class DynamicAABBTree<NativePhysicsBody*>;
+
+} // end of namespace BABYLON
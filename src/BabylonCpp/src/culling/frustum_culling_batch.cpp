@@ -0,0 +1,120 @@
+#include <babylon/culling/frustum_culling_batch.h>
+
+#include <babylon/culling/bounding_info.h>
+#include <babylon/engines/constants.h>
+
+namespace BABYLON {
+
+FrustumCullingBatch::FrustumCullingBatch() = default;
+
+FrustumCullingBatch::~FrustumCullingBatch() = default;
+
+void FrustumCullingBatch::resize(size_t count)
+{
+  _centerX.resize(count);
+  _centerY.resize(count);
+  _centerZ.resize(count);
+  _radius.resize(count);
+  _corners.resize(count * 24);
+  _strategies.resize(count);
+  _valid.resize(count);
+  _inFrustum.resize(count);
+}
+
+size_t FrustumCullingBatch::size() const
+{
+  return _inFrustum.size();
+}
+
+void FrustumCullingBatch::set(size_t index, const BoundingInfo* boundingInfo,
+                              unsigned int strategy)
+{
+  _valid[index] = boundingInfo != nullptr;
+  if (!boundingInfo) {
+    return;
+  }
+
+  const auto& sphere = boundingInfo->boundingSphere;
+  _centerX[index]    = sphere.centerWorld.x;
+  _centerY[index]    = sphere.centerWorld.y;
+  _centerZ[index]    = sphere.centerWorld.z;
+  _radius[index]     = sphere.radiusWorld;
+
+  auto corners = &_corners[index * 24];
+  for (unsigned int i = 0; i < 8; ++i) {
+    const auto& corner = boundingInfo->boundingBox.vectorsWorld[i];
+    corners[i]         = corner.x;
+    corners[8 + i]     = corner.y;
+    corners[16 + i]    = corner.z;
+  }
+  _strategies[index] = static_cast<uint8_t>(strategy);
+}
+
+void FrustumCullingBatch::cull(const std::array<Plane, 6>& frustumPlanes, size_t begin,
+                               size_t end)
+{
+  float planes[6][4];
+  for (unsigned int p = 0; p < 6; ++p) {
+    planes[p][0] = frustumPlanes[p].normal.x;
+    planes[p][1] = frustumPlanes[p].normal.y;
+    planes[p][2] = frustumPlanes[p].normal.z;
+    planes[p][3] = frustumPlanes[p].d;
+  }
+
+  // Pass 1: bounding spheres (branch free, vectorizable over the entries)
+  for (size_t i = begin; i < end; ++i) {
+    const auto cx = _centerX[i], cy = _centerY[i], cz = _centerZ[i], r = _radius[i];
+    bool sphereIn = true, centerIn = true;
+    for (unsigned int p = 0; p < 6; ++p) {
+      const auto dot = planes[p][0] * cx + planes[p][1] * cy + planes[p][2] * cz + planes[p][3];
+      sphereIn       = sphereIn && !(dot <= -r);
+      centerIn       = centerIn && !(dot < 0.f);
+    }
+    // bit 0: sphere intersects the frustum, bit 1: sphere center is inside
+    _inFrustum[i] = static_cast<uint8_t>((sphereIn ? 1 : 0) | (centerIn ? 2 : 0));
+  }
+
+  // Pass 2: resolve the culling strategies, boxes are only tested when needed
+  for (size_t i = begin; i < end; ++i) {
+    if (!_valid[i]) {
+      _inFrustum[i] = 0;
+      continue;
+    }
+    const auto sphereResult = _inFrustum[i];
+    const auto strategy     = _strategies[i];
+    const auto inclusionTest
+      = (strategy == Constants::MESHES_CULLINGSTRATEGY_OPTIMISTIC_INCLUSION
+         || strategy == Constants::MESHES_CULLINGSTRATEGY_OPTIMISTIC_INCLUSION_THEN_BSPHERE_ONLY);
+    if (inclusionTest && (sphereResult & 2)) {
+      _inFrustum[i] = 1;
+      continue;
+    }
+    if (!(sphereResult & 1)) {
+      _inFrustum[i] = 0;
+      continue;
+    }
+    const auto bSphereOnlyTest
+      = (strategy == Constants::MESHES_CULLINGSTRATEGY_BOUNDINGSPHERE_ONLY
+         || strategy == Constants::MESHES_CULLINGSTRATEGY_OPTIMISTIC_INCLUSION_THEN_BSPHERE_ONLY);
+    if (bSphereOnlyTest) {
+      _inFrustum[i] = 1;
+      continue;
+    }
+
+    // Same test as BoundingBox::IsInFrustum
+    const auto corners = &_corners[i * 24];
+    bool boxIn         = true;
+    for (unsigned int p = 0; p < 6 && boxIn; ++p) {
+      bool canReturnFalse = true;
+      for (unsigned int c = 0; c < 8; ++c) {
+        const auto dot = planes[p][0] * corners[c] + planes[p][1] * corners[8 + c]
+                         + planes[p][2] * corners[16 + c] + planes[p][3];
+        canReturnFalse = canReturnFalse && !(dot >= 0.f);
+      }
+      boxIn = !canReturnFalse;
+    }
+    _inFrustum[i] = boxIn ? 1 : 0;
+  }
+}
+
+} // end of namespace BABYLON
@@ -11,17 +11,20 @@
 namespace BABYLON {
 
 template <class T>
-Octree<T>::Octree() = default;
+Octree<T>::Octree()
+    : maxDepth{2}, _maxBlockCapacity{64}, _selectionStamp{0}, _entryCount{0}
+{
+}
 
 template <class T>
-Octree<T>::Octree(
-  const std::function<void(T& entry, OctreeBlock<T>& block)>& creationFunc,
-  size_t maxBlockCapacity, size_t iMaxDepth)
+Octree<T>::Octree(const BoundsFunc& boundsFunc, size_t maxBlockCapacity, size_t iMaxDepth)
     : maxDepth{iMaxDepth}
     , _maxBlockCapacity{maxBlockCapacity}
-    , _creationFunc{creationFunc}
+    , _selectionStamp{0}
+    , _entryCount{0}
+    , _boundsFunc{boundsFunc}
 {
-  _selectionContent.resize(1024);
+  _selectionContent.reserve(1024);
 }
 
 template <class T>
@@ -29,65 +32,225 @@ Octree<T>::~Octree() = default;
 
 template <class T>
 void Octree<T>::update(const Vector3& worldMin, const Vector3& worldMax,
-                       std::vector<T>& entries)
+                       const std::vector<T>& entries)
 {
-  OctreeBlock<T>::_CreateBlocks(worldMin, worldMax, entries, _maxBlockCapacity,
-                                0, maxDepth, *this, _creationFunc);
+  auto& blocks = IOctreeContainer<T>::blocks;
+  blocks.clear();
+  _locations.clear();
+  _entryCount = 0;
+
+  // Root block, also storing the entries which do not fit in a deeper block
+  blocks.emplace_back(worldMin, worldMax, _maxBlockCapacity, 0, maxDepth);
+
+  for (const auto& entry : entries) {
+    updateMesh(entry);
+  }
 }
 
 template <class T>
-void Octree<T>::addMesh(T& entry)
+void Octree<T>::addMesh(const T& entry)
 {
-  for (auto& block : IOctreeContainer<T>::blocks) {
-    block.addEntry(entry);
+  updateMesh(entry);
+}
+
+template <class T>
+void Octree<T>::removeMesh(const T& entry)
+{
+  auto it = _locations.find(entry);
+  if (it == _locations.end()) {
+    return;
+  }
+
+  if (it->second.block) {
+    _detach(it->second);
   }
+  _locations.erase(it);
 }
 
 template <class T>
-void Octree<T>::removeMesh(T& entry)
+void Octree<T>::updateMesh(const T& entry)
 {
-  for (auto& block : IOctreeContainer<T>::blocks) {
-    block.removeEntry(entry);
+  auto& blocks = IOctreeContainer<T>::blocks;
+  if (blocks.empty()) {
+    return;
+  }
+
+  Vector3 min, max;
+  if (!_boundsFunc || !_boundsFunc(entry, min, max)) {
+    removeMesh(entry);
+    return;
+  }
+
+  auto it = _locations.find(entry);
+  if (it == _locations.end() || !it->second.block) {
+    _insert(entry, min, max);
+    return;
+  }
+
+  // The entry stays in its block while it is in its loose bounds and cannot be
+  // stored deeper
+  auto& location        = it->second;
+  auto& block           = *location.block;
+  auto& root            = blocks.front();
+  const auto center     = min.add(max).scaleInPlace(0.5f);
+  const auto extendSize = max.subtract(min).scaleInPlace(0.5f);
+  const auto fitsDeeper
+    = !block.blocks.empty() && block.blocks[block.childIndex(center)].fits(center, extendSize);
+  if ((&block == &root || block.fits(center, extendSize)) && !fitsDeeper) {
+    if (&block == &root) {
+      root.extendLooseBounds(min, max);
+    }
+    return;
   }
+
+  _detach(location);
+  _insert(entry, min, max);
 }
 
 template <class T>
-std::vector<T>& Octree<T>::select(const std::array<Plane, 6>& frustumPlanes,
-                                  bool allowDuplicate)
+bool Octree<T>::contains(const T& entry) const
 {
-  _selectionContent.clear();
+  auto it = _locations.find(entry);
+  return it != _locations.end() && it->second.block != nullptr;
+}
 
-  for (auto& block : IOctreeContainer<T>::blocks) {
-    block.select(frustumPlanes, _selectionContent, allowDuplicate);
+template <class T>
+size_t Octree<T>::entryCount() const
+{
+  return _entryCount;
+}
+
+template <class T>
+void Octree<T>::_insert(const T& entry, const Vector3& min, const Vector3& max)
+{
+  auto& root            = IOctreeContainer<T>::blocks.front();
+  const auto center     = min.add(max).scaleInPlace(0.5f);
+  const auto extendSize = max.subtract(min).scaleInPlace(0.5f);
+
+  // Deepest existing block whose loose bounds contain the entry
+  auto block = &root;
+  while (!block->blocks.empty()) {
+    auto& child = block->blocks[block->childIndex(center)];
+    if (!child.fits(center, extendSize)) {
+      break;
+    }
+    block = &child;
+  }
+
+  if (block == &root) {
+    root.extendLooseBounds(min, max);
   }
 
+  _place(entry, *block);
+  ++_entryCount;
+
+  if (block->blocks.empty() && block->entries.size() > _maxBlockCapacity
+      && block->depth() < maxDepth) {
+    _split(*block);
+  }
+}
+
+template <class T>
+void Octree<T>::_place(const T& entry, OctreeBlock<T>& block)
+{
+  auto& location = _locations[entry];
+  location.block = &block;
+  location.index = block.entries.size();
+  block.entries.emplace_back(entry);
+}
+
+template <class T>
+void Octree<T>::_detach(EntryLocation& location)
+{
+  // Swap and pop, the moved entry gets the index of the removed one
+  auto& entries    = location.block->entries;
+  const auto index = location.index;
+  if (index + 1 < entries.size()) {
+    entries[index]                   = entries.back();
+    _locations[entries[index]].index = index;
+  }
+  entries.pop_back();
+  location.block = nullptr;
+  --_entryCount;
+}
+
+template <class T>
+void Octree<T>::_split(OctreeBlock<T>& block)
+{
+  block.createInnerBlocks();
+
+  // Moves down the entries fitting in a child block
+  auto entries = std::move(block.entries);
+  block.entries.clear();
+  Vector3 min, max;
+  for (const auto& entry : entries) {
+    if (_boundsFunc(entry, min, max)) {
+      const auto center     = min.add(max).scaleInPlace(0.5f);
+      const auto extendSize = max.subtract(min).scaleInPlace(0.5f);
+      auto& child           = block.blocks[block.childIndex(center)];
+      if (child.fits(center, extendSize)) {
+        _place(entry, child);
+        continue;
+      }
+    }
+    _place(entry, block);
+  }
+
+  for (auto& child : block.blocks) {
+    if (child.entries.size() > _maxBlockCapacity && child.depth() < maxDepth) {
+      _split(child);
+    }
+  }
+}
+
+template <class T>
+void Octree<T>::_addDynamicContent(bool allowDuplicate)
+{
   if (allowDuplicate) {
     stl_util::concat(_selectionContent, dynamicContent);
+    return;
   }
-  else {
-    stl_util::concat_with_no_duplicates(_selectionContent, dynamicContent);
+
+  // Skips the entries of the selected blocks and the entries already added,
+  // using the stamp of the current selection
+  for (const auto& entry : dynamicContent) {
+    auto& location = _locations[entry];
+    if ((location.block && location.block->_selectionStamp == _selectionStamp)
+        || location.stamp == _selectionStamp) {
+      continue;
+    }
+    location.stamp = _selectionStamp;
+    _selectionContent.emplace_back(entry);
   }
+}
+
+template <class T>
+std::vector<T>& Octree<T>::select(const std::array<Plane, 6>& frustumPlanes, bool allowDuplicate)
+{
+  _selectionContent.clear();
+  ++_selectionStamp;
+
+  for (auto& block : IOctreeContainer<T>::blocks) {
+    block.select(frustumPlanes, _selectionContent, _selectionStamp);
+  }
+
+  _addDynamicContent(allowDuplicate);
 
   return _selectionContent;
 }
 
 template <class T>
-std::vector<T>& Octree<T>::intersects(const Vector3& sphereCenter,
-                                      float sphereRadius, bool allowDuplicate)
+std::vector<T>& Octree<T>::intersects(const Vector3& sphereCenter, float sphereRadius,
+                                      bool allowDuplicate)
 {
   _selectionContent.clear();
+  ++_selectionStamp;
 
   for (auto& block : IOctreeContainer<T>::blocks) {
-    block.intersects(sphereCenter, sphereRadius, _selectionContent,
-                     allowDuplicate);
+    block.intersects(sphereCenter, sphereRadius, _selectionContent, _selectionStamp);
   }
 
-  if (allowDuplicate) {
-    stl_util::concat(_selectionContent, dynamicContent);
-  }
-  else {
-    stl_util::concat_with_no_duplicates(_selectionContent, dynamicContent);
-  }
+  _addDynamicContent(allowDuplicate);
 
   return _selectionContent;
 }
@@ -96,37 +259,41 @@ template <class T>
 std::vector<T>& Octree<T>::intersectsRay(const Ray& ray)
 {
   _selectionContent.clear();
+  ++_selectionStamp;
 
   for (auto& block : IOctreeContainer<T>::blocks) {
-    block.intersectsRay(ray, _selectionContent);
+    block.intersectsRay(ray, _selectionContent, _selectionStamp);
   }
 
-  stl_util::concat_with_no_duplicates(_selectionContent, dynamicContent);
+  _addDynamicContent(false);
 
   return _selectionContent;
 }
 
 template <class T>
-void Octree<T>::CreationFuncForMeshes(AbstractMesh* entry,
-                                      OctreeBlock<AbstractMesh*>& block)
+bool Octree<T>::BoundsFuncForMeshes(AbstractMesh* const& entry, Vector3& min, Vector3& max)
 {
-  const auto boundingInfo = entry->getBoundingInfo();
-  if (!entry->isBlocked()
-      && boundingInfo->boundingBox.intersectsMinMax(block.minPoint(),
-                                                    block.maxPoint())) {
-    block.entries.emplace_back(entry);
+  const auto& boundingInfo = entry->getBoundingInfo();
+  if (entry->isBlocked() || !boundingInfo) {
+    return false;
   }
+
+  min = boundingInfo->boundingBox.minimumWorld;
+  max = boundingInfo->boundingBox.maximumWorld;
+  return true;
 }
 
 template <class T>
-void Octree<T>::CreationFuncForSubMeshes(SubMesh* entry,
-                                         OctreeBlock<SubMesh*>& block)
+bool Octree<T>::BoundsFuncForSubMeshes(SubMesh* const& entry, Vector3& min, Vector3& max)
 {
-  const auto boundingInfo = entry->getBoundingInfo();
-  if (boundingInfo->boundingBox.intersectsMinMax(block.minPoint(),
-                                                 block.maxPoint())) {
-    block.entries.emplace_back(entry);
+  const auto& boundingInfo = entry->getBoundingInfo();
+  if (!boundingInfo) {
+    return false;
   }
+
+  min = boundingInfo->boundingBox.minimumWorld;
+  max = boundingInfo->boundingBox.maximumWorld;
+  return true;
 }
 
 template class Octree<AbstractMesh*>;
@@ -2,7 +2,6 @@
 
 #include <babylon/babylon_stl_util.h>
 #include <babylon/culling/bounding_box.h>
-#include <babylon/culling/bounding_info.h>
 #include <babylon/culling/ray.h>
 #include <babylon/meshes/abstract_mesh.h>
 #include <babylon/meshes/sub_mesh.h>
@@ -10,39 +9,23 @@
 namespace BABYLON {
 
 template <class T>
-OctreeBlock<T>::OctreeBlock(
-  const Vector3& iMinPoint, const Vector3& iMaxPoint, size_t iCapacity,
-  size_t depth, size_t maxDepth,
-  const std::function<void(T&, OctreeBlock<T>&)>& creationFunc)
+OctreeBlock<T>::OctreeBlock(const Vector3& iMinPoint, const Vector3& iMaxPoint, size_t iCapacity,
+                            size_t depth, size_t maxDepth)
+    : _selectionStamp{0}
 {
-  _capacity     = iCapacity;
-  _depth        = depth;
-  _maxDepth     = maxDepth;
-  _creationFunc = creationFunc;
+  _capacity = iCapacity;
+  _depth    = depth;
+  _maxDepth = maxDepth;
 
   _minPoint = iMinPoint;
   _maxPoint = iMaxPoint;
 
-  _boundingVectors[0] = _minPoint;
-  _boundingVectors[1] = _maxPoint;
+  // The loose bounds are twice as large as the cell
+  const auto extendSize = _maxPoint.subtract(_minPoint).scaleInPlace(0.5f);
+  _looseMinPoint        = _minPoint.subtract(extendSize);
+  _looseMaxPoint        = _maxPoint.add(extendSize);
 
-  _boundingVectors[2]   = _minPoint;
-  _boundingVectors[2].x = _maxPoint.x;
-
-  _boundingVectors[3]   = _minPoint;
-  _boundingVectors[3].y = _maxPoint.y;
-
-  _boundingVectors[4]   = _minPoint;
-  _boundingVectors[4].z = _maxPoint.z;
-
-  _boundingVectors[5]   = _maxPoint;
-  _boundingVectors[5].z = _minPoint.z;
-
-  _boundingVectors[6]   = _maxPoint;
-  _boundingVectors[6].x = _minPoint.x;
-
-  _boundingVectors[7]   = _maxPoint;
-  _boundingVectors[7].y = _minPoint.y;
+  _updateBoundingVectors();
 }
 
 template <class T>
@@ -54,6 +37,12 @@ size_t OctreeBlock<T>::capacity() const
   return _capacity;
 }
 
+template <class T>
+size_t OctreeBlock<T>::depth() const
+{
+  return _depth;
+}
+
 template <class T>
 Vector3& OctreeBlock<T>::minPoint()
 {
@@ -67,136 +56,137 @@ Vector3& OctreeBlock<T>::maxPoint()
 }
 
 template <class T>
-void OctreeBlock<T>::addEntry(T& entry)
+Vector3& OctreeBlock<T>::looseMinPoint()
 {
-  if (!IOctreeContainer<T>::blocks.empty()) {
-    for (auto& block : IOctreeContainer<T>::blocks) {
-      block.addEntry(entry);
-    }
-    return;
-  }
-
-  _creationFunc(entry, *this);
+  return _looseMinPoint;
+}
 
-  if (entries.size() > _capacity && _depth < _maxDepth) {
-    createInnerBlocks();
-  }
+template <class T>
+Vector3& OctreeBlock<T>::looseMaxPoint()
+{
+  return _looseMaxPoint;
 }
 
 template <class T>
-void OctreeBlock<T>::removeEntry(T& entry)
+void OctreeBlock<T>::_updateBoundingVectors()
 {
-  if (!IOctreeContainer<T>::blocks.empty()) {
-    for (auto& block : IOctreeContainer<T>::blocks) {
-      block.removeEntry(entry);
-    }
-    return;
-  }
+  _boundingVectors[0] = _looseMinPoint;
+  _boundingVectors[1] = _looseMaxPoint;
 
-  const auto entryIndex = std::find(entries.begin(), entries.end(), entry);
+  _boundingVectors[2]   = _looseMinPoint;
+  _boundingVectors[2].x = _looseMaxPoint.x;
 
-  if (entryIndex != entries.end()) {
-    entries.erase(entryIndex);
-  }
+  _boundingVectors[3]   = _looseMinPoint;
+  _boundingVectors[3].y = _looseMaxPoint.y;
+
+  _boundingVectors[4]   = _looseMinPoint;
+  _boundingVectors[4].z = _looseMaxPoint.z;
+
+  _boundingVectors[5]   = _looseMaxPoint;
+  _boundingVectors[5].z = _looseMinPoint.z;
+
+  _boundingVectors[6]   = _looseMaxPoint;
+  _boundingVectors[6].x = _looseMinPoint.x;
+
+  _boundingVectors[7]   = _looseMaxPoint;
+  _boundingVectors[7].y = _looseMinPoint.y;
 }
 
 template <class T>
-void OctreeBlock<T>::addEntries(std::vector<T>& _entries)
+bool OctreeBlock<T>::fits(const Vector3& center, const Vector3& extendSize) const
 {
-  for (auto& mesh : _entries) {
-    addEntry(mesh);
+  // The loose bounds contain any box centered in the cell and whose half size
+  // does not exceed the half size of the cell
+  return center.x >= _minPoint.x && center.x <= _maxPoint.x && center.y >= _minPoint.y
+         && center.y <= _maxPoint.y && center.z >= _minPoint.z && center.z <= _maxPoint.z
+         && extendSize.x * 2.f <= _maxPoint.x - _minPoint.x
+         && extendSize.y * 2.f <= _maxPoint.y - _minPoint.y
+         && extendSize.z * 2.f <= _maxPoint.z - _minPoint.z;
+}
+
+template <class T>
+size_t OctreeBlock<T>::childIndex(const Vector3& point) const
+{
+  // Same ordering as createInnerBlocks: x major, z minor
+  const auto center = _minPoint.add(_maxPoint).scaleInPlace(0.5f);
+  return (point.x >= center.x ? 4 : 0) + (point.y >= center.y ? 2 : 0)
+         + (point.z >= center.z ? 1 : 0);
+}
+
+template <class T>
+void OctreeBlock<T>::extendLooseBounds(const Vector3& min, const Vector3& max)
+{
+  if (min.x >= _looseMinPoint.x && min.y >= _looseMinPoint.y && min.z >= _looseMinPoint.z
+      && max.x <= _looseMaxPoint.x && max.y <= _looseMaxPoint.y && max.z <= _looseMaxPoint.z) {
+    return;
   }
+
+  _looseMinPoint.minimizeInPlace(min);
+  _looseMaxPoint.maximizeInPlace(max);
+  _updateBoundingVectors();
 }
 
 template <class T>
-void OctreeBlock<T>::select(const std::array<Plane, 6>& frustumPlanes,
-                            std::vector<T>& selection, bool allowDuplicate)
+void OctreeBlock<T>::select(const std::array<Plane, 6>& frustumPlanes, std::vector<T>& selection,
+                            size_t selectionStamp)
 {
   if (BoundingBox::IsInFrustum(_boundingVectors, frustumPlanes)) {
-    if (!IOctreeContainer<T>::blocks.empty()) {
-      for (auto& block : IOctreeContainer<T>::blocks) {
-        block.select(frustumPlanes, selection, allowDuplicate);
-      }
-      return;
-    }
-
-    if (allowDuplicate) {
-      stl_util::concat(selection, entries);
-    }
-    else {
-      stl_util::concat_with_no_duplicates(selection, entries);
+    _selectionStamp = selectionStamp;
+    stl_util::concat(selection, entries);
+    for (auto& block : IOctreeContainer<T>::blocks) {
+      block.select(frustumPlanes, selection, selectionStamp);
     }
   }
 }
 
 template <class T>
 void OctreeBlock<T>::intersects(const Vector3& sphereCenter, float sphereRadius,
-                                std::vector<T>& selection, bool allowDuplicate)
+                                std::vector<T>& selection, size_t selectionStamp)
 {
-  if (BoundingBox::IntersectsSphere(_minPoint, _maxPoint, sphereCenter,
-                                    sphereRadius)) {
-    if (!IOctreeContainer<T>::blocks.empty()) {
-      for (auto& block : IOctreeContainer<T>::blocks) {
-        block.intersects(sphereCenter, sphereRadius, selection, allowDuplicate);
-      }
-      return;
-    }
-
-    if (allowDuplicate) {
-      stl_util::concat(selection, entries);
-    }
-    else {
-      stl_util::concat_with_no_duplicates(selection, entries);
+  if (BoundingBox::IntersectsSphere(_looseMinPoint, _looseMaxPoint, sphereCenter, sphereRadius)) {
+    _selectionStamp = selectionStamp;
+    stl_util::concat(selection, entries);
+    for (auto& block : IOctreeContainer<T>::blocks) {
+      block.intersects(sphereCenter, sphereRadius, selection, selectionStamp);
     }
   }
 }
 
 template <class T>
-void OctreeBlock<T>::intersectsRay(const Ray& ray, std::vector<T>& selection)
+void OctreeBlock<T>::intersectsRay(const Ray& ray, std::vector<T>& selection,
+                                   size_t selectionStamp)
 {
-  if (ray.intersectsBoxMinMax(_minPoint, _maxPoint)) {
-    if (!IOctreeContainer<T>::blocks.empty()) {
-      for (auto& block : IOctreeContainer<T>::blocks) {
-        block.intersectsRay(ray, selection);
-      }
-      return;
+  if (ray.intersectsBoxMinMax(_looseMinPoint, _looseMaxPoint)) {
+    _selectionStamp = selectionStamp;
+    stl_util::concat(selection, entries);
+    for (auto& block : IOctreeContainer<T>::blocks) {
+      block.intersectsRay(ray, selection, selectionStamp);
     }
-    stl_util::concat_with_no_duplicates(selection, entries);
   }
 }
 
 template <class T>
 void OctreeBlock<T>::createInnerBlocks()
 {
-  OctreeBlock<T>::_CreateBlocks(_minPoint, _maxPoint, entries, _capacity,
-                                _depth, _maxDepth, *this, _creationFunc);
-}
+  auto& blocks = IOctreeContainer<T>::blocks;
+  if (!blocks.empty()) {
+    return;
+  }
 
-template <class T>
-void OctreeBlock<T>::_CreateBlocks(
-  const Vector3& worldMin, const Vector3& worldMax, std::vector<T>& entries,
-  size_t maxBlockCapacity, size_t currentDepth, size_t maxDepth,
-  IOctreeContainer<T>& target,
-  const std::function<void(T&, OctreeBlock<T>&)>& creationFunc)
-{
-  target.blocks.clear();
-  Vector3 blockSize((worldMax.x - worldMin.x) / 2.f,
-                    (worldMax.y - worldMin.y) / 2.f,
-                    (worldMax.z - worldMin.z) / 2.f);
+  const Vector3 blockSize((_maxPoint.x - _minPoint.x) / 2.f, (_maxPoint.y - _minPoint.y) / 2.f,
+                          (_maxPoint.z - _minPoint.z) / 2.f);
 
-  // Segmenting space
+  // Segmenting space, the blocks are never reallocated afterwards so that the
+  // octree can keep pointers to them
+  blocks.reserve(8);
   for (int x = 0; x < 2; ++x) {
     for (int y = 0; y < 2; ++y) {
       for (int z = 0; z < 2; ++z) {
-        const auto& localMin
-          = worldMin.add(blockSize.multiplyByFloats((float)x, (float)y, (float)z));
-        const auto& localMax
-          = worldMin.add(blockSize.multiplyByFloats((float)x + 1.f, (float)y + 1.f, (float)z + 1.f));
-
-        OctreeBlock<T> block(localMin, localMax, maxBlockCapacity,
-                             currentDepth + 1, maxDepth, creationFunc);
-        block.addEntries(entries);
-        target.blocks.emplace_back(block);
+        const auto localMin
+          = _minPoint.add(blockSize.multiplyByFloats((float)x, (float)y, (float)z));
+        const auto localMax = _minPoint.add(
+          blockSize.multiplyByFloats((float)x + 1.f, (float)y + 1.f, (float)z + 1.f));
+        blocks.emplace_back(localMin, localMax, _capacity, _depth + 1, _maxDepth);
       }
     }
   }
@@ -62,6 +62,8 @@ void OctreeSceneComponent::_register()
 std::vector<AbstractMesh*> OctreeSceneComponent::getActiveMeshCandidates()
 {
   if (scene->selectionOctree()) {
+    // Refits the meshes moved since the last frame before the selection
+    scene->_updateMeshesTree();
     auto selection = scene->selectionOctree()->select(scene->frustumPlanes());
     return selection;
   }
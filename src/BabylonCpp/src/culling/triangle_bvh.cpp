@@ -0,0 +1,296 @@
+#include <babylon/culling/triangle_bvh.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <babylon/collisions/intersection_info.h>
+#include <babylon/culling/ray.h>
+#include <babylon/maths/vector3.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Relative padding applied to the node boxes to make the slab test
+// conservative for triangles lying on a box face
+constexpr float BoxPadding = 1e-5f;
+
+} // end of anonymous namespace
+
+TriangleBVH::TriangleBVH(const std::vector<Vector3>& positions, const IndicesArray& indices,
+                         size_t indexStart, size_t indexCount)
+    : _indexStart{indexStart}
+{
+  const auto nbTriangles = indexCount / 3;
+  if (nbTriangles == 0) {
+    return;
+  }
+
+  // Triangle bounds and centroids
+  std::vector<std::array<float, 3>> mins(nbTriangles), maxs(nbTriangles), centroids(nbTriangles);
+  _faceIds.resize(nbTriangles);
+  for (size_t faceId = 0; faceId < nbTriangles; ++faceId) {
+    const auto index = indexStart + faceId * 3;
+    const auto& p0   = positions[indices[index]];
+    const auto& p1   = positions[indices[index + 1]];
+    const auto& p2   = positions[indices[index + 2]];
+    mins[faceId]     = {std::min({p0.x, p1.x, p2.x}), std::min({p0.y, p1.y, p2.y}),
+                        std::min({p0.z, p1.z, p2.z})};
+    maxs[faceId]     = {std::max({p0.x, p1.x, p2.x}), std::max({p0.y, p1.y, p2.y}),
+                        std::max({p0.z, p1.z, p2.z})};
+    for (unsigned int axis = 0; axis < 3; ++axis) {
+      centroids[faceId][axis] = (mins[faceId][axis] + maxs[faceId][axis]) * 0.5f;
+    }
+    _faceIds[faceId] = static_cast<uint32_t>(faceId);
+  }
+
+  // Top-down build, splitting each node at the median of its longest centroid
+  // axis
+  struct BuildTask {
+    size_t node;
+    size_t begin;
+    size_t end;
+  };
+  _nodes.reserve(2 * nbTriangles / MaxLeafSize + 1);
+  _nodes.emplace_back();
+  std::vector<BuildTask> stack{{0, 0, nbTriangles}};
+  while (!stack.empty()) {
+    const auto task = stack.back();
+    stack.pop_back();
+
+    std::array<float, 3> min{(std::numeric_limits<float>::max)(),
+                             (std::numeric_limits<float>::max)(),
+                             (std::numeric_limits<float>::max)()};
+    std::array<float, 3> max{std::numeric_limits<float>::lowest(),
+                             std::numeric_limits<float>::lowest(),
+                             std::numeric_limits<float>::lowest()};
+    std::array<float, 3> centroidMin = min, centroidMax = max;
+    for (size_t i = task.begin; i < task.end; ++i) {
+      const auto faceId = _faceIds[i];
+      for (unsigned int axis = 0; axis < 3; ++axis) {
+        min[axis]         = std::min(min[axis], mins[faceId][axis]);
+        max[axis]         = std::max(max[axis], maxs[faceId][axis]);
+        centroidMin[axis] = std::min(centroidMin[axis], centroids[faceId][axis]);
+        centroidMax[axis] = std::max(centroidMax[axis], centroids[faceId][axis]);
+      }
+    }
+    for (unsigned int axis = 0; axis < 3; ++axis) {
+      const auto padding = (std::abs(min[axis]) + std::abs(max[axis]) + 1.f) * BoxPadding;
+      min[axis] -= padding;
+      max[axis] += padding;
+    }
+
+    unsigned int axis = 0;
+    for (unsigned int a = 1; a < 3; ++a) {
+      if (centroidMax[a] - centroidMin[a] > centroidMax[axis] - centroidMin[axis]) {
+        axis = a;
+      }
+    }
+
+    auto& node = _nodes[task.node];
+    node.min   = min;
+    node.max   = max;
+    const auto count = task.end - task.begin;
+    if (count <= MaxLeafSize || centroidMax[axis] <= centroidMin[axis]) {
+      node.offset = static_cast<uint32_t>(task.begin);
+      node.count  = static_cast<uint32_t>(count);
+      continue;
+    }
+
+    const auto middle = task.begin + count / 2;
+    std::nth_element(_faceIds.begin() + static_cast<std::ptrdiff_t>(task.begin),
+                     _faceIds.begin() + static_cast<std::ptrdiff_t>(middle),
+                     _faceIds.begin() + static_cast<std::ptrdiff_t>(task.end),
+                     [&centroids, axis](uint32_t a, uint32_t b) {
+                       return centroids[a][axis] < centroids[b][axis];
+                     });
+
+    const auto left = _nodes.size();
+    node.offset     = static_cast<uint32_t>(left);
+    node.count      = 0;
+    // node is invalidated here
+    _nodes.emplace_back();
+    _nodes.emplace_back();
+    stack.push_back({left, task.begin, middle});
+    stack.push_back({left + 1, middle, task.end});
+  }
+}
+
+TriangleBVH::~TriangleBVH() = default;
+
+size_t TriangleBVH::triangleCount() const
+{
+  return _faceIds.size();
+}
+
+size_t TriangleBVH::nodeCount() const
+{
+  return _nodes.size();
+}
+
+bool TriangleBVH::_intersectsNode(const Node& node, const Ray& ray,
+                                  const std::array<float, 3>& inverseDirection, float maxDistance,
+                                  float& distance) const
+{
+  const std::array<float, 3> origin{ray.origin.x, ray.origin.y, ray.origin.z};
+  auto tmin = 0.f, tmax = maxDistance;
+  for (unsigned int axis = 0; axis < 3; ++axis) {
+    if (inverseDirection[axis] == std::numeric_limits<float>::infinity()) {
+      // Ray parallel to the slab
+      if (origin[axis] < node.min[axis] || origin[axis] > node.max[axis]) {
+        return false;
+      }
+      continue;
+    }
+    auto t0 = (node.min[axis] - origin[axis]) * inverseDirection[axis];
+    auto t1 = (node.max[axis] - origin[axis]) * inverseDirection[axis];
+    if (t0 > t1) {
+      std::swap(t0, t1);
+    }
+    tmin = std::max(tmin, t0);
+    tmax = std::min(tmax, t1);
+    if (tmin > tmax) {
+      return false;
+    }
+  }
+  distance = tmin;
+  return true;
+}
+
+std::optional<IntersectionInfo>
+TriangleBVH::intersects(Ray& ray, const std::vector<Vector3>& positions,
+                        const IndicesArray& indices, bool fastCheck,
+                        const TrianglePickingPredicate& trianglePredicate) const
+{
+  std::optional<IntersectionInfo> intersectInfo = std::nullopt;
+  if (_nodes.empty()) {
+    return intersectInfo;
+  }
+
+  const std::array<float, 3> direction{ray.direction.x, ray.direction.y, ray.direction.z};
+  std::array<float, 3> inverseDirection{};
+  for (unsigned int axis = 0; axis < 3; ++axis) {
+    inverseDirection[axis] = direction[axis] == 0.f ? std::numeric_limits<float>::infinity() :
+                                                      1.f / direction[axis];
+  }
+
+  // Nodes further than the ray length or than the closest hit are skipped
+  const auto rayLength = ray.length;
+  auto maxDistance     = rayLength;
+
+  float distance = 0.f;
+  if (!_intersectsNode(_nodes[0], ray, inverseDirection, maxDistance, distance)) {
+    return intersectInfo;
+  }
+
+  std::vector<std::pair<uint32_t, float>> stack;
+  stack.reserve(64);
+  stack.emplace_back(0u, distance);
+  while (!stack.empty()) {
+    const auto [nodeIndex, entryDistance] = stack.back();
+    stack.pop_back();
+    // Hits at the same distance are kept to favor the lowest face id
+    if (intersectInfo && entryDistance > intersectInfo->distance) {
+      continue;
+    }
+
+    const auto& node = _nodes[nodeIndex];
+    if (node.count > 0) {
+      for (uint32_t i = node.offset; i < node.offset + node.count; ++i) {
+        const auto faceId = _faceIds[i];
+        const auto index  = _indexStart + faceId * 3;
+        const auto& p0    = positions[indices[index]];
+        const auto& p1    = positions[indices[index + 1]];
+        const auto& p2    = positions[indices[index + 2]];
+
+        if (trianglePredicate && !trianglePredicate(p0, p1, p2, ray)) {
+          continue;
+        }
+
+        auto currentIntersectInfo = ray.intersectsTriangle(p0, p1, p2);
+        if (!currentIntersectInfo || currentIntersectInfo->distance < 0.f) {
+          continue;
+        }
+
+        if (fastCheck || !intersectInfo
+            || currentIntersectInfo->distance < intersectInfo->distance
+            || (currentIntersectInfo->distance == intersectInfo->distance
+                && faceId < intersectInfo->faceId)) {
+          intersectInfo         = std::move(currentIntersectInfo);
+          intersectInfo->faceId = faceId;
+          if (fastCheck) {
+            return intersectInfo;
+          }
+          maxDistance = std::min(rayLength, intersectInfo->distance);
+        }
+      }
+      continue;
+    }
+
+    // Visit the nearest child first
+    float leftDistance = 0.f, rightDistance = 0.f;
+    const auto leftHit
+      = _intersectsNode(_nodes[node.offset], ray, inverseDirection, maxDistance, leftDistance);
+    const auto rightHit
+      = _intersectsNode(_nodes[node.offset + 1], ray, inverseDirection, maxDistance, rightDistance);
+    if (leftHit && rightHit) {
+      if (leftDistance <= rightDistance) {
+        stack.emplace_back(node.offset + 1, rightDistance);
+        stack.emplace_back(node.offset, leftDistance);
+      }
+      else {
+        stack.emplace_back(node.offset, leftDistance);
+        stack.emplace_back(node.offset + 1, rightDistance);
+      }
+    }
+    else if (leftHit) {
+      stack.emplace_back(node.offset, leftDistance);
+    }
+    else if (rightHit) {
+      stack.emplace_back(node.offset + 1, rightDistance);
+    }
+  }
+
+  return intersectInfo;
+}
+
+void TriangleBVH::queryBox(const Vector3& min, const Vector3& max,
+                           std::vector<uint32_t>& faceIds) const
+{
+  if (_nodes.empty()) {
+    return;
+  }
+
+  const std::array<float, 3> boxMin{min.x, min.y, min.z};
+  const std::array<float, 3> boxMax{max.x, max.y, max.z};
+  const auto overlaps = [&boxMin, &boxMax](const Node& node) {
+    for (unsigned int axis = 0; axis < 3; ++axis) {
+      if (node.min[axis] > boxMax[axis] || node.max[axis] < boxMin[axis]) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  std::vector<uint32_t> stack;
+  stack.reserve(64);
+  stack.emplace_back(0u);
+  while (!stack.empty()) {
+    const auto& node = _nodes[stack.back()];
+    stack.pop_back();
+    if (!overlaps(node)) {
+      continue;
+    }
+    if (node.count > 0) {
+      faceIds.insert(faceIds.end(), _faceIds.begin() + node.offset,
+                     _faceIds.begin() + node.offset + node.count);
+    }
+    else {
+      stack.emplace_back(node.offset);
+      stack.emplace_back(node.offset + 1);
+    }
+  }
+}
+
+} // end of namespace BABYLON
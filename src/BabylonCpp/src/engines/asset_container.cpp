@@ -99,9 +99,7 @@ void AssetContainer::removeAllFromScene()
   for (const auto& o : lights) {
     scene->removeLight(o);
   }
-  for (const auto& o : meshes) {
-    scene->removeMesh(o);
-  }
+  scene->removeMeshes(meshes);
   for (const auto& o : skeletons) {
     scene->removeSkeleton(o);
   }
@@ -157,9 +155,7 @@ void AssetContainer::dispose()
   }
   lights.clear();
 
-  for (const auto& o : meshes) {
-    scene->removeMesh(o);
-  }
+  scene->removeMeshes(meshes);
   meshes.clear();
 
   for (const auto& o : skeletons) {
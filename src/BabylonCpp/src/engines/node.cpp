@@ -37,8 +37,8 @@ std::function<NodePtr()> Node::Construct(const std::string& type, const std::str
 }
 
 Node::Node(const std::string& iName, Scene* scene)
-    : name{iName}
-    , id{iName}
+    : name{this, &Node::_reindexInScene, iName}
+    , id{this, &Node::_reindexInScene, iName}
     , doNotSerialize{this, &Node::get_doNotSerialize, &Node::set_doNotSerialize}
     , _isDisposed{false}
     , onReady{nullptr}
@@ -285,6 +285,13 @@ void Node::initCacheImpl()
   _cache.cache_inited = true;
 }
 
+void Node::_reindexInScene()
+{
+  if (_scene) {
+    _scene->_reindexObject(this);
+  }
+}
+
 void Node::updateCache(bool force)
 {
   if (!force && isSynchronized()) {
@@ -144,9 +144,10 @@ NullEngine::getUniforms(const IPipelineContextPtr& /*pipelineContext*/,
 }
 
 Int32Array NullEngine::getAttributes(const IPipelineContextPtr& /*pipelineContext*/,
-                                     const std::vector<std::string>& /*attributesNames*/)
+                                     const std::vector<std::string>& attributesNames)
 {
-  return {};
+  // One unresolved location per attribute, the effect reads them by index
+  return Int32Array(attributesNames.size(), -1);
 }
 
 void NullEngine::bindSamplers(Effect& /*effect*/)
@@ -364,6 +365,42 @@ InternalTexturePtr NullEngine::createTexture(
   return texture;
 }
 
+InternalTexturePtr NullEngine::createRawTexture(const Uint8Array& data, int width, int height,
+                                                unsigned int format, bool generateMipMaps,
+                                                bool invertY, unsigned int samplingMode,
+                                                const std::string& compression, unsigned int type)
+{
+  auto texture             = InternalTexture::New(this, InternalTextureSource::Raw);
+  texture->baseWidth       = width;
+  texture->baseHeight      = height;
+  texture->width           = width;
+  texture->height          = height;
+  texture->generateMipMaps = generateMipMaps;
+  texture->samplingMode    = samplingMode;
+
+  updateRawTexture(texture, data, format, invertY, compression, type);
+
+  _internalTexturesCache.emplace_back(texture);
+
+  return texture;
+}
+
+void NullEngine::updateRawTexture(const InternalTexturePtr& texture, const Uint8Array& data,
+                                  unsigned int format, bool invertY, const std::string& compression,
+                                  unsigned int type)
+{
+  if (!texture) {
+    return;
+  }
+
+  texture->_bufferView  = data;
+  texture->format       = format;
+  texture->type         = type;
+  texture->invertY      = invertY;
+  texture->_compression = compression;
+  texture->isReady      = true;
+}
+
 InternalTexturePtr
 NullEngine::createRenderTargetTexture(const std::variant<int, RenderTargetSize, float>& size,
                                       const IRenderTargetOptions& options)
@@ -522,7 +559,7 @@ void NullEngine::_bindTexture(int channel, const InternalTexturePtr& texture)
   _bindTextureDirectly(0, texture);
 }
 
-void NullEngine::_deleteBuffer(GL::IGLBuffer* /*buffer*/)
+void NullEngine::_deleteBuffer(const WebGLDataBufferPtr& /*buffer*/)
 {
 }
 
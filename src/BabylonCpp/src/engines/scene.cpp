@@ -19,8 +19,10 @@
 #include <babylon/collisions/collision_coordinator.h>
 #include <babylon/collisions/icollision_coordinator.h>
 #include <babylon/core/logging.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/culling/bounding_box.h>
 #include <babylon/culling/bounding_info.h>
+#include <babylon/culling/frustum_culling_batch.h>
 #include <babylon/culling/octrees/octree_scene_component.h>
 #include <babylon/culling/ray.h>
 #include <babylon/debug/debug_layer.h>
@@ -36,6 +38,7 @@
 #include <babylon/gamepads/gamepad_system_scene_component.h>
 #include <babylon/helpers/environment_helper.h>
 #include <babylon/inputs/click_info.h>
+#include <babylon/instrumentation/profiler.h>
 #include <babylon/interfaces/icanvas.h>
 #include <babylon/layers/effect_layer.h>
 #include <babylon/layers/glow_layer.h>
@@ -47,6 +50,7 @@
 #include <babylon/lights/shadows/shadow_generator.h>
 #include <babylon/materials/image_processing_configuration.h>
 #include <babylon/materials/material.h>
+#include <babylon/materials/material_helper.h>
 #include <babylon/materials/multi_material.h>
 #include <babylon/materials/pbr/pbr_material.h>
 #include <babylon/materials/standard_material.h>
@@ -60,6 +64,7 @@
 #include <babylon/meshes/abstract_mesh.h>
 #include <babylon/meshes/buffer.h>
 #include <babylon/meshes/geometry.h>
+#include <babylon/meshes/lines_mesh.h>
 #include <babylon/meshes/mesh_simplification_scene_component.h>
 #include <babylon/meshes/simplification/simplification_queue.h>
 #include <babylon/meshes/sub_mesh.h>
@@ -174,7 +179,14 @@ Scene::Scene(Engine* engine, const std::optional<SceneOptions>& options)
     , _cachedMaterial{nullptr}
     , _cachedEffect{nullptr}
     , _cachedVisibility{0.f}
+    , _meshesTreeGeneration{1}
     , dispatchAllSubMeshesOfActiveMeshes{false}
+    , parallelActiveMeshesEvaluation{false}
+    , parallelActiveMeshesEvaluationThreshold{256}
+    , parallelSkeletonsPreparation{false}
+    , parallelAnimationEvaluation{false}
+    , parallelAnimationEvaluationThreshold{64}
+    , useTriangleBVHForPicking{true}
     , _forcedViewPosition{nullptr}
     , _isAlternateRenderingEnabled{this, &Scene::get_isAlternateRenderingEnabled}
     , frustumPlanes{this, &Scene::get_frustumPlanes}
@@ -272,6 +284,8 @@ Scene::Scene(Engine* engine, const std::optional<SceneOptions>& options)
     , _activeMeshCandidateProvider{nullptr}
     , _activeMeshesFrozen{false}
     , _skipEvaluateActiveMeshesCompletely{false}
+    , _meshesTreeOrderCounter{0}
+    , _unboundedLightsDirty{true}
     , _renderingManager{nullptr}
     , _transformMatrix{Matrix::Zero()}
     , _sceneUbo{nullptr}
@@ -2155,12 +2169,16 @@ void Scene::_animate()
   // We make a copy of "animatables" because animatable->_animate can suppress
   // elements from "animatables"
   auto animatables_copy = animatables;
-  for (const auto& animatable : animatables_copy) {
-    if (animatable) {
-      if (!animatable->_animate(std::chrono::milliseconds(animationTime))
-          && animatable->disposeOnEnd) {
-        // The animation removed itself from _activeAnimatables
-        // during the call to _animate()
+  if (!parallelAnimationEvaluation || ThreadPool::Default().workerCount() == 0
+      || animatables_copy.size() < parallelAnimationEvaluationThreshold
+      || !_animateInParallel(animatables_copy, std::chrono::milliseconds(animationTime))) {
+    for (const auto& animatable : animatables_copy) {
+      if (animatable) {
+        if (!animatable->_animate(std::chrono::milliseconds(animationTime))
+            && animatable->disposeOnEnd) {
+          // The animation removed itself from _activeAnimatables
+          // during the call to _animate()
+        }
       }
     }
   }
@@ -2169,6 +2187,56 @@ void Scene::_animate()
   _processLateAnimationBindings();
 }
 
+bool Scene::_animateInParallel(const std::vector<AnimatablePtr>& animatables,
+                               const millisecond_t& animationTime)
+{
+  static constexpr size_t animatableGrainSize = 16;
+
+  // Synchronized animatables read the frame of their root while it is
+  // evaluated: the whole step is then done serially
+  for (const auto& animatable : animatables) {
+    if (animatable && animatable->syncRoot()) {
+      return false;
+    }
+  }
+
+  std::vector<Animatable*> concurrentAnimatables;
+  concurrentAnimatables.reserve(animatables.size());
+  for (const auto& animatable : animatables) {
+    if (animatable && animatable->_prepareConcurrentEvaluation()) {
+      concurrentAnimatables.emplace_back(animatable.get());
+    }
+  }
+
+  // Frames and values, into the evaluation slots of the runtime animations
+  ThreadPool::Default().parallelFor(
+    concurrentAnimatables.size(), animatableGrainSize,
+    [&concurrentAnimatables, &animationTime](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        concurrentAnimatables[i]->_evaluate(animationTime);
+      }
+    });
+
+  // Values, callbacks and disposal in the animatables order, the animatables
+  // which could not be evaluated concurrently are animated in place
+  auto concurrentAnimatable = concurrentAnimatables.begin();
+  for (const auto& animatable : animatables) {
+    if (!animatable) {
+      continue;
+    }
+    if (concurrentAnimatable != concurrentAnimatables.end()
+        && *concurrentAnimatable == animatable.get()) {
+      animatable->_applyEvaluation();
+      ++concurrentAnimatable;
+    }
+    else {
+      animatable->_animate(animationTime);
+    }
+  }
+
+  return true;
+}
+
 void Scene::_registerTargetForLateAnimationBinding(RuntimeAnimation* /*runtimeAnimation*/,
                                                    const AnimationValue& /*originalValue*/)
 {
@@ -2414,7 +2482,11 @@ void Scene::addMesh(const AbstractMeshPtr& newMesh, bool recursive)
     return;
   }
 
+  newMesh->_indexInSceneMeshesArray = static_cast<int>(meshes.size());
   meshes.emplace_back(newMesh);
+  _meshesIndex.add(newMesh);
+  newMesh->_meshesTreeOrder = ++_meshesTreeOrderCounter;
+  _markMeshForMeshesTreeUpdate(newMesh.get());
 
   newMesh->_resyncLightSources();
 
@@ -2438,17 +2510,23 @@ int Scene::removeMesh(const AbstractMeshPtr& toRemove, bool recursive)
 
 int Scene::removeMesh(AbstractMesh* toRemove, bool recursive)
 {
-  auto it    = std::find_if(meshes.begin(), meshes.end(), [toRemove](const AbstractMeshPtr& mesh) {
-    return mesh.get() == toRemove;
-  });
-  auto index = static_cast<int>(it - meshes.begin());
-  if (it != meshes.end()) {
-    // Remove from the scene if mesh found
-    meshes.erase(it);
-
-    if (!toRemove->parent()) {
-      toRemove->_removeFromSceneRootNodes();
+  // The mesh position is tracked, so only the meshes after it are visited
+  auto index = toRemove->_indexInSceneMeshesArray;
+  if (index < 0 || static_cast<size_t>(index) >= meshes.size()
+      || meshes[static_cast<size_t>(index)].get() != toRemove) {
+    auto it = std::find_if(meshes.begin(), meshes.end(), [toRemove](const AbstractMeshPtr& mesh) {
+      return mesh.get() == toRemove;
+    });
+    index   = static_cast<int>(it - meshes.begin());
+  }
+  if (static_cast<size_t>(index) < meshes.size()) {
+    // Remove from the scene if mesh found (kept alive until the end of the removal)
+    const auto removed = meshes[static_cast<size_t>(index)];
+    meshes.erase(meshes.begin() + index);
+    for (size_t i = static_cast<size_t>(index); i < meshes.size(); ++i) {
+      meshes[i]->_indexInSceneMeshesArray = static_cast<int>(i);
     }
+    _detachRemovedMesh(toRemove);
   }
 
   onMeshRemovedObservable.notifyObservers(toRemove);
@@ -2460,6 +2538,113 @@ int Scene::removeMesh(AbstractMesh* toRemove, bool recursive)
   return index;
 }
 
+size_t Scene::removeMeshes(const std::vector<AbstractMeshPtr>& toRemove, bool recursive)
+{
+  std::vector<AbstractMeshPtr> candidates;
+  for (const auto& mesh : toRemove) {
+    if (!mesh) {
+      continue;
+    }
+    candidates.emplace_back(mesh);
+    if (recursive) {
+      stl_util::concat(candidates, mesh->getChildMeshes());
+    }
+  }
+
+  // The removed meshes leave a null slot, the array is then compacted once
+  std::vector<AbstractMeshPtr> removed;
+  auto firstIndex = meshes.size();
+  for (const auto& mesh : candidates) {
+    auto index = mesh->_indexInSceneMeshesArray;
+    if (index < 0 || static_cast<size_t>(index) >= meshes.size()
+        || meshes[static_cast<size_t>(index)] != mesh) {
+      continue;
+    }
+    meshes[static_cast<size_t>(index)] = nullptr;
+    firstIndex = std::min(firstIndex, static_cast<size_t>(index));
+    removed.emplace_back(mesh);
+  }
+  stl_util::erase_remove_if(meshes, [](const AbstractMeshPtr& mesh) { return mesh == nullptr; });
+  for (size_t i = firstIndex; i < meshes.size(); ++i) {
+    meshes[i]->_indexInSceneMeshesArray = static_cast<int>(i);
+  }
+
+  for (const auto& mesh : removed) {
+    _detachRemovedMesh(mesh.get());
+  }
+  for (const auto& mesh : removed) {
+    onMeshRemovedObservable.notifyObservers(mesh.get());
+  }
+  return removed.size();
+}
+
+namespace {
+
+/**
+ * @brief Removes a mesh from a queue of meshes in constant time, the last
+ * queued mesh takes its slot.
+ */
+void RemoveFromQueue(std::vector<AbstractMesh*>& queue, size_t AbstractMesh::*slot,
+                     AbstractMesh* mesh)
+{
+  auto last          = queue.back();
+  last->*slot        = mesh->*slot;
+  queue[last->*slot] = last;
+  queue.pop_back();
+}
+
+} // end of anonymous namespace
+
+void Scene::_detachRemovedMesh(AbstractMesh* toRemove)
+{
+  toRemove->_indexInSceneMeshesArray = -1;
+  _meshesIndex.remove(toRemove);
+
+  // Remove from the meshes tree and from the queued updates
+  std::lock_guard<std::mutex> lock(_meshesTreeMutex);
+  if (toRemove->_meshesTreeDirty.exchange(false)) {
+    RemoveFromQueue(_meshesTreeUpdates, &AbstractMesh::_meshesTreeUpdateSlot, toRemove);
+  }
+  if (toRemove->_meshesTreeProxyId != DynamicAABBTree<AbstractMesh*>::NullNode) {
+    _meshesTree.destroyProxy(toRemove->_meshesTreeProxyId);
+    toRemove->_meshesTreeProxyId = DynamicAABBTree<AbstractMesh*>::NullNode;
+  }
+  toRemove->_meshesTreeOrder = 0;
+  if (toRemove->_lightSourcesDirty) {
+    toRemove->_lightSourcesDirty = false;
+    RemoveFromQueue(_lightSourcesUpdates, &AbstractMesh::_lightSourcesUpdateSlot, toRemove);
+  }
+  if (_selectionOctree) {
+    _selectionOctree->removeMesh(toRemove);
+  }
+
+  if (!toRemove->parent()) {
+    toRemove->_removeFromSceneRootNodes();
+  }
+}
+
+void Scene::_reindexObject(Node* node)
+{
+  // Ids and names are only changed occasionally, so the indices are probed
+  if (auto mesh = dynamic_cast<AbstractMesh*>(node)) {
+    _meshesIndex.update(mesh);
+  }
+  else if (auto transformNode = dynamic_cast<TransformNode*>(node)) {
+    _transformNodesIndex.update(transformNode);
+  }
+  else if (auto light = dynamic_cast<Light*>(node)) {
+    _lightsIndex.update(light);
+  }
+  else if (auto camera = dynamic_cast<Camera*>(node)) {
+    _camerasIndex.update(camera);
+  }
+}
+
+void Scene::_reindexObject(Material* material)
+{
+  _materialsIndex.update(material);
+}
+
 void Scene::addTransformNode(const TransformNodePtr& newTransformNode)
 {
   if (_blockEntityCollection) {
@@ -2467,6 +2652,7 @@ void Scene::addTransformNode(const TransformNodePtr& newTransformNode)
   }
   newTransformNode->_indexInSceneTransformNodesArray = static_cast<int>(transformNodes.size());
   transformNodes.emplace_back(newTransformNode);
+  _transformNodesIndex.add(newTransformNode);
 
   if (!newTransformNode->parent()) {
     newTransformNode->_addToSceneRootNodes();
@@ -2482,13 +2668,26 @@ int Scene::removeTransformNode(const TransformNodePtr& toRemove)
 
 int Scene::removeTransformNode(TransformNode* toRemove)
 {
-  auto it = std::find_if(
-    transformNodes.begin(), transformNodes.end(),
-    [toRemove](const TransformNodePtr& transformNode) { return transformNode.get() == toRemove; });
-  auto index = static_cast<int>(it - transformNodes.begin());
-  if (it != transformNodes.end()) {
-    // Remove from the scene if found
-    transformNodes.erase(it);
+  auto index = toRemove->_indexInSceneTransformNodesArray;
+  if (index < 0 || static_cast<size_t>(index) >= transformNodes.size()
+      || transformNodes[static_cast<size_t>(index)].get() != toRemove) {
+    auto it = std::find_if(transformNodes.begin(), transformNodes.end(),
+                           [toRemove](const TransformNodePtr& transformNode) {
+                             return transformNode.get() == toRemove;
+                           });
+    index = static_cast<int>(it - transformNodes.begin());
+  }
+  if (static_cast<size_t>(index) < transformNodes.size()) {
+    // Remove from the scene if found, the order of the array is not significant
+    const auto removed = transformNodes[static_cast<size_t>(index)];
+    auto& lastNode     = transformNodes.back();
+    if (lastNode.get() != toRemove) {
+      transformNodes[static_cast<size_t>(index)] = lastNode;
+      lastNode->_indexInSceneTransformNodesArray = index;
+    }
+    toRemove->_indexInSceneTransformNodesArray = -1;
+    transformNodes.pop_back();
+    _transformNodesIndex.remove(toRemove);
     if (!toRemove->parent()) {
       toRemove->_removeFromSceneRootNodes();
     }
@@ -2550,9 +2749,18 @@ int Scene::removeLight(Light* toRemove)
     lights.erase(it);
     sortLightsByPriority();
 
+    // Remove from the lights tree
+    if (toRemove->_lightsTreeProxyId != DynamicAABBTree<Light*>::NullNode) {
+      _lightsTree.destroyProxy(toRemove->_lightsTreeProxyId);
+      toRemove->_lightsTreeProxyId = DynamicAABBTree<Light*>::NullNode;
+    }
+    toRemove->_lightsTreeTracked = false;
+    _unboundedLightsDirty        = true;
+
     if (!toRemove->parent()) {
       toRemove->_removeFromSceneRootNodes();
     }
+    _lightsIndex.remove(toRemove);
   }
 
   onLightRemovedObservable.notifyObservers(toRemove);
@@ -2576,6 +2784,7 @@ int Scene::removeCamera(Camera* toRemove)
     if (!toRemove->parent()) {
       toRemove->_removeFromSceneRootNodes();
     }
+    _camerasIndex.remove(toRemove);
   }
   // Remove from activeCameras
   auto it2 = std::find_if(activeCameras.begin(), activeCameras.end(),
@@ -2649,12 +2858,25 @@ int Scene::removeMaterial(const MaterialPtr& toRemove)
 
 int Scene::removeMaterial(Material* toRemove)
 {
-  auto it
-    = std::find_if(materials.begin(), materials.end(),
-                   [toRemove](const MaterialPtr& material) { return material.get() == toRemove; });
-  int index = static_cast<int>(it - materials.begin());
-  if (it != materials.end()) {
-    materials.erase(it);
+  auto index = toRemove->_indexInSceneMaterialArray;
+  if (index < 0 || static_cast<size_t>(index) >= materials.size()
+      || materials[static_cast<size_t>(index)].get() != toRemove) {
+    auto it = std::find_if(
+      materials.begin(), materials.end(),
+      [toRemove](const MaterialPtr& material) { return material.get() == toRemove; });
+    index = static_cast<int>(it - materials.begin());
+  }
+  if (static_cast<size_t>(index) < materials.size()) {
+    // The order of the array is not significant
+    const auto removed = materials[static_cast<size_t>(index)];
+    auto& lastMaterial = materials.back();
+    if (lastMaterial.get() != toRemove) {
+      materials[static_cast<size_t>(index)]   = lastMaterial;
+      lastMaterial->_indexInSceneMaterialArray = index;
+    }
+    toRemove->_indexInSceneMaterialArray = -1;
+    materials.pop_back();
+    _materialsIndex.remove(toRemove);
   }
   onMaterialRemovedObservable.notifyObservers(toRemove);
 
@@ -2704,18 +2926,16 @@ void Scene::addLight(const LightPtr& newLight)
     return;
   }
   lights.emplace_back(newLight);
+  _lightsIndex.add(newLight);
   sortLightsByPriority();
 
   if (!newLight->parent()) {
     newLight->_addToSceneRootNodes();
   }
 
-  // Add light to all meshes (To support if the light is removed and then re-added)
-  for (const auto& mesh : meshes) {
-    if (!stl_util::contains(mesh->_lightSources, newLight)) {
-      mesh->_lightSources.emplace_back(newLight);
-      mesh->_resyncLightSources();
-    }
+  // Add light to the meshes it can reach (To support if the light is removed and then re-added)
+  for (const auto& mesh : _updateLightInLightsTree(newLight.get())) {
+    mesh->_resyncLightSources();
   }
 
   onNewLightAddedObservable.notifyObservers(newLight.get());
@@ -2727,6 +2947,7 @@ void Scene::sortLightsByPriority()
     BABYLON::stl_util::sort_js_style(lights, [](const LightPtr& a, const LightPtr& b) {
       return Light::CompareLightsPriority(a.get(), b.get());
     });
+    _unboundedLightsDirty = true;
   }
 }
 
@@ -2736,6 +2957,7 @@ void Scene::addCamera(const CameraPtr& newCamera)
     return;
   }
   cameras.emplace_back(newCamera);
+  _camerasIndex.add(newCamera);
   onNewCameraAddedObservable.notifyObservers(newCamera.get());
 
   if (!newCamera->parent()) {
@@ -2788,7 +3010,9 @@ void Scene::addMaterial(const MaterialPtr& newMaterial)
   if (_blockEntityCollection) {
     return;
   }
+  newMaterial->_indexInSceneMaterialArray = static_cast<int>(materials.size());
   materials.emplace_back(newMaterial);
+  _materialsIndex.add(newMaterial);
   onNewMaterialAddedObservable.notifyObservers(newMaterial.get());
 }
 
@@ -2876,68 +3100,37 @@ AnimationGroupPtr Scene::getAnimationGroupByName(const std::string& name)
 
 MaterialPtr Scene::getMaterialByID(const std::string& id)
 {
-  auto it = std::find_if(materials.begin(), materials.end(),
-                         [&id](const MaterialPtr& material) { return material->id == id; });
-
-  return (it == materials.end()) ? nullptr : *it;
+  return _materialsIndex.getById(id);
 }
 
 MaterialPtr Scene::getLastMaterialByID(const std::string& id)
 {
-  if (materials.empty()) {
-    return nullptr;
-  }
-
-  for (size_t index = materials.size(); index-- > 0;) {
-    if (materials[index]->id == id) {
-      return materials[index];
-    }
-  }
-
-  return nullptr;
+  return _materialsIndex.getLastById(id);
 }
 
 MaterialPtr Scene::getMaterialByUniqueID(size_t uniqueId)
 {
-  auto it
-    = std::find_if(materials.begin(), materials.end(), [uniqueId](const MaterialPtr& material) {
-        return material->uniqueId == uniqueId;
-      });
-
-  return (it == materials.end()) ? nullptr : *it;
+  return _materialsIndex.getByUniqueId(uniqueId);
 }
 
 MaterialPtr Scene::getMaterialByName(const std::string& name)
 {
-  auto it = std::find_if(materials.begin(), materials.end(),
-                         [&name](const MaterialPtr& material) { return material->name == name; });
-
-  return (it == materials.end()) ? nullptr : *it;
+  return _materialsIndex.getByName(name);
 }
 
 CameraPtr Scene::getCameraByID(const std::string& id)
 {
-  auto it = std::find_if(cameras.begin(), cameras.end(),
-                         [&id](const CameraPtr& camera) { return camera->id == id; });
-
-  return (it == cameras.end()) ? nullptr : *it;
+  return _camerasIndex.getById(id);
 }
 
 CameraPtr Scene::getCameraByUniqueID(size_t uniqueId)
 {
-  auto it = std::find_if(cameras.begin(), cameras.end(), [uniqueId](const CameraPtr& camera) {
-    return camera->uniqueId == uniqueId;
-  });
-
-  return (it == cameras.end()) ? nullptr : *it;
+  return _camerasIndex.getByUniqueId(uniqueId);
 }
 
 CameraPtr Scene::getCameraByName(const std::string& name)
 {
-  auto it = std::find_if(cameras.begin(), cameras.end(),
-                         [&name](const CameraPtr& camera) { return camera->name == name; });
-
-  return (it == cameras.end()) ? nullptr : *it;
+  return _camerasIndex.getByName(name);
 }
 
 BonePtr Scene::getBoneByID(const std::string& id)
@@ -2981,26 +3174,17 @@ BonePtr Scene::getBoneByName(const std::string& name)
 
 LightPtr Scene::getLightByName(const std::string& name)
 {
-  auto it = std::find_if(lights.begin(), lights.end(),
-                         [&name](const LightPtr& light) { return light->name == name; });
-
-  return (it == lights.end()) ? nullptr : *it;
+  return _lightsIndex.getByName(name);
 }
 
 LightPtr Scene::getLightByID(const std::string& id)
 {
-  auto it = std::find_if(lights.begin(), lights.end(),
-                         [&id](const LightPtr& light) { return light->id == id; });
-
-  return (it == lights.end()) ? nullptr : *it;
+  return _lightsIndex.getById(id);
 }
 
 LightPtr Scene::getLightByUniqueID(size_t uniqueId)
 {
-  auto it = std::find_if(lights.begin(), lights.end(),
-                         [uniqueId](const LightPtr& light) { return light->uniqueId == uniqueId; });
-
-  return (it == lights.end()) ? nullptr : *it;
+  return _lightsIndex.getByUniqueId(uniqueId);
 }
 
 IParticleSystemPtr Scene::getParticleSystemByID(const std::string& id)
@@ -3091,10 +3275,7 @@ std::vector<GeometryPtr>& Scene::getGeometries()
 
 AbstractMeshPtr Scene::getMeshByID(const std::string& id)
 {
-  auto it = std::find_if(meshes.begin(), meshes.end(),
-                         [&id](const AbstractMeshPtr& mesh) { return mesh->id == id; });
-
-  return (it == meshes.end()) ? nullptr : *it;
+  return _meshesIndex.getById(id);
 }
 
 std::vector<AbstractMeshPtr> Scene::getMeshesByID(const std::string& id)
@@ -3110,21 +3291,12 @@ std::vector<AbstractMeshPtr> Scene::getMeshesByID(const std::string& id)
 
 TransformNodePtr Scene::getTransformNodeByID(const std::string& id)
 {
-  auto it = std::find_if(
-    transformNodes.begin(), transformNodes.end(),
-    [&id](const TransformNodePtr& transformNode) { return transformNode->id == id; });
-
-  return (it == transformNodes.end()) ? nullptr : *it;
+  return _transformNodesIndex.getById(id);
 }
 
 TransformNodePtr Scene::getTransformNodeByUniqueID(size_t uniqueId)
 {
-  auto it = std::find_if(transformNodes.begin(), transformNodes.end(),
-                         [&uniqueId](const TransformNodePtr& transformNode) {
-                           return transformNode->uniqueId == uniqueId;
-                         });
-
-  return (it == transformNodes.end()) ? nullptr : *it;
+  return _transformNodesIndex.getByUniqueId(uniqueId);
 }
 
 std::vector<TransformNodePtr> Scene::getTransformNodesByID(const std::string& id)
@@ -3141,56 +3313,29 @@ std::vector<TransformNodePtr> Scene::getTransformNodesByID(const std::string& id
 
 AbstractMeshPtr Scene::getMeshByUniqueID(size_t uniqueId)
 {
-  auto it = std::find_if(meshes.begin(), meshes.end(), [&uniqueId](const AbstractMeshPtr& mesh) {
-    return mesh->uniqueId == uniqueId;
-  });
-
-  return (it == meshes.end()) ? nullptr : *it;
+  return _meshesIndex.getByUniqueId(uniqueId);
 }
 
 AbstractMeshPtr Scene::getLastMeshByID(const std::string& id)
 {
-  if (meshes.empty()) {
-    return nullptr;
-  }
-
-  for (size_t index = meshes.size(); index > 0; --index) {
-    if (meshes[index - 1]->id == id) {
-      return meshes[index - 1];
-    }
-  }
-
-  return nullptr;
+  return _meshesIndex.getLastById(id);
 }
 
 NodePtr Scene::getLastEntryByID(const std::string& id)
 {
-  size_t index;
-  for (index = meshes.size(); index > 0; --index) {
-    if (meshes[index - 1]->id == id) {
-      return meshes[index - 1];
-    }
-  }
-
-  for (index = transformNodes.size(); index > 0; --index) {
-    if (transformNodes[index - 1]->id == id) {
-      return transformNodes[index - 1];
-    }
+  if (auto mesh = _meshesIndex.getLastById(id)) {
+    return mesh;
   }
 
-  for (index = cameras.size(); index > 0; --index) {
-    if (cameras[index - 1]->id == id) {
-      return cameras[index - 1];
-    }
+  if (auto transformNode = _transformNodesIndex.getLastById(id)) {
+    return transformNode;
   }
 
-  for (index = lights.size(); index > 0; --index) {
-    if (lights[index - 1]->id == id) {
-      return lights[index - 1];
-    }
+  if (auto camera = _camerasIndex.getLastById(id)) {
+    return camera;
   }
 
-  return nullptr;
+  return _lightsIndex.getLastById(id);
 }
 
 NodePtr Scene::getNodeByID(const std::string& id)
@@ -3245,19 +3390,12 @@ NodePtr Scene::getNodeByName(const std::string& name)
 
 AbstractMeshPtr Scene::getMeshByName(const std::string& name)
 {
-  auto it = std::find_if(meshes.begin(), meshes.end(),
-                         [&name](const AbstractMeshPtr& mesh) { return mesh->name == name; });
-
-  return (it == meshes.end()) ? nullptr : *it;
+  return _meshesIndex.getByName(name);
 }
 
 TransformNodePtr Scene::getTransformNodeByName(const std::string& name)
 {
-  auto it = std::find_if(
-    transformNodes.begin(), transformNodes.end(),
-    [&name](const TransformNodePtr& transformNode) { return transformNode->name == name; });
-
-  return (it == transformNodes.end()) ? nullptr : *it;
+  return _transformNodesIndex.getByName(name);
 }
 
 SoundPtr Scene::getSoundByName(const std::string& name)
@@ -3394,7 +3532,7 @@ void Scene::freeRenderingGroups()
 
 void Scene::_evaluateSubMesh(SubMesh* subMesh, AbstractMesh* mesh, AbstractMesh* initialMesh)
 {
-  if (initialMesh->hasInstances() || initialMesh->isAnInstance()
+  if (initialMesh->hasInstances() || initialMesh->isAnInstance() || initialMesh->hasThinInstances()
       || dispatchAllSubMeshesOfActiveMeshes || _skipFrustumClipping
       || mesh->alwaysSelectAsActiveMesh || mesh->subMeshes.size() == 1
       || subMesh->isInFrustum(_frustumPlanes)) {
@@ -3407,12 +3545,10 @@ void Scene::_evaluateSubMesh(SubMesh* subMesh, AbstractMesh* mesh, AbstractMesh*
     if (material) {
       // Render targets
       if (material->hasRenderTargetTextures && material->getRenderTargetTextures) {
-        if (std::find(_processedMaterials.begin(), _processedMaterials.end(), material)
-            == _processedMaterials.end()) {
+        if (_processedMaterialsSet.insert(material.get()).second) {
           _processedMaterials.emplace_back(material);
           for (const auto& renderTarget : material->getRenderTargetTextures()) {
-            if (std::find(_renderTargets.begin(), _renderTargets.end(), renderTarget)
-                == _renderTargets.end()) {
+            if (_renderTargetsSet.insert(renderTarget.get()).second) {
               _renderTargets.emplace_back(renderTarget);
             }
           }
@@ -3464,12 +3600,15 @@ Scene& Scene::unfreezeActiveMeshes()
 
 void Scene::_evaluateActiveMeshes()
 {
+  BABYLON_PROFILE_ZONE("Active meshes evaluation");
+
   if (_activeMeshesFrozen && !_activeMeshes.empty()) {
 
     if (!_skipEvaluateActiveMeshesCompletely) {
       for (const auto& mesh : _activeMeshes) {
         mesh->computeWorldMatrix();
       }
+      _updateLightSources();
     }
 
     return;
@@ -3489,6 +3628,18 @@ void Scene::_evaluateActiveMeshes()
   _activeSkeletons.clear();
   _softwareSkinnedMeshes.clear();
 
+  // Membership sets (render targets and intersections are not reset here)
+  _processedMaterialsSet.clear();
+  _activeSkeletonsSet.clear();
+  _softwareSkinnedMeshesSet.clear();
+  _renderTargetsSet.clear();
+  for (const auto& renderTarget : _renderTargets) {
+    _renderTargetsSet.insert(renderTarget.get());
+  }
+  _meshesForIntersectionsSet.clear();
+  _meshesForIntersectionsSet.insert(_meshesForIntersections.begin(),
+                                    _meshesForIntersections.end());
+
   for (const auto& step : _beforeEvaluateActiveMeshStage) {
     step.action();
   }
@@ -3496,8 +3647,58 @@ void Scene::_evaluateActiveMeshes()
   // Determine mesh candidates
   auto _meshes = getActiveMeshCandidates();
 
+  if (parallelActiveMeshesEvaluation && ThreadPool::Default().workerCount() > 0
+      && _meshes.size() >= parallelActiveMeshesEvaluationThreshold) {
+    _evaluateActiveMeshesInParallel(_meshes);
+  }
+  else {
+    _evaluateActiveMeshesSerially(_meshes);
+  }
+
+  if (parallelSkeletonsPreparation) {
+    BABYLON_PROFILE_ZONE("Skeletons preparation");
+    Skeleton::PrepareSkeletons(_activeSkeletons);
+  }
+
+  // Light sources of the meshes that moved (or reached by the lights that moved)
+  _updateLightSources();
+
+  onAfterActiveMeshesEvaluationObservable.notifyObservers(this);
+
+  // Particle systems
+  if (particlesEnabled) {
+    onBeforeParticlesRenderingObservable.notifyObservers(this);
+    for (const auto& particleSystem : particleSystems) {
+      if (!particleSystem->isStarted() || !particleSystem->hasEmitter()) {
+        continue;
+      }
+
+      if (std::holds_alternative<AbstractMeshPtr>(particleSystem->emitter)
+          && std::get<AbstractMeshPtr>(particleSystem->emitter)->isEnabled()) {
+        _activeParticleSystems.emplace_back(particleSystem.get());
+        particleSystem->animate();
+        _renderingManager->dispatchParticles(particleSystem.get());
+      }
+    }
+    onAfterParticlesRenderingObservable.notifyObservers(this);
+  }
+}
+
+void Scene::_registerMeshForIntersections(AbstractMesh* mesh)
+{
+  if (mesh->actionManager
+      && mesh->actionManager->hasSpecificTriggers2(ActionManager::OnIntersectionEnterTrigger,
+                                                   ActionManager::OnIntersectionExitTrigger)) {
+    if (_meshesForIntersectionsSet.insert(mesh).second) {
+      _meshesForIntersections.emplace_back(mesh);
+    }
+  }
+}
+
+void Scene::_evaluateActiveMeshesSerially(const std::vector<AbstractMesh*>& candidates)
+{
   // Check each mesh
-  for (const auto& mesh : _meshes) {
+  for (const auto& mesh : candidates) {
     if (mesh->isBlocked()) {
       continue;
     }
@@ -3511,15 +3712,78 @@ void Scene::_evaluateActiveMeshes()
     mesh->computeWorldMatrix();
 
     // Intersections
-    if (mesh->actionManager
-        && mesh->actionManager->hasSpecificTriggers2(ActionManager::OnIntersectionEnterTrigger,
-                                                     ActionManager::OnIntersectionExitTrigger)) {
-      if (std::find(_meshesForIntersections.begin(), _meshesForIntersections.end(), mesh)
-          == _meshesForIntersections.end()) {
-        _meshesForIntersections.emplace_back(mesh);
+    _registerMeshForIntersections(mesh);
+
+    // Switch to current LOD
+    auto meshLOD = mesh->getLOD(_activeCamera);
+    if (!meshLOD) {
+      continue;
+    }
+
+    mesh->_preActivate();
+
+    if (mesh->isVisible && mesh->visibility() > 0.f
+        && (mesh->alwaysSelectAsActiveMesh
+            || ((mesh->layerMask & _activeCamera->layerMask) != 0
+                && mesh->isInFrustum(_frustumPlanes)))) {
+      _activeMeshes.emplace_back(mesh);
+      _activeCamera->_activeMeshes.emplace_back(_activeMeshes.back());
+
+      mesh->_activate(_renderId, false);
+      if (meshLOD != mesh) {
+        meshLOD->_activate(_renderId, false);
       }
+
+      _activeMesh(mesh, meshLOD);
+    }
+  }
+}
+
+void Scene::_evaluateActiveMeshesInParallel(const std::vector<AbstractMesh*>& candidates)
+{
+  static constexpr size_t cullingGrainSize = 256;
+
+  // Filtering (same checks and same order as the serial evaluation)
+  std::vector<AbstractMesh*> meshes;
+  meshes.reserve(candidates.size());
+  for (const auto& mesh : candidates) {
+    if (mesh->isBlocked()) {
+      continue;
+    }
+
+    _totalVertices.addCount(mesh->getTotalVertices(), false);
+
+    if (!mesh->isReady() || !mesh->isEnabled()) {
+      continue;
     }
 
+    meshes.emplace_back(mesh);
+  }
+
+  // World matrices and bounding infos
+  _computeWorldMatricesInHierarchyOrder(meshes);
+
+  // Batched frustum tests over the packed bounding volumes
+  if (!_frustumCullingBatch) {
+    _frustumCullingBatch = std::make_unique<FrustumCullingBatch>();
+  }
+  auto& cullingBatch = *_frustumCullingBatch;
+  cullingBatch.resize(meshes.size());
+  ThreadPool::Default().parallelFor(
+    meshes.size(), cullingGrainSize, [this, &meshes, &cullingBatch](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        cullingBatch.set(i, meshes[i]->_boundingInfo.get(), meshes[i]->cullingStrategy);
+      }
+      cullingBatch.cull(_frustumPlanes, begin, end);
+    });
+
+  // Deterministic serial merge, in the candidates order
+  for (size_t i = 0; i < meshes.size(); ++i) {
+    auto mesh = meshes[i];
+
+    // Intersections
+    _registerMeshForIntersections(mesh);
+
     // Switch to current LOD
     auto meshLOD = mesh->getLOD(_activeCamera);
     if (!meshLOD) {
@@ -3531,7 +3795,7 @@ void Scene::_evaluateActiveMeshes()
     if (mesh->isVisible && mesh->visibility() > 0.f
         && (mesh->alwaysSelectAsActiveMesh
             || ((mesh->layerMask & _activeCamera->layerMask) != 0
-                && mesh->isInFrustum(_frustumPlanes)))) {
+                && mesh->_isInFrustumFromCullingResult(cullingBatch.isInFrustum(i))))) {
       _activeMeshes.emplace_back(mesh);
       _activeCamera->_activeMeshes.emplace_back(_activeMeshes.back());
 
@@ -3543,41 +3807,77 @@ void Scene::_evaluateActiveMeshes()
       _activeMesh(mesh, meshLOD);
     }
   }
+}
 
-  onAfterActiveMeshesEvaluationObservable.notifyObservers(this);
+void Scene::_computeWorldMatricesInHierarchyOrder(const std::vector<AbstractMesh*>& meshes)
+{
+  static constexpr size_t worldMatrixGrainSize = 64;
 
-  // Particle systems
-  if (particlesEnabled) {
-    onBeforeParticlesRenderingObservable.notifyObservers(this);
-    for (const auto& particleSystem : particleSystems) {
-      if (!particleSystem->isStarted() || !particleSystem->hasEmitter()) {
-        continue;
+  // Group the meshes and their ancestors by depth in the hierarchy, so that the
+  // world matrix of a node is always computed after the one of its parent
+  std::unordered_map<Node*, size_t> depths;
+  std::vector<std::vector<Node*>> levels;
+  std::vector<Node*> chain;
+  for (const auto& mesh : meshes) {
+    chain.clear();
+    Node* node = mesh;
+    while (node && depths.find(node) == depths.end()) {
+      chain.emplace_back(node);
+      node = node->parent();
+    }
+    auto depth = node ? depths[node] + 1 : 0;
+    for (auto it = chain.rbegin(); it != chain.rend(); ++it, ++depth) {
+      depths[*it] = depth;
+      if (levels.size() <= depth) {
+        levels.resize(depth + 1);
       }
+      levels[depth].emplace_back(*it);
+    }
+  }
 
-      if (std::holds_alternative<AbstractMeshPtr>(particleSystem->emitter)
-          && std::get<AbstractMeshPtr>(particleSystem->emitter)->isEnabled()) {
-        _activeParticleSystems.emplace_back(particleSystem.get());
-        particleSystem->animate();
-        _renderingManager->dispatchParticles(particleSystem.get());
+  std::vector<TransformNode*> concurrentNodes;
+  std::vector<Node*> serialNodes;
+  for (const auto& level : levels) {
+    concurrentNodes.clear();
+    serialNodes.clear();
+    for (const auto& node : level) {
+      auto transformNode = dynamic_cast<TransformNode*>(node);
+      if (transformNode && transformNode->_canComputeWorldMatrixConcurrently()) {
+        concurrentNodes.emplace_back(transformNode);
+      }
+      else {
+        serialNodes.emplace_back(node);
       }
     }
-    onAfterParticlesRenderingObservable.notifyObservers(this);
+
+    ThreadPool::Default().parallelFor(concurrentNodes.size(), worldMatrixGrainSize,
+                                      [&concurrentNodes](size_t begin, size_t end) {
+                                        for (size_t i = begin; i < end; ++i) {
+                                          concurrentNodes[i]->computeWorldMatrix();
+                                        }
+                                      });
+
+    for (const auto& node : serialNodes) {
+      node->computeWorldMatrix();
+    }
   }
 }
 
 void Scene::_activeMesh(AbstractMesh* sourceMesh, AbstractMesh* mesh)
 {
-  if (_skeletonsEnabled && mesh->skeleton()) {
-    if (std::find(_activeSkeletons.begin(), _activeSkeletons.end(), mesh->skeleton())
-        == _activeSkeletons.end()) {
+  // Meshes playing a baked vertex animation read their bone matrices from a
+  // texture in every pass, their skeleton is not evaluated
+  if (_skeletonsEnabled && mesh->skeleton() && !MaterialHelper::UseBakedVertexAnimation(mesh)) {
+    if (_activeSkeletonsSet.insert(mesh->skeleton().get()).second) {
       _activeSkeletons.emplace_back(mesh->skeleton());
-      mesh->skeleton()->prepare();
+      if (!parallelSkeletonsPreparation) {
+        mesh->skeleton()->prepare();
+      }
     }
 
     if (!mesh->computeBonesUsingShaders()) {
       if (auto _mesh = static_cast<Mesh*>(mesh)) {
-        if (std::find(_softwareSkinnedMeshes.begin(), _softwareSkinnedMeshes.end(), _mesh)
-            == _softwareSkinnedMeshes.end()) {
+        if (_softwareSkinnedMeshesSet.insert(_mesh).second) {
           _softwareSkinnedMeshes.emplace_back(_mesh);
         }
       }
@@ -3777,6 +4077,8 @@ void Scene::_checkIntersections()
 
 void Scene::animate()
 {
+  BABYLON_PROFILE_ZONE("Animate");
+
   if (_engine->isDeterministicLockStep()) {
     auto iDeltaTime = (std::max(static_cast<float>(Scene::MinDeltaTime.count()),
                                 std::min(_engine->getDeltaTime() * 1000.f,
@@ -3838,6 +4140,8 @@ void Scene::render(bool updateCameras, bool ignoreAnimations)
     return;
   }
 
+  BABYLON_PROFILE_ZONE("Render");
+
   ++_frameId;
 
   // Register components that have been associated lately to the scene.
@@ -4262,24 +4566,26 @@ void Scene::dispose()
     animationGroup->dispose();
   }
 
-  // Release lights
-  for (const auto& light : lights) {
-    light->dispose();
+  // Release lights, meshes, transform nodes and cameras. They remove themselves from the scene
+  // arrays, so copies are iterated, from the back to keep the removals cheap
+  const auto sceneLights = lights;
+  for (auto it = sceneLights.rbegin(); it != sceneLights.rend(); ++it) {
+    (*it)->dispose();
   }
 
-  // Release meshes
-  for (const auto& mesh : meshes) {
-    mesh->dispose(true);
+  const auto sceneMeshes = meshes;
+  for (auto it = sceneMeshes.rbegin(); it != sceneMeshes.rend(); ++it) {
+    (*it)->dispose(true);
   }
 
-  // Release transform nodes
-  for (const auto& transformNode : transformNodes) {
-    removeTransformNode(transformNode);
+  const auto sceneTransformNodes = transformNodes;
+  for (auto it = sceneTransformNodes.rbegin(); it != sceneTransformNodes.rend(); ++it) {
+    removeTransformNode(*it);
   }
 
-  // Release cameras
-  for (const auto& camera : cameras) {
-    camera->dispose();
+  const auto sceneCameras = cameras;
+  for (auto it = sceneCameras.rbegin(); it != sceneCameras.rend(); ++it) {
+    (*it)->dispose();
   }
 
   // Release materials
@@ -4289,8 +4595,9 @@ void Scene::dispose()
   for (const auto& multiMaterial : multiMaterials) {
     multiMaterial->dispose();
   }
-  for (const auto& material : materials) {
-    material->dispose();
+  const auto sceneMaterials = materials;
+  for (auto it = sceneMaterials.rbegin(); it != sceneMaterials.rend(); ++it) {
+    (*it)->dispose();
   }
 
   // Release particles
@@ -4318,6 +4625,13 @@ void Scene::dispose()
   // Post-processes
   postProcessManager->dispose();
 
+  // Release the lookup indices
+  _meshesIndex.clear();
+  _transformNodesIndex.clear();
+  _lightsIndex.clear();
+  _camerasIndex.clear();
+  _materialsIndex.clear();
+
   // Remove from engine
   _engine->scenes.erase(std::remove(_engine->scenes.begin(), _engine->scenes.end(), this),
                         _engine->scenes.end());
@@ -4431,11 +4745,8 @@ Octree<AbstractMesh*>* Scene::createOrUpdateSelectionOctree(size_t maxCapacity,
   }
 
   if (!_selectionOctree) {
-    _selectionOctree = new Octree<AbstractMesh*>(
-      [](AbstractMesh*& entry, OctreeBlock<AbstractMesh*>& block) {
-        Octree<AbstractMesh*>::CreationFuncForMeshes(entry, block);
-      },
-      maxCapacity, maxDepth);
+    _selectionOctree = new Octree<AbstractMesh*>(&Octree<AbstractMesh*>::BoundsFuncForMeshes,
+                                                 maxCapacity, maxDepth);
   }
 
   auto worldExtends = getWorldExtends();
@@ -4447,6 +4758,287 @@ Octree<AbstractMesh*>* Scene::createOrUpdateSelectionOctree(size_t maxCapacity,
   return _selectionOctree;
 }
 
+namespace {
+
+/**
+ * @brief Sorts the meshes returned by the meshes tree in the scene order, so
+ * that they are processed in the same order as the scene meshes.
+ */
+void SortInSceneOrder(std::vector<AbstractMesh*>& candidates)
+{
+  std::sort(candidates.begin(), candidates.end(), [](AbstractMesh* a, AbstractMesh* b) {
+    return a->_meshesTreeOrder < b->_meshesTreeOrder;
+  });
+}
+
+/**
+ * @brief Recomputes the world matrix of a node after the ones of its ancestors:
+ * without a render, the cached world matrix of a moved ancestor is stale.
+ */
+void ComputeWorldMatrixFromRoot(Node* node, std::unordered_set<Node*>& computedNodes)
+{
+  if (!computedNodes.insert(node).second) {
+    return;
+  }
+  if (auto parent = node->parent()) {
+    ComputeWorldMatrixFromRoot(parent, computedNodes);
+  }
+  node->computeWorldMatrix(true);
+}
+
+} // end of anonymous namespace
+
+std::vector<AbstractMesh*> Scene::getMeshesInSphere(const Vector3& center, float radius)
+{
+  auto candidates = _getMeshesTreeCandidates(center, radius);
+  stl_util::erase_remove_if(candidates, [&center, radius](AbstractMesh* mesh) {
+    const auto& boundingBox = mesh->_boundingInfo->boundingBox;
+    return !BoundingBox::IntersectsSphere(boundingBox.minimumWorld, boundingBox.maximumWorld,
+                                          center, radius);
+  });
+  return candidates;
+}
+
+std::vector<AbstractMesh*> Scene::getIntersectingMeshes(AbstractMesh& mesh, bool precise,
+                                                       bool includeDescendants)
+{
+  std::vector<AbstractMesh*> candidates;
+  const auto& boundingInfo = mesh.getBoundingInfo();
+  if (!boundingInfo) {
+    return candidates;
+  }
+
+  // The descendants of the mesh are tested too, so the queried box includes
+  // their bounding boxes
+  auto min = boundingInfo->boundingBox.minimumWorld;
+  auto max = boundingInfo->boundingBox.maximumWorld;
+  if (includeDescendants) {
+    for (const auto& child : mesh.getChildMeshes(false)) {
+      if (const auto& childBoundingInfo = child->getBoundingInfo()) {
+        min.minimizeInPlace(childBoundingInfo->boundingBox.minimumWorld);
+        max.maximizeInPlace(childBoundingInfo->boundingBox.maximumWorld);
+      }
+    }
+  }
+
+  _updateMeshesTree();
+  _meshesTree.queryBox(min, max, candidates);
+  SortInSceneOrder(candidates);
+  stl_util::erase_remove_if(candidates, [&mesh, precise, includeDescendants](AbstractMesh* other) {
+    return other == &mesh || !mesh.intersectsMesh(*other, precise, includeDescendants);
+  });
+  return candidates;
+}
+
+void Scene::_markMeshForMeshesTreeUpdate(AbstractMesh* mesh)
+{
+  if (mesh->_meshesTreeOrder == 0 || mesh->_meshesTreeDirty.exchange(true)) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(_meshesTreeMutex);
+  mesh->_meshesTreeUpdateSlot = _meshesTreeUpdates.size();
+  _meshesTreeUpdates.emplace_back(mesh);
+}
+
+void Scene::_updateMeshesTree()
+{
+  // The queued meshes may have been moved since their world matrix was last
+  // computed, their ancestors are recomputed first, once per update. The mutex
+  // is not held here, computing the world matrix queues the mesh again
+  {
+    std::vector<AbstractMesh*> movedMeshes;
+    {
+      std::lock_guard<std::mutex> lock(_meshesTreeMutex);
+      movedMeshes = _meshesTreeUpdates;
+    }
+    std::unordered_set<Node*> computedNodes;
+    for (const auto& mesh : movedMeshes) {
+      if (mesh->parent()) {
+        ComputeWorldMatrixFromRoot(mesh, computedNodes);
+      }
+      else {
+        mesh->computeWorldMatrix(true);
+      }
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(_meshesTreeMutex);
+  for (const auto& mesh : _meshesTreeUpdates) {
+    mesh->_meshesTreeDirty = false;
+    _queueLightSourcesUpdate(mesh);
+    if (_selectionOctree) {
+      _selectionOctree->updateMesh(mesh);
+    }
+
+    const auto& boundingInfo = mesh->_boundingInfo;
+    if (!boundingInfo) {
+      if (mesh->_meshesTreeProxyId != DynamicAABBTree<AbstractMesh*>::NullNode) {
+        _meshesTree.destroyProxy(mesh->_meshesTreeProxyId);
+        mesh->_meshesTreeProxyId = DynamicAABBTree<AbstractMesh*>::NullNode;
+      }
+      continue;
+    }
+
+    // Lines meshes are picked with an extra threshold
+    const auto className = mesh->getClassName();
+    const auto threshold = className == "InstancedLinesMesh" || className == "LinesMesh" ?
+                             static_cast<LinesMesh*>(mesh)->intersectionThreshold :
+                             0.f;
+    const auto& boundingBox = boundingInfo->boundingBox;
+    const Vector3 min(boundingBox.minimumWorld.x - threshold,
+                      boundingBox.minimumWorld.y - threshold,
+                      boundingBox.minimumWorld.z - threshold);
+    const Vector3 max(boundingBox.maximumWorld.x + threshold,
+                      boundingBox.maximumWorld.y + threshold,
+                      boundingBox.maximumWorld.z + threshold);
+    if (mesh->_meshesTreeProxyId == DynamicAABBTree<AbstractMesh*>::NullNode) {
+      mesh->_meshesTreeProxyId = _meshesTree.createProxy(min, max, mesh);
+    }
+    else {
+      _meshesTree.moveProxy(mesh->_meshesTreeProxyId, min, max);
+    }
+  }
+  _meshesTreeUpdates.clear();
+  ++_meshesTreeGeneration;
+}
+
+std::vector<AbstractMesh*> Scene::_getMeshesTreeCandidates(const Ray& ray)
+{
+  std::vector<AbstractMesh*> candidates;
+  _updateMeshesTree();
+  _meshesTree.queryRay(ray, candidates);
+  SortInSceneOrder(candidates);
+  return candidates;
+}
+
+std::vector<AbstractMesh*> Scene::_getMeshesTreeCandidates(const Vector3& center, float radius)
+{
+  std::vector<AbstractMesh*> candidates;
+  _updateMeshesTree();
+  _meshesTree.querySphere(center, radius, candidates);
+  SortInSceneOrder(candidates);
+  return candidates;
+}
+
+void Scene::_updateLightSources()
+{
+  _updateMeshesTree();
+
+  // Lights whose lit volume changed since the last update
+  for (const auto& light : lights) {
+    Vector3 center;
+    float radius       = 0.f;
+    const auto bounded = light->_getLitVolumeBoundingSphere(center, radius);
+    if (light->_lightsTreeTracked
+        && bounded == (light->_lightsTreeProxyId != DynamicAABBTree<Light*>::NullNode)
+        && (!bounded
+            || (radius == light->_lightsTreeRadius && center.equals(light->_lightsTreeCenter)))) {
+      continue;
+    }
+    for (const auto& mesh : _updateLightInLightsTree(light.get())) {
+      _queueLightSourcesUpdate(mesh);
+    }
+  }
+
+  for (const auto& mesh : _lightSourcesUpdates) {
+    mesh->_lightSourcesDirty = false;
+    mesh->_resyncLightSources();
+  }
+  _lightSourcesUpdates.clear();
+}
+
+void Scene::_queueLightSourcesUpdate(AbstractMesh* mesh)
+{
+  if (mesh->_lightSourcesDirty) {
+    return;
+  }
+
+  mesh->_lightSourcesDirty      = true;
+  mesh->_lightSourcesUpdateSlot = _lightSourcesUpdates.size();
+  _lightSourcesUpdates.emplace_back(mesh);
+}
+
+std::vector<AbstractMesh*> Scene::_updateLightInLightsTree(Light* light)
+{
+  Vector3 center;
+  float radius          = 0.f;
+  const auto bounded    = light->_getLitVolumeBoundingSphere(center, radius);
+  const auto wasTracked = light->_lightsTreeTracked;
+  const auto wasBounded = light->_lightsTreeProxyId != DynamicAABBTree<Light*>::NullNode;
+
+  // Meshes in the previous and in the new lit volumes
+  std::vector<AbstractMesh*> affectedMeshes;
+  if (!bounded || (wasTracked && !wasBounded)) {
+    affectedMeshes.reserve(meshes.size());
+    for (const auto& mesh : meshes) {
+      affectedMeshes.emplace_back(mesh.get());
+    }
+  }
+  else {
+    affectedMeshes = _getMeshesTreeCandidates(center, radius);
+    if (wasBounded) {
+      const auto previousMeshes
+        = _getMeshesTreeCandidates(light->_lightsTreeCenter, light->_lightsTreeRadius);
+      affectedMeshes.insert(affectedMeshes.end(), previousMeshes.begin(), previousMeshes.end());
+      SortInSceneOrder(affectedMeshes);
+      affectedMeshes.erase(std::unique(affectedMeshes.begin(), affectedMeshes.end()),
+                           affectedMeshes.end());
+    }
+  }
+
+  // Proxy of the light
+  const Vector3 extend(radius, radius, radius);
+  if (bounded && wasBounded) {
+    _lightsTree.moveProxy(light->_lightsTreeProxyId, center.subtract(extend),
+                          center.add(extend));
+  }
+  else if (bounded) {
+    light->_lightsTreeProxyId
+      = _lightsTree.createProxy(center.subtract(extend), center.add(extend), light);
+  }
+  else if (wasBounded) {
+    _lightsTree.destroyProxy(light->_lightsTreeProxyId);
+    light->_lightsTreeProxyId = DynamicAABBTree<Light*>::NullNode;
+  }
+  if (!wasTracked || bounded != wasBounded) {
+    _unboundedLightsDirty = true;
+  }
+  light->_lightsTreeTracked = true;
+  light->_lightsTreeCenter  = center;
+  light->_lightsTreeRadius  = radius;
+
+  return affectedMeshes;
+}
+
+std::vector<Light*> Scene::_getLightSourcesCandidates(AbstractMesh* mesh)
+{
+  if (_unboundedLightsDirty) {
+    _unboundedLights.clear();
+    for (const auto& light : lights) {
+      if (light->_lightsTreeProxyId == DynamicAABBTree<Light*>::NullNode) {
+        _unboundedLights.emplace_back(light.get());
+      }
+    }
+    _unboundedLightsDirty = false;
+  }
+
+  auto candidates = _unboundedLights;
+  if (mesh->_boundingInfo) {
+    const auto& boundingSphere = mesh->_boundingInfo->boundingSphere;
+    _lightsTree.querySphere(boundingSphere.centerWorld, boundingSphere.radiusWorld, candidates);
+  }
+  else {
+    for (const auto& light : lights) {
+      if (light->_lightsTreeProxyId != DynamicAABBTree<Light*>::NullNode) {
+        candidates.emplace_back(light.get());
+      }
+    }
+  }
+
+  return candidates;
+}
+
 /** Picking **/
 Ray Scene::createPickingRay(int x, int y, Matrix& world, const CameraPtr& camera,
                             bool cameraViewSpace)
@@ -4537,7 +5129,10 @@ Scene::_internalPick(const std::function<Ray(Matrix& world)>& rayFunction,
   const auto fastCheck                   = iFastCheck.value_or(true);
   std::optional<PickingInfo> pickingInfo = std::nullopt;
 
-  for (const auto& mesh : meshes) {
+  // Broadphase with the ray in world space
+  auto identity = Matrix::Identity();
+  for (const auto& candidate : _getMeshesTreeCandidates(rayFunction(identity))) {
+    const auto mesh = candidate->shared_from_base<AbstractMesh>();
     if (predicate) {
       if (!predicate(mesh)) {
         continue;
@@ -4578,9 +5173,11 @@ Scene::_internalMultiPick(const std::function<Ray(Matrix& world)>& rayFunction,
 {
   std::vector<std::optional<PickingInfo>> pickingInfos;
 
-  for (const auto& mesh : meshes) {
+  // Broadphase with the ray in world space
+  auto identity = Matrix::Identity();
+  for (const auto& mesh : _getMeshesTreeCandidates(rayFunction(identity))) {
     if (predicate) {
-      if (!predicate(mesh.get())) {
+      if (!predicate(mesh)) {
         continue;
       }
     }
@@ -0,0 +1,198 @@
+#include <babylon/engines/scene_object_index.h>
+
+#include <babylon/cameras/camera.h>
+#include <babylon/lights/light.h>
+#include <babylon/materials/material.h>
+#include <babylon/meshes/abstract_mesh.h>
+#include <babylon/meshes/transform_node.h>
+
+namespace BABYLON {
+
+template <class T>
+SceneObjectIndex<T>::SceneObjectIndex() : _orderCounter{0}
+{
+}
+
+template <class T>
+SceneObjectIndex<T>::~SceneObjectIndex() = default;
+
+template <class T>
+void SceneObjectIndex<T>::add(const TPtr& object)
+{
+  if (!object) {
+    return;
+  }
+
+  if (update(object.get())) {
+    return;
+  }
+
+  // Entries are stored in a node based map, so their address is stable
+  auto& entry    = _entries[object.get()];
+  entry.object   = object;
+  entry.order    = _orderCounter++;
+  entry.uniqueId = object->uniqueId;
+  entry.id       = object->id;
+  entry.name     = object->name;
+
+  _byUniqueId[entry.uniqueId] = &entry;
+  _insertInBucket(_byId, entry.id, &entry, &Entry::idSlot);
+  _insertInBucket(_byName, entry.name, &entry, &Entry::nameSlot);
+}
+
+template <class T>
+bool SceneObjectIndex<T>::remove(T* object)
+{
+  auto it = _entries.find(object);
+  if (it == _entries.end()) {
+    return false;
+  }
+
+  auto& entry = it->second;
+  auto uniqueIt = _byUniqueId.find(entry.uniqueId);
+  if (uniqueIt != _byUniqueId.end() && uniqueIt->second == &entry) {
+    _byUniqueId.erase(uniqueIt);
+  }
+  _removeFromBucket(_byId, entry.id, &entry, &Entry::idSlot);
+  _removeFromBucket(_byName, entry.name, &entry, &Entry::nameSlot);
+  _entries.erase(it);
+
+  return true;
+}
+
+template <class T>
+bool SceneObjectIndex<T>::update(T* object)
+{
+  auto it = _entries.find(object);
+  if (it == _entries.end()) {
+    return false;
+  }
+
+  auto& entry = it->second;
+  if (entry.uniqueId != object->uniqueId) {
+    auto uniqueIt = _byUniqueId.find(entry.uniqueId);
+    if (uniqueIt != _byUniqueId.end() && uniqueIt->second == &entry) {
+      _byUniqueId.erase(uniqueIt);
+    }
+    entry.uniqueId              = object->uniqueId;
+    _byUniqueId[entry.uniqueId] = &entry;
+  }
+  if (entry.id != object->id) {
+    _removeFromBucket(_byId, entry.id, &entry, &Entry::idSlot);
+    entry.id = object->id;
+    _insertInBucket(_byId, entry.id, &entry, &Entry::idSlot);
+  }
+  if (entry.name != object->name) {
+    _removeFromBucket(_byName, entry.name, &entry, &Entry::nameSlot);
+    entry.name = object->name;
+    _insertInBucket(_byName, entry.name, &entry, &Entry::nameSlot);
+  }
+
+  return true;
+}
+
+template <class T>
+bool SceneObjectIndex<T>::contains(T* object) const
+{
+  return _entries.find(object) != _entries.end();
+}
+
+template <class T>
+size_t SceneObjectIndex<T>::size() const
+{
+  return _entries.size();
+}
+
+template <class T>
+void SceneObjectIndex<T>::clear()
+{
+  _byUniqueId.clear();
+  _byId.clear();
+  _byName.clear();
+  _entries.clear();
+}
+
+template <class T>
+std::shared_ptr<T> SceneObjectIndex<T>::getByUniqueId(size_t uniqueId) const
+{
+  auto it = _byUniqueId.find(uniqueId);
+  return (it == _byUniqueId.end()) ? nullptr : it->second->object;
+}
+
+template <class T>
+std::shared_ptr<T> SceneObjectIndex<T>::getById(const std::string& id) const
+{
+  return _find(_byId, id, false);
+}
+
+template <class T>
+std::shared_ptr<T> SceneObjectIndex<T>::getLastById(const std::string& id) const
+{
+  return _find(_byId, id, true);
+}
+
+template <class T>
+std::shared_ptr<T> SceneObjectIndex<T>::getByName(const std::string& name) const
+{
+  return _find(_byName, name, false);
+}
+
+template <class T>
+void SceneObjectIndex<T>::_insertInBucket(std::unordered_map<std::string, Bucket>& buckets,
+                                          const std::string& key, Entry* entry,
+                                          size_t Entry::*slot)
+{
+  auto& bucket = buckets[key];
+  entry->*slot = bucket.size();
+  bucket.emplace_back(entry);
+}
+
+template <class T>
+void SceneObjectIndex<T>::_removeFromBucket(std::unordered_map<std::string, Bucket>& buckets,
+                                            const std::string& key, Entry* entry,
+                                            size_t Entry::*slot)
+{
+  auto it = buckets.find(key);
+  if (it == buckets.end()) {
+    return;
+  }
+
+  // Swap and pop, the insertion order is kept in the entries
+  auto& bucket    = it->second;
+  const auto last = bucket.back();
+  bucket[entry->*slot] = last;
+  last->*slot          = entry->*slot;
+  bucket.pop_back();
+  if (bucket.empty()) {
+    buckets.erase(it);
+  }
+}
+
+template <class T>
+std::shared_ptr<T>
+SceneObjectIndex<T>::_find(const std::unordered_map<std::string, Bucket>& buckets,
+                           const std::string& key, bool last) const
+{
+  auto it = buckets.find(key);
+  if (it == buckets.end()) {
+    return nullptr;
+  }
+
+  // Swap and pop removals do not keep the bucket ordered
+  const Entry* result = nullptr;
+  for (const auto* entry : it->second) {
+    if (!result || (last ? entry->order > result->order : entry->order < result->order)) {
+      result = entry;
+    }
+  }
+
+  return result ? result->object : nullptr;
+}
+
+template class SceneObjectIndex<AbstractMesh>;
+template class SceneObjectIndex<Camera>;
+template class SceneObjectIndex<Light>;
+template class SceneObjectIndex<Material>;
+template class SceneObjectIndex<TransformNode>;
+
+} // end of namespace BABYLON
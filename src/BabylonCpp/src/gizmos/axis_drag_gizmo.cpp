@@ -1,6 +1,5 @@
 ﻿#include <babylon/gizmos/axis_drag_gizmo.h>
 
-#include <babylon/babylon_stl_util.h>
 #include <babylon/behaviors/meshes/pointer_drag_behavior.h>
 #include <babylon/engines/scene.h>
 #include <babylon/gizmos/position_gizmo.h>
@@ -156,9 +155,10 @@ AxisDragGizmo::AxisDragGizmo(const Vector3& dragAxis, const Color3& color,
       }
     });
 
-  const auto& light         = gizmoLayer->_getSharedGizmoLight();
-  light->includedOnlyMeshes = stl_util::concat(light->includedOnlyMeshes(),
-                                               _rootMesh->getChildMeshes());
+  const auto& light = gizmoLayer->_getSharedGizmoLight();
+  for (const auto& mesh : _rootMesh->getChildMeshes()) {
+    light->addIncludedOnlyMesh(mesh);
+  }
 }
 
 AxisDragGizmo::~AxisDragGizmo() = default;
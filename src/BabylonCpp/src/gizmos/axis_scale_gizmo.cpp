@@ -1,6 +1,5 @@
 #include <babylon/gizmos/axis_scale_gizmo.h>
 
-#include <babylon/babylon_stl_util.h>
 #include <babylon/behaviors/meshes/pointer_drag_behavior.h>
 #include <babylon/engines/scene.h>
 #include <babylon/gizmos/scale_gizmo.h>
@@ -146,8 +145,9 @@ AxisScaleGizmo::AxisScaleGizmo(const Vector3& dragAxis, const Color3& color,
     });
 
   const auto& light = gizmoLayer->_getSharedGizmoLight();
-  light->includedOnlyMeshes
-    = stl_util::concat(light->includedOnlyMeshes(), _rootMesh->getChildMeshes());
+  for (const auto& mesh : _rootMesh->getChildMeshes()) {
+    light->addIncludedOnlyMesh(mesh);
+  }
 }
 
 AxisScaleGizmo::~AxisScaleGizmo() = default;
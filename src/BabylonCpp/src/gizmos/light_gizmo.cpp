@@ -1,6 +1,5 @@
 #include <babylon/gizmos/light_gizmo.h>
 
-#include <babylon/babylon_stl_util.h>
 #include <babylon/lights/hemispheric_light.h>
 #include <babylon/lights/light.h>
 #include <babylon/lights/shadow_light.h>
@@ -63,8 +62,9 @@ void LightGizmo::set_light(const LightPtr& iLight)
 
     // Add lighting to the light gizmo
     const auto& gizmoLight = gizmoLayer->_getSharedGizmoLight();
-    gizmoLight->includedOnlyMeshes
-      = stl_util::concat(gizmoLight->includedOnlyMeshes(), _lightMesh->getChildMeshes(false));
+    for (const auto& mesh : _lightMesh->getChildMeshes(false)) {
+      gizmoLight->addIncludedOnlyMesh(mesh);
+    }
 
     _lightMesh->rotationQuaternion = Quaternion();
 
@@ -126,7 +126,9 @@ PlaneDragGizmo::PlaneDragGizmo(const Vector3& dragPlaneNormal, const Color3& col
     });
 
   auto light = gizmoLayer->_getSharedGizmoLight();
-  stl_util::concat(light->includedOnlyMeshes(), _rootMesh->getChildMeshes(false));
+  for (const auto& mesh : _rootMesh->getChildMeshes(false)) {
+    light->addIncludedOnlyMesh(mesh);
+  }
 }
 
 PlaneDragGizmo::~PlaneDragGizmo() = default;
@@ -203,8 +203,9 @@ PlaneRotationGizmo::PlaneRotationGizmo(const Vector3& planeNormal, const Color3&
     });
 
   const auto& light = gizmoLayer->_getSharedGizmoLight();
-  light->includedOnlyMeshes
-    = stl_util::concat(light->includedOnlyMeshes(), _rootMesh->getChildMeshes(false));
+  for (const auto& mesh : _rootMesh->getChildMeshes(false)) {
+    light->addIncludedOnlyMesh(mesh);
+  }
 }
 
 PlaneRotationGizmo::~PlaneRotationGizmo() = default;
@@ -1,6 +1,5 @@
 #include <babylon/gizmos/scale_gizmo.h>
 
-#include <babylon/babylon_stl_util.h>
 #include <babylon/behaviors/meshes/pointer_drag_behavior.h>
 #include <babylon/core/logging.h>
 #include <babylon/gizmos/axis_scale_gizmo.h>
@@ -48,8 +47,8 @@ ScaleGizmo::ScaleGizmo(const std::shared_ptr<UtilityLayerRenderer>& iGizmoLayer)
   _octahedron->scaling().scaleInPlace(0.007f);
   _uniformScalingMesh->addChild(*_octahedron);
   uniformScaleGizmo->setCustomMesh(_uniformScalingMesh, true);
-  const auto& light         = gizmoLayer->_getSharedGizmoLight();
-  light->includedOnlyMeshes = stl_util::concat(light->includedOnlyMeshes(), {_octahedron});
+  const auto& light = gizmoLayer->_getSharedGizmoLight();
+  light->addIncludedOnlyMesh(_octahedron);
 
   // Relay drag events
   for (const auto& gizmo : {xGizmo.get(), yGizmo.get(), zGizmo.get(), uniformScaleGizmo.get()}) {
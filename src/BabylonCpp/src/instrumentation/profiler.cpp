@@ -0,0 +1,289 @@
+#include <babylon/instrumentation/profiler.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <limits>
+#include <unordered_map>
+
+#include <nlohmann/json.hpp>
+
+using json = nlohmann::json;
+
+namespace BABYLON {
+
+/**
+ * @brief Hidden
+ * Zones of a thread: the zones still open, only accessed by the thread, and
+ * the ring buffer of the closed zones, written by the thread and drained by
+ * Profiler::collect().
+ */
+struct ProfilerThreadBuffer {
+  struct OpenZone {
+    const char* name;
+    uint64_t start;
+    uint32_t depth;
+  }; // end of struct OpenZone
+
+  explicit ProfilerThreadBuffer(uint32_t id)
+      : threadId{id}, zones(Profiler::ThreadBufferCapacity), head{0}, tail{0}, dropped{0}
+  {
+    stack.reserve(64);
+  }
+
+  uint32_t threadId;
+  std::string threadName;
+  std::vector<OpenZone> stack;
+  std::vector<Profiler::Zone> zones;
+  std::atomic<uint64_t> head;
+  std::atomic<uint64_t> tail;
+  std::atomic<uint64_t> dropped;
+}; // end of struct ProfilerThreadBuffer
+
+namespace {
+
+static_assert((Profiler::ThreadBufferCapacity & (Profiler::ThreadBufferCapacity - 1)) == 0,
+              "The capacity of the ring buffers must be a power of two");
+
+/**
+ * Start time of the zones opened while no capture is running
+ */
+constexpr uint64_t NotCaptured = std::numeric_limits<uint64_t>::max();
+
+thread_local ProfilerThreadBuffer* _threadBufferPtr = nullptr;
+
+uint64_t SteadyClockNanoseconds()
+{
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                 std::chrono::steady_clock::now().time_since_epoch())
+                                 .count());
+}
+
+} // end of anonymous namespace
+
+Profiler& Profiler::Default()
+{
+  static Profiler profiler;
+  return profiler;
+}
+
+Profiler::Profiler()
+    : _capturing{false}, _captureStart{0}, _epoch{SteadyClockNanoseconds()}
+{
+}
+
+Profiler::~Profiler() = default;
+
+uint64_t Profiler::now() const
+{
+  return SteadyClockNanoseconds() - _epoch;
+}
+
+void Profiler::start()
+{
+  std::lock_guard<std::mutex> lock(_threadsMutex);
+  for (const auto& buffer : _threads) {
+    buffer->tail.store(buffer->head.load(std::memory_order_acquire), std::memory_order_release);
+    buffer->dropped.store(0, std::memory_order_relaxed);
+  }
+  _zones.clear();
+  _captureStart.store(now(), std::memory_order_relaxed);
+  _capturing.store(true, std::memory_order_release);
+}
+
+void Profiler::stop()
+{
+  _capturing.store(false, std::memory_order_release);
+}
+
+ProfilerThreadBuffer& Profiler::_threadBuffer()
+{
+  if (!_threadBufferPtr) {
+    std::lock_guard<std::mutex> lock(_threadsMutex);
+    // The buffers are kept by the profiler, the zones of the threads that
+    // ended are still exported
+    _threads.emplace_back(
+      std::make_shared<ProfilerThreadBuffer>(static_cast<uint32_t>(_threads.size() + 1)));
+    _threadBufferPtr = _threads.back().get();
+  }
+  return *_threadBufferPtr;
+}
+
+void Profiler::beginZone(const char* name)
+{
+  auto& buffer = _threadBuffer();
+  buffer.stack.push_back({name, isCapturing() ? now() : NotCaptured,
+                          static_cast<uint32_t>(buffer.stack.size())});
+}
+
+void Profiler::endZone()
+{
+  auto& buffer = _threadBuffer();
+  if (buffer.stack.empty()) {
+    return;
+  }
+
+  _pushZone(buffer, buffer.stack.size() - 1, now());
+  buffer.stack.pop_back();
+}
+
+void Profiler::beginZone(const std::string& name)
+{
+  beginZone(intern(name));
+}
+
+void Profiler::endZone(const std::string& name)
+{
+  auto& buffer = _threadBuffer();
+  auto& stack  = buffer.stack;
+  // Counters of the loaders may overlap without being nested, the matching
+  // zone is closed and the ones opened after it stay open
+  for (size_t i = stack.size(); i-- > 0;) {
+    if (name == stack[i].name) {
+      _pushZone(buffer, i, now());
+      stack.erase(stack.begin() + static_cast<std::ptrdiff_t>(i));
+      return;
+    }
+  }
+}
+
+void Profiler::_pushZone(ProfilerThreadBuffer& buffer, size_t stackIndex, uint64_t end)
+{
+  const auto& openZone = buffer.stack[stackIndex];
+  if (openZone.start == NotCaptured || !isCapturing()) {
+    return;
+  }
+
+  // Single producer ring buffer: the zone is dropped when the collector did
+  // not drain the buffer in time
+  const auto head = buffer.head.load(std::memory_order_relaxed);
+  if (head - buffer.tail.load(std::memory_order_acquire) >= ThreadBufferCapacity) {
+    buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  buffer.zones[head & (ThreadBufferCapacity - 1)]
+    = {openZone.name, openZone.start, end - openZone.start, openZone.depth, buffer.threadId};
+  buffer.head.store(head + 1, std::memory_order_release);
+}
+
+void Profiler::setThreadName(const std::string& name)
+{
+  auto& buffer = _threadBuffer();
+  std::lock_guard<std::mutex> lock(_threadsMutex);
+  buffer.threadName = name;
+}
+
+const char* Profiler::intern(const std::string& name)
+{
+  thread_local std::unordered_map<std::string, const char*> cache;
+  const auto it = cache.find(name);
+  if (it != cache.end()) {
+    return it->second;
+  }
+
+  std::lock_guard<std::mutex> lock(_namesMutex);
+  const auto* interned = _names.insert(name).first->c_str();
+  cache.emplace(name, interned);
+  return interned;
+}
+
+std::vector<Profiler::Zone> Profiler::collect()
+{
+  std::lock_guard<std::mutex> lock(_threadsMutex);
+  const auto captureStart = _captureStart.load(std::memory_order_relaxed);
+  const auto nbZones      = _zones.size();
+  for (const auto& buffer : _threads) {
+    const auto tail = buffer->tail.load(std::memory_order_relaxed);
+    const auto head = buffer->head.load(std::memory_order_acquire);
+    for (auto i = tail; i < head; ++i) {
+      const auto& zone = buffer->zones[i & (ThreadBufferCapacity - 1)];
+      if (zone.start >= captureStart) {
+        _zones.emplace_back(zone);
+      }
+    }
+    buffer->tail.store(head, std::memory_order_release);
+  }
+
+  // Zones are closed from the innermost one, parents are moved before their
+  // children
+  if (_zones.size() != nbZones) {
+    std::sort(_zones.begin(), _zones.end(), [](const Zone& lhs, const Zone& rhs) {
+      if (lhs.threadId != rhs.threadId) {
+        return lhs.threadId < rhs.threadId;
+      }
+      if (lhs.start != rhs.start) {
+        return lhs.start < rhs.start;
+      }
+      return lhs.depth < rhs.depth;
+    });
+  }
+
+  return _zones;
+}
+
+uint64_t Profiler::droppedZones() const
+{
+  std::lock_guard<std::mutex> lock(_threadsMutex);
+  uint64_t dropped = 0;
+  for (const auto& buffer : _threads) {
+    dropped += buffer->dropped.load(std::memory_order_relaxed);
+  }
+  return dropped;
+}
+
+std::string Profiler::toChromeTrace()
+{
+  const auto zones        = collect();
+  const auto captureStart = _captureStart.load(std::memory_order_relaxed);
+
+  auto events = json::array();
+  {
+    std::lock_guard<std::mutex> lock(_threadsMutex);
+    for (const auto& buffer : _threads) {
+      const auto threadName = buffer->threadName.empty() ?
+                                "Thread " + std::to_string(buffer->threadId) :
+                                buffer->threadName;
+      events.push_back({
+        {"name", "thread_name"},
+        {"ph", "M"},
+        {"pid", 1},
+        {"tid", buffer->threadId},
+        {"args", {{"name", threadName}}},
+      });
+    }
+  }
+
+  // Complete events, timestamps and durations are in microseconds
+  for (const auto& zone : zones) {
+    events.push_back({
+      {"name", zone.name},
+      {"cat", "babylon"},
+      {"ph", "X"},
+      {"ts", static_cast<double>(zone.start - captureStart) / 1000.0},
+      {"dur", static_cast<double>(zone.duration) / 1000.0},
+      {"pid", 1},
+      {"tid", zone.threadId},
+    });
+  }
+
+  return json{
+    {"traceEvents", events},
+    {"displayTimeUnit", "ms"},
+    {"otherData", {{"droppedZones", droppedZones()}}},
+  }
+    .dump();
+}
+
+bool Profiler::saveChromeTrace(const std::string& filename)
+{
+  std::ofstream file(filename);
+  if (!file) {
+    return false;
+  }
+
+  file << toChromeTrace();
+  return static_cast<bool>(file);
+}
+
+} // end of namespace BABYLON
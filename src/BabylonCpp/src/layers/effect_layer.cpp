@@ -1,6 +1,7 @@
 #include <babylon/layers/effect_layer.h>
 
 #include <babylon/babylon_stl_util.h>
+#include <babylon/baked_vertex_animation/baked_vertex_animation_manager.h>
 #include <babylon/bones/skeleton.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
@@ -328,6 +329,14 @@ bool EffectLayer::_isReady(SubMesh* subMesh, bool useInstances,
     defines.emplace_back("#define NUM_BONE_INFLUENCERS 0");
   }
 
+  // Baked vertex animation
+  if (MaterialHelper::UseBakedVertexAnimation(mesh.get())) {
+    defines.emplace_back("#define BAKED_VERTEX_ANIMATION_TEXTURE");
+    if (useInstances) {
+      attribs.emplace_back("bakedVertexAnimationSettingsInstanced");
+    }
+  }
+
   // Morph targets
   unsigned int morphInfluencers = 0;
   if (auto _mesh = std::static_pointer_cast<Mesh>(mesh)) {
@@ -372,9 +381,12 @@ bool EffectLayer::_isReady(SubMesh* subMesh, bool useInstances,
                                            "diffuseMatrix",
                                            "emissiveMatrix",
                                            "opacityMatrix",
-                                           "opacityIntensity"};
-    effectCreationOptions.samplers
-      = {"diffuseSampler", "emissiveSampler", "opacitySampler", "boneSampler"};
+                                           "opacityIntensity",
+                                           "bakedVertexAnimationSettings",
+                                           "bakedVertexAnimationTextureSizeInverted",
+                                           "bakedVertexAnimationTime"};
+    effectCreationOptions.samplers        = {"diffuseSampler", "emissiveSampler", "opacitySampler",
+                                           "boneSampler", "bakedVertexAnimationTexture"};
 
     _effectLayerMapGenerationEffect = _scene->getEngine()->createEffect(
       "glowMapGeneration", effectCreationOptions, _scene->getEngine());
@@ -561,9 +573,13 @@ void EffectLayer::_renderSubMesh(SubMesh* subMesh, bool enableAlphaMode)
         "emissiveMatrix", *_emissiveTextureAndColor.texture->getTextureMatrix());
     }
 
-    // Bones
-    if (renderingMesh->useBones() && renderingMesh->computeBonesUsingShaders()
-        && renderingMesh->skeleton()) {
+    // Bones, the skeleton of a mesh playing a baked vertex animation is not prepared
+    if (MaterialHelper::UseBakedVertexAnimation(renderingMesh.get())) {
+      renderingMesh->bakedVertexAnimationManager()->bind(_effectLayerMapGenerationEffect,
+                                                         hardwareInstancedRendering);
+    }
+    else if (renderingMesh->useBones() && renderingMesh->computeBonesUsingShaders()
+             && renderingMesh->skeleton()) {
       auto& skeleton = renderingMesh->skeleton();
 
       if (skeleton->isUsingTextureForMatrices()) {
@@ -30,13 +30,14 @@ Light::Light(const std::string& iName, Scene* scene)
     , radius{this, &Light::get_radius, &Light::set_radius}
     , shadowEnabled{this, &Light::get_shadowEnabled, &Light::set_shadowEnabled}
     , renderPriority{this, &Light::get_renderPriority, &Light::set_renderPriority}
-    , includedOnlyMeshes{this, &Light::get_includedOnlyMeshes, &Light::set_includedOnlyMeshes}
-    , excludedMeshes{this, &Light::get_excludedMeshes, &Light::set_excludedMeshes}
     , excludeWithLayerMask{this, &Light::get_excludeWithLayerMask, &Light::set_excludeWithLayerMask}
     , includeOnlyWithLayerMask{this, &Light::get_includeOnlyWithLayerMask,
                                &Light::set_includeOnlyWithLayerMask}
     , lightmapMode{this, &Light::get_lightmapMode, &Light::set_lightmapMode}
     , _isLight{true}
+    , _lightsTreeTracked{false}
+    , _lightsTreeProxyId{-1}
+    , _lightsTreeRadius{0.f}
     , _inverseSquaredRange{0.f}
     , _range{std::numeric_limits<float>::max()}
     , _photometricScale{1.f}
@@ -95,10 +96,11 @@ void Light::addToScene(const LightPtr& newLight)
 
 LightPtr Light::_this() const
 {
-  const auto& lights = getScene()->lights;
-  auto it            = std::find_if(lights.begin(), lights.end(),
-                         [this](const LightPtr& light) { return light.get() == this; });
-  return (it != lights.end()) ? (*it) : nullptr;
+  // Only the lights of the scene are returned, their lit volume is tracked
+  if (!_lightsTreeTracked) {
+    return nullptr;
+  }
+  return std::static_pointer_cast<Light>(std::const_pointer_cast<Node>(shared_from_this()));
 }
 
 std::string Light::getClassName() const
@@ -200,26 +202,68 @@ void Light::set_renderPriority(int value)
   _reorderLightsInScene();
 }
 
-std::vector<AbstractMeshPtr>& Light::get_includedOnlyMeshes()
+const std::vector<AbstractMeshPtr>& Light::includedOnlyMeshes() const
 {
   return _includedOnlyMeshes;
 }
 
-void Light::set_includedOnlyMeshes(const std::vector<AbstractMeshPtr>& value)
+void Light::setIncludedOnlyMeshes(const std::vector<AbstractMeshPtr>& meshes)
 {
-  _includedOnlyMeshes = value;
-  _hookArrayForIncludedOnly(value);
+  _includedOnlyMeshes = meshes;
+  _hookArrayForIncludedOnly(meshes);
 }
 
-std::vector<AbstractMeshPtr>& Light::get_excludedMeshes()
+void Light::addIncludedOnlyMesh(const AbstractMeshPtr& mesh)
+{
+  if (!mesh || !_includedOnlyMeshesSet.insert(mesh.get()).second) {
+    return;
+  }
+
+  _includedOnlyMeshes.emplace_back(mesh);
+  _resyncMeshes();
+}
+
+bool Light::removeIncludedOnlyMesh(AbstractMesh* mesh)
+{
+  if (_includedOnlyMeshesSet.erase(mesh) == 0) {
+    return false;
+  }
+
+  stl_util::remove_vector_elements_equal_sharedptr(_includedOnlyMeshes, mesh);
+  _resyncMeshes();
+  return true;
+}
+
+const std::vector<AbstractMeshPtr>& Light::excludedMeshes() const
 {
   return _excludedMeshes;
 }
 
-void Light::set_excludedMeshes(const std::vector<AbstractMeshPtr>& value)
+void Light::setExcludedMeshes(const std::vector<AbstractMeshPtr>& meshes)
 {
-  _excludedMeshes = value;
-  _hookArrayForExcluded(value);
+  _excludedMeshes = meshes;
+  _hookArrayForExcluded(meshes);
+}
+
+void Light::addExcludedMesh(const AbstractMeshPtr& mesh)
+{
+  if (!mesh || !_excludedMeshesSet.insert(mesh.get()).second) {
+    return;
+  }
+
+  _excludedMeshes.emplace_back(mesh);
+  _resyncMeshes();
+}
+
+bool Light::removeExcludedMesh(AbstractMesh* mesh)
+{
+  if (_excludedMeshesSet.erase(mesh) == 0) {
+    return false;
+  }
+
+  stl_util::remove_vector_elements_equal_sharedptr(_excludedMeshes, mesh);
+  _resyncMeshes();
+  return true;
 }
 
 unsigned int Light::get_excludeWithLayerMask() const
@@ -336,17 +380,11 @@ bool Light::canAffectMesh(AbstractMesh* mesh)
     return true;
   }
 
-  auto it1 = std::find_if(
-    _includedOnlyMeshes.begin(), _includedOnlyMeshes.end(),
-    [mesh](const AbstractMeshPtr& includedOnlyMesh) { return includedOnlyMesh.get() == mesh; });
-  if (!_includedOnlyMeshes.empty() && it1 == _includedOnlyMeshes.end()) {
+  if (!_includedOnlyMeshes.empty() && _includedOnlyMeshesSet.count(mesh) == 0) {
     return false;
   }
 
-  auto it2 = std::find_if(
-    _excludedMeshes.begin(), _excludedMeshes.end(),
-    [mesh](const AbstractMeshPtr& excludedMesh) { return excludedMesh.get() == mesh; });
-  if (!_excludedMeshes.empty() && it2 != _excludedMeshes.end()) {
+  if (!_excludedMeshes.empty() && _excludedMeshesSet.count(mesh) != 0) {
     return false;
   }
 
@@ -361,6 +399,21 @@ bool Light::canAffectMesh(AbstractMesh* mesh)
   return true;
 }
 
+bool Light::_getLitVolumeBoundingSphere(Vector3& /*center*/, float& /*radius*/)
+{
+  return false;
+}
+
+bool Light::_isLimitedByRange() const
+{
+  return falloffType == Light::FALLOFF_STANDARD || falloffType == Light::FALLOFF_GLTF;
+}
+
+bool Light::_canLightSphere(const Vector3& /*center*/, float /*radius*/)
+{
+  return true;
+}
+
 int Light::CompareLightsPriority(Light* a, Light* b)
 {
   // shadow-casting lights have priority over non-shadow-casting lights
@@ -492,24 +545,55 @@ LightPtr Light::Parse(const json& parsedLight, Scene* scene)
   return light;
 }
 
-void Light::_hookArrayForExcluded(const std::vector<AbstractMeshPtr>& /*array*/)
+void Light::_hookArrayForExcluded(const std::vector<AbstractMeshPtr>& array)
 {
+  _excludedMeshesSet.clear();
+  for (const auto& mesh : array) {
+    _excludedMeshesSet.insert(mesh.get());
+  }
+
+  _resyncMeshes();
 }
 
-void Light::_hookArrayForIncludedOnly(const std::vector<AbstractMeshPtr>& /*array*/)
+void Light::_hookArrayForIncludedOnly(const std::vector<AbstractMeshPtr>& array)
 {
+  _includedOnlyMeshesSet.clear();
+  for (const auto& mesh : array) {
+    _includedOnlyMeshesSet.insert(mesh.get());
+  }
+
+  _resyncMeshes();
 }
 
 void Light::_resyncMeshes()
 {
-  for (auto& mesh : getScene()->meshes) {
-    mesh->_resyncLightSource(_this());
+  // Not in the scene
+  if (!_lightsTreeTracked) {
+    return;
+  }
+
+  // Only the meshes in the lit volume of the light (before and after the
+  // update of the volume) can gain, lose or reorder the light
+  for (auto& mesh : getScene()->_updateLightInLightsTree(this)) {
+    mesh->_resyncLightSources();
   }
 }
 
 void Light::_markMeshesAsLightDirty()
 {
-  for (auto& mesh : getScene()->meshes) {
+  auto scene = getScene();
+  std::vector<AbstractMesh*> meshes;
+  if (_lightsTreeProxyId != -1) {
+    meshes = scene->_getMeshesTreeCandidates(_lightsTreeCenter, _lightsTreeRadius);
+  }
+  else {
+    meshes.reserve(scene->meshes.size());
+    for (const auto& mesh : scene->meshes) {
+      meshes.emplace_back(mesh.get());
+    }
+  }
+
+  for (auto& mesh : meshes) {
     if (std::find_if(mesh->lightSources().begin(), mesh->lightSources().end(),
                      [this](const LightPtr& light) { return light.get() == this; })
         != mesh->lightSources().end()) {
@@ -171,4 +171,26 @@ void PointLight::prepareLightSpecificDefines(MaterialDefines& defines, unsigned
   defines.boolDef["POINTLIGHT" + std::to_string(lightIndex)] = true;
 }
 
+bool PointLight::_getLitVolumeBoundingSphere(Vector3& center, float& sphereRadius)
+{
+  if (range() >= std::numeric_limits<float>::max() || !_isLimitedByRange()) {
+    return false;
+  }
+
+  center       = computeTransformedInformation() ? transformedPosition() : position();
+  sphereRadius = range();
+  return true;
+}
+
+bool PointLight::_canLightSphere(const Vector3& center, float sphereRadius)
+{
+  if (range() >= std::numeric_limits<float>::max() || !_isLimitedByRange()) {
+    return true;
+  }
+
+  const auto& lightPosition = computeTransformedInformation() ? transformedPosition() : position();
+  const auto maxDistance    = range() + sphereRadius;
+  return Vector3::DistanceSquared(lightPosition, center) <= maxDistance * maxDistance;
+}
+
 } // end of namespace BABYLON
@@ -3,6 +3,7 @@
 #include <nlohmann/json.hpp>
 
 #include <babylon/babylon_stl_util.h>
+#include <babylon/baked_vertex_animation/baked_vertex_animation_manager.h>
 #include <babylon/bones/skeleton.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/core/logging.h>
@@ -799,9 +800,12 @@ void ShadowGenerator::_renderSubMeshForShadowMap(SubMesh* subMesh)
       }
     }
 
-    // Bones
-    if (renderingMesh->useBones() && renderingMesh->computeBonesUsingShaders()
-        && renderingMesh->skeleton()) {
+    // Bones, the skeleton of a mesh playing a baked vertex animation is not prepared
+    if (MaterialHelper::UseBakedVertexAnimation(renderingMesh.get())) {
+      renderingMesh->bakedVertexAnimationManager()->bind(_effect, hardwareInstancedRendering);
+    }
+    else if (renderingMesh->useBones() && renderingMesh->computeBonesUsingShaders()
+             && renderingMesh->skeleton()) {
       const auto& skeleton = renderingMesh->skeleton();
 
       if (skeleton->isUsingTextureForMatrices) {
@@ -1008,6 +1012,14 @@ bool ShadowGenerator::isReady(SubMesh* subMesh, bool useInstances)
     defines.emplace_back("#define NUM_BONE_INFLUENCERS 0");
   }
 
+  // Baked vertex animation
+  if (MaterialHelper::UseBakedVertexAnimation(mesh.get())) {
+    defines.emplace_back("#define BAKED_VERTEX_ANIMATION_TEXTURE");
+    if (useInstances) {
+      attribs.emplace_back("bakedVertexAnimationSettingsInstanced");
+    }
+  }
+
   // Morph targets
   auto manager                  = (std::static_pointer_cast<Mesh>(mesh))->morphTargetManager();
   unsigned int morphInfluencers = 0;
@@ -1073,11 +1085,26 @@ bool ShadowGenerator::isReady(SubMesh* subMesh, bool useInstances)
     _cachedDefines = join;
 
     std::string shaderName = "shadowMap";
-    std::vector<std::string> uniforms{
-      "world",       "mBones",       "viewProjection",        "diffuseMatrix",    "lightData",
-      "depthValues", "biasAndScale", "morphTargetInfluences", "boneTextureWidth", "vClipPlane",
-      "vClipPlane2", "vClipPlane3",  "vClipPlane4",           "vClipPlane5",      "vClipPlane6"};
-    std::vector<std::string> samplers{"diffuseSampler", "boneSampler"};
+    std::vector<std::string> uniforms{"world",
+                                      "mBones",
+                                      "viewProjection",
+                                      "diffuseMatrix",
+                                      "lightData",
+                                      "depthValues",
+                                      "biasAndScale",
+                                      "morphTargetInfluences",
+                                      "boneTextureWidth",
+                                      "vClipPlane",
+                                      "vClipPlane2",
+                                      "vClipPlane3",
+                                      "vClipPlane4",
+                                      "vClipPlane5",
+                                      "vClipPlane6",
+                                      "bakedVertexAnimationSettings",
+                                      "bakedVertexAnimationTextureSizeInverted",
+                                      "bakedVertexAnimationTime"};
+    std::vector<std::string> samplers{"diffuseSampler", "boneSampler",
+                                      "bakedVertexAnimationTexture"};
 
     // Custom shader?
     if (customShaderOptions) {
@@ -383,4 +383,41 @@ void SpotLight::prepareLightSpecificDefines(MaterialDefines& defines, unsigned i
     = projectionTexture() && projectionTexture()->isReady();
 }
 
+bool SpotLight::_getLitVolumeBoundingSphere(Vector3& center, float& sphereRadius)
+{
+  if (range() >= std::numeric_limits<float>::max() || !_isLimitedByRange()) {
+    return false;
+  }
+
+  center       = computeTransformedInformation() ? transformedPosition() : position();
+  sphereRadius = range();
+  return true;
+}
+
+bool SpotLight::_canLightSphere(const Vector3& center, float sphereRadius)
+{
+  const auto parented       = computeTransformedInformation();
+  const auto& lightPosition = parented ? transformedPosition() : position();
+  const auto toSphere       = center.subtract(lightPosition);
+  const auto distance       = toSphere.length();
+  if (distance <= sphereRadius) {
+    return true;
+  }
+  if (range() < std::numeric_limits<float>::max() && _isLimitedByRange()
+      && distance - sphereRadius > range()) {
+    return false;
+  }
+
+  // The sphere is lit when its angular extent, seen from the light, overlaps
+  // the cone (same direction as the one sent to the effect)
+  auto axis = Vector3::Normalize(parented ? transformedDirection() : direction());
+  if (getScene()->useRightHandedSystem()) {
+    axis.scaleInPlace(-1.f);
+  }
+  const auto cosToCenter   = std::clamp(Vector3::Dot(axis, toSphere) / distance, -1.f, 1.f);
+  const auto angularRadius = std::asin(std::min(sphereRadius / distance, 1.f));
+  return std::acos(cosToCenter) - angularRadius
+         <= std::acos(std::clamp(_cosHalfAngle, -1.f, 1.f));
+}
+
 } // end of namespace BABYLON
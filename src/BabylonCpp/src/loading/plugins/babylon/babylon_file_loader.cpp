@@ -784,7 +784,7 @@ AssetContainerPtr BabylonFileLoader::loadAssetContainer(
           auto excludedMesh = scene->getMeshByID(excludedMeshesId);
 
           if (excludedMesh) {
-            light->excludedMeshes().emplace_back(excludedMesh);
+            light->addExcludedMesh(excludedMesh);
           }
         }
 
@@ -797,7 +797,7 @@ AssetContainerPtr BabylonFileLoader::loadAssetContainer(
           auto includedOnlyMesh = scene->getMeshByID(includedOnlyMeshesId);
 
           if (includedOnlyMesh) {
-            light->includedOnlyMeshes().emplace_back(includedOnlyMesh);
+            light->addIncludedOnlyMesh(includedOnlyMesh);
           }
         }
 
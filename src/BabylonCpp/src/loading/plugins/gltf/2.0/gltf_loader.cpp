@@ -13,6 +13,7 @@
 #include <babylon/core/time.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
+#include <babylon/instrumentation/profiler.h>
 #include <babylon/loading/plugins/gltf/2.0/gltf_loader_extension.h>
 #include <babylon/loading/plugins/gltf/gltf_file_loader.h>
 #include <babylon/materials/pbr/pbr_material.h>
@@ -161,6 +162,8 @@ void GLTFLoader::loadAsync(
 void GLTFLoader::_loadAsync(const std::vector<size_t>& nodes,
                             const std::function<void()>& resultFunc)
 {
+  BABYLON_PROFILE_ZONE("Load glTF nodes");
+
   _uniqueRootUrl = (!StringTools::contains(_rootUrl, "file:") && !_fileName.empty()) ?
                      _rootUrl :
                      StringTools::printf("%s%ld/", _rootUrl.c_str(), Time::unixtimeInMs());
@@ -229,6 +232,7 @@ void GLTFLoader::_loadAsync(const std::vector<size_t>& nodes,
     _parent._endPerformanceCounter(loadingToCompleteCounterName);
 
     _setState(GLTFLoaderState::COMPLETE);
+    _releaseBufferPages();
 
     _parent.onCompleteObservable.notifyObservers(nullptr);
     _parent.onCompleteObservable.clear();
@@ -239,12 +243,14 @@ void GLTFLoader::_loadAsync(const std::vector<size_t>& nodes,
 
 void GLTFLoader::_loadData(const IGLTFLoaderData& data)
 {
+  BABYLON_PROFILE_ZONE("Load glTF data");
+
   _gltf = IGLTF::Parse(data.jsonObject);
   _setupData();
 
   if (data.bin.has_value()) {
     const auto& buffers = _gltf->buffers;
-    if (!buffers.empty() && !buffers[0].uri.empty()) {
+    if (!buffers.empty() && buffers[0].uri.empty()) {
       const auto& binaryBuffer = buffers[0];
       if (binaryBuffer.byteLength < data.bin->byteLength() - 3
           || binaryBuffer.byteLength > data.bin->byteLength()) {
@@ -336,6 +342,18 @@ void GLTFLoader::_setState(const GLTFLoaderState& iState)
   _state = iState;
 }
 
+void GLTFLoader::_releaseBufferPages()
+{
+  // The babylon buffers and textures own a copy of the data they use, the
+  // pages of the mapped files can be dropped from the resident memory
+  for (const auto& buffer : _gltf->buffers) {
+    buffer._data.releasePages();
+  }
+  if (_bin.has_value()) {
+    _bin->releasePages();
+  }
+}
+
 INodePtr GLTFLoader::_createRootNode()
 {
   _rootBabylonMesh = Mesh::New("__root__", _babylonScene);
@@ -1401,7 +1419,12 @@ ArrayBufferView& GLTFLoader::_loadBufferAsync(const std::string& context, IBuffe
   }
 
   if (buffer.uri.empty()) {
-    throw std::runtime_error(StringTools::printf("%s/uri: Value is missing", context.c_str()));
+    // The buffer without uri is the BIN chunk of a binary glTF
+    if (buffer.index != 0 || !_bin.has_value()) {
+      throw std::runtime_error(StringTools::printf("%s/uri: Value is missing", context.c_str()));
+    }
+    buffer._data = _bin->subarray(0, std::min(buffer.byteLength, _bin->byteLength()));
+    return buffer._data;
   }
 
   buffer._data = loadUriAsync(StringTools::printf("%s/uri", context.c_str()), buffer.uri);
@@ -1418,13 +1441,12 @@ ArrayBufferView& GLTFLoader::loadBufferViewAsync(const std::string& context,
 
   auto& buffer = ArrayItem::Get(StringTools::printf("%s/buffer", context.c_str()), _gltf->buffers,
                                 bufferView.buffer);
-  const auto data = _loadBufferAsync(StringTools::printf("/buffers/%ld", buffer.index), buffer);
+  const auto& data = _loadBufferAsync(StringTools::printf("/buffers/%ld", buffer.index), buffer);
 
   // ASYNC_FIXME: We cannot treat the data right now, it will be otained later!
   try {
-    bufferView._data = stl_util::to_array<uint8_t>(
-      data.uint8Array(), data.byteOffset + (bufferView.byteOffset.value_or(0)),
-      bufferView.byteLength);
+    // The buffer view shares the buffer data
+    bufferView._data = data.subarray(bufferView.byteOffset.value_or(0), bufferView.byteLength);
   }
   catch (const std::exception& e) {
     throw std::runtime_error(StringTools::printf("%s: %s", context.c_str(), e.what()));
@@ -1452,25 +1474,24 @@ ArrayBufferView& GLTFLoader::_loadAccessorAsync(const std::string& context, IAcc
   else {
     auto& bufferView = ArrayItem::Get(StringTools::printf("%s/bufferView", context.c_str()),
                                       _gltf->bufferViews, *accessor.bufferView);
-    auto data
+    const auto& data
       = loadBufferViewAsync(StringTools::printf("/bufferViews/%ld", bufferView.index), bufferView);
-    if (accessor.componentType == IGLTF2::AccessorComponentType::FLOAT && !accessor.normalized) {
-      data = GLTFLoader::_GetTypedArray(context, accessor.componentType, data, accessor.byteOffset,
-                                        length);
+    if (accessor.componentType == IGLTF2::AccessorComponentType::FLOAT
+        && !accessor.normalized.value_or(false)
+        && (!bufferView.byteStride || *bufferView.byteStride == byteStride)) {
+      // Tightly packed float data is used in place
+      accessor._data = GLTFLoader::_GetTypedArray(context, accessor.componentType, data,
+                                                  accessor.byteOffset, length);
     }
     else {
-      auto typedArray             = Float32Array(length);
-      const auto dataFloat32Array = data.float32Array();
+      auto typedArray = Float32Array(length);
       VertexBuffer::ForEach(
-        dataFloat32Array, accessor.byteOffset || 0, bufferView.byteStride || byteStride,
+        data, accessor.byteOffset.value_or(0), bufferView.byteStride.value_or(byteStride),
         numComponents, static_cast<unsigned>(accessor.componentType), typedArray.size(),
-        accessor.normalized || false,
+        accessor.normalized.value_or(false),
         [&typedArray](float value, size_t index) -> void { typedArray[index] = value; });
-      data = typedArray;
+      accessor._data = typedArray;
     }
-
-    accessor._data = GLTFLoader::_GetTypedArray(context, accessor.componentType, data,
-                                                accessor.byteOffset, length);
   }
 
   if (accessor.sparse) {
@@ -1484,20 +1505,20 @@ ArrayBufferView& GLTFLoader::_loadAccessorAsync(const std::string& context, IAcc
       auto& valuesBufferView
         = ArrayItem::Get(StringTools::printf("%s/sparse/values/bufferView", context.c_str()),
                          _gltf->bufferViews, sparse.values.bufferView);
-      const auto indicesData = loadBufferViewAsync(
+      const auto& indicesData = loadBufferViewAsync(
         StringTools::printf("/bufferViews/%ld", indicesBufferView.index), indicesBufferView);
-      const auto valuesData = loadBufferViewAsync(
+      const auto& valuesData = loadBufferViewAsync(
         StringTools::printf("/bufferViews/%ld", valuesBufferView.index), valuesBufferView);
-      const auto& indices = _castIndicesTo32bit(
+      const auto indices = _castIndicesTo32bit(
         sparse.indices.componentType,
         GLTFLoader::_GetTypedArray(StringTools::printf("%s/sparse/indices", context.c_str()),
                                    sparse.indices.componentType, indicesData,
                                    sparse.indices.byteOffset, sparse.count));
-      const auto values
+      const auto valuesView
         = GLTFLoader::_GetTypedArray(StringTools::printf("%s/sparse/values", context.c_str()),
                                      accessor.componentType, valuesData, sparse.values.byteOffset,
-                                     numComponents * sparse.count)
-            .float32Array();
+                                     numComponents * sparse.count);
+      const auto values = valuesView.typedView<float>();
       size_t valuesIndex = 0;
       for (unsigned int indice : indices) {
         auto dataIndex = indice * numComponents;
@@ -1523,9 +1544,9 @@ IndicesArray GLTFLoader::_castIndicesTo32bit(const IGLTF2::AccessorComponentType
 {
   switch (type) {
     case IGLTF2::AccessorComponentType::UNSIGNED_BYTE:
-      return stl_util::cast_array_elements<uint32_t, uint8_t>(buffer.uint8Array());
+      return buffer.typedView<uint8_t>().toArray<uint32_t>();
     case IGLTF2::AccessorComponentType::UNSIGNED_SHORT:
-      return stl_util::cast_array_elements<uint32_t, uint16_t>(buffer.uint16Array());
+      return buffer.typedView<uint16_t>().toArray<uint32_t>();
     default:
       return buffer.uint32Array();
   }
@@ -1533,17 +1554,9 @@ IndicesArray GLTFLoader::_castIndicesTo32bit(const IGLTF2::AccessorComponentType
 
 IndicesArray GLTFLoader::_getConverted32bitIndices(IAccessor& accessor)
 {
-  switch (accessor.componentType) {
-    case IGLTF2::AccessorComponentType::UNSIGNED_BYTE:
-    case IGLTF2::AccessorComponentType::UNSIGNED_SHORT:
-      accessor._data
-        = ArrayBufferView(_castIndicesTo32bit(accessor.componentType, *accessor._data));
-      break;
-    default:
-      break;
-  }
-
-  return accessor._data->uint32Array();
+  // The accessor keeps its data in the component type of the accessor, so that converting the
+  // indices twice does not reinterpret already converted data
+  return _castIndicesTo32bit(accessor.componentType, *accessor._data);
 }
 
 IndicesArray GLTFLoader::_loadIndicesAccessorAsync(const std::string& context, IAccessor& accessor)
@@ -1565,7 +1578,7 @@ IndicesArray GLTFLoader::_loadIndicesAccessorAsync(const std::string& context, I
 
   auto& bufferView = ArrayItem::Get(StringTools::printf("%s/bufferView", context.c_str()),
                                     _gltf->bufferViews, *accessor.bufferView);
-  const auto data
+  const auto& data
     = loadBufferViewAsync(StringTools::printf("/bufferViews/%ld", bufferView.index), bufferView);
   accessor._data = GLTFLoader::_GetTypedArray(context, accessor.componentType, data,
                                               accessor.byteOffset, accessor.count);
@@ -1580,10 +1593,13 @@ BufferPtr GLTFLoader::_loadVertexBufferViewAsync(IBufferView& bufferView,
     return bufferView._babylonBuffer;
   }
 
-  auto data
+  const auto& data
     = loadBufferViewAsync(StringTools::printf("/bufferViews/%ld", bufferView.index), bufferView);
+  // Single copy, from the shared glTF buffer to the storage of the babylon buffer
   bufferView._babylonBuffer
     = std::make_shared<Buffer>(_babylonScene->getEngine(), data.float32Array(), false);
+  // The copy is the only remaining user of the pages of a mapped file
+  data.releasePages();
 
   return bufferView._babylonBuffer;
 }
@@ -1599,7 +1615,7 @@ VertexBufferPtr& GLTFLoader::_loadVertexAccessorAsync(const std::string& context
     auto data
       = _loadFloatAccessorAsync(StringTools::printf("/accessors/%ld", accessor.index), accessor);
     accessor._babylonVertexBuffer
-      = std::make_unique<VertexBuffer>(_babylonScene->getEngine(), data, kind, false);
+      = std::make_unique<VertexBuffer>(_babylonScene->getEngine(), std::move(data), kind, false);
   }
   // HACK: If byte offset is not a multiple of component type byte length then
   // load as a float array instead of using Babylon buffers.
@@ -1613,7 +1629,7 @@ VertexBufferPtr& GLTFLoader::_loadVertexAccessorAsync(const std::string& context
     auto data
       = _loadFloatAccessorAsync(StringTools::printf("/accessors/%ld", accessor.index), accessor);
     accessor._babylonVertexBuffer
-      = std::make_unique<VertexBuffer>(_babylonScene->getEngine(), data, kind, false);
+      = std::make_unique<VertexBuffer>(_babylonScene->getEngine(), std::move(data), kind, false);
   }
   // Load joint indices as a float array since the shaders expect float data but glTF uses unsigned
   // byte/short. This prevents certain platforms (e.g. D3D) from having to convert the data to float
@@ -1622,7 +1638,7 @@ VertexBufferPtr& GLTFLoader::_loadVertexAccessorAsync(const std::string& context
     auto data
       = _loadFloatAccessorAsync(StringTools::printf("/accessors/%ld", accessor.index), accessor);
     accessor._babylonVertexBuffer
-      = std::make_unique<VertexBuffer>(_babylonScene->getEngine(), data, kind, false);
+      = std::make_unique<VertexBuffer>(_babylonScene->getEngine(), std::move(data), kind, false);
   }
   else {
     auto& bufferView   = ArrayItem::Get(StringTools::printf("%s/bufferView", context.c_str()),
@@ -1997,12 +2013,13 @@ BaseTexturePtr GLTFLoader::_loadTextureAsync(
 
   if (url.empty()) {
     promises.emplace_back([this, &image, &babylonTexture]() -> void {
-      const auto data = loadImageAsync(StringTools::printf("/images/%ld", image.index), image);
+      const auto& data = loadImageAsync(StringTools::printf("/images/%ld", image.index), image);
       const auto name = !image.uri.empty() ?
                           image.uri :
                           StringTools::printf("%s#image%ld", _fileName.c_str(), image.index);
       const auto dataUrl = StringTools::printf("data:%s%s", _uniqueRootUrl.c_str(), name.c_str());
-      babylonTexture->updateURL(dataUrl, data.uint8Array());
+      // The image data may be a view of a glTF buffer, only pass the bytes of the image
+      babylonTexture->updateURL(dataUrl, data.typedView<uint8_t>().toArray());
     });
   }
 
@@ -2078,7 +2095,7 @@ ArrayBufferView GLTFLoader::loadUriAsync(const std::string& context, const std::
 
   log(StringTools::printf("Loading %s", uri.c_str()));
 
-  ArrayBuffer data;
+  ArrayBufferView data;
   auto url = _parent.preprocessUrlAsync(_rootUrl + uri);
   if (!_disposed) {
     FileTools::LoadFile(
@@ -2087,8 +2104,9 @@ ArrayBufferView GLTFLoader::loadUriAsync(const std::string& context, const std::
                           const std::string & /*responseURL*/) -> void {
         if (!_disposed) {
           if (std::holds_alternative<ArrayBufferView>(fileData)) {
-            data = std::get<ArrayBufferView>(fileData).uint8Array();
-            log(StringTools::printf("Loaded %s (%ld bytes)", uri.c_str(), data.size()));
+            // Mapped (when possible) file content, shared without a copy
+            data = std::get<ArrayBufferView>(fileData);
+            log(StringTools::printf("Loaded %s (%ld bytes)", uri.c_str(), data.byteLength()));
           }
         }
       },
@@ -2201,27 +2219,27 @@ ArrayBufferView GLTFLoader::_GetTypedArray(const std::string& context,
                                            const ArrayBufferView& bufferView,
                                            std::optional<size_t> byteOffset, size_t length)
 {
-  const auto& buffer = bufferView.uint8Array();
-  byteOffset         = bufferView.byteOffset + byteOffset.value_or(0);
-
   try {
+    size_t componentByteLength = 0;
     switch (componentType) {
       case IGLTF2::AccessorComponentType::BYTE:
-        return stl_util::to_array<int8_t>(buffer, *byteOffset, length);
       case IGLTF2::AccessorComponentType::UNSIGNED_BYTE:
-        return stl_util::to_array<uint8_t>(buffer, *byteOffset, length);
+        componentByteLength = 1;
+        break;
       case IGLTF2::AccessorComponentType::SHORT:
-        return stl_util::to_array<uint16_t>(buffer, *byteOffset, length);
       case IGLTF2::AccessorComponentType::UNSIGNED_SHORT:
-        return stl_util::to_array<uint16_t>(buffer, *byteOffset, length);
+        componentByteLength = 2;
+        break;
       case IGLTF2::AccessorComponentType::UNSIGNED_INT:
-        return stl_util::to_array<uint32_t>(buffer, *byteOffset, length);
       case IGLTF2::AccessorComponentType::FLOAT:
-        return stl_util::to_array<float_t>(buffer, *byteOffset, length);
+        componentByteLength = 4;
+        break;
       default:
         throw std::runtime_error(
           StringTools::printf("Invalid component type %d", static_cast<int>(componentType)));
     }
+    // The typed array is a view of the buffer view data, no data is copied
+    return bufferView.subarray(byteOffset.value_or(0), length * componentByteLength);
   }
   catch (const std::exception& e) {
     throw std::runtime_error(StringTools::printf("%s: %s", context.c_str(), e.what()));
@@ -1,12 +1,10 @@
 #include <babylon/loading/plugins/gltf/binary_reader.h>
 
-#include <babylon/babylon_stl_util.h>
-
 namespace BABYLON {
 namespace GLTF2 {
 
-BinaryReader::BinaryReader(const ArrayBuffer& arrayBuffer)
-    : _arrayBuffer{arrayBuffer}, _dataView{DataView(arrayBuffer)}, _byteOffset{0}
+BinaryReader::BinaryReader(const ArrayBufferView& arrayBuffer)
+    : _arrayBuffer{arrayBuffer}, _byteOffset{0}
 {
 }
 
@@ -19,19 +17,20 @@ size_t BinaryReader::getPosition() const
 
 size_t BinaryReader::getLength() const
 {
-  return _arrayBuffer.size();
+  return _arrayBuffer.byteLength();
 }
 
 uint32_t BinaryReader::readUint32()
 {
-  const auto value = _dataView.getUint32(_byteOffset, true);
+  // glTF binary data is little endian, like the supported platforms
+  const auto value = _arrayBuffer.typedView<uint32_t>(_byteOffset, 1)[0];
   _byteOffset += 4;
   return value;
 }
 
-Uint8Array BinaryReader::readUint8Array(size_t length)
+ArrayBufferView BinaryReader::readUint8Array(size_t length)
 {
-  const auto value = stl_util::to_array<uint8_t>(_arrayBuffer, _byteOffset, length);
+  const auto value = _arrayBuffer.subarray(_byteOffset, length);
   _byteOffset += length;
   return value;
 }
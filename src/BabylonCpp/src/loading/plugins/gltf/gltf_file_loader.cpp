@@ -257,8 +257,8 @@ void GLTFFileLoader::_clear()
 }
 
 ImportedMeshes GLTFFileLoader::importMeshAsync(
-  const std::vector<std::string>& meshesNames, Scene* scene, const std::string& data,
-  const std::string& rootUrl,
+  const std::vector<std::string>& meshesNames, Scene* scene,
+  const std::variant<std::string, ArrayBufferView>& data, const std::string& rootUrl,
   const std::function<void(const SceneLoaderProgressEvent& event)>& onProgress,
   const std::string& fileName)
 {
@@ -269,7 +269,7 @@ ImportedMeshes GLTFFileLoader::importMeshAsync(
 }
 
 void GLTFFileLoader::loadAsync(
-  Scene* scene, const std::string& data, const std::string& rootUrl,
+  Scene* scene, const std::variant<std::string, ArrayBufferView>& data, const std::string& rootUrl,
   const std::function<void(const SceneLoaderProgressEvent& event)>& onProgress,
   const std::string& fileName)
 {
@@ -280,7 +280,7 @@ void GLTFFileLoader::loadAsync(
 }
 
 AssetContainerPtr GLTFFileLoader::loadAssetContainerAsync(
-  Scene* scene, const std::string& data, const std::string& rootUrl,
+  Scene* scene, const std::variant<std::string, ArrayBufferView>& data, const std::string& rootUrl,
   const std::function<void(const SceneLoaderProgressEvent& event)>& onProgress,
   const std::string& fileName)
 {
@@ -326,13 +326,13 @@ void GLTFFileLoader::whenCompleteAsync()
 {
 }
 
-IGLTFLoaderData GLTFFileLoader::_parseAsync(Scene* scene,
-                                            const std::variant<std::string, ArrayBuffer>& data,
-                                            const std::string& rootUrl, const std::string& fileName)
+IGLTFLoaderData
+GLTFFileLoader::_parseAsync(Scene* scene, const std::variant<std::string, ArrayBufferView>& data,
+                            const std::string& rootUrl, const std::string& fileName)
 {
   UnpackedBinary unpacked;
-  if (std::holds_alternative<ArrayBuffer>(data)) {
-    unpacked = _unpackBinary(std::get<ArrayBuffer>(data));
+  if (std::holds_alternative<ArrayBufferView>(data)) {
+    unpacked = _unpackBinary(std::get<ArrayBufferView>(data));
   }
   else if (std::holds_alternative<std::string>(data)) {
     unpacked.json = std::get<std::string>(data);
@@ -412,10 +412,10 @@ IGLTFLoaderPtr GLTFFileLoader::_getLoader(const IGLTFLoaderData& loaderData)
   return createLoaders[version->major](*this);
 }
 
-UnpackedBinary GLTFFileLoader::_unpackBinary(const ArrayBuffer& data)
+UnpackedBinary GLTFFileLoader::_unpackBinary(const ArrayBufferView& data)
 {
   _startPerformanceCounter("Unpack binary");
-  _log(StringTools::printf("Binary length: %ld", data.size()));
+  _log(StringTools::printf("Binary length: %ld", data.byteLength()));
 
   static const unsigned int Binary_Magic = 0x46546C67;
 
@@ -507,8 +507,9 @@ UnpackedBinary GLTFFileLoader::_unpackBinaryV2(BinaryReader& binaryReader) const
   }
   const auto json = GLTFFileLoader::_decodeBufferToText(binaryReader.readUint8Array(chunkLength));
 
-  // Look for BIN chunk
-  Uint8Array bin;
+  // Look for BIN chunk, the chunk is a view of the file data (memory mapped when loaded from a
+  // file)
+  std::optional<ArrayBufferView> bin;
   while (binaryReader.getPosition() < binaryReader.getLength()) {
     const auto chunkLength2 = binaryReader.readUint32();
     const auto chunkFormat2 = binaryReader.readUint32();
@@ -572,16 +573,10 @@ int GLTFFileLoader::_compareVersion(const Version& a, const Version& b)
   return 0;
 }
 
-std::string GLTFFileLoader::_decodeBufferToText(const Uint8Array& buffer)
+std::string GLTFFileLoader::_decodeBufferToText(const ArrayBufferView& buffer)
 {
-  std::ostringstream result;
-  const auto length = buffer.size();
-
-  for (size_t i = 0; i < length; ++i) {
-    result << StringTools::fromCharCode(buffer[i]);
-  }
-
-  return result.str();
+  // The JSON chunk is UTF-8 encoded text
+  return std::string(reinterpret_cast<const char*>(buffer.data()), buffer.byteLength());
 }
 
 void GLTFFileLoader::_logOpen(const std::string& message)
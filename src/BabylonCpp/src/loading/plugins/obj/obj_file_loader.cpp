@@ -1,7 +1,15 @@
 #include <babylon/loading/plugins/obj/obj_file_loader.h>
 
+#include <algorithm>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+
 #include <babylon/babylon_stl_util.h>
+#include <babylon/core/filesystem.h>
 #include <babylon/core/logging.h>
+#include <babylon/core/memory_mapped_file.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/engines/scene.h>
 #include <babylon/materials/standard_material.h>
 #include <babylon/maths/vector3.h>
@@ -12,6 +20,224 @@
 
 namespace BABYLON {
 
+namespace {
+
+enum class OBJKeyword {
+  Empty,    // Empty line or comment
+  Vertex,   // v x y z [r g b [a]]
+  Normal,   // vn x y z
+  UV,       // vt u v [w]
+  Face,     // f v1 v2 v3 ...
+  Object,   // o name, g name
+  UseMtl,   // usemtl name
+  MtlLib,   // mtllib file
+  Smooth,   // s group
+  Unhandled // anything else
+}; // end of enum class OBJKeyword
+
+/**
+ * @brief Cursor over the characters of one line.
+ */
+struct OBJLineTokenizer {
+  const char* current;
+  const char* end;
+
+  static bool IsSpace(char c)
+  {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\v';
+  }
+
+  void skipSpaces()
+  {
+    while (current < end && IsSpace(*current)) {
+      ++current;
+    }
+  }
+
+  std::string_view nextToken()
+  {
+    skipSpaces();
+    const auto start = current;
+    while (current < end && !IsSpace(*current)) {
+      ++current;
+    }
+    return std::string_view(start, static_cast<size_t>(current - start));
+  }
+
+  // Remaining text of the line, without leading and trailing spaces
+  std::string_view rest()
+  {
+    skipSpaces();
+    auto last = end;
+    while (last > current && IsSpace(*(last - 1))) {
+      --last;
+    }
+    return std::string_view(current, static_cast<size_t>(last - current));
+  }
+}; // end of struct OBJLineTokenizer
+
+OBJKeyword ReadKeyword(OBJLineTokenizer& tokenizer)
+{
+  const auto keyword = tokenizer.nextToken();
+  if (keyword.empty() || keyword[0] == '#') {
+    return OBJKeyword::Empty;
+  }
+  switch (keyword[0]) {
+    case 'v':
+      if (keyword.size() == 1) {
+        return OBJKeyword::Vertex;
+      }
+      if (keyword == "vn") {
+        return OBJKeyword::Normal;
+      }
+      if (keyword == "vt") {
+        return OBJKeyword::UV;
+      }
+      break;
+    case 'f':
+      if (keyword.size() == 1) {
+        return OBJKeyword::Face;
+      }
+      break;
+    case 'o':
+    case 'g':
+      if (keyword.size() == 1) {
+        return OBJKeyword::Object;
+      }
+      break;
+    case 's':
+      if (keyword.size() == 1) {
+        return OBJKeyword::Smooth;
+      }
+      break;
+    case 'u':
+      if (keyword == "usemtl") {
+        return OBJKeyword::UseMtl;
+      }
+      break;
+    case 'm':
+      if (keyword == "mtllib") {
+        return OBJKeyword::MtlLib;
+      }
+      break;
+    default:
+      break;
+  }
+  return OBJKeyword::Unhandled;
+}
+
+bool ParseFloat(std::string_view token, float& value)
+{
+  auto first      = token.data();
+  const auto last = first + token.size();
+  if (first != last && *first == '+') {
+    ++first;
+  }
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+  const auto result = std::from_chars(first, last, value);
+  return result.ec == std::errc() && result.ptr == last;
+#else
+  // No floating point std::from_chars (libc++)
+  char buffer[64];
+  const auto length = std::min(static_cast<size_t>(last - first), sizeof(buffer) - 1);
+  std::memcpy(buffer, first, length);
+  buffer[length] = '\0';
+  char* parsedEnd = nullptr;
+  value           = std::strtof(buffer, &parsedEnd);
+  return parsedEnd == buffer + length && length > 0;
+#endif
+}
+
+/**
+ * @brief Parses an obj index ("3", "-1", ...) and resolves it to a 0-based
+ * index. Negative indices are relative to the count elements read so far,
+ * positive ones must be lower than the total number of elements of the file.
+ */
+bool ParseIndex(std::string_view token, size_t count, size_t total, uint32_t& index)
+{
+  int64_t value     = 0;
+  const auto last   = token.data() + token.size();
+  const auto result = std::from_chars(token.data(), last, value);
+  if (result.ec != std::errc() || result.ptr != last || value == 0) {
+    return false;
+  }
+  // Negative indices are relative to the end of the array
+  const auto resolved = value > 0 ? value - 1 : static_cast<int64_t>(count) + value;
+  if (resolved < 0 || resolved >= static_cast<int64_t>(total)) {
+    return false;
+  }
+  index = static_cast<uint32_t>(resolved);
+  return true;
+}
+
+/**
+ * @brief Statement of the file affecting the mesh being built, in file order
+ * with the faces.
+ */
+struct OBJStatement {
+  OBJKeyword keyword;
+  // Number of face vertices of the chunk read before the statement
+  size_t faceVertexOffset;
+  // Argument of the statement (or the whole line when unhandled)
+  std::string_view argument;
+}; // end of struct OBJStatement
+
+/**
+ * @brief Range of lines of the file, tokenized independently of the others.
+ */
+struct OBJChunk {
+  std::string_view text;
+  // Number of v, vn and vt statements in the chunk
+  size_t nbPositions = 0;
+  size_t nbNormals   = 0;
+  size_t nbUVs       = 0;
+  // Number of v, vn and vt statements in the previous chunks
+  size_t positionOffset = 0;
+  size_t normalOffset   = 0;
+  size_t uvOffset       = 0;
+  // Triangulated faces, 3 vertices per triangle
+  std::vector<OBJVertexKey> faceVertices;
+  std::vector<OBJStatement> statements;
+}; // end of struct OBJChunk
+
+template <typename Callback>
+void ForEachLine(std::string_view text, Callback&& callback)
+{
+  auto current   = text.data();
+  const auto end = current + text.size();
+  while (current < end) {
+    auto lineEnd = static_cast<const char*>(
+      std::memchr(current, '\n', static_cast<size_t>(end - current)));
+    if (!lineEnd) {
+      lineEnd = end;
+    }
+    OBJLineTokenizer tokenizer{current, lineEnd};
+    callback(tokenizer);
+    current = lineEnd + 1;
+  }
+}
+
+/**
+ * @brief Splits the text in about nbChunks chunks, on line boundaries.
+ */
+std::vector<OBJChunk> SplitInChunks(std::string_view data, size_t nbChunks)
+{
+  std::vector<OBJChunk> chunks;
+  size_t begin = 0;
+  for (size_t i = 1; i <= nbChunks && begin < data.size(); ++i) {
+    auto end = (i == nbChunks) ? data.size() : std::max(begin, data.size() * i / nbChunks);
+    end      = std::min(data.find('\n', end), data.size());
+    end      = (end < data.size()) ? end + 1 : end;
+    OBJChunk chunk;
+    chunk.text = data.substr(begin, end - begin);
+    chunks.emplace_back(std::move(chunk));
+    begin = end;
+  }
+  return chunks;
+}
+
+} // end of anonymous namespace
+
 bool OBJFileLoader::OPTIMIZE_WITH_UV = true;
 
 bool OBJFileLoader::INVERT_Y = false;
@@ -50,573 +276,392 @@ bool OBJFileLoader::canDirectLoad(const std::string& /*data*/)
   return false;
 }
 
-int OBJFileLoader::_isInArray(std::vector<TuplePosNormEntry>& arr, const std::vector<size_t>& iObj)
+std::vector<AbstractMeshPtr> OBJFileLoader::importMesh(const std::vector<std::string>& meshesNames,
+                                                       Scene* scene, std::string_view data,
+                                                       const std::string& rootUrl)
 {
-  if (arr.size() < iObj[0]) {
-    arr.resize(iObj[0] + 1);
-    arr[iObj[0]] = {};
-  }
-  auto idx = stl_util::index_of(arr[iObj[0]].normals, iObj[1]);
-
-  return idx == -1 ? -1 : static_cast<int>(arr[iObj[0]].idx[static_cast<size_t>(idx)]);
+  return _parseSolid(meshesNames, scene, data, rootUrl);
 }
 
-int OBJFileLoader::_isInArrayUV(std::vector<TuplePosNormEntry>& arr,
-                                const std::vector<size_t>& iObj)
+std::vector<AbstractMeshPtr>
+OBJFileLoader::importMeshFromFile(const std::vector<std::string>& meshesNames, Scene* scene,
+                                  const std::string& filename)
 {
-  if (arr.size() < iObj[0]) {
-    arr.resize(iObj[0] + 1);
-    arr[iObj[0]] = {};
+  const auto file = MemoryMappedFile::Open(filename);
+  if (!file) {
+    BABYLON_LOG_ERROR("OBJFileLoader", "Unable to read file : %s", filename.c_str())
+    return {};
   }
-  auto idx = stl_util::index_of(arr[iObj[0]].normals, iObj[1]);
 
-  if (idx != 1 && (iObj[2] == arr[iObj[0]].uv[static_cast<size_t>(idx)])) {
-    return static_cast<int>(arr[iObj[0]].idx[static_cast<size_t>(idx)]);
-  }
-  return -1;
+  return _parseSolid(meshesNames, scene, file->view(), Filesystem::baseDir(filename));
 }
 
-void OBJFileLoader::_setData(size_t indicePositionFromObj, size_t indiceUvsFromObj,
-                             size_t indiceNormalFromObj, const Vector3& positionVectorFromOBJ,
-                             const Vector2& textureVectorFromOBJ,
-                             const Vector3& normalsVectorFromOBJ, OBJParseSolidState& state,
-                             const std::optional<Color4>& positionColorsFromOBJ)
+void OBJFileLoader::_setData(const OBJVertexKey& vertex, OBJParseSolidState& state)
 {
   // Check if this tuple already exists in the list of tuples
-  int _index;
-  if (_meshLoadOptions.OptimizeWithUV) {
-    _index = _isInArrayUV(state.tuplePosNorm,
-                          {indicePositionFromObj, indiceNormalFromObj, indiceUvsFromObj});
-  }
-  else {
-    _index = _isInArray(state.tuplePosNorm, {indicePositionFromObj, indiceNormalFromObj});
+  auto key = vertex;
+  if (!_meshLoadOptions.OptimizeWithUV) {
+    key.uv = OBJVertexKey::Undefined;
   }
+  const auto nextIndex = static_cast<uint32_t>(state.unwrappedPositionsForBabylon.size() / 3);
+  const auto [it, inserted] = state.vertexIndices.try_emplace(key, nextIndex);
 
   // If it not exists
-  if (_index == -1) {
-    // Add an new indice.
-    // The array of indices is only an array with his length equal to the number of triangles - 1.
-    // We add vertices data in this order
-    state.indicesForBabylon.emplace_back(
-      static_cast<uint32_t>(state.wrappedPositionForBabylon.size()));
+  if (inserted) {
     // Push the position of vertice for Babylon
-    // Each element is a Vector3(x,y,z)
-    state.wrappedPositionForBabylon.emplace_back(positionVectorFromOBJ);
-    // Push the uvs for Babylon
-    // Each element is a Vector3(u,v)
-    state.wrappedUvsForBabylon.emplace_back(textureVectorFromOBJ);
-    // Push the normals for Babylon
-    // Each element is a Vector3(x,y,z)
-    state.wrappedNormalsForBabylon.emplace_back(normalsVectorFromOBJ);
-
-    if (positionColorsFromOBJ.has_value()) {
-      // Push the colors for Babylon
-      // Each element is a BABYLON.Color4(r,g,b,a)
-      state.wrappedColorsForBabylon.emplace_back(*positionColorsFromOBJ);
+    const auto position = &state.positions[vertex.position * 3];
+    state.unwrappedPositionsForBabylon.insert(state.unwrappedPositionsForBabylon.end(), position,
+                                              position + 3);
+    // Push the uvs for Babylon, (0, 0) when not defined
+    if (vertex.uv != OBJVertexKey::Undefined) {
+      const auto uv = &state.uvs[vertex.uv * 2];
+      state.unwrappedUVForBabylon.insert(state.unwrappedUVForBabylon.end(), uv, uv + 2);
     }
-
-    // Add the tuple in the comparison list
-    state.tuplePosNorm[indicePositionFromObj].normals.emplace_back(indiceNormalFromObj);
-    state.tuplePosNorm[indicePositionFromObj].idx.emplace_back(state.curPositionInIndices++);
-    if (_meshLoadOptions.OptimizeWithUV) {
-      state.tuplePosNorm[indicePositionFromObj].uv.emplace_back(indiceUvsFromObj);
+    else {
+      stl_util::concat(state.unwrappedUVForBabylon, {0.f, 0.f});
     }
-  }
-  else {
-    // The tuple already exists
-    // Add the index of the already existing tuple
-    // At this index we can get the value of position, normal, color and uvs of vertex
-    state.indicesForBabylon.emplace_back(_index);
-  }
-}
-
-void OBJFileLoader::_unwrapData(OBJParseSolidState& state)
-{
-  // Every array has the same length
-  for (size_t l = 0; l < state.wrappedPositionForBabylon.size(); ++l) {
-    // Push the x, y, z values of each element in the unwrapped array
-    stl_util::concat(state.unwrappedPositionsForBabylon,
-                     {state.wrappedPositionForBabylon[l].x, state.wrappedPositionForBabylon[l].y,
-                      state.wrappedPositionForBabylon[l].z});
-    stl_util::concat(state.unwrappedNormalsForBabylon,
-                     {state.wrappedNormalsForBabylon[l].x, state.wrappedNormalsForBabylon[l].y,
-                      state.wrappedNormalsForBabylon[l].z});
-    stl_util::concat(
-      state.unwrappedUVForBabylon,
-      {state.wrappedUvsForBabylon[l].x,
-       state.wrappedUvsForBabylon[l].y}); // z is an optional value not supported by BABYLON
-    if (_meshLoadOptions.ImportVertexColors == true) {
-      // Push the r, g, b, a values of each element in the unwrapped array
-      stl_util::concat(state.unwrappedColorsForBabylon,
-                       {state.wrappedColorsForBabylon[l].r, state.wrappedColorsForBabylon[l].g,
-                        state.wrappedColorsForBabylon[l].b, state.wrappedColorsForBabylon[l].a});
+    // Push the normals for Babylon, up vector when not defined
+    if (vertex.normal != OBJVertexKey::Undefined) {
+      const auto normal = &state.normals[vertex.normal * 3];
+      state.unwrappedNormalsForBabylon.insert(state.unwrappedNormalsForBabylon.end(), normal,
+                                              normal + 3);
+    }
+    else {
+      stl_util::concat(state.unwrappedNormalsForBabylon, {0.f, 1.f, 0.f});
+    }
+    if (_meshLoadOptions.ImportVertexColors) {
+      // Push the colors for Babylon [r,g,b,a]
+      const auto color = &state.colors[vertex.position * 4];
+      state.unwrappedColorsForBabylon.insert(state.unwrappedColorsForBabylon.end(), color,
+                                             color + 4);
     }
-  }
-  // Reset arrays for the next new meshes
-  state.wrappedPositionForBabylon = {};
-  state.wrappedNormalsForBabylon  = {};
-  state.wrappedUvsForBabylon      = {};
-  state.wrappedColorsForBabylon   = {};
-  state.tuplePosNorm              = {};
-  state.curPositionInIndices      = 0;
-}
-
-void OBJFileLoader::_getTriangles(const std::vector<std::string>& faces, size_t v,
-                                  OBJParseSolidState& state)
-{
-  // Work for each element of the array
-  for (size_t faceIndex = v; faceIndex < faces.size() - 1; ++faceIndex) {
-    // Add on the triangle variable the indexes to obtain triangles
-    stl_util::concat(state.triangles, {faces[0], faces[faceIndex], faces[faceIndex + 1]});
   }
 
-  // Result obtained after 2 iterations:
-  // Pattern1 => triangle = ["1","2","3","1","3","4"];
-  // Pattern2 => triangle = ["1/1","2/2","3/3","1/1","3/3","4/4"];
-  // Pattern3 => triangle = ["1/1/1","2/2/2","3/3/3","1/1/1","3/3/3","4/4/4"];
-  // Pattern4 => triangle = ["1//1","2//2","3//3","1//1","3//3","4//4"];
-  // Pattern5 => triangle = ["-1/-1/-1","-2/-2/-2","-3/-3/-3","-1/-1/-1","-3/-3/-3","-4/-4/-4"];
+  // Add the index of the vertex, at this index we can get the value of position, normal, color
+  // and uvs of vertex
+  state.indicesForBabylon.emplace_back(it->second);
 }
 
-void OBJFileLoader::_setDataForCurrentFaceWithPattern1(const std::vector<std::string>& face,
-                                                       size_t v, OBJParseSolidState& state)
+void OBJFileLoader::_addPreviousObjMesh(OBJParseSolidState& state)
 {
-  // Get the indices of triangles for each polygon
-  _getTriangles(face, v, state);
-  // For each element in the triangles array.
-  // This var could contains 1 to an infinity of triangles
-  for (const auto& triangle : state.triangles) {
-    // Set position indice
-    const auto indicePositionFromObj = StringTools::toNumber<size_t>(triangle) - 1;
-
-    std::optional<Color4> positionColorsFromOBJ = std::nullopt;
-    if (_meshLoadOptions.ImportVertexColors == true) {
-      state.colors[indicePositionFromObj];
-    }
-    _setData(indicePositionFromObj, 0, 0, // In the pattern 1, normals and uvs are not defined
-             state.positions[indicePositionFromObj], // Get the vectors data
-             Vector2::Zero(), Vector3::Up(),         // Create default vectors
-             state, positionColorsFromOBJ);
+  // Check if it is not the first mesh. Otherwise we don't have data.
+  if (state.meshesFromObj.empty()) {
+    return;
   }
-  // Reset variable for the next line
-  state.triangles = {};
-}
 
-void OBJFileLoader::_setDataForCurrentFaceWithPattern2(const std::vector<std::string>& face,
-                                                       size_t v, OBJParseSolidState& state)
-{
-  // Get the indices of triangles for each polygon
-  _getTriangles(face, v, state);
-  for (const auto& triangle : state.triangles) {
-    // triangle[k] = "1/1"
-    // Split the data for getting position and uv
-    const auto point = StringTools::split(triangle, '/'); // ["1", "1"]
-    // Set position indice
-    const auto indicePositionFromObj = StringTools::toNumber<size_t>(point[0]) - 1;
-    // Set uv indice
-    const auto indiceUvsFromObj = StringTools::toNumber<size_t>(point[1]) - 1;
-
-    std::optional<Color4> positionColorsFromOBJ = std::nullopt;
-    if (_meshLoadOptions.ImportVertexColors == true) {
-      state.colors[indicePositionFromObj];
-    }
-    _setData(indicePositionFromObj, indiceUvsFromObj,
-             0,                                      // Default value for normals
-             state.positions[indicePositionFromObj], // Get the values for each element
-             state.uvs[indiceUvsFromObj],
-             Vector3::Up(), // Default value for normals
-             state, positionColorsFromOBJ);
-  }
+  // Get the previous mesh for applying the data about the faces
+  // => in obj file, faces definition append after the name of the mesh
+  auto& handledMesh = state.meshesFromObj.back();
 
-  // Reset variable for the next line
-  state.triangles = {};
-}
+  // Reverse tab. Otherwise face are displayed in the wrong sense
+  std::reverse(state.indicesForBabylon.begin(), state.indicesForBabylon.end());
+  // Set the information for the mesh
+  handledMesh.indices   = std::move(state.indicesForBabylon);
+  handledMesh.positions = std::move(state.unwrappedPositionsForBabylon);
+  handledMesh.normals   = std::move(state.unwrappedNormalsForBabylon);
+  handledMesh.uvs       = std::move(state.unwrappedUVForBabylon);
 
-void OBJFileLoader::_setDataForCurrentFaceWithPattern3(const std::vector<std::string>& face,
-                                                       size_t v, OBJParseSolidState& state)
-{
-  // Get the indices of triangles for each polygon
-  _getTriangles(face, v, state);
-
-  for (const auto& triangle : state.triangles) {
-    // triangle[k] = "1/1/1"
-    // Split the data for getting position, uv, and normals
-    const auto point = StringTools::split(triangle, '/'); // ["1", "1", "1"]
-    // Set position indice
-    const auto indicePositionFromObj = StringTools::toNumber<size_t>(point[0]) - 1;
-    // Set uv indice
-    const auto indiceUvsFromObj = StringTools::toNumber<size_t>(point[1]) - 1;
-    // Set normal indice
-    const auto indiceNormalFromObj = StringTools::toNumber<size_t>(point[2]) - 1;
-
-    _setData(indicePositionFromObj, indiceUvsFromObj, indiceNormalFromObj,
-             state.positions[indicePositionFromObj], state.uvs[indiceUvsFromObj],
-             state.normals[indiceNormalFromObj], // Set the vector for each component
-             state);
+  if (_meshLoadOptions.ImportVertexColors) {
+    handledMesh.colors = std::move(state.unwrappedColorsForBabylon);
   }
-  // Reset variable for the next line
-  state.triangles = {};
-}
 
-void OBJFileLoader::_setDataForCurrentFaceWithPattern4(const std::vector<std::string>& face,
-                                                       size_t v, OBJParseSolidState& state)
-{
-  _getTriangles(face, v, state);
-
-  for (const auto& triangle : state.triangles) {
-    // triangle[k] = "1//1"
-    // Split the data for getting position and normals
-    const auto point = StringTools::split(triangle, "//"); // ["1", "1"] // TODO FIXME
-    // We check indices, and normals
-    const auto indicePositionFromObj = StringTools::toNumber<size_t>(point[0]) - 1;
-    const auto indiceNormalFromObj   = StringTools::toNumber<size_t>(point[1]) - 1;
-
-    std::optional<Color4> positionColorsFromOBJ = std::nullopt;
-    if (_meshLoadOptions.ImportVertexColors == true) {
-      state.colors[indicePositionFromObj];
-    }
-    _setData(indicePositionFromObj,
-             1, // Default value for uv
-             indiceNormalFromObj,
-             state.positions[indicePositionFromObj], // Get each vector of data
-             Vector2::Zero(), state.normals[indiceNormalFromObj], state, positionColorsFromOBJ);
-  }
-  // Reset variable for the next line
-  state.triangles = {};
+  // Reset the arrays for the next mesh
+  state.indicesForBabylon            = {};
+  state.unwrappedPositionsForBabylon = {};
+  state.unwrappedColorsForBabylon    = {};
+  state.unwrappedNormalsForBabylon   = {};
+  state.unwrappedUVForBabylon        = {};
+  state.vertexIndices.clear();
 }
 
-void OBJFileLoader::_setDataForCurrentFaceWithPattern5(const std::vector<std::string>& face,
-                                                       size_t v, OBJParseSolidState& state)
+void OBJFileLoader::_parseMeshObjects(std::string_view data, OBJParseSolidState& state)
 {
-  // Get the indices of triangles for each polygon
-  _getTriangles(face, v, state);
-
-  for (const auto& triangle : state.triangles) {
-    // triangle[k] = "-1/-1/-1"
-    // Split the data for getting position, uv, and normals
-    const auto point = StringTools::split(triangle, '/'); // ["-1", "-1", "-1"]
-    // Set position indice
-    const auto indicePositionFromObj
-      = state.positions.size() + StringTools::toNumber<size_t>(point[0]);
-    // Set uv indice
-    const auto indiceUvsFromObj = state.uvs.size() + StringTools::toNumber<size_t>(point[1]);
-    // Set normal indice
-    const auto indiceNormalFromObj = state.normals.size() + StringTools::toNumber<size_t>(point[2]);
-
-    std::optional<Color4> positionColorsFromOBJ = std::nullopt;
-    if (_meshLoadOptions.ImportVertexColors == true) {
-      state.colors[indicePositionFromObj];
+  // Chunks of at least 1MB, a few per thread for load balancing
+  static constexpr size_t MinChunkSize = 1 << 20;
+
+  auto& threadPool    = ThreadPool::Default();
+  const auto nbChunks = std::clamp<size_t>(data.size() / MinChunkSize, 1,
+                                           threadPool.concurrency() * 4);
+  auto chunks         = SplitInChunks(data, nbChunks);
+
+  // Pass 1: count the vertex statements of each chunk
+  threadPool.parallelFor(chunks.size(), 1, [&chunks](size_t begin, size_t end) {
+    for (auto c = begin; c < end; ++c) {
+      auto& chunk = chunks[c];
+      ForEachLine(chunk.text, [&chunk](OBJLineTokenizer& tokenizer) {
+        switch (ReadKeyword(tokenizer)) {
+          case OBJKeyword::Vertex:
+            ++chunk.nbPositions;
+            break;
+          case OBJKeyword::Normal:
+            ++chunk.nbNormals;
+            break;
+          case OBJKeyword::UV:
+            ++chunk.nbUVs;
+            break;
+          default:
+            break;
+        }
+      });
     }
-    _setData(indicePositionFromObj, indiceUvsFromObj, indiceNormalFromObj,
-             state.positions[indicePositionFromObj], state.uvs[indiceUvsFromObj],
-             state.normals[indiceNormalFromObj], // Set the vector for each component
-             state, positionColorsFromOBJ);
+  });
+
+  size_t nbPositions = 0, nbNormals = 0, nbUVs = 0;
+  for (auto& chunk : chunks) {
+    chunk.positionOffset = nbPositions;
+    chunk.normalOffset   = nbNormals;
+    chunk.uvOffset       = nbUVs;
+    nbPositions += chunk.nbPositions;
+    nbNormals += chunk.nbNormals;
+    nbUVs += chunk.nbUVs;
   }
-  // Reset variable for the next line
-  state.triangles = {};
-}
-
-void OBJFileLoader::_addPreviousObjMesh(OBJParseSolidState& state)
-{
-  // Check if it is not the first mesh. Otherwise we don't have data.
-  if (state.meshesFromObj.size() > 0) {
-    // Get the previous mesh for applying the data about the faces
-    // => in obj file, faces definition append after the name of the mesh
-    state.handledMesh = state.meshesFromObj.back();
 
-    // Set the data into Array for the mesh
-    _unwrapData(state);
-
-    // Reverse tab. Otherwise face are displayed in the wrong sense
-    std::reverse(state.indicesForBabylon.begin(), state.indicesForBabylon.end());
-    // Set the information for the mesh
-    // Slice the array to avoid rewriting because of the fact this is the same var which be rewrited
-    state.handledMesh.indices   = state.indicesForBabylon;
-    state.handledMesh.positions = state.unwrappedPositionsForBabylon;
-    state.handledMesh.normals   = state.unwrappedNormalsForBabylon;
-    state.handledMesh.uvs       = state.unwrappedUVForBabylon;
-
-    if (_meshLoadOptions.ImportVertexColors == true) {
-      state.handledMesh.colors = state.unwrappedColorsForBabylon;
-    }
-
-    // Reset the array for the next mesh
-    state.indicesForBabylon            = {};
-    state.unwrappedPositionsForBabylon = {};
-    state.unwrappedColorsForBabylon    = {};
-    state.unwrappedNormalsForBabylon   = {};
-    state.unwrappedUVForBabylon        = {};
+  const auto importVertexColors = _meshLoadOptions.ImportVertexColors;
+  const auto uvScaling          = _meshLoadOptions.UVScaling;
+  state.positions.resize(nbPositions * 3);
+  state.normals.resize(nbNormals * 3);
+  state.uvs.resize(nbUVs * 2);
+  if (importVertexColors) {
+    state.colors.resize(nbPositions * 4);
   }
-}
-
-std::vector<AbstractMeshPtr> OBJFileLoader::_parseSolid(const std::vector<std::string>& meshesNames,
-                                                        Scene* scene, const std::string& data,
-                                                        const std::string& /*rootUrl*/)
-{
-  OBJParseSolidState state = {};
 
-  // Split the file into lines
-  auto lines = StringTools::split(data, '\n');
-  const std::string regex{"\\s\\s"};
-  // Look at each line
-  for (auto line : lines) {
-    line = StringTools::regexReplace(StringTools::trim(line), regex, " ");
-    std::vector<std::string> result;
-
-    // Comment or newLine
-    if (line.empty() || line[0] == '#') {
-      continue;
-
-      // Get information about one position possible for the vertices
-    }
-    else if (!StringTools::regexMatch(line, std::regex(vertexPattern, std::regex::optimize))
-                .empty()) {
-      result = StringTools::regexMatch(line, std::regex(R"([^ ]+)", std::regex::optimize));
-
-      // Value of result with line: "v 1.0 2.0 3.0"
-      // ["v", "1.0", "2.0", "3.0"]
-      // Create a Vector3 with the position x, y, z
-      state.positions.emplace_back(Vector3(StringTools::toNumber<float>(result[1]), //
-                                           StringTools::toNumber<float>(result[2]), //
-                                           StringTools::toNumber<float>(result[3])  //
-                                           ));
-
-      if (_meshLoadOptions.ImportVertexColors == true) {
-        if (result.size() >= 7) {
-          // TODO: if these numbers are > 1 we can use Color4.FromInts(r,g,b,a)
-          state.colors.emplace_back(Color4(StringTools::toNumber<float>(result[4]), //
-                                           StringTools::toNumber<float>(result[5]), //
-                                           StringTools::toNumber<float>(result[6]), //
-                                           (result.size() == 7 /* || result[7] == undefined */) ?
-                                             1.f :
-                                             StringTools::toNumber<float>(result[7])));
-        }
-        else {
-          // TODO: maybe push NULL and if all are NULL to skip (and remove grayColor var).
-          state.colors.emplace_back(state.grayColor);
+  // Pass 2: parse the values and the faces, every chunk writes its values at its offsets
+  threadPool.parallelFor(chunks.size(), 1, [&](size_t begin, size_t end) {
+    for (auto c = begin; c < end; ++c) {
+      auto& chunk        = chunks[c];
+      auto positionIndex = chunk.positionOffset;
+      auto normalIndex   = chunk.normalOffset;
+      auto uvIndex       = chunk.uvOffset;
+      std::vector<OBJVertexKey> polygon;
+      float values[7];
+
+      ForEachLine(chunk.text, [&](OBJLineTokenizer& tokenizer) {
+        const auto line    = tokenizer;
+        const auto keyword = ReadKeyword(tokenizer);
+        // Reads up to maxValues numbers, returns how many were read (0 on error)
+        const auto readValues = [&tokenizer, &values](size_t maxValues) {
+          size_t nbValues = 0;
+          for (auto token = tokenizer.nextToken(); !token.empty() && nbValues < maxValues;
+               token      = tokenizer.nextToken()) {
+            if (!ParseFloat(token, values[nbValues])) {
+              return size_t{0};
+            }
+            ++nbValues;
+          }
+          return nbValues;
+        };
+        const auto addUnhandled = [&chunk, &line]() {
+          auto lineTokenizer = line;
+          chunk.statements.emplace_back(
+            OBJStatement{OBJKeyword::Unhandled, chunk.faceVertices.size(), lineTokenizer.rest()});
+        };
+
+        switch (keyword) {
+          case OBJKeyword::Vertex: {
+            // ["v", "1.0", "2.0", "3.0"] or ["v", "1.0", "2.0", "3.0", "r", "g", "b"(, "a")]
+            const auto nbValues = readValues(7);
+            const auto position = &state.positions[positionIndex * 3];
+            if (nbValues >= 3) {
+              std::copy(values, values + 3, position);
+            }
+            else {
+              addUnhandled();
+            }
+            if (importVertexColors) {
+              const auto color = &state.colors[positionIndex * 4];
+              if (nbValues >= 6) {
+                std::copy(values + 3, values + 6, color);
+                color[3] = (nbValues == 7) ? values[6] : 1.f;
+              }
+              else {
+                color[0] = state.grayColor.r;
+                color[1] = state.grayColor.g;
+                color[2] = state.grayColor.b;
+                color[3] = state.grayColor.a;
+              }
+            }
+            ++positionIndex;
+          } break;
+          case OBJKeyword::Normal: {
+            // ["vn", "1.0", "2.0", "3.0"]
+            const auto normal = &state.normals[normalIndex * 3];
+            if (readValues(3) == 3) {
+              std::copy(values, values + 3, normal);
+            }
+            else {
+              addUnhandled();
+            }
+            ++normalIndex;
+          } break;
+          case OBJKeyword::UV: {
+            // ["vt", "0.1", "0.2"(, "0.3")], w is not supported by BABYLON
+            const auto uv = &state.uvs[uvIndex * 2];
+            if (readValues(3) >= 2) {
+              uv[0] = values[0] * uvScaling.x;
+              uv[1] = values[1] * uvScaling.y;
+            }
+            else {
+              addUnhandled();
+            }
+            ++uvIndex;
+          } break;
+          case OBJKeyword::Face: {
+            // Face vertices are "1", "1/1", "1/1/1", "1//1", negative indices being relative to
+            // the last vertex read
+            polygon.clear();
+            bool valid = true;
+            for (auto token = tokenizer.nextToken(); valid && !token.empty();
+                 token      = tokenizer.nextToken()) {
+              OBJVertexKey vertex;
+              const auto slash = token.find('/');
+              valid = ParseIndex(token.substr(0, slash), positionIndex, nbPositions, vertex.position);
+              if (valid && slash != std::string_view::npos) {
+                const auto uvAndNormal = token.substr(slash + 1);
+                const auto slash2      = uvAndNormal.find('/');
+                const auto uvToken     = uvAndNormal.substr(0, slash2);
+                if (!uvToken.empty()) {
+                  valid = ParseIndex(uvToken, uvIndex, nbUVs, vertex.uv);
+                }
+                if (valid && slash2 != std::string_view::npos) {
+                  valid = ParseIndex(uvAndNormal.substr(slash2 + 1), normalIndex, nbNormals,
+                                     vertex.normal);
+                }
+              }
+              polygon.emplace_back(vertex);
+            }
+            if (!valid || polygon.size() < 3) {
+              addUnhandled();
+              break;
+            }
+            // Create triangles from the polygon: [0, 1, 2], [0, 2, 3], ...
+            for (size_t v = 1; v + 1 < polygon.size(); ++v) {
+              chunk.faceVertices.emplace_back(polygon[0]);
+              chunk.faceVertices.emplace_back(polygon[v]);
+              chunk.faceVertices.emplace_back(polygon[v + 1]);
+            }
+          } break;
+          case OBJKeyword::Object:
+          case OBJKeyword::UseMtl:
+          case OBJKeyword::MtlLib:
+            chunk.statements.emplace_back(
+              OBJStatement{keyword, chunk.faceVertices.size(), tokenizer.rest()});
+            break;
+          case OBJKeyword::Unhandled:
+            addUnhandled();
+            break;
+          case OBJKeyword::Empty:
+          case OBJKeyword::Smooth:
+            // Smooth shading is not supported, an integer is set
+            break;
         }
-      }
-    }
-    else if (!(result
-               = StringTools::regexMatch(line, std::regex(normalPattern, std::regex::optimize)))
-                .empty()) {
-      // Create a Vector3 with the normals x, y, z
-      // Value of result
-      //  ["vn 1.0 2.0 3.0", "1.0", "2.0", "3.0"]
-      // Add the Vector in the list of normals
-      state.normals.emplace_back(Vector3(StringTools::toNumber<float>(result[1]), //
-                                         StringTools::toNumber<float>(result[2]), //
-                                         StringTools::toNumber<float>(result[3])  //
-                                         ));
-    }
-    else if (!(result = StringTools::regexMatch(line, std::regex(uvPattern, std::regex::optimize)))
-                .empty()) {
-      // Create a Vector2 with the normals u, v
-      // Value of result
-      //  ["vt 0.1 0.2 0.3", "0.1", "0.2"]
-      // Add the Vector in the list of uvs
-      state.uvs.emplace_back(
-        Vector2(StringTools::toNumber<float>(result[1]) * OBJFileLoader::UV_SCALING.x,
-                StringTools::toNumber<float>(result[2]) * OBJFileLoader::UV_SCALING.y));
-
-      // Identify patterns of faces
-      // Face could be defined in different type of pattern
-    }
-    else if (!(result
-               = StringTools::regexMatch(line, std::regex(facePattern3, std::regex::optimize)))
-                .empty()) {
-      // Value of result:
-      // ["f 1/1/1 2/2/2 3/3/3", "1/1/1 2/2/2 3/3/3"...]
-
-      // Set the data for this face
-      _setDataForCurrentFaceWithPattern3(
-        StringTools::split(StringTools::trim(result[1]), " "), // ["1/1/1", "2/2/2", "3/3/3"]
-        1,                                                     // v
-        state                                                  // state
-      );
+      });
     }
-    else if (!(result
-               = StringTools::regexMatch(line, std::regex(facePattern4, std::regex::optimize)))
-                .empty()) {
-      // Value of result:
-      // ["f 1//1 2//2 3//3", "1//1 2//2 3//3"...]
-
-      // Set the data for this face
-      _setDataForCurrentFaceWithPattern4(
-        StringTools::split(StringTools::trim(result[1]), " "), // ["1//1", "2//2", "3//3"]
-        1,                                                     // v
-        state                                                  // state
-      );
-    }
-    else if (!(result
-               = StringTools::regexMatch(line, std::regex(facePattern5, std::regex::optimize)))
-                .empty()) {
-      // Value of result:
-      // ["f -1/-1/-1 -2/-2/-2 -3/-3/-3", "-1/-1/-1 -2/-2/-2 -3/-3/-3"...]
-
-      // Set the data for this face
-      _setDataForCurrentFaceWithPattern5(
-        StringTools::split(StringTools::trim(result[1]),
-                           " "), // ["-1/-1/-1", "-2/-2/-2", "-3/-3/-3"]
-        1,                       // v
-        state                    // state
-      );
-    }
-    else if (!(result
-               = StringTools::regexMatch(line, std::regex(facePattern2, std::regex::optimize)))
-                .empty()) {
-      // Value of result:
-      //["f 1/1 2/2 3/3", "1/1 2/2 3/3"...]
-
-      // Set the data for this face
-      _setDataForCurrentFaceWithPattern2(
-        StringTools::split(StringTools::trim(result[1]), " "), // ["1/1", "2/2", "3/3"]
-        1,                                                     // v
-        state                                                  // state
-      );
-    }
-    else if (!(result
-               = StringTools::regexMatch(line, std::regex(facePattern2, std::regex::optimize)))
-                .empty()) {
-      // Value of result
-      //["f 1 2 3", "1 2 3"...]
-
-      // Set the data for this face
-      _setDataForCurrentFaceWithPattern1(
-        StringTools::split(StringTools::trim(result[1]), " "), // ["1", "2", "3"]
-        1,                                                     // v
-        state                                                  // state
-      );
-
-      // Define a mesh or an object
-      // Each time this keyword is analysed, create a new Object with all data for creating a
-      // babylonMesh
-    }
-    else if ((!StringTools::regexMatch(line, std::regex(group, std::regex::optimize)).empty())
-             || (!StringTools::regexMatch(obj, std::regex(group, std::regex::optimize)).empty())) {
-      // Create a new mesh corresponding to the name of the group.
-      // Definition of the mesh
-      auto substr = line.substr(2);
-      MeshObject objMesh{
-        StringTools::trim(substr), // Set the name of the current obj mesh
-        {},                        // indices
-        {},                        // positions
-        {},                        // normals
-        {},                        // uvs
-        {},                        // colors
-        ""                         // materialName
-      };
-      _addPreviousObjMesh(state);
-
-      // Push the last mesh created with only the name
-      state.meshesFromObj.emplace_back(objMesh);
-
-      // Set this variable to indicate that now meshesFromObj has objects defined inside
-      state.hasMeshes       = true;
-      state.isFirstMaterial = true;
-      state.increment       = 1;
-      // Keyword for applying a material
-    }
-    else if (!StringTools::regexMatch(line, std::regex(usemtl, std::regex::optimize)).empty()) {
-      // Get the name of the material
-      auto substr               = line.substr(7);
-      state.materialNameFromObj = StringTools::trim(substr);
-
-      // If this new material is in the same mesh
-
-      if (!state.isFirstMaterial || !state.hasMeshes) {
-        // Set the data for the previous mesh
-        _addPreviousObjMesh(state);
-        // Create a new mesh
-        MeshObject objMesh
-          // Set the name of the current obj mesh
-          {
-            StringTools::printf("%s_mm%zu",
-                                (!state.objMeshName.empty() ? state.objMeshName.c_str() : "mesh"),
-                                state.increment), // Set the name of the current obj mesh
-            {},                                   // indices
-            {},                                   // positions
-            {},                                   // normals
-            {},                                   // uvs
-            {},                                   // colors
-            state.materialNameFromObj             // materialName
-          };
-        ++state.increment;
-        // If meshes are already defined
-        state.meshesFromObj.emplace_back(objMesh);
-        state.hasMeshes = true;
+  });
+
+  // Pass 3: build the meshes, in file order
+  for (const auto& chunk : chunks) {
+    size_t faceVertexIndex = 0;
+    const auto setFaceData = [&](size_t faceVertexEnd) {
+      for (; faceVertexIndex < faceVertexEnd; ++faceVertexIndex) {
+        _setData(chunk.faceVertices[faceVertexIndex], state);
       }
-      // Set the material name if the previous line define a mesh
-
-      if (state.hasMeshes && state.isFirstMaterial) {
-        // Set the material name to the previous mesh (1 material per mesh)
-        state.meshesFromObj.back().materialName = state.materialNameFromObj;
-        state.isFirstMaterial                   = false;
+    };
+
+    for (const auto& statement : chunk.statements) {
+      setFaceData(statement.faceVertexOffset);
+      switch (statement.keyword) {
+        case OBJKeyword::Object: {
+          // Define a mesh or an object
+          // Each time this keyword is analysed, create a new Object with all data for creating a
+          // babylonMesh
+          _addPreviousObjMesh(state);
+          state.objMeshName = std::string(statement.argument);
+
+          // Push the last mesh created with only the name
+          MeshObject objMesh;
+          objMesh.name = state.objMeshName;
+          state.meshesFromObj.emplace_back(std::move(objMesh));
+
+          // Set this variable to indicate that now meshesFromObj has objects defined inside
+          state.hasMeshes       = true;
+          state.isFirstMaterial = true;
+          state.increment       = 1;
+        } break;
+        case OBJKeyword::UseMtl: {
+          // Keyword for applying a material
+          state.materialNameFromObj = std::string(statement.argument);
+
+          // If this new material is in the same mesh
+          if (!state.isFirstMaterial || !state.hasMeshes) {
+            // Set the data for the previous mesh
+            _addPreviousObjMesh(state);
+            // Create a new mesh
+            MeshObject objMesh;
+            objMesh.name = StringTools::printf(
+              "%s_mm%zu", (!state.objMeshName.empty() ? state.objMeshName.c_str() : "mesh"),
+              state.increment);
+            objMesh.materialName = state.materialNameFromObj;
+            ++state.increment;
+            // If meshes are already defined
+            state.meshesFromObj.emplace_back(std::move(objMesh));
+            state.hasMeshes = true;
+          }
+
+          // Set the material name if the previous line define a mesh
+          if (state.hasMeshes && state.isFirstMaterial) {
+            // Set the material name to the previous mesh (1 material per mesh)
+            state.meshesFromObj.back().materialName = state.materialNameFromObj;
+            state.isFirstMaterial                   = false;
+          }
+        } break;
+        case OBJKeyword::MtlLib:
+          // Keyword for loading the mtl file
+          state.fileToLoad = std::string(statement.argument);
+          break;
+        default: {
+          // If there is another possibility
+          const std::string line{statement.argument};
+          BABYLON_LOG_ERROR("OBJFileLoader", "Unhandled expression at line : %s", line.c_str())
+        } break;
       }
-      // Keyword for loading the mtl file
-    }
-    else if (!StringTools::regexMatch(line, std::regex(mtllib, std::regex::optimize)).empty()) {
-      // Get the name of mtl file
-      auto substr      = line.substr(7);
-      state.fileToLoad = StringTools::trim(substr);
-
-      // Apply smoothing
-    }
-    else if (!StringTools::regexMatch(line, std::regex(smooth, std::regex::optimize)).empty()) {
-      // smooth shading => apply smoothing
-      // Today I don't know it work with babylon and with obj.
-      // With the obj file  an integer is set
-    }
-    else {
-      // If there is another possibility
-      BABYLON_LOG_ERROR("OBJFileLoader", "Unhandled expression at line : %s", line.c_str())
     }
+    setFaceData(chunk.faceVertices.size());
   }
 
   // At the end of the file, add the last mesh into the meshesFromObj array
   if (state.hasMeshes) {
-    // Set the data for the last mesh
-    state.handledMesh = state.meshesFromObj.back();
-
-    // Reverse indices for displaying faces in the good sense
-    std::reverse(state.indicesForBabylon.begin(), state.indicesForBabylon.end());
-    // Get the good array
-    _unwrapData(state);
-    // Set array
-    state.handledMesh.indices   = state.indicesForBabylon;
-    state.handledMesh.positions = state.unwrappedPositionsForBabylon;
-    state.handledMesh.normals   = state.unwrappedNormalsForBabylon;
-    state.handledMesh.uvs       = state.unwrappedUVForBabylon;
-
-    if (_meshLoadOptions.ImportVertexColors == true) {
-      state.handledMesh.colors = state.unwrappedColorsForBabylon;
-    }
+    _addPreviousObjMesh(state);
   }
-
   // If any o or g keyword found, create a mesh with a random id
-  if (!state.hasMeshes) {
+  else {
     // reverse tab of indices
     std::reverse(state.indicesForBabylon.begin(), state.indicesForBabylon.end());
-    // Get positions normals uvs
-    _unwrapData(state);
     // Set data for one mesh
-    state.meshesFromObj.emplace_back(MeshObject{
-      Geometry::RandomId(),               // name
-      state.indicesForBabylon,            // indices
-      state.unwrappedPositionsForBabylon, // positions
-      state.unwrappedColorsForBabylon,    // colors
-      state.unwrappedNormalsForBabylon,   // normals
-      state.unwrappedUVForBabylon,        // uvs
-      state.materialNameFromObj           // materialName
-    });
+    MeshObject objMesh;
+    objMesh.name         = Geometry::RandomId();
+    objMesh.indices      = std::move(state.indicesForBabylon);
+    objMesh.positions    = std::move(state.unwrappedPositionsForBabylon);
+    objMesh.normals      = std::move(state.unwrappedNormalsForBabylon);
+    objMesh.colors       = std::move(state.unwrappedColorsForBabylon);
+    objMesh.uvs          = std::move(state.unwrappedUVForBabylon);
+    objMesh.materialName = state.materialNameFromObj;
+    state.meshesFromObj.emplace_back(std::move(objMesh));
   }
+}
+
+std::vector<AbstractMeshPtr> OBJFileLoader::_parseSolid(const std::vector<std::string>& meshesNames,
+                                                        Scene* scene, std::string_view data,
+                                                        const std::string& /*rootUrl*/)
+{
+  OBJParseSolidState state;
+  _parseMeshObjects(data, state);
 
   // Create a Mesh list
   std::vector<AbstractMeshPtr> babylonMeshesArray; // The mesh for babylon
   std::vector<std::string> materialToUse;
 
   // Set data for each mesh
-  for (const auto& meshFromObj : state.meshesFromObj) {
+  for (auto& meshFromObj : state.meshesFromObj) {
 
     // check meshesNames (stlFileLoader)
     if (!meshesNames.empty() && !meshFromObj.name.empty()) {
@@ -625,11 +670,7 @@ std::vector<AbstractMeshPtr> OBJFileLoader::_parseSolid(const std::vector<std::s
       }
     }
 
-    // Get the current mesh
-    // Set the data with VertexBuffer for each mesh
-    state.handledMesh = meshFromObj;
     // Create a Mesh with the name of the obj mesh
-
     scene->_blockEntityCollection = _forAssetContainer;
     auto babylonMesh              = Mesh::New(meshFromObj.name, scene);
     scene->_blockEntityCollection = false;
@@ -640,19 +681,19 @@ std::vector<AbstractMeshPtr> OBJFileLoader::_parseSolid(const std::vector<std::s
 
     auto vertexData = std::make_unique<VertexData>(); // The container for the values
     // Set the data for the babylonMesh
-    vertexData->uvs       = state.handledMesh.uvs;
-    vertexData->indices   = state.handledMesh.indices;
-    vertexData->positions = state.handledMesh.positions;
-    if (_meshLoadOptions.ComputeNormals == true) {
+    if (_meshLoadOptions.ComputeNormals) {
       Float32Array normals;
-      VertexData::ComputeNormals(state.handledMesh.positions, state.handledMesh.indices, normals);
-      vertexData->normals = normals;
+      VertexData::ComputeNormals(meshFromObj.positions, meshFromObj.indices, normals);
+      vertexData->normals = std::move(normals);
     }
     else {
-      vertexData->normals = state.handledMesh.normals;
+      vertexData->normals = std::move(meshFromObj.normals);
     }
-    if (_meshLoadOptions.ImportVertexColors == true) {
-      vertexData->colors = state.handledMesh.colors;
+    vertexData->uvs       = std::move(meshFromObj.uvs);
+    vertexData->indices   = std::move(meshFromObj.indices);
+    vertexData->positions = std::move(meshFromObj.positions);
+    if (_meshLoadOptions.ImportVertexColors) {
+      vertexData->colors = std::move(meshFromObj.colors);
     }
     // Set the data from the VertexBuffer to the current Mesh
     vertexData->applyToMesh(*babylonMesh);
@@ -4,6 +4,7 @@
 #include <babylon/core/logging.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
+#include <babylon/instrumentation/profiler.h>
 #include <babylon/loading/ifileInfo.h>
 #include <babylon/loading/iregistered_plugin.h>
 #include <babylon/loading/iscene_loader_plugin.h>
@@ -18,6 +19,22 @@
 
 namespace BABYLON {
 
+namespace {
+
+/**
+ * @brief Returns the loaded data as text (the synchronous plugins only support text data).
+ */
+std::string DataAsText(const std::variant<std::string, ArrayBufferView>& data)
+{
+  if (std::holds_alternative<std::string>(data)) {
+    return std::get<std::string>(data);
+  }
+  const auto& view = std::get<ArrayBufferView>(data);
+  return std::string(reinterpret_cast<const char*>(view.data()), view.byteLength());
+}
+
+} // end of anonymous namespace
+
 Observable<ISceneLoaderPlugin> SceneLoader::OnPluginActivatedObservable;
 Observable<ISceneLoaderPluginAsync> SceneLoader::OnPluginAsyncActivatedObservable;
 
@@ -154,7 +171,8 @@ std::variant<ISceneLoaderPluginPtr, ISceneLoaderPluginAsyncPtr> SceneLoader::_lo
   const IFileInfo& fileInfo, Scene* scene,
   const std::function<
     void(const std::variant<ISceneLoaderPluginPtr, ISceneLoaderPluginAsyncPtr>& plugin,
-         const std::string& data, const std::string& responseURL)>& onSuccess,
+         const std::variant<std::string, ArrayBufferView>& data, const std::string& responseURL)>&
+    onSuccess,
   const std::function<void(const SceneLoaderProgressEvent& event)>& onProgress,
   const std::function<void(const std::string& message, const std::string& exception)>& onError,
   const std::function<void()>& /*onDispose*/, const std::string& pluginExtension)
@@ -199,7 +217,8 @@ std::variant<ISceneLoaderPluginPtr, ISceneLoaderPluginAsyncPtr> SceneLoader::_lo
           return;
         }
 
-        onSuccess(plugin, std::get<std::string>(data), responseURL);
+        // Binary data (e.g. a memory mapped .glb file) is passed as is to the plugin
+        onSuccess(plugin, data, responseURL);
       };
 
   const auto manifestChecked = [fileInfo, dataCallback, useArrayBuffer, onError, onProgress]() {
@@ -322,6 +341,8 @@ SceneLoader::ImportMesh(
     onError,
   const std::string& pluginExtension)
 {
+  BABYLON_PROFILE_ZONE("Import mesh");
+
   scene = scene ? scene : Engine::LastCreatedScene();
 
   if (!scene) {
@@ -382,7 +403,8 @@ SceneLoader::ImportMesh(
   return SceneLoader::_loadData(
     *fileInfo, scene,
     [=](const std::variant<ISceneLoaderPluginPtr, ISceneLoaderPluginAsyncPtr>& plugin,
-        const std::string& data, const std::string& responseURL) -> void {
+        const std::variant<std::string, ArrayBufferView>& data,
+        const std::string& responseURL) -> void {
       if (std::holds_alternative<ISceneLoaderPluginPtr>(plugin)) {
         auto syncedPlugin = std::get<ISceneLoaderPluginPtr>(plugin);
 
@@ -399,7 +421,7 @@ SceneLoader::ImportMesh(
         std::vector<SkeletonPtr> skeletons;
         std::vector<AnimationGroupPtr> animationGroups;
 
-        if (!syncedPlugin->importMesh(meshNames, scene, data, fileInfo->rootUrl, meshes,
+        if (!syncedPlugin->importMesh(meshNames, scene, DataAsText(data), fileInfo->rootUrl, meshes,
                                       particleSystems, skeletons, errorHandler)) {
           return;
         }
@@ -446,6 +468,8 @@ std::optional<std::variant<ISceneLoaderPluginPtr, ISceneLoaderPluginAsyncPtr>> S
     onError,
   const std::string& pluginExtension)
 {
+  BABYLON_PROFILE_ZONE("Append scene");
+
   scene = scene ? scene : Engine::LastCreatedScene();
 
   if (!scene) {
@@ -504,10 +528,11 @@ std::optional<std::variant<ISceneLoaderPluginPtr, ISceneLoaderPluginAsyncPtr>> S
   return SceneLoader::_loadData(
     *fileInfo, scene,
     [=](const std::variant<ISceneLoaderPluginPtr, ISceneLoaderPluginAsyncPtr>& plugin,
-        const std::string& data, const std::string & /*responseURL*/) -> void {
+        const std::variant<std::string, ArrayBufferView>& data,
+        const std::string & /*responseURL*/) -> void {
       if (std::holds_alternative<ISceneLoaderPluginPtr>(plugin)) {
         auto syncedPlugin = std::get<ISceneLoaderPluginPtr>(plugin);
-        if (!syncedPlugin->load(scene, data, fileInfo->rootUrl, errorHandler)) {
+        if (!syncedPlugin->load(scene, DataAsText(data), fileInfo->rootUrl, errorHandler)) {
           return;
         }
 
@@ -126,8 +126,9 @@ BackgroundMaterialDefines::BackgroundMaterialDefines()
     {"FOG", false},        //
     {"NORMAL", false},     //
 
-    {"INSTANCES", false},   //
-    {"SHADOWFLOAT", false}, //
+    {"INSTANCES", false},      //
+    {"THIN_INSTANCES", false}, //
+    {"SHADOWFLOAT", false},    //
   };
 
   intDef = {
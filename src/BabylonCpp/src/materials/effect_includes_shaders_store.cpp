@@ -3,6 +3,8 @@
 #include <babylon/shaders/shadersinclude/background_fragment_declaration_fx.h>
 #include <babylon/shaders/shadersinclude/background_ubo_declaration_fx.h>
 #include <babylon/shaders/shadersinclude/background_vertex_declaration_fx.h>
+#include <babylon/shaders/shadersinclude/baked_vertex_animation_declaration_fx.h>
+#include <babylon/shaders/shadersinclude/baked_vertex_animation_fx.h>
 #include <babylon/shaders/shadersinclude/bones_declaration_fx.h>
 #include <babylon/shaders/shadersinclude/bones_vertex_fx.h>
 #include <babylon/shaders/shadersinclude/bump_fragment_fx.h>
@@ -87,6 +89,8 @@ std::unordered_map<std::string, std::string>
   = {{"backgroundFragmentDeclaration", backgroundFragmentDeclaration},
      {"backgroundUboDeclaration", backgroundUboDeclaration},
      {"backgroundVertexDeclaration", backgroundVertexDeclaration},
+     {"bakedVertexAnimation", bakedVertexAnimation},
+     {"bakedVertexAnimationDeclaration", bakedVertexAnimationDeclaration},
      {"bonesDeclaration", bonesDeclaration},
      {"bonesVertex", bonesVertex},
      {"bumpFragment", bumpFragment},
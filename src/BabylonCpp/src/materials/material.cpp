@@ -55,8 +55,8 @@ const Material::MaterialDefinesCallback Material::_RunDirtyCallBacks
 Material::Material(const std::string& iName, Scene* scene, bool doNotAdd)
     : customShaderNameResolve{nullptr}
     , shadowDepthWrapper{nullptr}
-    , id{!iName.empty() ? iName : GUID::RandomId()}
-    , name{iName}
+    , id{this, &Material::_reindexInScene, !iName.empty() ? iName : GUID::RandomId()}
+    , name{this, &Material::_reindexInScene, iName}
     , checkReadyOnEveryCall{false}
     , checkReadyOnlyOnce{false}
     , alpha{this, &Material::get_alpha, &Material::set_alpha}
@@ -180,8 +180,7 @@ void Material::setProperty(const std::vector<std::string>& /*targetPropertyPath*
 
 void Material::addMaterialToScene(const MaterialPtr& newMaterial)
 {
-  _scene->materials.emplace_back(newMaterial);
-  _scene->onNewMaterialAddedObservable.notifyObservers(newMaterial.get());
+  _scene->addMaterial(newMaterial);
 }
 
 void Material::addMultiMaterialToScene(const MultiMaterialPtr& newMultiMaterial)
@@ -450,6 +449,13 @@ void Material::trackCreation(
 {
 }
 
+void Material::_reindexInScene()
+{
+  if (_scene) {
+    _scene->_reindexObject(this);
+  }
+}
+
 void Material::markDirty()
 {
   const auto& meshes = getScene()->meshes;
@@ -0,0 +1,44 @@
+#include <babylon/materials/material_define_table.h>
+
+#include <array>
+
+namespace BABYLON {
+
+MaterialDefineRegistry& MaterialDefineRegistry::Get(MaterialDefineKind kind)
+{
+  static std::array<MaterialDefineRegistry, 4> registries;
+  return registries[static_cast<size_t>(kind)];
+}
+
+size_t MaterialDefineRegistry::indexOf(const std::string& name)
+{
+  const auto it = _indices.find(name);
+  if (it != _indices.end()) {
+    return it->second;
+  }
+  const auto index = _names.size();
+  _names.emplace_back(name);
+  _indices[name] = index;
+  return index;
+}
+
+std::optional<size_t> MaterialDefineRegistry::find(const std::string& name) const
+{
+  const auto it = _indices.find(name);
+  if (it == _indices.end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
+const std::string& MaterialDefineRegistry::name(size_t index) const
+{
+  return _names[index];
+}
+
+size_t MaterialDefineRegistry::size() const
+{
+  return _names.size();
+}
+
+} // end of namespace BABYLON
@@ -1,6 +1,6 @@
 #include <babylon/materials/material_defines.h>
 
-#include <babylon/babylon_stl_util.h>
+#include <sstream>
 
 namespace BABYLON {
 
@@ -18,6 +18,7 @@ MaterialDefines::MaterialDefines()
     , _uvs{false}
     , _needNormals{false}
     , _needUVs{false}
+    , _hasCachedString{false}
 {
 }
 
@@ -39,6 +40,12 @@ MaterialDefines::MaterialDefines(const MaterialDefines& other)
     , _uvs{other._uvs}
     , _needNormals{other._needNormals}
     , _needUVs{other._needUVs}
+    , _hasCachedString{other._hasCachedString}
+    , _cachedString{other._cachedString}
+    , _cachedBoolDef{other._cachedBoolDef}
+    , _cachedIntDef{other._cachedIntDef}
+    , _cachedFloatDef{other._cachedFloatDef}
+    , _cachedStringDef{other._cachedStringDef}
 {
 }
 
@@ -60,7 +67,14 @@ MaterialDefines::MaterialDefines(MaterialDefines&& other)
     , _uvs{std::move(other._uvs)}
     , _needNormals{std::move(other._needNormals)}
     , _needUVs{std::move(other._needUVs)}
+    , _hasCachedString{std::move(other._hasCachedString)}
+    , _cachedString{std::move(other._cachedString)}
+    , _cachedBoolDef{std::move(other._cachedBoolDef)}
+    , _cachedIntDef{std::move(other._cachedIntDef)}
+    , _cachedFloatDef{std::move(other._cachedFloatDef)}
+    , _cachedStringDef{std::move(other._cachedStringDef)}
 {
+  other._hasCachedString = false;
 }
 
 MaterialDefines& MaterialDefines::operator=(const MaterialDefines& other)
@@ -83,6 +97,12 @@ MaterialDefines& MaterialDefines::operator=(const MaterialDefines& other)
     _uvs                     = other._uvs;
     _needNormals             = other._needNormals;
     _needUVs                 = other._needUVs;
+    _hasCachedString         = other._hasCachedString;
+    _cachedString            = other._cachedString;
+    _cachedBoolDef           = other._cachedBoolDef;
+    _cachedIntDef            = other._cachedIntDef;
+    _cachedFloatDef          = other._cachedFloatDef;
+    _cachedStringDef         = other._cachedStringDef;
   }
 
   return *this;
@@ -108,6 +128,13 @@ MaterialDefines& MaterialDefines::operator=(MaterialDefines&& other)
     _uvs                     = std::move(other._uvs);
     _needNormals             = std::move(other._needNormals);
     _needUVs                 = std::move(other._needUVs);
+    _hasCachedString         = std::move(other._hasCachedString);
+    _cachedString            = std::move(other._cachedString);
+    _cachedBoolDef           = std::move(other._cachedBoolDef);
+    _cachedIntDef            = std::move(other._cachedIntDef);
+    _cachedFloatDef          = std::move(other._cachedFloatDef);
+    _cachedStringDef         = std::move(other._cachedStringDef);
+    other._hasCachedString   = false;
   }
 
   return *this;
@@ -117,7 +144,13 @@ MaterialDefines::~MaterialDefines() = default;
 
 bool MaterialDefines::operator[](const std::string& define) const
 {
-  return stl_util::contains(boolDef, define) && boolDef.at(define);
+  const auto defineIndex = MaterialDefineTable<bool>::Find(define);
+  return defineIndex && boolDef.test(*defineIndex);
+}
+
+bool MaterialDefines::operator[](size_t defineIndex) const
+{
+  return boolDef.test(defineIndex);
 }
 
 bool MaterialDefines::operator==(const MaterialDefines& rhs) const
@@ -133,23 +166,23 @@ bool MaterialDefines::operator!=(const MaterialDefines& rhs) const
 std::ostream& operator<<(std::ostream& os,
                          const MaterialDefines& materialDefines)
 {
-  for (const auto& item : materialDefines.boolDef) {
-    if (item.second) {
-      os << "#define " << item.first << "\n";
+  materialDefines.boolDef.forEach([&os](const std::string& name, bool value) {
+    if (value) {
+      os << "#define " << name << "\n";
     }
-  }
+  });
 
-  for (const auto& item : materialDefines.intDef) {
-    os << "#define " << item.first << " " << item.second << "\n";
-  }
+  materialDefines.intDef.forEach([&os](const std::string& name, unsigned int value) {
+    os << "#define " << name << " " << value << "\n";
+  });
 
-  for (const auto& item : materialDefines.floatDef) {
-    os << "#define " << item.first << " " << item.second << "\n";
-  }
+  materialDefines.floatDef.forEach([&os](const std::string& name, float value) {
+    os << "#define " << name << " " << value << "\n";
+  });
 
-  for (const auto& item : materialDefines.stringDef) {
-    os << "#define " << item.first << " " << item.second << "\n";
-  }
+  materialDefines.stringDef.forEach([&os](const std::string& name, const std::string& value) {
+    os << "#define " << name << " " << value << "\n";
+  });
 
   return os;
 }
@@ -230,13 +263,6 @@ void MaterialDefines::rebuild()
 
 bool MaterialDefines::isEqual(const MaterialDefines& other) const
 {
-  if ((boolDef.size() != other.boolDef.size())
-      || (intDef.size() != other.intDef.size())
-      || (floatDef.size() != other.floatDef.size())
-      || (stringDef.size() != other.stringDef.size())) {
-    return false;
-  }
-
   if ((_isDirty != other._isDirty) || (_renderId != other._renderId)
       || (_areLightsDirty != other._areLightsDirty)
       || (_areLightsDisposed != other._areLightsDisposed)
@@ -298,10 +324,22 @@ void MaterialDefines::reset()
 
 std::string MaterialDefines::toString() const
 {
+  if (_hasCachedString && (boolDef == _cachedBoolDef) && (intDef == _cachedIntDef)
+      && (floatDef == _cachedFloatDef) && (stringDef == _cachedStringDef)) {
+    return _cachedString;
+  }
+
   std::ostringstream oss;
   oss << *this;
 
-  return oss.str();
+  _cachedString    = oss.str();
+  _cachedBoolDef   = boolDef;
+  _cachedIntDef    = intDef;
+  _cachedFloatDef  = floatDef;
+  _cachedStringDef = stringDef;
+  _hasCachedString = true;
+
+  return _cachedString;
 }
 
 } // end of namespace BABYLON
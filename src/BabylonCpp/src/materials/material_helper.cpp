@@ -1,6 +1,7 @@
 #include <babylon/materials/material_helper.h>
 
 #include <babylon/babylon_stl_util.h>
+#include <babylon/baked_vertex_animation/baked_vertex_animation_manager.h>
 #include <babylon/bones/skeleton.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/core/logging.h>
@@ -91,7 +92,8 @@ void MaterialHelper::PrepareDefinesForMisc(AbstractMesh* mesh, Scene* scene,
 
 void MaterialHelper::PrepareDefinesForFrameBoundValues(Scene* scene, Engine* engine,
                                                        MaterialDefines& defines, bool useInstances,
-                                                       std::optional<bool> useClipPlane)
+                                                       std::optional<bool> useClipPlane,
+                                                       bool useThinInstances)
 {
   auto changed       = false;
   auto useClipPlane1 = false;
@@ -113,44 +115,60 @@ void MaterialHelper::PrepareDefinesForFrameBoundValues(Scene* scene, Engine* eng
   useClipPlane6
     = useClipPlane == std::nullopt ? (scene->clipPlane6 != std::nullopt) : *useClipPlane;
 
-  if (defines["CLIPPLANE"] != useClipPlane1) {
-    defines.boolDef["CLIPPLANE"] = useClipPlane1;
-    changed                      = true;
+  // Evaluated on every frame: the define names are only resolved once
+  static const auto CLIPPLANE      = MaterialDefineTable<bool>::Index("CLIPPLANE");
+  static const auto CLIPPLANE2     = MaterialDefineTable<bool>::Index("CLIPPLANE2");
+  static const auto CLIPPLANE3     = MaterialDefineTable<bool>::Index("CLIPPLANE3");
+  static const auto CLIPPLANE4     = MaterialDefineTable<bool>::Index("CLIPPLANE4");
+  static const auto CLIPPLANE5     = MaterialDefineTable<bool>::Index("CLIPPLANE5");
+  static const auto CLIPPLANE6     = MaterialDefineTable<bool>::Index("CLIPPLANE6");
+  static const auto DEPTHPREPASS   = MaterialDefineTable<bool>::Index("DEPTHPREPASS");
+  static const auto INSTANCES      = MaterialDefineTable<bool>::Index("INSTANCES");
+  static const auto THIN_INSTANCES = MaterialDefineTable<bool>::Index("THIN_INSTANCES");
+
+  if (defines[CLIPPLANE] != useClipPlane1) {
+    defines.boolDef[CLIPPLANE] = useClipPlane1;
+    changed                    = true;
   }
 
-  if (defines["CLIPPLANE2"] != useClipPlane2) {
-    defines.boolDef["CLIPPLANE2"] = useClipPlane2;
-    changed                       = true;
+  if (defines[CLIPPLANE2] != useClipPlane2) {
+    defines.boolDef[CLIPPLANE2] = useClipPlane2;
+    changed                     = true;
   }
 
-  if (defines["CLIPPLANE3"] != useClipPlane3) {
-    defines.boolDef["CLIPPLANE3"] = useClipPlane3;
-    changed                       = true;
+  if (defines[CLIPPLANE3] != useClipPlane3) {
+    defines.boolDef[CLIPPLANE3] = useClipPlane3;
+    changed                     = true;
   }
 
-  if (defines["CLIPPLANE4"] != useClipPlane4) {
-    defines.boolDef["CLIPPLANE4"] = useClipPlane4;
-    changed                       = true;
+  if (defines[CLIPPLANE4] != useClipPlane4) {
+    defines.boolDef[CLIPPLANE4] = useClipPlane4;
+    changed                     = true;
   }
 
-  if (defines["CLIPPLANE5"] != useClipPlane5) {
-    defines.boolDef["CLIPPLANE5"] = useClipPlane5;
-    changed                       = true;
+  if (defines[CLIPPLANE5] != useClipPlane5) {
+    defines.boolDef[CLIPPLANE5] = useClipPlane5;
+    changed                     = true;
+  }
+
+  if (defines[CLIPPLANE6] != useClipPlane6) {
+    defines.boolDef[CLIPPLANE6] = useClipPlane6;
+    changed                     = true;
   }
 
-  if (defines["CLIPPLANE6"] != useClipPlane6) {
-    defines.boolDef["CLIPPLANE6"] = useClipPlane6;
+  if (defines[DEPTHPREPASS] != !engine->getColorWrite()) {
+    defines.boolDef[DEPTHPREPASS] = !defines[DEPTHPREPASS];
     changed                       = true;
   }
 
-  if (defines["DEPTHPREPASS"] != !engine->getColorWrite()) {
-    defines.boolDef["DEPTHPREPASS"] = !defines["DEPTHPREPASS"];
-    changed                         = true;
+  if (defines[INSTANCES] != useInstances) {
+    defines.boolDef[INSTANCES] = useInstances;
+    changed                    = true;
   }
 
-  if (defines["INSTANCES"] != useInstances) {
-    defines.boolDef["INSTANCES"] = useInstances;
-    changed                      = true;
+  if (defines[THIN_INSTANCES] != useThinInstances) {
+    defines.boolDef[THIN_INSTANCES] = useThinInstances;
+    changed                         = true;
   }
 
   if (changed) {
@@ -163,7 +181,7 @@ void MaterialHelper::PrepareDefinesForBones(AbstractMesh* mesh, MaterialDefines&
   if (mesh->useBones() && mesh->computeBonesUsingShaders() && mesh->skeleton()) {
     defines.intDef["NUM_BONE_INFLUENCERS"] = mesh->numBoneInfluencers();
 
-    const auto materialSupportsBoneTexture = stl_util::contains(defines.boolDef, "BONETEXTURE");
+    const auto materialSupportsBoneTexture = defines.boolDef.contains("BONETEXTURE");
 
     if (mesh->skeleton()->isUsingTextureForMatrices && materialSupportsBoneTexture) {
       defines.boolDef["BONETEXTURE"] = true;
@@ -185,6 +203,22 @@ void MaterialHelper::PrepareDefinesForBones(AbstractMesh* mesh, MaterialDefines&
   }
 }
 
+bool MaterialHelper::UseBakedVertexAnimation(AbstractMesh* mesh)
+{
+  const auto& manager = mesh->bakedVertexAnimationManager();
+  return manager && manager->isEnabled() && manager->texture() != nullptr;
+}
+
+void MaterialHelper::PrepareDefinesForBakedVertexAnimation(AbstractMesh* mesh,
+                                                           MaterialDefines& defines)
+{
+  if (!defines.boolDef.contains("BAKED_VERTEX_ANIMATION_TEXTURE")) {
+    return;
+  }
+
+  defines.boolDef["BAKED_VERTEX_ANIMATION_TEXTURE"] = UseBakedVertexAnimation(mesh);
+}
+
 void MaterialHelper::PrepareDefinesForMorphTargets(AbstractMesh* mesh, MaterialDefines& defines)
 {
   const auto& manager = static_cast<Mesh*>(mesh)->morphTargetManager();
@@ -206,7 +240,8 @@ void MaterialHelper::PrepareDefinesForMorphTargets(AbstractMesh* mesh, MaterialD
 
 bool MaterialHelper::PrepareDefinesForAttributes(AbstractMesh* mesh, MaterialDefines& defines,
                                                  bool useVertexColor, bool useBones,
-                                                 bool useMorphTargets, bool useVertexAlpha)
+                                                 bool useMorphTargets, bool useVertexAlpha,
+                                                 bool useBakedVertexAnimation)
 {
   if (!defines._areAttributesDirty && defines._needNormals == defines._normals
       && defines._needUVs == defines._uvs) {
@@ -247,17 +282,22 @@ bool MaterialHelper::PrepareDefinesForAttributes(AbstractMesh* mesh, MaterialDef
     PrepareDefinesForMorphTargets(mesh, defines);
   }
 
+  if (useBakedVertexAnimation) {
+    PrepareDefinesForBakedVertexAnimation(mesh, defines);
+  }
+
   return true;
 }
 
 void MaterialHelper::PrepareDefinesForMultiview(Scene* scene, MaterialDefines& defines)
 {
   if (scene->activeCamera()) {
-    const auto previousMultiview = defines["MULTIVIEW"];
-    defines.boolDef["MULTIVIEW"]
+    static const auto MULTIVIEW  = MaterialDefineTable<bool>::Index("MULTIVIEW");
+    const auto previousMultiview = defines[MULTIVIEW];
+    defines.boolDef[MULTIVIEW]
       = (scene->activeCamera()->outputRenderTarget != nullptr
          && scene->activeCamera()->outputRenderTarget->getViewCount() > 1);
-    if (defines["MULTIVIEW"] != previousMultiview) {
+    if (defines[MULTIVIEW] != previousMultiview) {
       defines.markAsUnprocessed();
     }
   }
@@ -272,7 +312,7 @@ void MaterialHelper::PrepareDefinesForLight(Scene* scene, AbstractMesh* mesh, co
 
   auto lightIndexStr = std::to_string(lightIndex);
 
-  if (!stl_util::contains(defines.boolDef, "LIGHT" + lightIndexStr)) {
+  if (!defines.boolDef.contains("LIGHT" + lightIndexStr)) {
     state.needRebuild = true;
   }
 
@@ -384,7 +424,7 @@ bool MaterialHelper::PrepareDefinesForLights(Scene* scene, AbstractMesh* mesh,
   auto lightIndexStr = std::to_string(lightIndex);
   for (auto index = lightIndex; index < maxSimultaneousLights; ++index) {
     const auto indexStr = std::to_string(index);
-    if (stl_util::contains(defines.boolDef, "LIGHT" + indexStr)) {
+    if (defines.boolDef.contains("LIGHT" + indexStr)) {
       defines.boolDef["LIGHT" + indexStr]                  = false;
       defines.boolDef["HEMILIGHT" + indexStr]              = false;
       defines.boolDef["POINTLIGHT" + indexStr]             = false;
@@ -409,7 +449,7 @@ bool MaterialHelper::PrepareDefinesForLights(Scene* scene, AbstractMesh* mesh,
 
   auto caps = scene->getEngine()->getCaps();
 
-  if (!stl_util::contains(defines.boolDef, "SHADOWFLOAT")) {
+  if (!defines.boolDef.contains("SHADOWFLOAT")) {
     state.needRebuild = true;
   }
 
@@ -495,7 +535,7 @@ void MaterialHelper::PrepareUniformsAndSamplersList(std::vector<std::string>& un
                                        defines["PROJECTEDLIGHTTEXTURE" + lightIndexStr]);
   }
 
-  if (stl_util::contains(defines.intDef, "NUM_MORPH_INFLUENCERS")
+  if (defines.intDef.contains("NUM_MORPH_INFLUENCERS")
       && defines.intDef["NUM_MORPH_INFLUENCERS"]) {
     uniformsList.emplace_back("morphTargetInfluences");
   }
@@ -520,7 +560,7 @@ void MaterialHelper::PrepareUniformsAndSamplersList(IEffectCreationOptions& opti
                                        defines["PROJECTEDLIGHTTEXTURE" + lightIndexStr]);
   }
 
-  if (stl_util::contains(defines.intDef, "NUM_MORPH_INFLUENCERS")
+  if (defines.intDef.contains("NUM_MORPH_INFLUENCERS")
       && defines.intDef["NUM_MORPH_INFLUENCERS"]) {
     uniformsList.emplace_back("morphTargetInfluences");
   }
@@ -535,7 +575,7 @@ unsigned int MaterialHelper::HandleFallbacksForShadows(MaterialDefines& defines,
   for (unsigned int lightIndex = 0; lightIndex < maxSimultaneousLights; ++lightIndex) {
     const std::string lightIndexStr = std::to_string(lightIndex);
 
-    if (!stl_util::contains(defines.boolDef, "LIGHT" + lightIndexStr)) {
+    if (!defines.boolDef.contains("LIGHT" + lightIndexStr)) {
       break;
     }
 
@@ -631,10 +671,24 @@ void MaterialHelper::PrepareAttributesForBones(std::vector<std::string>& attribs
   }
 }
 
+void MaterialHelper::PrepareAttributesForBakedVertexAnimation(std::vector<std::string>& attribs,
+                                                              MaterialDefines& defines)
+{
+  static const auto BAKED_VERTEX_ANIMATION_TEXTURE
+    = MaterialDefineTable<bool>::Index("BAKED_VERTEX_ANIMATION_TEXTURE");
+  static const auto INSTANCES = MaterialDefineTable<bool>::Index("INSTANCES");
+
+  if (defines[BAKED_VERTEX_ANIMATION_TEXTURE] && defines[INSTANCES]) {
+    attribs.emplace_back("bakedVertexAnimationSettingsInstanced");
+  }
+}
+
 void MaterialHelper::PrepareAttributesForInstances(std::vector<std::string>& attribs,
                                                    MaterialDefines& defines)
 {
-  if (defines["INSTANCES"]) {
+  static const auto INSTANCES = MaterialDefineTable<bool>::Index("INSTANCES");
+
+  if (defines[INSTANCES]) {
     PushAttributesForInstances(attribs);
   }
 }
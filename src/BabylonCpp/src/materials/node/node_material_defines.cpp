@@ -1,6 +1,5 @@
 #include <babylon/materials/node/node_material_defines.h>
 
-#include <babylon/babylon_stl_util.h>
 
 namespace BABYLON {
 
@@ -55,7 +54,7 @@ NodeMaterialDefines::~NodeMaterialDefines() = default;
 void NodeMaterialDefines::setValue(const std::string& name, bool value,
                                    bool markAsUnprocessedIfDirty)
 {
-  if (markAsUnprocessedIfDirty && (!stl_util::contains(boolDef, name) || boolDef[name] != value)) {
+  if (markAsUnprocessedIfDirty && (!boolDef.contains(name) || boolDef[name] != value)) {
     markAsUnprocessed();
   }
 
@@ -1,5 +1,6 @@
 #include <babylon/materials/pbr/pbr_base_material.h>
 
+#include <babylon/baked_vertex_animation/baked_vertex_animation_manager.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/core/logging.h>
 #include <babylon/engines/engine.h>
@@ -554,6 +555,7 @@ EffectPtr PBRBaseMaterial::_prepareEffect(
   MaterialHelper::PrepareAttributesForBones(attribs, mesh, defines, *fallbacks);
   MaterialHelper::PrepareAttributesForInstances(attribs, defines);
   MaterialHelper::PrepareAttributesForMorphTargets(attribs, mesh, defines);
+  MaterialHelper::PrepareAttributesForBakedVertexAnimation(attribs, defines);
 
   std::string shaderName = "pbr";
 
@@ -622,14 +624,17 @@ EffectPtr PBRBaseMaterial::_prepareEffect(
                                     "vReflectionMicrosurfaceInfos",
                                     "vTangentSpaceParams",
                                     "boneTextureWidth",
-                                    "vDebugMode"};
+                                    "vDebugMode",
+                                    "bakedVertexAnimationSettings",
+                                    "bakedVertexAnimationTextureSizeInverted",
+                                    "bakedVertexAnimationTime"};
 
   std::vector<std::string> samplers{
     "albedoSampler",          "reflectivitySampler", "ambientSampler",
     "emissiveSampler",        "bumpSampler",         "lightmapSampler",
     "opacitySampler",         "reflectionSampler",   "reflectionSamplerLow",
     "reflectionSamplerHigh",  "irradianceSampler",   "microSurfaceSampler",
-    "environmentBrdfSampler", "boneSampler"};
+    "environmentBrdfSampler", "boneSampler",         "bakedVertexAnimationTexture"};
 
   std::vector<std::string> uniformBuffers{"Material", "Scene"};
 
@@ -985,8 +990,10 @@ void PBRBaseMaterial::_prepareDefines(AbstractMesh* mesh, PBRMaterialDefines& de
   sheen->prepareDefines(defines, scene);
 
   // Values that need to be evaluated on every frame
+  const auto useHardwareInstances = useInstances.has_value() && (*useInstances);
   MaterialHelper::PrepareDefinesForFrameBoundValues(
-    scene, engine, defines, useInstances.has_value() && (*useInstances), useClipPlane);
+    scene, engine, defines, useHardwareInstances, useClipPlane,
+    useHardwareInstances && mesh->hasThinInstances());
 
   // Attribs
   MaterialHelper::PrepareDefinesForAttributes(
@@ -1087,6 +1094,22 @@ void PBRBaseMaterial::unbind()
 
 void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh)
 {
+  // Evaluated on every frame: the define names are only resolved once
+  static const auto INSTANCES            = MaterialDefineTable<bool>::Index("INSTANCES");
+  static const auto THIN_INSTANCES       = MaterialDefineTable<bool>::Index("THIN_INSTANCES");
+  static const auto USEIRRADIANCEMAP     = MaterialDefineTable<bool>::Index("USEIRRADIANCEMAP");
+  static const auto METALLICWORKFLOW     = MaterialDefineTable<bool>::Index("METALLICWORKFLOW");
+  static const auto SS_REFRACTION        = MaterialDefineTable<bool>::Index("SS_REFRACTION");
+  static const auto ENVIRONMENTBRDF      = MaterialDefineTable<bool>::Index("ENVIRONMENTBRDF");
+  static const auto SPHERICAL_HARMONICS  = MaterialDefineTable<bool>::Index("SPHERICAL_HARMONICS");
+  static const auto LODBASEDMICROSFURACE = MaterialDefineTable<bool>::Index("LODBASEDMICROSFURACE");
+  static const auto OBJECTSPACE_NORMALMAP
+    = MaterialDefineTable<bool>::Index("OBJECTSPACE_NORMALMAP");
+  static const auto BAKED_VERTEX_ANIMATION_TEXTURE
+    = MaterialDefineTable<bool>::Index("BAKED_VERTEX_ANIMATION_TEXTURE");
+  static const auto USESPHERICALFROMREFLECTIONMAP
+    = MaterialDefineTable<bool>::Index("USESPHERICALFROMREFLECTIONMAP");
+
   auto scene = getScene();
 
   auto definesTmp = static_cast<PBRMaterialDefines*>(subMesh->_materialDefines.get());
@@ -1103,12 +1126,12 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
   _activeEffect = effect;
 
   // Matrices
-  if (!defines["INSTANCES"]) {
+  if (!defines[INSTANCES] || defines[THIN_INSTANCES]) {
     bindOnlyWorldMatrix(world);
   }
 
   // Normal Matrix
-  if (defines["OBJECTSPACE_NORMALMAP"]) {
+  if (defines[OBJECTSPACE_NORMALMAP]) {
     world.toNormalMatrix(_normalMatrix);
     bindOnlyNormalMatrix(_normalMatrix);
   }
@@ -1116,7 +1139,12 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
   const auto mustRebind = _mustRebind(scene, effect, mesh->visibility());
 
   // Bones
-  MaterialHelper::BindBonesParameters(mesh, _activeEffect);
+  if (defines[BAKED_VERTEX_ANIMATION_TEXTURE]) {
+    mesh->bakedVertexAnimationManager()->bind(_activeEffect, defines[INSTANCES]);
+  }
+  else {
+    MaterialHelper::BindBonesParameters(mesh, _activeEffect);
+  }
 
   BaseTexturePtr reflectionTexture = nullptr;
   auto& ubo                        = *_uniformBuffer;
@@ -1162,11 +1190,11 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
             }
           }
 
-          if (!defines["USEIRRADIANCEMAP"]) {
+          if (!defines[USEIRRADIANCEMAP]) {
             auto _polynomials = reflectionTexture->sphericalPolynomial();
-            if (defines["USESPHERICALFROMREFLECTIONMAP"] && _polynomials) {
+            if (defines[USESPHERICALFROMREFLECTIONMAP] && _polynomials) {
               auto polynomials = *_polynomials;
-              if (defines["SPHERICAL_HARMONICS"]) {
+              if (defines[SPHERICAL_HARMONICS]) {
                 auto& preScaledHarmonics = polynomials.preScaledHarmonics();
                 _activeEffect->setVector3("vSphericalL00", preScaledHarmonics.l00);
                 _activeEffect->setVector3("vSphericalL1_1", preScaledHarmonics.l1_1);
@@ -1265,7 +1293,7 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
       }
 
       // Colors
-      if (defines["METALLICWORKFLOW"]) {
+      if (defines[METALLICWORKFLOW]) {
         TmpVectors::Color3Array[0].r = !_metallic.has_value() ? 1.f : *_metallic;
         TmpVectors::Color3Array[0].g = !_roughness.has_value() ? 1.f : *_roughness;
 
@@ -1284,7 +1312,7 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
         "vEmissiveColor",
         MaterialFlags::EmissiveTextureEnabled() ? _emissiveColor : Color3::BlackReadOnly(), "");
       ubo.updateColor3("vReflectionColor", _reflectionColor, "");
-      if (!defines["SS_REFRACTION"] && subSurface->linkRefractionWithTransparency()) {
+      if (!defines[SS_REFRACTION] && subSurface->linkRefractionWithTransparency()) {
         ubo.updateColor4("vAlbedoColor", _albedoColor, 1.f, "");
       }
       else {
@@ -1318,7 +1346,7 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
       }
 
       if (reflectionTexture && MaterialFlags::ReflectionTextureEnabled()) {
-        if (defines["LODBASEDMICROSFURACE"]) {
+        if (defines[LODBASEDMICROSFURACE]) {
           ubo.setTexture("reflectionSampler", reflectionTexture);
         }
         else {
@@ -1333,12 +1361,12 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
                                                     reflectionTexture);
         }
 
-        if (defines["USEIRRADIANCEMAP"]) {
+        if (defines[USEIRRADIANCEMAP]) {
           ubo.setTexture("irradianceSampler", reflectionTexture->irradianceTexture());
         }
       }
 
-      if (defines["ENVIRONMENTBRDF"]) {
+      if (defines[ENVIRONMENTBRDF]) {
         ubo.setTexture("environmentBrdfSampler", _environmentBRDFTexture);
       }
 
@@ -1369,7 +1397,7 @@ void PBRBaseMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh
       }
     }
 
-    subSurface->bindForSubMesh(ubo, scene, engine, isFrozen(), defines["LODBASEDMICROSFURACE"]);
+    subSurface->bindForSubMesh(ubo, scene, engine, isFrozen(), defines[LODBASEDMICROSFURACE]);
     clearCoat->bindForSubMesh(ubo, scene, engine, _disableBumpMap, isFrozen(), _invertNormalMapX,
                               _invertNormalMapY);
     anisotropy->bindForSubMesh(ubo, scene, isFrozen());
@@ -93,8 +93,10 @@ PBRMaterialDefines::PBRMaterialDefines()
     {"HORIZONOCCLUSION", false},                            //
 
     {"INSTANCES", false}, //
+    {"THIN_INSTANCES", false}, //
 
     {"BONETEXTURE", false}, //
+    {"BAKED_VERTEX_ANIMATION_TEXTURE", false}, //
 
     {"NONUNIFORMSCALING", false}, //
 
@@ -2,6 +2,7 @@
 
 #include <babylon/animations/animation.h>
 #include <babylon/babylon_stl_util.h>
+#include <babylon/baked_vertex_animation/baked_vertex_animation_manager.h>
 #include <babylon/bones/skeleton.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/core/json_util.h>
@@ -692,7 +693,9 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, BaseSubMesh* subMes
   MaterialHelper::PrepareDefinesForAttributes(mesh, defines, true, true, true, true);
 
   // Values that need to be evaluated on every frame
-  MaterialHelper::PrepareDefinesForFrameBoundValues(scene, engine, defines, useInstances);
+  MaterialHelper::PrepareDefinesForFrameBoundValues(scene, engine, defines, useInstances,
+                                                    std::nullopt,
+                                                    useInstances && mesh->hasThinInstances());
 
   // Get correct effect
   if (defines.isDirty()) {
@@ -789,6 +792,7 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, BaseSubMesh* subMes
     MaterialHelper::PrepareAttributesForBones(attribs, mesh, defines, *fallbacks);
     MaterialHelper::PrepareAttributesForInstances(attribs, defines);
     MaterialHelper::PrepareAttributesForMorphTargets(attribs, mesh, defines);
+    MaterialHelper::PrepareAttributesForBakedVertexAnimation(attribs, defines);
 
     std::string shaderName{"default"};
     const auto join = defines.toString();
@@ -845,12 +849,16 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, BaseSubMesh* subMes
                                       "logarithmicDepthConstant",
                                       "vTangentSpaceParams",
                                       "alphaCutOff",
-                                      "boneTextureWidth"};
+                                      "boneTextureWidth",
+                                      "bakedVertexAnimationSettings",
+                                      "bakedVertexAnimationTextureSizeInverted",
+                                      "bakedVertexAnimationTime"};
     std::vector<std::string> samplers{
       "diffuseSampler",        "ambientSampler",      "opacitySampler",
       "reflectionCubeSampler", "reflection2DSampler", "emissiveSampler",
       "specularSampler",       "bumpSampler",         "lightmapSampler",
-      "refractionCubeSampler", "refraction2DSampler", "boneSampler"};
+      "refractionCubeSampler", "refraction2DSampler", "boneSampler",
+      "bakedVertexAnimationTexture"};
     std::vector<std::string> uniformBuffers{"Material", "Scene"};
 
     ImageProcessingConfiguration::PrepareUniforms(uniforms, defines);
@@ -990,6 +998,16 @@ void StandardMaterial::unbind()
 
 void StandardMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMesh)
 {
+  // Evaluated on every frame: the define names are only resolved once
+  static const auto INSTANCES      = MaterialDefineTable<bool>::Index("INSTANCES");
+  static const auto THIN_INSTANCES = MaterialDefineTable<bool>::Index("THIN_INSTANCES");
+  static const auto OBJECTSPACE_NORMALMAP
+    = MaterialDefineTable<bool>::Index("OBJECTSPACE_NORMALMAP");
+  static const auto BAKED_VERTEX_ANIMATION_TEXTURE
+    = MaterialDefineTable<bool>::Index("BAKED_VERTEX_ANIMATION_TEXTURE");
+  static const auto FRESNEL      = MaterialDefineTable<bool>::Index("FRESNEL");
+  static const auto SPECULARTERM = MaterialDefineTable<bool>::Index("SPECULARTERM");
+
   auto scene = getScene();
 
   auto definesTmp = static_cast<StandardMaterialDefines*>(subMesh->_materialDefines.get());
@@ -1005,12 +1023,12 @@ void StandardMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMes
   _activeEffect = effect;
 
   // Matrices
-  if (!defines["INSTANCES"]) {
+  if (!defines[INSTANCES] || defines[THIN_INSTANCES]) {
     bindOnlyWorldMatrix(world);
   }
 
   // Normal Matrix
-  if (defines["OBJECTSPACE_NORMALMAP"]) {
+  if (defines[OBJECTSPACE_NORMALMAP]) {
     world.toNormalMatrix(_normalMatrix);
     bindOnlyNormalMatrix(_normalMatrix);
   }
@@ -1018,7 +1036,12 @@ void StandardMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMes
   const auto mustRebind = _mustRebind(scene, effect, mesh->visibility());
 
   // Bones
-  MaterialHelper::BindBonesParameters(mesh, effect);
+  if (defines[BAKED_VERTEX_ANIMATION_TEXTURE]) {
+    mesh->bakedVertexAnimationManager()->bind(effect, defines[INSTANCES]);
+  }
+  else {
+    MaterialHelper::BindBonesParameters(mesh, effect);
+  }
   auto& ubo = *_uniformBuffer;
   if (mustRebind) {
     ubo.bindToEffect(effect.get(), "Material");
@@ -1026,7 +1049,7 @@ void StandardMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMes
     bindViewProjection(effect);
     if (!ubo.useUbo() || !isFrozen() || !ubo.isSync()) {
 
-      if (StandardMaterial::FresnelEnabled() && defines["FRESNEL"]) {
+      if (StandardMaterial::FresnelEnabled() && defines[FRESNEL]) {
         // Fresnel
         if (_diffuseFresnelParameters && _diffuseFresnelParameters->isEnabled()) {
           ubo.updateColor4("diffuseLeftColor", _diffuseFresnelParameters->leftColor,
@@ -1154,7 +1177,7 @@ void StandardMaterial::bindForSubMesh(Matrix& world, Mesh* mesh, SubMesh* subMes
         ubo.updateFloat("pointSize", pointSize);
       }
 
-      if (defines["SPECULARTERM"]) {
+      if (defines[SPECULARTERM]) {
         ubo.updateColor4("vSpecularColor", specularColor, specularPower, "");
       }
       ubo.updateColor3(
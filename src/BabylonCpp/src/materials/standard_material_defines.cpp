@@ -45,7 +45,9 @@ StandardMaterialDefines::StandardMaterialDefines()
     {"VERTEXCOLOR", false},                                 //
     {"VERTEXALPHA", false},                                 //
     {"BONETEXTURE", false},                                 //
+    {"BAKED_VERTEX_ANIMATION_TEXTURE", false},              //
     {"INSTANCES", false},                                   //
+    {"THIN_INSTANCES", false},                              //
     {"GLOSSINESS", false},                                  //
     {"ROUGHNESS", false},                                   //
     {"EMISSIVEASILLUMINATION", false},                      //
@@ -1,6 +1,5 @@
 #include <babylon/materials/textures/loaders/tga_texture_loader.h>
 
-#include <babylon/babylon_stl_util.h>
 #include <babylon/materials/textures/internal_texture.h>
 #include <babylon/misc/string_tools.h>
 #include <babylon/misc/tga.h>
@@ -44,7 +43,7 @@ void _TGATextureLoader::loadData(
   const std::function<void(int width, int height, bool loadMipmap, bool isCompressed,
                            const std::function<void()>& done, bool loadFailed)>& callback)
 {
-  const auto bytes = stl_util::to_array<uint8_t>(data.buffer(), data.byteOffset, data.byteLength());
+  const auto bytes = data.typedView<uint8_t>().toArray();
 
   auto header = TGATools::GetTGAHeader(bytes);
   callback(
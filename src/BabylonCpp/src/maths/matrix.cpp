@@ -13,9 +13,28 @@
 
 namespace BABYLON {
 
-int Matrix::_updateFlagSeed      = 0;
+std::atomic<int> Matrix::_updateFlagSeed{0};
 Matrix Matrix::_identityReadOnly = Matrix::Identity();
 
+int Matrix::_NextUpdateFlag()
+{
+  // Matrices can be updated from several threads (scene evaluation, skeletons
+  // preparation), so each thread reserves a block of flags and hands them out
+  // without synchronization. Flags are only compared for equality.
+  static constexpr int blockSize = 1024;
+  thread_local int nextFlag      = 0;
+  thread_local int lastFlag      = 0;
+  if (nextFlag == lastFlag) {
+    nextFlag = Matrix::_updateFlagSeed.fetch_add(blockSize, std::memory_order_relaxed);
+    if (nextFlag > std::numeric_limits<int>::max() - blockSize) {
+      Matrix::_updateFlagSeed = 0;
+      nextFlag                = 0;
+    }
+    lastFlag = nextFlag + blockSize;
+  }
+  return nextFlag++;
+}
+
 Matrix::Matrix()
     : updateFlag{-1}
     , _isIdentity{false}
@@ -68,8 +87,7 @@ const std::array<float, 16>& Matrix::m() const
 
 void Matrix::_markAsUpdated()
 {
-  updateFlag
-    = (Matrix::_updateFlagSeed < std::numeric_limits<int>::max()) ? Matrix::_updateFlagSeed++ : 0;
+  updateFlag          = Matrix::_NextUpdateFlag();
   _isIdentity         = false;
   _isIdentity3x2      = false;
   _isIdentityDirty    = true;
@@ -79,7 +97,7 @@ void Matrix::_markAsUpdated()
 void Matrix::_updateIdentityStatus(bool isIdentity, bool isIdentityDirty, bool isIdentity3x2,
                                    bool isIdentity3x2Dirty)
 {
-  updateFlag          = Matrix::_updateFlagSeed++;
+  updateFlag          = Matrix::_NextUpdateFlag();
   _isIdentity         = isIdentity;
   _isIdentity3x2      = isIdentity || isIdentity3x2;
   _isIdentityDirty    = _isIdentity ? false : isIdentityDirty;
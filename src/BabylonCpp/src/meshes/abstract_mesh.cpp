@@ -113,6 +113,13 @@ AbstractMesh::AbstractMesh(const std::string& iName, Scene* scene)
     , _masterMesh{nullptr}
     , _materialDefines{nullptr}
     , _boundingInfo{nullptr}
+    , _meshesTreeProxyId{-1}
+    , _meshesTreeOrder{0}
+    , _meshesTreeDirty{false}
+    , _meshesTreeUpdateSlot{0}
+    , _indexInSceneMeshesArray{-1}
+    , _lightSourcesDirty{false}
+    , _lightSourcesUpdateSlot{0}
     , _renderId{0}
     , _submeshesOctree{nullptr}
     , _unIndexed{false}
@@ -125,6 +132,8 @@ AbstractMesh::AbstractMesh(const std::string& iName, Scene* scene)
       }}
     , _transformMatrixTexture{nullptr}
     , skeleton{this, &AbstractMesh::get_skeleton, &AbstractMesh::set_skeleton}
+    , bakedVertexAnimationManager{this, &AbstractMesh::get_bakedVertexAnimationManager,
+                                  &AbstractMesh::set_bakedVertexAnimationManager}
     , edgesRenderer{this, &AbstractMesh::get_edgesRenderer}
     , isBlocked{this, &AbstractMesh::get_isBlocked}
     , useBones{this, &AbstractMesh::get_useBones}
@@ -161,10 +170,11 @@ void AbstractMesh::addToScene(const AbstractMeshPtr& newMesh)
 
 AbstractMeshPtr AbstractMesh::_this() const
 {
-  const auto& meshes = getScene()->meshes;
-  auto it            = std::find_if(meshes.begin(), meshes.end(),
-                         [this](const AbstractMeshPtr& mesh) { return mesh.get() == this; });
-  return (it != meshes.end()) ? (*it) : nullptr;
+  // Only the meshes of the scene are returned, their position is tracked
+  if (_indexInSceneMeshesArray < 0) {
+    return nullptr;
+  }
+  return std::static_pointer_cast<AbstractMesh>(std::const_pointer_cast<Node>(shared_from_this()));
 }
 
 size_t AbstractMesh::get_facetNb() const
@@ -601,43 +611,85 @@ void AbstractMesh::_rebuild()
 
 void AbstractMesh::_resyncLightSources()
 {
-  _lightSources.clear();
+  auto scene                 = getScene();
+  const auto* boundingSphere = _boundingInfo ? &_boundingInfo->boundingSphere : nullptr;
 
-  for (const auto& light : getScene()->lights) {
-    if (!light->isEnabled()) {
+  // Lights reaching the mesh, with their distance to the mesh relative to their
+  // range (-1 for the lights with an unbounded lit volume)
+  std::vector<std::pair<float, Light*>> candidates;
+  for (const auto& light : scene->_getLightSourcesCandidates(this)) {
+    if (!light->isEnabled() || !light->canAffectMesh(this)) {
       continue;
     }
 
-    if (light->canAffectMesh(this)) {
-      _lightSources.emplace_back(light);
+    auto relevance = -1.f;
+    if (boundingSphere && light->_lightsTreeProxyId != -1) {
+      if (!light->_canLightSphere(boundingSphere->centerWorld, boundingSphere->radiusWorld)) {
+        continue;
+      }
+      const auto distance = std::max(Vector3::Distance(boundingSphere->centerWorld,
+                                                       light->_lightsTreeCenter)
+                                       - boundingSphere->radiusWorld,
+                                     0.f);
+      relevance
+        = light->_lightsTreeRadius > 0.f ? distance / light->_lightsTreeRadius : distance;
     }
+    candidates.emplace_back(relevance, light);
+  }
+
+  // The materials only use the first lights, so the most relevant lights are
+  // kept first. Unbounded lights stay in the scene order.
+  const auto sortByPriority = scene->requireLightSorting;
+  std::stable_sort(candidates.begin(), candidates.end(),
+                   [sortByPriority](const std::pair<float, Light*>& a,
+                                    const std::pair<float, Light*>& b) {
+                     if (sortByPriority) {
+                       const auto priority = Light::CompareLightsPriority(a.second, b.second);
+                       if (priority != 0) {
+                         return priority < 0;
+                       }
+                     }
+                     if (a.first != b.first) {
+                       return a.first < b.first;
+                     }
+                     return a.first >= 0.f && a.second->uniqueId < b.second->uniqueId;
+                   });
+
+  std::vector<LightPtr> lightSources;
+  lightSources.reserve(candidates.size());
+  for (const auto& candidate : candidates) {
+    auto node = candidate.second->shared_from_this();
+    lightSources.emplace_back(std::static_pointer_cast<Light>(node));
+  }
+
+  if (lightSources == _lightSources) {
+    return;
   }
 
-  _markSubMeshesAsLightDirty();
+  const auto removed = std::any_of(
+    _lightSources.begin(), _lightSources.end(),
+    [&lightSources](const LightPtr& light) { return !stl_util::contains(lightSources, light); });
+  _lightSources = std::move(lightSources);
+
+  _markSubMeshesAsLightDirty(removed);
 }
 
 void AbstractMesh::_resyncLightSource(const LightPtr& light)
 {
-  const auto isIn = light && light->isEnabled() && light->canAffectMesh(this);
-
-  auto index = std::find(_lightSources.begin(), _lightSources.end(), light);
+  const auto* boundingSphere = _boundingInfo ? &_boundingInfo->boundingSphere : nullptr;
 
-  auto removed = false;
-  if (index == _lightSources.end()) {
-    if (!isIn) {
-      return;
-    }
-    _lightSources.emplace_back(light);
+  auto isIn = light && light->isEnabled() && light->canAffectMesh(this);
+  if (isIn && boundingSphere) {
+    isIn = light->_canLightSphere(boundingSphere->centerWorld, boundingSphere->radiusWorld);
   }
-  else {
-    if (isIn) {
-      return;
-    }
-    removed = true;
-    _lightSources.erase(index);
+  const auto wasIn = stl_util::contains(_lightSources, light);
+
+  if (isIn == wasIn) {
+    return;
   }
 
-  _markSubMeshesAsLightDirty(removed);
+  // The light sources are kept sorted
+  _resyncLightSources();
 }
 
 void AbstractMesh::_unBindEffect()
@@ -733,14 +785,31 @@ SkeletonPtr& AbstractMesh::get_skeleton()
   return _internalAbstractMeshDataInfo._skeleton;
 }
 
+void AbstractMesh::set_bakedVertexAnimationManager(const BakedVertexAnimationManagerPtr& value)
+{
+  if (_internalAbstractMeshDataInfo._bakedVertexAnimationManager == value) {
+    return;
+  }
+
+  _internalAbstractMeshDataInfo._bakedVertexAnimationManager = value;
+  _markSubMeshesAsAttributesDirty();
+}
+
+BakedVertexAnimationManagerPtr& AbstractMesh::get_bakedVertexAnimationManager()
+{
+  return _internalAbstractMeshDataInfo._bakedVertexAnimationManager;
+}
+
 Vector3& AbstractMesh::get_scaling()
 {
+  _markAsTransformDirty();
   return _scaling;
 }
 
 void AbstractMesh::set_scaling(const Vector3& newScaling)
 {
   _scaling = newScaling;
+  _markAsTransformDirty();
 }
 
 AbstractMesh* AbstractMesh::getParent()
@@ -857,6 +926,7 @@ AbstractMesh::normalizeToUnitCube(bool includeDescendants, bool ignoreRotation,
 AbstractMesh& AbstractMesh::setBoundingInfo(const BoundingInfo& boundingInfo)
 {
   _boundingInfo = std::make_unique<BoundingInfo>(boundingInfo);
+  _scene->_markMeshForMeshesTreeUpdate(this);
   return *this;
 }
 
@@ -1073,6 +1143,12 @@ AbstractMesh& AbstractMesh::_updateBoundingInfo()
                                                    effectiveMesh->worldMatrixFromCache());
   }
   _updateSubMeshesBoundingInfo(effectiveMesh->worldMatrixFromCache());
+  if (_submeshesOctree) {
+    for (const auto& subMesh : subMeshes) {
+      _submeshesOctree->updateMesh(subMesh.get());
+    }
+  }
+  _scene->_markMeshForMeshesTreeUpdate(this);
   return *this;
 }
 
@@ -1093,6 +1169,13 @@ AbstractMesh& AbstractMesh::_updateSubMeshesBoundingInfo(const Matrix& matrix)
   return *this;
 }
 
+void AbstractMesh::_markAsTransformDirty()
+{
+  // The world matrix is recomputed before the next meshes tree query
+  _scene->_markMeshForMeshesTreeUpdate(this);
+  TransformNode::_markAsTransformDirty();
+}
+
 void AbstractMesh::_afterComputeWorldMatrix()
 {
   if (doNotSyncBoundingInfo) {
@@ -1102,6 +1185,14 @@ void AbstractMesh::_afterComputeWorldMatrix()
   _updateBoundingInfo();
 }
 
+bool AbstractMesh::_canComputeWorldMatrixConcurrently()
+{
+  // LOD levels and skeleton override meshes depend on another mesh state
+  const auto& iSkeleton = skeleton();
+  return TransformNode::_canComputeWorldMatrixConcurrently() && _masterMesh == nullptr
+         && !(iSkeleton && iSkeleton->overrideMesh);
+}
+
 AbstractMesh* AbstractMesh::_effectiveMesh()
 {
   return (skeleton() && skeleton()->overrideMesh) ? skeleton()->overrideMesh.get() : this;
@@ -1112,6 +1203,11 @@ bool AbstractMesh::isInFrustum(const std::array<Plane, 6>& frustumPlanes, unsign
   return _boundingInfo != nullptr && _boundingInfo->isInFrustum(frustumPlanes, cullingStrategy);
 }
 
+bool AbstractMesh::_isInFrustumFromCullingResult(bool boundingInfoInFrustum)
+{
+  return _boundingInfo != nullptr && boundingInfoInFrustum;
+}
+
 bool AbstractMesh::isCompletelyInFrustum(const std::array<Plane, 6>& frustumPlanes)
 {
   return _boundingInfo != nullptr && _boundingInfo->isCompletelyInFrustum(frustumPlanes);
@@ -1319,11 +1415,8 @@ Octree<SubMesh*>* AbstractMesh::createOrUpdateSubmeshesOctree(size_t maxCapacity
   }
 
   if (!_submeshesOctree) {
-    _submeshesOctree = new Octree<SubMesh*>(
-      [](SubMesh* entry, OctreeBlock<SubMesh*>& block) {
-        Octree<AbstractMesh*>::CreationFuncForSubMeshes(entry, block);
-      },
-      maxCapacity, maxDepth);
+    _submeshesOctree
+      = new Octree<SubMesh*>(&Octree<SubMesh*>::BoundsFuncForSubMeshes, maxCapacity, maxDepth);
   }
 
   computeWorldMatrix(true);
@@ -1444,8 +1537,9 @@ PickingInfo AbstractMesh::intersects(Ray& ray, const std::optional<bool>& iFastC
   std::optional<IntersectionInfo> intersectInfo = std::nullopt;
 
   // Octrees
-  auto _subMeshes = _scene->getIntersectingSubMeshCandidates(this, ray);
-  auto len        = _subMeshes.size();
+  auto _subMeshes    = _scene->getIntersectingSubMeshCandidates(this, ray);
+  auto len           = _subMeshes.size();
+  const auto indices = getIndices();
   for (size_t index = 0; index < len; ++index) {
     auto& subMesh = _subMeshes[index];
 
@@ -1455,7 +1549,7 @@ PickingInfo AbstractMesh::intersects(Ray& ray, const std::optional<bool>& iFastC
     }
 
     auto currentIntersectInfo
-      = subMesh->intersects(ray, _positions(), getIndices(), fastCheck, trianglePredicate);
+      = subMesh->intersects(ray, _positions(), indices, fastCheck, trianglePredicate);
 
     if (currentIntersectInfo) {
       if (fastCheck || !intersectInfo || currentIntersectInfo->distance < intersectInfo->distance) {
@@ -1555,12 +1649,10 @@ void AbstractMesh::dispose(bool doNotRecurse, bool disposeMaterialAndTextures)
   auto lightsCopy = getScene()->lights;
   for (const auto& light : lightsCopy) {
     // Included meshes
-    stl_util::remove_vector_elements_equal_sharedptr_wrapped(light->includedOnlyMeshes,
-                                                             this); // Checked
+    light->removeIncludedOnlyMesh(this);
 
     // Excluded meshes
-    stl_util::remove_vector_elements_equal_sharedptr_wrapped(light->excludedMeshes,
-                                                             this); // Checked
+    light->removeExcludedMesh(this);
 
     // Shadow generators
     auto generator = light->getShadowGenerator();
@@ -8,9 +8,9 @@
 
 namespace BABYLON {
 
-Buffer::Buffer(Engine* engine, const Float32Array& data, bool updatable,
-               std::optional<size_t> stride, bool postponeInternalCreation, bool instanced,
-               bool useBytes, const std::optional<unsigned int>& divisor)
+Buffer::Buffer(Engine* engine, Float32Array data, bool updatable, std::optional<size_t> stride,
+               bool postponeInternalCreation, bool instanced, bool useBytes,
+               const std::optional<unsigned int>& divisor)
     : _buffer{nullptr}
 {
   _engine    = engine ? engine : Engine::LastCreatedEngine();
@@ -18,7 +18,7 @@ Buffer::Buffer(Engine* engine, const Float32Array& data, bool updatable,
   _instanced = instanced;
   _divisor   = divisor.value_or(1);
 
-  _data = data;
+  _data = std::move(data);
 
   if (!stride.has_value()) {
     stride = 0ull;
@@ -31,7 +31,7 @@ Buffer::Buffer(Engine* engine, const Float32Array& data, bool updatable,
   }
 }
 
-Buffer::Buffer(Mesh* mesh, const Float32Array& data, bool updatable, std::optional<size_t> stride,
+Buffer::Buffer(Mesh* mesh, Float32Array data, bool updatable, std::optional<size_t> stride,
                bool postponeInternalCreation, bool instanced, bool useBytes,
                const std::optional<unsigned int>& divisor)
     : _buffer{nullptr}
@@ -41,7 +41,7 @@ Buffer::Buffer(Mesh* mesh, const Float32Array& data, bool updatable, std::option
   _instanced = instanced;
   _divisor   = divisor.value_or(1);
 
-  _data = data;
+  _data = std::move(data);
 
   if (!stride.has_value()) {
     stride = 0ull;
@@ -0,0 +1,686 @@
+#include <babylon/meshes/csg/boolean_operation.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <limits>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/meshes/csg/node.h>
+#include <babylon/meshes/csg/plane.h>
+#include <babylon/meshes/csg/vertex.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Number of polygons processed per parallel chunk
+constexpr size_t PolygonsGrainSize = 64;
+
+// Maximum number of polygons in a leaf of the bounding volume hierarchy
+constexpr size_t MaxLeafSize = 4;
+
+// Ray directions used to classify the fragments, avoiding the axes and the
+// diagonals to not graze the edges of axis aligned solids
+constexpr std::array<std::array<float, 3>, 4> RayDirections{{
+  {{0.5410f, 0.6178f, 0.5705f}},
+  {{-0.6524f, 0.4871f, 0.5806f}},
+  {{0.3147f, -0.7529f, 0.5780f}},
+  {{-0.4663f, -0.5318f, -0.7069f}},
+}};
+
+enum class Classification {
+  Outside,
+  Inside,
+  CoplanarSame,
+  CoplanarOpposite,
+}; // end of enum class Classification
+
+enum class Containment {
+  Outside,
+  Boundary,
+  Inside,
+}; // end of enum class Containment
+
+struct Bounds {
+  std::array<float, 3> min{{std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
+                            std::numeric_limits<float>::max()}};
+  std::array<float, 3> max{{std::numeric_limits<float>::lowest(),
+                            std::numeric_limits<float>::lowest(),
+                            std::numeric_limits<float>::lowest()}};
+
+  void add(const Vector3& point)
+  {
+    min = {{std::min(min[0], point.x), std::min(min[1], point.y), std::min(min[2], point.z)}};
+    max = {{std::max(max[0], point.x), std::max(max[1], point.y), std::max(max[2], point.z)}};
+  }
+
+  void add(const Bounds& other)
+  {
+    for (size_t axis = 0; axis < 3; ++axis) {
+      min[axis] = std::min(min[axis], other.min[axis]);
+      max[axis] = std::max(max[axis], other.max[axis]);
+    }
+  }
+
+  [[nodiscard]] bool overlaps(const Bounds& other, float epsilon) const
+  {
+    for (size_t axis = 0; axis < 3; ++axis) {
+      if (min[axis] > other.max[axis] + epsilon || max[axis] < other.min[axis] - epsilon) {
+        return false;
+      }
+    }
+    return true;
+  }
+}; // end of struct Bounds
+
+template <class Iterator>
+Bounds ComputeBounds(Iterator begin, Iterator end)
+{
+  Bounds bounds;
+  for (auto it = begin; it != end; ++it) {
+    bounds.add(it->pos);
+  }
+  return bounds;
+}
+
+/**
+ * Tells whether a point of the plane of a convex polygon lies inside it, on its
+ * boundary or outside it. The vertices of the csg polygons are clockwise around
+ * their plane normal.
+ */
+Containment PolygonContains(const CSG::Polygon& polygon, const Vector3& point)
+{
+  const auto& normal   = polygon.plane.second.normal;
+  const auto& vertices = polygon.vertices;
+  auto onBoundary      = false;
+  for (size_t i = 0, j = vertices.size() - 1; i < vertices.size(); j = i++) {
+    const auto edge   = vertices[i].pos.subtract(vertices[j].pos);
+    const auto length = edge.length();
+    if (length <= 0.f) {
+      continue;
+    }
+    const auto distance
+      = Vector3::Dot(Vector3::Cross(point.subtract(vertices[j].pos), edge), normal) / length;
+    if (distance < -CSG::Plane::EPSILON) {
+      return Containment::Outside;
+    }
+    onBoundary = onBoundary || distance <= CSG::Plane::EPSILON;
+  }
+  return onBoundary ? Containment::Boundary : Containment::Inside;
+}
+
+/**
+ * Static bounding volume hierarchy over the polygons of a solid.
+ */
+class PolygonBVH {
+
+public:
+  PolygonBVH(const std::vector<CSG::Polygon>& polygons) : _polygons{polygons}
+  {
+    _polygonBounds.reserve(polygons.size());
+    _ids.reserve(polygons.size());
+    for (size_t i = 0; i < polygons.size(); ++i) {
+      const auto& vertices = polygons[i].vertices;
+      _polygonBounds.emplace_back(ComputeBounds(vertices.begin(), vertices.end()));
+      if (polygons[i].plane.first && vertices.size() >= 3) {
+        _ids.emplace_back(static_cast<uint32_t>(i));
+      }
+    }
+    _nodes.reserve(2 * (_ids.size() / MaxLeafSize + 1));
+    if (!_ids.empty()) {
+      _build(0, _ids.size());
+    }
+  }
+
+  [[nodiscard]] const Bounds& bounds() const
+  {
+    static const Bounds empty;
+    return _nodes.empty() ? empty : _nodes.front().bounds;
+  }
+
+  [[nodiscard]] const Bounds& polygonBounds(uint32_t polygonId) const
+  {
+    return _polygonBounds[polygonId];
+  }
+
+  /**
+   * Collects the polygons whose bounding box overlaps a box.
+   */
+  void query(const Bounds& box, std::vector<uint32_t>& results,
+             std::vector<uint32_t>& stack) const
+  {
+    results.clear();
+    if (_nodes.empty()) {
+      return;
+    }
+    stack.assign(1, 0);
+    while (!stack.empty()) {
+      const auto& node = _nodes[stack.back()];
+      stack.pop_back();
+      if (!node.bounds.overlaps(box, CSG::Plane::EPSILON)) {
+        continue;
+      }
+      if (node.count > 0) {
+        for (size_t i = node.first; i < node.first + node.count; ++i) {
+          if (_polygonBounds[_ids[i]].overlaps(box, CSG::Plane::EPSILON)) {
+            results.emplace_back(_ids[i]);
+          }
+        }
+      }
+      else {
+        stack.emplace_back(node.left);
+        stack.emplace_back(node.right);
+      }
+    }
+  }
+
+  /**
+   * Counts the polygons crossed by a ray, or returns -1 when the ray grazes an
+   * edge or starts on the surface, in which case the parity is unreliable.
+   */
+  int countCrossings(const Vector3& origin, const Vector3& direction,
+                     std::vector<uint32_t>& stack) const
+  {
+    if (_nodes.empty()) {
+      return 0;
+    }
+    const std::array<float, 3> o{{origin.x, origin.y, origin.z}};
+    const std::array<float, 3> invDirection{{1.f / direction.x, 1.f / direction.y,
+                                             1.f / direction.z}};
+    auto crossings = 0;
+    stack.assign(1, 0);
+    while (!stack.empty()) {
+      const auto& node = _nodes[stack.back()];
+      stack.pop_back();
+      // Slab test, the ray is unbounded
+      auto tMin = 0.f;
+      auto tMax = std::numeric_limits<float>::max();
+      for (size_t axis = 0; axis < 3 && tMin <= tMax; ++axis) {
+        auto t0 = (node.bounds.min[axis] - CSG::Plane::EPSILON - o[axis]) * invDirection[axis];
+        auto t1 = (node.bounds.max[axis] + CSG::Plane::EPSILON - o[axis]) * invDirection[axis];
+        if (t0 > t1) {
+          std::swap(t0, t1);
+        }
+        tMin = std::max(tMin, t0);
+        tMax = std::min(tMax, t1);
+      }
+      if (tMin > tMax) {
+        continue;
+      }
+      if (node.count == 0) {
+        stack.emplace_back(node.left);
+        stack.emplace_back(node.right);
+        continue;
+      }
+      for (size_t i = node.first; i < node.first + node.count; ++i) {
+        const auto hit = _intersects(_polygons[_ids[i]], origin, direction);
+        if (hit < 0) {
+          return -1;
+        }
+        crossings += hit;
+      }
+    }
+    return crossings;
+  }
+
+private:
+  struct Node {
+    Bounds bounds;
+    uint32_t left  = 0;
+    uint32_t right = 0;
+    uint32_t first = 0;
+    // Number of polygons of a leaf, 0 for inner nodes
+    uint32_t count = 0;
+  }; // end of struct Node
+
+  uint32_t _build(size_t begin, size_t end)
+  {
+    const auto nodeIndex = static_cast<uint32_t>(_nodes.size());
+    _nodes.emplace_back();
+
+    Bounds bounds, centers;
+    for (size_t i = begin; i < end; ++i) {
+      const auto& polygonBounds = _polygonBounds[_ids[i]];
+      bounds.add(polygonBounds);
+      centers.add(Vector3((polygonBounds.min[0] + polygonBounds.max[0]) * 0.5f,
+                          (polygonBounds.min[1] + polygonBounds.max[1]) * 0.5f,
+                          (polygonBounds.min[2] + polygonBounds.max[2]) * 0.5f));
+    }
+
+    if (end - begin <= MaxLeafSize) {
+      auto& node  = _nodes[nodeIndex];
+      node.bounds = bounds;
+      node.first  = static_cast<uint32_t>(begin);
+      node.count  = static_cast<uint32_t>(end - begin);
+      return nodeIndex;
+    }
+
+    // Median split on the largest axis of the polygon centers
+    size_t axis = 0;
+    for (size_t i = 1; i < 3; ++i) {
+      if (centers.max[i] - centers.min[i] > centers.max[axis] - centers.min[axis]) {
+        axis = i;
+      }
+    }
+    const auto middle = begin + (end - begin) / 2;
+    std::nth_element(_ids.begin() + static_cast<std::ptrdiff_t>(begin),
+                     _ids.begin() + static_cast<std::ptrdiff_t>(middle),
+                     _ids.begin() + static_cast<std::ptrdiff_t>(end),
+                     [this, axis](uint32_t lhs, uint32_t rhs) {
+                       const auto& l = _polygonBounds[lhs];
+                       const auto& r = _polygonBounds[rhs];
+                       return l.min[axis] + l.max[axis] < r.min[axis] + r.max[axis];
+                     });
+
+    const auto left  = _build(begin, middle);
+    const auto right = _build(middle, end);
+    auto& node       = _nodes[nodeIndex];
+    node.bounds      = bounds;
+    node.left        = left;
+    node.right       = right;
+    return nodeIndex;
+  }
+
+  // Returns 1 when the ray crosses the polygon, 0 when it misses it and -1
+  // when the result is ambiguous
+  static int _intersects(const CSG::Polygon& polygon, const Vector3& origin,
+                         const Vector3& direction)
+  {
+    const auto& plane     = polygon.plane.second;
+    const auto distance   = Vector3::Dot(plane.normal, origin) - plane.w;
+    const auto projection = Vector3::Dot(plane.normal, direction);
+    if (std::abs(projection) < 1e-6f) {
+      return std::abs(distance) <= CSG::Plane::EPSILON ? -1 : 0;
+    }
+    const auto t = -distance / projection;
+    if (t < -CSG::Plane::EPSILON) {
+      return 0;
+    }
+    switch (PolygonContains(polygon, origin.add(direction.scale(t)))) {
+      case Containment::Outside:
+        return 0;
+      case Containment::Boundary:
+        return -1;
+      default:
+        return t <= CSG::Plane::EPSILON ? -1 : 1;
+    }
+  }
+
+private:
+  const std::vector<CSG::Polygon>& _polygons;
+  std::vector<Bounds> _polygonBounds;
+  std::vector<Node> _nodes;
+  std::vector<uint32_t> _ids;
+
+}; // end of class PolygonBVH
+
+/**
+ * Fragments of the polygons of a chunk. The vertices of all the fragments are
+ * stored contiguously.
+ */
+struct FragmentArena {
+  struct Fragment {
+    uint32_t polygonId;
+    uint32_t first;
+    uint32_t count;
+    Classification classification;
+  }; // end of struct Fragment
+
+  std::vector<CSG::Vertex> vertices;
+  std::vector<Fragment> fragments;
+}; // end of struct FragmentArena
+
+/**
+ * Splits the polygons of a solid against the polygons of another solid and
+ * classifies the fragments. One instance is used per chunk, so that the
+ * scratch buffers are reused from one polygon to the next.
+ */
+class PolygonClassifier {
+
+public:
+  PolygonClassifier(const std::vector<CSG::Polygon>& others, const PolygonBVH& bvh)
+      : _others{others}, _bvh{bvh}
+  {
+  }
+
+  void process(const std::vector<CSG::Polygon>& polygons, size_t polygonId, FragmentArena& arena)
+  {
+    const auto& polygon = polygons[polygonId];
+    if (!polygon.plane.first || polygon.vertices.size() < 3) {
+      return;
+    }
+
+    const auto& vertices = polygon.vertices;
+    const auto bounds    = ComputeBounds(vertices.begin(), vertices.end());
+    const auto id        = static_cast<uint32_t>(polygonId);
+
+    // Far from the other solid, the polygon is kept whole
+    if (!bounds.overlaps(_bvh.bounds(), CSG::Plane::EPSILON)) {
+      _emit(arena, id, vertices.begin(), vertices.end(), Classification::Outside);
+      return;
+    }
+
+    _bvh.query(bounds, _candidates, _stack);
+    _collectSplitters(polygon);
+
+    // Splits the polygon, fragments not overlapping the bounds of a splitter
+    // are not touched by it
+    _pool.assign(vertices.begin(), vertices.end());
+    _fragments.assign(1, {0, static_cast<uint32_t>(vertices.size())});
+    for (const auto& splitter : _splitters) {
+      _nextFragments.clear();
+      for (const auto& fragment : _fragments) {
+        const auto begin = _pool.begin() + fragment.first;
+        if (!ComputeBounds(begin, begin + fragment.count)
+               .overlaps(_bvh.polygonBounds(splitter.polygonId), CSG::Plane::EPSILON)) {
+          _nextFragments.emplace_back(fragment);
+          continue;
+        }
+        _split(fragment, splitter.normal, splitter.w);
+      }
+      std::swap(_fragments, _nextFragments);
+    }
+
+    for (const auto& fragment : _fragments) {
+      const auto begin = _pool.begin() + fragment.first;
+      _emit(arena, id, begin, begin + fragment.count,
+            _classify(begin, begin + fragment.count, polygon.plane.second.normal));
+    }
+  }
+
+private:
+  struct Range {
+    uint32_t first;
+    uint32_t count;
+  }; // end of struct Range
+
+  struct Splitter {
+    Vector3 normal;
+    float w;
+    uint32_t polygonId;
+  }; // end of struct Splitter
+
+  static unsigned int _side(const Vector3& normal, float w, const Vector3& point)
+  {
+    const auto t = Vector3::Dot(normal, point) - w;
+    return t < -CSG::Plane::EPSILON ? CSG::Plane::BACK :
+                                      (t > CSG::Plane::EPSILON ? CSG::Plane::FRONT :
+                                                                 CSG::Plane::COPLANAR);
+  }
+
+  void _collectSplitters(const CSG::Polygon& polygon)
+  {
+    _splitters.clear();
+    _coplanars.clear();
+    const auto& plane = polygon.plane.second;
+    for (auto candidateId : _candidates) {
+      const auto& candidate      = _others[candidateId];
+      const auto& candidatePlane = candidate.plane.second;
+
+      unsigned int polygonType = 0;
+      for (const auto& vertex : polygon.vertices) {
+        polygonType |= _side(candidatePlane.normal, candidatePlane.w, vertex.pos);
+      }
+      if (polygonType == CSG::Plane::COPLANAR) {
+        // The coplanar fragments are split along the edges of the candidate
+        _coplanars.emplace_back(candidateId);
+        const auto& candidateVertices = candidate.vertices;
+        for (size_t i = 0, j = candidateVertices.size() - 1; i < candidateVertices.size();
+             j = i++) {
+          const auto edge = candidateVertices[i].pos.subtract(candidateVertices[j].pos);
+          if (edge.lengthSquared() <= 0.f) {
+            continue;
+          }
+          const auto normal = Vector3::Normalize(Vector3::Cross(edge, candidatePlane.normal));
+          _splitters.push_back(
+            {normal, Vector3::Dot(normal, candidateVertices[j].pos), candidateId});
+        }
+        continue;
+      }
+      if (polygonType != CSG::Plane::SPANNING) {
+        continue;
+      }
+
+      // The candidate must also reach the plane of the polygon
+      unsigned int candidateType = 0;
+      for (const auto& vertex : candidate.vertices) {
+        candidateType |= _side(plane.normal, plane.w, vertex.pos);
+      }
+      if (candidateType == CSG::Plane::FRONT || candidateType == CSG::Plane::BACK) {
+        continue;
+      }
+      _splitters.push_back({candidatePlane.normal, candidatePlane.w, candidateId});
+    }
+  }
+
+  void _split(const Range& fragment, const Vector3& normal, float w)
+  {
+    unsigned int fragmentType = 0;
+    _types.resize(fragment.count);
+    for (uint32_t i = 0; i < fragment.count; ++i) {
+      _types[i] = _side(normal, w, _pool[fragment.first + i].pos);
+      fragmentType |= _types[i];
+    }
+    if (fragmentType != CSG::Plane::SPANNING) {
+      _nextFragments.emplace_back(fragment);
+      return;
+    }
+
+    _front.clear();
+    _back.clear();
+    for (uint32_t i = 0; i < fragment.count; ++i) {
+      const auto j  = (i + 1) % fragment.count;
+      const auto ti = _types[i];
+      const auto tj = _types[j];
+      auto vi       = _pool[fragment.first + i];
+      const auto& vj = _pool[fragment.first + j];
+      if (ti != CSG::Plane::BACK) {
+        _front.emplace_back(vi);
+      }
+      if (ti != CSG::Plane::FRONT) {
+        _back.emplace_back(vi);
+      }
+      if ((ti | tj) == CSG::Plane::SPANNING) {
+        const auto t = (w - Vector3::Dot(normal, vi.pos))
+                       / Vector3::Dot(normal, vj.pos.subtract(vi.pos));
+        const auto vertex = vi.interpolate(vj, t);
+        _front.emplace_back(vertex);
+        _back.emplace_back(vertex);
+      }
+    }
+
+    for (const auto* part : {&_front, &_back}) {
+      if (part->size() >= 3) {
+        _nextFragments.push_back(
+          {static_cast<uint32_t>(_pool.size()), static_cast<uint32_t>(part->size())});
+        _pool.insert(_pool.end(), part->begin(), part->end());
+      }
+    }
+  }
+
+  Classification _classify(std::vector<CSG::Vertex>::const_iterator begin,
+                           std::vector<CSG::Vertex>::const_iterator end, const Vector3& normal)
+  {
+    Vector3 centroid;
+    for (auto it = begin; it != end; ++it) {
+      centroid.addInPlace(it->pos);
+    }
+    centroid = centroid.scale(1.f / static_cast<float>(end - begin));
+
+    for (auto coplanarId : _coplanars) {
+      const auto& coplanar = _others[coplanarId];
+      if (PolygonContains(coplanar, centroid) == Containment::Inside) {
+        return Vector3::Dot(normal, coplanar.plane.second.normal) > 0.f ?
+                 Classification::CoplanarSame :
+                 Classification::CoplanarOpposite;
+      }
+    }
+
+    for (const auto& direction : RayDirections) {
+      const auto crossings
+        = _bvh.countCrossings(centroid, Vector3(direction[0], direction[1], direction[2]), _stack);
+      if (crossings >= 0) {
+        return crossings % 2 == 1 ? Classification::Inside : Classification::Outside;
+      }
+    }
+    return Classification::Outside;
+  }
+
+  template <class Iterator>
+  static void _emit(FragmentArena& arena, uint32_t polygonId, Iterator begin, Iterator end,
+                    Classification classification)
+  {
+    arena.fragments.push_back({polygonId, static_cast<uint32_t>(arena.vertices.size()),
+                               static_cast<uint32_t>(end - begin), classification});
+    arena.vertices.insert(arena.vertices.end(), begin, end);
+  }
+
+private:
+  const std::vector<CSG::Polygon>& _others;
+  const PolygonBVH& _bvh;
+  // Scratch buffers
+  std::vector<uint32_t> _candidates;
+  std::vector<uint32_t> _coplanars;
+  std::vector<uint32_t> _stack;
+  std::vector<Splitter> _splitters;
+  std::vector<CSG::Vertex> _pool;
+  std::vector<Range> _fragments;
+  std::vector<Range> _nextFragments;
+  std::vector<unsigned int> _types;
+  std::vector<CSG::Vertex> _front;
+  std::vector<CSG::Vertex> _back;
+
+}; // end of class PolygonClassifier
+
+std::vector<FragmentArena> ClassifyPolygons(const std::vector<CSG::Polygon>& polygons,
+                                            const std::vector<CSG::Polygon>& others,
+                                            const PolygonBVH& bvh)
+{
+  std::vector<FragmentArena> arenas((polygons.size() + PolygonsGrainSize - 1) / PolygonsGrainSize);
+  ThreadPool::Default().parallelFor(
+    polygons.size(), PolygonsGrainSize, [&](size_t begin, size_t end) {
+      // Chunks are aligned on the grain size
+      auto& arena = arenas[begin / PolygonsGrainSize];
+      PolygonClassifier classifier(others, bvh);
+      for (size_t i = begin; i < end; ++i) {
+        classifier.process(polygons, i, arena);
+      }
+    });
+  return arenas;
+}
+
+void CollectFragments(const std::vector<FragmentArena>& arenas,
+                      const std::vector<CSG::Polygon>& polygons,
+                      const std::function<bool(Classification)>& keep, bool flip,
+                      std::vector<CSG::Polygon>& result)
+{
+  for (const auto& arena : arenas) {
+    for (const auto& fragment : arena.fragments) {
+      if (!keep(fragment.classification)) {
+        continue;
+      }
+      const auto& source = polygons[fragment.polygonId];
+      const auto begin
+        = arena.vertices.begin() + static_cast<std::ptrdiff_t>(fragment.first);
+      CSG::Polygon polygon;
+      polygon.vertices.assign(begin, begin + fragment.count);
+      polygon.shared = source.shared;
+      polygon.plane  = source.plane;
+      if (flip) {
+        polygon.flip();
+      }
+      result.emplace_back(std::move(polygon));
+    }
+  }
+}
+
+} // end of anonymous namespace
+
+std::vector<CSG::Polygon> CSG::BooleanOperation::Apply(Type type, const std::vector<Polygon>& a,
+                                                       const std::vector<Polygon>& b)
+{
+  const PolygonBVH bvhA{a};
+  const PolygonBVH bvhB{b};
+  const auto fragmentsA = ClassifyPolygons(a, b, bvhB);
+  const auto fragmentsB = ClassifyPolygons(b, a, bvhA);
+
+  std::vector<Polygon> result;
+  switch (type) {
+    case Type::Union:
+      CollectFragments(
+        fragmentsA, a,
+        [](Classification c) {
+          return c == Classification::Outside || c == Classification::CoplanarSame;
+        },
+        false, result);
+      CollectFragments(
+        fragmentsB, b, [](Classification c) { return c == Classification::Outside; }, false,
+        result);
+      break;
+    case Type::Subtract:
+      CollectFragments(
+        fragmentsA, a,
+        [](Classification c) {
+          return c == Classification::Outside || c == Classification::CoplanarOpposite;
+        },
+        false, result);
+      CollectFragments(
+        fragmentsB, b, [](Classification c) { return c == Classification::Inside; }, true,
+        result);
+      break;
+    case Type::Intersect:
+      CollectFragments(
+        fragmentsA, a,
+        [](Classification c) {
+          return c == Classification::Inside || c == Classification::CoplanarSame;
+        },
+        false, result);
+      CollectFragments(
+        fragmentsB, b, [](Classification c) { return c == Classification::Inside; }, false,
+        result);
+      break;
+  }
+  return result;
+}
+
+std::vector<CSG::Polygon> CSG::BooleanOperation::ApplyWithBSPTree(Type type,
+                                                                  const std::vector<Polygon>& a,
+                                                                  const std::vector<Polygon>& b)
+{
+  Node nodeA{a};
+  Node nodeB{b};
+  switch (type) {
+    case Type::Union:
+      nodeA.clipTo(nodeB);
+      nodeB.clipTo(nodeA);
+      nodeB.invert();
+      nodeB.clipTo(nodeA);
+      nodeB.invert();
+      break;
+    case Type::Subtract:
+      nodeA.invert();
+      nodeA.clipTo(nodeB);
+      nodeB.clipTo(nodeA);
+      nodeB.invert();
+      nodeB.clipTo(nodeA);
+      nodeB.invert();
+      break;
+    case Type::Intersect:
+      nodeA.invert();
+      nodeB.clipTo(nodeA);
+      nodeB.invert();
+      nodeA.clipTo(nodeB);
+      nodeB.clipTo(nodeA);
+      break;
+  }
+  auto allPolygonsB = nodeB.allPolygons();
+  nodeA.build(allPolygonsB);
+  if (type != Type::Union) {
+    nodeA.invert();
+  }
+  return nodeA.allPolygons();
+}
+
+} // end of namespace BABYLON
@@ -1,7 +1,6 @@
 #include <babylon/meshes/csg/csg.h>
 
 #include <babylon/babylon_stl_util.h>
-#include <babylon/meshes/csg/node.h>
 #include <babylon/meshes/csg/polygon.h>
 #include <babylon/meshes/csg/vertex.h>
 #include <babylon/meshes/mesh.h>
@@ -12,6 +11,7 @@
 namespace BABYLON {
 
 unsigned int CSG::CSG::currentCSGMeshId = 0;
+bool CSG::CSG::UseBSPTree                = false;
 
 CSG::CSG::CSG() = default;
 
@@ -112,98 +112,43 @@ std::unique_ptr<CSG::CSG> CSG::CSG::clone() const
 
 CSG::CSG CSG::CSG::_union(const BABYLON::CSG::CSGPtr& csg)
 {
-  Node a{_polygons};
-  Node b{csg->_polygons};
-  a.clipTo(b);
-  b.clipTo(a);
-  b.invert();
-  b.clipTo(a);
-  b.invert();
-  auto allPolygonsB = b.allPolygons();
-  a.build(allPolygonsB);
-  return CSG::FromPolygons(a.allPolygons())->copyTransformAttributes(*this);
+  return CSG::FromPolygons(_applyBooleanOperation(BooleanOperation::Type::Union, *csg))
+    ->copyTransformAttributes(*this);
 }
 
 void CSG::CSG::unionInPlace(const BABYLON::CSG::CSGPtr& csg)
 {
-  Node a{_polygons};
-  Node b{csg->_polygons};
-
-  a.clipTo(b);
-  b.clipTo(a);
-  b.invert();
-  b.clipTo(a);
-  b.invert();
-  auto allPolygonsB = b.allPolygons();
-  a.build(allPolygonsB);
-
-  _polygons = a.allPolygons();
+  _polygons = _applyBooleanOperation(BooleanOperation::Type::Union, *csg);
 }
 
 CSG::CSG CSG::CSG::subtract(const BABYLON::CSG::CSGPtr& csg)
 {
-  Node a{_polygons};
-  Node b{csg->_polygons};
-  a.invert();
-  a.clipTo(b);
-  b.clipTo(a);
-  b.invert();
-  b.clipTo(a);
-  b.invert();
-  auto allPolygonsB = b.allPolygons();
-  a.build(allPolygonsB);
-  a.invert();
-  return CSG::FromPolygons(a.allPolygons())->copyTransformAttributes(*this);
+  return CSG::FromPolygons(_applyBooleanOperation(BooleanOperation::Type::Subtract, *csg))
+    ->copyTransformAttributes(*this);
 }
 
 void CSG::CSG::subtractInPlace(const BABYLON::CSG::CSGPtr& csg)
 {
-  Node a{_polygons};
-  Node b{csg->_polygons};
-
-  a.invert();
-  a.clipTo(b);
-  b.clipTo(a);
-  b.invert();
-  b.clipTo(a);
-  b.invert();
-  auto allPolygonsB = b.allPolygons();
-  a.build(allPolygonsB);
-  a.invert();
-
-  _polygons = a.allPolygons();
+  _polygons = _applyBooleanOperation(BooleanOperation::Type::Subtract, *csg);
 }
 
 CSG::CSG CSG::CSG::intersect(const BABYLON::CSG::CSGPtr& csg)
 {
-  Node a{_polygons};
-  Node b{csg->_polygons};
-  a.invert();
-  b.clipTo(a);
-  b.invert();
-  a.clipTo(b);
-  b.clipTo(a);
-  auto allPolygonsB = b.allPolygons();
-  a.build(allPolygonsB);
-  a.invert();
-  return CSG::FromPolygons(a.allPolygons())->copyTransformAttributes(*this);
+  return CSG::FromPolygons(_applyBooleanOperation(BooleanOperation::Type::Intersect, *csg))
+    ->copyTransformAttributes(*this);
 }
 
 void CSG::CSG::intersectInPlace(const BABYLON::CSG::CSGPtr& csg)
 {
-  Node a{_polygons};
-  Node b{csg->_polygons};
-
-  a.invert();
-  b.clipTo(a);
-  b.invert();
-  a.clipTo(b);
-  b.clipTo(a);
-  auto allPolygonsB = b.allPolygons();
-  a.build(allPolygonsB);
-  a.invert();
-
-  _polygons = a.allPolygons();
+  _polygons = _applyBooleanOperation(BooleanOperation::Type::Intersect, *csg);
+}
+
+std::vector<CSG::Polygon>
+CSG::CSG::_applyBooleanOperation(BooleanOperation::Type type,
+                                 const BABYLON::CSG::CSG& csg) const
+{
+  return UseBSPTree ? BooleanOperation::ApplyWithBSPTree(type, _polygons, csg._polygons) :
+                      BooleanOperation::Apply(type, _polygons, csg._polygons);
 }
 
 std::unique_ptr<CSG::CSG> CSG::CSG::inverse()
@@ -5,6 +5,7 @@
 #include <babylon/babylon_stl_util.h>
 #include <babylon/bones/skeleton.h>
 #include <babylon/culling/bounding_info.h>
+#include <babylon/culling/triangle_bvh.h>
 #include <babylon/engines/constants.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
@@ -418,6 +419,7 @@ void Geometry::updateIndices(const IndicesArray& indices, int offset, bool gpuMe
 
     if (!gpuMemoryOnly) {
       _indices = indices;
+      _triangleBVHs.clear();
     }
     _engine->updateDynamicIndexBuffer(_indexBuffer, indices, offset);
     if (needToUpdateSubMeshes) {
@@ -439,6 +441,7 @@ AbstractMesh* Geometry::setIndices(const IndicesArray& indices, size_t totalVert
 
   _indices                = indices;
   _indexBufferIsUpdatable = updatable;
+  _triangleBVHs.clear();
   if (!_meshes.empty()) {
     _indexBuffer = _engine->createIndexBuffer(_indices, updatable);
   }
@@ -663,6 +666,7 @@ void Geometry::toLeftHanded()
 void Geometry::_resetPointsArrayCache()
 {
   _positions.clear();
+  _triangleBVHs.clear();
 }
 
 bool Geometry::_generatePointsArray()
@@ -686,6 +690,20 @@ bool Geometry::_generatePointsArray()
   return true;
 }
 
+TriangleBVH* Geometry::_getTriangleBVH(size_t indexStart, size_t indexCount)
+{
+  if (indexStart + indexCount > _indices.size() || !_generatePointsArray()) {
+    return nullptr;
+  }
+
+  auto& bvh = _triangleBVHs[{indexStart, indexCount}];
+  if (!bvh) {
+    bvh = std::make_unique<TriangleBVH>(_positions, _indices, indexStart, indexCount);
+  }
+
+  return bvh.get();
+}
+
 bool Geometry::isDisposed() const
 {
   return _isDisposed;
@@ -722,6 +740,7 @@ void Geometry::dispose()
   }
   _indexBuffer = nullptr;
   _indices.clear();
+  _triangleBVHs.clear();
 
   delayLoadState = Constants::DELAYLOADSTATE_NONE;
   delayLoadingFile.clear();
@@ -98,6 +98,11 @@ SkeletonPtr& InstancedMesh::get_skeleton()
   return _sourceMesh->skeleton();
 }
 
+BakedVertexAnimationManagerPtr& InstancedMesh::get_bakedVertexAnimationManager()
+{
+  return _sourceMesh->bakedVertexAnimationManager();
+}
+
 int InstancedMesh::get_renderingGroupId() const
 {
   return _sourceMesh->renderingGroupId;
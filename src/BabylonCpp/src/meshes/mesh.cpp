@@ -11,6 +11,7 @@
 #include <babylon/culling/bounding_sphere.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
+#include <babylon/instrumentation/profiler.h>
 #include <babylon/interfaces/igl_rendering_context.h>
 #include <babylon/layers/highlight_layer.h>
 #include <babylon/lights/light.h>
@@ -29,6 +30,7 @@
 #include <babylon/meshes/_instance_data_storage.h>
 #include <babylon/meshes/_instances_batch.h>
 #include <babylon/meshes/_internal_mesh_data_info.h>
+#include <babylon/meshes/_thin_instance_data_storage.h>
 #include <babylon/meshes/_visible_instances.h>
 #include <babylon/meshes/buffer.h>
 #include <babylon/meshes/builders/box_builder.h>
@@ -54,6 +56,7 @@
 #include <babylon/meshes/ground_mesh.h>
 #include <babylon/meshes/instanced_mesh.h>
 #include <babylon/meshes/mesh_lod_level.h>
+#include <babylon/meshes/simplification/simplification_queue.h>
 #include <babylon/meshes/vertex_buffer.h>
 #include <babylon/meshes/vertex_data.h>
 #include <babylon/misc/file_tools.h>
@@ -94,9 +97,11 @@ Mesh::Mesh(const std::string& iName, Scene* scene, Node* iParent, Mesh* source,
     , geometry{this, &Mesh::get_geometry}
     , areNormalsFrozen{this, &Mesh::get_areNormalsFrozen}
     , overridenInstanceCount{this, &Mesh::set_overridenInstanceCount}
+    , thinInstanceCount{this, &Mesh::get_thinInstanceCount, &Mesh::set_thinInstanceCount}
     , _internalMeshDataInfo{std::make_unique<_InternalMeshDataInfo>()}
     , _onBeforeDrawObserver{nullptr}
     , _instanceDataStorage{std::make_unique<_InstanceDataStorage>()}
+    , _thinInstanceDataStorage{std::make_unique<_ThinInstanceDataStorage>()}
     , _effectiveMaterial{nullptr}
     , _tessellation{0}
     , _arc{1.f}
@@ -613,7 +618,8 @@ bool Mesh::isReady(bool completeCheck, bool forceInstanceSupport)
   auto engine = getEngine();
   auto scene  = getScene();
   auto hardwareInstancedRendering
-    = forceInstanceSupport || (engine->getCaps().instancedArrays && !instances.empty());
+    = forceInstanceSupport
+      || (engine->getCaps().instancedArrays && (!instances.empty() || hasThinInstances()));
 
   computeWorldMatrix();
 
@@ -737,6 +743,13 @@ Mesh& Mesh::refreshBoundingInfo(bool applySkeleton)
 
   std::optional<Vector2> bias = geometry() ? geometry()->boundingBias() : std::nullopt;
   _refreshBoundingInfo(_getPositionData(applySkeleton), bias);
+
+  // The bounding info of the thin instances is based on the new bounding info of the mesh
+  if (_thinInstanceDataStorage->matrixBuffer) {
+    _thinInstanceDataStorage->hasBoundingVectors = false;
+    thinInstanceRefreshBoundingInfo(false);
+  }
+
   return *this;
 }
 
@@ -1088,10 +1101,12 @@ _InstancesBatchPtr Mesh::_getInstancesRenderList(size_t subMeshId, bool isReplac
     batchCache->hardwareInstancedRendering.resize(subMeshId + 1);
   }
 
+  // Thin instances are always drawn with hardware instancing, even without any InstancedMesh
   batchCache->hardwareInstancedRendering[subMeshId]
-    = !isReplacementMode && _instanceDataStorage->hardwareInstancedRendering
-      && (batchCache->visibleInstances.find(subMeshId) != batchCache->visibleInstances.end())
-      && (!batchCache->visibleInstances[subMeshId].empty());
+    = (!isReplacementMode && _instanceDataStorage->hardwareInstancedRendering
+       && (batchCache->visibleInstances.find(subMeshId) != batchCache->visibleInstances.end())
+       && (!batchCache->visibleInstances[subMeshId].empty()))
+      || (_instanceDataStorage->hardwareInstancedRendering && hasThinInstances());
   _instanceDataStorage->previousBatch = batchCache;
 
   return batchCache;
@@ -1201,7 +1216,10 @@ Mesh& Mesh::_processRendering(
   auto scene  = getScene();
   auto engine = scene->getEngine();
 
-  if (hardwareInstancedRendering) {
+  if (hardwareInstancedRendering && hasThinInstances()) {
+    _renderWithThinInstances(subMesh, static_cast<unsigned>(fillMode), effect, engine);
+  }
+  else if (hardwareInstancedRendering) {
     _renderWithInstances(subMesh, static_cast<unsigned>(fillMode), batch, effect, engine);
   }
   else {
@@ -1251,6 +1269,13 @@ void Mesh::_rebuild()
     _instanceDataStorage->instancesBuffer->dispose();
     _instanceDataStorage->instancesBuffer = nullptr;
   }
+  // Thin instance buffers keep their data and are simply recreated
+  if (_thinInstanceDataStorage->matrixBuffer) {
+    _thinInstanceDataStorage->matrixBuffer->_rebuild();
+  }
+  for (const auto& item : _thinInstanceDataStorage->userBuffers) {
+    item.second->_rebuild();
+  }
   AbstractMesh::_rebuild();
 }
 
@@ -1321,6 +1346,7 @@ Mesh& Mesh::render(SubMesh* subMesh, bool enableAlphaMode,
 
   // Material
   if (!instanceDataStorage.isFrozen || !_effectiveMaterial || _effectiveMaterial != iMaterial) {
+    BABYLON_PROFILE_ZONE("Material readiness");
     if (iMaterial->_storeEffectOnSubMeshes) {
       if (!iMaterial->isReadyForSubMesh(this, subMesh, hardwareInstancedRendering)) {
         return *this;
@@ -1725,6 +1751,21 @@ bool Mesh::isInFrustum(const std::array<Plane, 6>& frustumPlanes, unsigned int /
   return true;
 }
 
+bool Mesh::_isInFrustumFromCullingResult(bool boundingInfoInFrustum)
+{
+  if (delayLoadState == Constants::DELAYLOADSTATE_LOADING) {
+    return false;
+  }
+
+  if (!AbstractMesh::_isInFrustumFromCullingResult(boundingInfoInFrustum)) {
+    return false;
+  }
+
+  _checkDelayState();
+
+  return true;
+}
+
 Mesh& Mesh::setMaterialByID(const std::string& iId)
 {
   const auto& materials = getScene()->materials;
@@ -1896,6 +1937,7 @@ void Mesh::dispose(bool doNotRecurse, bool disposeMaterialAndTextures)
 
   // Instances
   _disposeInstanceSpecificData();
+  _disposeThinInstanceSpecificData();
 
   AbstractMesh::dispose(doNotRecurse, disposeMaterialAndTextures);
 }
@@ -2449,6 +2491,20 @@ void Mesh::optimizeIndices(const std::function<void(Mesh* mesh)>& successCallbac
   successCallback(nullptr);
 }
 
+Mesh& Mesh::simplify(const std::vector<ISimplificationSettings>& settings,
+                     bool parallelProcessing, SimplificationType simplificationType,
+                     const std::function<void()>& successCallback)
+{
+  ISimplificationTask task;
+  task.settings           = settings;
+  task.parallelProcessing = parallelProcessing;
+  task.mesh               = shared_from_base<Mesh>();
+  task.simplificationType = simplificationType;
+  task.successCallback    = successCallback;
+  getScene()->simplificationQueue()->addTask(task);
+  return *this;
+}
+
 void Mesh::minimizeVertices()
 {
   auto _pdata = getVerticesData(VertexBuffer::PositionKind);
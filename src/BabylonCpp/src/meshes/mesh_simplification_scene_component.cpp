@@ -32,8 +32,12 @@ void SimplicationQueueSceneComponent::dispose()
 
 void SimplicationQueueSceneComponent::_beforeCameraUpdate()
 {
-  if (scene->simplificationQueue() && !scene->simplificationQueue()->running) {
-    scene->simplificationQueue()->executeNext();
+  if (scene->simplificationQueue()) {
+    // Adds the levels decimated on the workers since the previous frame
+    scene->simplificationQueue()->update();
+    if (!scene->simplificationQueue()->running) {
+      scene->simplificationQueue()->executeNext();
+    }
   }
 }
 
@@ -2,13 +2,15 @@
 
 namespace BABYLON {
 
-DecimationTriangle::DecimationTriangle(
-  const std::vector<DecimationVertex>& iVertices)
-    : deleted{false}
+DecimationTriangle::DecimationTriangle(const std::array<int, 3>& iVertices,
+                                       const std::array<uint32_t, 3>& iOriginalOffsets,
+                                       size_t iSubMeshIndex)
+    : error{{0.0, 0.0, 0.0, 0.0}}
+    , deleted{false}
     , isDirty{false}
-    , borderFactor{0}
-    , deletePending{false}
     , vertices{iVertices}
+    , originalOffsets{iOriginalOffsets}
+    , subMeshIndex{iSubMeshIndex}
 {
 }
 
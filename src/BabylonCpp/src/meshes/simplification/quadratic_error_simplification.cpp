@@ -0,0 +1,551 @@
+#include <babylon/meshes/simplification/quadratic_error_simplification.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include <babylon/babylon_stl_util.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/simplification/decimation_triangle.h>
+#include <babylon/meshes/simplification/decimation_vertex.h>
+#include <babylon/meshes/simplification/isimplification_settings.h>
+#include <babylon/meshes/simplification/reference.h>
+#include <babylon/meshes/sub_mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+namespace BABYLON {
+
+namespace {
+
+using PositionKey = std::array<uint32_t, 3>;
+
+struct PositionKeyHash {
+  size_t operator()(const PositionKey& key) const
+  {
+    size_t hash = key[0];
+    hash        = hash * 31 + key[1];
+    return hash * 31 + key[2];
+  }
+}; // end of struct PositionKeyHash
+
+uint32_t FloatBits(float value)
+{
+  // Adding 0 turns -0 into +0
+  value += 0.f;
+  uint32_t bits = 0;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+} // end of anonymous namespace
+
+struct QuadraticErrorSimplification::DecimationState {
+  std::vector<DecimationVertex> vertices;
+  std::vector<DecimationTriangle> triangles;
+  std::vector<Reference> references;
+  // Vertices shared by source vertices with different attributes (uv seams,
+  // hard edges...), whose corners keep their own attributes
+  std::vector<bool> seams;
+  // Source vertex providing the attributes of the other vertices
+  std::vector<uint32_t> firstOffsets;
+}; // end of struct DecimationState
+
+QuadraticErrorSimplification::QuadraticErrorSimplification(const MeshPtr& mesh)
+    : decimationIterations{100}, aggressiveness{7.f}, _mesh{mesh}
+{
+  _positions = mesh->getVerticesData(VertexBuffer::PositionKind);
+  _indices   = mesh->getIndices();
+
+  const auto verticesCount = _positions.size() / 3;
+  if (verticesCount == 0) {
+    return;
+  }
+
+  // Every other attribute (normals, uvs, colors, skin weights...) is copied
+  // from the source vertices
+  for (const auto& kind : mesh->getVerticesDataKinds()) {
+    if (kind == VertexBuffer::PositionKind) {
+      continue;
+    }
+    auto data = mesh->getVerticesData(kind);
+    if (data.empty() || data.size() % verticesCount != 0) {
+      continue;
+    }
+    _strides[kind]    = data.size() / verticesCount;
+    _vertexData[kind] = std::move(data);
+  }
+
+  for (const auto& subMesh : mesh->subMeshes) {
+    _subMeshes.push_back({{subMesh->materialIndex, subMesh->indexStart,
+                           static_cast<uint32_t>(subMesh->indexCount)}});
+  }
+}
+
+QuadraticErrorSimplification::~QuadraticErrorSimplification() = default;
+
+void QuadraticErrorSimplification::simplify(
+  const ISimplificationSettings& settings,
+  const std::function<void(const MeshPtr& simplifiedMesh)>& successCallback)
+{
+  auto simplifiedMesh = createMesh(decimate(settings.quality));
+  if (successCallback) {
+    successCallback(simplifiedMesh);
+  }
+}
+
+QuadraticErrorSimplification::SimplifiedGeometry
+QuadraticErrorSimplification::decimate(float quality) const
+{
+  DecimationState state;
+  _initDecimatedMesh(state);
+
+  const auto trianglesCount = state.triangles.size();
+  const auto targetCount    = static_cast<size_t>(
+    std::ceil(static_cast<float>(trianglesCount) * std::clamp(quality, 0.f, 1.f)));
+
+  size_t deletedTriangles = 0;
+  std::vector<bool> deleted0, deleted1;
+  Vector3 point;
+
+  for (size_t iteration = 0; iteration < decimationIterations; ++iteration) {
+    if (trianglesCount - deletedTriangles <= targetCount) {
+      break;
+    }
+
+    if (iteration % 5 == 0) {
+      _updateMesh(state, iteration);
+    }
+
+    for (auto& triangle : state.triangles) {
+      triangle.isDirty = false;
+    }
+
+    // Collapses the edges whose error is below a threshold growing with the
+    // iterations
+    const auto threshold
+      = 0.000000001 * std::pow(static_cast<double>(iteration) + 3.0, aggressiveness);
+
+    for (auto& triangle : state.triangles) {
+      if (trianglesCount - deletedTriangles <= targetCount) {
+        break;
+      }
+
+      if (triangle.error[3] > threshold || triangle.deleted || triangle.isDirty) {
+        continue;
+      }
+
+      for (unsigned int j = 0; j < 3; ++j) {
+        if (triangle.error[j] >= threshold) {
+          continue;
+        }
+
+        const auto index0 = triangle.vertices[j];
+        const auto index1 = triangle.vertices[(j + 1) % 3];
+        auto& vertex0     = state.vertices[static_cast<size_t>(index0)];
+        auto& vertex1     = state.vertices[static_cast<size_t>(index1)];
+
+        if (vertex0.isBorder != vertex1.isBorder) {
+          continue;
+        }
+
+        _calculateError(vertex0, vertex1, point);
+
+        deleted0.assign(static_cast<size_t>(vertex0.triangleCount), false);
+        deleted1.assign(static_cast<size_t>(vertex1.triangleCount), false);
+
+        if (_isFlipped(state, vertex0, index1, point, deleted0)
+            || _isFlipped(state, vertex1, index0, point, deleted1)) {
+          continue;
+        }
+
+        vertex0.updatePosition(point);
+        vertex0.q.addInPlace(vertex1.q);
+
+        const auto triangleStart = state.references.size();
+        _updateTriangles(state, index0, vertex0, deleted0, deletedTriangles);
+        _updateTriangles(state, index0, vertex1, deleted1, deletedTriangles);
+        const auto triangleCount = state.references.size() - triangleStart;
+
+        // Reuses the references range of the vertex when it is large enough
+        if (triangleCount <= static_cast<size_t>(vertex0.triangleCount)) {
+          std::copy(state.references.begin() + static_cast<long>(triangleStart),
+                    state.references.end(),
+                    state.references.begin() + vertex0.triangleStart);
+          state.references.resize(triangleStart, Reference(0, 0));
+        }
+        else {
+          vertex0.triangleStart = static_cast<int>(triangleStart);
+        }
+        vertex0.triangleCount = static_cast<int>(triangleCount);
+
+        break;
+      }
+    }
+  }
+
+  return _reconstructGeometry(state);
+}
+
+MeshPtr QuadraticErrorSimplification::createMesh(const SimplifiedGeometry& geometry) const
+{
+  auto newMesh = Mesh::New(_mesh->name + "Decimated", _mesh->getScene());
+
+  newMesh->setVerticesData(VertexBuffer::PositionKind,
+                           geometry.vertexData.at(VertexBuffer::PositionKind), false, 3);
+  for (const auto& [kind, data] : geometry.vertexData) {
+    if (kind != VertexBuffer::PositionKind) {
+      newMesh->setVerticesData(kind, data, false, _strides.at(kind));
+    }
+  }
+  newMesh->setIndices(geometry.indices);
+
+  newMesh->releaseSubMeshes();
+  for (const auto& subMesh : geometry.subMeshes) {
+    if (subMesh[2] > 0) {
+      SubMesh::CreateFromIndices(subMesh[0], subMesh[1], subMesh[2], newMesh);
+    }
+  }
+
+  newMesh->material  = _mesh->material();
+  newMesh->parent    = _mesh->parent();
+  newMesh->skeleton  = _mesh->skeleton();
+  newMesh->isVisible = false;
+
+  return newMesh;
+}
+
+void QuadraticErrorSimplification::_initDecimatedMesh(DecimationState& state) const
+{
+  const auto verticesCount = _positions.size() / 3;
+
+  // The vertices sharing a position are welded, so that the uv seams and the
+  // hard edges do not split the mesh into separate parts
+  std::unordered_map<PositionKey, int, PositionKeyHash> welded;
+  welded.reserve(verticesCount);
+  std::vector<int> vertexIds(verticesCount);
+
+  for (size_t offset = 0; offset < verticesCount; ++offset) {
+    const auto position = Vector3::FromArray(_positions, static_cast<unsigned int>(offset * 3));
+    const PositionKey key{{FloatBits(position.x), FloatBits(position.y), FloatBits(position.z)}};
+
+    auto it = welded.find(key);
+    if (it == welded.end()) {
+      const auto id = static_cast<int>(state.vertices.size());
+      welded.emplace(key, id);
+      state.vertices.emplace_back(position, id);
+      state.seams.emplace_back(false);
+      state.firstOffsets.emplace_back(static_cast<uint32_t>(offset));
+      vertexIds[offset] = id;
+      continue;
+    }
+
+    const auto id     = static_cast<size_t>(it->second);
+    vertexIds[offset] = it->second;
+    for (const auto& [kind, data] : _vertexData) {
+      const auto stride = _strides.at(kind);
+      if (!std::equal(data.begin() + static_cast<long>(offset * stride),
+                      data.begin() + static_cast<long>((offset + 1) * stride),
+                      data.begin() + static_cast<long>(state.firstOffsets[id] * stride))) {
+        state.seams[id] = true;
+      }
+    }
+  }
+
+  for (size_t subMeshIndex = 0; subMeshIndex < _subMeshes.size(); ++subMeshIndex) {
+    const auto indexStart = _subMeshes[subMeshIndex][1];
+    const auto indexEnd   = std::min(static_cast<size_t>(indexStart + _subMeshes[subMeshIndex][2]),
+                                   _indices.size());
+    for (size_t index = indexStart; index + 2 < indexEnd; index += 3) {
+      const std::array<uint32_t, 3> offsets{{_indices[index], _indices[index + 1],
+                                             _indices[index + 2]}};
+      if (offsets[0] >= verticesCount || offsets[1] >= verticesCount
+          || offsets[2] >= verticesCount) {
+        continue;
+      }
+      const std::array<int, 3> ids{
+        {vertexIds[offsets[0]], vertexIds[offsets[1]], vertexIds[offsets[2]]}};
+      // Degenerated triangles are dropped
+      if (ids[0] == ids[1] || ids[1] == ids[2] || ids[2] == ids[0]) {
+        continue;
+      }
+      state.triangles.emplace_back(ids, offsets, subMeshIndex);
+    }
+  }
+}
+
+void QuadraticErrorSimplification::_updateMesh(DecimationState& state, size_t iteration) const
+{
+  auto& vertices   = state.vertices;
+  auto& triangles  = state.triangles;
+  auto& references = state.references;
+
+  if (iteration > 0) {
+    stl_util::erase_remove_if(triangles,
+                              [](const DecimationTriangle& triangle) { return triangle.deleted; });
+  }
+
+  // Init references
+  for (auto& vertex : vertices) {
+    vertex.triangleStart = 0;
+    vertex.triangleCount = 0;
+  }
+  for (const auto& triangle : triangles) {
+    for (auto id : triangle.vertices) {
+      ++vertices[static_cast<size_t>(id)].triangleCount;
+    }
+  }
+  int triangleStart = 0;
+  for (auto& vertex : vertices) {
+    vertex.triangleStart = triangleStart;
+    triangleStart += vertex.triangleCount;
+    vertex.triangleCount = 0;
+  }
+  references.assign(triangles.size() * 3, Reference(0, 0));
+  for (size_t i = 0; i < triangles.size(); ++i) {
+    for (int j = 0; j < 3; ++j) {
+      auto& vertex = vertices[static_cast<size_t>(triangles[i].vertices[j])];
+      references[static_cast<size_t>(vertex.triangleStart + vertex.triangleCount)]
+        = Reference(j, static_cast<int>(i));
+      ++vertex.triangleCount;
+    }
+  }
+
+  if (iteration > 0) {
+    return;
+  }
+
+  // Identify the borders: the vertices of the edges used by a single triangle
+  for (auto& vertex : vertices) {
+    vertex.isBorder = state.seams[static_cast<size_t>(vertex.id)];
+  }
+  std::vector<int> vertexCounts, vertexIds;
+  for (const auto& vertex : vertices) {
+    vertexCounts.clear();
+    vertexIds.clear();
+    for (int k = 0; k < vertex.triangleCount; ++k) {
+      const auto& reference = references[static_cast<size_t>(vertex.triangleStart + k)];
+      for (auto id : triangles[static_cast<size_t>(reference.triangleId)].vertices) {
+        auto it = std::find(vertexIds.begin(), vertexIds.end(), id);
+        if (it == vertexIds.end()) {
+          vertexIds.emplace_back(id);
+          vertexCounts.emplace_back(1);
+        }
+        else {
+          ++vertexCounts[static_cast<size_t>(it - vertexIds.begin())];
+        }
+      }
+    }
+    for (size_t j = 0; j < vertexIds.size(); ++j) {
+      if (vertexCounts[j] == 1) {
+        vertices[static_cast<size_t>(vertexIds[j])].isBorder = true;
+      }
+    }
+  }
+
+  // Init quadrics by plane and edge errors
+  for (auto& vertex : vertices) {
+    vertex.q = QuadraticMatrix();
+  }
+  for (auto& triangle : triangles) {
+    const auto& p0 = vertices[static_cast<size_t>(triangle.vertices[0])].position;
+    const auto& p1 = vertices[static_cast<size_t>(triangle.vertices[1])].position;
+    const auto& p2 = vertices[static_cast<size_t>(triangle.vertices[2])].position;
+    auto normal    = Vector3::Cross(p1.subtract(p0), p2.subtract(p0));
+    normal.normalize();
+    triangle.normal = normal;
+
+    const auto plane = QuadraticMatrix::DataFromNumbers(normal.x, normal.y, normal.z,
+                                                        -Vector3::Dot(normal, p0));
+    for (auto id : triangle.vertices) {
+      vertices[static_cast<size_t>(id)].q.addArrayInPlace(plane);
+    }
+  }
+  Vector3 point;
+  for (auto& triangle : triangles) {
+    for (unsigned int j = 0; j < 3; ++j) {
+      triangle.error[j]
+        = _calculateError(vertices[static_cast<size_t>(triangle.vertices[j])],
+                          vertices[static_cast<size_t>(triangle.vertices[(j + 1) % 3])], point);
+    }
+    triangle.error[3] = std::min({triangle.error[0], triangle.error[1], triangle.error[2]});
+  }
+}
+
+void QuadraticErrorSimplification::_updateTriangles(DecimationState& state, int origVertex,
+                                                    const DecimationVertex& vertex,
+                                                    const std::vector<bool>& deletedArray,
+                                                    size_t& deletedTriangles) const
+{
+  Vector3 point;
+  for (int k = 0; k < vertex.triangleCount; ++k) {
+    // Copied, as the references can be reallocated below
+    const auto reference = state.references[static_cast<size_t>(vertex.triangleStart + k)];
+    auto& triangle       = state.triangles[static_cast<size_t>(reference.triangleId)];
+    if (triangle.deleted) {
+      continue;
+    }
+
+    if (deletedArray[static_cast<size_t>(k)]) {
+      triangle.deleted = true;
+      ++deletedTriangles;
+      continue;
+    }
+
+    triangle.vertices[static_cast<size_t>(reference.vertexId)] = origVertex;
+    triangle.isDirty                                           = true;
+    for (unsigned int j = 0; j < 3; ++j) {
+      triangle.error[j]
+        = _calculateError(state.vertices[static_cast<size_t>(triangle.vertices[j])],
+                          state.vertices[static_cast<size_t>(triangle.vertices[(j + 1) % 3])],
+                          point);
+    }
+    triangle.error[3] = std::min({triangle.error[0], triangle.error[1], triangle.error[2]});
+    state.references.emplace_back(reference);
+  }
+}
+
+bool QuadraticErrorSimplification::_isFlipped(const DecimationState& state,
+                                              const DecimationVertex& vertex1, int index2,
+                                              const Vector3& point,
+                                              std::vector<bool>& deletedArray) const
+{
+  for (int k = 0; k < vertex1.triangleCount; ++k) {
+    const auto& reference = state.references[static_cast<size_t>(vertex1.triangleStart + k)];
+    const auto& triangle  = state.triangles[static_cast<size_t>(reference.triangleId)];
+    if (triangle.deleted) {
+      continue;
+    }
+
+    const auto s   = static_cast<size_t>(reference.vertexId);
+    const auto id1 = triangle.vertices[(s + 1) % 3];
+    const auto id2 = triangle.vertices[(s + 2) % 3];
+
+    // The triangle is removed by the collapse
+    if (id1 == index2 || id2 == index2) {
+      deletedArray[static_cast<size_t>(k)] = true;
+      continue;
+    }
+
+    auto d1 = state.vertices[static_cast<size_t>(id1)].position.subtract(point);
+    d1.normalize();
+    auto d2 = state.vertices[static_cast<size_t>(id2)].position.subtract(point);
+    d2.normalize();
+    if (std::abs(Vector3::Dot(d1, d2)) > 0.999f) {
+      return true;
+    }
+
+    auto normal = Vector3::Cross(d1, d2);
+    normal.normalize();
+    deletedArray[static_cast<size_t>(k)] = false;
+    if (Vector3::Dot(normal, triangle.normal) < 0.2f) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+double QuadraticErrorSimplification::_calculateError(const DecimationVertex& vertex1,
+                                                     const DecimationVertex& vertex2,
+                                                     Vector3& pointResult) const
+{
+  const auto q      = vertex1.q.add(vertex2.q);
+  const auto border = vertex1.isBorder && vertex2.isBorder;
+  const auto det    = q.det(0, 1, 2, 1, 4, 5, 2, 5, 7);
+
+  // Optimal position, if the quadric is invertible
+  if (det != 0.0 && !border) {
+    pointResult.x = static_cast<float>(-1.0 / det * q.det(1, 2, 3, 4, 5, 6, 5, 7, 8));
+    pointResult.y = static_cast<float>(1.0 / det * q.det(0, 2, 3, 1, 5, 6, 2, 7, 8));
+    pointResult.z = static_cast<float>(-1.0 / det * q.det(0, 1, 3, 1, 4, 6, 2, 5, 8));
+    return _vertexError(q, pointResult);
+  }
+
+  // Otherwise one of the ends (borders stay on their vertices) or the middle
+  const auto error1 = _vertexError(q, vertex1.position);
+  const auto error2 = _vertexError(q, vertex2.position);
+  auto error        = std::min(error1, error2);
+  pointResult.copyFrom(error1 <= error2 ? vertex1.position : vertex2.position);
+  if (!border) {
+    const auto middle = vertex1.position.add(vertex2.position).scale(0.5f);
+    const auto error3 = _vertexError(q, middle);
+    if (error3 < error) {
+      error = error3;
+      pointResult.copyFrom(middle);
+    }
+  }
+
+  return error;
+}
+
+double QuadraticErrorSimplification::_vertexError(const QuadraticMatrix& q,
+                                                  const Vector3& point) const
+{
+  const double x = point.x;
+  const double y = point.y;
+  const double z = point.z;
+  return q[0] * x * x + 2 * q[1] * x * y + 2 * q[2] * x * z + 2 * q[3] * x + q[4] * y * y
+         + 2 * q[5] * y * z + 2 * q[6] * y + q[7] * z * z + 2 * q[8] * z + q[9];
+}
+
+QuadraticErrorSimplification::SimplifiedGeometry
+QuadraticErrorSimplification::_reconstructGeometry(const DecimationState& state) const
+{
+  SimplifiedGeometry geometry;
+  geometry.originalTrianglesCount = _indices.size() / 3;
+
+  auto& positions = geometry.vertexData[VertexBuffer::PositionKind];
+  for (const auto& item : _vertexData) {
+    geometry.vertexData[item.first] = Float32Array();
+  }
+
+  // A vertex is created per pair of decimation vertex (position) and source
+  // vertex (attributes), and per submesh to keep their vertex ranges apart.
+  // Outside of the seams, all the corners of a vertex share its attributes
+  std::unordered_map<uint64_t, uint32_t> newIndices;
+  for (size_t subMeshIndex = 0; subMeshIndex < _subMeshes.size(); ++subMeshIndex) {
+    newIndices.clear();
+    const auto indexStart = static_cast<uint32_t>(geometry.indices.size());
+
+    for (const auto& triangle : state.triangles) {
+      if (triangle.deleted || triangle.subMeshIndex != subMeshIndex) {
+        continue;
+      }
+      for (unsigned int j = 0; j < 3; ++j) {
+        const auto id     = static_cast<size_t>(triangle.vertices[j]);
+        const auto offset
+          = state.seams[id] ? triangle.originalOffsets[j] : state.firstOffsets[id];
+        const auto key    = (static_cast<uint64_t>(id) << 32) | offset;
+
+        auto it = newIndices.find(key);
+        if (it != newIndices.end()) {
+          geometry.indices.emplace_back(it->second);
+          continue;
+        }
+
+        const auto newIndex = static_cast<uint32_t>(positions.size() / 3);
+        newIndices.emplace(key, newIndex);
+        geometry.indices.emplace_back(newIndex);
+
+        const auto& position = state.vertices[id].position;
+        stl_util::concat(positions, {position.x, position.y, position.z});
+        for (const auto& [kind, data] : _vertexData) {
+          const auto stride = _strides.at(kind);
+          auto& newData     = geometry.vertexData[kind];
+          newData.insert(newData.end(), data.begin() + static_cast<long>(offset * stride),
+                         data.begin() + static_cast<long>((offset + 1) * stride));
+        }
+      }
+    }
+
+    geometry.subMeshes.push_back({{_subMeshes[subMeshIndex][0], indexStart,
+                                   static_cast<uint32_t>(geometry.indices.size()) - indexStart}});
+  }
+
+  geometry.trianglesCount = geometry.indices.size() / 3;
+
+  return geometry;
+}
+
+} // end of namespace BABYLON
@@ -1,6 +1,10 @@
 #include <babylon/meshes/simplification/simplification_queue.h>
 
-#include <babylon/meshes/simplification/simplification_settings.h>
+#include <algorithm>
+
+#include <babylon/core/logging.h>
+#include <babylon/core/thread_pool.h>
+#include <babylon/meshes/mesh.h>
 
 namespace BABYLON {
 
@@ -18,8 +22,8 @@ void SimplificationQueue::addTask(const ISimplificationTask& task)
 void SimplificationQueue::executeNext()
 {
   if (!_simplificationQueue.empty()) {
-    running                         = true;
-    const ISimplificationTask& task = _simplificationQueue.front();
+    running   = true;
+    auto task = _simplificationQueue.front();
     _simplificationQueue.pop();
     runSimplification(task);
   }
@@ -28,18 +32,125 @@ void SimplificationQueue::executeNext()
   }
 }
 
-void SimplificationQueue::runSimplification(const ISimplificationTask& /*task*/)
+void SimplificationQueue::runSimplification(const ISimplificationTask& task)
+{
+  _runningTask = task;
+  _levels.clear();
+
+  if (!task.mesh || task.mesh->isDisposed() || task.mesh->getTotalIndices() == 0) {
+    _completeTask();
+    return;
+  }
+
+  // The geometry is copied here, the workers never access the mesh
+  _simplifier = getSimplifier(task);
+
+  // Sort the settings by quality, from the best one
+  auto settings = task.settings;
+  std::stable_sort(settings.begin(), settings.end(),
+                   [](const ISimplificationSettings& a, const ISimplificationSettings& b) {
+                     return a.quality > b.quality;
+                   });
+
+  for (const auto& setting : settings) {
+    auto level      = std::make_shared<SimplificationLevel>();
+    level->settings = setting;
+    _levels.emplace_back(level);
+  }
+
+  if (task.parallelProcessing) {
+    for (const auto& level : _levels) {
+      _startLevel(level);
+    }
+  }
+  else if (!_levels.empty()) {
+    _startLevel(_levels.front());
+  }
+
+  update();
+}
+
+void SimplificationQueue::update()
 {
+  if (!running || !_simplifier) {
+    return;
+  }
+
+  auto& mesh = _runningTask.mesh;
+  for (auto it = _levels.begin(); it != _levels.end();) {
+    auto& level = *it;
+    if (!level->started) {
+      ++it;
+      continue;
+    }
+    if (level->job.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+      ++it;
+      continue;
+    }
+
+    try {
+      level->job.get();
+      if (!mesh->isDisposed()) {
+        auto newMesh = _simplifier->createMesh(level->geometry);
+        mesh->addLODLevel(level->settings.distance, newMesh);
+        newMesh->isVisible = true;
+      }
+    }
+    catch (const std::exception& e) {
+      BABYLON_LOG_ERROR("SimplificationQueue", "Simplification of ", mesh->name,
+                        " failed: ", e.what())
+    }
+    it = _levels.erase(it);
+
+    // Sequential processing, starts the next level
+    if (!_runningTask.parallelProcessing && !_levels.empty()) {
+      _startLevel(_levels.front());
+    }
+  }
+
+  if (_levels.empty()) {
+    _completeTask();
+  }
 }
 
-ISimplifier* SimplificationQueue::getSimplifier(const ISimplificationTask& task)
+std::shared_ptr<QuadraticErrorSimplification>
+SimplificationQueue::getSimplifier(const ISimplificationTask& task) const
 {
   switch (task.simplificationType) {
     case SimplificationType::QUADRATIC:
     default:
-      // TODO FIXME
-      return nullptr;
-      // return new QuadraticErrorSimplification(task.mesh);
+      return std::make_shared<QuadraticErrorSimplification>(task.mesh);
+  }
+}
+
+void SimplificationQueue::_startLevel(const std::shared_ptr<SimplificationLevel>& level)
+{
+  if (level->started) {
+    return;
+  }
+
+  level->started = true;
+  // The job only keeps a weak reference on the level, as the level owns the
+  // future of the job
+  level->job = ThreadPool::Default().submit(
+    [simplifier = _simplifier, weakLevel = std::weak_ptr<SimplificationLevel>(level)]() {
+      if (auto pendingLevel = weakLevel.lock()) {
+        pendingLevel->geometry = simplifier->decimate(pendingLevel->settings.quality);
+      }
+    });
+}
+
+void SimplificationQueue::_completeTask()
+{
+  auto successCallback = _runningTask.successCallback;
+
+  _levels.clear();
+  _simplifier  = nullptr;
+  _runningTask = ISimplificationTask();
+  running      = false;
+
+  if (successCallback) {
+    successCallback();
   }
 }
 
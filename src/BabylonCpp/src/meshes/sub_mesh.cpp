@@ -4,6 +4,7 @@
 #include <babylon/collisions/intersection_info.h>
 #include <babylon/culling/bounding_info.h>
 #include <babylon/culling/ray.h>
+#include <babylon/culling/triangle_bvh.h>
 #include <babylon/engines/constants.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
@@ -298,6 +299,19 @@ SubMesh::intersects(Ray& ray, const std::vector<Vector3>& positions, const Uint3
       return _intersectUnIndexedTriangles(ray, positions, indices, fastCheck, trianglePredicate);
     }
 
+    // Large triangle lists are picked through the triangle BVH cached by the
+    // geometry. Skinned meshes are excluded as their points array is updated
+    // in place when the skeleton is applied on the CPU.
+    Geometry* geometry = _renderingMesh ? _renderingMesh->geometry() : nullptr;
+    if (step == 3 && geometry && _mesh->getScene()->useTriangleBVHForPicking
+        && &positions == &geometry->_positions && !_mesh->skeleton()
+        && indexCount / 3 >= TriangleBVH::MinTriangleCount
+        && indices.size() == geometry->_indices.size()) {
+      if (auto bvh = geometry->_getTriangleBVH(indexStart, indexCount)) {
+        return bvh->intersects(ray, positions, indices, fastCheck, trianglePredicate);
+      }
+    }
+
     return _intersectTriangles(ray, positions, indices, step, checkStopper, fastCheck,
                                trianglePredicate);
   }
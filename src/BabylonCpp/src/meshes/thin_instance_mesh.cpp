@@ -0,0 +1,498 @@
+#include <babylon/meshes/mesh.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+#include <babylon/babylon_stl_util.h>
+#include <babylon/core/logging.h>
+#include <babylon/culling/bounding_box.h>
+#include <babylon/culling/bounding_info.h>
+#include <babylon/engines/engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/_thin_instance_data_storage.h>
+#include <babylon/meshes/buffer.h>
+#include <babylon/meshes/sub_mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+namespace BABYLON {
+
+namespace {
+
+constexpr const char* MatrixKind = "matrix";
+constexpr size_t MatrixStride    = 16;
+
+/**
+ * @brief Extends a box with the local box of the mesh transformed by the
+ * matrices [start, end[ of a matrix buffer. Each transformed box is bounded by
+ * transforming its center and the absolute value of its extents, which is
+ * exact for affine matrices and avoids transforming the 8 corners.
+ */
+void ExtendBoundsWithInstances(const Float32Array& matrices, size_t start, size_t end,
+                               const Vector3& localMinimum, const Vector3& localMaximum,
+                               std::array<float, 3>& minimum, std::array<float, 3>& maximum)
+{
+  const std::array<float, 3> center{(localMinimum.x + localMaximum.x) * 0.5f,
+                                    (localMinimum.y + localMaximum.y) * 0.5f,
+                                    (localMinimum.z + localMaximum.z) * 0.5f};
+  const std::array<float, 3> extend{(localMaximum.x - localMinimum.x) * 0.5f,
+                                    (localMaximum.y - localMinimum.y) * 0.5f,
+                                    (localMaximum.z - localMinimum.z) * 0.5f};
+  for (size_t instance = start; instance < end; ++instance) {
+    // Row vector convention: the translation is stored in m[12], m[13], m[14]
+    const auto* m = matrices.data() + instance * MatrixStride;
+    for (unsigned int axis = 0; axis < 3; ++axis) {
+      const auto c = center[0] * m[axis] + center[1] * m[4 + axis] + center[2] * m[8 + axis]
+                     + m[12 + axis];
+      const auto e = extend[0] * std::abs(m[axis]) + extend[1] * std::abs(m[4 + axis])
+                     + extend[2] * std::abs(m[8 + axis]);
+      minimum[axis] = std::min(minimum[axis], c - e);
+      maximum[axis] = std::max(maximum[axis], c + e);
+    }
+  }
+}
+
+} // end of anonymous namespace
+
+bool Mesh::get_hasThinInstances() const
+{
+  return _thinInstanceDataStorage->instancesCount > 0;
+}
+
+size_t Mesh::get_thinInstanceCount() const
+{
+  return _thinInstanceDataStorage->instancesCount;
+}
+
+void Mesh::set_thinInstanceCount(size_t value)
+{
+  const auto& matrixBuffer = _thinInstanceDataStorage->matrixBuffer;
+  const auto numInstances  = matrixBuffer ? matrixBuffer->getData().size() / MatrixStride : 0;
+  if (value <= numInstances) {
+    _thinInstanceDataStorage->instancesCount = value;
+  }
+}
+
+size_t Mesh::thinInstanceAdd(const Matrix& matrix, bool refresh)
+{
+  auto& storage    = *_thinInstanceDataStorage;
+  const auto index = storage.instancesCount;
+
+  _thinInstanceUpdateBufferSize(MatrixKind, index + 1);
+  for (const auto& item : storage.userBuffers) {
+    _thinInstanceUpdateBufferSize(item.first, index + 1);
+  }
+
+  ++storage.instancesCount;
+  thinInstanceSetMatrixAt(index, matrix, refresh);
+
+  return index;
+}
+
+void Mesh::thinInstanceRegisterAttribute(const std::string& kind, size_t stride)
+{
+  if (kind == MatrixKind || stride == 0) {
+    BABYLON_LOG_ERROR("Mesh", "Invalid thin instance attribute ", kind)
+    return;
+  }
+
+  const auto& matrixBuffer = _thinInstanceDataStorage->matrixBuffer;
+  const auto numInstances  = matrixBuffer ? matrixBuffer->getData().size() / MatrixStride : 0;
+  _thinInstanceCreateBuffer(kind, Float32Array(std::max(numInstances, size_t(1)) * stride, 0.f),
+                            stride, false);
+}
+
+bool Mesh::thinInstanceSetMatrixAt(size_t index, const Matrix& matrix, bool refresh)
+{
+  auto& storage = *_thinInstanceDataStorage;
+  if (!storage.matrixBuffer || index >= storage.instancesCount) {
+    return false;
+  }
+
+  matrix.copyToArray(storage.matrixBuffer->getData(),
+                     static_cast<unsigned int>(index * MatrixStride));
+  _thinInstanceUpdateRange(MatrixKind, index, index + 1, refresh);
+
+  return true;
+}
+
+bool Mesh::thinInstanceSetAttributeAt(const std::string& kind, size_t index,
+                                      const Float32Array& value, bool refresh)
+{
+  const auto buffer = _thinInstanceGetBufferForKind(kind);
+  const auto stride = _thinInstanceGetStride(kind);
+  if (kind == MatrixKind || !buffer || value.size() < stride) {
+    return false;
+  }
+
+  // Custom attributes follow the capacity of the matrix buffer
+  _thinInstanceUpdateBufferSize(kind, index + 1);
+  auto& data = _thinInstanceGetBufferForKind(kind)->getData();
+  std::copy(value.begin(), value.begin() + static_cast<std::ptrdiff_t>(stride),
+            data.begin() + static_cast<std::ptrdiff_t>(index * stride));
+  _thinInstanceUpdateRange(kind, index, index + 1, refresh);
+
+  return true;
+}
+
+void Mesh::thinInstanceSetBuffer(const std::string& kind, Float32Array buffer, size_t stride,
+                                 bool staticBuffer)
+{
+  auto& storage = *_thinInstanceDataStorage;
+  if (kind == MatrixKind) {
+    stride = MatrixStride;
+  }
+  else if (stride == 0) {
+    BABYLON_LOG_ERROR("Mesh", "The stride of the thin instance attribute ", kind,
+                      " must be set")
+    return;
+  }
+
+  // An empty buffer removes the attribute
+  if (buffer.empty()) {
+    if (kind == MatrixKind) {
+      if (storage.matrixBuffer) {
+        for (const auto* worldKind : {VertexBuffer::World0Kind, VertexBuffer::World1Kind,
+                                      VertexBuffer::World2Kind, VertexBuffer::World3Kind}) {
+          removeVerticesData(worldKind);
+        }
+        storage.matrixBuffer->dispose();
+        storage.matrixBuffer = nullptr;
+      }
+      // Restores the bounding info of the mesh
+      auto& boundingInfo = getBoundingInfo();
+      if (storage.hasBoundingVectors && boundingInfo) {
+        boundingInfo->reConstruct(storage.boundingMinimum, storage.boundingMaximum);
+        _updateBoundingInfo();
+      }
+      storage.instancesCount     = 0;
+      storage.hasBoundingVectors = false;
+    }
+    else if (stl_util::contains(storage.userBuffers, kind)) {
+      removeVerticesData(kind);
+      storage.userBuffers[kind]->dispose();
+      storage.userBuffers.erase(kind);
+      storage.userStrides.erase(kind);
+    }
+    storage.bufferSizes.erase(kind);
+    storage.dirtyRanges.erase(kind);
+    return;
+  }
+
+  if (kind == MatrixKind) {
+    storage.instancesCount = buffer.size() / MatrixStride;
+  }
+
+  storage.dirtyRanges.erase(kind);
+  _thinInstanceCreateBuffer(kind, std::move(buffer), stride, staticBuffer);
+
+  if (kind == MatrixKind && !doNotSyncBoundingInfo) {
+    thinInstanceRefreshBoundingInfo(false);
+  }
+}
+
+Float32Array* Mesh::thinInstanceGetBuffer(const std::string& kind)
+{
+  const auto buffer = _thinInstanceGetBufferForKind(kind);
+  return buffer ? &buffer->getData() : nullptr;
+}
+
+void Mesh::thinInstanceBufferUpdated(const std::string& kind)
+{
+  const auto buffer = _thinInstanceGetBufferForKind(kind);
+  if (!buffer) {
+    return;
+  }
+
+  auto& storage = *_thinInstanceDataStorage;
+  storage.dirtyRanges.erase(kind);
+
+  const auto stride       = _thinInstanceGetStride(kind);
+  const auto numInstances = buffer->getData().size() / stride;
+  if (kind == MatrixKind && buffer->getData().size() != storage.bufferSizes[kind]) {
+    // The buffer was resized: all its instances are displayed, like with
+    // thinInstanceSetBuffer
+    storage.instancesCount = numInstances;
+  }
+
+  _thinInstanceUploadRange(kind, 0, numInstances);
+
+  if (kind == MatrixKind && !doNotSyncBoundingInfo) {
+    thinInstanceRefreshBoundingInfo(false);
+  }
+}
+
+void Mesh::thinInstancePartialBufferUpdate(const std::string& kind, const Float32Array& data,
+                                           size_t offset)
+{
+  const auto buffer = _thinInstanceGetBufferForKind(kind);
+  if (!buffer || data.empty()) {
+    return;
+  }
+
+  auto& bufferData = buffer->getData();
+  if (offset + data.size() > bufferData.size()) {
+    BABYLON_LOG_ERROR("Mesh", "Partial update of the thin instance attribute ", kind,
+                      " out of range")
+    return;
+  }
+
+  std::copy(data.begin(), data.end(), bufferData.begin() + static_cast<std::ptrdiff_t>(offset));
+
+  const auto stride = _thinInstanceGetStride(kind);
+  _thinInstanceUpdateRange(kind, offset / stride, (offset + data.size() + stride - 1) / stride,
+                           true);
+}
+
+void Mesh::thinInstanceRefreshBoundingInfo(bool forceRefreshParentInfo)
+{
+  auto& storage = *_thinInstanceDataStorage;
+  if (forceRefreshParentInfo) {
+    storage.hasBoundingVectors = false;
+    // Refreshes the bounding info of the thin instances as well
+    refreshBoundingInfo();
+    return;
+  }
+
+  auto& boundingInfo = getBoundingInfo();
+  if (!storage.matrixBuffer || !boundingInfo || storage.instancesCount == 0) {
+    return;
+  }
+
+  if (!storage.hasBoundingVectors) {
+    storage.boundingMinimum    = boundingInfo->boundingBox.minimum;
+    storage.boundingMaximum    = boundingInfo->boundingBox.maximum;
+    storage.hasBoundingVectors = true;
+  }
+
+  std::array<float, 3> minimum{
+    (std::numeric_limits<float>::max)(),
+    (std::numeric_limits<float>::max)(),
+    (std::numeric_limits<float>::max)(),
+  };
+  std::array<float, 3> maximum{
+    std::numeric_limits<float>::lowest(),
+    std::numeric_limits<float>::lowest(),
+    std::numeric_limits<float>::lowest(),
+  };
+  ExtendBoundsWithInstances(storage.matrixBuffer->getData(), 0, storage.instancesCount,
+                            storage.boundingMinimum, storage.boundingMaximum, minimum, maximum);
+
+  boundingInfo->reConstruct(Vector3(minimum[0], minimum[1], minimum[2]),
+                            Vector3(maximum[0], maximum[1], maximum[2]));
+  _updateBoundingInfo();
+}
+
+void Mesh::_renderWithThinInstances(SubMesh* subMesh, unsigned int fillMode,
+                                    const EffectPtr& effect, Engine* engine)
+{
+  auto& storage = *_thinInstanceDataStorage;
+
+  // Uploads the values set with refresh = false
+  while (!storage.dirtyRanges.empty()) {
+    const auto [kind, range] = *storage.dirtyRanges.begin();
+    _thinInstanceUpdateRange(kind, range.first, range.second, true);
+  }
+
+  const auto instancesCount = storage.instancesCount;
+
+  // Stats
+  getScene()->_activeIndices.addCount(subMesh->indexCount * instancesCount, false);
+
+  // Draw
+  _bind(subMesh, effect, fillMode);
+  _draw(subMesh, static_cast<int>(fillMode), instancesCount);
+
+  engine->unbindInstanceAttributes();
+}
+
+void Mesh::_disposeThinInstanceSpecificData()
+{
+  auto& storage = *_thinInstanceDataStorage;
+
+  if (storage.matrixBuffer) {
+    storage.matrixBuffer->dispose();
+    storage.matrixBuffer = nullptr;
+  }
+
+  for (const auto& item : storage.userBuffers) {
+    item.second->dispose();
+  }
+
+  storage.userBuffers.clear();
+  storage.userStrides.clear();
+  storage.bufferSizes.clear();
+  storage.dirtyRanges.clear();
+  storage.instancesCount     = 0;
+  storage.hasBoundingVectors = false;
+}
+
+BufferPtr Mesh::_thinInstanceGetBufferForKind(const std::string& kind) const
+{
+  const auto& storage = *_thinInstanceDataStorage;
+  if (kind == MatrixKind) {
+    return storage.matrixBuffer;
+  }
+
+  const auto it = storage.userBuffers.find(kind);
+  return it != storage.userBuffers.end() ? it->second : nullptr;
+}
+
+size_t Mesh::_thinInstanceGetStride(const std::string& kind) const
+{
+  if (kind == MatrixKind) {
+    return MatrixStride;
+  }
+
+  const auto& userStrides = _thinInstanceDataStorage->userStrides;
+  const auto it           = userStrides.find(kind);
+  return it != userStrides.end() ? it->second : 0;
+}
+
+void Mesh::_thinInstanceCreateBuffer(const std::string& kind, Float32Array data, size_t stride,
+                                     bool staticBuffer)
+{
+  auto& storage = *_thinInstanceDataStorage;
+
+  const auto previousBuffer = _thinInstanceGetBufferForKind(kind);
+  if (previousBuffer) {
+    previousBuffer->dispose();
+  }
+
+  const auto size = data.size();
+  auto buffer = std::make_shared<Buffer>(this, std::move(data), !staticBuffer, stride, false, true);
+
+  if (kind == MatrixKind) {
+    storage.matrixBuffer = buffer;
+    setVerticesBuffer(buffer->createVertexBuffer(VertexBuffer::World0Kind, 0, 4));
+    setVerticesBuffer(buffer->createVertexBuffer(VertexBuffer::World1Kind, 4, 4));
+    setVerticesBuffer(buffer->createVertexBuffer(VertexBuffer::World2Kind, 8, 4));
+    setVerticesBuffer(buffer->createVertexBuffer(VertexBuffer::World3Kind, 12, 4));
+  }
+  else {
+    storage.userBuffers[kind] = buffer;
+    storage.userStrides[kind] = stride;
+    setVerticesBuffer(buffer->createVertexBuffer(kind, 0, stride));
+  }
+
+  // The pending dirty range is kept: the new buffer already holds its values,
+  // but the bounding info may still have to be extended with them
+  storage.bufferSizes[kind] = size;
+}
+
+void Mesh::_thinInstanceUpdateBufferSize(const std::string& kind, size_t numInstances)
+{
+  const auto buffer = _thinInstanceGetBufferForKind(kind);
+  const auto stride = _thinInstanceGetStride(kind);
+  if (stride == 0) {
+    return;
+  }
+
+  const auto capacity = buffer ? buffer->getData().size() / stride : 0;
+  if (numInstances <= capacity) {
+    return;
+  }
+
+  // Doubles the capacity so that adding instances one at a time only
+  // reallocates the gpu buffer O(log n) times
+  const auto newCapacity = std::max(numInstances, capacity * 2);
+  Float32Array data(newCapacity * stride, 0.f);
+  if (buffer) {
+    const auto& previousData = buffer->getData();
+    std::copy(previousData.begin(), previousData.end(), data.begin());
+  }
+
+  _thinInstanceCreateBuffer(kind, std::move(data), stride, buffer && !buffer->isUpdatable());
+}
+
+void Mesh::_thinInstanceUpdateRange(const std::string& kind, size_t start, size_t end,
+                                    bool refresh)
+{
+  auto& dirtyRanges = _thinInstanceDataStorage->dirtyRanges;
+
+  const auto it = dirtyRanges.find(kind);
+  if (it != dirtyRanges.end()) {
+    start = std::min(start, it->second.first);
+    end   = std::max(end, it->second.second);
+  }
+
+  if (!refresh) {
+    dirtyRanges[kind] = {start, end};
+    return;
+  }
+
+  if (it != dirtyRanges.end()) {
+    dirtyRanges.erase(it);
+  }
+
+  _thinInstanceUploadRange(kind, start, end);
+
+  if (kind == MatrixKind && !doNotSyncBoundingInfo) {
+    _thinInstanceExtendBoundingInfo(start, end);
+  }
+}
+
+void Mesh::_thinInstanceUploadRange(const std::string& kind, size_t start, size_t end)
+{
+  const auto buffer = _thinInstanceGetBufferForKind(kind);
+  const auto stride = _thinInstanceGetStride(kind);
+  if (!buffer || start >= end) {
+    return;
+  }
+
+  auto& data = buffer->getData();
+  end        = std::min(end, data.size() / stride);
+
+  // Static buffers and buffers resized since their creation are recreated
+  if (!buffer->isUpdatable() || !buffer->getBuffer()
+      || data.size() != _thinInstanceDataStorage->bufferSizes[kind]) {
+    _thinInstanceCreateBuffer(kind, data, stride, !buffer->isUpdatable());
+    return;
+  }
+
+  auto engine = getEngine();
+  if (start == 0 && end * stride == data.size()) {
+    engine->updateDynamicVertexBuffer(buffer->getBuffer(), data);
+  }
+  else {
+    const Float32Array range(data.begin() + static_cast<std::ptrdiff_t>(start * stride),
+                             data.begin() + static_cast<std::ptrdiff_t>(end * stride));
+    engine->updateDynamicVertexBuffer(buffer->getBuffer(), range,
+                                      static_cast<int>(start * stride * sizeof(float)));
+  }
+}
+
+void Mesh::_thinInstanceExtendBoundingInfo(size_t start, size_t end)
+{
+  auto& storage      = *_thinInstanceDataStorage;
+  auto& boundingInfo = getBoundingInfo();
+  if (!storage.matrixBuffer || !boundingInfo) {
+    return;
+  }
+
+  // The first thin instances replace the bounding info of the mesh
+  if (!storage.hasBoundingVectors) {
+    thinInstanceRefreshBoundingInfo(false);
+    return;
+  }
+
+  end = std::min(end, storage.instancesCount);
+  if (start >= end) {
+    return;
+  }
+
+  const auto& boundingBox = boundingInfo->boundingBox;
+  std::array<float, 3> minimum{boundingBox.minimum.x, boundingBox.minimum.y,
+                               boundingBox.minimum.z};
+  std::array<float, 3> maximum{boundingBox.maximum.x, boundingBox.maximum.y,
+                               boundingBox.maximum.z};
+  ExtendBoundsWithInstances(storage.matrixBuffer->getData(), start, end, storage.boundingMinimum,
+                            storage.boundingMaximum, minimum, maximum);
+
+  boundingInfo->reConstruct(Vector3(minimum[0], minimum[1], minimum[2]),
+                            Vector3(maximum[0], maximum[1], maximum[2]));
+  _updateBoundingInfo();
+}
+
+} // end of namespace BABYLON
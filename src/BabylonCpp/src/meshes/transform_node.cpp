@@ -72,6 +72,7 @@ TransformNode::TransformNode(const std::string& iName, Scene* scene, bool isPure
     , _pivotMatrix{Matrix::Identity()}
     , _pivotMatrixInverse{nullptr}
     , _nonUniformScaling{false}
+    , _transformDirtyGeneration{0}
 {
 }
 
@@ -86,11 +87,12 @@ void TransformNode::addToScene(const TransformNodePtr& transformNode)
 
 TransformNodePtr TransformNode::_this() const
 {
-  const auto& transformNodes = getScene()->transformNodes;
-  auto it                    = std::find_if(
-    transformNodes.begin(), transformNodes.end(),
-    [this](const TransformNodePtr& transformNode) { return transformNode.get() == this; });
-  return (it != transformNodes.end()) ? (*it) : nullptr;
+  // Only the transform nodes of the scene are returned, their position is tracked
+  if (_indexInSceneTransformNodesArray < 0) {
+    return nullptr;
+  }
+  return std::static_pointer_cast<TransformNode>(
+    std::const_pointer_cast<Node>(shared_from_this()));
 }
 
 Type TransformNode::type() const
@@ -223,6 +225,8 @@ void TransformNode::set_infiniteDistance(bool value)
 
 Vector3& TransformNode::get_position()
 {
+  // The returned reference can be modified in place
+  _markAsTransformDirty();
   return _position;
 }
 
@@ -230,10 +234,12 @@ void TransformNode::set_position(const Vector3& newPosition)
 {
   _position = newPosition;
   _isDirty  = true;
+  _markAsTransformDirty();
 }
 
 Vector3& TransformNode::get_rotation()
 {
+  _markAsTransformDirty();
   return _rotation;
 }
 
@@ -242,10 +248,12 @@ void TransformNode::set_rotation(const Vector3& newRotation)
   _rotation           = newRotation;
   _rotationQuaternion = std::nullopt;
   _isDirty            = true;
+  _markAsTransformDirty();
 }
 
 Vector3& TransformNode::get_scaling()
 {
+  _markAsTransformDirty();
   return _scaling;
 }
 
@@ -253,10 +261,12 @@ void TransformNode::set_scaling(const Vector3& newScaling)
 {
   _scaling = newScaling;
   _isDirty = true;
+  _markAsTransformDirty();
 }
 
 std::optional<Quaternion>& TransformNode::get_rotationQuaternion()
 {
+  _markAsTransformDirty();
   return _rotationQuaternion;
 }
 
@@ -268,6 +278,7 @@ void TransformNode::set_rotationQuaternion(const std::optional<Quaternion>& quat
     _rotation.setAll(0.f);
   }
   _isDirty = true;
+  _markAsTransformDirty();
 }
 
 Vector3& TransformNode::get_forward()
@@ -369,9 +380,32 @@ TransformNode& TransformNode::markAsDirty(const std::string& /*property*/)
 {
   _currentRenderId = std::numeric_limits<int>::max();
   _isDirty         = true;
+  _markAsTransformDirty();
   return *this;
 }
 
+void TransformNode::_markAsTransformDirty()
+{
+  // The descendants stay queued until the scene applies the updates, so the
+  // hierarchy is only visited by the first change
+  const auto generation = getScene()->_meshesTreeGeneration;
+  if (_transformDirtyGeneration.exchange(generation) == generation) {
+    return;
+  }
+
+  for (const auto& child : _children) {
+    if (auto transformNode = dynamic_cast<TransformNode*>(child.get())) {
+      transformNode->_markAsTransformDirty();
+    }
+  }
+}
+
+void TransformNode::set_parent(Node* const& iParent)
+{
+  Node::set_parent(iParent);
+  _markAsTransformDirty();
+}
+
 Vector3& TransformNode::get_absolutePosition()
 {
   return _absolutePosition;
@@ -689,6 +723,7 @@ TransformNode& TransformNode::setParent(Node* node)
   position().copyFrom(*newPosition);
 
   Node::set_parent(node);
+  _markAsTransformDirty();
   return *this;
 }
 
@@ -711,6 +746,7 @@ TransformNode& TransformNode::attachToBone(Bone* bone, TransformNode* affectedTr
 {
   _transformToBoneReferal = affectedTransformNode;
   Node::set_parent(bone);
+  _markAsTransformDirty();
 
   if (bone->getWorldMatrix().determinant() < 0.f) {
     scalingDeterminant *= -1.f;
@@ -833,6 +869,15 @@ Node* TransformNode::_getEffectiveParent() const
   return parent();
 }
 
+bool TransformNode::_canComputeWorldMatrixConcurrently()
+{
+  // Billboards and infinite distance nodes read the camera state (and use
+  // shared caches), observers are user code
+  return _billboardMode == TransformNode::BILLBOARDMODE_NONE && !_infiniteDistance
+         && _transformToBoneReferal == nullptr
+         && !onAfterWorldMatrixUpdateObservable.hasObservers();
+}
+
 Matrix& TransformNode::computeWorldMatrix(bool force, bool /*useWasUpdatedFlag*/)
 {
   if (_isWorldMatrixFrozen && !_isDirty) {
@@ -910,7 +955,7 @@ Matrix& TransformNode::computeWorldMatrix(bool force, bool /*useWasUpdatedFlag*/
   auto& iRotation = cache.rotationQuaternion;
   if (_rotationQuaternion.has_value()) {
     if (reIntegrateRotationIntoRotationQuaternion) {
-      const auto len = rotation().lengthSquared();
+      const auto len = _rotation.lengthSquared();
       if (len != 0.f) {
         _rotationQuaternion->multiplyInPlace(
           Quaternion::RotationYawPitchRoll(_rotation.y, _rotation.x, _rotation.z));
@@ -1,5 +1,9 @@
 ﻿#include <babylon/meshes/vertex_buffer.h>
 
+#include <algorithm>
+#include <limits>
+
+#include <babylon/core/array_buffer_view.h>
 #include <babylon/core/data_view.h>
 #include <babylon/engines/engine.h>
 #include <babylon/meshes/buffer.h>
@@ -7,7 +11,7 @@
 
 namespace BABYLON {
 
-VertexBuffer::VertexBuffer(Engine* engine, const std::variant<Float32Array, Buffer*>& data,
+VertexBuffer::VertexBuffer(Engine* engine, std::variant<Float32Array, Buffer*> data,
                            const std::string& kind, bool updatable,
                            const std::optional<bool>& postponeInternalCreation,
                            std::optional<size_t> stride, const std::optional<bool>& instanced,
@@ -23,7 +27,7 @@ VertexBuffer::VertexBuffer(Engine* engine, const std::variant<Float32Array, Buff
   }
   else {
     _ownedBuffer = std::make_unique<Buffer>(
-      engine, std::get<Float32Array>(data), updatable, stride,
+      engine, std::move(std::get<Float32Array>(data)), updatable, stride,
       postponeInternalCreation.has_value() ? *postponeInternalCreation : false,
       instanced.has_value() ? *instanced : false);
     _buffer     = nullptr;
@@ -255,6 +259,86 @@ void VertexBuffer::ForEach(const std::variant<ArrayBuffer, DataView>& data, size
   }
 }
 
+namespace {
+
+template <typename T>
+float NormalizedValue(T value, bool normalized)
+{
+  if constexpr (std::is_integral<T>::value && sizeof(T) < 4) {
+    if (normalized) {
+      const auto maxValue = static_cast<float>(std::numeric_limits<T>::max());
+      return std::max(static_cast<float>(value) / maxValue, -1.f);
+    }
+  }
+  return static_cast<float>(value);
+}
+
+template <typename T>
+void ForEachValue(const ArrayBufferView& data, size_t byteOffset, size_t byteStride,
+                  size_t componentCount, size_t count, bool normalized,
+                  const std::function<void(float value, size_t index)>& callback)
+{
+  if (componentCount == 0 || count == 0) {
+    return;
+  }
+  const auto elementCount = count / componentCount;
+  if (byteStride == 0) {
+    byteStride = componentCount * sizeof(T);
+  }
+  // One strided view per component, the bounds are checked once when the views are created
+  std::vector<TypedArrayView<T>> components(componentCount);
+  for (size_t componentIndex = 0; componentIndex < componentCount; componentIndex++) {
+    components[componentIndex]
+      = data.typedView<T>(byteOffset + componentIndex * sizeof(T), elementCount, byteStride);
+  }
+  for (size_t elementIndex = 0, index = 0; elementIndex < elementCount; ++elementIndex) {
+    for (const auto& component : components) {
+      callback(NormalizedValue(component[elementIndex], normalized), index++);
+    }
+  }
+}
+
+} // end of anonymous namespace
+
+void VertexBuffer::ForEach(const ArrayBufferView& data, size_t byteOffset, size_t byteStride,
+                           size_t componentCount, unsigned int componentType, size_t count,
+                           bool normalized,
+                           const std::function<void(float value, size_t index)>& callback)
+{
+  switch (componentType) {
+    case VertexBuffer::BYTE:
+      ForEachValue<int8_t>(data, byteOffset, byteStride, componentCount, count, normalized,
+                           callback);
+      break;
+    case VertexBuffer::UNSIGNED_BYTE:
+      ForEachValue<uint8_t>(data, byteOffset, byteStride, componentCount, count, normalized,
+                            callback);
+      break;
+    case VertexBuffer::SHORT:
+      ForEachValue<int16_t>(data, byteOffset, byteStride, componentCount, count, normalized,
+                            callback);
+      break;
+    case VertexBuffer::UNSIGNED_SHORT:
+      ForEachValue<uint16_t>(data, byteOffset, byteStride, componentCount, count, normalized,
+                             callback);
+      break;
+    case VertexBuffer::INT:
+      ForEachValue<int32_t>(data, byteOffset, byteStride, componentCount, count, normalized,
+                            callback);
+      break;
+    case VertexBuffer::UNSIGNED_INT:
+      ForEachValue<uint32_t>(data, byteOffset, byteStride, componentCount, count, normalized,
+                             callback);
+      break;
+    case VertexBuffer::FLOAT:
+      ForEachValue<float>(data, byteOffset, byteStride, componentCount, count, normalized,
+                          callback);
+      break;
+    default:
+      throw std::runtime_error("Invalid component type " + std::to_string(componentType));
+  }
+}
+
 float VertexBuffer::_GetFloatValue(const DataView& dataView, unsigned int type, size_t byteOffset,
                                    bool normalized)
 {
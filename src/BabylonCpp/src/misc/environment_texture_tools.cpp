@@ -2,7 +2,6 @@
 
 #include <sstream>
 
-#include <babylon/babylon_stl_util.h>
 #include <babylon/core/array_buffer_view.h>
 #include <babylon/core/json_util.h>
 #include <babylon/core/logging.h>
@@ -36,8 +35,7 @@ EnvironmentTextureTools::~EnvironmentTextureTools() = default;
 
 EnvironmentTextureInfoPtr EnvironmentTextureTools::GetEnvInfo(const ArrayBufferView& data)
 {
-  const auto& dataView
-    = stl_util::to_array<int32_t>(data.buffer(), data.byteOffset, data.byteLength());
+  const auto dataView = data.typedView<uint8_t>();
   auto pos = 0ull;
 
   for (unsigned char magicByte : EnvironmentTextureTools::_MagicBytes) {
@@ -118,9 +116,11 @@ EnvironmentTextureTools::CreateImageDataArrayBufferViews(const ArrayBufferView&
     imageData[i] = std::vector<ArrayBuffer>(6);
     for (size_t face = 0; face < 6; ++face) {
       auto imageInfo     = specularInfo->mipmaps[i * 6 + face];
-      imageData[i][face] = stl_util::to_array<uint8_t>(
-        data.buffer(), data.byteOffset + *specularInfo->specularDataPosition + imageInfo.position,
-        imageInfo.length);
+      imageData[i][face]
+        = data
+            .typedView<uint8_t>(*specularInfo->specularDataPosition + imageInfo.position,
+                                imageInfo.length)
+            .toArray();
     }
   }
 
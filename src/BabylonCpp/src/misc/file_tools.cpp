@@ -362,11 +362,13 @@ void FileTools::LoadFile(
   };
 
   if (useArrayBuffer) {
-    auto onSuccessWrapper = [onSuccess](const ArrayBuffer& data) {
+    // The file is memory mapped: the view is passed without copying the data
+    auto onSuccessWrapper = [onSuccess](const ArrayBufferView& data) {
       if (onSuccess)
         onSuccess(data, dummyResponseUrl);
     };
-    asio::LoadAssetAsync_Binary(url_clean, onSuccessWrapper, onErrorWrapper, onProgressWrapper);
+    asio::LoadAssetAsync_MappedBinary(url_clean, onSuccessWrapper, onErrorWrapper,
+                                      onProgressWrapper);
   }
   else {
     auto onSuccessWrapper = [onSuccess](const std::string& data) {
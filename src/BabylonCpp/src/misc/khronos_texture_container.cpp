@@ -1,6 +1,5 @@
 #include <babylon/misc/khronos_texture_container.h>
 
-#include <babylon/babylon_stl_util.h>
 #include <babylon/core/data_view.h>
 #include <babylon/core/logging.h>
 #include <babylon/engines/engine.h>
@@ -25,7 +24,7 @@ KhronosTextureContainer::KhronosTextureContainer(const ArrayBufferView& iData, i
 
   // load the reset of the header in native 32 bit uint
   auto dataSize = sizeof(uint32_t); // Uint32Array.BYTES_PER_ELEMENT;
-  DataView headerDataView(data.uint8Array(), data.byteOffset + 12, 13 * dataSize);
+  DataView headerDataView(data.typedView<uint8_t>(12, 13 * dataSize).toArray());
   auto endianness   = headerDataView.getUint32(0, true);
   auto littleEndian = endianness == 0x04030201;
 
@@ -122,13 +121,12 @@ void KhronosTextureContainer::_upload2DCompressedLevels(const InternalTexturePtr
   auto mipmapCount = loadMipmaps ? numberOfMipmapLevels : 1;
   for (auto level = 0u; level < mipmapCount; ++level) {
     // size per face, since not supporting array cubemaps
-    auto imageSize
-      = stl_util::to_array<int32_t>(data.uint8Array(), data.byteOffset + dataOffset, 1)[0];
+    auto imageSize = data.typedView<int32_t>(dataOffset, 1)[0];
     dataOffset += 4; // image data starts from next multiple of 4 offset. Each
                      // face refers to same imagesize field above.
     for (unsigned int face = 0; face < numberOfFaces; face++) {
-      auto byteArray = stl_util::to_array<uint8_t>(data.uint8Array(), data.byteOffset + dataOffset,
-                                                   static_cast<size_t>(imageSize));
+      auto byteArray
+        = data.typedView<uint8_t>(dataOffset, static_cast<size_t>(imageSize)).toArray();
 
       auto engine = texture->getEngine();
       engine->_uploadCompressedDataToTextureDirectly(
@@ -148,7 +146,7 @@ bool KhronosTextureContainer::IsValid(const ArrayBufferView& data)
 {
   if (data.byteLength() >= 12) {
     // '«', 'K', 'T', 'X', ' ', '1', '1', '»', '\r', '\n', '\x1A', '\n'
-    const auto identifier = stl_util::to_array<uint8_t>(data.buffer(), data.byteOffset, 12);
+    const auto identifier = data.typedView<uint8_t>(0, 12);
     if (identifier[0] == 0xAB && identifier[1] == 0x4B && identifier[2] == 0x54
         && identifier[3] == 0x58 && identifier[4] == 0x20 && identifier[5] == 0x31
         && identifier[6] == 0x31 && identifier[7] == 0xBB && identifier[8] == 0x0D
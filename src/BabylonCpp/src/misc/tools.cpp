@@ -3,6 +3,7 @@
 #include <babylon/core/logging.h>
 #include <babylon/core/random.h>
 #include <babylon/engines/engine_store.h>
+#include <babylon/instrumentation/profiler.h>
 #include <babylon/interfaces/igl_rendering_context.h>
 #include <babylon/maths/color4.h>
 #include <babylon/maths/isize.h>
@@ -195,4 +196,24 @@ void Tools::DumpFramebuffer(int /*width*/, int /*height*/, Engine* /*engine*/)
 {
 }
 
+#ifdef BABYLON_ENABLE_PROFILER
+void Tools::StartPerformanceCounter(const std::string& counterName, bool condition)
+{
+  if (!condition) {
+    return;
+  }
+
+  Profiler::Default().beginZone(counterName);
+}
+
+void Tools::EndPerformanceCounter(const std::string& counterName, bool condition)
+{
+  if (!condition) {
+    return;
+  }
+
+  Profiler::Default().endZone(counterName);
+}
+#endif
+
 } // end of namespace BABYLON
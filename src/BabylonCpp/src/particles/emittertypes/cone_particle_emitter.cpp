@@ -71,7 +71,7 @@ void ConeParticleEmitter::startDirectionFunction(const Matrix& worldMatrix,
   }
   else {
     // measure the direction Vector from the emitter to the particle.
-    auto direction   = particle->position.subtract(worldMatrix.getTranslation()).normalize();
+    auto direction   = particle->position().subtract(worldMatrix.getTranslation()).normalize();
     const auto randX = Scalar::RandomRange(0.f, directionRandomizer);
     const auto randY = Scalar::RandomRange(0.f, directionRandomizer);
     const auto randZ = Scalar::RandomRange(0.f, directionRandomizer);
@@ -95,10 +95,10 @@ void ConeParticleEmitter::startPositionFunction(const Matrix& worldMatrix,
                                                 bool isLocal)
 {
   if (isLocal) {
-    TmpVectors::Vector3Array[0].copyFrom(particle->_localPosition.value_or(Vector3())).normalize();
+    TmpVectors::Vector3Array[0].copyFrom(particle->_localPosition().value_or(Vector3())).normalize();
   }
   else {
-    particle->position.subtractToRef(worldMatrix.getTranslation(), TmpVectors::Vector3Array[0])
+    particle->position().subtractToRef(worldMatrix.getTranslation(), TmpVectors::Vector3Array[0])
       .normalize();
   }
 
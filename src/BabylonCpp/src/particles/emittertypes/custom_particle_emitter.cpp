@@ -27,9 +27,9 @@ void CustomParticleEmitter::startDirectionFunction(const Matrix& worldMatrix,
 
     // Get direction
     auto& diffVector = TmpVectors::Vector3Array[1];
-    tmpVector.subtractToRef(particle->position, diffVector);
+    tmpVector.subtractToRef(particle->position(), diffVector);
 
-    diffVector.scaleToRef(1.f / particle->lifeTime, tmpVector);
+    diffVector.scaleToRef(1.f / particle->lifeTime(), tmpVector);
   }
   else {
     tmpVector.set(0.f, 0.f, 0.f);
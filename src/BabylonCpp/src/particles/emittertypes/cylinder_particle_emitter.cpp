@@ -23,7 +23,7 @@ void CylinderParticleEmitter::startDirectionFunction(const Matrix& worldMatrix,
                                                      Vector3& directionToUpdate, Particle* particle,
                                                      bool isLocal)
 {
-  auto direction = particle->position.subtract(worldMatrix.getTranslation()).normalize();
+  auto direction = particle->position().subtract(worldMatrix.getTranslation()).normalize();
   auto randY     = Scalar::RandomRange(-directionRandomizer / 2.f, directionRandomizer / 2.f);
 
   auto angle = std::atan2(direction.x, direction.z);
@@ -21,7 +21,7 @@ void HemisphericParticleEmitter::startDirectionFunction(const Matrix& worldMatri
                                                         Vector3& directionToUpdate,
                                                         Particle* particle, bool isLocal)
 {
-  auto direction = particle->position.subtract(worldMatrix.getTranslation()).normalize();
+  auto direction = particle->position().subtract(worldMatrix.getTranslation()).normalize();
   auto randX     = Scalar::RandomRange(0.f, directionRandomizer);
   auto randY     = Scalar::RandomRange(0.f, directionRandomizer);
   auto randZ     = Scalar::RandomRange(0.f, directionRandomizer);
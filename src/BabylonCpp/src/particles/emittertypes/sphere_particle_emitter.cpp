@@ -21,7 +21,7 @@ void SphereParticleEmitter::startDirectionFunction(const Matrix& worldMatrix,
                                                    Vector3& directionToUpdate, Particle* particle,
                                                    bool isLocal)
 {
-  auto direction   = particle->position.subtract(worldMatrix.getTranslation()).normalize();
+  auto direction   = particle->position().subtract(worldMatrix.getTranslation()).normalize();
   const auto randX = Scalar::RandomRange(0, directionRandomizer);
   const auto randY = Scalar::RandomRange(0, directionRandomizer);
   const auto randZ = Scalar::RandomRange(0, directionRandomizer);
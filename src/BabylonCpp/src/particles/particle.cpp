@@ -8,62 +8,14 @@
 
 namespace BABYLON {
 
-size_t Particle::_Count = 0;
-
-Particle::Particle(ParticleSystem* iParticleSystem)
-    : id{Particle::_Count++}
-    , position{Vector3::Zero()}
-    , direction{Vector3::Zero()}
-    , color{Color4(0.f, 0.f, 0.f, 0.f)}
-    , colorStep{Color4(0.f, 0.f, 0.f, 0.f)}
-    , lifeTime{1.f}
-    , age{0.f}
-    , size{0.f}
-    , scale{Vector2(1.f, 1.f)}
-    , angle{0.f}
-    , angularSpeed{0.f}
-    , cellIndex{0u}
-    , remapData{std::nullopt}
-    , _randomCellOffset{std::nullopt}
-    , _initialDirection{std::nullopt}
-    , _initialStartSpriteCellID{0}
-    , _initialEndSpriteCellID{0}
-    , _currentColorGradient{std::nullopt}
-    , _currentColor1{Color4(0.f, 0.f, 0.f, 0.f)}
-    , _currentColor2{Color4(0.f, 0.f, 0.f, 0.f)}
-    , _currentSizeGradient{std::nullopt}
-    , _currentSize1{0.f}
-    , _currentSize2{0.f}
-    , _currentAngularSpeedGradient{std::nullopt}
-    , _currentAngularSpeed1{0.f}
-    , _currentAngularSpeed2{0.f}
-    , _currentVelocityGradient{std::nullopt}
-    , _currentVelocity1{0.f}
-    , _currentVelocity2{0.f}
-    , _currentLimitVelocityGradient{std::nullopt}
-    , _currentLimitVelocity1{0.f}
-    , _currentLimitVelocity2{0.f}
-    , _currentDragGradient{std::nullopt}
-    , _currentDrag1{0.f}
-    , _currentDrag2{0.f}
-    , _randomNoiseCoordinates1{std::nullopt}
-    , _localPosition{std::nullopt}
-    , particleSystem{iParticleSystem}
-    , _currentFrameCounter{0u}
-{
-  if (!particleSystem->isAnimationSheetEnabled()) {
-    return;
-  }
-
-  updateCellInfoFromSystem();
+Particle::Particle(ParticleSystem* iParticleSystem, size_t index)
+    : particleSystem{iParticleSystem}, _store{&iParticleSystem->particleStore()}, _index{index}
+{
 }
 
 Particle::Particle(const Particle& other) = default;
 
-Particle::Particle(Particle&& other)
-{
-  *this = std::move(other);
-}
+Particle::Particle(Particle&& other) = default;
 
 Particle& Particle::operator=(const Particle& other) = default;
 
@@ -71,66 +23,212 @@ Particle& Particle::operator=(Particle&& other) = default;
 
 Particle::~Particle() = default;
 
-Particle* Particle::clone() const
+size_t Particle::index() const
+{
+  return _index;
+}
+
+size_t Particle::id() const
+{
+  return _store->states[_index].id;
+}
+
+Vector3 Particle::position() const
+{
+  return Vector3(_store->positionX[_index], _store->positionY[_index], _store->positionZ[_index]);
+}
+
+void Particle::setPosition(const Vector3& value)
+{
+  _store->positionX[_index] = value.x;
+  _store->positionY[_index] = value.y;
+  _store->positionZ[_index] = value.z;
+}
+
+Vector3 Particle::direction() const
+{
+  return Vector3(_store->directionX[_index], _store->directionY[_index],
+                 _store->directionZ[_index]);
+}
+
+void Particle::setDirection(const Vector3& value)
 {
-  return new Particle(*this);
+  _store->directionX[_index] = value.x;
+  _store->directionY[_index] = value.y;
+  _store->directionZ[_index] = value.z;
 }
 
-void Particle::updateCellInfoFromSystem()
+Color4 Particle::color() const
 {
-  cellIndex = particleSystem->startSpriteCellID;
+  return Color4(_store->colorR[_index], _store->colorG[_index], _store->colorB[_index],
+                _store->colorA[_index]);
+}
+
+void Particle::setColor(const Color4& value)
+{
+  _store->colorR[_index] = value.r;
+  _store->colorG[_index] = value.g;
+  _store->colorB[_index] = value.b;
+  _store->colorA[_index] = value.a;
+}
+
+Color4 Particle::colorStep() const
+{
+  return Color4(_store->colorStepR[_index], _store->colorStepG[_index],
+                _store->colorStepB[_index], _store->colorStepA[_index]);
+}
+
+void Particle::setColorStep(const Color4& value)
+{
+  _store->colorStepR[_index] = value.r;
+  _store->colorStepG[_index] = value.g;
+  _store->colorStepB[_index] = value.b;
+  _store->colorStepA[_index] = value.a;
+}
+
+float& Particle::lifeTime()
+{
+  return _store->lifeTime[_index];
+}
+
+float Particle::lifeTime() const
+{
+  return _store->lifeTime[_index];
+}
+
+float& Particle::age()
+{
+  return _store->age[_index];
+}
+
+float Particle::age() const
+{
+  return _store->age[_index];
+}
+
+float& Particle::size()
+{
+  return _store->sizes[_index];
+}
+
+float Particle::size() const
+{
+  return _store->sizes[_index];
+}
+
+Vector2 Particle::scale() const
+{
+  return Vector2(_store->scaleX[_index], _store->scaleY[_index]);
+}
+
+void Particle::setScale(const Vector2& value)
+{
+  _store->scaleX[_index] = value.x;
+  _store->scaleY[_index] = value.y;
+}
+
+float& Particle::angle()
+{
+  return _store->angle[_index];
+}
+
+float Particle::angle() const
+{
+  return _store->angle[_index];
+}
+
+float& Particle::angularSpeed()
+{
+  return _store->angularSpeed[_index];
+}
+
+float Particle::angularSpeed() const
+{
+  return _store->angularSpeed[_index];
+}
+
+unsigned int& Particle::cellIndex()
+{
+  return _store->cellIndex[_index];
+}
+
+unsigned int Particle::cellIndex() const
+{
+  return _store->cellIndex[_index];
+}
+
+std::optional<Vector4>& Particle::remapData()
+{
+  return _store->states[_index].remapData;
+}
+
+ParticleState& Particle::state()
+{
+  return _store->states[_index];
+}
+
+const ParticleState& Particle::state() const
+{
+  return _store->states[_index];
+}
+
+std::optional<Vector3>& Particle::_localPosition()
+{
+  return _store->states[_index]._localPosition;
 }
 
 void Particle::updateCellIndex()
 {
-  auto offsetAge   = age;
-  auto changeSpeed = particleSystem->spriteCellChangeSpeed;
+  auto& particleState = state();
+  auto offsetAge      = age();
+  auto changeSpeed    = particleSystem->spriteCellChangeSpeed;
 
   if (particleSystem->spriteRandomStartCell) {
-    if (!_randomCellOffset.has_value()) {
-      _randomCellOffset = Math::random() * lifeTime;
+    if (!particleState._randomCellOffset.has_value()) {
+      particleState._randomCellOffset = Math::random() * lifeTime();
     }
 
     if (changeSpeed == 0.f) { // Special case when speed = 0 meaning we want to
                               // stay on initial cell
       changeSpeed = 1.f;
-      offsetAge   = *_randomCellOffset;
+      offsetAge   = *particleState._randomCellOffset;
     }
     else {
-      offsetAge += *_randomCellOffset;
+      offsetAge += *particleState._randomCellOffset;
     }
   }
 
-  auto dist  = (_initialEndSpriteCellID - _initialStartSpriteCellID);
-  auto ratio = Scalar::Clamp(std::fmod((offsetAge * changeSpeed), lifeTime) / lifeTime);
+  auto dist  = (particleState._initialEndSpriteCellID - particleState._initialStartSpriteCellID);
+  auto ratio = Scalar::Clamp(std::fmod((offsetAge * changeSpeed), lifeTime()) / lifeTime());
 
-  cellIndex = static_cast<unsigned int>(_initialStartSpriteCellID + (ratio * dist));
+  cellIndex() = static_cast<unsigned int>(particleState._initialStartSpriteCellID + (ratio * dist));
 }
 
 void Particle::_inheritParticleInfoToSubEmitter(const SubEmitterPtr& subEmitter)
 {
+  const auto particlePosition = position();
   if (std::holds_alternative<AbstractMeshPtr>(subEmitter->particleSystem->emitter)) {
     auto emitterMesh = std::get<AbstractMeshPtr>(subEmitter->particleSystem->emitter);
-    emitterMesh->position().copyFrom(position);
+    emitterMesh->position().copyFrom(particlePosition);
     if (subEmitter->inheritDirection) {
       auto& temp = TmpVectors::Vector3Array[0];
-      direction.normalizeToRef(temp);
+      direction().normalizeToRef(temp);
       emitterMesh->setDirection(temp, 0.f, Math::PI_2);
     }
   }
   else if (std::holds_alternative<Vector3>(subEmitter->particleSystem->emitter)) {
     auto emitterPosition = std::get<Vector3>(subEmitter->particleSystem->emitter);
-    emitterPosition.copyFrom(position);
+    emitterPosition.copyFrom(particlePosition);
   }
   // Set inheritedVelocityOffset to be used when new particles are created
-  direction.scaleToRef(subEmitter->inheritedVelocityAmount / 2.f, TmpVectors::Vector3Array[0]);
+  direction().scaleToRef(subEmitter->inheritedVelocityAmount / 2.f, TmpVectors::Vector3Array[0]);
   subEmitter->particleSystem->_inheritedVelocityOffset.copyFrom(TmpVectors::Vector3Array[0]);
 }
 
 void Particle::_inheritParticleInfoToSubEmitters()
 {
-  if (!_attachedSubEmitters.empty()) {
-    for (const auto& subEmitter : _attachedSubEmitters) {
+  if (!state()._attachedSubEmitters.empty()) {
+    for (const auto& subEmitter : state()._attachedSubEmitters) {
       _inheritParticleInfoToSubEmitter(subEmitter);
     }
   }
@@ -138,106 +236,38 @@ void Particle::_inheritParticleInfoToSubEmitters()
 
 void Particle::_reset()
 {
-  age                           = 0.f;
-  id                            = Particle::_Count++;
-  _currentColorGradient         = std::nullopt;
-  _currentSizeGradient          = std::nullopt;
-  _currentAngularSpeedGradient  = std::nullopt;
-  _currentVelocityGradient      = std::nullopt;
-  _currentLimitVelocityGradient = std::nullopt;
-  _currentDragGradient          = std::nullopt;
-  cellIndex                     = particleSystem->startSpriteCellID;
-  _randomCellOffset             = std::nullopt;
+  auto& particleState                         = state();
+  age()                                       = 0.f;
+  particleState.id                            = ParticleStore::NextId();
+  particleState._currentColorGradient         = std::nullopt;
+  particleState._currentSizeGradient          = std::nullopt;
+  particleState._currentAngularSpeedGradient  = std::nullopt;
+  particleState._currentVelocityGradient      = std::nullopt;
+  particleState._currentLimitVelocityGradient = std::nullopt;
+  particleState._currentDragGradient          = std::nullopt;
+  cellIndex()                                 = particleSystem->startSpriteCellID;
+  particleState._randomCellOffset             = std::nullopt;
 }
 
 void Particle::copyTo(Particle& other)
 {
-  other.position.copyFrom(position);
-  if (_initialDirection) {
-    if (other._initialDirection) {
-      other._initialDirection = _initialDirection;
-    }
-    else {
-      other._initialDirection = _initialDirection;
-    }
-  }
-  else {
-    other._initialDirection = std::nullopt;
-  }
-  other.direction.copyFrom(direction);
-  if (_localPosition) {
-    if (other._localPosition) {
-      other._localPosition->copyFrom(*_localPosition);
-    }
-    else {
-      other._localPosition = _localPosition->copy();
-    }
-  }
-  other.color.copyFrom(color);
-  other.colorStep.copyFrom(colorStep);
-  other.lifeTime          = lifeTime;
-  other.age               = age;
-  other._randomCellOffset = _randomCellOffset;
-  other.size              = size;
-  other.scale.copyFrom(scale);
-  other.angle                = angle;
-  other.angularSpeed         = angularSpeed;
-  other.particleSystem       = particleSystem;
-  other.cellIndex            = cellIndex;
-  other.id                   = id;
-  other._attachedSubEmitters = _attachedSubEmitters;
-  if (_currentColorGradient) {
-    other._currentColorGradient = _currentColorGradient;
-    other._currentColor1.copyFrom(_currentColor1);
-    other._currentColor2.copyFrom(_currentColor2);
-  }
-  if (_currentSizeGradient) {
-    other._currentSizeGradient = _currentSizeGradient;
-    other._currentSize1        = _currentSize1;
-    other._currentSize2        = _currentSize2;
-  }
-  if (_currentAngularSpeedGradient) {
-    other._currentAngularSpeedGradient = _currentAngularSpeedGradient;
-    other._currentAngularSpeed1        = _currentAngularSpeed1;
-    other._currentAngularSpeed2        = _currentAngularSpeed2;
-  }
-  if (_currentVelocityGradient) {
-    other._currentVelocityGradient = _currentVelocityGradient;
-    other._currentVelocity1        = _currentVelocity1;
-    other._currentVelocity2        = _currentVelocity2;
-  }
-  if (_currentLimitVelocityGradient) {
-    other._currentLimitVelocityGradient = _currentLimitVelocityGradient;
-    other._currentLimitVelocity1        = _currentLimitVelocity1;
-    other._currentLimitVelocity2        = _currentLimitVelocity2;
-  }
-  if (_currentDragGradient) {
-    other._currentDragGradient = _currentDragGradient;
-    other._currentDrag1        = _currentDrag1;
-    other._currentDrag2        = _currentDrag2;
-  }
-  if (particleSystem->isAnimationSheetEnabled) {
-    other._initialStartSpriteCellID = _initialStartSpriteCellID;
-    other._initialEndSpriteCellID   = _initialEndSpriteCellID;
-  }
-  if (particleSystem->useRampGradients) {
-    if (other.remapData && remapData) {
-      other.remapData->copyFrom(*remapData);
-    }
-    else {
-      other.remapData = Vector4(0.f, 0.f, 0.f, 0.f);
-    }
-  }
-  if (_randomNoiseCoordinates1) {
-    if (other._randomNoiseCoordinates1) {
-      other._randomNoiseCoordinates1->copyFrom(*_randomNoiseCoordinates1);
-      other._randomNoiseCoordinates2.copyFrom(_randomNoiseCoordinates2);
-    }
-    else {
-      other._randomNoiseCoordinates1 = _randomNoiseCoordinates1;
-      other._randomNoiseCoordinates2 = _randomNoiseCoordinates2;
-    }
+  if (other._store == _store) {
+    _store->copy(_index, other._index);
+    return;
   }
+
+  other.setPosition(position());
+  other.setDirection(direction());
+  other.setColor(color());
+  other.setColorStep(colorStep());
+  other.setScale(scale());
+  other.lifeTime()     = lifeTime();
+  other.age()          = age();
+  other.size()         = size();
+  other.angle()        = angle();
+  other.angularSpeed() = angularSpeed();
+  other.cellIndex()    = cellIndex();
+  other.state()        = state();
 }
 
 } // end of namespace BABYLON
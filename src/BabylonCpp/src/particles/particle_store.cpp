@@ -0,0 +1,105 @@
+#include <babylon/particles/particle_store.h>
+
+#include <babylon/particles/sub_emitter.h>
+
+namespace BABYLON {
+
+namespace {
+
+/**
+ * @brief Float arrays of the store with the value of a new particle.
+ */
+struct FloatArray {
+  Float32Array ParticleStore::*array;
+  float defaultValue;
+};
+
+const FloatArray floatArrays[] = {
+  {&ParticleStore::positionX, 0.f},  {&ParticleStore::positionY, 0.f},
+  {&ParticleStore::positionZ, 0.f},  {&ParticleStore::directionX, 0.f},
+  {&ParticleStore::directionY, 0.f}, {&ParticleStore::directionZ, 0.f},
+  {&ParticleStore::colorR, 0.f},     {&ParticleStore::colorG, 0.f},
+  {&ParticleStore::colorB, 0.f},     {&ParticleStore::colorA, 0.f},
+  {&ParticleStore::colorStepR, 0.f}, {&ParticleStore::colorStepG, 0.f},
+  {&ParticleStore::colorStepB, 0.f}, {&ParticleStore::colorStepA, 0.f},
+  {&ParticleStore::lifeTime, 1.f},   {&ParticleStore::age, 0.f},
+  {&ParticleStore::sizes, 0.f},      {&ParticleStore::scaleX, 1.f},
+  {&ParticleStore::scaleY, 1.f},     {&ParticleStore::angle, 0.f},
+  {&ParticleStore::angularSpeed, 0.f},
+};
+
+} // end of anonymous namespace
+
+size_t ParticleStore::_Count = 0;
+
+ParticleStore::ParticleStore() = default;
+
+ParticleStore::~ParticleStore() = default;
+
+size_t ParticleStore::NextId()
+{
+  return ParticleStore::_Count++;
+}
+
+void ParticleStore::reserve(size_t capacity)
+{
+  for (const auto& floatArray : floatArrays) {
+    (this->*floatArray.array).reserve(capacity);
+  }
+  cellIndex.reserve(capacity);
+  states.reserve(capacity);
+}
+
+size_t ParticleStore::add(unsigned int iCellIndex)
+{
+  const auto index = size();
+  for (const auto& floatArray : floatArrays) {
+    (this->*floatArray.array).emplace_back(floatArray.defaultValue);
+  }
+  cellIndex.emplace_back(iCellIndex);
+  states.emplace_back();
+  states.back().id = ParticleStore::NextId();
+  return index;
+}
+
+void ParticleStore::swapRemove(size_t index)
+{
+  const auto last = size() - 1;
+  if (index != last) {
+    for (const auto& floatArray : floatArrays) {
+      auto& values  = this->*floatArray.array;
+      values[index] = values[last];
+    }
+    cellIndex[index] = cellIndex[last];
+    states[index]    = std::move(states[last]);
+  }
+  for (const auto& floatArray : floatArrays) {
+    (this->*floatArray.array).pop_back();
+  }
+  cellIndex.pop_back();
+  states.pop_back();
+}
+
+void ParticleStore::copy(size_t from, size_t to)
+{
+  if (from == to) {
+    return;
+  }
+  for (const auto& floatArray : floatArrays) {
+    auto& values = this->*floatArray.array;
+    values[to]   = values[from];
+  }
+  cellIndex[to] = cellIndex[from];
+  states[to]    = states[from];
+}
+
+void ParticleStore::clear()
+{
+  for (const auto& floatArray : floatArrays) {
+    (this->*floatArray.array).clear();
+  }
+  cellIndex.clear();
+  states.clear();
+}
+
+} // end of namespace BABYLON
@@ -48,21 +48,18 @@ ParticleSystem::ParticleSystem(const std::string& iName, size_t capacity, Scene*
     , _currentStartSize1{0.f}
     , _currentStartSize2{0.f}
     , _disposeEmitterOnDispose{false}
-    , _newPartsExcess{0}
-    , _scaledColorStep{Color4(0.f, 0.f, 0.f, 0.f)}
+    , _newPartsExcess{0.f}
     , _colorDiff{Color4(0.f, 0.f, 0.f, 0.f)}
-    , _scaledDirection{Vector3::Zero()}
-    , _scaledGravity{Vector3::Zero()}
     , _currentRenderId{-1}
     , _useInstancing{false}
     , _started{false}
     , _stopped{false}
-    , _actualFrame{0}
+    , _actualFrame{0.f}
+    , _scaledUpdateSpeed{0.f}
     , _vertexBufferSize{11u}
     , _rawTextureWidth{256}
     , _rampGradientsTexture{nullptr}
     , _useRampGradients{false}
-    , _appendParticleVertexes{nullptr}
     , _rootParticleSystem{nullptr}
     , _zeroVector3{Vector3::Zero()}
 {
@@ -91,242 +88,8 @@ ParticleSystem::ParticleSystem(const std::string& iName, size_t capacity, Scene*
   // Default emitter type
   particleEmitterType = std::make_unique<BoxParticleEmitter>();
 
-  // Update
-  updateFunction = [this](std::vector<Particle*>& particles) {
-    std::optional<ISize> noiseTextureSize = std::nullopt;
-    std::optional<Uint8Array> noiseTextureData;
-
-    if (noiseTexture()) { // We need to get texture data back to CPU
-      noiseTextureSize = noiseTexture()->getSize();
-      noiseTextureData = noiseTexture()->getContent().uint8Array();
-    }
-
-    for (unsigned int index = 0; index < _particles.size(); ++index) {
-      auto particle          = particles[index];
-      auto scaledUpdateSpeed = static_cast<float>(_scaledUpdateSpeed);
-      auto previousAge       = particle->age;
-      particle->age += scaledUpdateSpeed;
-
-      // Evaluate step to death
-      if (particle->age > particle->lifeTime) {
-        auto diff    = particle->age - previousAge;
-        auto oldDiff = particle->lifeTime - previousAge;
-
-        scaledUpdateSpeed = (oldDiff * scaledUpdateSpeed) / diff;
-
-        particle->age = particle->lifeTime;
-      }
-
-      auto ratio = particle->age / particle->lifeTime;
-
-      // Color
-      if (!_colorGradients.empty()) {
-        GradientHelper::GetCurrentGradient<ColorGradient>(
-          ratio, _colorGradients,
-          [&](const ColorGradient& currentGradient, const ColorGradient& nextGradient,
-              float scale) {
-            if (currentGradient != *particle->_currentColorGradient) {
-              particle->_currentColor1.copyFrom(particle->_currentColor2);
-              const_cast<ColorGradient&>(nextGradient).getColorToRef(particle->_currentColor2);
-              particle->_currentColorGradient = const_cast<ColorGradient&>(currentGradient);
-            }
-            Color4::LerpToRef(particle->_currentColor1, particle->_currentColor2, scale,
-                              particle->color);
-          });
-      }
-      else {
-        particle->colorStep.scaleToRef(scaledUpdateSpeed, _scaledColorStep);
-        particle->color.addInPlace(_scaledColorStep);
-
-        if (particle->color.a < 0.f) {
-          particle->color.a = 0.f;
-        }
-      }
-
-      // Angular speed
-      if (!_angularSpeedGradients.empty()) {
-        GradientHelper::GetCurrentGradient<FactorGradient>(
-          ratio, _angularSpeedGradients,
-          [&](const FactorGradient& currentGradient, const FactorGradient& nextGradient,
-              float scale) {
-            if (currentGradient != particle->_currentAngularSpeedGradient) {
-              particle->_currentAngularSpeed1        = particle->_currentAngularSpeed2;
-              particle->_currentAngularSpeed2        = nextGradient.getFactor();
-              particle->_currentAngularSpeedGradient = currentGradient;
-            }
-            particle->angularSpeed = Scalar::Lerp(particle->_currentAngularSpeed1,
-                                                  particle->_currentAngularSpeed2, scale);
-          });
-      }
-      particle->angle += particle->angularSpeed * scaledUpdateSpeed;
-
-      // Direction
-      auto directionScale = scaledUpdateSpeed;
-
-      // Velocity
-      if (!_velocityGradients.empty()) {
-        GradientHelper::GetCurrentGradient<FactorGradient>(
-          ratio, _velocityGradients,
-          [&](const FactorGradient& currentGradient, const FactorGradient& nextGradient,
-              float scale) {
-            if (currentGradient != particle->_currentVelocityGradient) {
-              particle->_currentVelocity1        = particle->_currentVelocity2;
-              particle->_currentVelocity2        = nextGradient.getFactor();
-              particle->_currentVelocityGradient = currentGradient;
-            }
-            directionScale
-              *= Scalar::Lerp(particle->_currentVelocity1, particle->_currentVelocity2, scale);
-          });
-      }
-      particle->direction.scaleToRef(directionScale, _scaledDirection);
-
-      // Limit velocity
-      if (!_limitVelocityGradients.empty()) {
-        GradientHelper::GetCurrentGradient<FactorGradient>(
-          ratio, _limitVelocityGradients,
-          [&](const FactorGradient& currentGradient, const FactorGradient& nextGradient,
-              float scale) {
-            if (currentGradient != particle->_currentLimitVelocityGradient) {
-              particle->_currentLimitVelocity1        = particle->_currentLimitVelocity2;
-              particle->_currentLimitVelocity2        = nextGradient.getFactor();
-              particle->_currentLimitVelocityGradient = currentGradient;
-            }
-
-            auto limitVelocity   = Scalar::Lerp(particle->_currentLimitVelocity1,
-                                              particle->_currentLimitVelocity2, scale);
-            auto currentVelocity = particle->direction.length();
-
-            if (currentVelocity > limitVelocity) {
-              particle->direction.scaleInPlace(limitVelocityDamping);
-            }
-          });
-      }
-
-      /// Drag
-      if (!_dragGradients.empty()) {
-        GradientHelper::GetCurrentGradient<FactorGradient>(
-          ratio, _dragGradients,
-          [&](const FactorGradient& currentGradient, const FactorGradient& nextGradient,
-              float scale) {
-            if (currentGradient != particle->_currentDragGradient) {
-              particle->_currentDrag1        = particle->_currentDrag2;
-              particle->_currentDrag2        = nextGradient.getFactor();
-              particle->_currentDragGradient = currentGradient;
-            }
-
-            auto drag = Scalar::Lerp(particle->_currentDrag1, particle->_currentDrag2, scale);
-
-            _scaledDirection.scaleInPlace(1.f - drag);
-          });
-      }
-
-      if (isLocal && particle->_localPosition) {
-        particle->_localPosition->addInPlace(_scaledDirection);
-        Vector3::TransformCoordinatesToRef(*particle->_localPosition, _emitterWorldMatrix,
-                                           particle->position);
-      }
-      else {
-        particle->position.addInPlace(_scaledDirection);
-      }
-
-      // Noise
-      if (noiseTextureData && noiseTextureSize && particle->_randomNoiseCoordinates1.has_value()) {
-        auto fetchedColorR
-          = _fetchR(particle->_randomNoiseCoordinates1->x, particle->_randomNoiseCoordinates1->y,
-                    static_cast<float>(noiseTextureSize->width),
-                    static_cast<float>(noiseTextureSize->height), *noiseTextureData);
-        auto fetchedColorG
-          = _fetchR(particle->_randomNoiseCoordinates1->z, particle->_randomNoiseCoordinates2.x,
-                    static_cast<float>(noiseTextureSize->width),
-                    static_cast<float>(noiseTextureSize->height), *noiseTextureData);
-        auto fetchedColorB
-          = _fetchR(particle->_randomNoiseCoordinates2.y, particle->_randomNoiseCoordinates2.z,
-                    static_cast<float>(noiseTextureSize->width),
-                    static_cast<float>(noiseTextureSize->height), *noiseTextureData);
-
-        auto& force       = TmpVectors::Vector3Array[0];
-        auto& scaledForce = TmpVectors::Vector3Array[1];
-
-        force.copyFromFloats((2.f * fetchedColorR - 1.f) * noiseStrength.x,
-                             (2.f * fetchedColorG - 1.f) * noiseStrength.y,
-                             (2.f * fetchedColorB - 1.f) * noiseStrength.z);
-
-        force.scaleToRef(scaledUpdateSpeed, scaledForce);
-        particle->direction.addInPlace(scaledForce);
-      }
-
-      // Gravity
-      gravity.scaleToRef(scaledUpdateSpeed, _scaledGravity);
-      particle->direction.addInPlace(_scaledGravity);
-
-      // Size
-      if (!_sizeGradients.empty()) {
-        GradientHelper::GetCurrentGradient<FactorGradient>(
-          ratio, _sizeGradients,
-          [&](const FactorGradient& currentGradient, const FactorGradient& nextGradient,
-              float scale) {
-            if (currentGradient != particle->_currentSizeGradient) {
-              particle->_currentSize1        = particle->_currentSize2;
-              particle->_currentSize2        = nextGradient.getFactor();
-              particle->_currentSizeGradient = currentGradient;
-            }
-            particle->size = Scalar::Lerp(particle->_currentSize1, particle->_currentSize2, scale);
-          });
-      }
-
-      // Remap data
-      if (_useRampGradients) {
-        if (!_colorRemapGradients.empty()) {
-          GradientHelper::GetCurrentGradient<FactorGradient>(
-            ratio, _colorRemapGradients,
-            [&](const FactorGradient& currentGradient, const FactorGradient& nextGradient,
-                float scale) {
-              auto min = Scalar::Lerp(currentGradient.factor1, nextGradient.factor1, scale);
-              auto max = Scalar::Lerp(*currentGradient.factor2, *nextGradient.factor2, scale);
-
-              particle->remapData->x = min;
-              particle->remapData->y = max - min;
-            });
-        }
-
-        if (!_alphaRemapGradients.empty()) {
-          GradientHelper::GetCurrentGradient<FactorGradient>(
-            ratio, _alphaRemapGradients,
-            [&](const FactorGradient& currentGradient, const FactorGradient& nextGradient,
-                float scale) {
-              auto min = Scalar::Lerp(currentGradient.factor1, nextGradient.factor1, scale);
-              auto max = Scalar::Lerp(*currentGradient.factor2, *nextGradient.factor2, scale);
-
-              particle->remapData->z = min;
-              particle->remapData->w = max - min;
-            });
-        }
-      }
-
-      if (_isAnimationSheetEnabled) {
-        particle->updateCellIndex();
-      }
-
-      // Update the position of the attached sub-emitters to match their
-      // attached particle
-      particle->_inheritParticleInfoToSubEmitters();
-
-      // Recycle by swapping with last particle
-      if (particle->age >= particle->lifeTime) {
-        _emitFromParticle(particle);
-        if (!particle->_attachedSubEmitters.empty()) {
-          for (auto& subEmitter : particle->_attachedSubEmitters) {
-            subEmitter->particleSystem->disposeOnStop = true;
-            subEmitter->particleSystem->stop();
-          }
-          particle->_attachedSubEmitters.clear();
-        }
-        recycleParticle(particle);
-        --index;
-        continue;
-      }
-    }
-  };
+  // Particles storage
+  _particles.reserve(capacity);
 }
 
 ParticleSystem::~ParticleSystem() = default;
@@ -341,6 +104,21 @@ size_t ParticleSystem::getActiveCount() const
   return _particles.size();
 }
 
+std::vector<Particle> ParticleSystem::particles()
+{
+  std::vector<Particle> activeParticles;
+  activeParticles.reserve(_particles.size());
+  for (size_t index = 0; index < _particles.size(); ++index) {
+    activeParticles.emplace_back(this, index);
+  }
+  return activeParticles;
+}
+
+ParticleStore& ParticleSystem::particleStore()
+{
+  return _particles;
+}
+
 std::string ParticleSystem::getClassName() const
 {
   return "ParticleSystem";
@@ -906,110 +684,13 @@ void ParticleSystem::stop(bool stopSubEmitters)
 
 void ParticleSystem::reset()
 {
-  _stockParticles.clear();
   _particles.clear();
 }
 
-void ParticleSystem::_appendParticleVertex(unsigned int index, Particle* particle, int offsetX,
-                                           int offsetY)
-{
-  unsigned int offset = index * _vertexBufferSize;
-
-  _vertexData[offset++] = particle->position.x + worldOffset.x;
-  _vertexData[offset++] = particle->position.y + worldOffset.y;
-  _vertexData[offset++] = particle->position.z + worldOffset.z;
-  _vertexData[offset++] = particle->color.r;
-  _vertexData[offset++] = particle->color.g;
-  _vertexData[offset++] = particle->color.b;
-  _vertexData[offset++] = particle->color.a;
-  _vertexData[offset++] = particle->angle;
-
-  _vertexData[offset++] = particle->scale.x * particle->size;
-  _vertexData[offset++] = particle->scale.y * particle->size;
-
-  if (_isAnimationSheetEnabled) {
-    _vertexData[offset++] = static_cast<float>(particle->cellIndex);
-  }
-
-  if (!_isBillboardBased) {
-    if (particle->_initialDirection) {
-      auto initialDirection = *particle->_initialDirection;
-      if (isLocal) {
-        Vector3::TransformNormalToRef(initialDirection, _emitterWorldMatrix,
-                                      TmpVectors::Vector3Array[0]);
-        initialDirection = TmpVectors::Vector3Array[0];
-      }
-      if (initialDirection.x == 0.f && initialDirection.z == 0.f) {
-        initialDirection.x = 0.001f;
-      }
-
-      _vertexData[offset++] = initialDirection.x;
-      _vertexData[offset++] = initialDirection.y;
-      _vertexData[offset++] = initialDirection.z;
-    }
-    else {
-      auto direction = particle->direction;
-      if (isLocal) {
-        Vector3::TransformNormalToRef(direction, _emitterWorldMatrix, TmpVectors::Vector3Array[0]);
-        direction = TmpVectors::Vector3Array[0];
-      }
-
-      if (direction.x == 0.f && direction.z == 0.f) {
-        direction.x = 0.001f;
-      }
-      _vertexData[offset++] = direction.x;
-      _vertexData[offset++] = direction.y;
-      _vertexData[offset++] = direction.z;
-    }
-  }
-  else if (billboardMode == ParticleSystem::BILLBOARDMODE_STRETCHED) {
-    _vertexData[offset++] = particle->direction.x;
-    _vertexData[offset++] = particle->direction.y;
-    _vertexData[offset++] = particle->direction.z;
-  }
-
-  if (_useRampGradients && particle->remapData) {
-    _vertexData[offset++] = particle->remapData->x;
-    _vertexData[offset++] = particle->remapData->y;
-    _vertexData[offset++] = particle->remapData->z;
-    _vertexData[offset++] = particle->remapData->w;
-  }
-
-  if (!_useInstancing) {
-    auto _offsetX = static_cast<float>(offsetX);
-    auto _offsetY = static_cast<float>(offsetY);
-
-    if (_isAnimationSheetEnabled) {
-      if (offsetX == 0) {
-        _offsetX = _epsilon;
-      }
-      else if (offsetX == 1) {
-        _offsetX = 1.f - _epsilon;
-      }
-
-      if (offsetY == 0) {
-        _offsetY = _epsilon;
-      }
-      else if (offsetY == 1) {
-        _offsetY = 1.f - _epsilon;
-      }
-    }
-
-    _vertexData[offset++] = _offsetX;
-    _vertexData[offset++] = _offsetY;
-  }
-}
-
-void ParticleSystem::recycleParticle(Particle* particle)
+void ParticleSystem::recycleParticle(const Particle& particle)
 {
-  // move particle from activeParticle list to stock particles
-  auto lastParticle = _particles.back();
-  _particles.pop_back();
-
-  if (lastParticle != particle) {
-    lastParticle->copyTo(*particle);
-  }
-  _stockParticles.emplace_back(lastParticle);
+  // move the last particle in the slot of the recycled one
+  _particles.swapRemove(particle.index());
 }
 
 void ParticleSystem::_stopSubEmitters()
@@ -1023,17 +704,9 @@ void ParticleSystem::_stopSubEmitters()
   activeSubSystems.clear();
 }
 
-Particle* ParticleSystem::_createParticle()
+Particle ParticleSystem::_createParticle()
 {
-  Particle* particle;
-  if (!_stockParticles.empty()) {
-    particle = _stockParticles.back();
-    _stockParticles.pop_back();
-    particle->_reset();
-  }
-  else {
-    particle = new Particle(this);
-  }
+  Particle particle(this, _particles.add(startSpriteCellID));
 
   // Attach emitters
   // TODO FIXME
@@ -1055,7 +728,7 @@ void ParticleSystem::_removeFromRoot()
   _rootParticleSystem = nullptr;
 }
 
-void ParticleSystem::_emitFromParticle(Particle* /*particle*/)
+void ParticleSystem::_emitFromParticle(const Particle& /*particle*/)
 {
   if (_subEmitters.empty()) {
     return;
@@ -1065,13 +738,330 @@ void ParticleSystem::_emitFromParticle(Particle* /*particle*/)
     = static_cast<size_t>(std::floor(Math::random() * subEmitters.size()));
 
   auto subSystem
-    = subEmitters[templateIndex]->clone(name + "_sub", particle->position);
+    = subEmitters[templateIndex]->clone(name + "_sub", particle.position());
   subSystem._rootParticleSystem = this;
   activeSubSystems.emplace_back(subSystem);
   subSystem.start();
 #endif
 }
 
+void ParticleSystem::_updateParticles()
+{
+  const auto count = _particles.size();
+  if (count == 0) {
+    return;
+  }
+
+  std::optional<ISize> noiseTextureSize = std::nullopt;
+  std::optional<Uint8Array> noiseTextureData;
+
+  if (noiseTexture()) { // We need to get texture data back to CPU
+    noiseTextureSize = noiseTexture()->getSize();
+    noiseTextureData = noiseTexture()->getContent().uint8Array();
+  }
+
+  auto& particles = _particles;
+  auto& states    = particles.states;
+  _updateSteps.resize(count);
+  _directionScales.resize(count);
+
+  auto* age             = particles.age.data();
+  const auto* lifeTime  = particles.lifeTime.data();
+  auto* steps           = _updateSteps.data();
+  auto* directionScales = _directionScales.data();
+  const auto speed      = _scaledUpdateSpeed;
+
+  // Age, the step to death is shortened so that the particle dies at its life time
+  for (size_t i = 0; i < count; ++i) {
+    steps[i] = std::min(speed, lifeTime[i] - age[i]);
+    age[i]   = std::min(age[i] + speed, lifeTime[i]);
+  }
+
+  // Color
+  if (!_colorGradients.empty()) {
+    auto& color = TmpVectors::Color4Array[0];
+    for (size_t i = 0; i < count; ++i) {
+      auto& state = states[i];
+      GradientHelper::GetCurrentGradient<ColorGradient>(
+        age[i] / lifeTime[i], _colorGradients,
+        [&](const ColorGradient& currentGradient, const ColorGradient& nextGradient,
+            float scale) {
+          if (currentGradient != state._currentColorGradient) {
+            state._currentColor1.copyFrom(state._currentColor2);
+            const_cast<ColorGradient&>(nextGradient).getColorToRef(state._currentColor2);
+            state._currentColorGradient = currentGradient;
+          }
+          Color4::LerpToRef(state._currentColor1, state._currentColor2, scale, color);
+        });
+      particles.colorR[i] = color.r;
+      particles.colorG[i] = color.g;
+      particles.colorB[i] = color.b;
+      particles.colorA[i] = color.a;
+    }
+  }
+  else {
+    auto* colorR           = particles.colorR.data();
+    auto* colorG           = particles.colorG.data();
+    auto* colorB           = particles.colorB.data();
+    auto* colorA           = particles.colorA.data();
+    const auto* colorStepR = particles.colorStepR.data();
+    const auto* colorStepG = particles.colorStepG.data();
+    const auto* colorStepB = particles.colorStepB.data();
+    const auto* colorStepA = particles.colorStepA.data();
+    for (size_t i = 0; i < count; ++i) {
+      colorR[i] += colorStepR[i] * steps[i];
+      colorG[i] += colorStepG[i] * steps[i];
+      colorB[i] += colorStepB[i] * steps[i];
+      colorA[i] = std::max(colorA[i] + colorStepA[i] * steps[i], 0.f);
+    }
+  }
+
+  // Angular speed
+  auto* angularSpeed = particles.angularSpeed.data();
+  if (!_angularSpeedGradients.empty()) {
+    for (size_t i = 0; i < count; ++i) {
+      auto& state = states[i];
+      GradientHelper::GetCurrentGradient<FactorGradient>(
+        age[i] / lifeTime[i], _angularSpeedGradients,
+        [&](const FactorGradient& currentGradient, const FactorGradient& nextGradient,
+            float scale) {
+          if (currentGradient != state._currentAngularSpeedGradient) {
+            state._currentAngularSpeed1        = state._currentAngularSpeed2;
+            state._currentAngularSpeed2        = nextGradient.getFactor();
+            state._currentAngularSpeedGradient = currentGradient;
+          }
+          angularSpeed[i]
+            = Scalar::Lerp(state._currentAngularSpeed1, state._currentAngularSpeed2, scale);
+        });
+    }
+  }
+  auto* angle = particles.angle.data();
+  for (size_t i = 0; i < count; ++i) {
+    angle[i] += angularSpeed[i] * steps[i];
+  }
+
+  // Direction scale: velocity and drag
+  std::copy(steps, steps + count, directionScales);
+  if (!_velocityGradients.empty()) {
+    for (size_t i = 0; i < count; ++i) {
+      auto& state = states[i];
+      GradientHelper::GetCurrentGradient<FactorGradient>(
+        age[i] / lifeTime[i], _velocityGradients,
+        [&](const FactorGradient& currentGradient, const FactorGradient& nextGradient,
+            float scale) {
+          if (currentGradient != state._currentVelocityGradient) {
+            state._currentVelocity1        = state._currentVelocity2;
+            state._currentVelocity2        = nextGradient.getFactor();
+            state._currentVelocityGradient = currentGradient;
+          }
+          directionScales[i]
+            *= Scalar::Lerp(state._currentVelocity1, state._currentVelocity2, scale);
+        });
+    }
+  }
+  if (!_dragGradients.empty()) {
+    for (size_t i = 0; i < count; ++i) {
+      auto& state = states[i];
+      GradientHelper::GetCurrentGradient<FactorGradient>(
+        age[i] / lifeTime[i], _dragGradients,
+        [&](const FactorGradient& currentGradient, const FactorGradient& nextGradient,
+            float scale) {
+          if (currentGradient != state._currentDragGradient) {
+            state._currentDrag1        = state._currentDrag2;
+            state._currentDrag2        = nextGradient.getFactor();
+            state._currentDragGradient = currentGradient;
+          }
+          directionScales[i] *= 1.f - Scalar::Lerp(state._currentDrag1, state._currentDrag2, scale);
+        });
+    }
+  }
+
+  // Position
+  auto* positionX  = particles.positionX.data();
+  auto* positionY  = particles.positionY.data();
+  auto* positionZ  = particles.positionZ.data();
+  auto* directionX = particles.directionX.data();
+  auto* directionY = particles.directionY.data();
+  auto* directionZ = particles.directionZ.data();
+  if (isLocal) {
+    auto& position = TmpVectors::Vector3Array[0];
+    for (size_t i = 0; i < count; ++i) {
+      auto& localPosition = states[i]._localPosition;
+      if (localPosition) {
+        localPosition->addInPlaceFromFloats(directionX[i] * directionScales[i],
+                                            directionY[i] * directionScales[i],
+                                            directionZ[i] * directionScales[i]);
+        Vector3::TransformCoordinatesToRef(*localPosition, _emitterWorldMatrix, position);
+        positionX[i] = position.x;
+        positionY[i] = position.y;
+        positionZ[i] = position.z;
+      }
+      else {
+        positionX[i] += directionX[i] * directionScales[i];
+        positionY[i] += directionY[i] * directionScales[i];
+        positionZ[i] += directionZ[i] * directionScales[i];
+      }
+    }
+  }
+  else {
+    for (size_t i = 0; i < count; ++i) {
+      positionX[i] += directionX[i] * directionScales[i];
+      positionY[i] += directionY[i] * directionScales[i];
+      positionZ[i] += directionZ[i] * directionScales[i];
+    }
+  }
+
+  // Limit velocity (applied after the move, as the direction of the current step is already
+  // computed)
+  if (!_limitVelocityGradients.empty()) {
+    for (size_t i = 0; i < count; ++i) {
+      auto& state = states[i];
+      GradientHelper::GetCurrentGradient<FactorGradient>(
+        age[i] / lifeTime[i], _limitVelocityGradients,
+        [&](const FactorGradient& currentGradient, const FactorGradient& nextGradient,
+            float scale) {
+          if (currentGradient != state._currentLimitVelocityGradient) {
+            state._currentLimitVelocity1        = state._currentLimitVelocity2;
+            state._currentLimitVelocity2        = nextGradient.getFactor();
+            state._currentLimitVelocityGradient = currentGradient;
+          }
+
+          auto limitVelocity
+            = Scalar::Lerp(state._currentLimitVelocity1, state._currentLimitVelocity2, scale);
+          auto currentVelocity = std::sqrt(directionX[i] * directionX[i]
+                                           + directionY[i] * directionY[i]
+                                           + directionZ[i] * directionZ[i]);
+
+          if (currentVelocity > limitVelocity) {
+            directionX[i] *= limitVelocityDamping;
+            directionY[i] *= limitVelocityDamping;
+            directionZ[i] *= limitVelocityDamping;
+          }
+        });
+    }
+  }
+
+  // Noise
+  if (noiseTextureData && noiseTextureSize) {
+    const auto width  = static_cast<float>(noiseTextureSize->width);
+    const auto height = static_cast<float>(noiseTextureSize->height);
+    for (size_t i = 0; i < count; ++i) {
+      const auto& state = states[i];
+      if (!state._randomNoiseCoordinates1.has_value()) {
+        continue;
+      }
+      const auto& coordinates1 = *state._randomNoiseCoordinates1;
+      const auto& coordinates2 = state._randomNoiseCoordinates2;
+
+      const auto& data   = *noiseTextureData;
+      auto fetchedColorR = _fetchR(coordinates1.x, coordinates1.y, width, height, data);
+      auto fetchedColorG = _fetchR(coordinates1.z, coordinates2.x, width, height, data);
+      auto fetchedColorB = _fetchR(coordinates2.y, coordinates2.z, width, height, data);
+
+      directionX[i] += (2.f * fetchedColorR - 1.f) * noiseStrength.x * steps[i];
+      directionY[i] += (2.f * fetchedColorG - 1.f) * noiseStrength.y * steps[i];
+      directionZ[i] += (2.f * fetchedColorB - 1.f) * noiseStrength.z * steps[i];
+    }
+  }
+
+  // Gravity
+  {
+    const auto gravityX = gravity.x, gravityY = gravity.y, gravityZ = gravity.z;
+    for (size_t i = 0; i < count; ++i) {
+      directionX[i] += gravityX * steps[i];
+      directionY[i] += gravityY * steps[i];
+      directionZ[i] += gravityZ * steps[i];
+    }
+  }
+
+  // Size
+  if (!_sizeGradients.empty()) {
+    auto* sizes = particles.sizes.data();
+    for (size_t i = 0; i < count; ++i) {
+      auto& state = states[i];
+      GradientHelper::GetCurrentGradient<FactorGradient>(
+        age[i] / lifeTime[i], _sizeGradients,
+        [&](const FactorGradient& currentGradient, const FactorGradient& nextGradient,
+            float scale) {
+          if (currentGradient != state._currentSizeGradient) {
+            state._currentSize1        = state._currentSize2;
+            state._currentSize2        = nextGradient.getFactor();
+            state._currentSizeGradient = currentGradient;
+          }
+          sizes[i] = Scalar::Lerp(state._currentSize1, state._currentSize2, scale);
+        });
+    }
+  }
+
+  // Remap data
+  if (_useRampGradients && (!_colorRemapGradients.empty() || !_alphaRemapGradients.empty())) {
+    for (size_t i = 0; i < count; ++i) {
+      auto& remapData = states[i].remapData;
+      if (!remapData) {
+        continue;
+      }
+      const auto ratio = age[i] / lifeTime[i];
+      if (!_colorRemapGradients.empty()) {
+        GradientHelper::GetCurrentGradient<FactorGradient>(
+          ratio, _colorRemapGradients,
+          [&](const FactorGradient& currentGradient, const FactorGradient& nextGradient,
+              float scale) {
+            auto min = Scalar::Lerp(currentGradient.factor1, nextGradient.factor1, scale);
+            auto max = Scalar::Lerp(*currentGradient.factor2, *nextGradient.factor2, scale);
+
+            remapData->x = min;
+            remapData->y = max - min;
+          });
+      }
+
+      if (!_alphaRemapGradients.empty()) {
+        GradientHelper::GetCurrentGradient<FactorGradient>(
+          ratio, _alphaRemapGradients,
+          [&](const FactorGradient& currentGradient, const FactorGradient& nextGradient,
+              float scale) {
+            auto min = Scalar::Lerp(currentGradient.factor1, nextGradient.factor1, scale);
+            auto max = Scalar::Lerp(*currentGradient.factor2, *nextGradient.factor2, scale);
+
+            remapData->z = min;
+            remapData->w = max - min;
+          });
+      }
+    }
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    if (_isAnimationSheetEnabled || !states[i]._attachedSubEmitters.empty()) {
+      Particle particle(this, i);
+      if (_isAnimationSheetEnabled) {
+        particle.updateCellIndex();
+      }
+
+      // Update the position of the attached sub-emitters to match their
+      // attached particle
+      particle._inheritParticleInfoToSubEmitters();
+    }
+  }
+
+  // Recycle by swapping with last particle
+  for (size_t i = 0; i < particles.size();) {
+    if (particles.age[i] < particles.lifeTime[i]) {
+      ++i;
+      continue;
+    }
+    Particle particle(this, i);
+    _emitFromParticle(particle);
+    auto& attachedSubEmitters = particles.states[i]._attachedSubEmitters;
+    if (!attachedSubEmitters.empty()) {
+      for (auto& subEmitter : attachedSubEmitters) {
+        subEmitter->particleSystem->disposeOnStop = true;
+        subEmitter->particleSystem->stop();
+      }
+      attachedSubEmitters.clear();
+    }
+    recycleParticle(particle);
+  }
+}
+
 void ParticleSystem::_update(int newParticles)
 {
   // Update current
@@ -1087,22 +1077,26 @@ void ParticleSystem::_update(int newParticles)
       = Matrix::Translation(emitterPosition.x, emitterPosition.y, emitterPosition.z);
   }
 
-  updateFunction(_particles);
+  if (updateFunction) {
+    auto activeParticles = particles();
+    updateFunction(activeParticles);
+  }
+  else {
+    _updateParticles();
+  }
 
   // Add new ones
-  Particle* particle = nullptr;
   for (int index = 0; index < newParticles; ++index) {
     if (_particles.size() == _capacity) {
       break;
     }
 
-    particle = _createParticle();
-
-    _particles.emplace_back(particle);
+    auto particle = _createParticle();
+    auto& state   = particle.state();
 
     // Life time
     if (targetStopDuration && !_lifeTimeGradients.empty()) {
-      auto ratio = static_cast<float>(Scalar::Clamp(_actualFrame / targetStopDuration));
+      auto ratio = Scalar::Clamp(_actualFrame / static_cast<float>(targetStopDuration));
       GradientHelper::GetCurrentGradient<FactorGradient>(
         ratio, _lifeTimeGradients,
         [&](const FactorGradient& currentGradient, const FactorGradient& nextGradient,
@@ -1113,210 +1107,197 @@ void ParticleSystem::_update(int newParticles)
           auto lifeTime2        = factorGradient2.getFactor();
           auto gradient         = (ratio - factorGradient1.gradient)
                           / (factorGradient2.gradient - factorGradient1.gradient);
-          particle->lifeTime = Scalar::Lerp(lifeTime1, lifeTime2, gradient);
+          particle.lifeTime() = Scalar::Lerp(lifeTime1, lifeTime2, gradient);
         });
     }
     else {
-      particle->lifeTime = Scalar::RandomRange(minLifeTime, maxLifeTime);
+      particle.lifeTime() = Scalar::RandomRange(minLifeTime, maxLifeTime);
     }
 
     // Emitter
     auto emitPower = Scalar::RandomRange(minEmitPower, maxEmitPower);
 
+    auto position = Vector3::Zero();
     if (startPositionFunction) {
-      startPositionFunction(_emitterWorldMatrix, particle->position, particle, isLocal);
+      startPositionFunction(_emitterWorldMatrix, position, &particle, isLocal);
     }
     else {
-      particleEmitterType->startPositionFunction(_emitterWorldMatrix, particle->position, particle,
+      particleEmitterType->startPositionFunction(_emitterWorldMatrix, position, &particle,
                                                  isLocal);
     }
 
     if (isLocal) {
-      if (!particle->_localPosition) {
-        particle->_localPosition = particle->position;
-      }
-      else {
-        particle->_localPosition->copyFrom(particle->position);
-      }
-      if (particle->_localPosition) {
-        Vector3::TransformCoordinatesToRef(*particle->_localPosition, _emitterWorldMatrix,
-                                           particle->position);
-      }
+      state._localPosition = position;
+      Vector3::TransformCoordinatesToRef(*state._localPosition, _emitterWorldMatrix, position);
     }
+    particle.setPosition(position);
 
+    auto direction = Vector3::Zero();
     if (startDirectionFunction) {
-      startDirectionFunction(_emitterWorldMatrix, particle->direction, particle, isLocal);
+      startDirectionFunction(_emitterWorldMatrix, direction, &particle, isLocal);
     }
     else {
-      particleEmitterType->startDirectionFunction(_emitterWorldMatrix, particle->direction,
-                                                  particle, isLocal);
+      particleEmitterType->startDirectionFunction(_emitterWorldMatrix, direction, &particle,
+                                                  isLocal);
     }
 
     if (emitPower == 0.f) {
-      if (!particle->_initialDirection) {
-        particle->_initialDirection = particle->direction;
-      }
-      else {
-        particle->_initialDirection = particle->direction;
-      }
+      state._initialDirection = direction;
     }
     else {
-      particle->_initialDirection = std::nullopt;
+      state._initialDirection = std::nullopt;
     }
 
-    particle->direction.scaleInPlace(emitPower);
+    direction.scaleInPlace(emitPower);
 
     // Size
-    if (!_sizeGradients.empty()) {
-      particle->size = Scalar::RandomRange(minSize, maxSize);
+    if (_sizeGradients.empty()) {
+      particle.size() = Scalar::RandomRange(minSize, maxSize);
     }
     else {
-      particle->_currentSizeGradient = _sizeGradients[0];
-      particle->_currentSize1        = (*particle->_currentSizeGradient).getFactor();
-      particle->size                 = particle->_currentSize1;
+      state._currentSizeGradient = _sizeGradients[0];
+      state._currentSize1        = state._currentSizeGradient->getFactor();
+      particle.size()            = state._currentSize1;
 
       if (_sizeGradients.size() > 1) {
-        particle->_currentSize2 = _sizeGradients[1].getFactor();
+        state._currentSize2 = _sizeGradients[1].getFactor();
       }
       else {
-        particle->_currentSize2 = particle->_currentSize1;
+        state._currentSize2 = state._currentSize1;
       }
     }
     // Size and scale
-    particle->scale.copyFromFloats(Scalar::RandomRange(minScaleX, maxScaleX),
-                                   Scalar::RandomRange(minScaleY, maxScaleY));
+    auto scale = Vector2(Scalar::RandomRange(minScaleX, maxScaleX),
+                         Scalar::RandomRange(minScaleY, maxScaleY));
 
     // Adjust scale by start size
     if (!_startSizeGradients.empty() && targetStopDuration) {
-      auto ratio = static_cast<float>(_actualFrame) / static_cast<float>(targetStopDuration);
+      auto ratio = _actualFrame / static_cast<float>(targetStopDuration);
       GradientHelper::GetCurrentGradient<FactorGradient>(
         ratio, _startSizeGradients,
         [&](const FactorGradient& currentGradient, const FactorGradient& nextGradient,
-            float scale) {
+            float gradientScale) {
           if (currentGradient != _currentStartSizeGradient) {
             _currentStartSize1        = _currentStartSize2;
             _currentStartSize2        = nextGradient.getFactor();
             _currentStartSizeGradient = currentGradient;
           }
 
-          auto value = Scalar::Lerp(_currentStartSize1, _currentStartSize2, scale);
-          particle->scale.scaleInPlace(value);
+          auto value = Scalar::Lerp(_currentStartSize1, _currentStartSize2, gradientScale);
+          scale.scaleInPlace(value);
         });
     }
+    particle.setScale(scale);
 
     // Angle
-    if (!_angularSpeedGradients.empty()) {
-      particle->angularSpeed = Scalar::RandomRange(minAngularSpeed, maxAngularSpeed);
+    if (_angularSpeedGradients.empty()) {
+      particle.angularSpeed() = Scalar::RandomRange(minAngularSpeed, maxAngularSpeed);
     }
     else {
-      particle->_currentAngularSpeedGradient = _angularSpeedGradients[0];
-      particle->angularSpeed          = (*particle->_currentAngularSpeedGradient).getFactor();
-      particle->_currentAngularSpeed1 = particle->angularSpeed;
+      state._currentAngularSpeedGradient = _angularSpeedGradients[0];
+      particle.angularSpeed()            = state._currentAngularSpeedGradient->getFactor();
+      state._currentAngularSpeed1        = particle.angularSpeed();
 
       if (_angularSpeedGradients.size() > 1) {
-        particle->_currentAngularSpeed2 = _angularSpeedGradients[1].getFactor();
+        state._currentAngularSpeed2 = _angularSpeedGradients[1].getFactor();
       }
       else {
-        particle->_currentAngularSpeed2 = particle->_currentAngularSpeed1;
+        state._currentAngularSpeed2 = state._currentAngularSpeed1;
       }
     }
-    particle->angle = Scalar::RandomRange(minInitialRotation, maxInitialRotation);
+    particle.angle() = Scalar::RandomRange(minInitialRotation, maxInitialRotation);
 
     // Velocity
     if (!_velocityGradients.empty()) {
-      particle->_currentVelocityGradient = _velocityGradients[0];
-      particle->_currentVelocity1        = (*particle->_currentVelocityGradient).getFactor();
+      state._currentVelocityGradient = _velocityGradients[0];
+      state._currentVelocity1        = state._currentVelocityGradient->getFactor();
 
       if (_velocityGradients.size() > 1) {
-        particle->_currentVelocity2 = _velocityGradients[1].getFactor();
+        state._currentVelocity2 = _velocityGradients[1].getFactor();
       }
       else {
-        particle->_currentVelocity2 = particle->_currentVelocity1;
+        state._currentVelocity2 = state._currentVelocity1;
       }
     }
 
     // Limit velocity
     if (!_limitVelocityGradients.empty()) {
-      particle->_currentLimitVelocityGradient = _limitVelocityGradients[0];
-      particle->_currentLimitVelocity1 = particle->_currentLimitVelocityGradient->getFactor();
+      state._currentLimitVelocityGradient = _limitVelocityGradients[0];
+      state._currentLimitVelocity1        = state._currentLimitVelocityGradient->getFactor();
 
       if (_limitVelocityGradients.size() > 1) {
-        particle->_currentLimitVelocity2 = _limitVelocityGradients[1].getFactor();
+        state._currentLimitVelocity2 = _limitVelocityGradients[1].getFactor();
       }
       else {
-        particle->_currentLimitVelocity2 = particle->_currentLimitVelocity1;
+        state._currentLimitVelocity2 = state._currentLimitVelocity1;
       }
     }
 
     // Drag
-    if (_dragGradients.empty()) {
-      particle->_currentDragGradient = _dragGradients[0];
-      particle->_currentDrag1        = particle->_currentDragGradient->getFactor();
+    if (!_dragGradients.empty()) {
+      state._currentDragGradient = _dragGradients[0];
+      state._currentDrag1        = state._currentDragGradient->getFactor();
 
       if (_dragGradients.size() > 1) {
-        particle->_currentDrag2 = _dragGradients[1].getFactor();
+        state._currentDrag2 = _dragGradients[1].getFactor();
       }
       else {
-        particle->_currentDrag2 = particle->_currentDrag1;
+        state._currentDrag2 = state._currentDrag1;
       }
     }
 
     // Color
+    auto& color = TmpVectors::Color4Array[0];
     if (_colorGradients.empty()) {
       auto step = Scalar::RandomRange(0.f, 1.f);
 
-      Color4::LerpToRef(color1, color2, step, particle->color);
+      Color4::LerpToRef(color1, color2, step, color);
 
-      colorDead.subtractToRef(particle->color, _colorDiff);
-      _colorDiff.scaleToRef(1.f / particle->lifeTime, particle->colorStep);
+      auto& colorStep = TmpVectors::Color4Array[1];
+      colorDead.subtractToRef(color, _colorDiff);
+      _colorDiff.scaleToRef(1.f / particle.lifeTime(), colorStep);
+      particle.setColorStep(colorStep);
     }
     else {
       auto currentColorGradient = _colorGradients[0];
-      currentColorGradient.getColorToRef(particle->color);
-      particle->_currentColorGradient = currentColorGradient;
-      particle->_currentColor1.copyFrom(particle->color);
+      currentColorGradient.getColorToRef(color);
+      state._currentColorGradient = currentColorGradient;
+      state._currentColor1.copyFrom(color);
 
       if (_colorGradients.size() > 1) {
-        _colorGradients[1].getColorToRef(particle->_currentColor2);
+        _colorGradients[1].getColorToRef(state._currentColor2);
       }
       else {
-        particle->_currentColor2.copyFrom(particle->color);
+        state._currentColor2.copyFrom(color);
       }
     }
+    particle.setColor(color);
 
     // Sheet
     if (_isAnimationSheetEnabled) {
-      particle->_initialStartSpriteCellID = startSpriteCellID;
-      particle->_initialEndSpriteCellID   = endSpriteCellID;
+      state._initialStartSpriteCellID = startSpriteCellID;
+      state._initialEndSpriteCellID   = endSpriteCellID;
     }
 
     // Inherited Velocity
-    particle->direction.addInPlace(_inheritedVelocityOffset);
+    direction.addInPlace(_inheritedVelocityOffset);
+    particle.setDirection(direction);
 
     // Ramp
     if (_useRampGradients) {
-      particle->remapData = Vector4(0.f, 1.f, 0.f, 1.f);
+      state.remapData = Vector4(0.f, 1.f, 0.f, 1.f);
     }
 
     // Noise texture coordinates
     if (noiseTexture()) {
-      if (particle->_randomNoiseCoordinates1.has_value()) {
-        particle->_randomNoiseCoordinates1->copyFromFloats(Math::random(), Math::random(),
-                                                           Math::random());
-        particle->_randomNoiseCoordinates2.copyFromFloats(Math::random(), Math::random(),
-                                                          Math::random());
-      }
-      else {
-        particle->_randomNoiseCoordinates1
-          = Vector3(Math::random(), Math::random(), Math::random());
-        particle->_randomNoiseCoordinates2
-          = Vector3(Math::random(), Math::random(), Math::random());
-      }
+      state._randomNoiseCoordinates1 = Vector3(Math::random(), Math::random(), Math::random());
+      state._randomNoiseCoordinates2.copyFromFloats(Math::random(), Math::random(),
+                                                    Math::random());
     }
 
     // Update the position of the attached sub-emitters to match their attached
     // particle
-    particle->_inheritParticleInfoToSubEmitters();
+    particle._inheritParticleInfoToSubEmitters();
   }
 }
 
@@ -1488,8 +1469,9 @@ void ParticleSystem::animate(bool preWarmOnly)
     _currentRenderId = _scene->getFrameId();
   }
 
-  _scaledUpdateSpeed = static_cast<int>(
-    updateSpeed * (preWarmOnly ? preWarmStepOffset : _scene->getAnimationRatio()));
+  _scaledUpdateSpeed
+    = updateSpeed
+      * (preWarmOnly ? static_cast<float>(preWarmStepOffset) : _scene->getAnimationRatio());
 
   // Determine the number of particles we need to create
   int newParticles = 0;
@@ -1519,12 +1501,13 @@ void ParticleSystem::animate(bool preWarmOnly)
     }
 
     newParticles = static_cast<int>(rate * _scaledUpdateSpeed);
-    _newPartsExcess += static_cast<int>(rate * _scaledUpdateSpeed - newParticles);
+    _newPartsExcess += rate * _scaledUpdateSpeed - static_cast<float>(newParticles);
   }
 
-  if (_newPartsExcess > 1) {
-    newParticles += _newPartsExcess >> 0;
-    _newPartsExcess -= _newPartsExcess >> 0;
+  if (_newPartsExcess > 1.f) {
+    const auto excess = static_cast<int>(_newPartsExcess);
+    newParticles += excess;
+    _newPartsExcess -= static_cast<float>(excess);
   }
 
   _alive = false;
@@ -1556,11 +1539,7 @@ void ParticleSystem::animate(bool preWarmOnly)
 
   if (!preWarmOnly) {
     // Update VBO
-    unsigned int offset = 0;
-    for (auto& particle : _particles) {
-      _appendParticleVertices(offset, particle);
-      offset += _useInstancing ? 1 : 4;
-    }
+    _fillVertexData();
 
     if (_vertexBuffer) {
       _vertexBuffer->update(_vertexData);
@@ -1572,13 +1551,114 @@ void ParticleSystem::animate(bool preWarmOnly)
   }
 }
 
-void ParticleSystem::_appendParticleVertices(unsigned int offset, Particle* particle)
+void ParticleSystem::_fillVertexData()
 {
-  _appendParticleVertex(offset++, particle, 0, 0);
+  const auto count               = _particles.size();
+  const auto verticesPerParticle = _useInstancing ? 1u : 4u;
+  const auto stride              = static_cast<size_t>(_vertexBufferSize);
+  const auto particleStride      = stride * verticesPerParticle;
+  auto* vertexData               = _vertexData.data();
+  size_t column                  = 0;
+
+  // Writes a value per particle in a column of the interleaved vertex data
+  const auto fillColumn = [&](const float* values, float offset = 0.f) {
+    auto* vertex = vertexData + column++;
+    for (size_t i = 0; i < count; ++i, vertex += particleStride) {
+      const auto value = values[i] + offset;
+      for (size_t v = 0; v < verticesPerParticle; ++v) {
+        vertex[v * stride] = value;
+      }
+    }
+  };
+
+  fillColumn(_particles.positionX.data(), worldOffset.x);
+  fillColumn(_particles.positionY.data(), worldOffset.y);
+  fillColumn(_particles.positionZ.data(), worldOffset.z);
+  fillColumn(_particles.colorR.data());
+  fillColumn(_particles.colorG.data());
+  fillColumn(_particles.colorB.data());
+  fillColumn(_particles.colorA.data());
+  fillColumn(_particles.angle.data());
+
+  // Size
+  {
+    auto* vertex = vertexData + column;
+    for (size_t i = 0; i < count; ++i, vertex += particleStride) {
+      const auto sizeX = _particles.scaleX[i] * _particles.sizes[i];
+      const auto sizeY = _particles.scaleY[i] * _particles.sizes[i];
+      for (size_t v = 0; v < verticesPerParticle; ++v) {
+        vertex[v * stride]     = sizeX;
+        vertex[v * stride + 1] = sizeY;
+      }
+    }
+    column += 2;
+  }
+
+  if (_isAnimationSheetEnabled) {
+    auto* vertex = vertexData + column++;
+    for (size_t i = 0; i < count; ++i, vertex += particleStride) {
+      const auto cellIndex = static_cast<float>(_particles.cellIndex[i]);
+      for (size_t v = 0; v < verticesPerParticle; ++v) {
+        vertex[v * stride] = cellIndex;
+      }
+    }
+  }
+
+  if (!_isBillboardBased) {
+    auto* vertex = vertexData + column;
+    for (size_t i = 0; i < count; ++i, vertex += particleStride) {
+      const auto& initialDirection = _particles.states[i]._initialDirection;
+      auto direction = initialDirection ? *initialDirection :
+                                          Vector3(_particles.directionX[i],
+                                                  _particles.directionY[i],
+                                                  _particles.directionZ[i]);
+      if (isLocal) {
+        Vector3::TransformNormalToRef(direction, _emitterWorldMatrix, TmpVectors::Vector3Array[0]);
+        direction = TmpVectors::Vector3Array[0];
+      }
+      if (direction.x == 0.f && direction.z == 0.f) {
+        direction.x = 0.001f;
+      }
+      for (size_t v = 0; v < verticesPerParticle; ++v) {
+        vertex[v * stride]     = direction.x;
+        vertex[v * stride + 1] = direction.y;
+        vertex[v * stride + 2] = direction.z;
+      }
+    }
+    column += 3;
+  }
+  else if (billboardMode == ParticleSystem::BILLBOARDMODE_STRETCHED) {
+    fillColumn(_particles.directionX.data());
+    fillColumn(_particles.directionY.data());
+    fillColumn(_particles.directionZ.data());
+  }
+
+  if (_useRampGradients) {
+    auto* vertex = vertexData + column;
+    for (size_t i = 0; i < count; ++i, vertex += particleStride) {
+      const auto remapData = _particles.states[i].remapData.value_or(Vector4(0.f, 0.f, 0.f, 0.f));
+      for (size_t v = 0; v < verticesPerParticle; ++v) {
+        vertex[v * stride]     = remapData.x;
+        vertex[v * stride + 1] = remapData.y;
+        vertex[v * stride + 2] = remapData.z;
+        vertex[v * stride + 3] = remapData.w;
+      }
+    }
+    column += 4;
+  }
+
   if (!_useInstancing) {
-    _appendParticleVertex(offset++, particle, 1, 0);
-    _appendParticleVertex(offset++, particle, 1, 1);
-    _appendParticleVertex(offset++, particle, 0, 1);
+    // Corners of the quad, moved inside by epsilon for sprite sheets
+    const auto low  = _isAnimationSheetEnabled ? _epsilon : 0.f;
+    const auto high = _isAnimationSheetEnabled ? 1.f - _epsilon : 1.f;
+    const std::array<float, 8> offsets{low, low, high, low, high, high, low, high};
+    auto* vertex = vertexData + column;
+    for (size_t i = 0; i < count; ++i, vertex += particleStride) {
+      for (size_t v = 0; v < verticesPerParticle; ++v) {
+        vertex[v * stride]     = offsets[v * 2];
+        vertex[v * stride + 1] = offsets[v * 2 + 1];
+      }
+    }
   }
 }
 
@@ -1710,7 +1790,7 @@ size_t ParticleSystem::_render(unsigned int iBlendMode)
 size_t ParticleSystem::render(bool /*preWarm*/)
 {
   // Check
-  if (!isReady() || !_particles.empty()) {
+  if (!isReady() || _particles.empty()) {
     return 0;
   }
 
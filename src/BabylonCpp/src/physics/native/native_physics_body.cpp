@@ -0,0 +1,304 @@
+#include <babylon/physics/native/native_physics_body.h>
+
+#include <cmath>
+
+#include <babylon/core/logging.h>
+#include <babylon/culling/dynamic_aabb_tree.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Rotates a vector by a unit quaternion (the rotation of
+// Quaternion::toRotationMatrix), without the shared temporaries of Vector3
+inline Vector3 Rotate(const Quaternion& q, const Vector3& v)
+{
+  const auto tx = 2.f * (q.y * v.z - q.z * v.y);
+  const auto ty = 2.f * (q.z * v.x - q.x * v.z);
+  const auto tz = 2.f * (q.x * v.y - q.y * v.x);
+  return Vector3(v.x + q.w * tx + (q.y * tz - q.z * ty), v.y + q.w * ty + (q.z * tx - q.x * tz),
+                 v.z + q.w * tz + (q.x * ty - q.y * tx));
+}
+
+inline Vector3 InverseRotate(const Quaternion& q, const Vector3& v)
+{
+  return Rotate(Quaternion(-q.x, -q.y, -q.z, q.w), v);
+}
+
+} // end of anonymous namespace
+
+NativePhysicsBody::NativePhysicsBody(const NativePhysicsShapePtr& shape, float mass,
+                                     const Vector3& position, const Quaternion& rotation)
+    : _uniqueId{0}
+    , _shape{shape}
+    , _position{position}
+    , _rotation{rotation}
+    , _linearVelocity{Vector3::Zero()}
+    , _angularVelocity{Vector3::Zero()}
+    , _force{Vector3::Zero()}
+    , _torque{Vector3::Zero()}
+    , _mass{mass}
+    , _inverseMass{0.f}
+    , _inverseInertia{Vector3::Zero()}
+    , _friction{0.2f}
+    , _restitution{0.2f}
+    , _linearDamping{0.01f}
+    , _angularDamping{0.05f}
+    , _sleeping{false}
+    , _sleepTime{0.f}
+    , _transformDirty{false}
+    , _boundingMin{Vector3::Zero()}
+    , _boundingMax{Vector3::Zero()}
+    , _proxyId{DynamicAABBTree<NativePhysicsBody*>::NullNode}
+    , _index{0}
+    , _solverIndex{0}
+{
+  _rotation.normalize();
+  _updateMassProperties();
+}
+
+NativePhysicsBody::~NativePhysicsBody() = default;
+
+void NativePhysicsBody::setPosition(const Vector3& newPosition)
+{
+  _position.copyFrom(newPosition);
+  _transformDirty = true;
+  awake();
+}
+
+void NativePhysicsBody::setOrientation(const Quaternion& newRotation)
+{
+  _rotation.copyFrom(newRotation);
+  _rotation.normalize();
+  _transformDirty = true;
+  awake();
+}
+
+void NativePhysicsBody::setShapesDensity(float density)
+{
+  setMass(density * _shape->volume());
+}
+
+void NativePhysicsBody::setupMass(int iMass)
+{
+  setMass(static_cast<float>(iMass));
+}
+
+float NativePhysicsBody::mass()
+{
+  return _mass;
+}
+
+void NativePhysicsBody::applyImpulse(const Vector3& iPosition, const Vector3& force)
+{
+  if (isStatic()) {
+    return;
+  }
+  _linearVelocity.addInPlace(force.scale(_inverseMass));
+  _angularVelocity.addInPlace(
+    applyInverseInertia(Vector3::Cross(iPosition.subtract(_position), force)));
+  awake();
+}
+
+Vector3 NativePhysicsBody::angularVelocity()
+{
+  return _angularVelocity;
+}
+
+void NativePhysicsBody::setAngularVelocity(const Vector3& velocity)
+{
+  if (isStatic()) {
+    return;
+  }
+  _angularVelocity.copyFrom(velocity);
+  awake();
+}
+
+Vector3 NativePhysicsBody::linearVelocity()
+{
+  return _linearVelocity;
+}
+
+void NativePhysicsBody::setLinearVelocity(const Vector3& velocity)
+{
+  if (isStatic()) {
+    return;
+  }
+  _linearVelocity.copyFrom(velocity);
+  awake();
+}
+
+void NativePhysicsBody::sleep()
+{
+  if (isStatic()) {
+    return;
+  }
+  _sleeping = true;
+  _linearVelocity.setAll(0.f);
+  _angularVelocity.setAll(0.f);
+}
+
+bool NativePhysicsBody::sleeping()
+{
+  return _sleeping;
+}
+
+void NativePhysicsBody::awake()
+{
+  _sleeping  = false;
+  _sleepTime = 0.f;
+}
+
+void NativePhysicsBody::syncShapes()
+{
+  _transformDirty = true;
+}
+
+size_t NativePhysicsBody::uniqueId() const
+{
+  return _uniqueId;
+}
+
+const NativePhysicsShapePtr& NativePhysicsBody::shape() const
+{
+  return _shape;
+}
+
+const Vector3& NativePhysicsBody::position() const
+{
+  return _position;
+}
+
+const Quaternion& NativePhysicsBody::rotation() const
+{
+  return _rotation;
+}
+
+bool NativePhysicsBody::isStatic() const
+{
+  return _inverseMass == 0.f;
+}
+
+void NativePhysicsBody::setMass(float iMass)
+{
+  _mass = iMass;
+  _updateMassProperties();
+  awake();
+}
+
+float NativePhysicsBody::friction() const
+{
+  return _friction;
+}
+
+void NativePhysicsBody::setFriction(float iFriction)
+{
+  _friction = iFriction;
+}
+
+float NativePhysicsBody::restitution() const
+{
+  return _restitution;
+}
+
+void NativePhysicsBody::setRestitution(float iRestitution)
+{
+  _restitution = iRestitution;
+}
+
+void NativePhysicsBody::setDamping(float linearDamping, float angularDamping)
+{
+  _linearDamping  = linearDamping;
+  _angularDamping = angularDamping;
+}
+
+void NativePhysicsBody::applyForce(const Vector3& force, const Vector3& contactPoint)
+{
+  if (isStatic()) {
+    return;
+  }
+  _force.addInPlace(force);
+  _torque.addInPlace(Vector3::Cross(contactPoint.subtract(_position), force));
+  awake();
+}
+
+Vector3 NativePhysicsBody::localToWorld(const Vector3& point) const
+{
+  return Rotate(_rotation, point).addInPlace(_position);
+}
+
+Vector3 NativePhysicsBody::worldToLocal(const Vector3& point) const
+{
+  return InverseRotate(_rotation, point.subtract(_position));
+}
+
+Vector3 NativePhysicsBody::rotateToWorld(const Vector3& direction) const
+{
+  return Rotate(_rotation, direction);
+}
+
+Vector3 NativePhysicsBody::rotateToLocal(const Vector3& direction) const
+{
+  return InverseRotate(_rotation, direction);
+}
+
+Vector3 NativePhysicsBody::applyInverseInertia(const Vector3& vector) const
+{
+  auto local = InverseRotate(_rotation, vector);
+  local.multiplyInPlace(_inverseInertia);
+  return Rotate(_rotation, local);
+}
+
+void NativePhysicsBody::computeBoundingBox(Vector3& min, Vector3& max) const
+{
+  const auto& localMin = _shape->localMin();
+  const auto& localMax = _shape->localMax();
+  if (_shape->type() == NativePhysicsShapeType::Sphere) {
+    min = _position.add(localMin);
+    max = _position.add(localMax);
+    return;
+  }
+
+  // Rotated local box: |R| * halfSize around the rotated center
+  const auto& q = _rotation;
+  const auto xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+  const auto xy = q.x * q.y, zw = q.z * q.w, zx = q.z * q.x;
+  const auto yw = q.y * q.w, yz = q.y * q.z, xw = q.x * q.w;
+  const float m[3][3]
+    = {{1.f - 2.f * (yy + zz), 2.f * (xy - zw), 2.f * (zx + yw)},
+       {2.f * (xy + zw), 1.f - 2.f * (zz + xx), 2.f * (yz - xw)},
+       {2.f * (zx - yw), 2.f * (yz + xw), 1.f - 2.f * (yy + xx)}};
+  const auto halfSize = localMax.subtract(localMin).scaleInPlace(0.5f);
+  const auto center   = localToWorld(localMin.add(localMax).scaleInPlace(0.5f));
+  const Vector3 extents(
+    std::abs(m[0][0]) * halfSize.x + std::abs(m[0][1]) * halfSize.y
+      + std::abs(m[0][2]) * halfSize.z,
+    std::abs(m[1][0]) * halfSize.x + std::abs(m[1][1]) * halfSize.y
+      + std::abs(m[1][2]) * halfSize.z,
+    std::abs(m[2][0]) * halfSize.x + std::abs(m[2][1]) * halfSize.y
+      + std::abs(m[2][2]) * halfSize.z);
+  min = center.subtract(extents);
+  max = center.add(extents);
+}
+
+void NativePhysicsBody::_updateMassProperties()
+{
+  if (_mass > 0.f && !_shape->isConvex()) {
+    BABYLON_LOG_WARN("NativePhysicsBody", "Mesh bodies can only be static, the mass is ignored")
+  }
+  if (_mass <= 0.f || !_shape->isConvex()) {
+    _inverseMass = 0.f;
+    _inverseInertia.setAll(0.f);
+    _linearVelocity.setAll(0.f);
+    _angularVelocity.setAll(0.f);
+    return;
+  }
+
+  _inverseMass       = 1.f / _mass;
+  const auto inertia = _shape->computeInertia(_mass);
+  _inverseInertia.x  = inertia.x > 0.f ? 1.f / inertia.x : 0.f;
+  _inverseInertia.y  = inertia.y > 0.f ? 1.f / inertia.y : 0.f;
+  _inverseInertia.z  = inertia.z > 0.f ? 1.f / inertia.z : 0.f;
+}
+
+} // end of namespace BABYLON
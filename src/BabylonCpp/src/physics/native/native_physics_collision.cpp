@@ -0,0 +1,1128 @@
+#include <babylon/physics/native/native_physics_collision.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <babylon/collisions/intersection_info.h>
+#include <babylon/culling/ray.h>
+#include <babylon/culling/triangle_bvh.h>
+#include <babylon/physics/native/native_physics_body.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Maximum number of points of the feature of a shape facing a direction
+constexpr size_t MaxFeaturePoints = 4;
+// Maximum number of points of a clipped contact polygon
+constexpr size_t MaxClippedPoints = 16;
+// Cosine of the angle under which a box face is considered as facing a
+// direction, and sine of the angle under which an edge is (10 degrees)
+constexpr float FaceCosine = 0.985f;
+constexpr float EdgeSine   = 0.17f;
+// GJK termination criteria
+constexpr size_t MaxGjkIterations    = 32;
+constexpr float GjkRelativeTolerance = 1e-5f;
+constexpr float OverlapDistance      = 1e-4f;
+// Conservative advancement criteria of the ray casts against convex hulls
+constexpr size_t MaxRaycastIterations = 64;
+constexpr float RaycastTolerance      = 1e-3f;
+// Squared distance under which a new contact point continues an old one
+constexpr float PersistentDistanceSquared
+  = NativePhysicsCollision::ContactMargin * NativePhysicsCollision::ContactMargin;
+
+using Feature = std::array<Vector3, MaxFeaturePoints>;
+
+/**
+ * @brief Convex core of a body, or a set of world points (a mesh triangle, or
+ * the point of a ray cast), with its inflating radius.
+ */
+struct ConvexProxy {
+  const NativePhysicsBody* body    = nullptr;
+  const NativePhysicsShape* shape  = nullptr;
+  std::array<Vector3, 3> points    = {};
+  size_t pointCount                = 0;
+  float radius                     = 0.f;
+  Vector3 center                   = Vector3::Zero();
+
+  static ConvexProxy FromBody(const NativePhysicsBody& body)
+  {
+    ConvexProxy proxy;
+    proxy.body   = &body;
+    proxy.shape  = body.shape().get();
+    proxy.radius = proxy.shape->radius();
+    proxy.center = body.position();
+    return proxy;
+  }
+
+  static ConvexProxy FromPoints(const Vector3* points, size_t count)
+  {
+    ConvexProxy proxy;
+    proxy.pointCount = count;
+    for (size_t i = 0; i < count; ++i) {
+      proxy.points[i] = points[i];
+      proxy.center.addInPlace(points[i]);
+    }
+    proxy.center.scaleInPlace(1.f / static_cast<float>(count));
+    return proxy;
+  }
+
+  [[nodiscard]] Vector3 support(const Vector3& direction) const
+  {
+    if (body) {
+      return body->localToWorld(shape->supportCore(body->rotateToLocal(direction)));
+    }
+    size_t best  = 0;
+    auto bestDot = Vector3::Dot(points[0], direction);
+    for (size_t i = 1; i < pointCount; ++i) {
+      const auto dot = Vector3::Dot(points[i], direction);
+      if (dot > bestDot) {
+        bestDot = dot;
+        best    = i;
+      }
+    }
+    return points[best];
+  }
+
+  /**
+   * @brief Returns the points of the core feature (vertex, edge or face)
+   * facing a unit world direction, as a convex polygon in world space.
+   */
+  size_t feature(const Vector3& direction, Feature& result) const;
+}; // end of struct ConvexProxy
+
+/**
+ * @brief Orders points as a convex polygon around a normal.
+ */
+void SortPolygon(Vector3* points, size_t count, const Vector3& normal)
+{
+  if (count < 4) {
+    return;
+  }
+  auto center = Vector3::Zero();
+  for (size_t i = 0; i < count; ++i) {
+    center.addInPlace(points[i]);
+  }
+  center.scaleInPlace(1.f / static_cast<float>(count));
+  const auto u = points[0].subtract(center);
+  const auto v = Vector3::Cross(normal, u);
+  std::array<float, MaxFeaturePoints> angles{};
+  for (size_t i = 0; i < count; ++i) {
+    const auto d = points[i].subtract(center);
+    angles[i]    = std::atan2(Vector3::Dot(d, v), Vector3::Dot(d, u));
+  }
+  // Insertion sort, the polygons have at most four points
+  for (size_t i = 1; i < count; ++i) {
+    for (size_t j = i; j > 0 && angles[j] < angles[j - 1]; --j) {
+      std::swap(angles[j], angles[j - 1]);
+      std::swap(points[j], points[j - 1]);
+    }
+  }
+}
+
+/**
+ * @brief Keeps four points of a planar point set spanning the largest area:
+ * the first point, the furthest one from it, the one maximizing the triangle
+ * area, and the one furthest outside of this triangle.
+ */
+template <typename GetPoint>
+std::array<size_t, 4> SelectSpanningPoints(size_t count, size_t first, const GetPoint& point)
+{
+  std::array<size_t, 4> selected = {first, first, first, first};
+  const auto& p0                 = point(first);
+  auto best                      = -1.f;
+  for (size_t i = 0; i < count; ++i) {
+    const auto distance = Vector3::DistanceSquared(point(i), p0);
+    if (distance > best) {
+      best        = distance;
+      selected[1] = i;
+    }
+  }
+  const auto& p1 = point(selected[1]);
+  best           = -1.f;
+  for (size_t i = 0; i < count; ++i) {
+    const auto area = Vector3::Cross(p1.subtract(p0), point(i).subtract(p0)).lengthSquared();
+    if (area > best) {
+      best        = area;
+      selected[2] = i;
+    }
+  }
+  const auto& p2 = point(selected[2]);
+  best           = -1.f;
+  for (size_t i = 0; i < count; ++i) {
+    const auto& p   = point(i);
+    const auto area = Vector3::Cross(p0.subtract(p), p1.subtract(p)).length()
+                      + Vector3::Cross(p1.subtract(p), p2.subtract(p)).length()
+                      + Vector3::Cross(p2.subtract(p), p0.subtract(p)).length();
+    if (area > best) {
+      best        = area;
+      selected[3] = i;
+    }
+  }
+  return selected;
+}
+
+size_t ConvexProxy::feature(const Vector3& direction, Feature& result) const
+{
+  if (!body) {
+    // Points within an angular tolerance of the furthest one
+    auto maxDot = std::numeric_limits<float>::lowest();
+    auto extent = 0.f;
+    for (size_t i = 0; i < pointCount; ++i) {
+      maxDot = std::max(maxDot, Vector3::Dot(points[i], direction));
+      extent = std::max(extent, Vector3::Distance(points[i], points[(i + 1) % pointCount]));
+    }
+    size_t count = 0;
+    for (size_t i = 0; i < pointCount; ++i) {
+      if (Vector3::Dot(points[i], direction) >= maxDot - EdgeSine * extent) {
+        result[count++] = points[i];
+      }
+    }
+    return count;
+  }
+
+  const auto local = body->rotateToLocal(direction);
+  size_t count     = 0;
+  switch (shape->type()) {
+    case NativePhysicsShapeType::Box: {
+      const auto& h      = shape->halfExtents();
+      const auto r       = shape->radius();
+      const float c[3]   = {h.x - r, h.y - r, h.z - r};
+      const float d[3]   = {local.x, local.y, local.z};
+      const float ad[3]  = {std::abs(local.x), std::abs(local.y), std::abs(local.z)};
+      const auto maxAxis = static_cast<size_t>(std::max_element(ad, ad + 3) - ad);
+      const auto minAxis = static_cast<size_t>(std::min_element(ad, ad + 3) - ad);
+      float corner[3]    = {d[0] < 0.f ? -c[0] : c[0], d[1] < 0.f ? -c[1] : c[1],
+                         d[2] < 0.f ? -c[2] : c[2]};
+      if (ad[maxAxis] >= FaceCosine) {
+        // Face, in winding order
+        const auto u     = (maxAxis + 1) % 3;
+        const auto v     = (maxAxis + 2) % 3;
+        const float su[] = {1.f, -1.f, -1.f, 1.f};
+        const float sv[] = {1.f, 1.f, -1.f, -1.f};
+        for (size_t i = 0; i < 4; ++i) {
+          corner[u]       = su[i] * c[u];
+          corner[v]       = sv[i] * c[v];
+          result[count++] = body->localToWorld(Vector3(corner[0], corner[1], corner[2]));
+        }
+      }
+      else if (ad[minAxis] <= EdgeSine) {
+        // Edge
+        for (float s : {1.f, -1.f}) {
+          corner[minAxis] = s * c[minAxis];
+          result[count++] = body->localToWorld(Vector3(corner[0], corner[1], corner[2]));
+        }
+      }
+      else {
+        result[count++] = body->localToWorld(Vector3(corner[0], corner[1], corner[2]));
+      }
+    } break;
+    case NativePhysicsShapeType::Capsule: {
+      const auto halfHeight = shape->halfHeight();
+      if (std::abs(local.y) <= EdgeSine) {
+        result[count++] = body->localToWorld(Vector3(0.f, halfHeight, 0.f));
+        result[count++] = body->localToWorld(Vector3(0.f, -halfHeight, 0.f));
+      }
+      else {
+        result[count++] = body->localToWorld(shape->supportCore(local));
+      }
+    } break;
+    case NativePhysicsShapeType::ConvexHull: {
+      const auto& hullPoints = shape->points();
+      const auto tolerance   = EdgeSine * Vector3::Distance(shape->localMin(), shape->localMax());
+      auto maxDot            = std::numeric_limits<float>::lowest();
+      for (const auto& point : hullPoints) {
+        maxDot = std::max(maxDot, Vector3::Dot(point, local));
+      }
+      std::array<size_t, MaxClippedPoints> candidates{};
+      size_t candidateCount = 0;
+      for (size_t i = 0; i < hullPoints.size() && candidateCount < MaxClippedPoints; ++i) {
+        if (Vector3::Dot(hullPoints[i], local) >= maxDot - tolerance) {
+          candidates[candidateCount++] = i;
+        }
+      }
+      if (candidateCount <= MaxFeaturePoints) {
+        for (size_t i = 0; i < candidateCount; ++i) {
+          result[count++] = body->localToWorld(hullPoints[candidates[i]]);
+        }
+      }
+      else {
+        const auto selected = SelectSpanningPoints(
+          candidateCount, 0, [&](size_t i) -> const Vector3& { return hullPoints[candidates[i]]; });
+        for (auto index : selected) {
+          const auto point = body->localToWorld(hullPoints[candidates[index]]);
+          if (std::find(result.begin(), result.begin() + static_cast<long>(count), point)
+              == result.begin() + static_cast<long>(count)) {
+            result[count++] = point;
+          }
+        }
+      }
+      SortPolygon(result.data(), count, direction);
+    } break;
+    default:
+      result[count++] = body->position();
+      break;
+  }
+  return count;
+}
+
+/** GJK **/
+
+struct SupportPoint {
+  Vector3 w;
+  Vector3 a;
+  Vector3 b;
+}; // end of struct SupportPoint
+
+struct Simplex {
+  std::array<SupportPoint, 4> points;
+  std::array<float, 4> weights = {};
+  size_t count                 = 0;
+}; // end of struct Simplex
+
+struct GjkResult {
+  bool overlap = false;
+  Vector3 pointA;
+  Vector3 pointB;
+  float distance = 0.f;
+}; // end of struct GjkResult
+
+inline SupportPoint MakeSupportPoint(const ConvexProxy& a, const ConvexProxy& b,
+                                     const Vector3& direction)
+{
+  SupportPoint point;
+  point.a = a.support(direction);
+  point.b = b.support(direction.negate());
+  point.w = point.a.subtract(point.b);
+  return point;
+}
+
+void KeepSimplex(Simplex& simplex, std::initializer_list<size_t> indices,
+                 std::initializer_list<float> weights)
+{
+  std::array<SupportPoint, 4> points;
+  size_t count = 0;
+  for (auto index : indices) {
+    points[count++] = simplex.points[index];
+  }
+  std::copy(points.begin(), points.begin() + static_cast<long>(count), simplex.points.begin());
+  std::copy(weights.begin(), weights.end(), simplex.weights.begin());
+  simplex.count = count;
+}
+
+void SolveSegment(Simplex& simplex, size_t ia, size_t ib)
+{
+  const auto& a       = simplex.points[ia].w;
+  const auto ab       = simplex.points[ib].w.subtract(a);
+  const auto abLength = ab.lengthSquared();
+  const auto t        = abLength > 0.f ? -Vector3::Dot(a, ab) / abLength : 0.f;
+  if (t <= 0.f) {
+    KeepSimplex(simplex, {ia}, {1.f});
+  }
+  else if (t >= 1.f) {
+    KeepSimplex(simplex, {ib}, {1.f});
+  }
+  else {
+    KeepSimplex(simplex, {ia, ib}, {1.f - t, t});
+  }
+}
+
+// Closest point of a triangle to the origin (Ericson, Real-Time Collision
+// Detection, 5.1.5)
+void SolveTriangle(Simplex& simplex, size_t ia, size_t ib, size_t ic)
+{
+  const auto& a = simplex.points[ia].w;
+  const auto& b = simplex.points[ib].w;
+  const auto& c = simplex.points[ic].w;
+  const auto ab = b.subtract(a);
+  const auto ac = c.subtract(a);
+
+  const auto d1 = -Vector3::Dot(ab, a);
+  const auto d2 = -Vector3::Dot(ac, a);
+  if (d1 <= 0.f && d2 <= 0.f) {
+    KeepSimplex(simplex, {ia}, {1.f});
+    return;
+  }
+  const auto d3 = -Vector3::Dot(ab, b);
+  const auto d4 = -Vector3::Dot(ac, b);
+  if (d3 >= 0.f && d4 <= d3) {
+    KeepSimplex(simplex, {ib}, {1.f});
+    return;
+  }
+  const auto vc = d1 * d4 - d3 * d2;
+  if (vc <= 0.f && d1 >= 0.f && d3 <= 0.f) {
+    const auto v = d1 / (d1 - d3);
+    KeepSimplex(simplex, {ia, ib}, {1.f - v, v});
+    return;
+  }
+  const auto d5 = -Vector3::Dot(ab, c);
+  const auto d6 = -Vector3::Dot(ac, c);
+  if (d6 >= 0.f && d5 <= d6) {
+    KeepSimplex(simplex, {ic}, {1.f});
+    return;
+  }
+  const auto vb = d5 * d2 - d1 * d6;
+  if (vb <= 0.f && d2 >= 0.f && d6 <= 0.f) {
+    const auto w = d2 / (d2 - d6);
+    KeepSimplex(simplex, {ia, ic}, {1.f - w, w});
+    return;
+  }
+  const auto va = d3 * d6 - d5 * d4;
+  if (va <= 0.f && (d4 - d3) >= 0.f && (d5 - d6) >= 0.f) {
+    const auto w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+    KeepSimplex(simplex, {ib, ic}, {1.f - w, w});
+    return;
+  }
+  const auto sum = va + vb + vc;
+  if (sum <= std::numeric_limits<float>::min()) {
+    // Degenerate triangle
+    SolveSegment(simplex, ia, ib);
+    return;
+  }
+  const auto v = vb / sum;
+  const auto w = vc / sum;
+  KeepSimplex(simplex, {ia, ib, ic}, {1.f - v - w, v, w});
+}
+
+inline Vector3 ClosestPoint(const Simplex& simplex)
+{
+  auto point = Vector3::Zero();
+  for (size_t i = 0; i < simplex.count; ++i) {
+    point.addInPlace(simplex.points[i].w.scale(simplex.weights[i]));
+  }
+  return point;
+}
+
+/**
+ * @brief Reduces the simplex to its feature closest to the origin.
+ * @returns false when the origin is inside the tetrahedron
+ */
+bool SolveSimplex(Simplex& simplex)
+{
+  switch (simplex.count) {
+    case 1:
+      simplex.weights[0] = 1.f;
+      return true;
+    case 2:
+      SolveSegment(simplex, 0, 1);
+      return true;
+    case 3:
+      SolveTriangle(simplex, 0, 1, 2);
+      return true;
+    default:
+      break;
+  }
+
+  // Tetrahedron: closest point of the faces separating the origin from the
+  // opposite vertex
+  static constexpr std::array<std::array<size_t, 4>, 4> faces
+    = {{{0, 1, 2, 3}, {0, 2, 3, 1}, {0, 3, 1, 2}, {1, 3, 2, 0}}};
+  auto bestDistance = std::numeric_limits<float>::max();
+  Simplex best;
+  bool outside = false;
+  for (const auto& face : faces) {
+    const auto& a     = simplex.points[face[0]].w;
+    const auto normal = Vector3::Cross(simplex.points[face[1]].w.subtract(a),
+                                       simplex.points[face[2]].w.subtract(a));
+    const auto origin   = -Vector3::Dot(a, normal);
+    const auto opposite = Vector3::Dot(simplex.points[face[3]].w.subtract(a), normal);
+    if (origin * opposite > 0.f) {
+      continue;
+    }
+    outside   = true;
+    auto copy = simplex;
+    SolveTriangle(copy, face[0], face[1], face[2]);
+    const auto distance = ClosestPoint(copy).lengthSquared();
+    if (distance < bestDistance) {
+      bestDistance = distance;
+      best         = copy;
+    }
+  }
+  if (!outside) {
+    return false;
+  }
+  simplex = best;
+  return true;
+}
+
+GjkResult Gjk(const ConvexProxy& a, const ConvexProxy& b)
+{
+  GjkResult result;
+  Simplex simplex;
+
+  auto direction = b.center.subtract(a.center);
+  if (direction.lengthSquared() < OverlapDistance * OverlapDistance) {
+    direction.copyFromFloats(1.f, 0.f, 0.f);
+  }
+  simplex.points[0]  = MakeSupportPoint(a, b, direction);
+  simplex.weights[0] = 1.f;
+  simplex.count      = 1;
+  auto v             = simplex.points[0].w;
+  auto vv            = v.lengthSquared();
+
+  for (size_t iteration = 0; iteration < MaxGjkIterations; ++iteration) {
+    if (vv <= OverlapDistance * OverlapDistance) {
+      result.overlap = true;
+      return result;
+    }
+    const auto point = MakeSupportPoint(a, b, v.negate());
+    if (vv - Vector3::Dot(v, point.w) <= GjkRelativeTolerance * vv) {
+      break;
+    }
+    const auto previous             = simplex;
+    simplex.points[simplex.count++] = point;
+    if (!SolveSimplex(simplex)) {
+      result.overlap = true;
+      return result;
+    }
+    // Rounding errors on nearly degenerate simplices (flat faces of large
+    // shapes) can lead to a worse closest point, the previous one is kept
+    const auto closest = ClosestPoint(simplex);
+    if (closest.lengthSquared() >= vv) {
+      simplex = previous;
+      break;
+    }
+    v  = closest;
+    vv = closest.lengthSquared();
+  }
+
+  result.pointA = Vector3::Zero();
+  result.pointB = Vector3::Zero();
+  for (size_t i = 0; i < simplex.count; ++i) {
+    result.pointA.addInPlace(simplex.points[i].a.scale(simplex.weights[i]));
+    result.pointB.addInPlace(simplex.points[i].b.scale(simplex.weights[i]));
+  }
+  result.distance = std::sqrt(vv);
+  result.overlap  = result.distance <= OverlapDistance;
+  return result;
+}
+
+/** Separating axis fallback for overlapping cores **/
+
+size_t AppendAxes(const ConvexProxy& proxy, Vector3* axes)
+{
+  if (!proxy.body) {
+    // Edges of the triangle or of the segment
+    const auto count = proxy.pointCount == 3 ? 3 : proxy.pointCount - 1;
+    for (size_t i = 0; i < count; ++i) {
+      axes[i] = proxy.points[(i + 1) % proxy.pointCount].subtract(proxy.points[i]);
+    }
+    return count;
+  }
+  switch (proxy.shape->type()) {
+    case NativePhysicsShapeType::Box:
+    case NativePhysicsShapeType::ConvexHull:
+      axes[0] = proxy.body->rotateToWorld(Vector3(1.f, 0.f, 0.f));
+      axes[1] = proxy.body->rotateToWorld(Vector3(0.f, 1.f, 0.f));
+      axes[2] = proxy.body->rotateToWorld(Vector3(0.f, 0.f, 1.f));
+      return 3;
+    case NativePhysicsShapeType::Capsule:
+      axes[0] = proxy.body->rotateToWorld(Vector3(0.f, 1.f, 0.f));
+      return 1;
+    default:
+      return 0;
+  }
+}
+
+/**
+ * @brief Finds the axis of least penetration among the center direction, the
+ * face normals of the shapes and the cross products of their edges.
+ */
+void SeparatingAxis(const ConvexProxy& a, const ConvexProxy& b, const Vector3* extraAxis,
+                    Vector3& normal, float& separation)
+{
+  std::array<Vector3, 3> axesA, axesB;
+  const auto countA = AppendAxes(a, axesA.data());
+  const auto countB = AppendAxes(b, axesB.data());
+
+  std::array<Vector3, 17> axes;
+  size_t count  = 0;
+  axes[count++] = b.center.subtract(a.center);
+  if (extraAxis) {
+    axes[count++] = *extraAxis;
+  }
+  for (size_t i = 0; i < countA; ++i) {
+    axes[count++] = axesA[i];
+  }
+  for (size_t i = 0; i < countB; ++i) {
+    axes[count++] = axesB[i];
+  }
+  for (size_t i = 0; i < countA; ++i) {
+    for (size_t j = 0; j < countB; ++j) {
+      axes[count++] = Vector3::Cross(axesA[i], axesB[j]);
+    }
+  }
+
+  auto bestDepth = std::numeric_limits<float>::max();
+  normal.copyFromFloats(0.f, 1.f, 0.f);
+  for (size_t i = 0; i < count; ++i) {
+    const auto length = axes[i].length();
+    if (length < 1e-6f) {
+      continue;
+    }
+    for (float sign : {1.f, -1.f}) {
+      const auto n     = axes[i].scale(sign / length);
+      const auto depth = Vector3::Dot(a.support(n), n) + a.radius
+                         - Vector3::Dot(b.support(n.negate()), n) + b.radius;
+      if (depth < bestDepth) {
+        bestDepth = depth;
+        normal    = n;
+      }
+    }
+  }
+  separation = -bestDepth;
+}
+
+/** Contact polygons **/
+
+struct Candidate {
+  Vector3 pointA;
+  Vector3 pointB;
+  Vector3 normal;
+  float separation;
+}; // end of struct Candidate
+
+/**
+ * @brief Computes the normal of a feature polygon (Newell's method), oriented
+ * along a direction.
+ * @returns the cosine between the normal and the direction, 0 for segments and
+ * points
+ */
+float FeatureNormal(const Feature& feature, size_t count, const Vector3& direction,
+                    Vector3& normal)
+{
+  if (count < 3) {
+    return 0.f;
+  }
+  normal = Vector3::Zero();
+  for (size_t i = 0; i < count; ++i) {
+    normal.addInPlace(Vector3::Cross(feature[i], feature[(i + 1) % count]));
+  }
+  const auto length = normal.length();
+  if (length <= 0.f) {
+    return 0.f;
+  }
+  normal.scaleInPlace(1.f / length);
+  if (Vector3::Dot(normal, direction) < 0.f) {
+    normal.negateInPlace();
+  }
+  return Vector3::Dot(normal, direction);
+}
+
+/**
+ * @brief Clips a convex polygon (or a segment, or a point) by a plane,
+ * keeping the points on the side of the plane normal.
+ */
+size_t ClipPolygon(const Vector3* input, size_t count, const Vector3& planePoint,
+                   const Vector3& planeNormal, Vector3* output)
+{
+  if (count == 0) {
+    return 0;
+  }
+  const auto distance = [&](const Vector3& p) {
+    return Vector3::Dot(p.subtract(planePoint), planeNormal);
+  };
+  if (count == 1) {
+    if (distance(input[0]) < 0.f) {
+      return 0;
+    }
+    output[0] = input[0];
+    return 1;
+  }
+  size_t outputCount = 0;
+  const auto edges   = count == 2 ? 1 : count;
+  if (count == 2 && distance(input[0]) >= 0.f) {
+    output[outputCount++] = input[0];
+  }
+  for (size_t i = 0; i < edges; ++i) {
+    const auto& p = input[i];
+    const auto& q = input[(i + 1) % count];
+    const auto dp = distance(p);
+    const auto dq = distance(q);
+    if ((dp < 0.f) != (dq < 0.f)) {
+      output[outputCount++] = Vector3::Lerp(p, q, dp / (dp - dq));
+    }
+    if (dq >= 0.f && outputCount < MaxClippedPoints) {
+      output[outputCount++] = q;
+    }
+  }
+  return std::min(outputCount, MaxClippedPoints);
+}
+
+/**
+ * @brief Computes the contact points between two convex proxies.
+ * @param extraAxis defines an additional candidate separating axis
+ */
+void ConvexContacts(const ConvexProxy& a, const ConvexProxy& b, const Vector3* extraAxis,
+                    std::vector<Candidate>& candidates)
+{
+  Vector3 normal;
+  float separation;
+  const auto gjk = Gjk(a, b);
+  if (!gjk.overlap) {
+    separation = gjk.distance - a.radius - b.radius;
+    if (separation > NativePhysicsCollision::ContactMargin) {
+      return;
+    }
+    normal = gjk.pointB.subtract(gjk.pointA).scaleInPlace(1.f / gjk.distance);
+  }
+  else {
+    SeparatingAxis(a, b, extraAxis, normal, separation);
+    if (separation > NativePhysicsCollision::ContactMargin) {
+      return;
+    }
+  }
+  const auto negatedNormal = normal.negate();
+  const auto witnessA      = a.support(normal).addInPlace(normal.scale(a.radius));
+  const auto witnessB      = b.support(negatedNormal).addInPlace(normal.scale(-b.radius));
+  const auto offsetA       = Vector3::Dot(witnessA, normal);
+  const auto offsetB       = Vector3::Dot(witnessB, normal);
+
+  Feature featureA, featureB;
+  const auto countA = a.feature(normal, featureA);
+  const auto countB = b.feature(negatedNormal, featureB);
+  const auto before = candidates.size();
+  if (countA >= 3 || countB >= 3 || (countA == 2 && countB == 2)) {
+    // Clip the incident feature by the side planes of the reference one, which
+    // is the face best aligned with the normal
+    Vector3 faceNormalA, faceNormalB;
+    const auto cosineA        = FeatureNormal(featureA, countA, normal, faceNormalA);
+    const auto cosineB        = FeatureNormal(featureB, countB, negatedNormal, faceNormalB);
+    const auto referenceIsB   = cosineB > cosineA || (cosineB == cosineA && countB >= countA);
+    const auto& reference     = referenceIsB ? featureB : featureA;
+    const auto referenceCount = referenceIsB ? countB : countA;
+    const auto& incident      = referenceIsB ? featureA : featureB;
+    const auto incidentCount  = referenceIsB ? countA : countB;
+    const auto incidentOffset = referenceIsB ? normal.scale(a.radius) : normal.scale(-b.radius);
+    // The separations are measured along the normal up to the reference face,
+    // or up to the support plane of the reference body for edges and faces
+    // too tilted
+    const auto& faceNormal = referenceIsB ? faceNormalB : faceNormalA;
+    const auto cosine      = referenceIsB ? cosineB : cosineA;
+    const auto facePoint
+      = reference[0].add(faceNormal.scale(referenceIsB ? b.radius : a.radius));
+    const auto separationTo = [&](const Vector3& p) {
+      if (cosine < 0.5f) {
+        return referenceIsB ? offsetB - Vector3::Dot(p, normal) :
+                              Vector3::Dot(p, normal) - offsetA;
+      }
+      return Vector3::Dot(p.subtract(facePoint), faceNormal) / cosine;
+    };
+    std::array<Vector3, MaxClippedPoints> polygon, clipped;
+    size_t polygonCount = incidentCount;
+    for (size_t i = 0; i < incidentCount; ++i) {
+      polygon[i] = incident[i].add(incidentOffset);
+    }
+    auto referenceCenter = Vector3::Zero();
+    for (size_t i = 0; i < referenceCount; ++i) {
+      referenceCenter.addInPlace(reference[i]);
+    }
+    referenceCenter.scaleInPlace(1.f / static_cast<float>(referenceCount));
+    const auto planeCount = referenceCount == 2 ? 2 : referenceCount;
+    for (size_t i = 0; i < planeCount && polygonCount > 0; ++i) {
+      const auto& p = reference[i];
+      auto planeNormal
+        = referenceCount == 2 ?
+            reference[1 - i].subtract(p) :
+            Vector3::Cross(normal, reference[(i + 1) % referenceCount].subtract(p));
+      if (Vector3::Dot(planeNormal, referenceCenter.subtract(p)) < 0.f) {
+        planeNormal.negateInPlace();
+      }
+      polygonCount = ClipPolygon(polygon.data(), polygonCount, p, planeNormal, clipped.data());
+      std::swap(polygon, clipped);
+    }
+    for (size_t i = 0; i < polygonCount; ++i) {
+      const auto& p = polygon[i];
+      Candidate candidate;
+      candidate.normal     = normal;
+      candidate.separation = separationTo(p);
+      if (referenceIsB) {
+        candidate.pointA = p;
+        candidate.pointB = p.add(normal.scale(candidate.separation));
+      }
+      else {
+        candidate.pointB = p;
+        candidate.pointA = p.subtract(normal.scale(candidate.separation));
+      }
+      // Points deeper than the penetration of the shapes come from features
+      // which are not facing each other
+      if (candidate.separation <= NativePhysicsCollision::ContactMargin
+          && candidate.separation >= separation - NativePhysicsCollision::ContactMargin) {
+        candidates.emplace_back(candidate);
+      }
+    }
+  }
+  if (candidates.size() == before) {
+    candidates.emplace_back(Candidate{witnessA, witnessB, normal, offsetB - offsetA});
+  }
+}
+
+/**
+ * @brief Computes the contact points between a convex body and the triangles
+ * of a mesh body overlapping it.
+ */
+void MeshContacts(const NativePhysicsBody& convex, const NativePhysicsBody& mesh,
+                  std::vector<Candidate>& candidates)
+{
+  const auto& shape = *mesh.shape();
+  const auto* bvh   = shape.triangleBVH();
+  if (!bvh) {
+    return;
+  }
+
+  // Bounding box of the convex body in the local space of the mesh
+  Vector3 worldMin, worldMax;
+  convex.computeBoundingBox(worldMin, worldMax);
+  const auto margin   = NativePhysicsCollision::ContactMargin;
+  const auto maxFloat = std::numeric_limits<float>::max();
+  auto localMin       = Vector3(maxFloat, maxFloat, maxFloat);
+  auto localMax       = Vector3(-maxFloat, -maxFloat, -maxFloat);
+  for (unsigned int corner = 0; corner < 8; ++corner) {
+    const Vector3 point((corner & 1) ? worldMax.x + margin : worldMin.x - margin,
+                        (corner & 2) ? worldMax.y + margin : worldMin.y - margin,
+                        (corner & 4) ? worldMax.z + margin : worldMin.z - margin);
+    const auto local = mesh.worldToLocal(point);
+    localMin         = Vector3::Minimize(localMin, local);
+    localMax         = Vector3::Maximize(localMax, local);
+  }
+
+  thread_local std::vector<uint32_t> faceIds;
+  faceIds.clear();
+  bvh->queryBox(localMin, localMax, faceIds);
+
+  const auto proxy      = ConvexProxy::FromBody(convex);
+  const auto& positions = shape.points();
+  const auto& indices   = shape.indices();
+  for (auto faceId : faceIds) {
+    std::array<Vector3, 3> triangle;
+    for (size_t i = 0; i < 3; ++i) {
+      triangle[i] = mesh.localToWorld(positions[indices[faceId * 3 + i]]);
+    }
+    auto triangleNormal
+      = Vector3::Cross(triangle[1].subtract(triangle[0]), triangle[2].subtract(triangle[0]));
+    if (triangleNormal.lengthSquared() <= 0.f) {
+      continue;
+    }
+    triangleNormal.normalize();
+    ConvexContacts(proxy, ConvexProxy::FromPoints(triangle.data(), 3), &triangleNormal,
+                   candidates);
+  }
+}
+
+/** Ray casts **/
+
+bool RaycastSphere(const Vector3& center, float radius, const Vector3& from, const Vector3& d,
+                   float& fraction)
+{
+  const auto m = from.subtract(center);
+  const auto a = Vector3::Dot(d, d);
+  const auto b = Vector3::Dot(m, d);
+  const auto c = Vector3::Dot(m, m) - radius * radius;
+  if (a <= 0.f || c <= 0.f) {
+    return false;
+  }
+  const auto discriminant = b * b - a * c;
+  if (b > 0.f || discriminant < 0.f) {
+    return false;
+  }
+  const auto t = (-b - std::sqrt(discriminant)) / a;
+  if (t < 0.f || t > 1.f) {
+    return false;
+  }
+  fraction = t;
+  return true;
+}
+
+bool RaycastBox(const Vector3& halfExtents, const Vector3& from, const Vector3& d,
+                float& fraction, Vector3& normal)
+{
+  const float o[3] = {from.x, from.y, from.z};
+  const float v[3] = {d.x, d.y, d.z};
+  const float h[3] = {halfExtents.x, halfExtents.y, halfExtents.z};
+  auto tMin        = 0.f;
+  auto tMax        = 1.f;
+  int axis         = -1;
+  auto sign        = 0.f;
+  for (int i = 0; i < 3; ++i) {
+    if (std::abs(v[i]) < 1e-12f) {
+      if (o[i] < -h[i] || o[i] > h[i]) {
+        return false;
+      }
+      continue;
+    }
+    const auto inverse = 1.f / v[i];
+    auto t1            = (-h[i] - o[i]) * inverse;
+    auto t2            = (h[i] - o[i]) * inverse;
+    auto s             = -1.f;
+    if (t1 > t2) {
+      std::swap(t1, t2);
+      s = 1.f;
+    }
+    if (t1 > tMin) {
+      tMin = t1;
+      axis = i;
+      sign = s;
+    }
+    tMax = std::min(tMax, t2);
+    if (tMin > tMax) {
+      return false;
+    }
+  }
+  if (axis < 0) {
+    // The segment starts inside of the box
+    return false;
+  }
+  fraction = tMin;
+  normal.copyFromFloats(axis == 0 ? sign : 0.f, axis == 1 ? sign : 0.f, axis == 2 ? sign : 0.f);
+  return true;
+}
+
+bool RaycastCapsule(float radius, float halfHeight, const Vector3& from, const Vector3& d,
+                    float& fraction, Vector3& normal)
+{
+  auto found = false;
+  // Cylindrical part
+  const auto a = d.x * d.x + d.z * d.z;
+  const auto b = from.x * d.x + from.z * d.z;
+  const auto c = from.x * from.x + from.z * from.z - radius * radius;
+  if (a > 0.f && c > 0.f) {
+    const auto discriminant = b * b - a * c;
+    if (discriminant >= 0.f) {
+      const auto t = (-b - std::sqrt(discriminant)) / a;
+      const auto y = from.y + t * d.y;
+      if (t >= 0.f && t <= 1.f && y >= -halfHeight && y <= halfHeight) {
+        fraction = t;
+        normal.copyFromFloats(from.x + t * d.x, 0.f, from.z + t * d.z);
+        found = true;
+      }
+    }
+  }
+  // Spherical caps
+  for (float sign : {1.f, -1.f}) {
+    const Vector3 center(0.f, sign * halfHeight, 0.f);
+    float t;
+    if (RaycastSphere(center, radius, from, d, t) && (!found || t < fraction)) {
+      fraction = t;
+      normal   = from.add(d.scale(t)).subtractInPlace(center);
+      found    = true;
+    }
+  }
+  if (found) {
+    normal.normalize();
+  }
+  return found;
+}
+
+bool RaycastConvexHull(const NativePhysicsBody& body, const Vector3& from, const Vector3& to,
+                       float& fraction, Vector3& normal)
+{
+  // Conservative advancement: the segment can advance by the distance to the
+  // hull without crossing it
+  const auto hull   = ConvexProxy::FromBody(body);
+  const auto d      = to.subtract(from);
+  const auto length = d.length();
+  if (length <= 0.f) {
+    return false;
+  }
+  auto t = 0.f;
+  for (size_t iteration = 0; iteration < MaxRaycastIterations; ++iteration) {
+    const auto point  = from.add(d.scale(t));
+    const auto result = Gjk(ConvexProxy::FromPoints(&point, 1), hull);
+    if (result.overlap) {
+      return false;
+    }
+    if (result.distance <= RaycastTolerance) {
+      if (iteration == 0) {
+        return false;
+      }
+      fraction = t;
+      return true;
+    }
+    normal = result.pointA.subtract(result.pointB).scaleInPlace(1.f / result.distance);
+    // Moving away from the hull
+    if (Vector3::Dot(normal, d) >= 0.f) {
+      return false;
+    }
+    t += result.distance / length;
+    if (t > 1.f) {
+      return false;
+    }
+  }
+  return false;
+}
+
+} // end of anonymous namespace
+
+void NativePhysicsCollision::UpdateManifold(NativePhysicsManifold& manifold)
+{
+  thread_local std::vector<Candidate> candidates;
+  candidates.clear();
+
+  auto* bodyA    = manifold.bodyA;
+  auto* bodyB    = manifold.bodyB;
+  const auto& sA = *bodyA->shape();
+  const auto& sB = *bodyB->shape();
+  if (sA.isConvex() && sB.isConvex()) {
+    if (sA.type() == NativePhysicsShapeType::Sphere
+        && sB.type() == NativePhysicsShapeType::Sphere) {
+      auto delta            = bodyB->position().subtract(bodyA->position());
+      const auto distance   = delta.length();
+      const auto separation = distance - sA.radius() - sB.radius();
+      if (separation <= ContactMargin) {
+        const auto normal
+          = distance > OverlapDistance ? delta.scaleInPlace(1.f / distance) : Vector3::Up();
+        candidates.emplace_back(
+          Candidate{bodyA->position().add(normal.scale(sA.radius())),
+                    bodyB->position().subtract(normal.scale(sB.radius())), normal, separation});
+      }
+    }
+    else {
+      ConvexContacts(ConvexProxy::FromBody(*bodyA), ConvexProxy::FromBody(*bodyB), nullptr,
+                     candidates);
+    }
+  }
+  else if (sA.isConvex()) {
+    MeshContacts(*bodyA, *bodyB, candidates);
+  }
+  else if (sB.isConvex()) {
+    MeshContacts(*bodyB, *bodyA, candidates);
+    for (auto& candidate : candidates) {
+      std::swap(candidate.pointA, candidate.pointB);
+      candidate.normal.negateInPlace();
+    }
+  }
+
+  // Coincident points (produced by the triangles sharing an edge) are merged
+  for (size_t i = 0; i < candidates.size(); ++i) {
+    for (size_t j = candidates.size() - 1; j > i; --j) {
+      if (Vector3::DistanceSquared(candidates[i].pointB, candidates[j].pointB)
+          < PersistentDistanceSquared) {
+        if (candidates[j].separation < candidates[i].separation) {
+          candidates[i] = candidates[j];
+        }
+        candidates.erase(candidates.begin() + static_cast<long>(j));
+      }
+    }
+  }
+
+  // Reduction to the deepest point and the points spanning the largest area
+  std::array<size_t, NativePhysicsManifold::MaxPoints> selected{};
+  size_t selectedCount = 0;
+  if (candidates.size() <= NativePhysicsManifold::MaxPoints) {
+    for (size_t i = 0; i < candidates.size(); ++i) {
+      selected[selectedCount++] = i;
+    }
+  }
+  else {
+    size_t deepest = 0;
+    for (size_t i = 1; i < candidates.size(); ++i) {
+      if (candidates[i].separation < candidates[deepest].separation) {
+        deepest = i;
+      }
+    }
+    const auto spanning = SelectSpanningPoints(
+      candidates.size(), deepest, [](size_t i) -> const Vector3& { return candidates[i].pointB; });
+    for (auto index : spanning) {
+      if (std::find(selected.begin(), selected.begin() + static_cast<long>(selectedCount), index)
+          == selected.begin() + static_cast<long>(selectedCount)) {
+        selected[selectedCount++] = index;
+      }
+    }
+  }
+
+  // Warm starting: new points close to old ones inherit their impulses
+  const auto oldPoints = manifold.points;
+  const auto oldCount  = manifold.pointCount;
+  std::array<bool, NativePhysicsManifold::MaxPoints> used{};
+  manifold.pointCount = selectedCount;
+  for (size_t i = 0; i < selectedCount; ++i) {
+    const auto& candidate = candidates[selected[i]];
+    auto& point           = manifold.points[i];
+    point                 = NativePhysicsContactPoint();
+    point.pointA          = candidate.pointA;
+    point.pointB          = candidate.pointB;
+    point.normal          = candidate.normal;
+    point.separation      = candidate.separation;
+    point.localPointA     = bodyA->worldToLocal(candidate.pointA);
+    point.localPointB     = bodyB->worldToLocal(candidate.pointB);
+    auto bestDistance     = PersistentDistanceSquared;
+    size_t best           = oldCount;
+    for (size_t j = 0; j < oldCount; ++j) {
+      const auto distance
+        = Vector3::DistanceSquared(oldPoints[j].localPointA, point.localPointA);
+      if (!used[j] && distance < bestDistance) {
+        bestDistance = distance;
+        best         = j;
+      }
+    }
+    if (best < oldCount) {
+      used[best]            = true;
+      point.normalImpulse   = oldPoints[best].normalImpulse;
+      point.tangentImpulse1 = oldPoints[best].tangentImpulse1;
+      point.tangentImpulse2 = oldPoints[best].tangentImpulse2;
+    }
+  }
+}
+
+bool NativePhysicsCollision::Raycast(const NativePhysicsBody& body, const Vector3& from,
+                                     const Vector3& to, float& fraction, Vector3& normal)
+{
+  const auto& shape    = *body.shape();
+  const auto localFrom = body.worldToLocal(from);
+  const auto localTo   = body.worldToLocal(to);
+  const auto d         = localTo.subtract(localFrom);
+  auto hit             = false;
+  Vector3 localNormal;
+  switch (shape.type()) {
+    case NativePhysicsShapeType::Sphere:
+      hit = RaycastSphere(Vector3::Zero(), shape.radius(), localFrom, d, fraction);
+      if (hit) {
+        localNormal = localFrom.add(d.scale(fraction)).normalize();
+      }
+      break;
+    case NativePhysicsShapeType::Box:
+      hit = RaycastBox(shape.halfExtents(), localFrom, d, fraction, localNormal);
+      break;
+    case NativePhysicsShapeType::Capsule:
+      hit = RaycastCapsule(shape.radius(), shape.halfHeight(), localFrom, d, fraction,
+                           localNormal);
+      break;
+    case NativePhysicsShapeType::ConvexHull:
+      // Works in world space
+      if (RaycastConvexHull(body, from, to, fraction, normal)) {
+        return true;
+      }
+      return false;
+    case NativePhysicsShapeType::Mesh: {
+      const auto length = d.length();
+      if (!shape.triangleBVH() || length <= 0.f) {
+        return false;
+      }
+      Ray ray(localFrom, d.scale(1.f / length), length);
+      const auto info = shape.triangleBVH()->intersects(ray, shape.points(), shape.indices(),
+                                                        false, nullptr);
+      if (!info || info->distance > length) {
+        return false;
+      }
+      const auto& positions = shape.points();
+      const auto& indices   = shape.indices();
+      const auto& p0        = positions[indices[info->faceId * 3]];
+      const auto& p1        = positions[indices[info->faceId * 3 + 1]];
+      const auto& p2        = positions[indices[info->faceId * 3 + 2]];
+      localNormal           = Vector3::Cross(p1.subtract(p0), p2.subtract(p0)).normalize();
+      if (Vector3::Dot(localNormal, d) > 0.f) {
+        localNormal.negateInPlace();
+      }
+      fraction = info->distance / length;
+      hit      = true;
+    } break;
+  }
+  if (hit) {
+    normal = body.rotateToWorld(localNormal);
+  }
+  return hit;
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,553 @@
+#include <babylon/physics/native/native_physics_plugin.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <babylon/core/logging.h>
+#include <babylon/meshes/abstract_mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/physics/iphysics_enabled_object.h>
+#include <babylon/physics/joint/distance_joint.h>
+#include <babylon/physics/joint/physics_joint.h>
+#include <babylon/physics/native/native_physics_body.h>
+#include <babylon/physics/native/native_physics_world.h>
+#include <babylon/physics/physics_impostor.h>
+#include <babylon/physics/physics_impostor_joint.h>
+#include <babylon/physics/physics_raycast_result.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Smallest size of a shape along an axis
+constexpr float MinShapeSize = 1e-3f;
+
+// Changes of the transformation of a body under which it is not updated from
+// its object
+constexpr float TransformEpsilon = 1e-6f;
+
+std::vector<Vector3> ScaledPositions(AbstractMesh* mesh)
+{
+  std::vector<Vector3> points;
+  const auto positions = mesh->getVerticesData(VertexBuffer::PositionKind);
+  const auto& scaling  = mesh->absoluteScaling();
+  points.reserve(positions.size() / 3);
+  for (size_t i = 0; i + 2 < positions.size(); i += 3) {
+    points.emplace_back(positions[i] * scaling.x, positions[i + 1] * scaling.y,
+                        positions[i + 2] * scaling.z);
+  }
+  return points;
+}
+
+NativePhysicsShapePtr CreateShape(PhysicsImpostor& impostor)
+{
+  auto* object = impostor.object;
+  switch (impostor.physicsImposterType) {
+    case PhysicsImpostor::SphereImpostor: {
+      const auto size = impostor.getObjectExtendSize();
+      return NativePhysicsShape::CreateSphere(
+        std::max({size.x, size.y, size.z, MinShapeSize}) * 0.5f);
+    }
+    case PhysicsImpostor::BoxImpostor:
+    case PhysicsImpostor::PlaneImpostor: {
+      const auto size = impostor.getObjectExtendSize();
+      return NativePhysicsShape::CreateBox(Vector3(std::max(size.x, MinShapeSize) * 0.5f,
+                                                   std::max(size.y, MinShapeSize) * 0.5f,
+                                                   std::max(size.z, MinShapeSize) * 0.5f));
+    }
+    case PhysicsImpostor::CapsuleImpostor: {
+      const auto size   = impostor.getObjectExtendSize();
+      const auto radius = std::max({size.x, size.z, MinShapeSize}) * 0.5f;
+      return NativePhysicsShape::CreateCapsule(radius, std::max(size.y * 0.5f - radius, 0.f));
+    }
+    case PhysicsImpostor::CylinderImpostor:
+    case PhysicsImpostor::ConvexHullImpostor: {
+      auto points = ScaledPositions(object);
+      if (points.empty()) {
+        return nullptr;
+      }
+      return NativePhysicsShape::CreateConvexHull(points);
+    }
+    case PhysicsImpostor::MeshImpostor: {
+      auto points = ScaledPositions(object);
+      auto indices = object->getIndices();
+      if (points.empty() || indices.size() < 3) {
+        return nullptr;
+      }
+      return NativePhysicsShape::CreateMesh(points, indices);
+    }
+    default:
+      return nullptr;
+  }
+}
+
+} // end of anonymous namespace
+
+NativePhysicsPlugin::NativePhysicsPlugin(bool useDeltaForWorldStep, size_t iterations)
+    : _useDeltaForWorldStep{useDeltaForWorldStep}
+    , _fixedTimeStep{1.f / 60.f}
+    , _timeAccumulator{0.f}
+    , _world{std::make_unique<NativePhysicsWorld>()}
+{
+  world = nullptr;
+  name  = "NativePhysicsPlugin";
+  _world->setSolverIterations(iterations);
+}
+
+NativePhysicsPlugin::~NativePhysicsPlugin() = default;
+
+NativePhysicsWorld& NativePhysicsPlugin::physicsWorld()
+{
+  return *_world;
+}
+
+void NativePhysicsPlugin::setGravity(const Vector3& gravity)
+{
+  _world->setGravity(gravity);
+}
+
+void NativePhysicsPlugin::setTimeStep(float timeStep)
+{
+  _fixedTimeStep = timeStep;
+}
+
+float NativePhysicsPlugin::getTimeStep() const
+{
+  return _fixedTimeStep;
+}
+
+void NativePhysicsPlugin::executeStep(float delta, const std::vector<PhysicsImpostor*>& impostors)
+{
+  for (const auto& impostor : impostors) {
+    if (_getBody(*impostor) && !impostor->parent()) {
+      impostor->beforeStep();
+    }
+  }
+
+  if (!_useDeltaForWorldStep) {
+    _world->step(_fixedTimeStep);
+  }
+  else {
+    // Fixed steps, the remaining time is carried over to the next frame unless
+    // the simulation falls behind
+    _timeAccumulator += delta;
+    size_t subSteps = 0;
+    while (_timeAccumulator >= _fixedTimeStep && subSteps < MaxSubSteps) {
+      _world->step(_fixedTimeStep);
+      _timeAccumulator -= _fixedTimeStep;
+      ++subSteps;
+    }
+    if (subSteps == MaxSubSteps) {
+      _timeAccumulator = std::min(_timeAccumulator, _fixedTimeStep);
+    }
+  }
+
+  for (const auto& impostor : impostors) {
+    if (_getBody(*impostor) && !impostor->parent()) {
+      impostor->afterStep();
+    }
+  }
+}
+
+void NativePhysicsPlugin::applyImpulse(const PhysicsImpostor& impostor, const Vector3& force,
+                                       const Vector3& contactPoint)
+{
+  if (auto body = _getBody(impostor)) {
+    body->applyImpulse(contactPoint, force);
+  }
+}
+
+void NativePhysicsPlugin::applyForce(const PhysicsImpostor& impostor, const Vector3& force,
+                                     const Vector3& contactPoint)
+{
+  if (auto body = _getBody(impostor)) {
+    body->applyForce(force, contactPoint);
+  }
+}
+
+void NativePhysicsPlugin::generatePhysicsBody(const PhysicsImpostor& iImpostor)
+{
+  auto& impostor = const_cast<PhysicsImpostor&>(iImpostor);
+
+  // Compound bodies are not supported, children have no body of their own
+  if (impostor.parent() || !impostor.isBodyInitRequired()) {
+    return;
+  }
+
+  auto shape = CreateShape(impostor);
+  if (!shape) {
+    BABYLON_LOGF_WARN("NativePhysicsPlugin",
+                      "Impostor type %u is not supported by the native physics plugin",
+                      impostor.physicsImposterType)
+    impostor.resetUpdateFlags();
+    return;
+  }
+
+  auto* object = impostor.object;
+  object->computeWorldMatrix(true);
+  if (!object->rotationQuaternion()) {
+    object->rotationQuaternion = Quaternion::RotationYawPitchRoll(
+      object->rotation().y, object->rotation().x, object->rotation().z);
+  }
+  auto* body = _world->createBody(shape, impostor.getParam("mass"),
+                                  object->getAbsolutePosition(), *object->rotationQuaternion());
+  body->setFriction(impostor.getParam("friction"));
+  body->setRestitution(impostor.getParam("restitution"));
+
+  // Replaces (and removes) the previous body
+  impostor.physicsBody = body;
+}
+
+void NativePhysicsPlugin::removePhysicsBody(const PhysicsImpostor& impostor)
+{
+  // The body of a child impostor is the one of its parent
+  auto body = _getBody(impostor);
+  if (!body || impostor.parent()) {
+    return;
+  }
+
+  // The joints of the body are destroyed with it
+  for (auto it = _joints.begin(); it != _joints.end();) {
+    if (it->second->bodyA == body || it->second->bodyB == body) {
+      it = _joints.erase(it);
+    }
+    else {
+      ++it;
+    }
+  }
+  _world->destroyBody(body);
+  const_cast<PhysicsImpostor&>(impostor).physicsBody = nullptr;
+}
+
+void NativePhysicsPlugin::generateJoint(PhysicsImpostorJoint* impostorJoint)
+{
+  if (!impostorJoint || !impostorJoint->joint) {
+    return;
+  }
+  auto mainBody      = _getBody(*impostorJoint->mainImpostor);
+  auto connectedBody = _getBody(*impostorJoint->connectedImpostor);
+  if (!mainBody || !connectedBody) {
+    return;
+  }
+
+  auto& joint           = *impostorJoint->joint;
+  const auto& jointData = joint.jointData;
+  auto type             = NativePhysicsJointType::PointToPoint;
+  switch (joint.jointType) {
+    case PhysicsJoint::DistanceJoint:
+      type = NativePhysicsJointType::Distance;
+      break;
+    case PhysicsJoint::BallAndSocketJoint:
+    case PhysicsJoint::PointToPointJoint:
+      break;
+    default:
+      BABYLON_LOGF_WARN("NativePhysicsPlugin",
+                        "Joint type %u is approximated by a point to point joint",
+                        joint.jointType)
+      break;
+  }
+
+  auto nativeJoint = _world->createJoint(type, mainBody, connectedBody,
+                                         jointData.mainPivot.value_or(Vector3::Zero()),
+                                         jointData.connectedPivot.value_or(Vector3::Zero()));
+  if (nativeJoint) {
+    _joints[&joint] = nativeJoint;
+  }
+}
+
+void NativePhysicsPlugin::removeJoint(PhysicsImpostorJoint* impostorJoint)
+{
+  if (!impostorJoint || !impostorJoint->joint) {
+    return;
+  }
+  auto it = _joints.find(impostorJoint->joint.get());
+  if (it != _joints.end()) {
+    _world->destroyJoint(it->second);
+    _joints.erase(it);
+  }
+}
+
+bool NativePhysicsPlugin::isSupported()
+{
+  return true;
+}
+
+void NativePhysicsPlugin::setTransformationFromPhysicsBody(const PhysicsImpostor& impostor)
+{
+  auto body = _getBody(impostor);
+  if (!body || body->isStatic() || body->sleeping()) {
+    return;
+  }
+  auto* object = impostor.object;
+  object->position().copyFrom(body->position());
+  if (object->rotationQuaternion()) {
+    object->rotationQuaternion()->copyFrom(body->rotation());
+  }
+}
+
+void NativePhysicsPlugin::setPhysicsBodyTransformation(const PhysicsImpostor& impostor,
+                                                       const Vector3& newPosition,
+                                                       const Quaternion& newRotation)
+{
+  auto body = _getBody(impostor);
+  if (!body) {
+    return;
+  }
+
+  // Called before each step with the transformation written after the
+  // previous one: only actual changes are applied, so that sleeping bodies are
+  // not woken up
+  const auto& position = body->position();
+  const auto& rotation = body->rotation();
+  if (std::abs(position.x - newPosition.x) > TransformEpsilon
+      || std::abs(position.y - newPosition.y) > TransformEpsilon
+      || std::abs(position.z - newPosition.z) > TransformEpsilon) {
+    body->setPosition(newPosition);
+  }
+  if (std::abs(std::abs(Quaternion::Dot(rotation, newRotation)) - 1.f) > TransformEpsilon) {
+    body->setOrientation(newRotation);
+  }
+}
+
+void NativePhysicsPlugin::setLinearVelocity(const PhysicsImpostor& impostor,
+                                            const std::optional<Vector3>& velocity)
+{
+  if (auto body = _getBody(impostor)) {
+    body->setLinearVelocity(velocity.value_or(Vector3::Zero()));
+  }
+}
+
+void NativePhysicsPlugin::setAngularVelocity(const PhysicsImpostor& impostor,
+                                             const std::optional<Vector3>& velocity)
+{
+  if (auto body = _getBody(impostor)) {
+    body->setAngularVelocity(velocity.value_or(Vector3::Zero()));
+  }
+}
+
+Vector3 NativePhysicsPlugin::getLinearVelocity(const PhysicsImpostor& impostor)
+{
+  auto body = _getBody(impostor);
+  return body ? body->linearVelocity() : Vector3::Zero();
+}
+
+Vector3 NativePhysicsPlugin::getAngularVelocity(const PhysicsImpostor& impostor)
+{
+  auto body = _getBody(impostor);
+  return body ? body->angularVelocity() : Vector3::Zero();
+}
+
+void NativePhysicsPlugin::setBodyMass(const PhysicsImpostor& impostor, float mass)
+{
+  if (auto body = _getBody(impostor)) {
+    body->setMass(mass);
+  }
+}
+
+float NativePhysicsPlugin::getBodyMass(const PhysicsImpostor& impostor)
+{
+  auto body = _getBody(impostor);
+  return body ? body->mass() : 0.f;
+}
+
+float NativePhysicsPlugin::getBodyFriction(const PhysicsImpostor& impostor)
+{
+  auto body = _getBody(impostor);
+  return body ? body->friction() : 0.f;
+}
+
+void NativePhysicsPlugin::setBodyFriction(const PhysicsImpostor& impostor, float friction)
+{
+  if (auto body = _getBody(impostor)) {
+    body->setFriction(friction);
+  }
+}
+
+float NativePhysicsPlugin::getBodyRestitution(const PhysicsImpostor& impostor)
+{
+  auto body = _getBody(impostor);
+  return body ? body->restitution() : 0.f;
+}
+
+void NativePhysicsPlugin::setBodyRestitution(const PhysicsImpostor& impostor, float restitution)
+{
+  if (auto body = _getBody(impostor)) {
+    body->setRestitution(restitution);
+  }
+}
+
+float NativePhysicsPlugin::getBodyPressure(const PhysicsImpostor& /*impostor*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin", "Pressure is not a property of a rigid body")
+  return 0.f;
+}
+
+void NativePhysicsPlugin::setBodyPressure(const PhysicsImpostor& /*impostor*/,
+                                          float /*pressure*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin", "Pressure is not a property of a rigid body")
+}
+
+float NativePhysicsPlugin::getBodyStiffness(const PhysicsImpostor& /*impostor*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin", "Stiffness is not a property of a rigid body")
+  return 0.f;
+}
+
+void NativePhysicsPlugin::setBodyStiffness(const PhysicsImpostor& /*impostor*/,
+                                           float /*stiffness*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin", "Stiffness is not a property of a rigid body")
+}
+
+size_t NativePhysicsPlugin::getBodyVelocityIterations(const PhysicsImpostor& /*impostor*/)
+{
+  return _world->solverIterations();
+}
+
+void NativePhysicsPlugin::setBodyVelocityIterations(const PhysicsImpostor& /*impostor*/,
+                                                    size_t velocityIterations)
+{
+  // The iterations are shared by all the bodies
+  _world->setSolverIterations(velocityIterations);
+}
+
+size_t NativePhysicsPlugin::getBodyPositionIterations(const PhysicsImpostor& /*impostor*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin", "Position iterations are not used by the solver")
+  return 0;
+}
+
+void NativePhysicsPlugin::setBodyPositionIterations(const PhysicsImpostor& /*impostor*/,
+                                                    size_t /*positionIterations*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin", "Position iterations are not used by the solver")
+}
+
+void NativePhysicsPlugin::appendAnchor(const PhysicsImpostor& /*impostor*/,
+                                       const PhysicsImpostorPtr& /*otherImpostor*/,
+                                       int /*width*/, int /*height*/, float /*influence*/,
+                                       bool /*noCollisionBetweenLinkedBodies*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin", "Soft bodies are not supported")
+}
+
+void NativePhysicsPlugin::appendHook(const PhysicsImpostor& /*impostor*/,
+                                     const PhysicsImpostorPtr& /*otherImpostor*/,
+                                     float /*length*/, float /*influence*/,
+                                     bool /*noCollisionBetweenLinkedBodies*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin", "Soft bodies are not supported")
+}
+
+void NativePhysicsPlugin::sleepBody(const PhysicsImpostor& impostor)
+{
+  if (auto body = _getBody(impostor)) {
+    body->sleep();
+  }
+}
+
+void NativePhysicsPlugin::wakeUpBody(const PhysicsImpostor& impostor)
+{
+  if (auto body = _getBody(impostor)) {
+    body->awake();
+  }
+}
+
+PhysicsRaycastResult NativePhysicsPlugin::raycast(const Vector3& from, const Vector3& to)
+{
+  PhysicsRaycastResult result;
+  result.reset(from, to);
+
+  NativePhysicsBody* body = nullptr;
+  float fraction          = 0.f;
+  Vector3 normal;
+  if (_world->raycast(from, to, body, fraction, normal)) {
+    const auto point = Vector3::Lerp(from, to, fraction);
+    result.setHitData({normal.x, normal.y, normal.z}, {point.x, point.y, point.z});
+    result.calculateHitDistance();
+  }
+  return result;
+}
+
+void NativePhysicsPlugin::updateDistanceJoint(DistanceJoint* joint, float maxDistance,
+                                              float minDistance)
+{
+  auto it = _joints.find(joint);
+  if (it == _joints.end()) {
+    return;
+  }
+  auto nativeJoint         = it->second;
+  nativeJoint->minDistance = std::min(minDistance, maxDistance);
+  nativeJoint->maxDistance = maxDistance;
+  nativeJoint->bodyA->awake();
+  nativeJoint->bodyB->awake();
+}
+
+void NativePhysicsPlugin::setMotor(IMotorEnabledJoint* /*joint*/, float /*speed*/,
+                                   float /*maxForce*/, unsigned int /*motorIndex*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin", "Motors are not supported")
+}
+
+void NativePhysicsPlugin::setLimit(IMotorEnabledJoint* /*joint*/, float /*upperLimit*/,
+                                   float /*lowerLimit*/, unsigned int /*motorIndex*/)
+{
+  BABYLON_LOG_WARN("NativePhysicsPlugin", "Motors are not supported")
+}
+
+float NativePhysicsPlugin::getRadius(const PhysicsImpostor& impostor)
+{
+  auto body = _getBody(impostor);
+  if (!body) {
+    return 0.f;
+  }
+  const auto type = body->shape()->type();
+  return (type == NativePhysicsShapeType::Sphere || type == NativePhysicsShapeType::Capsule) ?
+           body->shape()->radius() :
+           0.f;
+}
+
+void NativePhysicsPlugin::getBoxSizeToRef(const PhysicsImpostor& impostor, Vector3& result)
+{
+  auto body = _getBody(impostor);
+  if (!body) {
+    result.setAll(0.f);
+    return;
+  }
+  const auto& shape = *body->shape();
+  result            = shape.localMax().subtract(shape.localMin());
+}
+
+void NativePhysicsPlugin::syncMeshWithImpostor(AbstractMesh* mesh,
+                                               const PhysicsImpostor& impostor)
+{
+  auto body = _getBody(impostor);
+  if (!mesh || !body) {
+    return;
+  }
+  mesh->position().copyFrom(body->position());
+  if (mesh->rotationQuaternion()) {
+    mesh->rotationQuaternion()->copyFrom(body->rotation());
+  }
+}
+
+void NativePhysicsPlugin::dispose()
+{
+  _joints.clear();
+  const auto gravity    = _world->gravity();
+  const auto iterations = _world->solverIterations();
+  _world                = std::make_unique<NativePhysicsWorld>();
+  _world->setGravity(gravity);
+  _world->setSolverIterations(iterations);
+  _timeAccumulator = 0.f;
+}
+
+NativePhysicsBody* NativePhysicsPlugin::_getBody(const PhysicsImpostor& impostor) const
+{
+  // Every body of the impostors of the physics engine is created by this
+  // plugin
+  return static_cast<NativePhysicsBody*>(const_cast<PhysicsImpostor&>(impostor).physicsBody());
+}
+
+} // end of namespace BABYLON
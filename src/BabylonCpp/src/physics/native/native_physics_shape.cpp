@@ -0,0 +1,271 @@
+#include <babylon/physics/native/native_physics_shape.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <babylon/culling/triangle_bvh.h>
+#include <babylon/babylon_constants.h>
+
+namespace BABYLON {
+
+NativePhysicsShape::NativePhysicsShape(NativePhysicsShapeType type)
+    : _type{type}
+    , _radius{0.f}
+    , _halfExtents{Vector3::Zero()}
+    , _coreHalfExtents{Vector3::Zero()}
+    , _halfHeight{0.f}
+    , _triangleBVH{nullptr}
+    , _localMin{Vector3::Zero()}
+    , _localMax{Vector3::Zero()}
+{
+}
+
+NativePhysicsShape::~NativePhysicsShape() = default;
+
+NativePhysicsShapePtr NativePhysicsShape::CreateSphere(float radius)
+{
+  auto shape     = std::shared_ptr<NativePhysicsShape>(
+    new NativePhysicsShape(NativePhysicsShapeType::Sphere));
+  shape->_radius = std::max(radius, 0.f);
+  shape->_computeLocalBounds();
+  return shape;
+}
+
+NativePhysicsShapePtr NativePhysicsShape::CreateBox(const Vector3& halfExtents)
+{
+  auto shape = std::shared_ptr<NativePhysicsShape>(
+    new NativePhysicsShape(NativePhysicsShapeType::Box));
+  shape->_halfExtents = Vector3(std::max(halfExtents.x, 0.f), std::max(halfExtents.y, 0.f),
+                                std::max(halfExtents.z, 0.f));
+  // The core is rounded by a small radius, so that resting contacts are found
+  // by the distance query instead of the penetration one
+  const auto& h = shape->_halfExtents;
+  shape->_radius
+    = std::min(MaxBoxMargin, BoxMarginRatio * std::min({h.x, h.y, h.z}));
+  shape->_coreHalfExtents
+    = Vector3(h.x - shape->_radius, h.y - shape->_radius, h.z - shape->_radius);
+  shape->_computeLocalBounds();
+  return shape;
+}
+
+NativePhysicsShapePtr NativePhysicsShape::CreateCapsule(float radius, float halfHeight)
+{
+  auto shape = std::shared_ptr<NativePhysicsShape>(
+    new NativePhysicsShape(NativePhysicsShapeType::Capsule));
+  shape->_radius     = std::max(radius, 0.f);
+  shape->_halfHeight = std::max(halfHeight, 0.f);
+  shape->_computeLocalBounds();
+  return shape;
+}
+
+NativePhysicsShapePtr NativePhysicsShape::CreateConvexHull(const std::vector<Vector3>& points)
+{
+  auto shape = std::shared_ptr<NativePhysicsShape>(
+    new NativePhysicsShape(NativePhysicsShapeType::ConvexHull));
+  if (points.size() <= MaxConvexHullPoints) {
+    shape->_points = points;
+  }
+  else {
+    // Extreme points along directions evenly spread on the sphere (Fibonacci
+    // lattice)
+    const auto goldenAngle = Math::PI * (3.f - std::sqrt(5.f));
+    std::vector<size_t> extremes;
+    extremes.reserve(MaxConvexHullPoints);
+    for (size_t i = 0; i < MaxConvexHullPoints; ++i) {
+      const auto y = 1.f - 2.f * (static_cast<float>(i) + 0.5f) / MaxConvexHullPoints;
+      const auto r = std::sqrt(std::max(0.f, 1.f - y * y));
+      const auto theta = goldenAngle * static_cast<float>(i);
+      const Vector3 direction(r * std::cos(theta), y, r * std::sin(theta));
+      size_t best   = 0;
+      auto bestDot = std::numeric_limits<float>::lowest();
+      for (size_t p = 0; p < points.size(); ++p) {
+        const auto dot = Vector3::Dot(points[p], direction);
+        if (dot > bestDot) {
+          bestDot = dot;
+          best    = p;
+        }
+      }
+      extremes.emplace_back(best);
+    }
+    std::sort(extremes.begin(), extremes.end());
+    extremes.erase(std::unique(extremes.begin(), extremes.end()), extremes.end());
+    for (auto index : extremes) {
+      shape->_points.emplace_back(points[index]);
+    }
+  }
+  if (shape->_points.empty()) {
+    shape->_points.emplace_back(Vector3::Zero());
+  }
+  shape->_computeLocalBounds();
+  return shape;
+}
+
+NativePhysicsShapePtr NativePhysicsShape::CreateMesh(const std::vector<Vector3>& positions,
+                                                     const IndicesArray& indices)
+{
+  auto shape = std::shared_ptr<NativePhysicsShape>(
+    new NativePhysicsShape(NativePhysicsShapeType::Mesh));
+  shape->_points  = positions;
+  shape->_indices = indices;
+  shape->_indices.resize(indices.size() - indices.size() % 3);
+  shape->_triangleBVH
+    = std::make_unique<TriangleBVH>(shape->_points, shape->_indices, 0, shape->_indices.size());
+  shape->_computeLocalBounds();
+  return shape;
+}
+
+NativePhysicsShapeType NativePhysicsShape::type() const
+{
+  return _type;
+}
+
+bool NativePhysicsShape::isConvex() const
+{
+  return _type != NativePhysicsShapeType::Mesh;
+}
+
+float NativePhysicsShape::radius() const
+{
+  return _radius;
+}
+
+const Vector3& NativePhysicsShape::halfExtents() const
+{
+  return _halfExtents;
+}
+
+float NativePhysicsShape::halfHeight() const
+{
+  return _halfHeight;
+}
+
+const std::vector<Vector3>& NativePhysicsShape::points() const
+{
+  return _points;
+}
+
+const IndicesArray& NativePhysicsShape::indices() const
+{
+  return _indices;
+}
+
+const TriangleBVH* NativePhysicsShape::triangleBVH() const
+{
+  return _triangleBVH.get();
+}
+
+const Vector3& NativePhysicsShape::localMin() const
+{
+  return _localMin;
+}
+
+const Vector3& NativePhysicsShape::localMax() const
+{
+  return _localMax;
+}
+
+Vector3 NativePhysicsShape::supportCore(const Vector3& direction) const
+{
+  switch (_type) {
+    case NativePhysicsShapeType::Box:
+      return Vector3(direction.x < 0.f ? -_coreHalfExtents.x : _coreHalfExtents.x,
+                     direction.y < 0.f ? -_coreHalfExtents.y : _coreHalfExtents.y,
+                     direction.z < 0.f ? -_coreHalfExtents.z : _coreHalfExtents.z);
+    case NativePhysicsShapeType::Capsule:
+      return Vector3(0.f, direction.y < 0.f ? -_halfHeight : _halfHeight, 0.f);
+    case NativePhysicsShapeType::ConvexHull:
+    case NativePhysicsShapeType::Mesh: {
+      size_t best  = 0;
+      auto bestDot = std::numeric_limits<float>::lowest();
+      for (size_t i = 0; i < _points.size(); ++i) {
+        const auto dot = Vector3::Dot(_points[i], direction);
+        if (dot > bestDot) {
+          bestDot = dot;
+          best    = i;
+        }
+      }
+      return _points.empty() ? Vector3::Zero() : _points[best];
+    }
+    default:
+      return Vector3::Zero();
+  }
+}
+
+float NativePhysicsShape::volume() const
+{
+  switch (_type) {
+    case NativePhysicsShapeType::Sphere:
+      return 4.f / 3.f * Math::PI * _radius * _radius * _radius;
+    case NativePhysicsShapeType::Capsule:
+      return Math::PI * _radius * _radius * (2.f * _halfHeight + 4.f / 3.f * _radius);
+    default: {
+      const auto size = _localMax.subtract(_localMin);
+      return size.x * size.y * size.z;
+    }
+  }
+}
+
+Vector3 NativePhysicsShape::computeInertia(float mass) const
+{
+  switch (_type) {
+    case NativePhysicsShapeType::Sphere: {
+      const auto inertia = 0.4f * mass * _radius * _radius;
+      return Vector3(inertia, inertia, inertia);
+    }
+    case NativePhysicsShapeType::Capsule: {
+      // Cylinder and two half spheres, sharing the mass by volume
+      const auto r2             = _radius * _radius;
+      const auto height         = 2.f * _halfHeight;
+      const auto cylinderVolume = Math::PI * r2 * height;
+      const auto sphereVolume   = 4.f / 3.f * Math::PI * r2 * _radius;
+      const auto totalVolume    = cylinderVolume + sphereVolume;
+      const auto cylinderMass
+        = totalVolume > 0.f ? mass * cylinderVolume / totalVolume : 0.f;
+      const auto sphereMass = mass - cylinderMass;
+      const auto axial      = cylinderMass * r2 * 0.5f + sphereMass * 0.4f * r2;
+      const auto lateral    = cylinderMass * (r2 * 0.25f + height * height / 12.f)
+                           + sphereMass * (0.4f * r2 + height * height * 0.25f
+                                           + 0.375f * height * _radius);
+      return Vector3(lateral, axial, lateral);
+    }
+    default: {
+      const auto size = _localMax.subtract(_localMin);
+      const auto x2 = size.x * size.x, y2 = size.y * size.y, z2 = size.z * size.z;
+      return Vector3(mass * (y2 + z2) / 12.f, mass * (x2 + z2) / 12.f,
+                     mass * (x2 + y2) / 12.f);
+    }
+  }
+}
+
+void NativePhysicsShape::_computeLocalBounds()
+{
+  switch (_type) {
+    case NativePhysicsShapeType::Sphere:
+      _localMin = Vector3(-_radius, -_radius, -_radius);
+      _localMax = Vector3(_radius, _radius, _radius);
+      break;
+    case NativePhysicsShapeType::Box:
+      _localMin = _halfExtents.negate();
+      _localMax = _halfExtents;
+      break;
+    case NativePhysicsShapeType::Capsule:
+      _localMin = Vector3(-_radius, -_radius - _halfHeight, -_radius);
+      _localMax = Vector3(_radius, _radius + _halfHeight, _radius);
+      break;
+    default: {
+      if (_points.empty()) {
+        break;
+      }
+      _localMin = _points.front();
+      _localMax = _points.front();
+      for (const auto& point : _points) {
+        _localMin = Vector3::Minimize(_localMin, point);
+        _localMax = Vector3::Maximize(_localMax, point);
+      }
+      break;
+    }
+  }
+}
+
+} // end of namespace BABYLON
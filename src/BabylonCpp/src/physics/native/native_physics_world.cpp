@@ -0,0 +1,812 @@
+#include <babylon/physics/native/native_physics_world.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/culling/ray.h>
+#include <babylon/physics/native/native_physics_body.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Ratio of the position error corrected at each step, and penetration allowed
+// without correction
+constexpr float Baumgarte  = 0.2f;
+constexpr float LinearSlop = 0.005f;
+// Approach velocity above which the contacts bounce
+constexpr float RestitutionThreshold = 1.f;
+// Maximum translation of a body during a step
+constexpr float MaxTranslation = 2.f;
+// Distance range under which a distance joint is rigid
+constexpr float RigidDistanceRange = 1e-4f;
+// Number of elements per chunk of the parallel stages
+constexpr size_t BodyGrainSize     = 64;
+constexpr size_t ManifoldGrainSize = 32;
+
+inline uint64_t PairKey(const NativePhysicsBody* a, const NativePhysicsBody* b)
+{
+  const auto idA = static_cast<uint64_t>(a->uniqueId());
+  const auto idB = static_cast<uint64_t>(b->uniqueId());
+  return idA < idB ? (idA << 32) | idB : (idB << 32) | idA;
+}
+
+/**
+ * @brief Row major 3x3 matrix.
+ */
+struct Matrix3 {
+  std::array<float, 9> m = {};
+
+  [[nodiscard]] Vector3 transform(const Vector3& v) const
+  {
+    return Vector3(m[0] * v.x + m[1] * v.y + m[2] * v.z, m[3] * v.x + m[4] * v.y + m[5] * v.z,
+                   m[6] * v.x + m[7] * v.y + m[8] * v.z);
+  }
+
+  [[nodiscard]] Matrix3 inverse() const
+  {
+    Matrix3 result;
+    const auto c0  = m[4] * m[8] - m[5] * m[7];
+    const auto c1  = m[5] * m[6] - m[3] * m[8];
+    const auto c2  = m[3] * m[7] - m[4] * m[6];
+    const auto det = m[0] * c0 + m[1] * c1 + m[2] * c2;
+    if (std::abs(det) <= std::numeric_limits<float>::min()) {
+      return result;
+    }
+    const auto inv = 1.f / det;
+    result.m = {c0 * inv, (m[2] * m[7] - m[1] * m[8]) * inv, (m[1] * m[5] - m[2] * m[4]) * inv,
+                c1 * inv, (m[0] * m[8] - m[2] * m[6]) * inv, (m[2] * m[3] - m[0] * m[5]) * inv,
+                c2 * inv, (m[1] * m[6] - m[0] * m[7]) * inv, (m[0] * m[4] - m[1] * m[3]) * inv};
+    return result;
+  }
+}; // end of struct Matrix3
+
+/**
+ * @brief Returns R * diag(inverseInertia) * R^T.
+ */
+Matrix3 WorldInverseInertia(const Quaternion& q, const Vector3& inverseInertia)
+{
+  const auto xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+  const auto xy = q.x * q.y, zw = q.z * q.w, zx = q.z * q.x;
+  const auto yw = q.y * q.w, yz = q.y * q.z, xw = q.x * q.w;
+  const float r[9]
+    = {1.f - 2.f * (yy + zz), 2.f * (xy - zw),       2.f * (zx + yw),
+       2.f * (xy + zw),       1.f - 2.f * (zz + xx), 2.f * (yz - xw),
+       2.f * (zx - yw),       2.f * (yz + xw),       1.f - 2.f * (yy + xx)};
+  const float d[3] = {inverseInertia.x, inverseInertia.y, inverseInertia.z};
+  Matrix3 result;
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t j = 0; j < 3; ++j) {
+      result.m[i * 3 + j]
+        = r[i * 3] * d[0] * r[j * 3] + r[i * 3 + 1] * d[1] * r[j * 3 + 1]
+          + r[i * 3 + 2] * d[2] * r[j * 3 + 2];
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief Velocity state of a body during the solve of its island.
+ */
+struct SolverBody {
+  Vector3 linearVelocity  = Vector3::Zero();
+  Vector3 angularVelocity = Vector3::Zero();
+  float inverseMass       = 0.f;
+  Matrix3 inverseInertia;
+}; // end of struct SolverBody
+
+struct ContactConstraint {
+  size_t indexA;
+  size_t indexB;
+  Vector3 rA;
+  Vector3 rB;
+  Vector3 normal;
+  Vector3 tangent1;
+  Vector3 tangent2;
+  float normalMass;
+  float tangentMass1;
+  float tangentMass2;
+  float friction;
+  float velocityTarget;
+  NativePhysicsContactPoint* point;
+}; // end of struct ContactConstraint
+
+struct JointConstraint {
+  size_t indexA;
+  size_t indexB;
+  Vector3 rA;
+  Vector3 rB;
+  NativePhysicsJoint* joint;
+  // Point to point joints
+  Matrix3 mass;
+  Vector3 bias;
+  // Distance joints
+  Vector3 axis;
+  float axialMass;
+  float distance;
+}; // end of struct JointConstraint
+
+struct IslandScratch {
+  std::vector<SolverBody> bodies;
+  std::vector<ContactConstraint> contacts;
+  std::vector<JointConstraint> joints;
+}; // end of struct IslandScratch
+
+inline Vector3 RelativeVelocity(const SolverBody& a, const SolverBody& b, const Vector3& rA,
+                                const Vector3& rB)
+{
+  return b.linearVelocity.add(Vector3::Cross(b.angularVelocity, rB))
+    .subtractInPlace(a.linearVelocity)
+    .subtractInPlace(Vector3::Cross(a.angularVelocity, rA));
+}
+
+inline void ApplyImpulse(SolverBody& a, SolverBody& b, const Vector3& rA, const Vector3& rB,
+                         const Vector3& impulse)
+{
+  a.linearVelocity.subtractInPlace(impulse.scale(a.inverseMass));
+  a.angularVelocity.subtractInPlace(a.inverseInertia.transform(Vector3::Cross(rA, impulse)));
+  b.linearVelocity.addInPlace(impulse.scale(b.inverseMass));
+  b.angularVelocity.addInPlace(b.inverseInertia.transform(Vector3::Cross(rB, impulse)));
+}
+
+inline float EffectiveMass(const SolverBody& a, const SolverBody& b, const Vector3& rA,
+                           const Vector3& rB, const Vector3& direction)
+{
+  const auto rnA = Vector3::Cross(rA, direction);
+  const auto rnB = Vector3::Cross(rB, direction);
+  const auto k   = a.inverseMass + b.inverseMass
+                 + Vector3::Dot(rnA, a.inverseInertia.transform(rnA))
+                 + Vector3::Dot(rnB, b.inverseInertia.transform(rnB));
+  return k > 0.f ? 1.f / k : 0.f;
+}
+
+// Orthonormal basis of the plane orthogonal to a unit normal
+inline void PlaneSpace(const Vector3& n, Vector3& t1, Vector3& t2)
+{
+  if (std::abs(n.x) > 0.57735f) {
+    t1.copyFromFloats(n.y, -n.x, 0.f);
+  }
+  else {
+    t1.copyFromFloats(0.f, n.z, -n.y);
+  }
+  t1.normalize();
+  t2 = Vector3::Cross(n, t1);
+}
+
+inline bool IsActive(NativePhysicsBody* body)
+{
+  return !body->isStatic() && !body->sleeping();
+}
+
+size_t FindRoot(std::vector<size_t>& parents, size_t index)
+{
+  while (parents[index] != index) {
+    parents[index] = parents[parents[index]];
+    index          = parents[index];
+  }
+  return index;
+}
+
+} // end of anonymous namespace
+
+NativePhysicsWorld::NativePhysicsWorld()
+    : _gravity{Vector3(0.f, -9.807f, 0.f)}
+    , _solverIterations{DefaultSolverIterations}
+    , _nextBodyId{1}
+    , _stepCount{0}
+    , _broadphase{0.1f}
+{
+}
+
+NativePhysicsWorld::~NativePhysicsWorld() = default;
+
+void NativePhysicsWorld::setGravity(const Vector3& gravity)
+{
+  _gravity = gravity;
+  for (auto& body : _bodies) {
+    body->awake();
+  }
+}
+
+const Vector3& NativePhysicsWorld::gravity() const
+{
+  return _gravity;
+}
+
+void NativePhysicsWorld::setSolverIterations(size_t iterations)
+{
+  _solverIterations = std::max<size_t>(iterations, 1);
+}
+
+size_t NativePhysicsWorld::solverIterations() const
+{
+  return _solverIterations;
+}
+
+NativePhysicsBody* NativePhysicsWorld::createBody(const NativePhysicsShapePtr& shape, float mass,
+                                                  const Vector3& position,
+                                                  const Quaternion& rotation)
+{
+  auto body       = std::make_unique<NativePhysicsBody>(shape, mass, position, rotation);
+  body->_uniqueId = _nextBodyId++;
+  body->_index    = _bodies.size();
+  body->computeBoundingBox(body->_boundingMin, body->_boundingMax);
+  body->_proxyId = _broadphase.createProxy(body->_boundingMin, body->_boundingMax, body.get());
+  _bodies.emplace_back(std::move(body));
+  return _bodies.back().get();
+}
+
+void NativePhysicsWorld::destroyBody(NativePhysicsBody* body)
+{
+  if (!body || body->_index >= _bodies.size() || _bodies[body->_index].get() != body) {
+    return;
+  }
+
+  for (auto it = _manifolds.begin(); it != _manifolds.end();) {
+    auto& manifold = it->second;
+    if (manifold.bodyA == body || manifold.bodyB == body) {
+      (manifold.bodyA == body ? manifold.bodyB : manifold.bodyA)->awake();
+      it = _manifolds.erase(it);
+    }
+    else {
+      ++it;
+    }
+  }
+  _joints.erase(std::remove_if(_joints.begin(), _joints.end(),
+                               [body](const std::unique_ptr<NativePhysicsJoint>& joint) {
+                                 if (joint->bodyA != body && joint->bodyB != body) {
+                                   return false;
+                                 }
+                                 (joint->bodyA == body ? joint->bodyB : joint->bodyA)->awake();
+                                 return true;
+                               }),
+                _joints.end());
+  _broadphase.destroyProxy(body->_proxyId);
+
+  const auto index = body->_index;
+  if (index + 1 < _bodies.size()) {
+    std::swap(_bodies[index], _bodies.back());
+    _bodies[index]->_index = index;
+  }
+  _bodies.pop_back();
+}
+
+size_t NativePhysicsWorld::bodyCount() const
+{
+  return _bodies.size();
+}
+
+NativePhysicsJoint* NativePhysicsWorld::createJoint(NativePhysicsJointType type,
+                                                    NativePhysicsBody* bodyA,
+                                                    NativePhysicsBody* bodyB,
+                                                    const Vector3& pivotA, const Vector3& pivotB)
+{
+  if (!bodyA || !bodyB || bodyA == bodyB) {
+    return nullptr;
+  }
+  auto joint         = std::make_unique<NativePhysicsJoint>();
+  joint->type        = type;
+  joint->bodyA       = bodyA;
+  joint->bodyB       = bodyB;
+  joint->localPivotA = pivotA;
+  joint->localPivotB = pivotB;
+  const auto distance
+    = Vector3::Distance(bodyA->localToWorld(pivotA), bodyB->localToWorld(pivotB));
+  joint->minDistance = distance;
+  joint->maxDistance = distance;
+  bodyA->awake();
+  bodyB->awake();
+  _joints.emplace_back(std::move(joint));
+  return _joints.back().get();
+}
+
+void NativePhysicsWorld::destroyJoint(NativePhysicsJoint* joint)
+{
+  auto it = std::find_if(_joints.begin(), _joints.end(),
+                         [joint](const std::unique_ptr<NativePhysicsJoint>& j) {
+                           return j.get() == joint;
+                         });
+  if (it != _joints.end()) {
+    (*it)->bodyA->awake();
+    (*it)->bodyB->awake();
+    _joints.erase(it);
+  }
+}
+
+void NativePhysicsWorld::step(float timeStep)
+{
+  if (timeStep <= 0.f) {
+    return;
+  }
+  ++_stepCount;
+
+  _updateBroadphase();
+  _findPairs();
+  _updateManifolds();
+  _buildIslands();
+
+  // Islands are independent: each dynamic body, contact and joint belongs to
+  // a single island, and static bodies are only read
+  ThreadPool::Default().parallelFor(_awakeIslands.size(), 1, [this, timeStep](size_t begin,
+                                                                              size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      _solveIsland(_islands[_awakeIslands[i]], timeStep);
+    }
+  });
+
+  for (auto& body : _bodies) {
+    body->_force.setAll(0.f);
+    body->_torque.setAll(0.f);
+  }
+}
+
+void NativePhysicsWorld::_updateBroadphase()
+{
+  _awakeBodies.clear();
+  for (auto& body : _bodies) {
+    if (IsActive(body.get())) {
+      _awakeBodies.emplace_back(body.get());
+    }
+    else if (body->_transformDirty) {
+      body->computeBoundingBox(body->_boundingMin, body->_boundingMax);
+      _broadphase.moveProxy(body->_proxyId, body->_boundingMin, body->_boundingMax);
+    }
+    body->_transformDirty = false;
+  }
+
+  ThreadPool::Default().parallelFor(_awakeBodies.size(), BodyGrainSize,
+                                    [this](size_t begin, size_t end) {
+                                      for (size_t i = begin; i < end; ++i) {
+                                        auto* body = _awakeBodies[i];
+                                        body->computeBoundingBox(body->_boundingMin,
+                                                                 body->_boundingMax);
+                                      }
+                                    });
+  for (auto* body : _awakeBodies) {
+    _broadphase.moveProxy(body->_proxyId, body->_boundingMin, body->_boundingMax);
+  }
+}
+
+void NativePhysicsWorld::_findPairs()
+{
+  const auto chunkCount = (_awakeBodies.size() + BodyGrainSize - 1) / BodyGrainSize;
+  _chunkPairs.resize(std::max<size_t>(chunkCount, 1));
+  for (auto& pairs : _chunkPairs) {
+    pairs.clear();
+  }
+
+  ThreadPool::Default().parallelFor(
+    _awakeBodies.size(), BodyGrainSize, [this](size_t begin, size_t end) {
+      thread_local std::vector<NativePhysicsBody*> candidates;
+      auto& pairs       = _chunkPairs[begin / BodyGrainSize];
+      const auto margin = NativePhysicsCollision::ContactMargin;
+      for (size_t i = begin; i < end; ++i) {
+        auto* body     = _awakeBodies[i];
+        const auto min = body->_boundingMin.subtract(Vector3(margin, margin, margin));
+        const auto max = body->_boundingMax.add(Vector3(margin, margin, margin));
+        candidates.clear();
+        _broadphase.queryBox(min, max, candidates);
+        for (auto* other : candidates) {
+          // Pairs of awake bodies are reported by the first one
+          if (other == body || (IsActive(other) && other->_index < body->_index)) {
+            continue;
+          }
+          if (other->_boundingMin.x > max.x || other->_boundingMax.x < min.x
+              || other->_boundingMin.y > max.y || other->_boundingMax.y < min.y
+              || other->_boundingMin.z > max.z || other->_boundingMax.z < min.z) {
+            continue;
+          }
+          pairs.emplace_back(body, other);
+        }
+      }
+    });
+}
+
+void NativePhysicsWorld::_updateManifolds()
+{
+  _activeManifolds.clear();
+  for (const auto& pairs : _chunkPairs) {
+    for (const auto& [bodyA, bodyB] : pairs) {
+      auto& manifold = _manifolds[PairKey(bodyA, bodyB)];
+      if (!manifold.bodyA) {
+        const auto ordered = bodyA->uniqueId() < bodyB->uniqueId();
+        manifold.bodyA     = ordered ? bodyA : bodyB;
+        manifold.bodyB     = ordered ? bodyB : bodyA;
+      }
+      manifold.lastStep = _stepCount;
+      _activeManifolds.emplace_back(&manifold);
+    }
+  }
+
+  ThreadPool::Default().parallelFor(_activeManifolds.size(), ManifoldGrainSize,
+                                    [this](size_t begin, size_t end) {
+                                      for (size_t i = begin; i < end; ++i) {
+                                        NativePhysicsCollision::UpdateManifold(
+                                          *_activeManifolds[i]);
+                                      }
+                                    });
+
+  // Manifolds which were not updated are dropped, unless their bodies are all
+  // sleeping or static
+  for (auto it = _manifolds.begin(); it != _manifolds.end();) {
+    const auto& manifold = it->second;
+    if (manifold.lastStep != _stepCount
+        && (IsActive(manifold.bodyA) || IsActive(manifold.bodyB))) {
+      it = _manifolds.erase(it);
+    }
+    else {
+      ++it;
+    }
+  }
+}
+
+void NativePhysicsWorld::_buildIslands()
+{
+  const auto bodyCount = _bodies.size();
+  _islandParents.resize(bodyCount);
+  std::iota(_islandParents.begin(), _islandParents.end(), size_t{0});
+  const auto connect = [this](const NativePhysicsBody* a, const NativePhysicsBody* b) {
+    if (a->isStatic() || b->isStatic()) {
+      return;
+    }
+    const auto rootA = FindRoot(_islandParents, a->_index);
+    const auto rootB = FindRoot(_islandParents, b->_index);
+    if (rootA != rootB) {
+      _islandParents[std::max(rootA, rootB)] = std::min(rootA, rootB);
+    }
+  };
+  for (const auto& [key, manifold] : _manifolds) {
+    if (manifold.pointCount > 0) {
+      connect(manifold.bodyA, manifold.bodyB);
+    }
+  }
+  for (const auto& joint : _joints) {
+    connect(joint->bodyA, joint->bodyB);
+  }
+
+  // Islands are numbered in body order
+  constexpr auto NoIsland = std::numeric_limits<size_t>::max();
+  std::vector<size_t> rootIslands(bodyCount, NoIsland);
+  size_t islandCount = 0;
+  for (size_t i = 0; i < bodyCount; ++i) {
+    if (!_bodies[i]->isStatic()) {
+      auto& island = rootIslands[FindRoot(_islandParents, i)];
+      if (island == NoIsland) {
+        island = islandCount++;
+      }
+    }
+  }
+  if (_islands.size() < islandCount) {
+    _islands.resize(islandCount);
+  }
+  for (size_t i = 0; i < islandCount; ++i) {
+    _islands[i].bodies.clear();
+    _islands[i].manifolds.clear();
+    _islands[i].joints.clear();
+  }
+  const auto islandOf = [&](const NativePhysicsBody* a, const NativePhysicsBody* b) -> Island& {
+    const auto* dynamicBody = a->isStatic() ? b : a;
+    return _islands[rootIslands[FindRoot(_islandParents, dynamicBody->_index)]];
+  };
+  for (size_t i = 0; i < bodyCount; ++i) {
+    if (!_bodies[i]->isStatic()) {
+      _islands[rootIslands[FindRoot(_islandParents, i)]].bodies.emplace_back(_bodies[i].get());
+    }
+  }
+  for (auto& [key, manifold] : _manifolds) {
+    if (manifold.pointCount > 0 && !(manifold.bodyA->isStatic() && manifold.bodyB->isStatic())) {
+      islandOf(manifold.bodyA, manifold.bodyB).manifolds.emplace_back(&manifold);
+    }
+  }
+  for (auto& joint : _joints) {
+    if (!(joint->bodyA->isStatic() && joint->bodyB->isStatic())) {
+      islandOf(joint->bodyA, joint->bodyB).joints.emplace_back(joint.get());
+    }
+  }
+
+  // Islands touching an awake body are woken up, the largest ones are solved
+  // first to balance the threads
+  _awakeIslands.clear();
+  for (size_t i = 0; i < islandCount; ++i) {
+    auto& bodies = _islands[i].bodies;
+    if (std::any_of(bodies.begin(), bodies.end(),
+                    [](NativePhysicsBody* body) { return !body->sleeping(); })) {
+      for (auto* body : bodies) {
+        if (body->sleeping()) {
+          body->awake();
+        }
+      }
+      _awakeIslands.emplace_back(i);
+    }
+  }
+  std::stable_sort(_awakeIslands.begin(), _awakeIslands.end(), [this](size_t a, size_t b) {
+    return _islands[a].bodies.size() > _islands[b].bodies.size();
+  });
+}
+
+void NativePhysicsWorld::_solveIsland(Island& island, float timeStep) const
+{
+  thread_local IslandScratch scratch;
+  auto& solverBodies = scratch.bodies;
+  auto& contacts     = scratch.contacts;
+  auto& joints       = scratch.joints;
+  solverBodies.clear();
+  contacts.clear();
+  joints.clear();
+
+  // Static bodies share the first solver body
+  solverBodies.emplace_back(SolverBody());
+  const auto solverIndex = [](const NativePhysicsBody* body) {
+    return body->isStatic() ? size_t{0} : body->_solverIndex;
+  };
+
+  // Velocity integration
+  for (auto* body : island.bodies) {
+    body->_solverIndex = solverBodies.size();
+    SolverBody solverBody;
+    solverBody.inverseMass    = body->_inverseMass;
+    solverBody.inverseInertia = WorldInverseInertia(body->_rotation, body->_inverseInertia);
+    solverBody.linearVelocity
+      = body->_linearVelocity.add(_gravity.add(body->_force.scale(body->_inverseMass))
+                                    .scaleInPlace(timeStep))
+          .scaleInPlace(1.f / (1.f + timeStep * body->_linearDamping));
+    solverBody.angularVelocity
+      = body->_angularVelocity
+          .add(solverBody.inverseInertia.transform(body->_torque).scaleInPlace(timeStep))
+          .scaleInPlace(1.f / (1.f + timeStep * body->_angularDamping));
+    solverBodies.emplace_back(solverBody);
+  }
+
+  // Contact constraints, the bounce velocities are computed before warm
+  // starting
+  const auto inverseTimeStep = 1.f / timeStep;
+  for (auto* manifold : island.manifolds) {
+    const auto* bodyA = manifold->bodyA;
+    const auto* bodyB = manifold->bodyB;
+    const auto friction
+      = std::sqrt(std::max(bodyA->_friction, 0.f) * std::max(bodyB->_friction, 0.f));
+    const auto restitution = std::max(bodyA->_restitution, bodyB->_restitution);
+    for (size_t i = 0; i < manifold->pointCount; ++i) {
+      auto& point = manifold->points[i];
+      ContactConstraint c;
+      c.indexA   = solverIndex(bodyA);
+      c.indexB   = solverIndex(bodyB);
+      c.rA       = point.pointA.subtract(bodyA->_position);
+      c.rB       = point.pointB.subtract(bodyB->_position);
+      c.normal   = point.normal;
+      c.friction = friction;
+      c.point    = &point;
+      PlaneSpace(c.normal, c.tangent1, c.tangent2);
+      const auto& a  = solverBodies[c.indexA];
+      const auto& b  = solverBodies[c.indexB];
+      c.normalMass   = EffectiveMass(a, b, c.rA, c.rB, c.normal);
+      c.tangentMass1 = EffectiveMass(a, b, c.rA, c.rB, c.tangent1);
+      c.tangentMass2 = EffectiveMass(a, b, c.rA, c.rB, c.tangent2);
+      // Speculative contacts let the bodies close the gap, penetrations are
+      // pushed out progressively
+      c.velocityTarget
+        = point.separation > 0.f ?
+            -point.separation * inverseTimeStep :
+            Baumgarte * inverseTimeStep * std::max(-point.separation - LinearSlop, 0.f);
+      const auto normalVelocity
+        = Vector3::Dot(RelativeVelocity(a, b, c.rA, c.rB), c.normal);
+      if (normalVelocity < -RestitutionThreshold) {
+        c.velocityTarget = std::max(c.velocityTarget, -restitution * normalVelocity);
+      }
+      contacts.emplace_back(c);
+    }
+  }
+
+  // Joint constraints
+  for (auto* joint : island.joints) {
+    JointConstraint c;
+    c.joint       = joint;
+    c.indexA      = solverIndex(joint->bodyA);
+    c.indexB      = solverIndex(joint->bodyB);
+    c.rA          = joint->bodyA->rotateToWorld(joint->localPivotA);
+    c.rB          = joint->bodyB->rotateToWorld(joint->localPivotB);
+    const auto& a = solverBodies[c.indexA];
+    const auto& b = solverBodies[c.indexB];
+    const auto delta
+      = joint->bodyB->_position.add(c.rB).subtractInPlace(joint->bodyA->_position.add(c.rA));
+    if (joint->type == NativePhysicsJointType::PointToPoint) {
+      // K = (mA + mB) I - [rA] IA [rA] - [rB] IB [rB]
+      Matrix3 k;
+      for (size_t column = 0; column < 3; ++column) {
+        const Vector3 axis(column == 0 ? 1.f : 0.f, column == 1 ? 1.f : 0.f,
+                           column == 2 ? 1.f : 0.f);
+        const auto value
+          = axis.scale(a.inverseMass + b.inverseMass)
+              .addInPlace(
+                Vector3::Cross(a.inverseInertia.transform(Vector3::Cross(c.rA, axis)), c.rA))
+              .addInPlace(
+                Vector3::Cross(b.inverseInertia.transform(Vector3::Cross(c.rB, axis)), c.rB));
+        k.m[column]     = value.x;
+        k.m[3 + column] = value.y;
+        k.m[6 + column] = value.z;
+      }
+      c.mass = k.inverse();
+      c.bias = delta.scale(Baumgarte * inverseTimeStep);
+    }
+    else {
+      c.distance  = delta.length();
+      c.axis      = c.distance > 1e-6f ? delta.scale(1.f / c.distance) : Vector3(0.f, 1.f, 0.f);
+      c.axialMass = EffectiveMass(a, b, c.rA, c.rB, c.axis);
+    }
+    joints.emplace_back(c);
+  }
+
+  // Warm starting with the impulses of the previous step
+  for (const auto& c : contacts) {
+    const auto& point = *c.point;
+    ApplyImpulse(solverBodies[c.indexA], solverBodies[c.indexB], c.rA, c.rB,
+                 c.normal.scale(point.normalImpulse)
+                   .addInPlace(c.tangent1.scale(point.tangentImpulse1))
+                   .addInPlace(c.tangent2.scale(point.tangentImpulse2)));
+  }
+  for (const auto& c : joints) {
+    const auto* joint = c.joint;
+    ApplyImpulse(solverBodies[c.indexA], solverBodies[c.indexB], c.rA, c.rB,
+                 joint->type == NativePhysicsJointType::PointToPoint ?
+                   joint->impulse :
+                   c.axis.scale(joint->lowerImpulse + joint->upperImpulse));
+  }
+
+  // Sequential impulses
+  for (size_t iteration = 0; iteration < _solverIterations; ++iteration) {
+    for (auto& c : joints) {
+      auto& a      = solverBodies[c.indexA];
+      auto& b      = solverBodies[c.indexB];
+      auto* joint  = c.joint;
+      const auto v = RelativeVelocity(a, b, c.rA, c.rB);
+      if (joint->type == NativePhysicsJointType::PointToPoint) {
+        const auto impulse = c.mass.transform(v.add(c.bias)).negate();
+        joint->impulse.addInPlace(impulse);
+        ApplyImpulse(a, b, c.rA, c.rB, impulse);
+        continue;
+      }
+      const auto vn = Vector3::Dot(v, c.axis);
+      auto impulse  = 0.f;
+      if (joint->maxDistance - joint->minDistance <= RigidDistanceRange) {
+        impulse = -c.axialMass
+                  * (vn + Baumgarte * inverseTimeStep * (c.distance - joint->maxDistance));
+        joint->upperImpulse += impulse;
+      }
+      else {
+        // Lower bound: vn >= target, pushing impulses
+        const auto lower = c.distance - joint->minDistance;
+        const auto lowerTarget
+          = lower > 0.f ? -lower * inverseTimeStep : -Baumgarte * lower * inverseTimeStep;
+        const auto oldLower = joint->lowerImpulse;
+        joint->lowerImpulse = std::max(oldLower - c.axialMass * (vn - lowerTarget), 0.f);
+        // Upper bound: vn <= target, pulling impulses
+        const auto upper = joint->maxDistance - c.distance;
+        const auto upperTarget
+          = upper > 0.f ? upper * inverseTimeStep : Baumgarte * upper * inverseTimeStep;
+        const auto oldUpper = joint->upperImpulse;
+        joint->upperImpulse = std::min(oldUpper - c.axialMass * (vn - upperTarget), 0.f);
+        impulse = joint->lowerImpulse - oldLower + joint->upperImpulse - oldUpper;
+      }
+      ApplyImpulse(a, b, c.rA, c.rB, c.axis.scale(impulse));
+    }
+
+    for (auto& c : contacts) {
+      auto& a      = solverBodies[c.indexA];
+      auto& b      = solverBodies[c.indexB];
+      auto& point  = *c.point;
+      // Friction, bounded by the normal impulse of the previous iteration
+      const auto maxFriction = c.friction * point.normalImpulse;
+      auto v                 = RelativeVelocity(a, b, c.rA, c.rB);
+      const auto old1        = point.tangentImpulse1;
+      point.tangentImpulse1
+        = std::clamp(old1 - c.tangentMass1 * Vector3::Dot(v, c.tangent1), -maxFriction,
+                     maxFriction);
+      const auto old2 = point.tangentImpulse2;
+      point.tangentImpulse2
+        = std::clamp(old2 - c.tangentMass2 * Vector3::Dot(v, c.tangent2), -maxFriction,
+                     maxFriction);
+      ApplyImpulse(a, b, c.rA, c.rB,
+                   c.tangent1.scale(point.tangentImpulse1 - old1)
+                     .addInPlace(c.tangent2.scale(point.tangentImpulse2 - old2)));
+      // Non penetration
+      v               = RelativeVelocity(a, b, c.rA, c.rB);
+      const auto vn   = Vector3::Dot(v, c.normal);
+      const auto oldN = point.normalImpulse;
+      point.normalImpulse
+        = std::max(oldN - c.normalMass * (vn - c.velocityTarget), 0.f);
+      ApplyImpulse(a, b, c.rA, c.rB, c.normal.scale(point.normalImpulse - oldN));
+    }
+  }
+
+  // Position integration and sleeping
+  auto minSleepTime = std::numeric_limits<float>::max();
+  for (auto* body : island.bodies) {
+    const auto& solverBody = solverBodies[body->_solverIndex];
+    body->_linearVelocity  = solverBody.linearVelocity;
+    body->_angularVelocity = solverBody.angularVelocity;
+    const auto translation = body->_linearVelocity.length() * timeStep;
+    if (translation > MaxTranslation) {
+      body->_linearVelocity.scaleInPlace(MaxTranslation / translation);
+    }
+    body->_position.addInPlace(body->_linearVelocity.scale(timeStep));
+    // q += dt / 2 * (w, 0) * q
+    const auto& w = body->_angularVelocity;
+    auto& q       = body->_rotation;
+    const auto h  = 0.5f * timeStep;
+    const Quaternion dq(h * (w.x * q.w + w.y * q.z - w.z * q.y),
+                        h * (w.y * q.w + w.z * q.x - w.x * q.z),
+                        h * (w.z * q.w + w.x * q.y - w.y * q.x),
+                        -h * (w.x * q.x + w.y * q.y + w.z * q.z));
+    q.x += dq.x;
+    q.y += dq.y;
+    q.z += dq.z;
+    q.w += dq.w;
+    q.normalize();
+
+    if (body->_linearVelocity.lengthSquared() > SleepLinearVelocity * SleepLinearVelocity
+        || w.lengthSquared() > SleepAngularVelocity * SleepAngularVelocity) {
+      body->_sleepTime = 0.f;
+    }
+    else {
+      body->_sleepTime += timeStep;
+    }
+    minSleepTime = std::min(minSleepTime, body->_sleepTime);
+  }
+  if (minSleepTime >= TimeToSleep) {
+    for (auto* body : island.bodies) {
+      body->sleep();
+    }
+  }
+}
+
+bool NativePhysicsWorld::raycast(const Vector3& from, const Vector3& to,
+                                 NativePhysicsBody*& body, float& fraction,
+                                 Vector3& normal) const
+{
+  const auto direction = to.subtract(from);
+  const auto length    = direction.length();
+  if (length <= 0.f) {
+    return false;
+  }
+  std::vector<NativePhysicsBody*> candidates;
+  _broadphase.queryRay(Ray(from, direction.scale(1.f / length), length), candidates);
+
+  auto hit = false;
+  fraction = std::numeric_limits<float>::max();
+  for (auto* candidate : candidates) {
+    float candidateFraction;
+    Vector3 candidateNormal;
+    if (NativePhysicsCollision::Raycast(*candidate, from, to, candidateFraction, candidateNormal)
+        && candidateFraction < fraction) {
+      hit      = true;
+      body     = candidate;
+      fraction = candidateFraction;
+      normal   = candidateNormal;
+    }
+  }
+  return hit;
+}
+
+size_t NativePhysicsWorld::manifoldCount() const
+{
+  return _manifolds.size();
+}
+
+size_t NativePhysicsWorld::awakeIslandCount() const
+{
+  return _awakeIslands.size();
+}
+
+size_t NativePhysicsWorld::awakeBodyCount() const
+{
+  return static_cast<size_t>(
+    std::count_if(_bodies.begin(), _bodies.end(), [](const std::unique_ptr<NativePhysicsBody>& b) {
+      return IsActive(b.get());
+    }));
+}
+
+} // end of namespace BABYLON
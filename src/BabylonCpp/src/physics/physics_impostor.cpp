@@ -116,7 +116,13 @@ PhysicsImpostor::PhysicsImpostor(IPhysicsEnabledObject* iObject, unsigned int iT
   }
 }
 
-PhysicsImpostor::~PhysicsImpostor() = default;
+PhysicsImpostor::~PhysicsImpostor()
+{
+  // The engine does not own the impostor, it must not keep a dangling pointer
+  if (_physicsEngine && !_isDisposed) {
+    _physicsEngine->removeImpostor(this);
+  }
+}
 
 void PhysicsImpostor::_init()
 {
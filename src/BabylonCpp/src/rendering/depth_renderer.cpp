@@ -1,5 +1,6 @@
 #include <babylon/rendering/depth_renderer.h>
 
+#include <babylon/baked_vertex_animation/baked_vertex_animation_manager.h>
 #include <babylon/bones/skeleton.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/engines/engine.h>
@@ -121,9 +122,12 @@ DepthRenderer::DepthRenderer(Scene* scene, unsigned int type, const CameraPtr& c
         }
       }
 
-      // Bones
-      if (renderingMesh->useBones() && renderingMesh->computeBonesUsingShaders()
-          && renderingMesh->skeleton()) {
+      // Bones, the skeleton of a mesh playing a baked vertex animation is not prepared
+      if (MaterialHelper::UseBakedVertexAnimation(renderingMesh.get())) {
+        renderingMesh->bakedVertexAnimationManager()->bind(_effect, hardwareInstancedRendering);
+      }
+      else if (renderingMesh->useBones() && renderingMesh->computeBonesUsingShaders()
+               && renderingMesh->skeleton()) {
         _effect->setMatrices("mBones",
                              renderingMesh->skeleton()->getTransformMatrices(renderingMesh.get()));
       }
@@ -211,6 +215,14 @@ bool DepthRenderer::isReady(SubMesh* subMesh, bool useInstances)
     defines.emplace_back("#define NUM_BONE_INFLUENCERS 0");
   }
 
+  // Baked vertex animation
+  if (MaterialHelper::UseBakedVertexAnimation(mesh.get())) {
+    defines.emplace_back("#define BAKED_VERTEX_ANIMATION_TEXTURE");
+    if (useInstances) {
+      attribs.emplace_back("bakedVertexAnimationSettingsInstanced");
+    }
+  }
+
   // Morph targets
   auto morphTargetManager  = std::static_pointer_cast<Mesh>(mesh)->morphTargetManager();
   auto numMorphInfluencers = 0ull;
@@ -249,9 +261,16 @@ bool DepthRenderer::isReady(SubMesh* subMesh, bool useInstances)
 
     IEffectCreationOptions options;
     options.attributes    = std::move(attribs);
-    options.uniformsNames = {"world",         "mBones",      "viewProjection",
-                             "diffuseMatrix", "depthValues", "morphTargetInfluences"};
-    options.samplers      = {"diffuseSampler"};
+    options.uniformsNames = {"world",
+                             "mBones",
+                             "viewProjection",
+                             "diffuseMatrix",
+                             "depthValues",
+                             "morphTargetInfluences",
+                             "bakedVertexAnimationSettings",
+                             "bakedVertexAnimationTextureSizeInverted",
+                             "bakedVertexAnimationTime"};
+    options.samplers      = {"diffuseSampler", "bakedVertexAnimationTexture"};
     options.defines       = std::move(join);
     options.indexParameters
       = {{"maxSimultaneousMorphTargets", static_cast<unsigned>(numMorphInfluencers)}};
@@ -1,7 +1,13 @@
 #include <babylon/rendering/edges_renderer.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
 #include <babylon/babylon_stl_util.h>
 #include <babylon/cameras/camera.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
 #include <babylon/materials/ishader_material_options.h>
@@ -12,8 +18,24 @@
 
 namespace BABYLON {
 
+namespace {
+
+using GridCell = std::array<int64_t, 3>;
+
+struct GridCellHash {
+  size_t operator()(const GridCell& cell) const
+  {
+    size_t hash = std::hash<int64_t>{}(cell[0]);
+    hash        = hash * 31 + std::hash<int64_t>{}(cell[1]);
+    return hash * 31 + std::hash<int64_t>{}(cell[2]);
+  }
+}; // end of struct GridCellHash
+
+} // end of anonymous namespace
+
 EdgesRenderer::EdgesRenderer(const AbstractMeshPtr& source, float epsilon,
-                             bool checkVerticesInsteadOfIndices, bool generateEdgesLines)
+                             bool checkVerticesInsteadOfIndices, bool generateEdgesLines,
+                             float epsilonVertexMerge)
     : edgesWidthScalerForOrthographic{1000.f}
     , edgesWidthScalerForPerspective{50.f}
     , _source{source}
@@ -21,6 +43,7 @@ EdgesRenderer::EdgesRenderer(const AbstractMeshPtr& source, float epsilon,
     , _lineShader{nullptr}
     , _ib{nullptr}
     , _checkVerticesInsteadOfIndices{checkVerticesInsteadOfIndices}
+    , _epsilonVertexMerge{epsilonVertexMerge}
 {
   isEnabled = true;
 
@@ -100,92 +123,104 @@ void EdgesRenderer::dispose(bool /*doNotRecurse*/, bool /*disposeMaterialAndText
   _lineShader->dispose();
 }
 
-int EdgesRenderer::_processEdgeForAdjacencies(unsigned int pa, unsigned int pb, unsigned int p0,
-                                              unsigned int p1, unsigned int p2)
+Uint32Array EdgesRenderer::_weldVertices(const Float32Array& positions) const
 {
-  if ((pa == p0 && pb == p1) || (pa == p1 && pb == p0)) {
-    return 0;
-  }
-
-  if ((pa == p1 && pb == p2) || (pa == p2 && pb == p1)) {
-    return 1;
-  }
-
-  if ((pa == p2 && pb == p0) || (pa == p0 && pb == p2)) {
-    return 2;
-  }
-
-  return -1;
-}
-
-int EdgesRenderer::_processEdgeForAdjacenciesWithVertices(const Vector3& pa, const Vector3& pb,
-                                                          const Vector3& p0, const Vector3& p1,
-                                                          const Vector3& p2)
-{
-  if ((pa.equalsWithEpsilon(p0) && pb.equalsWithEpsilon(p1))
-      || (pa.equalsWithEpsilon(p1) && pb.equalsWithEpsilon(p0))) {
-    return 0;
-  }
-
-  if ((pa.equalsWithEpsilon(p1) && pb.equalsWithEpsilon(p2))
-      || (pa.equalsWithEpsilon(p2) && pb.equalsWithEpsilon(p1))) {
-    return 1;
-  }
+  const auto verticesCount = positions.size() / 3;
+  Uint32Array welded(verticesCount);
+
+  // Vertices closer than the merge epsilon (per coordinate) are at most one
+  // cell away from each other, so only the 27 surrounding cells are searched
+  const auto cellSize = std::max(_epsilonVertexMerge, std::numeric_limits<float>::min());
+  std::unordered_map<GridCell, Uint32Array, GridCellHash> grid;
+  grid.reserve(verticesCount);
+
+  for (size_t vertex = 0; vertex < verticesCount; ++vertex) {
+    const auto position = Vector3::FromArray(positions, static_cast<unsigned int>(vertex * 3));
+    const GridCell cell{{static_cast<int64_t>(std::floor(position.x / cellSize)),
+                         static_cast<int64_t>(std::floor(position.y / cellSize)),
+                         static_cast<int64_t>(std::floor(position.z / cellSize))}};
+
+    auto canonical = static_cast<uint32_t>(vertex);
+    auto found     = false;
+    for (int64_t dx = -1; dx <= 1 && !found; ++dx) {
+      for (int64_t dy = -1; dy <= 1 && !found; ++dy) {
+        for (int64_t dz = -1; dz <= 1 && !found; ++dz) {
+          auto it = grid.find({{cell[0] + dx, cell[1] + dy, cell[2] + dz}});
+          if (it == grid.end()) {
+            continue;
+          }
+          for (auto other : it->second) {
+            const auto otherPosition = Vector3::FromArray(positions, other * 3);
+            if (position.equalsWithEpsilon(otherPosition, _epsilonVertexMerge)) {
+              canonical = other;
+              found     = true;
+              break;
+            }
+          }
+        }
+      }
+    }
 
-  if ((pa.equalsWithEpsilon(p2) && pb.equalsWithEpsilon(p0))
-      || (pa.equalsWithEpsilon(p0) && pb.equalsWithEpsilon(p2))) {
-    return 2;
+    if (!found) {
+      grid[cell].emplace_back(canonical);
+    }
+    welded[vertex] = canonical;
   }
 
-  return -1;
+  return welded;
 }
 
-void EdgesRenderer::_checkEdge(size_t faceIndex, int edge, const std::vector<Vector3>& faceNormals,
-                               const Vector3& p0, const Vector3& p1)
+bool EdgesRenderer::_checkEdge(size_t faceIndex, int edge,
+                               const std::vector<Vector3>& faceNormals) const
 {
-  auto needToCreateLine = false;
-
   if (edge == -1) {
-    needToCreateLine = true;
-  }
-  else {
-    auto dotProduct  = Vector3::Dot(faceNormals[faceIndex], faceNormals[static_cast<size_t>(edge)]);
-    needToCreateLine = dotProduct < _epsilon;
+    return true;
   }
 
-  if (needToCreateLine) {
-    const auto offset = static_cast<uint32_t>(_linesPositions.size() / 3);
-    createLine(p0, p1, offset);
-  }
+  const auto dotProduct
+    = Vector3::Dot(faceNormals[faceIndex], faceNormals[static_cast<size_t>(edge)]);
+  return dotProduct < _epsilon;
 }
 
 void EdgesRenderer::createLine(const Vector3& p0, const Vector3& p1, uint32_t offset)
 {
   // Positions
-  stl_util::concat(_linesPositions, {
-                                      p0.x, p0.y, p0.z, //
-                                      p0.x, p0.y, p0.z, //
-                                      p1.x, p1.y, p1.z, //
-                                      p1.x, p1.y, p1.z  //
-                                    });
+  auto positions = &_linesPositions[offset * 3];
+  for (const auto* p : {&p0, &p0, &p1, &p1}) {
+    *positions++ = p->x;
+    *positions++ = p->y;
+    *positions++ = p->z;
+  }
 
   // Normals
-  stl_util::concat(_linesNormals, {
-                                    p1.x, p1.y, p1.z, -1.f, //
-                                    p1.x, p1.y, p1.z, 1.f,  //
-                                    p0.x, p0.y, p0.z, -1.f, //
-                                    p0.x, p0.y, p0.z, 1.f   //
-                                  });
+  auto normals = &_linesNormals[offset * 4];
+  auto side    = -1.f;
+  for (const auto* p : {&p1, &p1, &p0, &p0}) {
+    *normals++ = p->x;
+    *normals++ = p->y;
+    *normals++ = p->z;
+    *normals++ = side;
+    side       = -side;
+  }
 
   // Indices
-  stl_util::concat(_linesIndices, {
-                                    offset, offset + 1, offset + 2, //
-                                    offset, offset + 2, offset + 3  //
-                                  });
+  auto indices = &_linesIndices[offset / 4 * 6];
+  for (uint32_t index : {0u, 1u, 2u, 0u, 2u, 3u}) {
+    *indices++ = offset + index;
+  }
+}
+
+void EdgesRenderer::_allocateLines(size_t linesCount)
+{
+  _linesPositions.resize(linesCount * 4 * 3);
+  _linesNormals.resize(linesCount * 4 * 4);
+  _linesIndices.resize(linesCount * 6);
 }
 
 void EdgesRenderer::_generateEdgesLines()
 {
+  static constexpr size_t facesGrainSize = 1024;
+
   auto positions = _source->getVerticesData(VertexBuffer::PositionKind);
   auto indices   = _source->getIndices();
 
@@ -193,123 +228,154 @@ void EdgesRenderer::_generateEdgesLines()
     return;
   }
 
-  // First let's find adjacencies
-  std::vector<FaceAdjacencies> adjacencies;
-  std::vector<Vector3> faceNormals;
+  const auto facesCount = indices.size() / 3;
+  auto& threadPool      = ThreadPool::Default();
 
   // Prepare faces
-  for (unsigned int index = 0; index < indices.size(); index += 3) {
-    FaceAdjacencies _faceAdjacencies;
-    unsigned int p0Index = indices[index + 0];
-    unsigned int p1Index = indices[index + 1];
-    unsigned int p2Index = indices[index + 2];
-
-    _faceAdjacencies.edges = {0, 0, 0};
-
-    _faceAdjacencies.p0
-      = Vector3(positions[p0Index * 3 + 0], positions[p0Index * 3 + 1], positions[p0Index * 3 + 2]);
-    _faceAdjacencies.p1
-      = Vector3(positions[p1Index * 3 + 0], positions[p1Index * 3 + 1], positions[p1Index * 3 + 2]);
-    _faceAdjacencies.p2
-      = Vector3(positions[p2Index * 3 + 0], positions[p2Index * 3 + 1], positions[p2Index * 3 + 2]);
-    auto faceNormal = Vector3::Cross(_faceAdjacencies.p1.subtract(_faceAdjacencies.p0),
-                                     _faceAdjacencies.p2.subtract(_faceAdjacencies.p1));
-
-    faceNormal.normalize();
-
-    faceNormals.emplace_back(faceNormal);
-    adjacencies.emplace_back(_faceAdjacencies);
+  std::vector<FaceAdjacencies> adjacencies(facesCount);
+  std::vector<Vector3> faceNormals(facesCount);
+  threadPool.parallelFor(
+    facesCount, facesGrainSize,
+    [&adjacencies, &faceNormals, &positions, &indices](size_t begin, size_t end) {
+      for (size_t index = begin; index < end; ++index) {
+        auto& faceAdjacencies = adjacencies[index];
+        faceAdjacencies.edges = {-1, -1, -1};
+        faceAdjacencies.p0    = Vector3::FromArray(positions, indices[index * 3 + 0] * 3);
+        faceAdjacencies.p1    = Vector3::FromArray(positions, indices[index * 3 + 1] * 3);
+        faceAdjacencies.p2    = Vector3::FromArray(positions, indices[index * 3 + 2] * 3);
+
+        auto faceNormal = Vector3::Cross(faceAdjacencies.p1.subtract(faceAdjacencies.p0),
+                                         faceAdjacencies.p2.subtract(faceAdjacencies.p1));
+        faceNormal.normalize();
+        faceNormals[index] = faceNormal;
+      }
+    });
+
+  // Sort the edges on their (welded) vertex ids, the edges shared by several
+  // faces are then grouped in the faces order
+  const auto welded = _checkVerticesInsteadOfIndices ? _weldVertices(positions) : Uint32Array{};
+  const auto vertexId = [&welded, &indices](size_t index) {
+    return welded.empty() ? indices[index] : welded[indices[index]];
+  };
+
+  const auto edgesCount = facesCount * 3;
+  std::vector<std::pair<uint64_t, uint32_t>> sortedEdges(edgesCount);
+  threadPool.parallelFor(
+    facesCount, facesGrainSize, [&sortedEdges, &vertexId](size_t begin, size_t end) {
+      for (size_t edge = begin * 3; edge < end * 3; ++edge) {
+        const auto pa     = vertexId(edge);
+        const auto pb     = vertexId(edge - edge % 3 + (edge + 1) % 3);
+        const auto key    = pa < pb ? (static_cast<uint64_t>(pa) << 32) | pb :
+                                      (static_cast<uint64_t>(pb) << 32) | pa;
+        sortedEdges[edge] = {key, static_cast<uint32_t>(edge)};
+      }
+    });
+  std::sort(sortedEdges.begin(), sortedEdges.end());
+
+  // Rank of each edge in the sorted edges, and first rank of its group, which
+  // holds the cursor on the next candidate of the group
+  std::vector<uint32_t> ranks(edgesCount), groups(edgesCount), cursors(edgesCount);
+  for (uint32_t rank = 0; rank < edgesCount; ++rank) {
+    ranks[sortedEdges[rank].second] = rank;
+    groups[rank]  = (rank > 0 && sortedEdges[rank - 1].first == sortedEdges[rank].first) ?
+                      groups[rank - 1] :
+                      rank;
+    cursors[rank] = rank;
   }
 
-  // Scan
-  for (unsigned int index = 0; index < adjacencies.size(); ++index) {
+  // Find adjacencies: each free edge of a face is connected to the first
+  // following face sharing it which is not full yet, the same way as when all
+  // the faces were compared with each other. Faces already passed or full are
+  // never candidates again, so the cursors only move forward
+  for (size_t index = 0; index < facesCount; ++index) {
     auto& faceAdjacencies = adjacencies[index];
+    if (faceAdjacencies.edgesConnectedCount == 3) {
+      continue;
+    }
 
-    for (unsigned int otherIndex = index + 1; otherIndex < adjacencies.size(); ++otherIndex) {
-      auto& otherFaceAdjacencies = adjacencies[otherIndex];
-
-      if (faceAdjacencies.edgesConnectedCount == 3) { // Full
-        break;
-      }
-
-      if (otherFaceAdjacencies.edgesConnectedCount == 3) { // Full
+    // Other face, edge and other edge of the connections
+    std::array<std::array<uint32_t, 3>, 3> connections;
+    size_t connectionsCount = 0;
+    for (uint32_t edgeIndex = 0; edgeIndex < 3; ++edgeIndex) {
+      if (faceAdjacencies.edges[edgeIndex] != -1) {
         continue;
       }
 
-      const auto& otherP0 = indices[otherIndex * 3 + 0];
-      const auto& otherP1 = indices[otherIndex * 3 + 1];
-      const auto& otherP2 = indices[otherIndex * 3 + 2];
-
-      for (unsigned int edgeIndex = 0; edgeIndex < 3; ++edgeIndex) {
-        int otherEdgeIndex = 0;
-
-        if (edgeIndex >= faceAdjacencies.edges.size()) {
-          continue;
-        }
-
-        switch (edgeIndex) {
-          case 0:
-            if (_checkVerticesInsteadOfIndices) {
-              otherEdgeIndex = _processEdgeForAdjacenciesWithVertices(
-                faceAdjacencies.p0, faceAdjacencies.p1, otherFaceAdjacencies.p0,
-                otherFaceAdjacencies.p1, otherFaceAdjacencies.p2);
-            }
-            else {
-              otherEdgeIndex = _processEdgeForAdjacencies(
-                indices[index * 3], indices[index * 3 + 1], otherP0, otherP1, otherP2);
-            }
-            break;
-          case 1:
-            if (_checkVerticesInsteadOfIndices) {
-              otherEdgeIndex = _processEdgeForAdjacenciesWithVertices(
-                faceAdjacencies.p1, faceAdjacencies.p2, otherFaceAdjacencies.p0,
-                otherFaceAdjacencies.p1, otherFaceAdjacencies.p2);
-            }
-            else {
-              otherEdgeIndex = _processEdgeForAdjacencies(
-                indices[index * 3 + 1], indices[index * 3 + 2], otherP0, otherP1, otherP2);
-            }
-            break;
-          case 2:
-          default:
-            if (_checkVerticesInsteadOfIndices) {
-              otherEdgeIndex = _processEdgeForAdjacenciesWithVertices(
-                faceAdjacencies.p2, faceAdjacencies.p0, otherFaceAdjacencies.p0,
-                otherFaceAdjacencies.p1, otherFaceAdjacencies.p2);
-            }
-            else {
-              otherEdgeIndex = _processEdgeForAdjacencies(
-                indices[index * 3 + 2], indices[index * 3], otherP0, otherP1, otherP2);
-            }
+      const auto rank = ranks[index * 3 + edgeIndex];
+      const auto key  = sortedEdges[rank].first;
+      auto& cursor    = cursors[groups[rank]];
+      for (; cursor < edgesCount && sortedEdges[cursor].first == key; ++cursor) {
+        const auto otherIndex = sortedEdges[cursor].second / 3;
+        if (otherIndex > index && adjacencies[otherIndex].edgesConnectedCount < 3) {
+          connections[connectionsCount++]
+            = {otherIndex, edgeIndex, sortedEdges[cursor].second % 3};
+          break;
         }
+      }
+    }
 
-        if (otherEdgeIndex == -1) {
-          continue;
-        }
+    std::sort(connections.begin(), connections.begin() + connectionsCount);
+    for (size_t connection = 0; connection < connectionsCount; ++connection) {
+      if (faceAdjacencies.edgesConnectedCount == 3) {
+        break;
+      }
 
-        faceAdjacencies.edges[edgeIndex] = static_cast<int>(otherIndex);
-        otherFaceAdjacencies.edges[static_cast<size_t>(otherEdgeIndex)] = static_cast<int>(index);
+      const auto [otherIndex, edgeIndex, otherEdgeIndex] = connections[connection];
+      auto& otherFaceAdjacencies                         = adjacencies[otherIndex];
 
-        ++faceAdjacencies.edgesConnectedCount;
-        ++otherFaceAdjacencies.edgesConnectedCount;
+      faceAdjacencies.edges[edgeIndex]           = static_cast<int>(otherIndex);
+      otherFaceAdjacencies.edges[otherEdgeIndex] = static_cast<int>(index);
+      ++faceAdjacencies.edgesConnectedCount;
+      ++otherFaceAdjacencies.edgesConnectedCount;
+    }
+  }
 
-        if (faceAdjacencies.edgesConnectedCount == 3) {
-          break;
+  // We need a line when a face has no adjacency on a specific edge or if all
+  // the adjacencies has an angle greater than epsilon
+  std::vector<uint8_t> linesMasks(facesCount);
+  threadPool.parallelFor(
+    facesCount, facesGrainSize,
+    [this, &adjacencies, &faceNormals, &linesMasks](size_t begin, size_t end) {
+      for (size_t index = begin; index < end; ++index) {
+        const auto& edges = adjacencies[index].edges;
+        uint8_t mask      = 0;
+        for (uint32_t edgeIndex = 0; edgeIndex < 3; ++edgeIndex) {
+          if (_checkEdge(index, edges[edgeIndex], faceNormals)) {
+            mask |= static_cast<uint8_t>(1u << edgeIndex);
+          }
         }
+        linesMasks[index] = mask;
       }
-    }
+    });
+
+  // Offsets of the lines of each face, so that they can be written in parallel
+  // while keeping the faces order
+  std::vector<uint32_t> linesOffsets(facesCount + 1, 0);
+  for (size_t index = 0; index < facesCount; ++index) {
+    const auto mask         = linesMasks[index];
+    linesOffsets[index + 1] = linesOffsets[index] + (mask & 1u) + ((mask >> 1) & 1u) + (mask >> 2);
   }
 
   // Create lines
-  for (unsigned index = 0; index < adjacencies.size(); ++index) {
-    // We need a line when a face has no adjacency on a specific edge or if all
-    // the adjacencies has an angle greater than epsilon
-    const auto& current = adjacencies[index];
-
-    _checkEdge(index, current.edges[0], faceNormals, current.p0, current.p1);
-    _checkEdge(index, current.edges[1], faceNormals, current.p1, current.p2);
-    _checkEdge(index, current.edges[2], faceNormals, current.p2, current.p0);
-  }
+  _allocateLines(linesOffsets[facesCount]);
+  threadPool.parallelFor(
+    facesCount, facesGrainSize,
+    [this, &adjacencies, &linesMasks, &linesOffsets](size_t begin, size_t end) {
+      for (size_t index = begin; index < end; ++index) {
+        const auto& current = adjacencies[index];
+        const auto mask     = linesMasks[index];
+        auto line           = linesOffsets[index];
+        if (mask & 1u) {
+          createLine(current.p0, current.p1, 4 * line++);
+        }
+        if (mask & 2u) {
+          createLine(current.p1, current.p2, 4 * line++);
+        }
+        if (mask & 4u) {
+          createLine(current.p2, current.p0, 4 * line++);
+        }
+      }
+    });
 
   // Merge into a single mesh
   auto engine = _source->getScene()->getEngine();
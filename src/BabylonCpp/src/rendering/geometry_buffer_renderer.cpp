@@ -1,6 +1,7 @@
 #include <babylon/rendering/geometry_buffer_renderer.h>
 
 #include <babylon/babylon_stl_util.h>
+#include <babylon/baked_vertex_animation/baked_vertex_animation_manager.h>
 #include <babylon/bones/skeleton.h>
 #include <babylon/engines/constants.h>
 #include <babylon/engines/engine.h>
@@ -207,7 +208,8 @@ bool GeometryBufferRenderer::isReady(SubMesh* subMesh, bool useInstances)
   if (_enableVelocity) {
     defines.emplace_back("#define VELOCITY");
     defines.emplace_back("#define VELOCITY_INDEX " + std::to_string(_velocityIndex));
-    if (stl_util::contains(excludedSkinnedMeshesFromVelocity, mesh)) {
+    if (stl_util::contains(excludedSkinnedMeshesFromVelocity, mesh)
+        && !MaterialHelper::UseBakedVertexAnimation(mesh.get())) {
       defines.emplace_back("#define BONES_VELOCITY_ENABLED");
     }
   }
@@ -235,6 +237,14 @@ bool GeometryBufferRenderer::isReady(SubMesh* subMesh, bool useInstances)
     defines.emplace_back("#define NUM_BONE_INFLUENCERS 0");
   }
 
+  // Baked vertex animation
+  if (MaterialHelper::UseBakedVertexAnimation(mesh.get())) {
+    defines.emplace_back("#define BAKED_VERTEX_ANIMATION_TEXTURE");
+    if (useInstances) {
+      attribs.emplace_back("bakedVertexAnimationSettingsInstanced");
+    }
+  }
+
   // Morph targets
   auto morphTargetManager  = std::static_pointer_cast<Mesh>(mesh)->morphTargetManager();
   auto numMorphInfluencers = 0ull;
@@ -282,8 +292,12 @@ bool GeometryBufferRenderer::isReady(SubMesh* subMesh, bool useInstances)
                              "bumpMatrix",
                              "reflectivityMatrix",
                              "vTangentSpaceParams",
-                             "vBumpInfos"};
-    options.samplers        = {"diffuseSampler", "bumpSampler", "reflectivitySampler"};
+                             "vBumpInfos",
+                             "bakedVertexAnimationSettings",
+                             "bakedVertexAnimationTextureSizeInverted",
+                             "bakedVertexAnimationTime"};
+    options.samplers        = {"diffuseSampler", "bumpSampler", "reflectivitySampler",
+                             "bakedVertexAnimationTexture"};
     options.defines         = std::move(join);
     options.indexParameters = std::move(indexParameters);
     options.indexParameters
@@ -508,9 +522,12 @@ void GeometryBufferRenderer::renderSubMesh(SubMesh* subMesh)
       }
     }
 
-    // Bones
-    if (renderingMesh->useBones() && renderingMesh->computeBonesUsingShaders()
-        && renderingMesh->skeleton()) {
+    // Bones, the skeleton of a mesh playing a baked vertex animation is not prepared
+    if (MaterialHelper::UseBakedVertexAnimation(renderingMesh.get())) {
+      renderingMesh->bakedVertexAnimationManager()->bind(_effect, hardwareInstancedRendering);
+    }
+    else if (renderingMesh->useBones() && renderingMesh->computeBonesUsingShaders()
+             && renderingMesh->skeleton()) {
       _effect->setMatrices("mBones",
                            renderingMesh->skeleton()->getTransformMatrices(renderingMesh.get()));
       if (_enableVelocity) {
@@ -30,6 +30,7 @@ void LineEdgesRenderer::_generateEdgesLines_specialized()
   auto& p0 = TmpVectors::Vector3Array[0];
   auto& p1 = TmpVectors::Vector3Array[1];
   auto len = indices.size() - 1;
+  _allocateLines(indices.size() / 2);
   for (uint32_t i = 0, offset = 0; i < len; i += 2, offset += 4) {
     Vector3::FromArrayToRef(positions, 3 * indices[i], p0);
     Vector3::FromArrayToRef(positions, 3 * indices[i + 1], p1);
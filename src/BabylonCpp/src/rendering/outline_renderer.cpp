@@ -1,5 +1,6 @@
 #include <babylon/rendering/outline_renderer.h>
 
+#include <babylon/baked_vertex_animation/baked_vertex_animation_manager.h>
 #include <babylon/bones/skeleton.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/engines/constants.h>
@@ -96,9 +97,12 @@ void OutlineRenderer::render(SubMesh* subMesh, const _InstancesBatchPtr& batch,
                      useOverlay ? renderingMesh->overlayAlpha : material->alpha());
   _effect->setMatrix("viewProjection", scene->getTransformMatrix());
 
-  // Bones
-  if (renderingMesh->useBones() && renderingMesh->computeBonesUsingShaders()
-      && renderingMesh->skeleton()) {
+  // Bones, the skeleton of a mesh playing a baked vertex animation is not prepared
+  if (MaterialHelper::UseBakedVertexAnimation(renderingMesh.get())) {
+    renderingMesh->bakedVertexAnimationManager()->bind(_effect, hardwareInstancedRendering);
+  }
+  else if (renderingMesh->useBones() && renderingMesh->computeBonesUsingShaders()
+           && renderingMesh->skeleton()) {
     _effect->setMatrices("mBones",
                          renderingMesh->skeleton()->getTransformMatrices(renderingMesh.get()));
   }
@@ -173,6 +177,14 @@ bool OutlineRenderer::isReady(SubMesh* subMesh, bool useInstances)
     defines.emplace_back("#define NUM_BONE_INFLUENCERS 0");
   }
 
+  // Baked vertex animation
+  if (MaterialHelper::UseBakedVertexAnimation(mesh.get())) {
+    defines.emplace_back("#define BAKED_VERTEX_ANIMATION_TEXTURE");
+    if (useInstances) {
+      attribs.emplace_back("bakedVertexAnimationSettingsInstanced");
+    }
+  }
+
   // Morph targets
   auto morphTargetManager  = std::static_pointer_cast<Mesh>(mesh)->morphTargetManager();
   auto numMorphInfluencers = 0ull;
@@ -201,10 +213,18 @@ bool OutlineRenderer::isReady(SubMesh* subMesh, bool useInstances)
 
     IEffectCreationOptions options;
     options.attributes = std::move(attribs);
-    options.uniformsNames
-      = {"world",  "mBones", "viewProjection",           "diffuseMatrix",
-         "offset", "color",  "logarithmicDepthConstant", "morphTargetInfluences"};
-    options.samplers = {"diffuseSampler"};
+    options.uniformsNames = {"world",
+                             "mBones",
+                             "viewProjection",
+                             "diffuseMatrix",
+                             "offset",
+                             "color",
+                             "logarithmicDepthConstant",
+                             "morphTargetInfluences",
+                             "bakedVertexAnimationSettings",
+                             "bakedVertexAnimationTextureSizeInverted",
+                             "bakedVertexAnimationTime"};
+    options.samplers      = {"diffuseSampler", "bakedVertexAnimationTexture"};
     options.defines  = std::move(join);
     options.indexParameters
       = {{"maxSimultaneousMorphTargets", static_cast<unsigned>(numMorphInfluencers)}};
@@ -3,6 +3,7 @@
 
 #include "../test_utils.h"
 
+#include <babylon/animations/_ianimation_state.h>
 #include <babylon/animations/animation.h>
 #include <babylon/animations/ianimation_key.h>
 #include <babylon/engines/scene.h>
@@ -29,3 +30,109 @@ TEST(Animation, OneKey)
   }
 #endif
 }
+
+namespace {
+
+/**
+ * @brief Creates a float animation whose value is twice the frame, with keys
+ * every other frame.
+ */
+BABYLON::AnimationPtr CreateLinearAnimation(size_t nbKeys)
+{
+  using namespace BABYLON;
+
+  auto animation
+    = Animation::New("anim", "position.x", 30, static_cast<int>(Animation::ANIMATIONTYPE_FLOAT));
+  std::vector<IAnimationKey> keys;
+  for (size_t i = 0; i < nbKeys; ++i) {
+    const auto frame = static_cast<float>(i * 2);
+    keys.emplace_back(frame, AnimationValue(frame * 2.f));
+  }
+  animation->setKeys(keys);
+  return animation;
+}
+
+BABYLON::_IAnimationState CreateState()
+{
+  BABYLON::_IAnimationState state;
+  state.key         = 0;
+  state.repeatCount = 0;
+  state.loopMode    = BABYLON::Animation::ANIMATIONLOOPMODE_CYCLE;
+  return state;
+}
+
+} // end of anonymous namespace
+
+TEST(Animation, InterpolateForwardAndSeek)
+{
+  using namespace BABYLON;
+
+  auto animation = CreateLinearAnimation(100);
+  auto state     = CreateState();
+
+  // Forward playback
+  for (float frame = 0.f; frame <= 198.f; frame += 0.25f) {
+    EXPECT_FLOAT_EQ(animation->_interpolate(frame, state).get<float>(), frame * 2.f);
+  }
+  EXPECT_EQ(state.key, 98);
+
+  // Seeks backward and forward
+  for (float frame : {3.f, 150.5f, 1.f, 197.f, 0.f, 42.f, 41.9f}) {
+    EXPECT_FLOAT_EQ(animation->_interpolate(frame, state).get<float>(), frame * 2.f);
+  }
+
+  // Frames after the last key hold its value
+  EXPECT_FLOAT_EQ(animation->_interpolate(250.f, state).get<float>(), 396.f);
+}
+
+TEST(Animation, InterpolateAfterKeysChange)
+{
+  using namespace BABYLON;
+
+  auto animation = CreateLinearAnimation(10);
+  auto state     = CreateState();
+  EXPECT_FLOAT_EQ(animation->_interpolate(3.f, state).get<float>(), 6.f);
+
+  // Keys modified in place
+  animation->getKeys()[2].value = AnimationValue(0.f);
+  EXPECT_FLOAT_EQ(animation->_interpolate(3.f, state).get<float>(), 2.f);
+
+  // Keys replaced by fewer keys, the previous segment no longer exists
+  animation->setKeys({
+    IAnimationKey(0.f, AnimationValue(1.f)),
+    IAnimationKey(4.f, AnimationValue(5.f)),
+  });
+  EXPECT_FLOAT_EQ(animation->_interpolate(3.f, state).get<float>(), 4.f);
+}
+
+TEST(Animation, InterpolateStepKeys)
+{
+  using namespace BABYLON;
+
+  auto animation = Animation::New("anim", "position", 30,
+                                  static_cast<int>(Animation::ANIMATIONTYPE_VECTOR3));
+  // Step interpolation as set by the glTF loader
+  const auto step = AnimationValue(1);
+  animation->setKeys({
+    IAnimationKey(0.f, AnimationValue(Vector3(0.f, 0.f, 0.f)), std::nullopt, std::nullopt, step),
+    IAnimationKey(10.f, AnimationValue(Vector3(1.f, 2.f, 3.f)), std::nullopt, std::nullopt, step),
+    IAnimationKey(20.f, AnimationValue(Vector3(2.f, 4.f, 6.f))),
+  });
+
+  auto state = CreateState();
+  EXPECT_TRUE(animation->_interpolate(5.f, state).get<Vector3>().equals(Vector3(0.f, 0.f, 0.f)));
+  EXPECT_TRUE(animation->_interpolate(15.f, state).get<Vector3>().equals(Vector3(1.f, 2.f, 3.f)));
+  EXPECT_TRUE(animation->_interpolate(25.f, state).get<Vector3>().equals(Vector3(2.f, 4.f, 6.f)));
+}
+
+TEST(Animation, InterpolateRelativeLoopMode)
+{
+  using namespace BABYLON;
+
+  auto animation    = CreateLinearAnimation(3);
+  auto state        = CreateState();
+  state.loopMode    = Animation::ANIMATIONLOOPMODE_RELATIVE;
+  state.repeatCount = 2;
+  state.offsetValue = AnimationValue(8.f);
+  EXPECT_FLOAT_EQ(animation->_interpolate(1.f, state).get<float>(), 18.f);
+}
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/animations/animation.h>
+#include <babylon/animations/ianimation_key.h>
+#include <babylon/animations/runtime_animation.h>
+#include <babylon/babylon_constants.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/morph/morph_target.h>
+
+namespace {
+
+/**
+ * @brief Creates an animation going from a value at frame 0 to another one at
+ * frame 10.
+ */
+BABYLON::AnimationPtr CreateAnimation(const std::string& targetProperty, unsigned int dataType,
+                                      const BABYLON::AnimationValue& from,
+                                      const BABYLON::AnimationValue& to)
+{
+  using namespace BABYLON;
+
+  auto animation = Animation::New("animation", targetProperty, 30, static_cast<int>(dataType));
+  std::vector<IAnimationKey> keys{
+    IAnimationKey(0.f, from),
+    IAnimationKey(10.f, to),
+  };
+  animation->setKeys(keys);
+  return animation;
+}
+
+} // end of anonymous namespace
+
+TEST(RuntimeAnimation, SetsTransformNodeProperties)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto box    = Mesh::CreateBox("box", 1.f, scene.get());
+
+  auto position = RuntimeAnimation::New(
+    box, CreateAnimation("position", Animation::ANIMATIONTYPE_VECTOR3, Vector3(0.f, 0.f, 0.f),
+                         Vector3(2.f, 4.f, 6.f)),
+    scene.get(), nullptr);
+  position->goToFrame(5.f);
+  EXPECT_TRUE(box->position().equalsWithEpsilon(Vector3(1.f, 2.f, 3.f)));
+
+  auto scalingY = RuntimeAnimation::New(
+    box, CreateAnimation("scaling.y", Animation::ANIMATIONTYPE_FLOAT, 1.f, 3.f), scene.get(),
+    nullptr);
+  scalingY->goToFrame(5.f);
+  EXPECT_TRUE(box->scaling().equalsWithEpsilon(Vector3(1.f, 2.f, 1.f)));
+
+  auto axis     = Vector3::Up();
+  const auto to = Quaternion::RotationAxis(axis, Math::PI_2);
+  auto rotation = RuntimeAnimation::New(
+    box, CreateAnimation("rotationQuaternion", Animation::ANIMATIONTYPE_QUATERNION,
+                         Quaternion::Identity(), to),
+    scene.get(), nullptr);
+  rotation->goToFrame(10.f);
+  ASSERT_TRUE(box->rotationQuaternion().has_value());
+  EXPECT_TRUE(box->rotationQuaternion()->equalsWithEpsilon(to));
+
+  // Resetting restores the original value
+  position->reset(true);
+  EXPECT_TRUE(box->position().equalsWithEpsilon(Vector3::Zero()));
+}
+
+TEST(RuntimeAnimation, ComponentAnimationsMoveMeshesInSceneQueries)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto box    = Mesh::CreateBox("box", 1.f, scene.get());
+  EXPECT_EQ(scene->getMeshesInSphere(Vector3::Zero(), 0.5f), std::vector<AbstractMesh*>{box.get()});
+
+  // Without any render, the meshes tree follows the animated component
+  auto positionX = RuntimeAnimation::New(
+    box, CreateAnimation("position.x", Animation::ANIMATIONTYPE_FLOAT, 0.f, 10.f), scene.get(),
+    nullptr);
+  positionX->goToFrame(10.f);
+  EXPECT_TRUE(scene->getMeshesInSphere(Vector3::Zero(), 0.5f).empty());
+  EXPECT_EQ(scene->getMeshesInSphere(Vector3(10.f, 0.f, 0.f), 0.5f),
+            std::vector<AbstractMesh*>{box.get()});
+}
+
+TEST(RuntimeAnimation, SetsMorphTargetInfluence)
+{
+  using namespace BABYLON;
+
+  auto engine      = createSubject();
+  auto scene       = Scene::New(engine.get());
+  auto morphTarget = MorphTarget::New("target", 0.f, scene.get());
+
+  auto influence = RuntimeAnimation::New(
+    morphTarget, CreateAnimation("influence", Animation::ANIMATIONTYPE_FLOAT, 0.f, 1.f),
+    scene.get(), nullptr);
+  influence->goToFrame(2.5f);
+  EXPECT_FLOAT_EQ(morphTarget->influence(), 0.25f);
+}
@@ -1,9 +1,12 @@
 #include <gtest/gtest.h>
 #include <babylon/asio/asio.h>
+#include <babylon/asio/internal/io_worker_pool.h>
+#include <babylon/asio/internal/sync_callback_runner.h>
 #include <babylon/misc/string_tools.h>
 #include <babylon/core/filesystem.h>
 #include <babylon/babylon_common.h>
 
+#include <atomic>
 #include <thread>
 #include <iostream>
 
@@ -85,6 +88,66 @@ void SampleApplicationLoop()
 //    nb_success_text, nb_success_binary, nb_error, nb_calls_to_progress);
 }
 
+TEST(async_requests, BoundedConcurrency)
+{
+#ifndef _WIN32
+  BABYLON::asio::Service_SetConcurrency(2);
+
+  const int nbRequests = 16;
+  int nb_completed     = 0;
+  auto onSuccess = [&nb_completed](const BABYLON::ArrayBuffer& /*data*/) { ++nb_completed; };
+  auto onError   = [&nb_completed](const std::string& /*message*/) { ++nb_completed; };
+  for (int i = 0; i < nbRequests; ++i) {
+    auto priority
+      = (i % 2 == 0) ? BABYLON::asio::LoadPriority::Low : BABYLON::asio::LoadPriority::High;
+    BABYLON::asio::LoadAssetAsync_Binary(binaryUrl, onSuccess, onError, nullptr, priority);
+  }
+  BABYLON::asio::Service_WaitAll_Sync();
+
+  auto stats = BABYLON::asio::Service_GetStats();
+  EXPECT_EQ(nb_completed, nbRequests);
+  EXPECT_LE(stats.peakWorkerThreads, 2u);
+  EXPECT_EQ(stats.pendingRequests, 0u);
+  EXPECT_FALSE(BABYLON::asio::HasRemainingTasks());
+
+  BABYLON::asio::Service_SetConcurrency(4);
+#endif // _WIN32
+}
+
+TEST(async_requests, BudgetedHeartBeat)
+{
+  using namespace std::chrono_literals;
+
+  const size_t nbCallbacks = 50;
+  size_t nbCalled          = 0;
+  for (size_t i = 0; i < nbCallbacks; ++i) {
+    BABYLON::asio::sync_callback_runner::PushCallback([&nbCalled]() {
+      std::this_thread::sleep_for(1ms);
+      ++nbCalled;
+    });
+  }
+  BABYLON::asio::ResetCallbackQueueStats();
+
+  // A budget smaller than one callback still runs one callback
+  EXPECT_EQ(BABYLON::asio::HeartBeat_Sync(1us), 1u);
+  EXPECT_EQ(nbCalled, 1u);
+
+  const auto nbRun = BABYLON::asio::HeartBeat_Sync(5ms);
+  EXPECT_GE(nbRun, 1u);
+  EXPECT_LT(nbRun, nbCallbacks - 1);
+
+  auto stats = BABYLON::asio::GetCallbackQueueStats();
+  EXPECT_EQ(stats.queueDepth, nbCallbacks - 1 - nbRun);
+  EXPECT_EQ(stats.lastHeartBeatCallbacks, nbRun);
+  EXPECT_EQ(stats.totalCallbacks, 1 + nbRun);
+  EXPECT_GT(stats.maxLatencyMilliseconds, 0.);
+
+  // No budget: drain the queue
+  BABYLON::asio::HeartBeat_Sync();
+  EXPECT_EQ(nbCalled, nbCallbacks);
+  EXPECT_EQ(BABYLON::asio::GetCallbackQueueStats().queueDepth, 0u);
+}
+
 TEST(async_requests, SampleApplicationLoop)
 {
 #ifndef _WIN32
@@ -95,6 +158,67 @@ TEST(async_requests, SampleApplicationLoop)
 #endif // _WIN32
 }
 
+TEST(async_requests, DroppedJobs)
+{
+  using namespace std::chrono_literals;
+
+  BABYLON::asio::sync_io_impl::IoWorkerPool pool(1);
+  std::atomic<bool> started{false};
+  std::atomic<bool> release{false};
+  std::atomic<int> nbRun{0};
+  std::atomic<int> nbDropped{0};
+
+  // The single worker is kept busy, the next jobs stay queued
+  EXPECT_TRUE(pool.submit(
+    [&]() {
+      started = true;
+      while (!release) {
+        std::this_thread::sleep_for(1ms);
+      }
+      ++nbRun;
+    },
+    0));
+  while (!started) {
+    std::this_thread::sleep_for(1ms);
+  }
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_TRUE(pool.submit([&nbRun]() { ++nbRun; }, 0, [&nbDropped]() { ++nbDropped; }));
+  }
+
+  std::thread stopper([&pool]() { pool.stop(); });
+  while (nbDropped < 3) {
+    std::this_thread::sleep_for(1ms);
+  }
+  release = true;
+  stopper.join();
+  EXPECT_EQ(nbRun, 1);
+  EXPECT_EQ(nbDropped, 3);
+
+  // Rejected once stopped, onDropped is left to the caller
+  EXPECT_FALSE(pool.submit([&nbRun]() { ++nbRun; }, 0, [&nbDropped]() { ++nbDropped; }));
+  EXPECT_EQ(nbDropped, 3);
+}
+
+TEST(async_requests, RequestsFailOnceStopped)
+{
+#ifndef _WIN32
+  // The service was stopped by SampleApplicationLoop
+  BABYLON::asio::Service_Stop();
+
+  int nb_success = 0;
+  int nb_error   = 0;
+  auto onSuccess = [&nb_success](const BABYLON::ArrayBuffer& /*data*/) { ++nb_success; };
+  auto onError   = [&nb_error](const std::string& /*message*/) { ++nb_error; };
+  BABYLON::asio::LoadAssetAsync_Binary(binaryUrl, onSuccess, onError, nullptr);
+
+  EXPECT_EQ(BABYLON::asio::Service_GetStats().pendingRequests, 0u);
+  BABYLON::asio::HeartBeat_Sync();
+  EXPECT_EQ(nb_success, 0);
+  EXPECT_EQ(nb_error, 1);
+  EXPECT_FALSE(BABYLON::asio::HasRemainingTasks());
+#endif // _WIN32
+}
+
 TEST(async_requests, LoadText)
 {
 #if 0 // This code works, but features no real google test call
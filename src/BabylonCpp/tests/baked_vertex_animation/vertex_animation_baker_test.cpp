@@ -0,0 +1,290 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "../test_utils.h"
+
+#include <babylon/animations/animation.h>
+#include <babylon/animations/animation_group.h>
+#include <babylon/animations/animation_range.h>
+#include <babylon/animations/ianimation_key.h>
+#include <babylon/animations/runtime_animation.h>
+#include <babylon/animations/targeted_animation.h>
+#include <babylon/baked_vertex_animation/baked_vertex_animation_manager.h>
+#include <babylon/baked_vertex_animation/vertex_animation_baker.h>
+#include <babylon/bones/bone.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/scene.h>
+#include <babylon/lights/directional_light.h>
+#include <babylon/lights/shadows/shadow_generator.h>
+#include <babylon/materials/material_helper.h>
+#include <babylon/materials/textures/raw_texture.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/meshes/instanced_mesh.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/sub_mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+namespace {
+
+/**
+ * @brief Creates a skinned box with a chain of bones, each bone is translated
+ * along x by its frame from frame 0 to frame 10.
+ */
+BABYLON::MeshPtr CreateAnimatedMesh(BABYLON::Scene* scene, size_t nbBones)
+{
+  using namespace BABYLON;
+
+  auto mesh      = Mesh::CreateBox("box", 1.f, scene);
+  mesh->skeleton = Skeleton::New("skeleton", "skeleton", scene);
+  Bone* parent   = nullptr;
+  for (size_t i = 0; i < nbBones; ++i) {
+    auto bone = Bone::New("bone" + std::to_string(i), mesh->skeleton().get(), parent,
+                          Matrix::Translation(0.f, 1.f, 0.f));
+    auto animation = Animation::New("animation", "_matrix", 30, Animation::ANIMATIONTYPE_MATRIX);
+    std::vector<IAnimationKey> keys;
+    for (int frame = 0; frame <= 10; ++frame) {
+      keys.emplace_back(static_cast<float>(frame),
+                        AnimationValue(Matrix::Translation(static_cast<float>(frame), 1.f, 0.f)));
+    }
+    animation->setKeys(keys);
+    bone->animations.emplace_back(animation);
+    parent = bone.get();
+  }
+  return mesh;
+}
+
+/**
+ * @brief Returns the transform matrices of the skeleton of a mesh at a frame,
+ * evaluated on the CPU.
+ */
+BABYLON::Float32Array EvaluateSkeleton(BABYLON::Scene* scene, const BABYLON::MeshPtr& mesh,
+                                       float frame)
+{
+  using namespace BABYLON;
+
+  const auto& skeleton = mesh->skeleton();
+  std::vector<RuntimeAnimationPtr> runtimeAnimations;
+  for (const auto& bone : skeleton->bones) {
+    runtimeAnimations.emplace_back(
+      RuntimeAnimation::New(bone, bone->animations.front(), scene, nullptr));
+    runtimeAnimations.back()->goToFrame(frame);
+  }
+  skeleton->_markAsDirty();
+  skeleton->prepare();
+  auto matrices = skeleton->getTransformMatrices(mesh.get());
+
+  for (const auto& runtimeAnimation : runtimeAnimations) {
+    runtimeAnimation->reset(true);
+    runtimeAnimation->dispose();
+  }
+  skeleton->_markAsDirty();
+  skeleton->prepare();
+  return matrices;
+}
+
+/**
+ * @brief Shadow generator keeping the defines of the last shadow map effect.
+ */
+class DefinesShadowGenerator : public BABYLON::ShadowGenerator {
+public:
+  DefinesShadowGenerator(const BABYLON::IShadowLightPtr& light) : ShadowGenerator(256, light)
+  {
+  }
+
+  bool hasDefine(const std::string& define) const
+  {
+    return std::find(defines.begin(), defines.end(), define) != defines.end();
+  }
+
+  std::vector<std::string> defines;
+
+protected:
+  void _isReadyCustomDefines(std::vector<std::string>& iDefines, BABYLON::SubMesh* /*subMesh*/,
+                             bool /*useInstances*/) override
+  {
+    defines = iDefines;
+  }
+}; // end of class DefinesShadowGenerator
+
+} // end of anonymous namespace
+
+TEST(VertexAnimationBaker, BakesSkeletonFrames)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto mesh   = CreateAnimatedMesh(scene.get(), 3);
+
+  const auto pose = mesh->skeleton()->getTransformMatrices(mesh.get());
+
+  VertexAnimationBaker baker(scene.get(), mesh);
+  const std::vector<AnimationRange> ranges{
+    AnimationRange("first", 0.f, 4.f),
+    AnimationRange("second", 6.f, 10.f),
+  };
+  const auto vertexData = baker.bakeVertexData(ranges);
+
+  // 16 * (bones + 1) floats per frame, both bounds of the ranges are baked
+  const size_t matrixFloats = 16 * 4;
+  ASSERT_EQ(vertexData.size(), matrixFloats * 10);
+
+  // Each baked frame matches the skeleton evaluated on the CPU at that frame
+  const std::vector<float> frames{0.f, 1.f, 2.f, 3.f, 4.f, 6.f, 7.f, 8.f, 9.f, 10.f};
+  for (size_t frameIndex = 0; frameIndex < frames.size(); ++frameIndex) {
+    const auto expected = EvaluateSkeleton(scene.get(), mesh, frames[frameIndex]);
+    ASSERT_EQ(expected.size(), matrixFloats);
+    for (size_t i = 0; i < matrixFloats; ++i) {
+      EXPECT_FLOAT_EQ(vertexData[frameIndex * matrixFloats + i], expected[i]);
+    }
+  }
+
+  // The skeleton is back to its pose once baked
+  const auto& restored = mesh->skeleton()->getTransformMatrices(mesh.get());
+  ASSERT_EQ(restored.size(), pose.size());
+  for (size_t i = 0; i < pose.size(); ++i) {
+    EXPECT_FLOAT_EQ(restored[i], pose[i]);
+  }
+}
+
+TEST(VertexAnimationBaker, BakesAnimationGroup)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto mesh   = CreateAnimatedMesh(scene.get(), 2);
+
+  auto group = AnimationGroup::New("group", scene.get());
+  for (const auto& bone : mesh->skeleton()->bones) {
+    group->addTargetedAnimation(bone->animations.front(), bone);
+  }
+
+  VertexAnimationBaker baker(scene.get(), mesh);
+  const auto fromGroup    = baker.bakeVertexData(*group);
+  const auto fromSkeleton = baker.bakeVertexData({AnimationRange("all", 0.f, 10.f)});
+  ASSERT_EQ(fromGroup.size(), 16 * 3 * 11u);
+  ASSERT_EQ(fromGroup.size(), fromSkeleton.size());
+  for (size_t i = 0; i < fromGroup.size(); ++i) {
+    EXPECT_FLOAT_EQ(fromGroup[i], fromSkeleton[i]);
+  }
+}
+
+TEST(VertexAnimationBaker, TextureAndSerialization)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto mesh   = CreateAnimatedMesh(scene.get(), 3);
+
+  VertexAnimationBaker baker(scene.get(), mesh);
+  const auto vertexData = baker.bakeVertexData({AnimationRange("all", 0.f, 10.f)});
+
+  // One row per frame, four texels per matrix
+  auto texture    = baker.textureFromBakedVertexData(vertexData);
+  const auto size = texture->getSize();
+  EXPECT_EQ(size.width, 16);
+  EXPECT_EQ(size.height, 11);
+
+  const auto loaded
+    = baker.loadBakedVertexDataFromJSON(baker.serializeBakedVertexDataToJSON(vertexData));
+  ASSERT_EQ(loaded.size(), vertexData.size());
+  for (size_t i = 0; i < vertexData.size(); ++i) {
+    EXPECT_EQ(loaded[i], vertexData[i]);
+  }
+}
+
+TEST(VertexAnimationBaker, ShadowMapReadsTheBakedTexture)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto mesh   = CreateAnimatedMesh(scene.get(), 3);
+
+  // Every vertex follows the first bone
+  const auto nbVertices = mesh->getTotalVertices();
+  Float32Array matricesIndices(4 * nbVertices, 0.f);
+  Float32Array matricesWeights(4 * nbVertices, 0.f);
+  for (size_t i = 0; i < nbVertices; ++i) {
+    matricesWeights[4 * i] = 1.f;
+  }
+  mesh->setVerticesData(VertexBuffer::MatricesIndicesKind, matricesIndices);
+  mesh->setVerticesData(VertexBuffer::MatricesWeightsKind, matricesWeights);
+
+  auto light           = DirectionalLight::New("light", Vector3(0.f, -1.f, 0.f), scene.get());
+  auto shadowGenerator = std::make_shared<DefinesShadowGenerator>(light);
+  auto subMesh         = mesh->subMeshes.front().get();
+
+  shadowGenerator->isReady(subMesh, false);
+  EXPECT_FALSE(shadowGenerator->hasDefine("#define BAKED_VERTEX_ANIMATION_TEXTURE"));
+  EXPECT_FALSE(shadowGenerator->hasDefine("#define NUM_BONE_INFLUENCERS 0"));
+
+  // The skeleton of the mesh is no more prepared, the shadow map reads the
+  // bone matrices from the baked texture
+  VertexAnimationBaker baker(scene.get(), mesh);
+  auto manager     = BakedVertexAnimationManager::New(scene.get());
+  manager->texture = baker.textureFromBakedVertexData(
+    baker.bakeVertexData({AnimationRange("all", 0.f, 10.f)}));
+  mesh->bakedVertexAnimationManager = manager;
+  EXPECT_TRUE(MaterialHelper::UseBakedVertexAnimation(mesh.get()));
+  shadowGenerator->isReady(subMesh, false);
+  EXPECT_TRUE(shadowGenerator->hasDefine("#define BAKED_VERTEX_ANIMATION_TEXTURE"));
+  EXPECT_FALSE(shadowGenerator->hasDefine("#define NUM_BONE_INFLUENCERS 0"));
+
+  manager->isEnabled = false;
+  EXPECT_FALSE(MaterialHelper::UseBakedVertexAnimation(mesh.get()));
+  shadowGenerator->isReady(subMesh, false);
+  EXPECT_FALSE(shadowGenerator->hasDefine("#define BAKED_VERTEX_ANIMATION_TEXTURE"));
+}
+
+TEST(VertexAnimationBaker, InstancesDoNotPrepareTheSkeleton)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto camera = FreeCamera::New("camera", Vector3(0.f, 0.f, -20.f), scene.get());
+  camera->setTarget(Vector3::Zero());
+
+  // Crowd made of a source mesh and an instance, only the instance is visible
+  auto mesh              = CreateAnimatedMesh(scene.get(), 3);
+  auto instance          = mesh->createInstance("instance");
+  instance->position().x = 2.f;
+  mesh->isVisible        = false;
+
+  size_t preparations = 0;
+  mesh->skeleton()->onBeforeComputeObservable.add(
+    [&preparations](Skeleton* /*skeleton*/, EventState& /*es*/) { ++preparations; });
+  const auto evaluateActiveMeshes = [&scene, &mesh, &instance]() {
+    mesh->skeleton()->_markAsDirty();
+    scene->freezeActiveMeshes(false);
+    const auto& activeMeshes = scene->getActiveMeshes();
+    const auto active
+      = std::find(activeMeshes.begin(), activeMeshes.end(), instance.get()) != activeMeshes.end();
+    scene->unfreezeActiveMeshes();
+    return active;
+  };
+
+  // Skeleton evaluated on the CPU
+  ASSERT_TRUE(evaluateActiveMeshes());
+  EXPECT_EQ(preparations, 1ull);
+
+  // The instance plays the baked texture of its source mesh
+  VertexAnimationBaker baker(scene.get(), mesh);
+  auto manager     = BakedVertexAnimationManager::New(scene.get());
+  manager->texture = baker.textureFromBakedVertexData(
+    baker.bakeVertexData({AnimationRange("all", 0.f, 10.f)}));
+  mesh->bakedVertexAnimationManager = manager;
+  EXPECT_EQ(instance->bakedVertexAnimationManager(), manager);
+  EXPECT_TRUE(MaterialHelper::UseBakedVertexAnimation(instance.get()));
+
+  preparations = 0;
+  ASSERT_TRUE(evaluateActiveMeshes());
+  EXPECT_EQ(preparations, 0ull);
+}
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "../test_utils.h"
+
+#include <babylon/bones/bone.h>
+#include <babylon/bones/skeleton.h>
+#include <babylon/engines/scene.h>
+#include <babylon/maths/matrix.h>
+
+namespace {
+
+/**
+ * @brief Creates a chain of bones, each one translated and rotated from its
+ * parent, and stores the bones from the leaf to the root.
+ */
+BABYLON::SkeletonPtr CreateReversedChain(BABYLON::Scene* scene, size_t nbBones)
+{
+  using namespace BABYLON;
+
+  auto skeleton = Skeleton::New("skeleton", "skeleton", scene);
+  Bone* parent  = nullptr;
+  for (size_t i = 0; i < nbBones; ++i) {
+    auto rotation          = Matrix::RotationY(0.1f * static_cast<float>(i));
+    const auto localMatrix = rotation.multiply(Matrix::Translation(0.f, 1.f, 0.f));
+    parent = Bone::New("bone" + std::to_string(i), skeleton.get(), parent, localMatrix).get();
+  }
+  std::reverse(skeleton->bones.begin(), skeleton->bones.end());
+  return skeleton;
+}
+
+} // end of anonymous namespace
+
+TEST(TestSkeleton, PrepareComputesParentsFirst)
+{
+  using namespace BABYLON;
+
+  auto subject  = createSubject();
+  auto scene    = Scene::New(subject.get());
+  auto skeleton = CreateReversedChain(scene.get(), 4);
+  skeleton->prepare();
+
+  // Expected world matrices, from the root
+  auto worldMatrix = Matrix::Identity();
+  for (auto it = skeleton->bones.rbegin(); it != skeleton->bones.rend(); ++it) {
+    worldMatrix = (*it)->getLocalMatrix().multiply(worldMatrix);
+    const auto& expected = worldMatrix.m();
+    const auto& actual   = (*it)->getWorldMatrix().m();
+    for (size_t i = 0; i < 16; ++i) {
+      EXPECT_NEAR(actual[i], expected[i], 1e-5f);
+    }
+  }
+}
+
+TEST(TestSkeleton, PrepareSkeletonsMatchesPrepare)
+{
+  using namespace BABYLON;
+
+  auto subject = createSubject();
+  auto scene   = Scene::New(subject.get());
+
+  std::vector<SkeletonPtr> skeletons;
+  for (size_t i = 0; i < 8; ++i) {
+    skeletons.emplace_back(CreateReversedChain(scene.get(), 20));
+  }
+  auto reference = CreateReversedChain(scene.get(), 20);
+  reference->prepare();
+
+  Skeleton::PrepareSkeletons(skeletons);
+
+  const auto& expected = reference->getTransformMatrices(nullptr);
+  for (const auto& skeleton : skeletons) {
+    const auto& actual = skeleton->getTransformMatrices(nullptr);
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      EXPECT_FLOAT_EQ(actual[i], expected[i]);
+    }
+  }
+}
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#include <babylon/core/array_buffer_view.h>
+#include <babylon/core/data_view.h>
+#include <babylon/core/memory_mapped_file.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+TEST(TestArrayBufferView, subarraySharesTheBuffer)
+{
+  using namespace BABYLON;
+
+  const ArrayBufferView data(Float32Array{0.f, 1.f, 2.f, 3.f, 4.f, 5.f});
+  const auto view = data.subarray(2 * sizeof(float), 3 * sizeof(float));
+
+  EXPECT_EQ(view.byteOffset, 2 * sizeof(float));
+  EXPECT_EQ(view.byteLength(), 3 * sizeof(float));
+  EXPECT_EQ(view.data(), data.data() + 2 * sizeof(float));
+  EXPECT_EQ(view.float32Array(), (Float32Array{2.f, 3.f, 4.f}));
+
+  const auto nested = view.subarray(sizeof(float));
+  EXPECT_EQ(nested.float32Array(), (Float32Array{3.f, 4.f}));
+
+  EXPECT_THROW(static_cast<void>(view.subarray(2 * sizeof(float), 2 * sizeof(float))),
+               std::out_of_range);
+  EXPECT_THROW(static_cast<void>(view.subarray(4 * sizeof(float))), std::out_of_range);
+}
+
+TEST(TestArrayBufferView, copyOnWrite)
+{
+  using namespace BABYLON;
+
+  ArrayBufferView data(Uint8Array{1, 2, 3, 4});
+  const ArrayBufferView copy = data;
+  EXPECT_EQ(copy.data(), data.data());
+
+  data.uint8Array()[0] = 42;
+  EXPECT_NE(copy.data(), data.data());
+  EXPECT_EQ(copy.uint8Array()[0], 1);
+  EXPECT_EQ(data.uint8Array()[0], 42);
+}
+
+TEST(TestArrayBufferView, stridedTypedView)
+{
+  using namespace BABYLON;
+
+  // Interleaved position (3 floats) and uv (2 floats) at an unaligned offset
+  const Float32Array interleaved{0.f, 1.f, 2.f, 10.f, 11.f, 3.f, 4.f, 5.f, 12.f, 13.f};
+  Uint8Array bytes(1 + interleaved.size() * sizeof(float));
+  std::memcpy(bytes.data() + 1, interleaved.data(), interleaved.size() * sizeof(float));
+  const ArrayBufferView data(bytes);
+
+  const auto u = data.typedView<float>(1 + 3 * sizeof(float), 2, 5 * sizeof(float));
+  EXPECT_FALSE(u.isPacked());
+  EXPECT_EQ(u.size(), 2u);
+  EXPECT_EQ(u[0], 10.f);
+  EXPECT_EQ(u[1], 12.f);
+  EXPECT_EQ(u.byteLength(), 5 * sizeof(float) + sizeof(float));
+  EXPECT_THROW(static_cast<void>(u.at(2)), std::out_of_range);
+  EXPECT_THROW(
+    static_cast<void>(data.typedView<float>(1 + 3 * sizeof(float), 3, 5 * sizeof(float))),
+    std::out_of_range);
+  EXPECT_EQ(data.typedView<float>(1 + 3 * sizeof(float), std::nullopt, 5 * sizeof(float)).size(),
+            2u);
+
+  const auto positions = data.typedView<float>(1);
+  EXPECT_EQ(positions.size(), interleaved.size());
+  EXPECT_EQ(positions.toArray(), interleaved);
+}
+
+TEST(TestArrayBufferView, vertexBufferForEachReadsInPlace)
+{
+  using namespace BABYLON;
+
+  // Normalized unsigned byte vec2 with a 4 bytes stride
+  const ArrayBufferView data(Uint8Array{255, 0, 9, 9, 0, 255, 9, 9});
+  Float32Array values(4);
+  VertexBuffer::ForEach(data, 0, 4, 2, VertexBuffer::UNSIGNED_BYTE, values.size(), true,
+                        [&values](float value, size_t index) { values[index] = value; });
+  EXPECT_EQ(values, (Float32Array{1.f, 0.f, 0.f, 1.f}));
+
+  EXPECT_THROW(VertexBuffer::ForEach(data, 4, 4, 2, VertexBuffer::UNSIGNED_BYTE, 4, true,
+                                     [](float, size_t) {}),
+               std::out_of_range);
+}
+
+TEST(TestArrayBufferView, memoryMappedFile)
+{
+  using namespace BABYLON;
+
+  const Float32Array values{0.f, 1.f, 2.f, 3.f, 4.f, 5.f};
+  const auto filename
+    = (std::filesystem::temp_directory_path() / "array_buffer_view_test.bin").string();
+  {
+    std::ofstream stream(filename, std::ios::binary);
+    stream.write(reinterpret_cast<const char*>(values.data()),
+                 static_cast<std::streamsize>(values.size() * sizeof(float)));
+  }
+
+  const auto file = MemoryMappedFile::Open(filename);
+  ASSERT_TRUE(file);
+  ArrayBufferView data(file);
+  EXPECT_EQ(data.byteLength(), values.size() * sizeof(float));
+  EXPECT_EQ(data.isMapped(), file->isMapped());
+
+  // Read in place
+  EXPECT_EQ(data.data(), file->data());
+  const auto view = data.subarray(2 * sizeof(float), 3 * sizeof(float));
+  EXPECT_EQ(view.data(), file->data() + 2 * sizeof(float));
+  EXPECT_EQ(view.typedView<float>().toArray(), (Float32Array{2.f, 3.f, 4.f}));
+
+  // Released pages are read again from the file
+  data.releasePages();
+  EXPECT_EQ(view.float32Array(), (Float32Array{2.f, 3.f, 4.f}));
+
+  // Writing copies the content out of the file
+  data.uint8Array()[0] = 42;
+  EXPECT_FALSE(data.isMapped());
+  EXPECT_NE(data.data(), file->data());
+  EXPECT_EQ(data.uint8Array()[0], 42);
+  EXPECT_EQ(view.data(), file->data() + 2 * sizeof(float));
+
+  // Accessing the buffer of a view copies its range only
+  const auto& viewBuffer = view.uint8Array();
+  EXPECT_FALSE(view.isMapped());
+  EXPECT_EQ(viewBuffer.size(), 3 * sizeof(float));
+  EXPECT_EQ(view.byteOffset, 0ull);
+  EXPECT_EQ(view.byteLength(), 3 * sizeof(float));
+  EXPECT_EQ(view.float32Array(), (Float32Array{2.f, 3.f, 4.f}));
+  const ArrayBufferView fileView(file);
+  EXPECT_EQ(fileView.subarray(sizeof(float)).data(), file->data() + sizeof(float));
+
+  std::remove(filename.c_str());
+}
@@ -0,0 +1,70 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <babylon/core/thread_pool.h>
+
+TEST(TestThreadPool, parallelForVisitsEachIndexOnce)
+{
+  using namespace BABYLON;
+
+  ThreadPool pool(3);
+  std::vector<std::atomic<int>> visits(10000);
+  pool.parallelFor(visits.size(), 64, [&visits](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      ++visits[i];
+    }
+  });
+  for (const auto& visit : visits) {
+    EXPECT_EQ(visit.load(), 1);
+  }
+}
+
+TEST(TestThreadPool, nestedParallelFor)
+{
+  using namespace BABYLON;
+
+  ThreadPool pool(2);
+  std::atomic<size_t> sum{0};
+  pool.parallelFor(16, 1, [&pool, &sum](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      pool.parallelFor(100, 10, [&sum](size_t innerBegin, size_t innerEnd) {
+        sum += innerEnd - innerBegin;
+      });
+    }
+  });
+  EXPECT_EQ(sum.load(), 1600u);
+}
+
+TEST(TestThreadPool, parallelForRethrows)
+{
+  using namespace BABYLON;
+
+  ThreadPool pool(2);
+  EXPECT_THROW(pool.parallelFor(100, 1,
+                                [](size_t begin, size_t /*end*/) {
+                                  if (begin == 42) {
+                                    throw std::runtime_error("chunk 42");
+                                  }
+                                }),
+               std::runtime_error);
+}
+
+TEST(TestThreadPool, submit)
+{
+  using namespace BABYLON;
+
+  ThreadPool pool(2);
+  std::atomic<int> counter{0};
+  std::vector<std::future<void>> futures;
+  for (int i = 0; i < 10; ++i) {
+    futures.emplace_back(pool.submit([&counter]() { ++counter; }));
+  }
+  for (auto& future : futures) {
+    future.get();
+  }
+  EXPECT_EQ(counter.load(), 10);
+}
@@ -0,0 +1,669 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <set>
+
+#include "../test_utils.h"
+
+#include <babylon/animations/animatable.h>
+#include <babylon/animations/animation.h>
+#include <babylon/animations/ianimation_key.h>
+#include <babylon/babylon_stl_util.h>
+#include <babylon/cameras/free_camera.h>
+#include <babylon/collisions/picking_info.h>
+#include <babylon/culling/bounding_box.h>
+#include <babylon/culling/bounding_info.h>
+#include <babylon/culling/ray.h>
+#include <babylon/engines/scene.h>
+#include <babylon/lights/hemispheric_light.h>
+#include <babylon/lights/point_light.h>
+#include <babylon/lights/spot_light.h>
+#include <babylon/materials/standard_material.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/transform_node.h>
+
+TEST(TestScene, parallelActiveMeshesEvaluationMatchesSerial)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto camera = FreeCamera::New("camera", Vector3(0.f, 0.f, -50.f), scene.get());
+  camera->setTarget(Vector3::Zero());
+
+  // Grid of boxes, half of them parented to a moving root
+  auto root = Mesh::New("root", scene.get());
+  for (int i = 0; i < 40; ++i) {
+    for (int j = 0; j < 40; ++j) {
+      auto box        = Mesh::CreateBox("box", 1.f, scene.get());
+      box->position() = Vector3(static_cast<float>(i - 20) * 3.f, static_cast<float>(j - 20) * 3.f,
+                                0.f);
+      if ((i + j) % 2 == 0) {
+        box->parent = root.get();
+      }
+    }
+  }
+  root->position().x = 10.f;
+
+  scene->parallelActiveMeshesEvaluation = false;
+  scene->freezeActiveMeshes(false);
+  const auto serialActiveMeshes = scene->getActiveMeshes();
+  scene->unfreezeActiveMeshes();
+
+  scene->parallelActiveMeshesEvaluation          = true;
+  scene->parallelActiveMeshesEvaluationThreshold = 1;
+  scene->freezeActiveMeshes(false);
+  const auto parallelActiveMeshes = scene->getActiveMeshes();
+  scene->unfreezeActiveMeshes();
+
+  EXPECT_EQ(serialActiveMeshes, parallelActiveMeshes);
+}
+
+TEST(TestScene, parallelAnimationEvaluationMatchesSerial)
+{
+  using namespace BABYLON;
+
+  // Shared position, rotation and scaling animations with 30 keys
+  std::vector<IAnimationKey> positionKeys, rotationKeys, scalingKeys;
+  for (int i = 0; i < 30; ++i) {
+    const auto frame = static_cast<float>(i * 4);
+    positionKeys.emplace_back(frame, AnimationValue(Vector3(std::sin(frame), frame, 0.f)));
+    rotationKeys.emplace_back(
+      frame, AnimationValue(Quaternion::RotationYawPitchRoll(frame * 0.1f, 0.f, frame * 0.05f)));
+    scalingKeys.emplace_back(frame, AnimationValue(1.f + std::cos(frame) * 0.5f));
+  }
+  const auto createAnimation = [](const std::string& property, unsigned int dataType,
+                                  unsigned int loopMode, const std::vector<IAnimationKey>& keys) {
+    auto animation = Animation::New(property, property, 30, static_cast<int>(dataType), loopMode);
+    animation->setKeys(keys);
+    return animation;
+  };
+  const std::vector<AnimationPtr> animations{
+    createAnimation("position", Animation::ANIMATIONTYPE_VECTOR3,
+                    Animation::ANIMATIONLOOPMODE_RELATIVE, positionKeys),
+    createAnimation("rotationQuaternion", Animation::ANIMATIONTYPE_QUATERNION,
+                    Animation::ANIMATIONLOOPMODE_CYCLE, rotationKeys),
+    createAnimation("scaling.y", Animation::ANIMATIONTYPE_FLOAT,
+                    Animation::ANIMATIONLOOPMODE_CYCLE, scalingKeys),
+  };
+
+  // Same crowd in two scenes, looping and ending animatables at various speeds
+  auto engine = createSubject();
+  std::array<std::unique_ptr<Scene>, 2> scenes{Scene::New(engine.get()), Scene::New(engine.get())};
+  std::array<std::vector<TransformNodePtr>, 2> nodes;
+  std::array<size_t, 2> loops{0, 0};
+  std::array<size_t, 2> ends{0, 0};
+  for (size_t s = 0; s < 2; ++s) {
+    auto& scene                                = *scenes[s];
+    scene.useConstantAnimationDeltaTime        = true;
+    scene.parallelAnimationEvaluation          = (s == 1);
+    scene.parallelAnimationEvaluationThreshold = 1;
+    for (size_t i = 0; i < 200; ++i) {
+      auto node = TransformNode::New("node" + std::to_string(i), &scene);
+      scene.beginDirectAnimation(
+        node, animations, static_cast<float>(i % 5), 116.f, i % 3 != 0,
+        0.5f + static_cast<float>(i % 7) * 0.25f, [&ends, s]() { ++ends[s]; },
+        [&loops, s]() { ++loops[s]; });
+      nodes[s].emplace_back(node);
+    }
+  }
+
+  for (size_t frame = 0; frame < 300; ++frame) {
+    scenes[0]->animate();
+    scenes[1]->animate();
+    ASSERT_EQ(scenes[1]->_activeAnimatables.size(), scenes[0]->_activeAnimatables.size());
+  }
+
+  for (size_t i = 0; i < nodes[0].size(); ++i) {
+    EXPECT_EQ(nodes[1][i]->position(), nodes[0][i]->position());
+    ASSERT_TRUE(nodes[0][i]->rotationQuaternion().has_value());
+    ASSERT_TRUE(nodes[1][i]->rotationQuaternion().has_value());
+    EXPECT_EQ(*nodes[1][i]->rotationQuaternion(), *nodes[0][i]->rotationQuaternion());
+    EXPECT_EQ(nodes[1][i]->scaling(), nodes[0][i]->scaling());
+  }
+  EXPECT_GT(loops[0], 0ull);
+  EXPECT_EQ(loops[1], loops[0]);
+  EXPECT_EQ(ends[1], ends[0]);
+}
+
+TEST(TestScene, evaluatedAnimatablesFollowCallbacksOfPreviousOnes)
+{
+  using namespace BABYLON;
+
+  auto animation = Animation::New("position", "position", 30,
+                                  static_cast<int>(Animation::ANIMATIONTYPE_VECTOR3),
+                                  Animation::ANIMATIONLOOPMODE_CYCLE);
+  animation->setKeys({IAnimationKey(0.f, AnimationValue(Vector3::Zero())),
+                      IAnimationKey(30.f, AnimationValue(Vector3(30.f, 0.f, 0.f)))});
+
+  // The loop callback of the first animatable pauses, speeds up and restarts
+  // the following ones in the same frame
+  auto engine = createSubject();
+  std::array<std::unique_ptr<Scene>, 2> scenes{Scene::New(engine.get()), Scene::New(engine.get())};
+  std::array<std::vector<TransformNodePtr>, 2> nodes;
+  std::array<std::vector<AnimatablePtr>, 2> animatables;
+  for (size_t s = 0; s < 2; ++s) {
+    auto& scene                         = *scenes[s];
+    scene.useConstantAnimationDeltaTime = true;
+    for (size_t i = 0; i < 3; ++i) {
+      nodes[s].emplace_back(TransformNode::New("node" + std::to_string(i), &scene));
+    }
+    size_t nbLoops = 0;
+    animatables[s].emplace_back(scene.beginDirectAnimation(
+      nodes[s][0], {animation}, 0.f, 30.f, true, 1.f, nullptr, [&animatables, s, nbLoops]() mutable {
+        ++nbLoops;
+        if (nbLoops == 1) {
+          animatables[s][1]->pause();
+          animatables[s][2]->speedRatio = 2.f;
+        }
+        else if (nbLoops == 2) {
+          animatables[s][1]->restart();
+        }
+      }));
+    for (size_t i = 1; i < 3; ++i) {
+      animatables[s].emplace_back(
+        scene.beginDirectAnimation(nodes[s][i], {animation}, 0.f, 30.f, true, 1.f));
+    }
+  }
+
+  // Serial animation in the first scene, evaluation then application in the
+  // animatables order in the second one, as with parallelAnimationEvaluation
+  for (int frame = 1; frame <= 200; ++frame) {
+    scenes[0]->animate();
+    const millisecond_t animationTime{static_cast<uint64_t>(frame * 16)};
+    for (const auto& animatable : animatables[1]) {
+      animatable->_evaluate(animationTime);
+    }
+    for (const auto& animatable : animatables[1]) {
+      animatable->_applyEvaluation();
+    }
+  }
+
+  for (size_t i = 0; i < 3; ++i) {
+    EXPECT_EQ(nodes[1][i]->position(), nodes[0][i]->position()) << "node" << i;
+  }
+  EXPECT_NE(nodes[0][1]->position(), nodes[0][0]->position());
+}
+
+TEST(TestScene, meshesTreeQueriesMatchBruteForce)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  // Grid of boxes
+  std::vector<MeshPtr> boxes;
+  for (int i = 0; i < 20; ++i) {
+    for (int j = 0; j < 20; ++j) {
+      auto box        = Mesh::CreateBox("box", 1.f, scene.get());
+      box->position() = Vector3(static_cast<float>(i - 10) * 2.f, static_cast<float>(j - 10) * 2.f,
+                                0.f);
+      box->computeWorldMatrix(true);
+      boxes.emplace_back(box);
+    }
+  }
+
+  // Rays going through the grid
+  for (int k = 0; k < 50; ++k) {
+    const auto angle = static_cast<float>(k) * 0.37f;
+    const Vector3 origin(std::cos(angle) * 15.f, std::sin(angle) * 15.f, -10.f);
+    const Vector3 target(std::sin(angle * 2.1f) * 10.f, std::cos(angle * 0.7f) * 10.f, 0.f);
+    Ray ray(origin, target.subtract(origin).normalize(), 100.f);
+
+    // The triangles are intersected with the ray in the space of the mesh
+    std::vector<AbstractMesh*> expected;
+    for (const auto& mesh : scene->meshes) {
+      auto invertedWorld = Matrix::Identity();
+      mesh->getWorldMatrix().invertToRef(invertedWorld);
+      auto localRay = Ray::Transform(ray, invertedWorld);
+      if (mesh->intersects(localRay).hit) {
+        expected.emplace_back(mesh.get());
+      }
+    }
+    std::vector<AbstractMesh*> picked;
+    for (const auto& pickingInfo : scene->multiPickWithRay(ray, nullptr)) {
+      if (pickingInfo && pickingInfo->hit) {
+        picked.emplace_back(pickingInfo->pickedMesh.get());
+      }
+    }
+    EXPECT_EQ(picked, expected);
+  }
+
+  // Sphere query
+  const Vector3 center(1.f, -3.f, 0.5f);
+  const auto radius = 4.5f;
+  std::vector<AbstractMesh*> expected;
+  for (const auto& mesh : scene->meshes) {
+    const auto& boundingBox = mesh->getBoundingInfo()->boundingBox;
+    if (BoundingBox::IntersectsSphere(boundingBox.minimumWorld, boundingBox.maximumWorld, center,
+                                      radius)) {
+      expected.emplace_back(mesh.get());
+    }
+  }
+  EXPECT_FALSE(expected.empty());
+  EXPECT_EQ(scene->getMeshesInSphere(center, radius), expected);
+
+  // Moved meshes are picked at their new position
+  Ray ray(Vector3(100.2f, 100.f, -10.f), Vector3(0.f, 0.f, 1.f), 100.f);
+  EXPECT_FALSE(scene->pickWithRay(ray)->hit);
+  boxes[0]->position() = Vector3(100.f, 100.f, 0.f);
+  boxes[0]->computeWorldMatrix(true);
+  auto pickingInfo = scene->pickWithRay(ray);
+  ASSERT_TRUE(pickingInfo->hit);
+  EXPECT_EQ(pickingInfo->pickedMesh.get(), boxes[0].get());
+  EXPECT_EQ(scene->getIntersectingMeshes(*boxes[1]).size(), 0ull);
+  boxes[1]->position() = Vector3(100.5f, 100.f, 0.f);
+  boxes[1]->computeWorldMatrix(true);
+  EXPECT_EQ(scene->getIntersectingMeshes(*boxes[1]), std::vector<AbstractMesh*>{boxes[0].get()});
+
+  // Removed meshes are no more picked
+  scene->removeMesh(boxes[0].get());
+  pickingInfo = scene->pickWithRay(ray);
+  ASSERT_TRUE(pickingInfo->hit);
+  EXPECT_EQ(pickingInfo->pickedMesh.get(), boxes[1].get());
+  scene->removeMesh(boxes[1].get());
+  EXPECT_FALSE(scene->pickWithRay(ray)->hit);
+}
+
+TEST(TestScene, pickWithoutRenderFollowsTransforms)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto box    = Mesh::CreateBox("box", 1.f, scene.get());
+  auto child  = Mesh::CreateBox("child", 1.f, scene.get());
+  child->position().x = 10.f;
+  child->setParent(box.get());
+
+  // Moved through the setter, without any render or world matrix computation
+  box->position = Vector3(5.f, 0.f, 0.f);
+  Ray ray(Vector3(5.f, 0.f, -10.f), Vector3(0.f, 0.f, 1.f), 100.f);
+  auto pickingInfo = scene->pickWithRay(ray);
+  ASSERT_TRUE(pickingInfo->hit);
+  EXPECT_EQ(pickingInfo->pickedMesh.get(), box.get());
+
+  // Moved in place, the child follows its parent and keeps its offset
+  box->position().y = 20.f;
+  EXPECT_FALSE(scene->pickWithRay(ray)->hit);
+  Ray childRay(Vector3(15.f, 20.f, -10.f), Vector3(0.f, 0.f, 1.f), 100.f);
+  pickingInfo = scene->pickWithRay(childRay);
+  ASSERT_TRUE(pickingInfo->hit);
+  EXPECT_EQ(pickingInfo->pickedMesh.get(), child.get());
+  EXPECT_EQ(scene->getMeshesInSphere(Vector3(5.f, 20.f, 0.f), 1.f),
+            std::vector<AbstractMesh*>{box.get()});
+}
+
+TEST(TestScene, pickWithoutRenderFollowsRepeatedHierarchyMoves)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto root   = TransformNode::New("root", scene.get());
+  auto pivot  = TransformNode::New("pivot", scene.get());
+  auto box    = Mesh::CreateBox("box", 1.f, scene.get());
+  pivot->setParent(root.get());
+  box->setParent(pivot.get());
+
+  // Each query applies the queued updates, so the hierarchy is queued again by
+  // the next move
+  for (float x : {5.f, 10.f, 15.f}) {
+    root->position().x = x - 1.f;
+    root->position().x = x;
+    EXPECT_EQ(scene->getMeshesInSphere(Vector3(x, 0.f, 0.f), 0.5f),
+              std::vector<AbstractMesh*>{box.get()})
+      << x;
+    EXPECT_TRUE(scene->getMeshesInSphere(Vector3(x - 5.f, 0.f, 0.f), 0.5f).empty()) << x;
+  }
+}
+
+TEST(TestScene, selectionOctreeFollowsMovingMeshes)
+{
+  using namespace BABYLON;
+
+  // Same grid of boxes in two scenes, the second one using a selection octree
+  auto engine = createSubject();
+  std::array<std::unique_ptr<Scene>, 2> scenes{Scene::New(engine.get()), Scene::New(engine.get())};
+  std::array<std::vector<MeshPtr>, 2> boxes;
+  for (size_t s = 0; s < 2; ++s) {
+    auto camera = FreeCamera::New("camera", Vector3(0.f, 0.f, -50.f), scenes[s].get());
+    camera->setTarget(Vector3::Zero());
+    for (int i = 0; i < 30; ++i) {
+      for (int j = 0; j < 30; ++j) {
+        auto box        = Mesh::CreateBox("box", 1.f, scenes[s].get());
+        box->position() = Vector3(static_cast<float>(i - 15) * 4.f,
+                                  static_cast<float>(j - 15) * 4.f, 0.f);
+        boxes[s].emplace_back(box);
+      }
+    }
+  }
+
+  // Indices of the active boxes
+  const auto activeBoxes = [&scenes, &boxes](size_t s) {
+    scenes[s]->freezeActiveMeshes(false);
+    std::set<AbstractMesh*> activeMeshes(scenes[s]->getActiveMeshes().begin(),
+                                         scenes[s]->getActiveMeshes().end());
+    EXPECT_EQ(activeMeshes.size(), scenes[s]->getActiveMeshes().size());
+    scenes[s]->unfreezeActiveMeshes();
+    std::vector<size_t> result;
+    for (size_t i = 0; i < boxes[s].size(); ++i) {
+      if (activeMeshes.count(boxes[s][i].get())) {
+        result.emplace_back(i);
+      }
+    }
+    return result;
+  };
+
+  auto octree = scenes[1]->createOrUpdateSelectionOctree(8, 4);
+  ASSERT_NE(octree, nullptr);
+  EXPECT_EQ(octree->entryCount(), scenes[1]->meshes.size());
+  EXPECT_FALSE(activeBoxes(0).empty());
+  EXPECT_EQ(activeBoxes(1), activeBoxes(0));
+
+  // Moves some boxes out of the frustum and some others in
+  for (size_t s = 0; s < 2; ++s) {
+    for (size_t i = 0; i < boxes[s].size(); i += 7) {
+      boxes[s][i]->position().x += (i % 2 == 0) ? 300.f : -20.f;
+    }
+  }
+  EXPECT_EQ(activeBoxes(1), activeBoxes(0));
+  EXPECT_EQ(octree->entryCount(), scenes[1]->meshes.size());
+
+  // New meshes are added to the octree, removed meshes are removed from it
+  auto box = Mesh::CreateBox("box", 1.f, scenes[1].get());
+  activeBoxes(1);
+  EXPECT_TRUE(octree->contains(box.get()));
+  EXPECT_EQ(octree->entryCount(), scenes[1]->meshes.size());
+  scenes[1]->removeMesh(box.get());
+  EXPECT_FALSE(octree->contains(box.get()));
+  EXPECT_EQ(octree->entryCount(), scenes[1]->meshes.size());
+}
+
+TEST(TestScene, lookupsFollowRenamesAndRemovals)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  std::vector<MeshPtr> boxes;
+  for (size_t i = 0; i < 10; ++i) {
+    boxes.emplace_back(Mesh::CreateBox("box" + std::to_string(i), 1.f, scene.get()));
+  }
+  auto twin = Mesh::New("box3", scene.get());
+
+  // Lookups by id, unique id and name
+  EXPECT_EQ(scene->getMeshByID("box3"), boxes[3]);
+  EXPECT_EQ(scene->getLastMeshByID("box3"), twin);
+  EXPECT_EQ(scene->getMeshByName("box5"), boxes[5]);
+  EXPECT_EQ(scene->getMeshByUniqueID(boxes[7]->uniqueId), boxes[7]);
+  EXPECT_EQ(scene->getNodeByName("box2"), boxes[2]);
+  EXPECT_EQ(scene->getMeshByID("unknown"), nullptr);
+
+  // Renamed objects are found with their new keys only
+  boxes[4]->id   = "renamed";
+  boxes[4]->name = "renamed";
+  EXPECT_EQ(scene->getMeshByID("renamed"), boxes[4]);
+  EXPECT_EQ(scene->getMeshByName("renamed"), boxes[4]);
+  EXPECT_EQ(scene->getMeshByID("box4"), nullptr);
+  boxes[3]->id = "box4";
+  EXPECT_EQ(scene->getMeshByID("box4"), boxes[3]);
+  EXPECT_EQ(scene->getMeshByID("box3"), twin);
+  boxes[8]->name += "_suffix";
+  EXPECT_EQ(scene->getMeshByName("box8_suffix"), boxes[8]);
+  EXPECT_EQ(scene->getNodeByName("box8"), nullptr);
+
+  // Copies of the keys are detached from the mesh
+  auto copy = boxes[8]->name;
+  copy      = "box8";
+  EXPECT_EQ(scene->getMeshByName("box8"), nullptr);
+
+  // Removals keep the order of the meshes
+  scene->removeMesh(boxes[1]);
+  scene->removeMesh(twin);
+  EXPECT_EQ(scene->getMeshByName("box1"), nullptr);
+  EXPECT_EQ(scene->getMeshByID("box3"), nullptr);
+  ASSERT_EQ(scene->meshes.size(), 9ull);
+  EXPECT_EQ(scene->meshes[0], boxes[0]);
+  EXPECT_EQ(scene->meshes[1], boxes[2]);
+  EXPECT_EQ(scene->meshes.back(), boxes[9]);
+  scene->removeMesh(boxes[9]);
+  scene->addMesh(boxes[9]);
+  EXPECT_EQ(scene->meshes.back(), boxes[9]);
+  EXPECT_EQ(scene->getMeshByName("box9"), boxes[9]);
+  scene->removeMesh(boxes[5]);
+  EXPECT_EQ(scene->getMeshByName("box9"), boxes[9]);
+  EXPECT_EQ(scene->meshes[4], boxes[6]);
+
+  // Transform nodes, lights and materials
+  auto node     = TransformNode::New("node", scene.get());
+  auto light    = PointLight::New("light", Vector3::Zero(), scene.get());
+  auto material = StandardMaterial::New("material", scene.get());
+  auto other    = StandardMaterial::New("other", scene.get());
+  EXPECT_EQ(scene->getTransformNodeByName("node"), node);
+  EXPECT_EQ(scene->getTransformNodeByUniqueID(node->uniqueId), node);
+  EXPECT_EQ(scene->getLightByID("light"), light);
+  EXPECT_EQ(scene->getMaterialByName("material"), material);
+  EXPECT_EQ(scene->getMaterialByUniqueID(other->uniqueId), other);
+  EXPECT_EQ(scene->getLastEntryByID("node"), node);
+  scene->removeTransformNode(node);
+  scene->removeMaterial(material);
+  EXPECT_EQ(scene->getTransformNodeByName("node"), nullptr);
+  EXPECT_EQ(scene->getMaterialByName("material"), nullptr);
+  EXPECT_EQ(scene->getMaterialByName("other"), other);
+  EXPECT_EQ(scene->materials.back(), other);
+  other->name = "renamed";
+  EXPECT_EQ(scene->getMaterialByName("renamed"), other);
+  light->id = "renamedLight";
+  EXPECT_EQ(scene->getNodeByID("renamedLight"), light);
+  EXPECT_EQ(scene->getLightByID("light"), nullptr);
+}
+
+TEST(TestScene, removeMeshesCompactsOnce)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto other  = Scene::New(engine.get());
+
+  // Row of boxes
+  std::vector<AbstractMeshPtr> boxes;
+  for (size_t i = 0; i < 100; ++i) {
+    auto box        = Mesh::CreateBox("box" + std::to_string(i), 1.f, scene.get());
+    box->position() = Vector3(static_cast<float>(i) * 2.f, 0.f, 0.f);
+    boxes.emplace_back(box);
+  }
+
+  // Every other box, and a mesh which is not in the scene
+  std::vector<AbstractMeshPtr> toRemove{Mesh::New("outside", other.get())};
+  for (size_t i = 0; i < boxes.size(); i += 2) {
+    toRemove.emplace_back(boxes[i]);
+  }
+  EXPECT_EQ(scene->removeMeshes(toRemove), 50ull);
+  ASSERT_EQ(scene->meshes.size(), 50ull);
+  for (size_t i = 0; i < scene->meshes.size(); ++i) {
+    EXPECT_EQ(scene->meshes[i], boxes[2 * i + 1]);
+    EXPECT_EQ(scene->meshes[i]->_indexInSceneMeshesArray, static_cast<int>(i));
+  }
+  EXPECT_EQ(scene->getMeshByName("box0"), nullptr);
+  EXPECT_EQ(scene->getMeshByName("box1"), boxes[1]);
+
+  // Removed meshes are no more picked, the remaining ones are
+  EXPECT_EQ(scene->getMeshesInSphere(Vector3(1.f, 0.f, 0.f), 1.f),
+            std::vector<AbstractMesh*>{boxes[1].get()});
+  EXPECT_EQ(scene->removeMeshes(toRemove), 0ull);
+}
+
+TEST(TestScene, removeMeshUnqueuesPendingUpdates)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto light  = PointLight::New("light", Vector3(0.f, 0.f, 0.f), scene.get());
+
+  // Bounded light, the lit meshes are found in the lights tree
+  light->range       = 100.f;
+  light->falloffType = Light::FALLOFF_STANDARD;
+
+  // Row of boxes, all queued for a meshes tree update
+  std::vector<AbstractMeshPtr> boxes;
+  for (size_t i = 0; i < 10; ++i) {
+    auto box        = Mesh::CreateBox("box" + std::to_string(i), 1.f, scene.get());
+    box->position() = Vector3(static_cast<float>(i) * 2.f, 0.f, 0.f);
+    boxes.emplace_back(box);
+  }
+
+  // The first, a middle and the last boxes are released while still queued
+  for (size_t i : {9ull, 4ull, 0ull}) {
+    scene->removeMesh(boxes[i]);
+    boxes[i] = nullptr;
+  }
+  ASSERT_EQ(scene->meshes.size(), 7ull);
+
+  // The remaining boxes are refitted and lit
+  EXPECT_EQ(scene->getMeshesInSphere(Vector3(8.f, 0.f, 0.f), 3.f),
+            (std::vector<AbstractMesh*>{boxes[3].get(), boxes[5].get()}));
+  scene->_updateLightSources();
+  for (const auto& mesh : scene->meshes) {
+    EXPECT_EQ(mesh->lightSources().size(), 1ull);
+  }
+}
+
+TEST(TestScene, lightSourcesFollowLightRangesAndMoves)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto camera = FreeCamera::New("camera", Vector3(0.f, 0.f, -50.f), scene.get());
+  camera->setTarget(Vector3::Zero());
+
+  auto center      = Mesh::CreateBox("center", 1.f, scene.get());
+  auto side        = Mesh::CreateBox("side", 1.f, scene.get());
+  auto far         = Mesh::CreateBox("far", 1.f, scene.get());
+  side->position() = Vector3(10.f, 0.f, 0.f);
+  far->position()  = Vector3(100.f, 0.f, 0.f);
+
+  auto hemi    = HemisphericLight::New("hemi", Vector3(0.f, 1.f, 0.f), scene.get());
+  auto point   = PointLight::New("point", Vector3(2.f, 0.f, 0.f), scene.get());
+  auto spot    = SpotLight::New("spot", Vector3(0.f, 5.f, 0.f), Vector3(0.f, -1.f, 0.f),
+                             Math::PI_4, 2.f, scene.get());
+  point->range       = 5.f;
+  spot->range        = 20.f;
+  point->falloffType = Light::FALLOFF_STANDARD;
+  spot->falloffType  = Light::FALLOFF_GLTF;
+
+  const auto update = [&scene]() {
+    scene->freezeActiveMeshes(false);
+    scene->unfreezeActiveMeshes();
+  };
+  const auto hasLight = [](const MeshPtr& mesh, const LightPtr& light) {
+    return stl_util::contains(mesh->lightSources(), light);
+  };
+  update();
+
+  // Unbounded lights first, then the lights whose range and cone reach the mesh
+  ASSERT_EQ(center->lightSources().size(), 3ull);
+  EXPECT_EQ(center->lightSources().front(), hemi);
+  EXPECT_TRUE(hasLight(center, point));
+  EXPECT_TRUE(hasLight(center, spot));
+  EXPECT_EQ(side->lightSources(), std::vector<LightPtr>{hemi});
+  EXPECT_EQ(far->lightSources(), std::vector<LightPtr>{hemi});
+
+  // Moving lights and meshes
+  point->position  = Vector3(98.f, 0.f, 0.f);
+  side->position() = Vector3(0.f, -3.f, 0.f);
+  update();
+  EXPECT_FALSE(hasLight(center, point));
+  EXPECT_TRUE(hasLight(far, point));
+  EXPECT_TRUE(hasLight(side, spot));
+
+  // Excluded and included only meshes
+  point->setExcludedMeshes({far});
+  EXPECT_FALSE(hasLight(far, point));
+  EXPECT_FALSE(point->canAffectMesh(far.get()));
+  point->setExcludedMeshes({});
+  EXPECT_TRUE(hasLight(far, point));
+  spot->addIncludedOnlyMesh(center);
+  EXPECT_TRUE(hasLight(center, spot));
+  EXPECT_FALSE(hasLight(side, spot));
+
+  // Replacing a mesh keeps the membership sets in sync with the arrays
+  point->addExcludedMesh(far);
+  EXPECT_TRUE(point->removeExcludedMesh(far.get()));
+  EXPECT_FALSE(point->removeExcludedMesh(far.get()));
+  point->addExcludedMesh(center);
+  EXPECT_TRUE(point->canAffectMesh(far.get()));
+  EXPECT_FALSE(point->canAffectMesh(center.get()));
+  EXPECT_TRUE(hasLight(far, point));
+  EXPECT_TRUE(spot->removeIncludedOnlyMesh(center.get()));
+  spot->addIncludedOnlyMesh(side);
+  EXPECT_FALSE(spot->canAffectMesh(center.get()));
+  EXPECT_TRUE(spot->canAffectMesh(side.get()));
+  EXPECT_FALSE(hasLight(center, spot));
+  EXPECT_TRUE(hasLight(side, spot));
+  point->setExcludedMeshes({});
+  spot->setIncludedOnlyMeshes({});
+
+  // Unbounded range
+  point->range = std::numeric_limits<float>::max();
+  update();
+  EXPECT_TRUE(hasLight(center, point));
+  EXPECT_TRUE(hasLight(side, point));
+}
+
+TEST(TestScene, lightSourcesIgnoreRangeOfPhysicalFalloff)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto camera = FreeCamera::New("camera", Vector3(0.f, 0.f, -50.f), scene.get());
+  camera->setTarget(Vector3::Zero());
+
+  auto near       = Mesh::CreateBox("near", 1.f, scene.get());
+  auto far        = Mesh::CreateBox("far", 1.f, scene.get());
+  far->position() = Vector3(100.f, 0.f, 0.f);
+
+  auto point   = PointLight::New("point", Vector3(0.f, 0.f, 0.f), scene.get());
+  auto spot    = SpotLight::New("spot", Vector3(0.f, 0.f, 0.f), Vector3(1.f, 0.f, 0.f),
+                             Math::PI_4, 2.f, scene.get());
+  point->range = 5.f;
+  spot->range  = 5.f;
+
+  const auto update = [&scene]() {
+    scene->freezeActiveMeshes(false);
+    scene->unfreezeActiveMeshes();
+  };
+  const auto hasLight = [](const MeshPtr& mesh, const LightPtr& light) {
+    return stl_util::contains(mesh->lightSources(), light);
+  };
+
+  // The default falloff is the physical one in the PBR materials
+  update();
+  EXPECT_TRUE(hasLight(near, point));
+  EXPECT_TRUE(hasLight(far, point));
+  EXPECT_TRUE(hasLight(far, spot));
+
+  // The standard and gltf falloffs stop at the range
+  point->falloffType = Light::FALLOFF_STANDARD;
+  spot->falloffType  = Light::FALLOFF_GLTF;
+  update();
+  EXPECT_TRUE(hasLight(near, point));
+  EXPECT_FALSE(hasLight(far, point));
+  EXPECT_FALSE(hasLight(far, spot));
+
+  // The physical falloff does not
+  point->falloffType = Light::FALLOFF_PHYSICAL;
+  spot->falloffType  = Light::FALLOFF_PHYSICAL;
+  update();
+  EXPECT_TRUE(hasLight(far, point));
+  EXPECT_TRUE(hasLight(far, spot));
+}
@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <babylon/instrumentation/profiler.h>
+
+TEST(Profiler, RecordsNestedZones)
+{
+  using namespace BABYLON;
+
+  auto& profiler = Profiler::Default();
+  profiler.start();
+  profiler.beginZone("outer");
+  profiler.beginZone("inner");
+  profiler.endZone();
+  profiler.beginZone("inner");
+  profiler.endZone();
+  profiler.endZone();
+  profiler.stop();
+
+  // Zones closed once the capture is stopped are not recorded
+  profiler.beginZone("ignored");
+  profiler.endZone();
+
+  const auto zones = profiler.collect();
+  ASSERT_EQ(zones.size(), 3u);
+  EXPECT_STREQ(zones[0].name, "outer");
+  EXPECT_EQ(zones[0].depth, 0u);
+  for (size_t i = 1; i < zones.size(); ++i) {
+    EXPECT_STREQ(zones[i].name, "inner");
+    EXPECT_EQ(zones[i].depth, 1u);
+    EXPECT_EQ(zones[i].threadId, zones[0].threadId);
+    EXPECT_GE(zones[i].start, zones[0].start);
+    EXPECT_LE(zones[i].start + zones[i].duration, zones[0].start + zones[0].duration);
+  }
+  EXPECT_LE(zones[1].start + zones[1].duration, zones[2].start);
+}
+
+TEST(Profiler, EndsZonesByName)
+{
+  using namespace BABYLON;
+
+  auto& profiler = Profiler::Default();
+  profiler.start();
+
+  // Overlapping counters, as started and ended by the loaders
+  profiler.beginZone(std::string("loading to ready"));
+  profiler.beginZone(std::string("loading to complete"));
+  profiler.endZone(std::string("loading to ready"));
+  profiler.endZone(std::string("unknown"));
+  profiler.endZone(std::string("loading to complete"));
+  profiler.stop();
+
+  const auto zones = profiler.collect();
+  ASSERT_EQ(zones.size(), 2u);
+  EXPECT_STREQ(zones[0].name, "loading to ready");
+  EXPECT_EQ(zones[0].depth, 0u);
+  EXPECT_STREQ(zones[1].name, "loading to complete");
+  EXPECT_EQ(zones[1].depth, 1u);
+}
+
+TEST(Profiler, RecordsZonesOfThreads)
+{
+  using namespace BABYLON;
+
+  constexpr size_t nbThreads = 4;
+  constexpr size_t nbZones   = 1000;
+
+  auto& profiler = Profiler::Default();
+  profiler.start();
+
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < nbThreads; ++i) {
+    threads.emplace_back([&profiler]() {
+      for (size_t j = 0; j < nbZones; ++j) {
+        profiler.beginZone("task");
+        profiler.endZone();
+      }
+    });
+  }
+  // The main thread collects while the threads are recording
+  size_t nbCollected = profiler.collect().size();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  profiler.stop();
+
+  const auto zones = profiler.collect();
+  EXPECT_GE(zones.size(), nbCollected);
+  EXPECT_EQ(zones.size(), nbThreads * nbZones);
+  std::set<uint32_t> threadIds;
+  for (const auto& zone : zones) {
+    threadIds.insert(zone.threadId);
+  }
+  EXPECT_EQ(threadIds.size(), nbThreads);
+  EXPECT_EQ(profiler.droppedZones(), 0u);
+}
+
+TEST(Profiler, ExportsChromeTrace)
+{
+  using namespace BABYLON;
+
+  auto& profiler = Profiler::Default();
+  profiler.start();
+  profiler.setThreadName("Main thread");
+  profiler.beginZone("frame");
+  profiler.beginZone(std::string("Rendering camera \"main\""));
+  profiler.endZone(std::string("Rendering camera \"main\""));
+  profiler.endZone();
+  profiler.stop();
+
+  const auto trace = nlohmann::json::parse(profiler.toChromeTrace());
+  ASSERT_TRUE(trace.find("traceEvents") != trace.end());
+
+  std::vector<nlohmann::json> completeEvents;
+  bool hasThreadName = false;
+  for (const auto& event : trace["traceEvents"]) {
+    if (event["ph"] == "X") {
+      completeEvents.emplace_back(event);
+    }
+    else if (event["ph"] == "M" && event["args"]["name"] == "Main thread") {
+      hasThreadName = true;
+    }
+  }
+  EXPECT_TRUE(hasThreadName);
+  ASSERT_EQ(completeEvents.size(), 2u);
+  EXPECT_EQ(completeEvents[0]["name"], "frame");
+  EXPECT_EQ(completeEvents[1]["name"], "Rendering camera \"main\"");
+  EXPECT_GE(completeEvents[1]["ts"].get<double>(), completeEvents[0]["ts"].get<double>());
+  EXPECT_LE(completeEvents[1]["dur"].get<double>(), completeEvents[0]["dur"].get<double>());
+}
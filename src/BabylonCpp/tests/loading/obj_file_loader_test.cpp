@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/engines/scene.h>
+#include <babylon/loading/plugins/obj/obj_file_loader.h>
+#include <babylon/meshes/mesh.h>
+
+namespace {
+
+const char* const quadsObj = R"(# two quads
+mtllib quads.mtl
+v 0.0 0.0 0.0
+v 1.0 0.0 0.0
+v 1.0 1.0 0.0
+v 0.0 1.0 0.0
+vt 0.0 0.0
+vt 1.0 0.0
+vt 1.0 1.0
+vt 0.0 1.0
+vn 0.0 0.0 1.0
+o first
+usemtl red
+f 1/1/1 2/2/1 3/3/1 4/4/1
+g second
+f -4//-1 -3//-1 -2//-1
+f 1 3 4
+)";
+
+} // end of anonymous namespace
+
+TEST(TestOBJFileLoader, importMesh)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  MeshLoadOptions options{};
+  options.OptimizeWithUV = true;
+  options.UVScaling      = Vector2(1.f, 1.f);
+  OBJFileLoader loader(options);
+
+  const auto meshes = loader.importMesh({}, scene.get(), quadsObj);
+  ASSERT_EQ(meshes.size(), 2u);
+
+  // The quad is split in 2 triangles sharing 2 vertices
+  auto first = std::static_pointer_cast<Mesh>(meshes[0]);
+  EXPECT_EQ(first->name, "first");
+  EXPECT_EQ(first->getTotalVertices(), 4u);
+  EXPECT_EQ(first->getTotalIndices(), 6u);
+
+  // Vertices with and without normals are different vertices
+  auto second = std::static_pointer_cast<Mesh>(meshes[1]);
+  EXPECT_EQ(second->name, "second");
+  EXPECT_EQ(second->getTotalVertices(), 6u);
+  EXPECT_EQ(second->getTotalIndices(), 6u);
+
+  // Only the requested meshes are imported
+  const auto secondOnly = loader.importMesh({"second"}, scene.get(), quadsObj);
+  ASSERT_EQ(secondOnly.size(), 1u);
+  EXPECT_EQ(secondOnly[0]->name, "second");
+}
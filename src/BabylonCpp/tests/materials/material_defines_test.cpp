@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include <babylon/materials/material_defines.h>
+#include <babylon/materials/standard_material_defines.h>
+
+/**
+ * @brief Test Suite for MaterialDefines.
+ */
+
+/**
+ * @brief bool defines behave like the map they replace
+ */
+TEST(TestMaterialDefines, BoolDefines)
+{
+  using namespace BABYLON;
+
+  MaterialDefines defines;
+  defines.boolDef = {{"DIFFUSE", false}, {"BUMP", true}};
+
+  EXPECT_EQ(defines.boolDef.size(), 2u);
+  EXPECT_TRUE(defines.boolDef.contains("DIFFUSE"));
+  EXPECT_FALSE(defines["DIFFUSE"]);
+  EXPECT_TRUE(defines["BUMP"]);
+  EXPECT_FALSE(defines["UNDECLARED_DEFINE"]);
+  EXPECT_FALSE(defines.boolDef.contains("UNDECLARED_DEFINE"));
+
+  defines.boolDef["DIFFUSE"] = defines.boolDef["BUMP"];
+  EXPECT_TRUE(defines["DIFFUSE"]);
+  EXPECT_TRUE(defines[MaterialDefineTable<bool>::Index("DIFFUSE")]);
+
+  EXPECT_EQ(defines.boolDef.erase("BUMP"), 1u);
+  EXPECT_FALSE(defines.boolDef.contains("BUMP"));
+  EXPECT_FALSE(defines["BUMP"]);
+  EXPECT_EQ(defines.toString(), "#define DIFFUSE\n");
+}
+
+/**
+ * @brief defines compare equal regardless of the declaration order
+ */
+TEST(TestMaterialDefines, IsEqual)
+{
+  using namespace BABYLON;
+
+  MaterialDefines lhs, rhs;
+  lhs.boolDef                   = {{"DIFFUSE", true}, {"BUMP", false}};
+  rhs.boolDef                   = {{"BUMP", false}, {"DIFFUSE", true}};
+  lhs.intDef["DIFFUSEDIRECTUV"] = 1;
+  rhs.intDef["DIFFUSEDIRECTUV"] = 1;
+  EXPECT_TRUE(lhs.isEqual(rhs));
+
+  rhs.intDef["DIFFUSEDIRECTUV"] = 2;
+  EXPECT_FALSE(lhs.isEqual(rhs));
+
+  rhs.intDef["DIFFUSEDIRECTUV"] = 1;
+  rhs.boolDef["SPECULAR"]       = false;
+  EXPECT_FALSE(lhs.isEqual(rhs));
+
+  rhs.boolDef.erase("SPECULAR");
+  EXPECT_TRUE(lhs.isEqual(rhs));
+
+  StandardMaterialDefines standardDefines;
+  MaterialDefines copy;
+  standardDefines.cloneTo(copy);
+  EXPECT_TRUE(copy.isEqual(standardDefines));
+}
+
+/**
+ * @brief the defines string is rebuilt when a define changes
+ */
+TEST(TestMaterialDefines, ToStringCache)
+{
+  using namespace BABYLON;
+
+  MaterialDefines defines;
+  defines.boolDef                        = {{"DIFFUSE", true}};
+  defines.intDef["NUM_BONE_INFLUENCERS"] = 4;
+  const auto first                       = defines.toString();
+  EXPECT_EQ(first, "#define DIFFUSE\n#define NUM_BONE_INFLUENCERS 4\n");
+  EXPECT_EQ(defines.toString(), first);
+
+  defines.intDef["NUM_BONE_INFLUENCERS"] = 2;
+  EXPECT_EQ(defines.toString(), "#define DIFFUSE\n#define NUM_BONE_INFLUENCERS 2\n");
+
+  defines.boolDef["DIFFUSE"] = false;
+  EXPECT_EQ(defines.toString(), "#define NUM_BONE_INFLUENCERS 2\n");
+}
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "../test_utils.h"
+
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/csg/csg.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+namespace {
+
+/**
+ * @brief Returns the volume enclosed by a closed mesh.
+ */
+float ComputeVolume(const BABYLON::MeshPtr& mesh)
+{
+  using namespace BABYLON;
+
+  const auto positions = mesh->getVerticesData(VertexBuffer::PositionKind);
+  const auto indices   = mesh->getIndices();
+  auto volume          = 0.f;
+  for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+    const auto p0 = Vector3::FromArray(positions, indices[i] * 3);
+    const auto p1 = Vector3::FromArray(positions, indices[i + 1] * 3);
+    const auto p2 = Vector3::FromArray(positions, indices[i + 2] * 3);
+    volume += Vector3::Dot(p0, Vector3::Cross(p1, p2)) / 6.f;
+  }
+  return std::abs(volume);
+}
+
+} // end of anonymous namespace
+
+TEST(TestCSG, BooleanOperationsOfBoxes)
+{
+  using namespace BABYLON;
+
+  auto subject = createSubject();
+  auto scene   = Scene::New(subject.get());
+
+  auto boxA = Mesh::CreateBox("boxA", 2.f, scene.get());
+  auto boxB = Mesh::CreateBox("boxB", 2.f, scene.get());
+  // Corner overlap
+  boxB->position().set(1.f, 1.f, 1.f);
+  auto csgA = CSG::CSG::FromMesh(boxA);
+  auto csgB = CSG::CSG::FromMesh(boxB);
+  EXPECT_NEAR(ComputeVolume(csgA->_union(csgB).buildMeshGeometry("union", scene.get())), 15.f,
+              1e-3f);
+  EXPECT_NEAR(ComputeVolume(csgA->subtract(csgB).buildMeshGeometry("subtract", scene.get())),
+              7.f, 1e-3f);
+  EXPECT_NEAR(ComputeVolume(csgA->intersect(csgB).buildMeshGeometry("intersect", scene.get())),
+              1.f, 1e-3f);
+
+  // Coplanar faces
+  boxB->position().set(1.f, 0.f, 0.f);
+  csgB = CSG::CSG::FromMesh(boxB);
+  EXPECT_NEAR(ComputeVolume(csgA->_union(csgB).buildMeshGeometry("union", scene.get())), 12.f,
+              1e-3f);
+  EXPECT_NEAR(ComputeVolume(csgA->subtract(csgB).buildMeshGeometry("subtract", scene.get())),
+              4.f, 1e-3f);
+  EXPECT_NEAR(ComputeVolume(csgA->intersect(csgB).buildMeshGeometry("intersect", scene.get())),
+              4.f, 1e-3f);
+
+  // Disjoint solids are kept unchanged
+  boxB->position().set(5.f, 0.f, 0.f);
+  csgB = CSG::CSG::FromMesh(boxB);
+  EXPECT_NEAR(ComputeVolume(csgA->_union(csgB).buildMeshGeometry("union", scene.get())), 16.f,
+              1e-3f);
+  EXPECT_NEAR(ComputeVolume(csgA->subtract(csgB).buildMeshGeometry("subtract", scene.get())),
+              8.f, 1e-3f);
+}
+
+TEST(TestCSG, MatchesBSPTreeImplementation)
+{
+  using namespace BABYLON;
+
+  auto subject = createSubject();
+  auto scene   = Scene::New(subject.get());
+
+  auto box    = Mesh::CreateBox("box", 2.f, scene.get());
+  auto sphere = Mesh::CreateSphere("sphere", 12, 2.6f, scene.get());
+  auto csgA   = CSG::CSG::FromMesh(box);
+  auto csgB   = CSG::CSG::FromMesh(sphere);
+
+  const auto subtract  = ComputeVolume(csgA->subtract(csgB).buildMeshGeometry("s", scene.get()));
+  const auto intersect = ComputeVolume(csgA->intersect(csgB).buildMeshGeometry("i", scene.get()));
+  EXPECT_NEAR(subtract + intersect, 8.f, 1e-3f);
+
+  CSG::CSG::UseBSPTree = true;
+  EXPECT_NEAR(ComputeVolume(csgA->subtract(csgB).buildMeshGeometry("s", scene.get())), subtract,
+              1e-3f);
+  CSG::CSG::UseBSPTree = false;
+}
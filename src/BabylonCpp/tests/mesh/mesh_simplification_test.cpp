@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+#include "../test_utils.h"
+
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_lod_level.h>
+#include <babylon/meshes/simplification/quadratic_error_simplification.h>
+#include <babylon/meshes/simplification/simplification_queue.h>
+#include <babylon/meshes/simplification/simplification_settings.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+TEST(TestMeshSimplification, DecimateKeepsAttributesAndSubMeshes)
+{
+  using namespace BABYLON;
+
+  auto subject = createSubject();
+  auto scene   = Scene::New(subject.get());
+  auto sphere  = Mesh::CreateSphere("sphere", 32, 1.f, scene.get());
+
+  QuadraticErrorSimplification simplifier(sphere);
+  const auto geometry = simplifier.decimate(0.25f);
+
+  EXPECT_EQ(geometry.originalTrianglesCount, sphere->getTotalIndices() / 3);
+  EXPECT_GT(geometry.trianglesCount, 0ull);
+  EXPECT_LE(geometry.trianglesCount, geometry.originalTrianglesCount / 4 + 1);
+
+  // Every vertex kind of the source mesh is kept, with the same vertex count
+  const auto verticesCount = geometry.vertexData.at(VertexBuffer::PositionKind).size() / 3;
+  for (const auto& kind : sphere->getVerticesDataKinds()) {
+    ASSERT_EQ(geometry.vertexData.count(kind), 1ull);
+    const auto stride = sphere->getVerticesData(kind).size() / sphere->getTotalVertices();
+    EXPECT_EQ(geometry.vertexData.at(kind).size(), verticesCount * stride);
+  }
+  for (auto index : geometry.indices) {
+    EXPECT_LT(index, verticesCount);
+  }
+  ASSERT_EQ(geometry.subMeshes.size(), sphere->subMeshes.size());
+  EXPECT_EQ(geometry.subMeshes[0][2], geometry.indices.size());
+
+  // The decimated surface stays close to the sphere
+  const auto& positions = geometry.vertexData.at(VertexBuffer::PositionKind);
+  for (size_t i = 0; i < positions.size(); i += 3) {
+    const auto radius = Vector3::FromArray(positions, static_cast<unsigned int>(i)).length();
+    EXPECT_NEAR(radius, 0.5f, 0.05f);
+  }
+}
+
+TEST(TestMeshSimplification, SimplifyAddsLODLevels)
+{
+  using namespace BABYLON;
+
+  auto subject = createSubject();
+  auto scene   = Scene::New(subject.get());
+  auto sphere  = Mesh::CreateSphere("sphere", 32, 1.f, scene.get());
+
+  auto done = false;
+  sphere->simplify({SimplificationSettings(0.5f, 10.f, false),
+                    SimplificationSettings(0.1f, 20.f, false)},
+                   true, SimplificationType::QUADRATIC, [&done]() { done = true; });
+
+  // The scene component polls the queue before each frame
+  auto& queue = scene->simplificationQueue();
+  for (size_t i = 0; i < 1000 && !done; ++i) {
+    queue->update();
+    if (!queue->running) {
+      queue->executeNext();
+    }
+    if (!done) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+  }
+
+  ASSERT_TRUE(done);
+  EXPECT_FALSE(queue->running);
+  const auto& levels = sphere->getLODLevels();
+  ASSERT_EQ(levels.size(), 2ull);
+  const auto sphereTriangles = sphere->getTotalIndices() / 3;
+  for (const auto& level : levels) {
+    ASSERT_TRUE(level->mesh);
+    EXPECT_TRUE(level->mesh->isVisible);
+    EXPECT_LT(level->mesh->getTotalIndices() / 3, sphereTriangles);
+    EXPECT_EQ(level->mesh->material(), sphere->material());
+  }
+}
@@ -3,7 +3,10 @@
 
 #include "../test_utils.h"
 
+#include <babylon/culling/bounding_box.h>
+#include <babylon/culling/bounding_info.h>
 #include <babylon/engines/scene.h>
+#include <babylon/maths/matrix.h>
 #include <babylon/meshes/builders/mesh_builder_options.h>
 #include <babylon/meshes/mesh.h>
 #include <babylon/meshes/mesh_builder.h>
@@ -23,3 +26,64 @@ TEST(Mesh, clone)
     EXPECT_NE(sphere->uniqueId, sphereClone->uniqueId);
   }
 }
+
+TEST(Mesh, thinInstances)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  BoxOptions boxOptions;
+  boxOptions.size = 2.f;
+  auto box        = MeshBuilder::CreateBox("box", boxOptions, scene.get());
+  EXPECT_FALSE(box->hasThinInstances());
+
+  // Two instances along the x axis, the second one scaled by 2
+  Float32Array matrices(2 * 16);
+  Matrix::Translation(-10.f, 0.f, 0.f).copyToArray(matrices, 0);
+  Matrix::Scaling(2.f, 2.f, 2.f).multiply(Matrix::Translation(5.f, 0.f, 0.f))
+    .copyToArray(matrices, 16);
+  box->thinInstanceSetBuffer("matrix", matrices);
+  EXPECT_TRUE(box->hasThinInstances());
+  EXPECT_EQ(box->thinInstanceCount(), 2ull);
+
+  auto& boundingBox = box->getBoundingInfo()->boundingBox;
+  EXPECT_TRUE(boundingBox.minimum.equalsWithEpsilon(Vector3(-11.f, -2.f, -2.f)));
+  EXPECT_TRUE(boundingBox.maximum.equalsWithEpsilon(Vector3(7.f, 2.f, 2.f)));
+
+  // Partial updates only extend the bounding box
+  Float32Array matrix(16);
+  Matrix::Translation(0.f, 20.f, 0.f).copyToArray(matrix, 0);
+  box->thinInstancePartialBufferUpdate("matrix", matrix, 16);
+  EXPECT_FLOAT_EQ((*box->thinInstanceGetBuffer("matrix"))[16 + 13], 20.f);
+  EXPECT_TRUE(boundingBox.minimum.equalsWithEpsilon(Vector3(-11.f, -2.f, -2.f)));
+  EXPECT_TRUE(boundingBox.maximum.equalsWithEpsilon(Vector3(7.f, 21.f, 2.f)));
+  box->thinInstanceRefreshBoundingInfo();
+  EXPECT_TRUE(boundingBox.minimum.equalsWithEpsilon(Vector3(-11.f, -1.f, -1.f)));
+  EXPECT_TRUE(boundingBox.maximum.equalsWithEpsilon(Vector3(1.f, 21.f, 1.f)));
+
+  // Adding instances grows the buffers, custom attributes included
+  box->thinInstanceRegisterAttribute("color", 4);
+  for (unsigned int i = 0; i < 10; ++i) {
+    const auto index = box->thinInstanceAdd(Matrix::Translation(0.f, 0.f, static_cast<float>(i)),
+                                            i == 9);
+    EXPECT_EQ(index, 2ull + i);
+    EXPECT_TRUE(box->thinInstanceSetAttributeAt("color", index, {1.f, 0.f, 0.f, 1.f}, i == 9));
+  }
+  EXPECT_EQ(box->thinInstanceCount(), 12ull);
+  EXPECT_GE(box->thinInstanceGetBuffer("matrix")->size(), 12ull * 16);
+  EXPECT_GE(box->thinInstanceGetBuffer("color")->size(), 12ull * 4);
+  EXPECT_TRUE(boundingBox.maximum.equalsWithEpsilon(Vector3(1.f, 21.f, 10.f)));
+  EXPECT_FALSE(box->thinInstanceSetMatrixAt(12, Matrix::Identity()));
+
+  box->thinInstanceCount = 1;
+  EXPECT_EQ(box->thinInstanceCount(), 1ull);
+  box->thinInstanceCount = 1000;
+  EXPECT_EQ(box->thinInstanceCount(), 1ull);
+
+  // Removing the matrix buffer restores the bounding box of the mesh
+  box->thinInstanceSetBuffer("matrix", {});
+  EXPECT_FALSE(box->hasThinInstances());
+  EXPECT_TRUE(boundingBox.minimum.equalsWithEpsilon(Vector3(-1.f, -1.f, -1.f)));
+  EXPECT_TRUE(boundingBox.maximum.equalsWithEpsilon(Vector3(1.f, 1.f, 1.f)));
+}
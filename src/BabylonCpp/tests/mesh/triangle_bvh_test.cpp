@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/collisions/intersection_info.h>
+#include <babylon/culling/ray.h>
+#include <babylon/culling/triangle_bvh.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/geometry.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/sub_mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+namespace {
+
+/**
+ * @brief Returns rays cast from a ring around the origin, towards points
+ * scattered around the origin.
+ */
+std::vector<BABYLON::Ray> CreateRays(size_t count)
+{
+  using namespace BABYLON;
+
+  std::vector<Ray> rays;
+  for (size_t i = 0; i < count; ++i) {
+    const auto angle = static_cast<float>(i) * 0.37f;
+    const Vector3 origin(std::cos(angle) * 3.f, std::sin(angle * 1.3f) * 2.f,
+                         std::sin(angle) * 3.f);
+    const Vector3 target(std::sin(angle * 2.1f) * 0.4f, std::cos(angle * 0.7f) * 0.4f, 0.f);
+    rays.emplace_back(origin, target.subtract(origin).normalize(), 100.f);
+  }
+  return rays;
+}
+
+/**
+ * @brief Reference implementation testing all the triangles in index order.
+ */
+std::optional<BABYLON::IntersectionInfo>
+BruteForceIntersects(BABYLON::Ray& ray, const std::vector<BABYLON::Vector3>& positions,
+                     const BABYLON::IndicesArray& indices,
+                     const BABYLON::TriangleBVH::TrianglePickingPredicate& predicate = nullptr)
+{
+  std::optional<BABYLON::IntersectionInfo> intersectInfo = std::nullopt;
+  for (size_t index = 0; index + 2 < indices.size(); index += 3) {
+    const auto& p0 = positions[indices[index]];
+    const auto& p1 = positions[indices[index + 1]];
+    const auto& p2 = positions[indices[index + 2]];
+    if (predicate && !predicate(p0, p1, p2, ray)) {
+      continue;
+    }
+    auto currentIntersectInfo = ray.intersectsTriangle(p0, p1, p2);
+    if (currentIntersectInfo && currentIntersectInfo->distance >= 0.f
+        && (!intersectInfo || currentIntersectInfo->distance < intersectInfo->distance)) {
+      intersectInfo         = currentIntersectInfo;
+      intersectInfo->faceId = index / 3;
+    }
+  }
+  return intersectInfo;
+}
+
+} // end of anonymous namespace
+
+TEST(TestTriangleBVH, ClosestHitMatchesBruteForce)
+{
+  using namespace BABYLON;
+
+  auto subject = createSubject();
+  auto scene   = Scene::New(subject.get());
+  auto sphere  = Mesh::CreateSphere("sphere", 16, 1.f, scene.get());
+  ASSERT_TRUE(sphere->_generatePointsArray());
+
+  const auto& positions = sphere->_positions();
+  const auto indices    = sphere->getIndices();
+  const auto& subMesh   = sphere->subMeshes[0];
+
+  TriangleBVH bvh(positions, indices, subMesh->indexStart, subMesh->indexCount);
+  EXPECT_EQ(bvh.triangleCount(), subMesh->indexCount / 3);
+  EXPECT_GT(bvh.nodeCount(), 1ull);
+
+  size_t nbHits = 0;
+  for (auto& ray : CreateRays(200)) {
+    const auto expected = BruteForceIntersects(ray, positions, indices);
+    const auto result   = bvh.intersects(ray, positions, indices, false, nullptr);
+    ASSERT_EQ(result.has_value(), expected.has_value());
+    if (expected) {
+      ++nbHits;
+      EXPECT_FLOAT_EQ(result->distance, expected->distance);
+      EXPECT_EQ(result->faceId, expected->faceId);
+    }
+  }
+  EXPECT_GT(nbHits, 0ull);
+
+  // Rays pointing away from the sphere
+  Ray ray(Vector3(0.f, 0.f, -3.f), Vector3(0.f, 0.f, -1.f), 100.f);
+  EXPECT_FALSE(bvh.intersects(ray, positions, indices, false, nullptr).has_value());
+
+  // Ray shorter than the distance to the sphere
+  Ray shortRay(Vector3(0.f, 0.f, -3.f), Vector3(0.f, 0.f, 1.f), 1.f);
+  EXPECT_FALSE(bvh.intersects(shortRay, positions, indices, false, nullptr).has_value());
+}
+
+TEST(TestTriangleBVH, PredicateAndFastCheck)
+{
+  using namespace BABYLON;
+
+  auto subject = createSubject();
+  auto scene   = Scene::New(subject.get());
+  auto sphere  = Mesh::CreateSphere("sphere", 16, 1.f, scene.get());
+  ASSERT_TRUE(sphere->_generatePointsArray());
+
+  const auto& positions = sphere->_positions();
+  const auto indices    = sphere->getIndices();
+  const auto& subMesh   = sphere->subMeshes[0];
+  TriangleBVH bvh(positions, indices, subMesh->indexStart, subMesh->indexCount);
+
+  // Only keeps the triangles of the far side of the sphere
+  const auto predicate = [](const Vector3& p0, const Vector3& p1, const Vector3& p2,
+                            const Ray& /*ray*/) { return p0.z + p1.z + p2.z > 0.f; };
+
+  Ray ray(Vector3(0.1f, 0.05f, -3.f), Vector3(0.f, 0.f, 1.f), 100.f);
+  const auto nearest  = bvh.intersects(ray, positions, indices, false, nullptr);
+  const auto far      = bvh.intersects(ray, positions, indices, false, predicate);
+  const auto expected = BruteForceIntersects(ray, positions, indices, predicate);
+  ASSERT_TRUE(nearest.has_value());
+  ASSERT_TRUE(far.has_value());
+  ASSERT_TRUE(expected.has_value());
+  EXPECT_LT(nearest->distance, 3.f);
+  EXPECT_GT(far->distance, 3.f);
+  EXPECT_FLOAT_EQ(far->distance, expected->distance);
+  EXPECT_EQ(far->faceId, expected->faceId);
+
+  // Any hit can be returned with fastCheck
+  const auto any = bvh.intersects(ray, positions, indices, true, nullptr);
+  ASSERT_TRUE(any.has_value());
+  EXPECT_GE(any->distance, nearest->distance);
+}
+
+TEST(TestTriangleBVH, GeometryCache)
+{
+  using namespace BABYLON;
+
+  auto subject  = createSubject();
+  auto scene    = Scene::New(subject.get());
+  auto sphere   = Mesh::CreateSphere("sphere", 16, 1.f, scene.get(), true);
+  auto geometry = sphere->geometry();
+  ASSERT_NE(geometry, nullptr);
+
+  const auto indexCount = geometry->_indices.size();
+  auto bvh              = geometry->_getTriangleBVH(0, indexCount);
+  ASSERT_NE(bvh, nullptr);
+  EXPECT_EQ(geometry->_getTriangleBVH(0, indexCount), bvh);
+  EXPECT_EQ(geometry->_triangleBVHs.size(), 1ull);
+
+  // Updating the positions invalidates the cache
+  auto positions = geometry->getVerticesData(VertexBuffer::PositionKind);
+  for (auto& value : positions) {
+    value *= 2.f;
+  }
+  sphere->updateVerticesData(VertexBuffer::PositionKind, positions, true);
+  EXPECT_TRUE(geometry->_triangleBVHs.empty());
+
+  // Closest hit, any hit is returned by default
+  Ray ray(Vector3(0.f, 0.f, -3.f), Vector3(0.f, 0.f, 1.f), 100.f);
+  const auto result = sphere->intersects(ray, false);
+  ASSERT_TRUE(result.hit);
+  EXPECT_NEAR(result.distance, 2.f, 0.05f);
+  EXPECT_EQ(geometry->_triangleBVHs.size(), 1ull);
+
+  // Updating the indices invalidates the cache
+  geometry->setIndices(geometry->_indices);
+  EXPECT_TRUE(geometry->_triangleBVHs.empty());
+}
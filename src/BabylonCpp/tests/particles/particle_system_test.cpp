@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/engines/scene.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/particles/particle.h>
+#include <babylon/particles/particle_store.h>
+#include <babylon/particles/particle_system.h>
+
+TEST(TestParticleStore, AddAndSwapRemove)
+{
+  using namespace BABYLON;
+
+  ParticleStore store;
+  EXPECT_TRUE(store.empty());
+
+  for (unsigned int i = 0; i < 4; ++i) {
+    const auto index = store.add(i);
+    EXPECT_EQ(index, i);
+    store.positionX[index] = static_cast<float>(i);
+  }
+  EXPECT_EQ(store.size(), 4ull);
+  EXPECT_FLOAT_EQ(store.lifeTime[0], 1.f);
+  EXPECT_FLOAT_EQ(store.scaleX[0], 1.f);
+  EXPECT_FLOAT_EQ(store.age[0], 0.f);
+
+  // The last particle is moved in the slot of the removed one
+  const auto lastId = store.states[3].id;
+  store.swapRemove(1);
+  EXPECT_EQ(store.size(), 3ull);
+  EXPECT_FLOAT_EQ(store.positionX[1], 3.f);
+  EXPECT_EQ(store.cellIndex[1], 3u);
+  EXPECT_EQ(store.states[1].id, lastId);
+
+  // Removing the last particle only shrinks the arrays
+  store.swapRemove(2);
+  EXPECT_EQ(store.size(), 2ull);
+  EXPECT_FLOAT_EQ(store.positionX[0], 0.f);
+  EXPECT_FLOAT_EQ(store.positionX[1], 3.f);
+
+  store.clear();
+  EXPECT_TRUE(store.empty());
+}
+
+TEST(TestParticleSystem, EmitUpdateAndRecycle)
+{
+  using namespace BABYLON;
+
+  auto subject = createSubject();
+  auto scene   = Scene::New(subject.get());
+
+  // Owned by the scene
+  auto& particleSystem = *new ParticleSystem("particles", 100, scene.get());
+  particleSystem.emitter           = Vector3::Zero();
+  particleSystem.minLifeTime       = 0.5f;
+  particleSystem.maxLifeTime       = 0.5f;
+  particleSystem.updateSpeed       = 0.3f;
+  particleSystem.preWarmStepOffset = 1;
+  particleSystem.gravity           = Vector3(0.f, -1.f, 0.f);
+  particleSystem.manualEmitCount   = 10;
+  particleSystem.start();
+
+  // Emission
+  particleSystem.animate(true);
+  EXPECT_EQ(particleSystem.getActiveCount(), 10ull);
+  for (const auto& particle : particleSystem.particles()) {
+    EXPECT_FLOAT_EQ(particle.age(), 0.f);
+    EXPECT_FLOAT_EQ(particle.lifeTime(), 0.5f);
+  }
+
+  // Default update over the store arrays
+  const auto directionY = particleSystem.particles()[0].direction().y;
+  particleSystem.animate(true);
+  EXPECT_EQ(particleSystem.getActiveCount(), 10ull);
+  for (const auto& particle : particleSystem.particles()) {
+    EXPECT_FLOAT_EQ(particle.age(), 0.3f);
+  }
+  EXPECT_FLOAT_EQ(particleSystem.particles()[0].direction().y, directionY - 0.3f);
+
+  // Particles reaching their life time are recycled
+  particleSystem.animate(true);
+  EXPECT_EQ(particleSystem.getActiveCount(), 0ull);
+}
+
+TEST(TestParticleSystem, CustomUpdateFunction)
+{
+  using namespace BABYLON;
+
+  auto subject = createSubject();
+  auto scene   = Scene::New(subject.get());
+
+  // Owned by the scene
+  auto& particleSystem = *new ParticleSystem("particles", 100, scene.get());
+  particleSystem.emitter           = Vector3::Zero();
+  particleSystem.preWarmStepOffset = 1;
+  particleSystem.manualEmitCount   = 5;
+  particleSystem.updateFunction    = [](std::vector<Particle>& particles) {
+    for (auto& particle : particles) {
+      particle.angle() += 1.f;
+    }
+  };
+  particleSystem.start();
+
+  particleSystem.animate(true);
+  particleSystem.animate(true);
+  ASSERT_EQ(particleSystem.getActiveCount(), 5ull);
+  for (const auto& particle : particleSystem.particles()) {
+    EXPECT_GE(particle.angle(), 1.f);
+  }
+}
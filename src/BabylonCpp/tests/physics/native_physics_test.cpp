@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include <babylon/physics/native/native_physics_body.h>
+#include <babylon/physics/native/native_physics_plugin.h>
+#include <babylon/physics/native/native_physics_shape.h>
+#include <babylon/physics/native/native_physics_world.h>
+
+namespace {
+
+constexpr float timeStep = 1.f / 60.f;
+
+/**
+ * @brief Adds a static ground box whose top face is at y = 0.
+ */
+BABYLON::NativePhysicsBody* CreateGround(BABYLON::NativePhysicsWorld& world)
+{
+  using namespace BABYLON;
+
+  return world.createBody(NativePhysicsShape::CreateBox(Vector3(50.f, 0.5f, 50.f)), 0.f,
+                          Vector3(0.f, -0.5f, 0.f), Quaternion());
+}
+
+void Simulate(BABYLON::NativePhysicsWorld& world, size_t steps)
+{
+  for (size_t i = 0; i < steps; ++i) {
+    world.step(timeStep);
+  }
+}
+
+} // end of anonymous namespace
+
+TEST(TestNativePhysics, ShapesComeToRestOnTheGround)
+{
+  using namespace BABYLON;
+
+  NativePhysicsWorld world;
+  CreateGround(world);
+  auto sphere = world.createBody(NativePhysicsShape::CreateSphere(0.5f), 1.f,
+                                 Vector3(-3.f, 2.f, 0.f), Quaternion());
+  auto box    = world.createBody(NativePhysicsShape::CreateBox(Vector3(0.5f, 0.5f, 0.5f)), 1.f,
+                                 Vector3(0.f, 2.f, 0.f), Quaternion());
+  // Square based pyramid
+  auto hull = world.createBody(
+    NativePhysicsShape::CreateConvexHull({Vector3(-0.5f, -0.5f, -0.5f),
+                                          Vector3(0.5f, -0.5f, -0.5f), Vector3(-0.5f, -0.5f, 0.5f),
+                                          Vector3(0.5f, -0.5f, 0.5f), Vector3(0.f, 0.5f, 0.f)}),
+    1.f, Vector3(3.f, 2.f, 0.f), Quaternion());
+
+  Simulate(world, 300);
+
+  EXPECT_NEAR(sphere->position().y, 0.5f, 0.02f);
+  EXPECT_NEAR(box->position().y, 0.5f, 0.02f);
+  EXPECT_NEAR(hull->position().y, 0.5f, 0.02f);
+  EXPECT_TRUE(sphere->sleeping());
+  EXPECT_TRUE(box->sleeping());
+  EXPECT_TRUE(hull->sleeping());
+  EXPECT_EQ(world.awakeBodyCount(), 0ull);
+}
+
+TEST(TestNativePhysics, BoxStackIsStable)
+{
+  using namespace BABYLON;
+
+  NativePhysicsWorld world;
+  CreateGround(world);
+  std::vector<NativePhysicsBody*> boxes;
+  for (size_t i = 0; i < 8; ++i) {
+    boxes.emplace_back(
+      world.createBody(NativePhysicsShape::CreateBox(Vector3(0.5f, 0.5f, 0.5f)), 1.f,
+                       Vector3(0.f, 0.5f + static_cast<float>(i), 0.f), Quaternion()));
+  }
+
+  Simulate(world, 600);
+
+  for (size_t i = 0; i < boxes.size(); ++i) {
+    const auto& position = boxes[i]->position();
+    EXPECT_NEAR(position.x, 0.f, 0.05f);
+    EXPECT_NEAR(position.y, 0.5f + static_cast<float>(i), 0.05f);
+    EXPECT_NEAR(position.z, 0.f, 0.05f);
+  }
+  EXPECT_EQ(world.awakeIslandCount(), 0ull);
+}
+
+TEST(TestNativePhysics, SleepingBodiesAreWokenUp)
+{
+  using namespace BABYLON;
+
+  NativePhysicsWorld world;
+  CreateGround(world);
+  auto box = world.createBody(NativePhysicsShape::CreateBox(Vector3(0.5f, 0.5f, 0.5f)), 1.f,
+                              Vector3(0.f, 0.5f, 0.f), Quaternion());
+  Simulate(world, 120);
+  ASSERT_TRUE(box->sleeping());
+
+  // A falling sphere wakes up the island it lands on
+  auto sphere = world.createBody(NativePhysicsShape::CreateSphere(0.25f), 1.f,
+                                 Vector3(0.f, 2.f, 0.f), Quaternion());
+  Simulate(world, 60);
+  EXPECT_FALSE(box->sleeping());
+  EXPECT_NEAR(sphere->position().y, 1.25f, 0.02f);
+}
+
+TEST(TestNativePhysics, Raycast)
+{
+  using namespace BABYLON;
+
+  NativePhysicsWorld world;
+  auto ground = CreateGround(world);
+  auto sphere = world.createBody(NativePhysicsShape::CreateSphere(1.f), 1.f,
+                                 Vector3(0.f, 1.f, 0.f), Quaternion());
+
+  NativePhysicsBody* body = nullptr;
+  float fraction          = 0.f;
+  Vector3 normal;
+  ASSERT_TRUE(world.raycast(Vector3(0.f, 10.f, 0.f), Vector3(0.f, -10.f, 0.f), body, fraction,
+                            normal));
+  EXPECT_EQ(body, sphere);
+  EXPECT_NEAR(fraction, 0.4f, 1e-3f);
+  EXPECT_NEAR(normal.y, 1.f, 1e-3f);
+
+  ASSERT_TRUE(world.raycast(Vector3(5.f, 10.f, 0.f), Vector3(5.f, -10.f, 0.f), body, fraction,
+                            normal));
+  EXPECT_EQ(body, ground);
+  EXPECT_NEAR(fraction, 0.5f, 1e-3f);
+
+  EXPECT_FALSE(world.raycast(Vector3(0.f, 10.f, 0.f), Vector3(0.f, 20.f, 0.f), body, fraction,
+                             normal));
+}
+
+TEST(TestNativePhysics, DistanceJointKeepsItsLength)
+{
+  using namespace BABYLON;
+
+  NativePhysicsWorld world;
+  auto anchor = world.createBody(NativePhysicsShape::CreateSphere(0.1f), 0.f,
+                                 Vector3(0.f, 5.f, 0.f), Quaternion());
+  auto bob    = world.createBody(NativePhysicsShape::CreateSphere(0.2f), 1.f,
+                                 Vector3(2.f, 5.f, 0.f), Quaternion());
+  world.createJoint(NativePhysicsJointType::Distance, anchor, bob, Vector3::Zero(),
+                    Vector3::Zero());
+
+  // The pendulum swings down to the vertical of its anchor without stretching
+  auto lowest = bob->position().y;
+  for (size_t i = 0; i < 120; ++i) {
+    world.step(timeStep);
+    EXPECT_NEAR(Vector3::Distance(anchor->position(), bob->position()), 2.f, 0.05f);
+    lowest = std::min(lowest, bob->position().y);
+  }
+  EXPECT_NEAR(lowest, 3.f, 0.05f);
+}
+
+TEST(TestNativePhysics, PluginStepsTheWorldInFixedSteps)
+{
+  using namespace BABYLON;
+
+  NativePhysicsPlugin plugin;
+  plugin.setGravity(Vector3(0.f, -10.f, 0.f));
+  auto& world = plugin.physicsWorld();
+  auto sphere = world.createBody(NativePhysicsShape::CreateSphere(0.5f), 1.f,
+                                 Vector3(0.f, 10.f, 0.f), Quaternion());
+
+  // Half a step does not advance the world, the remaining time is carried over
+  plugin.executeStep(timeStep * 0.5f, {});
+  EXPECT_FLOAT_EQ(sphere->position().y, 10.f);
+  plugin.executeStep(timeStep * 0.5f, {});
+  EXPECT_LT(sphere->position().y, 10.f);
+
+  // Long frames are capped to a few steps
+  const auto velocity = sphere->linearVelocity().y;
+  plugin.executeStep(1.f, {});
+  EXPECT_NEAR(sphere->linearVelocity().y - velocity,
+              -10.f * timeStep * static_cast<float>(NativePhysicsPlugin::MaxSubSteps), 1e-3f);
+}
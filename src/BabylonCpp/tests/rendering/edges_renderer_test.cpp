@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+#include "../test_utils.h"
+
+#include <babylon/engines/scene.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/rendering/edges_renderer.h>
+
+namespace {
+
+/**
+ * @brief Edges renderer exposing the number of generated lines.
+ */
+class TestEdgesRenderer : public BABYLON::EdgesRenderer {
+public:
+  using EdgesRenderer::EdgesRenderer;
+
+  [[nodiscard]] size_t linesCount() const
+  {
+    return _linesIndices.size() / 6;
+  }
+}; // end of class TestEdgesRenderer
+
+/**
+ * @brief Counts the lines of the edges of a mesh by comparing each face with
+ * all the following ones, as the edges renderer did before its adjacencies
+ * were hashed.
+ */
+size_t CountLinesQuadratically(const BABYLON::MeshPtr& mesh, float epsilon,
+                               bool checkVerticesInsteadOfIndices)
+{
+  using namespace BABYLON;
+
+  const auto positions  = mesh->getVerticesData(VertexBuffer::PositionKind);
+  const auto indices    = mesh->getIndices();
+  const auto facesCount = indices.size() / 3;
+
+  const auto vertex = [&positions, &indices](size_t index) {
+    return Vector3::FromArray(positions, indices[index] * 3);
+  };
+  const auto sameVertex = [&](size_t a, size_t b) {
+    return checkVerticesInsteadOfIndices ? vertex(a).equalsWithEpsilon(vertex(b)) :
+                                           indices[a] == indices[b];
+  };
+
+  std::vector<Vector3> faceNormals(facesCount);
+  for (size_t face = 0; face < facesCount; ++face) {
+    const auto p0 = vertex(face * 3), p1 = vertex(face * 3 + 1), p2 = vertex(face * 3 + 2);
+    faceNormals[face] = Vector3::Cross(p1.subtract(p0), p2.subtract(p1));
+    faceNormals[face].normalize();
+  }
+
+  std::vector<std::array<int, 3>> edges(facesCount, {-1, -1, -1});
+  std::vector<unsigned int> edgesConnectedCount(facesCount, 0);
+  for (size_t face = 0; face < facesCount; ++face) {
+    for (size_t other = face + 1; other < facesCount; ++other) {
+      if (edgesConnectedCount[face] == 3) {
+        break;
+      }
+      if (edgesConnectedCount[other] == 3) {
+        continue;
+      }
+      for (size_t edge = 0; edge < 3; ++edge) {
+        if (edges[face][edge] != -1) {
+          continue;
+        }
+        const auto a = face * 3 + edge, b = face * 3 + (edge + 1) % 3;
+        for (size_t otherEdge = 0; otherEdge < 3; ++otherEdge) {
+          const auto c = other * 3 + otherEdge, d = other * 3 + (otherEdge + 1) % 3;
+          if ((sameVertex(a, c) && sameVertex(b, d)) || (sameVertex(a, d) && sameVertex(b, c))) {
+            edges[face][edge]       = static_cast<int>(other);
+            edges[other][otherEdge] = static_cast<int>(face);
+            ++edgesConnectedCount[face];
+            ++edgesConnectedCount[other];
+            break;
+          }
+        }
+        if (edgesConnectedCount[face] == 3) {
+          break;
+        }
+      }
+    }
+  }
+
+  size_t linesCount = 0;
+  for (size_t face = 0; face < facesCount; ++face) {
+    for (auto edge : edges[face]) {
+      if (edge == -1
+          || Vector3::Dot(faceNormals[face], faceNormals[static_cast<size_t>(edge)]) < epsilon) {
+        ++linesCount;
+      }
+    }
+  }
+  return linesCount;
+}
+
+} // end of anonymous namespace
+
+TEST(TestEdgesRenderer, BoxLines)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto box    = Mesh::CreateBox("box", 1.f, scene.get());
+
+  // The faces of the box do not share their vertices: each side of each face
+  // is a border, the diagonals are flat
+  EXPECT_EQ(TestEdgesRenderer(box).linesCount(), 24ull);
+
+  // Welded, the sides of the faces are shared by perpendicular faces and are
+  // drawn once per face
+  EXPECT_EQ(TestEdgesRenderer(box, 0.95f, true).linesCount(), 24ull);
+
+  // Every edge of every triangle when no angle is flat enough
+  EXPECT_EQ(TestEdgesRenderer(box, 1.1f).linesCount(), 36ull);
+  EXPECT_EQ(TestEdgesRenderer(box, 1.1f, true).linesCount(), 36ull);
+}
+
+TEST(TestEdgesRenderer, SphereLines)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  for (unsigned int segments : {4u, 16u}) {
+    auto sphere = Mesh::CreateSphere("sphere", segments, 2.f, scene.get());
+    for (float epsilon : {0.95f, 0.999f}) {
+      const auto byIndices  = TestEdgesRenderer(sphere, epsilon).linesCount();
+      const auto byVertices = TestEdgesRenderer(sphere, epsilon, true).linesCount();
+      EXPECT_EQ(byIndices, CountLinesQuadratically(sphere, epsilon, false))
+        << segments << " segments, epsilon " << epsilon;
+      EXPECT_EQ(byVertices, CountLinesQuadratically(sphere, epsilon, true))
+        << segments << " segments, epsilon " << epsilon;
+
+      // Welding the duplicated vertices of the seam removes its border lines
+      EXPECT_LT(byVertices, byIndices) << segments << " segments, epsilon " << epsilon;
+    }
+  }
+}
@@ -100,7 +100,7 @@ public:
                                Math::PI * 2.f / 3.f, 0.f, scene);
       _light0->diffuse = _lightDiffuse;
       _light0->intensity = 20.f;
-      _light0->includedOnlyMeshes().emplace_back(_torus); // <<<<<<<<<<<<<<<<<<<<<
+      _light0->addIncludedOnlyMesh(_torus); // <<<<<<<<<<<<<<<<<<<<<
       auto shadowGen                          = ShadowGenerator::New(2048, _light0);
       shadowGen->useCloseExponentialShadowMap = true;
       shadowGen->addShadowCaster(_torus); // caster
@@ -112,7 +112,7 @@ public:
       _light1            = PointLight::New("light1", _lightPos, scene);
       _light1->diffuse   = _lightDiffuse;
       _light1->intensity = 200.f;
-      _light1->excludedMeshes().emplace_back(_bulb); // <<<<<<<<<<<<<<<<<<<<<<<<<<
+      _light1->addExcludedMesh(_bulb); // <<<<<<<<<<<<<<<<<<<<<<<<<<
       auto shadowGen                          = ShadowGenerator::New(1024, _light1);
       shadowGen->bias                         = 0.0005f;
       shadowGen->usePercentageCloserFiltering = true;